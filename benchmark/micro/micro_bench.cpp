@@ -0,0 +1,281 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Microbenchmarks for the core data structures on the transfer setup path:
+// nixlDescList construction and lookup, nixlMemSection::populate, and
+// nixlSerDes encode/decode. Run with --benchmark_format=json and compare
+// runs with google-benchmark's tools/compare.py to track regressions.
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "nixl_descriptors.h"
+#include "nixl_types.h"
+#include "backend/backend_engine.h"
+#include "mem_section.h"
+#include "serdes/serdes.h"
+
+namespace {
+
+// Minimal no-op engine: registration hands back a trivial MD, so section
+// population exercises the real lookup machinery without a transport.
+class stubBackendMD : public nixlBackendMD {
+public:
+    stubBackendMD() : nixlBackendMD(true) {}
+};
+
+class stubBackendEngine : public nixlBackendEngine {
+public:
+    explicit stubBackendEngine(const nixlBackendInitParams *init_params)
+        : nixlBackendEngine(init_params) {}
+
+    bool
+    supportsRemote() const override {
+        return false;
+    }
+
+    bool
+    supportsLocal() const override {
+        return true;
+    }
+
+    bool
+    supportsNotif() const override {
+        return false;
+    }
+
+    nixl_mem_list_t
+    getSupportedMems() const override {
+        return {DRAM_SEG};
+    }
+
+    nixl_status_t
+    registerMem(const nixlBlobDesc &mem, const nixl_mem_t &nixl_mem, nixlBackendMD *&out) override {
+        out = new stubBackendMD();
+        return NIXL_SUCCESS;
+    }
+
+    nixl_status_t
+    deregisterMem(nixlBackendMD *meta) override {
+        delete meta;
+        return NIXL_SUCCESS;
+    }
+
+    nixl_status_t
+    connect(const std::string &remote_agent) override {
+        return NIXL_SUCCESS;
+    }
+
+    nixl_status_t
+    disconnect(const std::string &remote_agent) override {
+        return NIXL_SUCCESS;
+    }
+
+    nixl_status_t
+    unloadMD(nixlBackendMD *input) override {
+        delete input;
+        return NIXL_SUCCESS;
+    }
+
+    nixl_status_t
+    prepXfer(const nixl_xfer_op_t &operation,
+             const nixl_meta_dlist_t &local,
+             const nixl_meta_dlist_t &remote,
+             const std::string &remote_agent,
+             nixlBackendReqH *&handle,
+             const nixl_opt_b_args_t *opt_args) const override {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    nixl_status_t
+    postXfer(const nixl_xfer_op_t &operation,
+             const nixl_meta_dlist_t &local,
+             const nixl_meta_dlist_t &remote,
+             const std::string &remote_agent,
+             nixlBackendReqH *&handle,
+             const nixl_opt_b_args_t *opt_args) const override {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    nixl_status_t
+    checkXfer(nixlBackendReqH *handle) const override {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    nixl_status_t
+    releaseReqH(nixlBackendReqH *handle) const override {
+        return NIXL_SUCCESS;
+    }
+};
+
+stubBackendEngine &
+getStubEngine() {
+    static nixl_b_params_t custom_params;
+    static nixlBackendInitParams init_params = [] {
+        nixlBackendInitParams p{};
+        p.localAgent = "micro_bench";
+        p.type = "STUB";
+        p.customParams = &custom_params;
+        p.enableProgTh = false;
+        p.enableTelemetry_ = false;
+        return p;
+    }();
+    static stubBackendEngine engine(&init_params);
+    return engine;
+}
+
+constexpr size_t region_bytes = 1 << 20;
+constexpr size_t region_stride = 2 * region_bytes;
+constexpr uintptr_t region_base = 0x10000;
+
+uintptr_t
+regionAddr(size_t i) {
+    return region_base + i * region_stride;
+}
+
+} // namespace
+
+// In-order append into a sorted list: the common registration pattern,
+// where every insertion lands at the tail
+static void
+BM_DescListAddDesc(benchmark::State &state) {
+    const size_t count = state.range(0);
+    for (auto _ : state) {
+        nixl_xfer_dlist_t dlist(DRAM_SEG);
+        for (size_t i = 0; i < count; i++)
+            dlist.addDesc(nixlBasicDesc(regionAddr(i), region_bytes, 0));
+        benchmark::DoNotOptimize(dlist.descCount());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_DescListAddDesc)->Arg(64)->Arg(1024)->Arg(16384);
+
+// Reverse-order insertion: worst case for the sorted-position search and
+// the element shift
+static void
+BM_DescListAddDescReverse(benchmark::State &state) {
+    const size_t count = state.range(0);
+    for (auto _ : state) {
+        nixl_xfer_dlist_t dlist(DRAM_SEG);
+        for (size_t i = count; i-- > 0;)
+            dlist.addDesc(nixlBasicDesc(regionAddr(i), region_bytes, 0));
+        benchmark::DoNotOptimize(dlist.descCount());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_DescListAddDescReverse)->Arg(64)->Arg(1024)->Arg(16384);
+
+// Exact-match lookup over a sorted list
+static void
+BM_DescListGetIndex(benchmark::State &state) {
+    const size_t count = state.range(0);
+    nixl_xfer_dlist_t dlist(DRAM_SEG);
+    for (size_t i = 0; i < count; i++)
+        dlist.addDesc(nixlBasicDesc(regionAddr(i), region_bytes, 0));
+
+    size_t i = 0;
+    for (auto _ : state) {
+        const nixlBasicDesc query(regionAddr(i), region_bytes, 0);
+        benchmark::DoNotOptimize(dlist.getIndex(query));
+        i = (i + 7919) % count; // coprime stride to defeat the branch predictor
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DescListGetIndex)->Arg(64)->Arg(1024)->Arg(16384);
+
+// Resolving a transfer query against a local section: range(0) registered
+// regions, range(1) query descriptors falling inside them
+static void
+BM_SectionPopulate(benchmark::State &state) {
+    const size_t regions = state.range(0);
+    const size_t query_cnt = state.range(1);
+
+    stubBackendEngine &engine = getStubEngine();
+    nixlLocalSection section;
+    nixl_reg_dlist_t reg_list(DRAM_SEG);
+    for (size_t i = 0; i < regions; i++) {
+        nixlBlobDesc blob(regionAddr(i), region_bytes, 0);
+        reg_list.addDesc(blob);
+    }
+    nixl_sec_dlist_t remote_self(DRAM_SEG);
+    if (section.addDescList(reg_list, &engine, remote_self) != NIXL_SUCCESS) {
+        state.SkipWithError("addDescList failed");
+        return;
+    }
+
+    // Sub-ranges of distinct regions, so every query descriptor takes the
+    // covering-search path
+    nixl_xfer_dlist_t query(DRAM_SEG);
+    for (size_t i = 0; i < query_cnt; i++) {
+        const size_t region = (i * 7919) % regions;
+        query.addDesc(nixlBasicDesc(regionAddr(region) + 0x100, region_bytes / 2, 0));
+    }
+
+    for (auto _ : state) {
+        nixl_meta_dlist_t resp(DRAM_SEG);
+        if (section.populate(query, &engine, resp) != NIXL_SUCCESS) {
+            state.SkipWithError("populate failed");
+            return;
+        }
+        benchmark::DoNotOptimize(resp.descCount());
+    }
+    state.SetItemsProcessed(state.iterations() * query_cnt);
+}
+BENCHMARK(BM_SectionPopulate)
+    ->Args({16, 16})
+    ->Args({256, 64})
+    ->Args({4096, 64})
+    ->Args({4096, 1024});
+
+// Tag/value encoding of a blob of range(0) bytes, the unit of metadata and
+// notification serialization
+static void
+BM_SerDesEncode(benchmark::State &state) {
+    const std::string blob(state.range(0), 'x');
+    for (auto _ : state) {
+        nixlSerDes sd;
+        sd.addStr("agent", "micro_bench");
+        sd.addBuf("blob", blob.data(), blob.size());
+        benchmark::DoNotOptimize(sd.exportStr());
+    }
+    state.SetBytesProcessed(state.iterations() * blob.size());
+}
+BENCHMARK(BM_SerDesEncode)->Arg(64)->Arg(4096)->Arg(65536);
+
+static void
+BM_SerDesDecode(benchmark::State &state) {
+    const std::string blob(state.range(0), 'x');
+    nixlSerDes enc;
+    enc.addStr("agent", "micro_bench");
+    enc.addBuf("blob", blob.data(), blob.size());
+    const std::string wire = enc.exportStr();
+
+    std::vector<char> out(blob.size());
+    for (auto _ : state) {
+        nixlSerDes sd;
+        sd.importStr(wire);
+        benchmark::DoNotOptimize(sd.getStr("agent"));
+        sd.getBuf("blob", out.data(), out.size());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(state.iterations() * blob.size());
+}
+BENCHMARK(BM_SerDesDecode)->Arg(64)->Arg(4096)->Arg(65536);
+
+BENCHMARK_MAIN();
@@ -16,6 +16,7 @@
  */
 
 #include "config.h"
+#include <algorithm>
 #include <iostream>
 #include <nixl.h>
 #include <sys/time.h>
@@ -29,6 +30,9 @@
 #include <unistd.h>
 #include <memory>
 #include <csignal>
+#include <iomanip>
+#include <map>
+#include <sstream>
 
 static std::pair<size_t, size_t> getStrideScheme(xferBenchWorker &worker, int num_threads) {
     int initiator_device, target_device;
@@ -51,6 +55,12 @@ static std::pair<size_t, size_t> getStrideScheme(xferBenchWorker &worker, int nu
         if (worker.isTarget()) {
             count = initiator_device;
         }
+    } else if (XFERBENCH_SCHEME_ALL_TO_ALL == xferBenchConfig::scheme) {
+        // Each target partitions its buffer per initiator; initiators keep
+        // their slice of every target's list during the IOV exchange
+        if (worker.isTarget()) {
+            count = initiator_device;
+        }
     } else if (XFERBENCH_SCHEME_TP == xferBenchConfig::scheme) {
         if (worker.isInitiator()) {
             if (initiator_device < target_device) {
@@ -102,6 +112,60 @@ static std::vector<std::vector<xferBenchIOV>> createTransferDescLists(xferBenchW
     return xfer_lists;
 }
 
+// Runs one (block size, batch size) measurement point on every rank
+static int processPoint(xferBenchWorker &worker,
+                        std::vector<std::vector<xferBenchIOV>> &iov_lists,
+                        size_t block_size, size_t batch_size, int num_threads) {
+    auto local_trans_lists = createTransferDescLists(worker,
+                                                     iov_lists,
+                                                     block_size,
+                                                     batch_size,
+                                                     num_threads);
+
+    if (worker.isTarget()) {
+        if (xferBenchConfig::isStorageBackend()) {
+            std::cerr << "storage backend should be always an initiator" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        worker.exchangeIOV(local_trans_lists, block_size);
+        worker.poll(block_size);
+
+        if (xferBenchConfig::check_consistency && xferBenchConfig::op_type == XFERBENCH_OP_WRITE) {
+            xferBenchUtils::checkConsistency(local_trans_lists);
+        }
+        if (IS_PAIRWISE_AND_SG()) {
+            // TODO: This is here just to call throughput reduction
+            // Separate reduction and print
+            xferBenchUtils::printStats(true, block_size, batch_size, xferBenchStats());
+        }
+    } else if (worker.isInitiator()) {
+        std::vector<std::vector<xferBenchIOV>> remote_trans_lists(
+            worker.exchangeIOV(local_trans_lists, block_size));
+
+        auto result = worker.transfer(block_size, local_trans_lists, remote_trans_lists);
+        if (std::holds_alternative<int>(result)) {
+            return 1;
+        }
+
+        if (xferBenchConfig::check_consistency) {
+            if (xferBenchConfig::op_type == XFERBENCH_OP_READ) {
+                xferBenchUtils::checkConsistency(local_trans_lists);
+            } else if (xferBenchConfig::op_type == XFERBENCH_OP_WRITE) {
+                // Only storage backends support consistency check for write on initiator
+                if (xferBenchConfig::isStorageBackend()) {
+                    xferBenchUtils::checkConsistency(remote_trans_lists);
+                }
+            }
+        }
+
+        xferBenchUtils::printStats(
+            false, block_size, batch_size, std::get<xferBenchStats>(result));
+    }
+
+    return 0;
+}
+
 static int processBatchSizes(xferBenchWorker &worker,
                              std::vector<std::vector<xferBenchIOV>> &iov_lists,
                              size_t block_size, int num_threads) {
@@ -109,54 +173,58 @@ static int processBatchSizes(xferBenchWorker &worker,
          !worker.signaled() &&
              batch_size <= xferBenchConfig::max_batch_size;
          batch_size *= 2) {
-        auto local_trans_lists = createTransferDescLists(worker,
-                                                         iov_lists,
-                                                         block_size,
-                                                         batch_size,
-                                                         num_threads);
-
-        if (worker.isTarget()) {
-            if (xferBenchConfig::isStorageBackend()) {
-                std::cerr << "storage backend should be always an initiator" << std::endl;
-                return EXIT_FAILURE;
-            }
+        int ret = processPoint(worker, iov_lists, block_size, batch_size, num_threads);
+        if (0 != ret) {
+            return ret;
+        }
+    }
 
-            worker.exchangeIOV(local_trans_lists, block_size);
-            worker.poll(block_size);
+    return 0;
+}
 
-            if (xferBenchConfig::check_consistency && xferBenchConfig::op_type == XFERBENCH_OP_WRITE) {
-                xferBenchUtils::checkConsistency(local_trans_lists);
-            }
-            if (IS_PAIRWISE_AND_SG()) {
-                // TODO: This is here just to call throughput reduction
-                // Separate reduction and print
-                xferBenchUtils::printStats(true, block_size, batch_size, xferBenchStats());
-            }
-        } else if (worker.isInitiator()) {
-            std::vector<std::vector<xferBenchIOV>> remote_trans_lists(
-                worker.exchangeIOV(local_trans_lists, block_size));
+// Executes a configured sweep plan in one launch: every rank runs the same
+// phases in order, separated by a runtime barrier so a slow phase on one
+// node cannot let another run ahead, and the per-phase rows accumulate into
+// the one stats table (and CSV/JSON manifest) of the launch
+static int runSweepPlan(xferBenchWorker &worker,
+                        std::vector<std::vector<xferBenchIOV>> &iov_lists,
+                        int num_threads) {
+    std::vector<xferBenchSweepPhase> plan = loadSweepPlan(xferBenchConfig::sweep_plan);
+    if (plan.empty()) {
+        return EXIT_FAILURE;
+    }
 
-            auto result = worker.transfer(block_size, local_trans_lists, remote_trans_lists);
-            if (std::holds_alternative<int>(result)) {
-                return 1;
-            }
+    const int global_num_iter = xferBenchConfig::num_iter;
+    size_t completed = 0;
+    for (const auto &phase : plan) {
+        if (worker.signaled()) {
+            break;
+        }
 
-            if (xferBenchConfig::check_consistency) {
-                if (xferBenchConfig::op_type == XFERBENCH_OP_READ) {
-                    xferBenchUtils::checkConsistency(local_trans_lists);
-                } else if (xferBenchConfig::op_type == XFERBENCH_OP_WRITE) {
-                    // Only storage backends support consistency check for write on initiator
-                    if (xferBenchConfig::isStorageBackend()) {
-                        xferBenchUtils::checkConsistency(remote_trans_lists);
-                    }
-                }
-            }
+        // Per-phase iteration override; transfer() and printStats() read the
+        // iteration count from the config
+        xferBenchConfig::num_iter = (phase.num_iter > 0) ? phase.num_iter : global_num_iter;
+        int ret = processPoint(worker, iov_lists, phase.block_size, phase.batch_size,
+                               num_threads);
+        xferBenchConfig::num_iter = global_num_iter;
+        if (0 != ret) {
+            return ret;
+        }
+        completed++;
 
-            xferBenchUtils::printStats(
-                false, block_size, batch_size, std::get<xferBenchStats>(result));
+        // Phase barrier: re-align all ranks before the next operating point
+        ret = worker.synchronize();
+        if (0 != ret) {
+            return ret;
         }
     }
 
+    if (worker.isInitiator() && worker.isMasterRank()) {
+        xferBenchConfig::printSeparator('-');
+        std::cout << "Sweep plan complete: " << completed << " of " << plan.size()
+                  << " phase(s) executed" << std::endl;
+    }
+
     return 0;
 }
 
@@ -181,6 +249,470 @@ static std::unique_ptr<xferBenchWorker> createWorker(int *argc, char ***argv) {
     }
 }
 
+// One measured point of the storage sweep matrix
+struct storageSweepPoint {
+    std::string backend;
+    std::string posix_api; // Empty for non-POSIX backends
+    int threads;
+    size_t block_size;
+    size_t queue_depth;
+    double gbps;
+    double lat_us;
+};
+
+static std::string storageSweepConfigName(const storageSweepPoint &pt) {
+    std::string name = pt.backend;
+    if (!pt.posix_api.empty()) {
+        name += "/" + pt.posix_api;
+    }
+    return name + " x" + std::to_string(pt.threads) + "thr";
+}
+
+static std::vector<std::string> storageSweepSplit(const std::string &list) {
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+    std::string item;
+
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+// Same throughput/latency math as xferBenchUtils::printStats, without the
+// multi-process reduction; storage sweeps are single-process
+static double storageSweepGbps(size_t block_size, size_t queue_depth,
+                               const xferBenchStats &stats, double &lat_us) {
+    int num_iter = xferBenchConfig::num_iter;
+
+    if (block_size > LARGE_BLOCK_SIZE) {
+        num_iter /= xferBenchConfig::large_blk_iter_ftr;
+    }
+
+    double total_duration = stats.total_duration.avg();
+    double total_data_transferred = (double)(block_size * queue_depth) * num_iter;
+
+    lat_us = total_duration / (num_iter * queue_depth);
+    return (total_data_transferred / (1000 * 1000 * 1000)) / (total_duration / 1e6);
+}
+
+// Storage sweep mode: runs the (plugin, block size, queue depth, thread
+// count) matrix against the storage backends sequentially, one worker per
+// (plugin, thread count) cell, and prints a per-block-size recommendation
+// table at the end. Block sizes and queue depths ride on the regular
+// start/max block and batch size flags.
+static int runStorageSweep(int *argc, char ***argv) {
+    std::vector<storageSweepPoint> results;
+
+    std::signal(SIGINT, xferBenchWorker::signalHandler);
+
+    std::vector<int> thread_counts;
+    for (const auto &item : storageSweepSplit(xferBenchConfig::storage_sweep_threads)) {
+        int threads = atoi(item.c_str());
+        if (threads <= 0) {
+            std::cerr << "Invalid thread count in --storage_sweep_threads: " << item << std::endl;
+            return EXIT_FAILURE;
+        }
+        thread_counts.push_back(threads);
+    }
+    if (thread_counts.empty()) {
+        std::cerr << "--storage_sweep_threads is empty" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::vector<std::string> backend_specs =
+        storageSweepSplit(xferBenchConfig::storage_sweep_backends);
+    if (backend_specs.empty()) {
+        std::cerr << "--storage_sweep_backends is empty" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // clang-format off
+    std::cout << std::left
+              << std::setw(20) << "Config"
+              << std::setw(20) << "Block Size (B)"
+              << std::setw(15) << "Queue Depth"
+              << std::setw(15) << "B/W (GB/Sec)"
+              << std::setw(15) << "Avg Lat. (us)"
+              << std::endl;
+    // clang-format on
+
+    bool signaled = false;
+    for (const auto &spec : backend_specs) {
+        std::string backend = spec;
+        std::string posix_api;
+        size_t colon = spec.find(':');
+        if (colon != std::string::npos) {
+            backend = spec.substr(0, colon);
+            posix_api = spec.substr(colon + 1);
+        }
+
+        xferBenchConfig::backend = backend;
+        if (!xferBenchConfig::isStorageBackend()) {
+            std::cerr << "Skipping non-storage backend in sweep: " << backend << std::endl;
+            continue;
+        }
+        if (!posix_api.empty()) {
+            if (backend != XFERBENCH_BACKEND_POSIX ||
+                (posix_api != XFERBENCH_POSIX_API_AIO &&
+                 posix_api != XFERBENCH_POSIX_API_URING)) {
+                std::cerr << "Skipping invalid sweep backend spec: " << spec << std::endl;
+                continue;
+            }
+            xferBenchConfig::posix_api_type = posix_api;
+        }
+
+        for (int threads : thread_counts) {
+            // GDS_MT parallelizes inside the plugin, the others in the
+            // benchmark's worker threads
+            int worker_threads = threads;
+            if (XFERBENCH_BACKEND_GDS_MT == backend) {
+                xferBenchConfig::gds_mt_num_threads = threads;
+                worker_threads = 1;
+            }
+            xferBenchConfig::num_threads = worker_threads;
+
+            std::unique_ptr<xferBenchWorker> worker = createWorker(argc, argv);
+            if (!worker) {
+                std::cerr << "Skipping sweep cell, failed to create worker for " << spec
+                          << " with " << threads << " thread(s)" << std::endl;
+                continue;
+            }
+            if (0 != worker->synchronizeStart()) {
+                continue;
+            }
+
+            std::vector<std::vector<xferBenchIOV>> iov_lists =
+                worker->allocateMemory(worker_threads);
+            auto mem_guard = make_scope_guard([&] {
+                worker->deallocateMemory(iov_lists);
+            });
+            if (0 != worker->exchangeMetadata()) {
+                continue;
+            }
+
+            for (size_t block_size = xferBenchConfig::start_block_size;
+                 !worker->signaled() && block_size <= xferBenchConfig::max_block_size;
+                 block_size *= 2) {
+                for (size_t queue_depth = xferBenchConfig::start_batch_size;
+                     !worker->signaled() && queue_depth <= xferBenchConfig::max_batch_size;
+                     queue_depth *= 2) {
+                    auto local_trans_lists = createTransferDescLists(
+                        *worker, iov_lists, block_size, queue_depth, worker_threads);
+                    std::vector<std::vector<xferBenchIOV>> remote_trans_lists(
+                        worker->exchangeIOV(local_trans_lists, block_size));
+
+                    auto result =
+                        worker->transfer(block_size, local_trans_lists, remote_trans_lists);
+                    if (std::holds_alternative<int>(result)) {
+                        std::cerr << "Sweep cell failed: " << spec << " block " << block_size
+                                  << " depth " << queue_depth << std::endl;
+                        continue;
+                    }
+
+                    storageSweepPoint pt;
+                    pt.backend = backend;
+                    pt.posix_api = posix_api;
+                    pt.threads = threads;
+                    pt.block_size = block_size;
+                    pt.queue_depth = queue_depth;
+                    pt.gbps = storageSweepGbps(block_size, queue_depth,
+                                               std::get<xferBenchStats>(result), pt.lat_us);
+                    results.push_back(pt);
+
+                    // clang-format off
+                    std::cout << std::left << std::fixed << std::setprecision(6)
+                              << std::setw(20) << storageSweepConfigName(pt)
+                              << std::setw(20) << pt.block_size
+                              << std::setw(15) << pt.queue_depth
+                              << std::setw(15) << pt.gbps
+                              << std::setprecision(1)
+                              << std::setw(15) << pt.lat_us
+                              << std::endl;
+                    // clang-format on
+                }
+            }
+            signaled = worker->signaled();
+            worker->synchronize();
+            if (signaled) {
+                break;
+            }
+        }
+        if (signaled) {
+            break;
+        }
+    }
+
+    if (results.empty()) {
+        std::cerr << "Storage sweep produced no results" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Recommendation table: the best measured (config, queue depth) per
+    // block size, plus the best overall operating point
+    std::map<size_t, storageSweepPoint> best_per_block;
+    const storageSweepPoint *best_overall = &results.front();
+    for (const auto &pt : results) {
+        auto [it, inserted] = best_per_block.try_emplace(pt.block_size, pt);
+        if (!inserted && pt.gbps > it->second.gbps) {
+            it->second = pt;
+        }
+        if (pt.gbps > best_overall->gbps) {
+            best_overall = &pt;
+        }
+    }
+
+    xferBenchConfig::printSeparator('=');
+    std::cout << "Storage sweep recommendations (best config per block size)" << std::endl;
+    xferBenchConfig::printSeparator();
+    // clang-format off
+    std::cout << std::left
+              << std::setw(20) << "Block Size (B)"
+              << std::setw(20) << "Config"
+              << std::setw(15) << "Queue Depth"
+              << std::setw(15) << "B/W (GB/Sec)"
+              << std::setw(15) << "Avg Lat. (us)"
+              << std::endl;
+    // clang-format on
+    for (const auto &[block_size, pt] : best_per_block) {
+        // clang-format off
+        std::cout << std::left << std::fixed << std::setprecision(6)
+                  << std::setw(20) << block_size
+                  << std::setw(20) << storageSweepConfigName(pt)
+                  << std::setw(15) << pt.queue_depth
+                  << std::setw(15) << pt.gbps
+                  << std::setprecision(1)
+                  << std::setw(15) << pt.lat_us
+                  << std::endl;
+        // clang-format on
+    }
+    xferBenchConfig::printSeparator();
+    std::cout << "Best overall: " << storageSweepConfigName(*best_overall)
+              << " at block " << best_overall->block_size
+              << ", queue depth " << best_overall->queue_depth
+              << " (" << std::fixed << std::setprecision(3) << best_overall->gbps
+              << " GB/Sec)" << std::endl;
+    xferBenchConfig::printSeparator('=');
+
+    return signaled ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+#if HAVE_CUDA
+// One flagged direction of the intra-node GPU-to-GPU sweep
+struct gpuTopoPoint {
+    int src;
+    int dst;
+    double gbps;
+    bool peer_access;
+};
+
+// Measures one directed GPU pair through the selected backend: two
+// in-process agents, one per side, exchange metadata directly and the
+// initiator WRITEs src GPU memory into the target's buffer, so the
+// backend's intra-node path (CUDA-IPC for UCX) carries the data. No
+// runtime is involved. Reports GB/sec over num_iter transfers of
+// max_block_size bytes.
+static int runGpuTopoPair(const std::string &backend, int src, int dst, double &gbps) {
+    const std::string pair_tag = std::to_string(src) + "-" + std::to_string(dst);
+    const size_t len = xferBenchConfig::max_block_size;
+
+    nixlAgentConfig cfg(xferBenchConfig::enable_pt);
+    nixlAgent initiator("topo-src-" + pair_tag, cfg);
+    nixlAgent target("topo-dst-" + pair_tag, cfg);
+
+    nixl_b_params_t init_params, tgt_params;
+    nixl_mem_list_t mems;
+    if (NIXL_SUCCESS != initiator.getPluginParams(backend, mems, init_params) ||
+        NIXL_SUCCESS != target.getPluginParams(backend, mems, tgt_params)) {
+        std::cerr << "Failed to get plugin params for backend " << backend << std::endl;
+        return -1;
+    }
+
+    nixlBackendH *init_bknd, *tgt_bknd;
+    if (NIXL_SUCCESS != initiator.createBackend(backend, init_params, init_bknd) ||
+        NIXL_SUCCESS != target.createBackend(backend, tgt_params, tgt_bknd)) {
+        std::cerr << "Failed to create backend " << backend << std::endl;
+        return -1;
+    }
+
+    void *src_buf = nullptr, *dst_buf = nullptr;
+    CHECK_CUDA_ERROR(cudaSetDevice(src), "Failed to set source device");
+    CHECK_CUDA_ERROR(cudaMalloc(&src_buf, len), "Failed to allocate source buffer");
+    CHECK_CUDA_ERROR(cudaMemset(src_buf, XFERBENCH_INITIATOR_BUFFER_ELEMENT, len),
+                     "Failed to fill source buffer");
+    CHECK_CUDA_ERROR(cudaSetDevice(dst), "Failed to set destination device");
+    CHECK_CUDA_ERROR(cudaMalloc(&dst_buf, len), "Failed to allocate destination buffer");
+    auto buf_guard = make_scope_guard([&] {
+        cudaFree(src_buf);
+        cudaFree(dst_buf);
+    });
+
+    nixl_opt_args_t init_extra, tgt_extra;
+    init_extra.backends.push_back(init_bknd);
+    tgt_extra.backends.push_back(tgt_bknd);
+
+    nixl_reg_dlist_t src_rlist(VRAM_SEG), dst_rlist(VRAM_SEG);
+    src_rlist.addDesc(nixlBlobDesc((uintptr_t)src_buf, len, src, ""));
+    dst_rlist.addDesc(nixlBlobDesc((uintptr_t)dst_buf, len, dst, ""));
+    if (NIXL_SUCCESS != initiator.registerMem(src_rlist, &init_extra) ||
+        NIXL_SUCCESS != target.registerMem(dst_rlist, &tgt_extra)) {
+        std::cerr << "Failed to register VRAM for GPU pair " << src << "->" << dst << std::endl;
+        return -1;
+    }
+    auto reg_guard = make_scope_guard([&] {
+        initiator.deregisterMem(src_rlist, &init_extra);
+        target.deregisterMem(dst_rlist, &tgt_extra);
+    });
+
+    std::string md, loaded_name;
+    if (NIXL_SUCCESS != target.getLocalMD(md) ||
+        NIXL_SUCCESS != initiator.loadRemoteMD(md, loaded_name)) {
+        std::cerr << "Failed to exchange metadata for GPU pair " << src << "->" << dst
+                  << std::endl;
+        return -1;
+    }
+
+    nixl_xfer_dlist_t src_descs(VRAM_SEG), dst_descs(VRAM_SEG);
+    src_descs.addDesc(nixlBasicDesc((uintptr_t)src_buf, len, src));
+    dst_descs.addDesc(nixlBasicDesc((uintptr_t)dst_buf, len, dst));
+
+    nixlXferReqH *req = nullptr;
+    if (NIXL_SUCCESS !=
+        initiator.createXferReq(NIXL_WRITE, src_descs, dst_descs, loaded_name, req, &init_extra)) {
+        std::cerr << "Failed to create transfer request for GPU pair " << src << "->" << dst
+                  << std::endl;
+        return -1;
+    }
+    auto req_guard = make_scope_guard([&] {
+        initiator.releaseXferReq(req);
+        initiator.invalidateRemoteMD(loaded_name);
+    });
+
+    int num_iter = xferBenchConfig::num_iter;
+    if (len > (size_t)LARGE_BLOCK_SIZE) {
+        num_iter /= xferBenchConfig::large_blk_iter_ftr;
+    }
+
+    // Each post is drained before the next, so the measurement is a
+    // single stream per pair
+    for (int i = 0; i < xferBenchConfig::warmup_iter; i++) {
+        nixl_status_t status = initiator.postXferReq(req);
+        while (NIXL_IN_PROG == status) {
+            status = initiator.getXferStatus(req);
+        }
+        if (NIXL_SUCCESS != status) {
+            std::cerr << "Warmup transfer failed for GPU pair " << src << "->" << dst
+                      << " with status " << status << std::endl;
+            return -1;
+        }
+    }
+
+    xferBenchTimer timer;
+    for (int i = 0; i < num_iter; i++) {
+        nixl_status_t status = initiator.postXferReq(req);
+        while (NIXL_IN_PROG == status) {
+            status = initiator.getXferStatus(req);
+        }
+        if (NIXL_SUCCESS != status) {
+            std::cerr << "Transfer failed for GPU pair " << src << "->" << dst << " with status "
+                      << status << std::endl;
+            return -1;
+        }
+    }
+    const double total_us = timer.lap();
+
+    gbps = ((double)len * num_iter / (1000.0 * 1000 * 1000)) / (total_us / 1e6);
+    return 0;
+}
+
+// GPU topology sweep mode: benchmarks every local GPU pair through the
+// selected backend and prints the bandwidth matrix, flagging pairs below
+// --gpu_topo_min_gbps (e.g. the NVLink line rate) so cabling/NVSwitch
+// routing problems show up without a full distributed run
+static int runGpuTopoSweep() {
+    int num_gpus = 0;
+    CHECK_CUDA_ERROR(cudaGetDeviceCount(&num_gpus), "Failed to query GPU count");
+    if (num_gpus < 2) {
+        std::cerr << "GPU topology sweep needs at least two GPUs, found " << num_gpus
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::string backend = xferBenchConfig::backend;
+    std::cout << "Sweeping " << num_gpus << " GPUs pairwise through backend " << backend << ", "
+              << xferBenchConfig::max_block_size << "B per transfer" << std::endl;
+
+    std::vector<std::vector<double>> matrix(num_gpus, std::vector<double>(num_gpus, 0.0));
+    std::vector<gpuTopoPoint> flagged;
+
+    for (int src = 0; src < num_gpus; src++) {
+        for (int dst = 0; dst < num_gpus; dst++) {
+            if (src == dst) {
+                continue;
+            }
+            int peer = 0;
+            CHECK_CUDA_ERROR(cudaDeviceCanAccessPeer(&peer, src, dst),
+                             "Failed to query peer access");
+            double gbps = 0.0;
+            if (0 != runGpuTopoPair(backend, src, dst, gbps)) {
+                std::cerr << "GPU pair " << src << "->" << dst << " failed, reporting 0"
+                          << std::endl;
+                gbps = 0.0;
+            }
+            matrix[src][dst] = gbps;
+            if ((xferBenchConfig::gpu_topo_min_gbps > 0.0) &&
+                (gbps < xferBenchConfig::gpu_topo_min_gbps)) {
+                flagged.push_back({src, dst, gbps, 0 != peer});
+            }
+        }
+    }
+
+    xferBenchConfig::printSeparator('=');
+    std::cout << "GPU-to-GPU WRITE bandwidth matrix (GB/Sec) via " << backend << std::endl;
+    xferBenchConfig::printSeparator();
+    std::cout << std::left << std::setw(10) << "src\\dst";
+    for (int dst = 0; dst < num_gpus; dst++) {
+        std::cout << std::setw(10) << ("GPU" + std::to_string(dst));
+    }
+    std::cout << std::endl;
+    for (int src = 0; src < num_gpus; src++) {
+        std::cout << std::left << std::setw(10) << ("GPU" + std::to_string(src));
+        for (int dst = 0; dst < num_gpus; dst++) {
+            if (src == dst) {
+                std::cout << std::setw(10) << "-";
+            } else {
+                std::ostringstream cell;
+                cell << std::fixed << std::setprecision(2) << matrix[src][dst];
+                std::cout << std::setw(10) << cell.str();
+            }
+        }
+        std::cout << std::endl;
+    }
+    xferBenchConfig::printSeparator();
+
+    if (xferBenchConfig::gpu_topo_min_gbps > 0.0) {
+        if (flagged.empty()) {
+            std::cout << "All GPU pairs meet " << xferBenchConfig::gpu_topo_min_gbps
+                      << " GB/Sec" << std::endl;
+        } else {
+            std::cout << "GPU pairs below " << xferBenchConfig::gpu_topo_min_gbps
+                      << " GB/Sec:" << std::endl;
+            for (const auto &pt : flagged) {
+                std::cout << "  GPU" << pt.src << " -> GPU" << pt.dst << ": " << std::fixed
+                          << std::setprecision(2) << pt.gbps << " GB/Sec"
+                          << (pt.peer_access ? "" : " (no peer access, staged through host)")
+                          << std::endl;
+            }
+        }
+    }
+    xferBenchConfig::printSeparator('=');
+
+    return flagged.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+#endif // HAVE_CUDA
+
 int main(int argc, char *argv[]) {
     gflags::ParseCommandLineFlags(&argc, &argv, true);
 
@@ -189,6 +721,31 @@ int main(int argc, char *argv[]) {
         return EXIT_FAILURE;
     }
 
+    if (!xferBenchConfig::json_compare.empty()) {
+        // Offline mode: diff two result manifests, no benchmark is run
+        ret = xferBenchUtils::compareJsonResults(xferBenchConfig::json_compare,
+                                                 xferBenchConfig::json_compare_threshold_pct);
+        gflags::ShutDownCommandLineFlags();
+        return ret;
+    }
+
+    if (xferBenchConfig::storage_sweep) {
+        ret = runStorageSweep(&argc, &argv);
+        gflags::ShutDownCommandLineFlags();
+        return ret;
+    }
+
+    if (xferBenchConfig::gpu_topo_sweep) {
+#if HAVE_CUDA
+        ret = runGpuTopoSweep();
+#else
+        std::cerr << "GPU topology sweep requires CUDA support" << std::endl;
+        ret = EXIT_FAILURE;
+#endif
+        gflags::ShutDownCommandLineFlags();
+        return ret;
+    }
+
     int num_threads = xferBenchConfig::num_threads;
 
     // Create the appropriate worker based on worker configuration
@@ -216,19 +773,85 @@ int main(int argc, char *argv[]) {
         return EXIT_FAILURE;
     }
 
+    const bool trace_mode = !xferBenchConfig::trace_file.empty();
+    const bool soak_mode = 0 != xferBenchConfig::soak_sec;
+    const bool ctrl_mode = !xferBenchConfig::ctrl_bench.empty();
+
     if (worker_ptr->isInitiator() && worker_ptr->isMasterRank()) {
         xferBenchConfig::printConfig();
-        xferBenchUtils::printStatsHeader();
+        if (!trace_mode && !soak_mode && !ctrl_mode) {
+            xferBenchUtils::printStatsHeader();
+        }
     }
 
-    for (size_t block_size = xferBenchConfig::start_block_size;
-         !worker_ptr->signaled() &&
-         block_size <= xferBenchConfig::max_block_size;
-         block_size *= 2) {
-        ret = processBatchSizes(*worker_ptr, iov_lists, block_size, num_threads);
+    if (ctrl_mode) {
+        // Benchmark the control plane instead of data transfers: the worker
+        // runs the notification or metadata loops over the already
+        // established connections, no IOV exchange needed
+        ret = worker_ptr->ctrlBench();
         if (0 != ret) {
             return EXIT_FAILURE;
         }
+    } else if (soak_mode) {
+        // Run continuously at the starting block/batch size instead of
+        // sweeping, reporting rolling-window throughput and latency
+        auto local_trans_lists = createTransferDescLists(*worker_ptr,
+                                                         iov_lists,
+                                                         xferBenchConfig::start_block_size,
+                                                         xferBenchConfig::start_batch_size,
+                                                         num_threads);
+
+        if (worker_ptr->isTarget()) {
+            worker_ptr->exchangeIOV(local_trans_lists, xferBenchConfig::start_block_size);
+            ret = worker_ptr->soak(local_trans_lists, {});
+        } else {
+            std::vector<std::vector<xferBenchIOV>> remote_trans_lists(
+                worker_ptr->exchangeIOV(local_trans_lists, xferBenchConfig::start_block_size));
+            ret = worker_ptr->soak(local_trans_lists, remote_trans_lists);
+        }
+        if (0 != ret) {
+            return EXIT_FAILURE;
+        }
+    } else if (trace_mode) {
+        // Replay a recorded workload instead of the synthetic block-size sweep
+        std::vector<xferBenchTraceEntry> trace = loadTraceFile(xferBenchConfig::trace_file);
+        if (trace.empty()) {
+            return EXIT_FAILURE;
+        }
+        size_t max_size = 0;
+        for (const auto &entry : trace) {
+            max_size = std::max(max_size, entry.size);
+        }
+
+        if (worker_ptr->isTarget()) {
+            worker_ptr->exchangeIOV(iov_lists, max_size);
+            ret = worker_ptr->replayTrace(trace, iov_lists, {});
+        } else {
+            std::vector<std::vector<xferBenchIOV>> remote_iov_lists(
+                worker_ptr->exchangeIOV(iov_lists, max_size));
+            ret = worker_ptr->replayTrace(trace, iov_lists, remote_iov_lists);
+        }
+        if (0 != ret) {
+            return EXIT_FAILURE;
+        }
+    } else if (!xferBenchConfig::sweep_plan.empty()) {
+        // One launch, many operating points: the plan replaces per-point
+        // relaunches (and their runtime re-coordination) with barrier-
+        // separated phases over the already-established connections
+        ret = runSweepPlan(*worker_ptr, iov_lists, num_threads);
+        if (0 != ret) {
+            return EXIT_FAILURE;
+        }
+    } else {
+        for (size_t block_size = xferBenchConfig::start_block_size;
+             !worker_ptr->signaled() &&
+             block_size <= xferBenchConfig::max_block_size;
+             block_size *= 2) {
+            ret = processBatchSizes(*worker_ptr, iov_lists, block_size, num_threads);
+            if (0 != ret) {
+                return EXIT_FAILURE;
+            }
+        }
     }
 
     ret = worker_ptr->synchronize(); // Make sure environment is not used anymore
@@ -236,6 +859,8 @@ int main(int argc, char *argv[]) {
         return EXIT_FAILURE;
     }
 
+    xferBenchUtils::finalizeJsonOutput();
+
     gflags::ShutDownCommandLineFlags();
 
     return worker_ptr->signaled() ? EXIT_FAILURE : EXIT_SUCCESS;
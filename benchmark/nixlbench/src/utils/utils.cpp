@@ -17,7 +17,10 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstring>
+#include <ctime>
+#include <fstream>
 #include <gflags/gflags.h>
 #include <numeric>
 #include <sstream>
@@ -53,7 +56,9 @@ DEFINE_string(initiator_seg_type, XFERBENCH_SEG_TYPE_DRAM, "Type of memory segme
               [DRAM, VRAM]. Note: Storage backends always use DRAM locally.");
 DEFINE_string(target_seg_type, XFERBENCH_SEG_TYPE_DRAM, "Type of memory segment for target \
               [DRAM, VRAM]. Note: Storage backends determine remote type automatically.");
-DEFINE_string(scheme, XFERBENCH_SCHEME_PAIRWISE, "Scheme: pairwise, maytoone, onetomany, tp");
+DEFINE_string(scheme,
+              XFERBENCH_SCHEME_PAIRWISE,
+              "Scheme: pairwise, manytoone, onetomany, tp, alltoall (SG mode only)");
 DEFINE_string(mode, XFERBENCH_MODE_SG, "MODE: SG (Single GPU per proc), MG (Multi GPU per proc) [default: SG]");
 DEFINE_string(op_type, XFERBENCH_OP_WRITE, "Op type: READ, WRITE");
 DEFINE_bool(check_consistency, false, "Enable Consistency Check");
@@ -70,6 +75,63 @@ DEFINE_int32(large_blk_iter_ftr,
              16,
              "factor to reduce test iteration when testing large block size(>1MB)");
 DEFINE_int32(warmup_iter, 100, "Number of warmup iterations before timing");
+DEFINE_bool(per_thread_stats,
+            false,
+            "Report per-thread and aggregate throughput for the timed iterations when multiple "
+            "posting threads share the agent (--num_threads > 1)");
+DEFINE_bool(latency_report,
+            false,
+            "Report per-operation transfer latency percentiles (p50/p90/p99/p999) and jitter "
+            "per block size. Warmup iterations are excluded.");
+DEFINE_string(csv_output_file,
+              "",
+              "Append per-block-size results, including latency percentiles, as CSV rows to "
+              "this file");
+DEFINE_string(json_output_file,
+              "",
+              "Write the results plus the full run config as a machine-readable JSON manifest "
+              "to this file when the run completes");
+DEFINE_string(json_compare,
+              "",
+              "Compare mode: 'baseline.json,candidate.json'. Diffs two manifests produced by "
+              "--json_output_file and exits non-zero when a statistically significant "
+              "transfer-performance regression is found; no benchmark is run.");
+DEFINE_double(json_compare_threshold_pct,
+              5.0,
+              "Flag a row as regressed in --json_compare when its bandwidth drops by more than "
+              "this percentage and the latency delta exceeds two standard errors of the "
+              "per-iteration transfer latency");
+DEFINE_string(sweep_plan,
+              "",
+              "Execute a configured sweep plan instead of the geometric block/batch sweep: one "
+              "phase per line 'block_size batch_size [num_iter]', run in order within a single "
+              "launch with a runtime barrier between phases. All ranks must be given the same "
+              "plan file.");
+DEFINE_string(trace_file,
+              "",
+              "Replay a transfer trace instead of the block-size sweep. One record per line: "
+              "'delay_us size op [peer]' with op READ or WRITE; inter-arrival delays are "
+              "honored. Both sides of a pairwise run must be given the same trace.");
+DEFINE_int32(soak_sec,
+             0,
+             "Soak mode: run continuously at start_block_size/start_batch_size for this many "
+             "seconds instead of the block-size sweep (0=disabled, -1=until interrupted)");
+DEFINE_int32(soak_window_sec,
+             10,
+             "Rolling window length in seconds for soak-mode throughput/latency reporting");
+DEFINE_double(soak_target_gbps,
+              0.0,
+              "Offered load cap per initiator in soak mode, in GB/Sec (0=unthrottled)");
+DEFINE_double(soak_tolerance_pct,
+              20.0,
+              "Flag a soak window as anomalous when its throughput deviates from the running "
+              "baseline by more than this percentage");
+DEFINE_string(ctrl_bench,
+              "",
+              "Control-plane benchmark instead of the data-transfer sweep: 'notif' measures "
+              "notification round-trip latency and rate over the block-size range, 'md' "
+              "measures getLocalMD/loadRemoteMD latency over the batch-size range of "
+              "registered descriptors (nixl worker, non-storage backends only)");
 DEFINE_int32 (
     num_threads,
     1,
@@ -86,6 +148,23 @@ DEFINE_bool(enable_vmm, false, "Enable VMM memory allocation when DRAM is reques
 DEFINE_string (filepath, "", "File path for storage operations");
 DEFINE_int32 (num_files, 1, "Number of files used by benchmark");
 DEFINE_bool (storage_enable_direct, false, "Enable direct I/O for storage operations");
+DEFINE_bool (storage_sweep, false, "Sweep the (plugin, block size, queue depth, thread count) \
+matrix against the storage backends and print a recommendation table");
+DEFINE_string (storage_sweep_backends,
+               "POSIX:AIO,POSIX:URING,GDS,GDS_MT",
+               "Comma-separated storage backends to sweep, POSIX optionally suffixed \
+with :AIO or :URING (only used with --storage_sweep)");
+DEFINE_string (storage_sweep_threads,
+               "1,2,4",
+               "Comma-separated thread counts to sweep (only used with --storage_sweep)");
+
+// Intra-node GPU-to-GPU topology sweep options
+DEFINE_bool (gpu_topo_sweep, false, "Benchmark every local GPU pair through the selected \
+backend and print a bandwidth matrix (single process, no runtime needed)");
+DEFINE_double (gpu_topo_min_gbps,
+               0.0,
+               "Flag GPU pairs whose measured bandwidth falls below this GB/sec \
+(e.g. NVLink line rate); 0 disables flagging (only used with --gpu_topo_sweep)");
 
 // GDS options - only used when backend is GDS
 DEFINE_int32(gds_batch_pool_size, 32, "Batch pool size for GDS operations (default: 32, only used with GDS backend)");
@@ -168,6 +247,19 @@ size_t xferBenchConfig::max_batch_size = 0;
 int xferBenchConfig::num_iter = 0;
 int xferBenchConfig::large_blk_iter_ftr = 16;
 int xferBenchConfig::warmup_iter = 0;
+bool xferBenchConfig::per_thread_stats = false;
+bool xferBenchConfig::latency_report = false;
+std::string xferBenchConfig::csv_output_file = "";
+std::string xferBenchConfig::json_output_file = "";
+std::string xferBenchConfig::json_compare = "";
+double xferBenchConfig::json_compare_threshold_pct = 5.0;
+std::string xferBenchConfig::sweep_plan = "";
+std::string xferBenchConfig::trace_file = "";
+int xferBenchConfig::soak_sec = 0;
+int xferBenchConfig::soak_window_sec = 0;
+double xferBenchConfig::soak_target_gbps = 0.0;
+double xferBenchConfig::soak_tolerance_pct = 0.0;
+std::string xferBenchConfig::ctrl_bench = "";
 int xferBenchConfig::num_threads = 0;
 bool xferBenchConfig::enable_pt = false;
 size_t xferBenchConfig::progress_threads = 0;
@@ -185,6 +277,11 @@ int xferBenchConfig::num_files = 0;
 std::string xferBenchConfig::posix_api_type = "";
 std::string xferBenchConfig::filepath = "";
 bool xferBenchConfig::storage_enable_direct = false;
+bool xferBenchConfig::storage_sweep = false;
+std::string xferBenchConfig::storage_sweep_backends = "";
+std::string xferBenchConfig::storage_sweep_threads = "";
+bool xferBenchConfig::gpu_topo_sweep = false;
+double xferBenchConfig::gpu_topo_min_gbps = 0.0;
 long xferBenchConfig::page_size = sysconf(_SC_PAGESIZE);
 std::string xferBenchConfig::obj_access_key = "";
 std::string xferBenchConfig::obj_secret_key = "";
@@ -312,12 +409,67 @@ xferBenchConfig::loadFromFlags() {
     num_iter = FLAGS_num_iter;
     large_blk_iter_ftr = FLAGS_large_blk_iter_ftr;
     warmup_iter = FLAGS_warmup_iter;
+    per_thread_stats = FLAGS_per_thread_stats;
+    latency_report = FLAGS_latency_report;
+    csv_output_file = FLAGS_csv_output_file;
+    json_output_file = FLAGS_json_output_file;
+    json_compare = FLAGS_json_compare;
+    json_compare_threshold_pct = FLAGS_json_compare_threshold_pct;
+    sweep_plan = FLAGS_sweep_plan;
+    trace_file = FLAGS_trace_file;
+    soak_sec = FLAGS_soak_sec;
+    soak_window_sec = FLAGS_soak_window_sec;
+    soak_target_gbps = FLAGS_soak_target_gbps;
+    soak_tolerance_pct = FLAGS_soak_tolerance_pct;
+    ctrl_bench = FLAGS_ctrl_bench;
     num_threads = FLAGS_num_threads;
     etcd_endpoints = FLAGS_etcd_endpoints;
     filepath = FLAGS_filepath;
     num_files = FLAGS_num_files;
     posix_api_type = FLAGS_posix_api_type;
     storage_enable_direct = FLAGS_storage_enable_direct;
+    storage_sweep = FLAGS_storage_sweep;
+    storage_sweep_backends = FLAGS_storage_sweep_backends;
+    storage_sweep_threads = FLAGS_storage_sweep_threads;
+
+    if (storage_sweep) {
+        if (worker_type != XFERBENCH_WORKER_NIXL) {
+            std::cerr << "Storage sweep mode requires the nixl worker" << std::endl;
+            return -1;
+        }
+        if (!trace_file.empty() || 0 != soak_sec) {
+            std::cerr << "Storage sweep mode cannot be combined with trace replay or soak mode"
+                      << std::endl;
+            return -1;
+        }
+        // The queue-depth axis rides on the batch size; widen the default
+        // range when the user did not set one
+        if (max_batch_size <= 1) {
+            max_batch_size = 64;
+        }
+    }
+
+    if (!sweep_plan.empty() && (!trace_file.empty() || 0 != soak_sec || storage_sweep)) {
+        std::cerr << "Sweep plan mode cannot be combined with trace replay, soak mode, or "
+                     "storage sweep" << std::endl;
+        return -1;
+    }
+
+    gpu_topo_sweep = FLAGS_gpu_topo_sweep;
+    gpu_topo_min_gbps = FLAGS_gpu_topo_min_gbps;
+
+    if (gpu_topo_sweep) {
+        if (worker_type != XFERBENCH_WORKER_NIXL) {
+            std::cerr << "GPU topology sweep mode requires the nixl worker" << std::endl;
+            return -1;
+        }
+        if (storage_sweep || !trace_file.empty() || 0 != soak_sec) {
+            std::cerr << "GPU topology sweep mode cannot be combined with storage sweep, "
+                         "trace replay or soak mode"
+                      << std::endl;
+            return -1;
+        }
+    }
 
     // Validate ETCD configuration
     if (!isStorageBackend() && etcd_endpoints.empty()) {
@@ -348,6 +500,74 @@ xferBenchConfig::loadFromFlags() {
         }
     }
 
+    if (XFERBENCH_SCHEME_ALL_TO_ALL == scheme) {
+        if (XFERBENCH_MODE_SG != mode) {
+            std::cerr << "alltoall scheme requires SG mode (one process per device)" << std::endl;
+            return -1;
+        }
+        if (!trace_file.empty()) {
+            std::cerr << "Trace replay is not supported with the alltoall scheme" << std::endl;
+            return -1;
+        }
+    }
+    if (0 != soak_sec) {
+        if (soak_sec < -1) {
+            std::cerr << "Invalid --soak_sec value, expected -1, 0 or a positive duration"
+                      << std::endl;
+            return -1;
+        }
+        if (soak_window_sec <= 0) {
+            std::cerr << "--soak_window_sec must be greater than 0" << std::endl;
+            return -1;
+        }
+        if (soak_target_gbps < 0.0 || soak_tolerance_pct < 0.0) {
+            std::cerr << "--soak_target_gbps and --soak_tolerance_pct must not be negative"
+                      << std::endl;
+            return -1;
+        }
+        if (!trace_file.empty()) {
+            std::cerr << "Soak mode and trace replay are mutually exclusive" << std::endl;
+            return -1;
+        }
+        if (XFERBENCH_SCHEME_ALL_TO_ALL == scheme) {
+            std::cerr << "Soak mode is not supported with the alltoall scheme" << std::endl;
+            return -1;
+        }
+    }
+
+    if (!ctrl_bench.empty()) {
+        if (XFERBENCH_CTRL_BENCH_NOTIF != ctrl_bench && XFERBENCH_CTRL_BENCH_MD != ctrl_bench) {
+            std::cerr << "Invalid --ctrl_bench value, expected 'notif' or 'md'" << std::endl;
+            return -1;
+        }
+        if (worker_type != XFERBENCH_WORKER_NIXL) {
+            std::cerr << "Control-plane benchmarks require the nixl worker" << std::endl;
+            return -1;
+        }
+        if (isStorageBackend()) {
+            std::cerr << "Control-plane benchmarks are not supported with storage backends"
+                      << std::endl;
+            return -1;
+        }
+        if (!trace_file.empty() || 0 != soak_sec || !sweep_plan.empty() || storage_sweep ||
+            gpu_topo_sweep) {
+            std::cerr << "Control-plane benchmarks cannot be combined with trace replay, soak "
+                         "mode, or the sweep modes" << std::endl;
+            return -1;
+        }
+        if (XFERBENCH_SCHEME_PAIRWISE != scheme || XFERBENCH_MODE_SG != mode) {
+            std::cerr << "Control-plane benchmarks require the pairwise scheme in SG mode"
+                      << std::endl;
+            return -1;
+        }
+    }
+
+    if (IS_INCAST_AND_SG() && 1 != num_target_dev) {
+        std::cerr << "manytoone scheme in SG mode (incast) requires num_target_dev = 1"
+                  << std::endl;
+        return -1;
+    }
+
     if ((max_block_size * max_batch_size) > (total_buffer_size / num_initiator_dev)) {
         std::cerr << "Incorrect buffer size configuration for Initiator"
                   << "(max_block_size * max_batch_size) is > (total_buffer_size / num_initiator_dev)"
@@ -487,7 +707,7 @@ xferBenchConfig::printConfig() {
     }
     printOption ("Initiator seg type (--initiator_seg_type=[DRAM,VRAM])", initiator_seg_type);
     printOption ("Target seg type (--target_seg_type=[DRAM,VRAM])", target_seg_type);
-    printOption ("Scheme (--scheme=[pairwise,manytoone,onetomany,tp])", scheme);
+    printOption ("Scheme (--scheme=[pairwise,manytoone,onetomany,tp,alltoall])", scheme);
     printOption ("Mode (--mode=[SG,MG])", mode);
     printOption ("Op type (--op_type=[READ,WRITE])", op_type);
     printOption ("Check consistency (--check_consistency=[0,1])",
@@ -501,9 +721,33 @@ xferBenchConfig::printConfig() {
     printOption ("Max batch size (--max_batch_size=N)", std::to_string (max_batch_size));
     printOption ("Num iter (--num_iter=N)", std::to_string (num_iter));
     printOption ("Warmup iter (--warmup_iter=N)", std::to_string (warmup_iter));
+    printOption("Latency report (--latency_report=[0,1])", std::to_string(latency_report));
+    if (!csv_output_file.empty()) {
+        printOption("CSV output file (--csv_output_file=path)", csv_output_file);
+    }
+    if (!json_output_file.empty()) {
+        printOption("JSON output file (--json_output_file=path)", json_output_file);
+    }
+    if (!sweep_plan.empty()) {
+        printOption("Sweep plan (--sweep_plan=path)", sweep_plan);
+    }
+    if (!trace_file.empty()) {
+        printOption("Trace file (--trace_file=path)", trace_file);
+    }
+    if (0 != soak_sec) {
+        printOption("Soak duration (--soak_sec=N, -1=unbounded)", std::to_string(soak_sec));
+        printOption("Soak window (--soak_window_sec=N)", std::to_string(soak_window_sec));
+        printOption("Soak target load (--soak_target_gbps=N)", std::to_string(soak_target_gbps));
+        printOption("Soak tolerance (--soak_tolerance_pct=N)",
+                    std::to_string(soak_tolerance_pct));
+    }
+    if (!ctrl_bench.empty()) {
+        printOption("Control-plane benchmark (--ctrl_bench=[notif,md])", ctrl_bench);
+    }
     printOption("Large block iter factor (--large_blk_iter_ftr=N)",
                 std::to_string(large_blk_iter_ftr));
     printOption ("Num threads (--num_threads=N)", std::to_string (num_threads));
+    printOption("Per-thread stats (--per_thread_stats=[0,1])", std::to_string(per_thread_stats));
     printSeparator('-');
     std::cout << std::endl;
 }
@@ -648,6 +892,106 @@ parseGusliDeviceList(const std::string &device_list,
     return devices;
 }
 
+// Implement trace parser (declared in utils.h); shared by main and the workers
+std::vector<xferBenchTraceEntry>
+loadTraceFile(const std::string &path) {
+    std::vector<xferBenchTraceEntry> trace;
+    std::ifstream file(path);
+
+    if (!file) {
+        std::cerr << "Failed to open trace file: " << path << std::endl;
+        return trace;
+    }
+
+    std::string line;
+    size_t lineno = 0;
+    while (std::getline(file, line)) {
+        lineno++;
+        // Strip comments and skip blank lines
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) {
+            line.erase(hash);
+        }
+        std::stringstream ss(line);
+        xferBenchTraceEntry entry;
+        std::string op;
+        if (!(ss >> entry.delay_us)) {
+            continue;
+        }
+        if (!(ss >> entry.size >> op)) {
+            std::cerr << "Invalid trace record at " << path << ":" << lineno
+                      << ". Expected 'delay_us size op [peer]'" << std::endl;
+            return {};
+        }
+        if (XFERBENCH_OP_READ == op) {
+            entry.is_read = true;
+        } else if (XFERBENCH_OP_WRITE == op) {
+            entry.is_read = false;
+        } else {
+            std::cerr << "Invalid trace op '" << op << "' at " << path << ":" << lineno
+                      << ". Must be READ or WRITE" << std::endl;
+            return {};
+        }
+        if (0 == entry.size) {
+            std::cerr << "Invalid zero-size trace record at " << path << ":" << lineno
+                      << std::endl;
+            return {};
+        }
+        ss >> entry.peer;
+        trace.push_back(entry);
+    }
+
+    if (trace.empty()) {
+        std::cerr << "Trace file contains no records: " << path << std::endl;
+    }
+    return trace;
+}
+
+std::vector<xferBenchSweepPhase>
+loadSweepPlan(const std::string &path) {
+    std::vector<xferBenchSweepPhase> plan;
+    std::ifstream file(path);
+
+    if (!file) {
+        std::cerr << "Failed to open sweep plan file: " << path << std::endl;
+        return plan;
+    }
+
+    std::string line;
+    size_t lineno = 0;
+    while (std::getline(file, line)) {
+        lineno++;
+        // Strip comments and skip blank lines
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) {
+            line.erase(hash);
+        }
+        std::stringstream ss(line);
+        xferBenchSweepPhase phase;
+        phase.num_iter = 0;
+        if (!(ss >> phase.block_size)) {
+            continue;
+        }
+        if (!(ss >> phase.batch_size)) {
+            std::cerr << "Invalid sweep phase at " << path << ":" << lineno
+                      << ". Expected 'block_size batch_size [num_iter]'" << std::endl;
+            return {};
+        }
+        if (0 == phase.block_size || 0 == phase.batch_size) {
+            std::cerr << "Invalid zero block or batch size at " << path << ":" << lineno
+                      << std::endl;
+            return {};
+        }
+        ss >> phase.num_iter;
+        plan.push_back(phase);
+    }
+
+    if (plan.empty()) {
+        std::cerr << "Sweep plan contains no phases: " << path << std::endl;
+    }
+    return plan;
+}
+
 void xferBenchUtils::checkConsistency(std::vector<std::vector<xferBenchIOV>> &iov_lists) {
     int i = 0, j = 0;
     static bool gusli_devmap_init = false;
@@ -929,6 +1273,409 @@ xferBenchUtils::printStats(bool is_target,
                   << std::endl;
         // clang-format on
     }
+
+    // Per-operation transfer latency distribution, from the post-warmup
+    // samples only (warmup iterations never reach these stats)
+    if (xferBenchConfig::latency_report) {
+        // clang-format off
+        std::cout << std::left << std::fixed << std::setprecision(1)
+                  << "    Tx lat (us):"
+                  << " p50=" << stats.transfer_duration.p50()
+                  << " p90=" << stats.transfer_duration.p90()
+                  << " p99=" << stats.transfer_duration.p99()
+                  << " p999=" << stats.transfer_duration.p999()
+                  << " min=" << stats.transfer_duration.min()
+                  << " max=" << stats.transfer_duration.max()
+                  << " jitter=" << stats.transfer_duration.stddev()
+                  << std::endl;
+        // clang-format on
+    }
+
+    if (!xferBenchConfig::csv_output_file.empty()) {
+        writeCsvRow(block_size, batch_size, throughput_gb, avg_latency, stats);
+    }
+
+    if (!xferBenchConfig::json_output_file.empty()) {
+        writeJsonRow(block_size, batch_size, throughput_gb, avg_latency, stats);
+    }
+}
+
+void
+xferBenchUtils::writeCsvRow(size_t block_size,
+                            size_t batch_size,
+                            double throughput_gb,
+                            double avg_latency,
+                            xferBenchStats &stats) {
+    static std::ofstream csv;
+    if (!csv.is_open()) {
+        csv.open(xferBenchConfig::csv_output_file, std::ios::out | std::ios::trunc);
+        if (!csv) {
+            std::cerr << "Failed to open CSV output file: " << xferBenchConfig::csv_output_file
+                      << std::endl;
+            return;
+        }
+        csv << "block_size,batch_size,bw_gb_sec,avg_lat_us,"
+            << "prep_avg_us,prep_p99_us,post_avg_us,post_p99_us,"
+            << "tx_avg_us,tx_p50_us,tx_p90_us,tx_p99_us,tx_p999_us,"
+            << "tx_min_us,tx_max_us,tx_jitter_us\n";
+    }
+
+    csv << block_size << ',' << batch_size << ',' << std::fixed << std::setprecision(6)
+        << throughput_gb << ',' << std::setprecision(3) << avg_latency << ','
+        << stats.prepare_duration.avg() << ',' << stats.prepare_duration.p99() << ','
+        << stats.post_duration.avg() << ',' << stats.post_duration.p99() << ','
+        << stats.transfer_duration.avg() << ',' << stats.transfer_duration.p50() << ','
+        << stats.transfer_duration.p90() << ',' << stats.transfer_duration.p99() << ','
+        << stats.transfer_duration.p999() << ',' << stats.transfer_duration.min() << ','
+        << stats.transfer_duration.max() << ',' << stats.transfer_duration.stddev() << '\n';
+    csv.flush();
+}
+
+// One collected --json_output_file result row; the manifest is written in
+// one piece by finalizeJsonOutput, so an aborted run leaves no partial file
+struct xferBenchJsonRow {
+    size_t block_size;
+    size_t batch_size;
+    double bw_gb_sec;
+    double avg_lat_us;
+    double prep_avg_us;
+    double prep_p99_us;
+    double post_avg_us;
+    double post_p99_us;
+    double tx_avg_us;
+    double tx_p50_us;
+    double tx_p90_us;
+    double tx_p99_us;
+    double tx_p999_us;
+    double tx_min_us;
+    double tx_max_us;
+    double tx_jitter_us;
+    size_t tx_samples;
+};
+
+static std::vector<xferBenchJsonRow> json_rows;
+
+static std::string
+jsonEscape(const std::string &s) {
+    std::string out;
+    out.reserve(s.size());
+    for (char c : s) {
+        if ('"' == c || '\\' == c) {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out;
+}
+
+void
+xferBenchUtils::writeJsonRow(size_t block_size,
+                             size_t batch_size,
+                             double throughput_gb,
+                             double avg_latency,
+                             xferBenchStats &stats) {
+    xferBenchJsonRow row;
+
+    row.block_size = block_size;
+    row.batch_size = batch_size;
+    row.bw_gb_sec = throughput_gb;
+    row.avg_lat_us = avg_latency;
+    row.prep_avg_us = stats.prepare_duration.avg();
+    row.prep_p99_us = stats.prepare_duration.p99();
+    row.post_avg_us = stats.post_duration.avg();
+    row.post_p99_us = stats.post_duration.p99();
+    row.tx_avg_us = stats.transfer_duration.avg();
+    row.tx_p50_us = stats.transfer_duration.p50();
+    row.tx_p90_us = stats.transfer_duration.p90();
+    row.tx_p99_us = stats.transfer_duration.p99();
+    row.tx_p999_us = stats.transfer_duration.p999();
+    row.tx_min_us = stats.transfer_duration.min();
+    row.tx_max_us = stats.transfer_duration.max();
+    row.tx_jitter_us = stats.transfer_duration.stddev();
+    row.tx_samples = stats.transfer_duration.count();
+
+    json_rows.push_back(row);
+}
+
+void
+xferBenchUtils::finalizeJsonOutput() {
+    if (xferBenchConfig::json_output_file.empty() || json_rows.empty()) {
+        return;
+    }
+
+    std::ofstream json(xferBenchConfig::json_output_file, std::ios::out | std::ios::trunc);
+    if (!json) {
+        std::cerr << "Failed to open JSON output file: " << xferBenchConfig::json_output_file
+                  << std::endl;
+        return;
+    }
+
+    char timestamp[32] = "";
+    time_t now = time(nullptr);
+    struct tm tm_utc;
+    if (nullptr != gmtime_r(&now, &tm_utc)) {
+        strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", &tm_utc);
+    }
+
+    auto str = [](const std::string &key, const std::string &value) {
+        return "\"" + key + "\": \"" + jsonEscape(value) + "\"";
+    };
+    auto num = [](const std::string &key, const std::string &value) {
+        return "\"" + key + "\": " + value;
+    };
+
+    json << "{\n";
+    json << "  \"schema\": \"nixlbench-results-1\",\n";
+#ifdef NIXLBENCH_VERSION
+    json << "  " << str("nixlbench_version", NIXLBENCH_VERSION) << ",\n";
+#else
+    json << "  " << str("nixlbench_version", "unknown") << ",\n";
+#endif
+    json << "  " << str("timestamp_utc", timestamp) << ",\n";
+
+    json << "  \"config\": {\n";
+    // clang-format off
+    json << "    " << str("benchmark_group", xferBenchConfig::benchmark_group) << ",\n"
+         << "    " << str("runtime_type", xferBenchConfig::runtime_type) << ",\n"
+         << "    " << str("worker_type", xferBenchConfig::worker_type) << ",\n"
+         << "    " << str("backend", xferBenchConfig::backend) << ",\n"
+         << "    " << str("initiator_seg_type", xferBenchConfig::initiator_seg_type) << ",\n"
+         << "    " << str("target_seg_type", xferBenchConfig::target_seg_type) << ",\n"
+         << "    " << str("scheme", xferBenchConfig::scheme) << ",\n"
+         << "    " << str("mode", xferBenchConfig::mode) << ",\n"
+         << "    " << str("op_type", xferBenchConfig::op_type) << ",\n"
+         << "    " << str("device_list", xferBenchConfig::device_list) << ",\n"
+         << "    " << num("total_buffer_size",
+                          std::to_string(xferBenchConfig::total_buffer_size)) << ",\n"
+         << "    " << num("num_initiator_dev",
+                          std::to_string(xferBenchConfig::num_initiator_dev)) << ",\n"
+         << "    " << num("num_target_dev",
+                          std::to_string(xferBenchConfig::num_target_dev)) << ",\n"
+         << "    " << num("start_block_size",
+                          std::to_string(xferBenchConfig::start_block_size)) << ",\n"
+         << "    " << num("max_block_size",
+                          std::to_string(xferBenchConfig::max_block_size)) << ",\n"
+         << "    " << num("start_batch_size",
+                          std::to_string(xferBenchConfig::start_batch_size)) << ",\n"
+         << "    " << num("max_batch_size",
+                          std::to_string(xferBenchConfig::max_batch_size)) << ",\n"
+         << "    " << num("num_iter", std::to_string(xferBenchConfig::num_iter)) << ",\n"
+         << "    " << num("large_blk_iter_ftr",
+                          std::to_string(xferBenchConfig::large_blk_iter_ftr)) << ",\n"
+         << "    " << num("warmup_iter", std::to_string(xferBenchConfig::warmup_iter)) << ",\n"
+         << "    " << num("num_threads", std::to_string(xferBenchConfig::num_threads)) << ",\n"
+         << "    " << num("progress_threads",
+                          std::to_string(xferBenchConfig::progress_threads)) << ",\n"
+         << "    " << num("enable_pt", xferBenchConfig::enable_pt ? "true" : "false") << ",\n"
+         << "    " << num("check_consistency",
+                          xferBenchConfig::check_consistency ? "true" : "false") << "\n";
+    // clang-format on
+    json << "  },\n";
+
+    json << "  \"results\": [\n";
+    for (size_t i = 0; i < json_rows.size(); i++) {
+        const xferBenchJsonRow &row = json_rows[i];
+        // clang-format off
+        json << "    {"
+             << "\"block_size\": " << row.block_size << ", "
+             << "\"batch_size\": " << row.batch_size << ", "
+             << std::fixed << std::setprecision(6)
+             << "\"bw_gb_sec\": " << row.bw_gb_sec << ", "
+             << std::setprecision(3)
+             << "\"avg_lat_us\": " << row.avg_lat_us << ", "
+             << "\"prep_avg_us\": " << row.prep_avg_us << ", "
+             << "\"prep_p99_us\": " << row.prep_p99_us << ", "
+             << "\"post_avg_us\": " << row.post_avg_us << ", "
+             << "\"post_p99_us\": " << row.post_p99_us << ", "
+             << "\"tx_avg_us\": " << row.tx_avg_us << ", "
+             << "\"tx_p50_us\": " << row.tx_p50_us << ", "
+             << "\"tx_p90_us\": " << row.tx_p90_us << ", "
+             << "\"tx_p99_us\": " << row.tx_p99_us << ", "
+             << "\"tx_p999_us\": " << row.tx_p999_us << ", "
+             << "\"tx_min_us\": " << row.tx_min_us << ", "
+             << "\"tx_max_us\": " << row.tx_max_us << ", "
+             << "\"tx_jitter_us\": " << row.tx_jitter_us << ", "
+             << "\"tx_samples\": " << row.tx_samples
+             << "}" << (i + 1 < json_rows.size() ? "," : "") << "\n";
+        // clang-format on
+    }
+    json << "  ]\n";
+    json << "}\n";
+
+    std::cout << "JSON results written to " << xferBenchConfig::json_output_file << std::endl;
+}
+
+// Minimal extractor for the manifests nixlbench writes itself; the benchmark
+// carries no JSON library dependency, so this is not a general parser
+static bool
+jsonFindNumber(const std::string &obj, const std::string &key, double &out) {
+    size_t pos = obj.find("\"" + key + "\"");
+    if (std::string::npos == pos) {
+        return false;
+    }
+    pos = obj.find(':', pos);
+    if (std::string::npos == pos) {
+        return false;
+    }
+    try {
+        out = std::stod(obj.substr(pos + 1));
+    } catch (const std::exception &) {
+        return false;
+    }
+    return true;
+}
+
+static std::vector<xferBenchJsonRow>
+loadJsonRows(const std::string &path) {
+    std::vector<xferBenchJsonRow> rows;
+    std::ifstream in(path);
+
+    if (!in) {
+        std::cerr << "Failed to open JSON results file: " << path << std::endl;
+        return rows;
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+    std::string text = ss.str();
+
+    size_t pos = text.find("\"results\"");
+    if (std::string::npos == pos) {
+        std::cerr << "No results array in " << path << std::endl;
+        return rows;
+    }
+
+    // Result rows are flat objects, so scanning brace pairs is sufficient
+    while (true) {
+        size_t open = text.find('{', pos);
+        if (std::string::npos == open) {
+            break;
+        }
+        size_t close = text.find('}', open);
+        if (std::string::npos == close) {
+            break;
+        }
+        std::string obj = text.substr(open, close - open + 1);
+        pos = close + 1;
+
+        xferBenchJsonRow row = {};
+        double value;
+        if (!jsonFindNumber(obj, "block_size", value)) {
+            continue;
+        }
+        row.block_size = (size_t)value;
+        if (!jsonFindNumber(obj, "batch_size", value)) {
+            continue;
+        }
+        row.batch_size = (size_t)value;
+        if (!jsonFindNumber(obj, "bw_gb_sec", row.bw_gb_sec) ||
+            !jsonFindNumber(obj, "avg_lat_us", row.avg_lat_us) ||
+            !jsonFindNumber(obj, "tx_avg_us", row.tx_avg_us) ||
+            !jsonFindNumber(obj, "tx_jitter_us", row.tx_jitter_us)) {
+            continue;
+        }
+        if (jsonFindNumber(obj, "tx_samples", value)) {
+            row.tx_samples = (size_t)value;
+        }
+        rows.push_back(row);
+    }
+
+    return rows;
+}
+
+int
+xferBenchUtils::compareJsonResults(const std::string &spec, double threshold_pct) {
+    size_t comma = spec.find(',');
+    if (std::string::npos == comma || 0 == comma || spec.size() - 1 == comma) {
+        std::cerr << "Expected --json_compare=baseline.json,candidate.json" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::string baseline_path = spec.substr(0, comma);
+    std::string candidate_path = spec.substr(comma + 1);
+    std::vector<xferBenchJsonRow> baseline = loadJsonRows(baseline_path);
+    std::vector<xferBenchJsonRow> candidate = loadJsonRows(candidate_path);
+
+    if (baseline.empty() || candidate.empty()) {
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Comparing " << candidate_path << " against " << baseline_path
+              << " (threshold " << threshold_pct << "%)" << std::endl;
+    // clang-format off
+    std::cout << std::left
+              << std::setw(20) << "Block Size (B)"
+              << std::setw(15) << "Batch Size"
+              << std::setw(18) << "Base BW (GB/Sec)"
+              << std::setw(18) << "Cand BW (GB/Sec)"
+              << std::setw(12) << "Delta (%)"
+              << std::setw(12) << "Verdict"
+              << std::endl;
+    // clang-format on
+    xferBenchConfig::printSeparator('-');
+
+    int compared = 0, regressions = 0;
+    for (const auto &base : baseline) {
+        const xferBenchJsonRow *cand = nullptr;
+        for (const auto &row : candidate) {
+            if (row.block_size == base.block_size && row.batch_size == base.batch_size) {
+                cand = &row;
+                break;
+            }
+        }
+        if (nullptr == cand) {
+            std::cout << "Missing row in candidate: block_size=" << base.block_size
+                      << " batch_size=" << base.batch_size << std::endl;
+            continue;
+        }
+        compared++;
+
+        double drop_pct = 0.0;
+        if (base.bw_gb_sec > 0.0) {
+            drop_pct = (base.bw_gb_sec - cand->bw_gb_sec) / base.bw_gb_sec * 100.0;
+        }
+
+        // Two-sample z-test on the mean per-iteration transfer latency; the
+        // jitter column is the sample standard deviation. Without sample
+        // counts (older manifests) the bandwidth threshold decides alone.
+        bool significant = true;
+        if (base.tx_samples > 0 && cand->tx_samples > 0) {
+            double std_err = std::sqrt(base.tx_jitter_us * base.tx_jitter_us / base.tx_samples +
+                                       cand->tx_jitter_us * cand->tx_jitter_us / cand->tx_samples);
+            if (std_err > 0.0) {
+                significant = (cand->tx_avg_us - base.tx_avg_us) > 2.0 * std_err;
+            }
+        }
+
+        bool regressed = drop_pct > threshold_pct && significant;
+        if (regressed) {
+            regressions++;
+        }
+
+        const char *verdict = regressed                      ? "REGRESSED" :
+            (drop_pct > threshold_pct)                       ? "NOISE" :
+            (-drop_pct > threshold_pct)                      ? "IMPROVED" :
+                                                               "OK";
+        // clang-format off
+        std::cout << std::left << std::fixed
+                  << std::setw(20) << base.block_size
+                  << std::setw(15) << base.batch_size
+                  << std::setprecision(6)
+                  << std::setw(18) << base.bw_gb_sec
+                  << std::setw(18) << cand->bw_gb_sec
+                  << std::setprecision(2)
+                  << std::setw(12) << -drop_pct
+                  << std::setw(12) << verdict
+                  << std::endl;
+        // clang-format on
+    }
+    xferBenchConfig::printSeparator('-');
+
+    if (0 == compared) {
+        std::cerr << "No comparable rows between the two result files" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << compared << " row(s) compared, " << regressions << " regression(s)" << std::endl;
+    return (regressions > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
 }
 
 std::string
@@ -1081,27 +1828,47 @@ xferMetricStats::avg() const {
 }
 
 double
-xferMetricStats::p90() {
+xferMetricStats::stddev() const {
+    if (samples.size() < 2) return 0;
+    double mean = avg();
+    double sq_sum = 0;
+    for (double s : samples) {
+        sq_sum += (s - mean) * (s - mean);
+    }
+    return std::sqrt(sq_sum / (samples.size() - 1));
+}
+
+double
+xferMetricStats::percentile(double q) {
     if (samples.empty()) return 0;
     std::sort(samples.begin(), samples.end());
-    size_t index = samples.size() * 0.9;
+    size_t index = samples.size() * q;
     return samples[std::min(index, samples.size() - 1)];
 }
 
+double
+xferMetricStats::p50() {
+    return percentile(0.5);
+}
+
+double
+xferMetricStats::p90() {
+    return percentile(0.9);
+}
+
 double
 xferMetricStats::p95() {
-    if (samples.empty()) return 0;
-    std::sort(samples.begin(), samples.end());
-    size_t index = samples.size() * 0.95;
-    return samples[std::min(index, samples.size() - 1)];
+    return percentile(0.95);
 }
 
 double
 xferMetricStats::p99() {
-    if (samples.empty()) return 0;
-    std::sort(samples.begin(), samples.end());
-    size_t index = samples.size() * 0.99;
-    return samples[std::min(index, samples.size() - 1)];
+    return percentile(0.99);
+}
+
+double
+xferMetricStats::p999() {
+    return percentile(0.999);
 }
 
 void
@@ -1124,6 +1891,11 @@ xferMetricStats::clear() {
     samples.clear();
 }
 
+size_t
+xferMetricStats::count() const {
+    return samples.size();
+}
+
 /*
  * xferBenchStats
  */
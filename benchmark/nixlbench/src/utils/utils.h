@@ -100,6 +100,7 @@
 #define XFERBENCH_SCHEME_ONE_TO_MANY  "onetomany"
 #define XFERBENCH_SCHEME_MANY_TO_ONE  "manytoone"
 #define XFERBENCH_SCHEME_TP           "tp"
+#define XFERBENCH_SCHEME_ALL_TO_ALL   "alltoall"
 
 // Operation types
 #define XFERBENCH_OP_READ  "READ"
@@ -109,6 +110,10 @@
 #define XFERBENCH_MODE_SG  "SG"
 #define XFERBENCH_MODE_MG  "MG"
 
+// Control-plane benchmark modes (--ctrl_bench)
+#define XFERBENCH_CTRL_BENCH_NOTIF "notif"
+#define XFERBENCH_CTRL_BENCH_MD    "md"
+
 // Segment types
 #define XFERBENCH_SEG_TYPE_DRAM "DRAM"
 #define XFERBENCH_SEG_TYPE_VRAM "VRAM"
@@ -122,6 +127,12 @@
                               XFERBENCH_MODE_SG == xferBenchConfig::mode)
 #define IS_PAIRWISE_AND_MG() (XFERBENCH_SCHEME_PAIRWISE == xferBenchConfig::scheme && \
                               XFERBENCH_MODE_MG == xferBenchConfig::mode)
+// manytoone in SG mode is an incast: every initiator process writes to the
+// single target process at the same time
+#define IS_INCAST_AND_SG() (XFERBENCH_SCHEME_MANY_TO_ONE == xferBenchConfig::scheme && \
+                            XFERBENCH_MODE_SG == xferBenchConfig::mode)
+#define IS_ALL_TO_ALL_AND_SG() (XFERBENCH_SCHEME_ALL_TO_ALL == xferBenchConfig::scheme && \
+                                XFERBENCH_MODE_SG == xferBenchConfig::mode)
 class xferBenchConfig {
     public:
         static std::string runtime_type;
@@ -143,6 +154,19 @@ class xferBenchConfig {
         static int num_iter;
         static int large_blk_iter_ftr;
         static int warmup_iter;
+        static bool per_thread_stats;
+        static bool latency_report;
+        static std::string csv_output_file;
+        static std::string json_output_file;
+        static std::string json_compare;
+        static double json_compare_threshold_pct;
+        static std::string sweep_plan;
+        static std::string trace_file;
+        static int soak_sec;
+        static int soak_window_sec;
+        static double soak_target_gbps;
+        static double soak_tolerance_pct;
+        static std::string ctrl_bench;
         static int num_threads;
         static bool enable_pt;
         static size_t progress_threads;
@@ -154,6 +178,11 @@ class xferBenchConfig {
         static int num_files;
         static std::string posix_api_type;
         static bool storage_enable_direct;
+        static bool storage_sweep;
+        static std::string storage_sweep_backends;
+        static std::string storage_sweep_threads;
+        static bool gpu_topo_sweep;
+        static double gpu_topo_min_gbps;
         static int gds_batch_pool_size;
         static int gds_batch_limit;
         static int gds_mt_num_threads;
@@ -206,6 +235,33 @@ parseGusliDeviceList(const std::string &device_list,
                      const std::string &security_list,
                      int num_devices);
 
+// One record of a transfer trace: wait delay_us after the previous record,
+// then post a size-byte READ or WRITE towards peer
+struct xferBenchTraceEntry {
+    uint64_t delay_us;
+    size_t size;
+    bool is_read;
+    std::string peer;
+};
+
+// Parser for trace files: one record per line, "delay_us size op [peer]",
+// op is READ or WRITE, '#' starts a comment. Returns an empty vector on error.
+std::vector<xferBenchTraceEntry>
+loadTraceFile(const std::string &path);
+
+// One phase of a --sweep_plan run; num_iter <= 0 keeps the global setting
+struct xferBenchSweepPhase {
+    size_t block_size;
+    size_t batch_size;
+    int num_iter;
+};
+
+// Parser for sweep plan files: one phase per line, "block_size batch_size
+// [num_iter]", '#' starts a comment. All ranks must be given the same plan
+// so the inter-phase barriers line up. Returns an empty vector on error.
+std::vector<xferBenchSweepPhase>
+loadSweepPlan(const std::string &path);
+
 // Timer class for measuring durations at high resolution
 class xferBenchTimer {
 public:
@@ -228,12 +284,19 @@ public:
     max() const;
     double
     avg() const;
+    // Jitter as the standard deviation of the samples
+    double
+    stddev() const;
+    double
+    p50();
     double
     p90();
     double
     p95();
     double
     p99();
+    double
+    p999();
 
     void
     add(double value);
@@ -243,8 +306,13 @@ public:
     reserve(size_t n);
     void
     clear();
+    size_t
+    count() const;
 
 private:
+    double
+    percentile(double q);
+
     std::vector<double> samples;
 };
 
@@ -315,6 +383,26 @@ class xferBenchUtils {
         printStatsHeader();
         static void
         printStats(bool is_target, size_t block_size, size_t batch_size, xferBenchStats stats);
+        static void
+        writeCsvRow(size_t block_size,
+                    size_t batch_size,
+                    double throughput_gb,
+                    double avg_latency,
+                    xferBenchStats &stats);
+        static void
+        writeJsonRow(size_t block_size,
+                     size_t batch_size,
+                     double throughput_gb,
+                     double avg_latency,
+                     xferBenchStats &stats);
+        // Writes the collected rows plus the full run config as a JSON
+        // manifest; no-op when --json_output_file is unset or nothing ran
+        static void
+        finalizeJsonOutput();
+        // Compare mode: spec is "baseline.json,candidate.json". Returns the
+        // process exit code, non-zero when a significant regression is found.
+        static int
+        compareJsonResults(const std::string &spec, double threshold_pct);
 };
 
 #endif // __UTILS_H
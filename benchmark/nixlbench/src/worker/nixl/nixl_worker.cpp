@@ -18,6 +18,7 @@
 #include "worker/nixl/nixl_worker.h"
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <cstring>
 #if HAVE_CUDA
 #include <cuda.h>
@@ -26,6 +27,7 @@
 #include <fcntl.h>
 #include <filesystem>
 #include <iomanip>
+#include <numeric>
 #include <sstream>
 #include "utils/utils.h"
 #include <unistd.h>
@@ -106,9 +108,20 @@ xferBenchNixlWorker::xferBenchNixlWorker(int *argc, char ***argv, std::vector<st
 
     rank = rt->getRank();
 
-    nixlAgentConfig dev_meta(enable_pt, false, 0, sync_mode);
-
-    agent = new nixlAgent(name, dev_meta);
+    // In soak mode force-enable agent telemetry so the rolling throughput
+    // and latency also land in the shared telemetry ring for external
+    // readers, independent of the console window reports
+    nixlAgentConfig dev_meta(
+        enable_pt, false, 0, sync_mode, 1, 0, 100000, 0 != xferBenchConfig::soak_sec);
+
+    if (IS_ALL_TO_ALL_AND_SG() && isTarget()) {
+        // Every initiator addresses every target, so each target agent needs
+        // a unique name instead of the shared role name
+        agent = new nixlAgent(
+            name + "_" + std::to_string(rank - xferBenchConfig::num_initiator_dev), dev_meta);
+    } else {
+        agent = new nixlAgent(name, dev_meta);
+    }
 
     agent->getAvailPlugins(plugins);
 
@@ -947,7 +960,7 @@ xferBenchNixlWorker::exchangeMetadata() {
     if (isTarget()) {
         std::string local_metadata;
         const char *buffer;
-        int destrank;
+        std::vector<int> destranks;
 
         agent->getLocalMD(local_metadata);
 
@@ -955,44 +968,61 @@ xferBenchNixlWorker::exchangeMetadata() {
         meta_sz = local_metadata.size();
 
         if (IS_PAIRWISE_AND_SG()) {
-            destrank = rt->getRank() - xferBenchConfig::num_target_dev;
+            destranks.push_back(rt->getRank() - xferBenchConfig::num_target_dev);
             // XXX: Fix up the rank, depends on processes distributed on hosts
             // assumes placement is adjacent ranks to same node
+        } else if (IS_INCAST_AND_SG() || IS_ALL_TO_ALL_AND_SG()) {
+            // Every initiator transfers to this target
+            for (int i = 0; i < xferBenchConfig::num_initiator_dev; i++) {
+                destranks.push_back(i);
+            }
         } else {
-            destrank = 0;
+            destranks.push_back(0);
+        }
+        for (int destrank : destranks) {
+            rt->sendInt(&meta_sz, destrank);
+            rt->sendChar((char *)buffer, meta_sz, destrank);
         }
-        rt->sendInt(&meta_sz, destrank);
-        rt->sendChar((char *)buffer, meta_sz, destrank);
     } else if (isInitiator()) {
-        std::string remote_agent;
-        int srcrank;
+        std::vector<int> srcranks;
 
         if (IS_PAIRWISE_AND_SG()) {
-            srcrank = rt->getRank() + xferBenchConfig::num_initiator_dev;
+            srcranks.push_back(rt->getRank() + xferBenchConfig::num_initiator_dev);
             // XXX: Fix up the rank, depends on processes distributed on hosts
             // assumes placement is adjacent ranks to same node
+        } else if (IS_INCAST_AND_SG()) {
+            // Single target process sits after all initiator ranks
+            srcranks.push_back(xferBenchConfig::num_initiator_dev);
+        } else if (IS_ALL_TO_ALL_AND_SG()) {
+            for (int i = 0; i < xferBenchConfig::num_target_dev; i++) {
+                srcranks.push_back(xferBenchConfig::num_initiator_dev + i);
+            }
         } else {
-            srcrank = 1;
+            srcranks.push_back(1);
         }
 
-        ret = rt->recvInt(&meta_sz, srcrank);
-        if (ret < 0) {
-            std::cerr << "NIXL: failed to receive metadata size" << std::endl;
-            return ret;
-        }
+        for (int srcrank : srcranks) {
+            std::string remote_agent;
 
-        std::string remote_metadata(meta_sz, '\0');
-        ret = rt->recvChar(remote_metadata.data(), meta_sz, srcrank);
-        if (ret < 0) {
-            std::cerr << "NIXL: failed to receive metadata" << std::endl;
-            return ret;
-        }
+            ret = rt->recvInt(&meta_sz, srcrank);
+            if (ret < 0) {
+                std::cerr << "NIXL: failed to receive metadata size" << std::endl;
+                return ret;
+            }
 
-        nixl_status_t status = agent->loadRemoteMD(remote_metadata, remote_agent);
-        if (status != NIXL_SUCCESS) {
-            std::cerr << "NIXL: loadRemoteMD failed: " << nixlEnumStrings::statusStr(status)
-                      << std::endl;
-            return -1;
+            std::string remote_metadata(meta_sz, '\0');
+            ret = rt->recvChar(remote_metadata.data(), meta_sz, srcrank);
+            if (ret < 0) {
+                std::cerr << "NIXL: failed to receive metadata" << std::endl;
+                return ret;
+            }
+
+            nixl_status_t status = agent->loadRemoteMD(remote_metadata, remote_agent);
+            if (status != NIXL_SUCCESS) {
+                std::cerr << "NIXL: loadRemoteMD failed: " << nixlEnumStrings::statusStr(status)
+                          << std::endl;
+                return -1;
+            }
         }
     }
 
@@ -1039,46 +1069,65 @@ xferBenchNixlWorker::exchangeIOV(const std::vector<std::vector<xferBenchIOV>> &l
             }
             res.push_back(remote_iov_list);
         }
-    } else {
+    } else if (isTarget()) {
+        std::vector<int> destranks;
+        if (IS_PAIRWISE_AND_SG()) {
+            destranks.push_back(rt->getRank() - xferBenchConfig::num_target_dev);
+            // XXX: Fix up the rank, depends on processes distributed on hosts
+            // assumes placement is adjacent ranks to same node
+        } else if (IS_INCAST_AND_SG() || IS_ALL_TO_ALL_AND_SG()) {
+            for (int i = 0; i < xferBenchConfig::num_initiator_dev; i++) {
+                destranks.push_back(i);
+            }
+        } else {
+            destranks.push_back(0);
+        }
+
         for (const auto &local_iov : local_iovs) {
             nixlSerDes ser_des;
             nixl_xfer_dlist_t local_desc(seg_type);
 
             iovListToNixlXferDlist(local_iov, local_desc);
-
-            if (isTarget()) {
-                int destrank;
-                if (IS_PAIRWISE_AND_SG()) {
-                    destrank = rt->getRank() - xferBenchConfig::num_target_dev;
-                    // XXX: Fix up the rank, depends on processes distributed on hosts
-                    // assumes placement is adjacent ranks to same node
-                } else {
-                    destrank = 0;
-                }
-
-                local_desc.serialize(&ser_des);
-                std::string desc_str = ser_des.exportStr();
-                desc_str_sz = desc_str.size();
+            local_desc.serialize(&ser_des);
+            std::string desc_str = ser_des.exportStr();
+            desc_str_sz = desc_str.size();
+            // Each initiator receives the full list and keeps its slice
+            for (int destrank : destranks) {
                 rt->sendInt(&desc_str_sz, destrank);
                 rt->sendChar(desc_str.data(), desc_str.size(), destrank);
-            } else if (isInitiator()) {
-                int srcrank;
-                if (IS_PAIRWISE_AND_SG()) {
-                    srcrank = rt->getRank() + xferBenchConfig::num_initiator_dev;
-                    // XXX: Fix up the rank, depends on processes distributed on hosts
-                    // assumes placement is adjacent ranks to same node
-                } else {
-                    srcrank = 1;
-                }
+            }
+        }
+    } else if (isInitiator()) {
+        std::vector<int> srcranks;
+        if (IS_PAIRWISE_AND_SG()) {
+            srcranks.push_back(rt->getRank() + xferBenchConfig::num_initiator_dev);
+            // XXX: Fix up the rank, depends on processes distributed on hosts
+            // assumes placement is adjacent ranks to same node
+        } else if (IS_INCAST_AND_SG()) {
+            srcranks.push_back(xferBenchConfig::num_initiator_dev);
+        } else if (IS_ALL_TO_ALL_AND_SG()) {
+            for (int i = 0; i < xferBenchConfig::num_target_dev; i++) {
+                srcranks.push_back(xferBenchConfig::num_initiator_dev + i);
+            }
+        } else {
+            srcranks.push_back(1);
+        }
 
-                if (rt->recvInt(&desc_str_sz, srcrank) != 0) {
+        a2a_remote_iovs.clear();
+        for (size_t t = 0; t < srcranks.size(); t++) {
+            std::vector<std::vector<xferBenchIOV>> target_lists;
+
+            for (size_t l = 0; l < local_iovs.size(); l++) {
+                nixlSerDes ser_des;
+
+                if (rt->recvInt(&desc_str_sz, srcranks[t]) != 0) {
                     std::cerr << "NIXL: failed to receive metadata size" << std::endl;
                     std::exit(EXIT_FAILURE);
                 }
 
                 std::string desc_str;
                 desc_str.resize(desc_str_sz, '\0');
-                if (rt->recvChar(desc_str.data(), desc_str.size(), srcrank) != 0) {
+                if (rt->recvChar(desc_str.data(), desc_str.size(), srcranks[t]) != 0) {
                     std::cerr << "NIXL: failed to receive metadata" << std::endl;
                     std::exit(EXIT_FAILURE);
                 }
@@ -1086,7 +1135,30 @@ xferBenchNixlWorker::exchangeIOV(const std::vector<std::vector<xferBenchIOV>> &l
                 ser_des.importStr(desc_str);
 
                 nixl_xfer_dlist_t remote_desc(&ser_des);
-                res.emplace_back(nixlXferDlistToIOVList(remote_desc));
+                std::vector<xferBenchIOV> remote_iov_list(nixlXferDlistToIOVList(remote_desc));
+
+                if (IS_INCAST_AND_SG() || IS_ALL_TO_ALL_AND_SG()) {
+                    // The target partitioned its list per initiator
+                    // (getStrideScheme); keep the chunk owned by this rank
+                    const size_t chunk =
+                        remote_iov_list.size() / xferBenchConfig::num_initiator_dev;
+                    if (chunk > 0 &&
+                        0 == remote_iov_list.size() % xferBenchConfig::num_initiator_dev) {
+                        const size_t base = rt->getRank() * chunk;
+                        remote_iov_list =
+                            std::vector<xferBenchIOV>(remote_iov_list.begin() + base,
+                                                      remote_iov_list.begin() + base + chunk);
+                    }
+                }
+
+                target_lists.push_back(std::move(remote_iov_list));
+            }
+
+            if (0 == t) {
+                res = target_lists;
+            }
+            if (IS_ALL_TO_ALL_AND_SG()) {
+                a2a_remote_iovs.push_back(std::move(target_lists));
             }
         }
     }
@@ -1218,16 +1290,23 @@ execTransfer(nixlAgent *agent,
              const nixl_xfer_op_t op,
              const int num_iter,
              const int num_threads,
-             xferBenchStats &stats) {
+             xferBenchStats &stats,
+             const bool report_per_thread = false,
+             const std::string &target_override = "") {
     int ret = 0;
     stats.clear();
 
+    // Per-thread throughput, so that agent-lock contention between posting
+    // threads shows up as uneven or sub-linear per-thread numbers
+    std::vector<double> thread_gbps(num_threads, 0.0);
+
     xferBenchTimer total_timer;
 #pragma omp parallel num_threads(num_threads)
     {
         xferBenchStats thread_stats;
         thread_stats.reserve(num_iter);
         xferBenchTimer timer;
+        xferBenchTimer wall_timer;
         const int tid = omp_get_thread_num();
         const auto &local_iov = local_iovs[tid];
         const auto &remote_iov = remote_iovs[tid];
@@ -1240,6 +1319,9 @@ execTransfer(nixlAgent *agent,
         // Setup transfer parameters
         nixl_opt_args_t params;
         std::string target = xferBenchConfig::isStorageBackend() ? "initiator" : "target";
+        if (!target_override.empty()) {
+            target = target_override;
+        }
         if (!xferBenchConfig::isStorageBackend()) {
             params.notifMsg = "0xBEEF";
             params.hasNotif = true;
@@ -1263,12 +1345,33 @@ execTransfer(nixlAgent *agent,
             ret = result;
         }
 
+        if (report_per_thread) {
+            const nixlTime::us_t thread_duration = wall_timer.lap();
+            size_t thread_bytes = 0;
+            for (const auto &iov : local_iov) {
+                thread_bytes += iov.len;
+            }
+            thread_bytes *= num_iter;
+            thread_gbps[tid] = ((double)thread_bytes / (1000 * 1000 * 1000)) /
+                (thread_duration / 1e6);
+        }
+
 #pragma omp critical
         { stats.add(thread_stats); }
     }
 
     const nixlTime::us_t total_duration = total_timer.lap();
     stats.total_duration.add(total_duration);
+
+    if (report_per_thread && 0 == ret) {
+        const double aggregate = std::accumulate(thread_gbps.begin(), thread_gbps.end(), 0.0);
+        std::cout << std::fixed << std::setprecision(6) << "    Per-thread B/W (GB/Sec):";
+        for (int tid = 0; tid < num_threads; tid++) {
+            std::cout << " t" << tid << "=" << thread_gbps[tid];
+        }
+        std::cout << " aggregate=" << aggregate << std::endl;
+    }
+
     return ret;
 }
 
@@ -1289,6 +1392,53 @@ xferBenchNixlWorker::transfer(size_t block_size,
         num_iter /= xferBenchConfig::large_blk_iter_ftr;
     }
 
+    if (IS_ALL_TO_ALL_AND_SG()) {
+        // Barrier-synchronized phases: in phase p this initiator transfers to
+        // target (rank + p) % T, so every phase keeps all initiators active
+        // and every target loaded, rotating the pairing each phase
+        const int num_targets = xferBenchConfig::num_target_dev;
+        const int my_idx = rt->getRank();
+
+        for (int phase = 0; phase < num_targets && 0 == ret; phase++) {
+            const int tgt = (my_idx + phase) % num_targets;
+            const std::string target_name = "target_" + std::to_string(tgt);
+            const auto &phase_remote_iovs = a2a_remote_iovs[tgt];
+            xferBenchStats phase_stats;
+
+            if (skip > 0) {
+                ret = execTransfer(agent,
+                                   local_iovs,
+                                   phase_remote_iovs,
+                                   xfer_op,
+                                   skip,
+                                   xferBenchConfig::num_threads,
+                                   phase_stats,
+                                   false,
+                                   target_name);
+                if (ret < 0) {
+                    return std::variant<xferBenchStats, int>(ret);
+                }
+            }
+            synchronize();
+
+            ret = execTransfer(agent,
+                               local_iovs,
+                               phase_remote_iovs,
+                               xfer_op,
+                               num_iter,
+                               xferBenchConfig::num_threads,
+                               phase_stats,
+                               xferBenchConfig::per_thread_stats,
+                               target_name);
+            if (ret < 0) {
+                return std::variant<xferBenchStats, int>(ret);
+            }
+            stats.add(phase_stats);
+            synchronize();
+        }
+        return std::variant<xferBenchStats, int>(stats);
+    }
+
     if (skip > 0) {
         ret = execTransfer(
             agent, local_iovs, remote_iovs, xfer_op, skip, xferBenchConfig::num_threads, stats);
@@ -1302,8 +1452,14 @@ xferBenchNixlWorker::transfer(size_t block_size,
 
     stats.clear();
 
-    ret = execTransfer(
-        agent, local_iovs, remote_iovs, xfer_op, num_iter, xferBenchConfig::num_threads, stats);
+    ret = execTransfer(agent,
+                       local_iovs,
+                       remote_iovs,
+                       xfer_op,
+                       num_iter,
+                       xferBenchConfig::num_threads,
+                       stats,
+                       xferBenchConfig::per_thread_stats);
     if (ret < 0) {
         return std::variant<xferBenchStats, int>(ret);
     }
@@ -1312,6 +1468,495 @@ xferBenchNixlWorker::transfer(size_t block_size,
     return std::variant<xferBenchStats, int>(stats);
 }
 
+int
+xferBenchNixlWorker::replayTrace(const std::vector<xferBenchTraceEntry> &trace,
+                                 const std::vector<std::vector<xferBenchIOV>> &local_iovs,
+                                 const std::vector<std::vector<xferBenchIOV>> &remote_iovs) {
+    if (isTarget()) {
+        // Consume one notification per trace record, like poll() does per
+        // iteration in the sweep mode; in an incast every initiator replays
+        // the whole trace
+        const size_t expected = trace.size() *
+            (IS_INCAST_AND_SG() ? xferBenchConfig::num_initiator_dev : 1);
+        nixl_notifs_t notifs;
+        nixl_status_t status;
+        do {
+            status = agent->getNotifs(notifs);
+        } while (status == NIXL_SUCCESS && expected != notifs["initiator"].size());
+        synchronize();
+        return 0;
+    }
+
+    // Replay uses the first thread's buffers; every record is carved from
+    // offset 0 of that partition
+    const xferBenchIOV &local_buf = local_iovs[0][0];
+    const xferBenchIOV &remote_buf = remote_iovs[0][0];
+    const size_t max_len = std::min(local_buf.len, remote_buf.len);
+
+    xferBenchStats stats;
+    stats.reserve(trace.size());
+    bool warned_truncate = false, warned_peer = false;
+    size_t total_bytes = 0;
+
+    nixl_opt_args_t params;
+    std::string target = xferBenchConfig::isStorageBackend() ? "initiator" : "target";
+    if (!xferBenchConfig::isStorageBackend()) {
+        params.notifMsg = "0xBEEF";
+        params.hasNotif = true;
+    }
+
+    xferBenchTimer timer;
+    const nixlTime::us_t start = nixlTime::getUs();
+    nixlTime::us_t due = 0;
+
+    for (const auto &entry : trace) {
+        if (!entry.peer.empty() && entry.peer != target && !warned_peer) {
+            std::cerr << "WARNING: trace peer '" << entry.peer
+                      << "' ignored, replay targets '" << target << "'" << std::endl;
+            warned_peer = true;
+        }
+
+        size_t len = entry.size;
+        if (len > max_len) {
+            if (!warned_truncate) {
+                std::cerr << "WARNING: trace sizes above " << max_len
+                          << " bytes are truncated to the buffer partition; increase "
+                          << "--total_buffer_size to replay them faithfully" << std::endl;
+                warned_truncate = true;
+            }
+            len = max_len;
+        }
+
+        // Honor the recorded inter-arrival time relative to replay start,
+        // so queueing effects of bursts are reproduced rather than averaged
+        due += entry.delay_us;
+        while ((nixlTime::getUs() - start) < due) {
+            if (due - (nixlTime::getUs() - start) > 100) {
+                usleep(50);
+            }
+        }
+
+        nixl_xfer_dlist_t local_desc(GET_SEG_TYPE(true));
+        nixl_xfer_dlist_t remote_desc(GET_SEG_TYPE(false));
+        std::vector<xferBenchIOV> local_one = {
+            xferBenchIOV(local_buf.addr, len, local_buf.devId, local_buf.metaInfo)};
+        std::vector<xferBenchIOV> remote_one = {
+            xferBenchIOV(remote_buf.addr, len, remote_buf.devId, remote_buf.metaInfo)};
+        prepareTransferDescriptors(local_desc, remote_desc, local_one, remote_one);
+
+        const nixl_xfer_op_t op = entry.is_read ? NIXL_READ : NIXL_WRITE;
+        nixlXferReqH *req = nullptr;
+
+        timer.lap();
+        nixl_status_t rc = agent->createXferReq(op, local_desc, remote_desc, target, req, &params);
+        if (NIXL_SUCCESS != rc) {
+            std::cerr << "createXferReq failed during trace replay: "
+                      << nixlEnumStrings::statusStr(rc) << std::endl;
+            return -1;
+        }
+        stats.prepare_duration.add(timer.lap());
+
+        rc = execSingleTransfer(agent, req, timer, stats);
+        if (NIXL_SUCCESS != rc) {
+            std::cerr << "Trace replay transfer failed: " << nixlEnumStrings::statusStr(rc)
+                      << std::endl;
+            agent->releaseXferReq(req);
+            return -1;
+        }
+        stats.transfer_duration.add(timer.lap());
+
+        if (NIXL_SUCCESS != agent->releaseXferReq(req)) {
+            std::cerr << "releaseXferReq failed during trace replay" << std::endl;
+            return -1;
+        }
+        total_bytes += len;
+    }
+
+    const nixlTime::us_t elapsed = nixlTime::getUs() - start;
+
+    if (isMasterRank()) {
+        xferBenchConfig::printSeparator('-');
+        std::cout << std::fixed << std::setprecision(6)
+                  << "Trace replay: " << trace.size() << " ops, " << total_bytes << " bytes in "
+                  << std::setprecision(3) << (elapsed / 1e6) << " s, "
+                  << std::setprecision(6)
+                  << (((double)total_bytes / (1000 * 1000 * 1000)) / (elapsed / 1e6))
+                  << " GB/Sec" << std::endl;
+        std::cout << std::setprecision(1)
+                  << "Tx lat (us):"
+                  << " avg=" << stats.transfer_duration.avg()
+                  << " p50=" << stats.transfer_duration.p50()
+                  << " p90=" << stats.transfer_duration.p90()
+                  << " p99=" << stats.transfer_duration.p99()
+                  << " p999=" << stats.transfer_duration.p999()
+                  << " jitter=" << stats.transfer_duration.stddev()
+                  << std::endl;
+    }
+
+    synchronize();
+    return 0;
+}
+
+int
+xferBenchNixlWorker::soak(const std::vector<std::vector<xferBenchIOV>> &local_iovs,
+                          const std::vector<std::vector<xferBenchIOV>> &remote_iovs) {
+    if (isTarget()) {
+        // Drain completions until every initiator has signaled the end of
+        // its run; the map is cleared after each scan so a multi-day soak
+        // does not accumulate notification strings
+        const int num_senders = IS_INCAST_AND_SG() ? xferBenchConfig::num_initiator_dev : 1;
+        nixl_notifs_t notifs;
+        nixl_status_t status = NIXL_SUCCESS;
+        int done = 0;
+
+        while (NIXL_SUCCESS == status && done < num_senders && !signaled()) {
+            status = agent->getNotifs(notifs);
+            for (const auto &msg : notifs["initiator"]) {
+                if ("SOAK_DONE" == msg) {
+                    done++;
+                }
+            }
+            notifs.clear();
+        }
+        synchronize();
+        return 0;
+    }
+
+    // Soak posts from a single thread at a fixed operating point; the
+    // request is created once and reposted, so MR cache or allocator growth
+    // shows up as throughput decay rather than as setup cost
+    const auto &local_iov = local_iovs[0];
+    const auto &remote_iov = remote_iovs[0];
+
+    nixl_xfer_dlist_t local_desc(GET_SEG_TYPE(true));
+    nixl_xfer_dlist_t remote_desc(GET_SEG_TYPE(false));
+    prepareTransferDescriptors(local_desc, remote_desc, local_iov, remote_iov);
+
+    nixl_opt_args_t params;
+    std::string target = xferBenchConfig::isStorageBackend() ? "initiator" : "target";
+    if (!xferBenchConfig::isStorageBackend()) {
+        params.notifMsg = "0xBEEF";
+        params.hasNotif = true;
+    }
+
+    const nixl_xfer_op_t op =
+        XFERBENCH_OP_READ == xferBenchConfig::op_type ? NIXL_READ : NIXL_WRITE;
+    nixlXferReqH *req = nullptr;
+    nixl_status_t rc = agent->createXferReq(op, local_desc, remote_desc, target, req, &params);
+    if (NIXL_SUCCESS != rc) {
+        std::cerr << "createXferReq failed in soak mode: " << nixlEnumStrings::statusStr(rc)
+                  << std::endl;
+        return -1;
+    }
+
+    size_t op_bytes = 0;
+    for (const auto &iov : local_iov) {
+        op_bytes += iov.len;
+    }
+
+    const double tol = xferBenchConfig::soak_tolerance_pct / 100.0;
+    const nixlTime::us_t window_us = (nixlTime::us_t)xferBenchConfig::soak_window_sec * 1000000;
+    const nixlTime::us_t start = nixlTime::getUs();
+    nixlTime::us_t win_start = start;
+    xferBenchTimer timer;
+    xferBenchStats win_stats;
+    win_stats.reserve(4096);
+    uint64_t total_bytes = 0, win_bytes = 0;
+    uint64_t total_ops = 0, anomalies = 0, window_idx = 0;
+    double baseline_gbps = 0.0;
+    int ret = 0;
+
+    while (!signaled()) {
+        const nixlTime::us_t now = nixlTime::getUs();
+        if (xferBenchConfig::soak_sec > 0 &&
+            (now - start) >= (nixlTime::us_t)xferBenchConfig::soak_sec * 1000000) {
+            break;
+        }
+
+        // Throttle to the offered load: at soak_target_gbps GB/Sec the bytes
+        // sent so far should have taken total_bytes / (gbps * 1000) us
+        if (xferBenchConfig::soak_target_gbps > 0.0) {
+            const double due_us = total_bytes / (xferBenchConfig::soak_target_gbps * 1000.0);
+            while ((nixlTime::getUs() - start) < due_us && !signaled()) {
+                usleep(50);
+            }
+        }
+
+        timer.lap();
+        rc = execSingleTransfer(agent, req, timer, win_stats);
+        if (NIXL_SUCCESS != rc) {
+            std::cerr << "Soak transfer failed: " << nixlEnumStrings::statusStr(rc) << std::endl;
+            ret = -1;
+            break;
+        }
+        win_stats.transfer_duration.add(timer.lap());
+        total_bytes += op_bytes;
+        win_bytes += op_bytes;
+        total_ops++;
+
+        const nixlTime::us_t win_elapsed = nixlTime::getUs() - win_start;
+        if (win_elapsed >= window_us) {
+            const double gbps = ((double)win_bytes / (1000 * 1000 * 1000)) / (win_elapsed / 1e6);
+            const bool anomaly =
+                window_idx > 0 && std::fabs(gbps - baseline_gbps) > (baseline_gbps * tol);
+
+            std::cout << std::fixed << std::setprecision(6) << "soak[rank " << rt->getRank()
+                      << "] window " << window_idx << ": " << gbps << " GB/Sec,"
+                      << std::setprecision(1) << " lat avg=" << win_stats.transfer_duration.avg()
+                      << " p99=" << win_stats.transfer_duration.p99()
+                      << " jitter=" << win_stats.transfer_duration.stddev() << " us";
+            if (anomaly) {
+                anomalies++;
+                std::cout << std::setprecision(6) << "  *** ANOMALY (baseline " << baseline_gbps
+                          << " GB/Sec) ***";
+            }
+            std::cout << std::endl;
+
+            // EWMA baseline, so slow decay is flagged against the long-run
+            // average rather than only against the previous window
+            baseline_gbps = (0 == window_idx) ? gbps : (0.8 * baseline_gbps + 0.2 * gbps);
+            window_idx++;
+            win_bytes = 0;
+            win_stats.clear();
+            win_start = nixlTime::getUs();
+        }
+    }
+
+    agent->releaseXferReq(req);
+
+    // Tell the target the run is over with a final, separately tagged
+    // transfer so its drain loop can exit
+    if (!xferBenchConfig::isStorageBackend()) {
+        params.notifMsg = "SOAK_DONE";
+        rc = agent->createXferReq(op, local_desc, remote_desc, target, req, &params);
+        if (NIXL_SUCCESS == rc) {
+            rc = agent->postXferReq(req);
+            while (NIXL_IN_PROG == rc) {
+                rc = agent->getXferStatus(req);
+            }
+            agent->releaseXferReq(req);
+        }
+        if (NIXL_SUCCESS != rc) {
+            std::cerr << "Failed to post soak completion marker" << std::endl;
+            ret = -1;
+        }
+    }
+
+    const nixlTime::us_t elapsed = nixlTime::getUs() - start;
+    std::cout << std::fixed << "soak[rank " << rt->getRank() << "] done: " << total_ops
+              << " ops, " << total_bytes << " bytes in " << std::setprecision(1)
+              << (elapsed / 1e6) << " s, " << std::setprecision(6)
+              << (((double)total_bytes / (1000 * 1000 * 1000)) / (elapsed / 1e6))
+              << " GB/Sec overall, " << anomalies << " anomalous windows" << std::endl;
+
+    synchronize();
+    return ret;
+}
+
+int
+xferBenchNixlWorker::ctrlBench() {
+    if (XFERBENCH_CTRL_BENCH_NOTIF == xferBenchConfig::ctrl_bench) {
+        return ctrlBenchNotif();
+    }
+    return ctrlBenchMd();
+}
+
+int
+xferBenchNixlWorker::ctrlBenchNotif() {
+    if (isTarget()) {
+        // Echo every payload back so the initiator measures full round
+        // trips; the CTRL_DONE marker is echoed too and ends the loop
+        nixl_notifs_t notifs;
+        nixl_status_t status = NIXL_SUCCESS;
+        bool done = false;
+
+        while (NIXL_SUCCESS == status && !done && !signaled()) {
+            status = agent->getNotifs(notifs);
+            for (const auto &msg : notifs["initiator"]) {
+                done = done || ("CTRL_DONE" == msg);
+                status = agent->genNotif("initiator", msg);
+                if (NIXL_SUCCESS != status) {
+                    std::cerr << "Notification echo failed: "
+                              << nixlEnumStrings::statusStr(status) << std::endl;
+                    break;
+                }
+            }
+            notifs.clear();
+        }
+        synchronize();
+        return (NIXL_SUCCESS == status) ? 0 : -1;
+    }
+
+    // One notification in flight at a time, so every sample is a clean
+    // request/response round trip through both agents' notification paths
+    auto round_trip = [this](const std::string &msg) -> nixl_status_t {
+        nixl_status_t rc = agent->genNotif("target", msg);
+        if (NIXL_SUCCESS != rc) {
+            return rc;
+        }
+        nixl_notifs_t notifs;
+        while (notifs["target"].empty() && !signaled()) {
+            rc = agent->getNotifs(notifs);
+            if (NIXL_SUCCESS != rc) {
+                return rc;
+            }
+        }
+        return NIXL_SUCCESS;
+    };
+
+    xferBenchConfig::printSeparator('-');
+    std::cout << std::setw(20) << "Payload (B)" << std::setw(16) << "RTT avg (us)"
+              << std::setw(16) << "RTT p99 (us)" << std::setw(16) << "Jitter (us)"
+              << std::setw(20) << "Round trips/sec" << std::endl;
+    xferBenchConfig::printSeparator('-');
+
+    nixl_status_t rc = NIXL_SUCCESS;
+    int ret = 0;
+    for (size_t payload_size = xferBenchConfig::start_block_size;
+         0 == ret && !signaled() && payload_size <= xferBenchConfig::max_block_size;
+         payload_size *= 2) {
+        const std::string payload(payload_size, 'n');
+        xferMetricStats rtt;
+        rtt.reserve(xferBenchConfig::num_iter);
+        xferBenchTimer timer;
+
+        for (int i = 0; 0 == ret && i < xferBenchConfig::warmup_iter; i++) {
+            rc = round_trip(payload);
+            ret = (NIXL_SUCCESS == rc) ? 0 : -1;
+        }
+
+        const nixlTime::us_t start = nixlTime::getUs();
+        for (int i = 0; 0 == ret && i < xferBenchConfig::num_iter; i++) {
+            timer.lap();
+            rc = round_trip(payload);
+            ret = (NIXL_SUCCESS == rc) ? 0 : -1;
+            rtt.add(timer.lap());
+        }
+        const nixlTime::us_t elapsed = nixlTime::getUs() - start;
+
+        if (0 != ret) {
+            std::cerr << "Notification round trip failed: " << nixlEnumStrings::statusStr(rc)
+                      << std::endl;
+            break;
+        }
+        std::cout << std::fixed << std::setprecision(1) << std::setw(20) << payload_size
+                  << std::setw(16) << rtt.avg() << std::setw(16) << rtt.p99() << std::setw(16)
+                  << rtt.stddev() << std::setw(20) << std::setprecision(0)
+                  << (xferBenchConfig::num_iter / (elapsed / 1e6)) << std::endl;
+    }
+
+    // Release the target's echo loop even after a failed sweep; its echo of
+    // the marker is drained like any other round trip
+    rc = round_trip("CTRL_DONE");
+    if (NIXL_SUCCESS != rc) {
+        std::cerr << "Failed to post control benchmark completion marker" << std::endl;
+        ret = -1;
+    }
+
+    synchronize();
+    return ret;
+}
+
+int
+xferBenchNixlWorker::ctrlBenchMd() {
+    // Metadata latency is measured on the initiator against its own agent:
+    // getLocalMD serializes the descriptor sections, and loading the blob
+    // back exercises the same deserialize-and-load path a remote peer pays,
+    // without putting runtime traffic inside the timed loop
+    if (isTarget()) {
+        synchronize();
+        return 0;
+    }
+
+    nixl_opt_args_t opt_args;
+    opt_args.backends.push_back(backend_engine);
+
+    xferBenchConfig::printSeparator('-');
+    std::cout << std::setw(14) << "Descriptors" << std::setw(14) << "MD size (B)" << std::setw(20)
+              << "getLocalMD avg (us)" << std::setw(22) << "loadRemoteMD avg (us)" << std::setw(22)
+              << "loadRemoteMD p99 (us)" << std::endl;
+    xferBenchConfig::printSeparator('-');
+
+    int ret = 0;
+    for (size_t num_desc = xferBenchConfig::start_batch_size;
+         0 == ret && !signaled() && num_desc <= xferBenchConfig::max_batch_size; num_desc *= 2) {
+        // Separately allocated page-sized buffers, so the metadata carries
+        // num_desc distinct section entries like a fragmented KV cache
+        std::vector<void *> buffers;
+        nixl_reg_dlist_t desc_list(DRAM_SEG);
+        for (size_t i = 0; i < num_desc; i++) {
+            void *addr = nullptr;
+            if (0 != posix_memalign(&addr, xferBenchConfig::page_size,
+                                    xferBenchConfig::page_size)) {
+                std::cerr << "Failed to allocate control benchmark buffers" << std::endl;
+                ret = -1;
+                break;
+            }
+            buffers.push_back(addr);
+            nixlBlobDesc desc;
+            desc.addr = (uintptr_t)addr;
+            desc.len = xferBenchConfig::page_size;
+            desc.devId = 0;
+            desc_list.addDesc(desc);
+        }
+        if (0 != ret) {
+            for (void *addr : buffers) {
+                free(addr);
+            }
+            break;
+        }
+        CHECK_NIXL_ERROR(agent->registerMem(desc_list, &opt_args), "registerMem failed");
+
+        nixl_blob_t md;
+        std::string loaded_agent;
+        xferMetricStats get_lat, load_lat;
+        get_lat.reserve(xferBenchConfig::num_iter);
+        load_lat.reserve(xferBenchConfig::num_iter);
+        xferBenchTimer timer;
+        nixl_status_t rc = NIXL_SUCCESS;
+
+        const int total_iter = xferBenchConfig::warmup_iter + xferBenchConfig::num_iter;
+        for (int i = 0; 0 == ret && i < total_iter && !signaled(); i++) {
+            timer.lap();
+            rc = agent->getLocalMD(md);
+            const double get_us = timer.lap();
+            if (NIXL_SUCCESS != rc) {
+                std::cerr << "getLocalMD failed: " << nixlEnumStrings::statusStr(rc) << std::endl;
+                ret = -1;
+                break;
+            }
+            timer.lap();
+            rc = agent->loadRemoteMD(md, loaded_agent);
+            const double load_us = timer.lap();
+            if (NIXL_SUCCESS != rc) {
+                std::cerr << "loadRemoteMD failed: " << nixlEnumStrings::statusStr(rc)
+                          << std::endl;
+                ret = -1;
+                break;
+            }
+            if (i >= xferBenchConfig::warmup_iter) {
+                get_lat.add(get_us);
+                load_lat.add(load_us);
+            }
+        }
+
+        if (0 == ret) {
+            std::cout << std::fixed << std::setprecision(1) << std::setw(14) << num_desc
+                      << std::setw(14) << md.size() << std::setw(20) << get_lat.avg()
+                      << std::setw(22) << load_lat.avg() << std::setw(22) << load_lat.p99()
+                      << std::endl;
+        }
+
+        CHECK_NIXL_ERROR(agent->deregisterMem(desc_list, &opt_args), "deregisterMem failed");
+        for (void *addr : buffers) {
+            free(addr);
+        }
+    }
+
+    synchronize();
+    return ret;
+}
+
 void
 xferBenchNixlWorker::poll(size_t block_size) {
     nixl_notifs_t notifs;
@@ -1327,16 +1972,49 @@ xferBenchNixlWorker::poll(size_t block_size) {
     }
     total_iter = skip + num_iter;
 
+    if (IS_ALL_TO_ALL_AND_SG()) {
+        // Mirror the initiators' phase loop: in phase p the initiators with
+        // rank % T == (my_idx - p) % T transfer here, and every phase is
+        // fenced by the same pair of barriers as transfer()
+        const int num_targets = xferBenchConfig::num_target_dev;
+        const int num_init = xferBenchConfig::num_initiator_dev;
+        const int my_idx = rt->getRank() - num_init;
+        int expected = 0;
+
+        for (int phase = 0; phase < num_targets; phase++) {
+            const int residue = ((my_idx - phase) % num_targets + num_targets) % num_targets;
+            const int senders = (num_init / num_targets) +
+                ((residue < (num_init % num_targets)) ? 1 : 0);
+
+            expected += senders * skip;
+            do {
+                status = agent->getNotifs(notifs);
+            } while (status == NIXL_SUCCESS && expected != int(notifs["initiator"].size()));
+            synchronize();
+
+            expected += senders * num_iter;
+            do {
+                status = agent->getNotifs(notifs);
+            } while (status == NIXL_SUCCESS && expected != int(notifs["initiator"].size()));
+            synchronize();
+        }
+        return;
+    }
+
+    // In an incast every initiator process posts the full iteration count
+    const int num_senders = IS_INCAST_AND_SG() ? xferBenchConfig::num_initiator_dev : 1;
+
     /* Ensure warmup is done*/
     do {
         status = agent->getNotifs(notifs);
-    } while (status == NIXL_SUCCESS && skip != int(notifs["initiator"].size()));
+    } while (status == NIXL_SUCCESS && (skip * num_senders) != int(notifs["initiator"].size()));
     synchronize();
 
     /* Polling for actual iterations*/
     do {
         status = agent->getNotifs(notifs);
-    } while (status == NIXL_SUCCESS && total_iter != int(notifs["initiator"].size()));
+    } while (status == NIXL_SUCCESS &&
+             (total_iter * num_senders) != int(notifs["initiator"].size()));
     synchronize();
 }
 
@@ -44,6 +44,9 @@ class xferBenchNixlWorker: public xferBenchWorker {
         nixl_mem_t seg_type;
         std::vector<xferFileState> remote_fds;
         std::vector<std::vector<xferBenchIOV>> remote_iovs;
+        // Per-target remote IOV lists for the alltoall scheme, indexed
+        // [target][thread]; refreshed by every exchangeIOV() call
+        std::vector<std::vector<std::vector<xferBenchIOV>>> a2a_remote_iovs;
         std::vector<GusliDeviceConfig> gusli_devices;
 
     public:
@@ -70,7 +73,23 @@ class xferBenchNixlWorker: public xferBenchWorker {
                  const std::vector<std::vector<xferBenchIOV>> &local_iov_lists,
                  const std::vector<std::vector<xferBenchIOV>> &remote_iov_lists) override;
 
+        int
+        replayTrace(const std::vector<xferBenchTraceEntry> &trace,
+                    const std::vector<std::vector<xferBenchIOV>> &local_iov_lists,
+                    const std::vector<std::vector<xferBenchIOV>> &remote_iov_lists) override;
+
+        int
+        soak(const std::vector<std::vector<xferBenchIOV>> &local_iov_lists,
+             const std::vector<std::vector<xferBenchIOV>> &remote_iov_lists) override;
+
+        int
+        ctrlBench() override;
+
     private:
+        int
+        ctrlBenchNotif();
+        int
+        ctrlBenchMd();
         std::optional<xferBenchIOV>
         initBasicDescDram(size_t buffer_size, int mem_dev_id);
         void cleanupBasicDescDram(xferBenchIOV &basic_desc);
@@ -62,6 +62,38 @@ class xferBenchWorker {
         transfer(size_t block_size,
                  const std::vector<std::vector<xferBenchIOV>> &local_iov_lists,
                  const std::vector<std::vector<xferBenchIOV>> &remote_iov_lists) = 0;
+
+        // Trace replay; workers without support report an error.
+        // The initiator replays the records with their inter-arrival delays,
+        // the target consumes the matching completions.
+        virtual int
+        replayTrace(const std::vector<xferBenchTraceEntry> &trace,
+                    const std::vector<std::vector<xferBenchIOV>> &local_iov_lists,
+                    const std::vector<std::vector<xferBenchIOV>> &remote_iov_lists) {
+            std::cerr << "Trace replay is not supported by this worker" << std::endl;
+            return -1;
+        }
+
+        // Continuous soak run at a fixed operating point; workers without
+        // support report an error. The initiator posts at the configured
+        // offered load and reports rolling-window stats, the target drains
+        // completions until the initiators signal the end of the run.
+        virtual int
+        soak(const std::vector<std::vector<xferBenchIOV>> &local_iov_lists,
+             const std::vector<std::vector<xferBenchIOV>> &remote_iov_lists) {
+            std::cerr << "Soak mode is not supported by this worker" << std::endl;
+            return -1;
+        }
+
+        // Control-plane benchmark (--ctrl_bench); workers without support
+        // report an error. Exercises the agent's notification and metadata
+        // paths instead of data transfers: the initiator drives the measured
+        // loops, the target echoes or idles as the mode requires.
+        virtual int
+        ctrlBench() {
+            std::cerr << "Control-plane benchmarks are not supported by this worker" << std::endl;
+            return -1;
+        }
 };
 
 #endif // __WORKER_H
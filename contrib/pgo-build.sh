@@ -0,0 +1,75 @@
+#!/bin/bash
+
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Profile-guided optimization build driver.
+#
+# Pass 1 builds libnixl in release mode with -Db_pgo=generate, trains the
+# instrumented library on a representative workload (the in-tree test suite
+# plus, when a nixlbench binary is provided, a loopback UCX sweep from
+# pgo-workload.plan), then reconfigures the same build directory with
+# -Db_pgo=use so the rebuild picks up the .gcda profiles left next to the
+# object files.
+#
+# Usage: contrib/pgo-build.sh [build_dir] [extra meson setup args...]
+#
+# Environment:
+#   NIXLBENCH       Path to a nixlbench binary (built separately, see
+#                   benchmark/nixlbench). When unset, training runs the
+#                   test suite only.
+#   ETCD_ENDPOINTS  etcd used for nixlbench rank coordination
+#                   (default: http://localhost:2379)
+
+set -euo pipefail
+
+SOURCE_DIR=$(dirname "$(dirname "$(readlink -f "$0")")")
+BUILD_DIR=${1:-${SOURCE_DIR}/build-pgo}
+shift || true
+PLAN_FILE="${SOURCE_DIR}/contrib/pgo-workload.plan"
+ETCD_ENDPOINTS=${ETCD_ENDPOINTS:-http://localhost:2379}
+
+echo "== PGO pass 1: instrumented build =="
+meson setup "${BUILD_DIR}" "${SOURCE_DIR}" --buildtype=release -Db_pgo=generate "$@"
+ninja -C "${BUILD_DIR}"
+
+echo "== PGO training: in-tree test suite =="
+# The unit tests exercise the populate/serdes/descriptor paths. A failing
+# suite aborts the run: profiles from a broken build are not worth using.
+meson test -C "${BUILD_DIR}" --print-errorlogs
+
+if [[ -n "${NIXLBENCH:-}" ]]; then
+    echo "== PGO training: nixlbench loopback UCX sweep =="
+    # Two ranks on localhost drive the agent post path over loopback UCX;
+    # the plan runs every (block size, batch size) point in one launch. The
+    # instrumented library is picked up through LD_LIBRARY_PATH, so the
+    # nixlbench binary itself does not need to be rebuilt.
+    LD_LIBRARY_PATH="${BUILD_DIR}/src:${LD_LIBRARY_PATH:-}" \
+        "${NIXLBENCH}" --etcd_endpoints "${ETCD_ENDPOINTS}" --backend UCX \
+                       --sweep_plan "${PLAN_FILE}" &
+    target_pid=$!
+    LD_LIBRARY_PATH="${BUILD_DIR}/src:${LD_LIBRARY_PATH:-}" \
+        "${NIXLBENCH}" --etcd_endpoints "${ETCD_ENDPOINTS}" --backend UCX \
+                       --sweep_plan "${PLAN_FILE}"
+    wait "${target_pid}"
+else
+    echo "NIXLBENCH not set; skipping the loopback sweep (test-suite profiles only)"
+fi
+
+echo "== PGO pass 2: optimized rebuild from profiles =="
+meson configure "${BUILD_DIR}" -Db_pgo=use
+ninja -C "${BUILD_DIR}"
+
+echo "PGO-optimized build ready in ${BUILD_DIR}"
@@ -27,12 +27,31 @@
 // level direction or so.
 typedef std::vector<std::pair<std::string, std::string>> notif_list_t;
 
+// Backend capability bitmask, aggregated from the individual supports*()
+// hooks once per engine (see nixlBackendEngine::getCapabilities), so the
+// agent's per-transfer paths branch on cached bits instead of probing
+// virtuals on every call
+using nixl_backend_caps_t = uint64_t;
+enum : nixl_backend_caps_t {
+    NIXL_CAP_REMOTE          = 1ULL << 0, // remote transfers
+    NIXL_CAP_LOCAL           = 1ULL << 1, // local transfers
+    NIXL_CAP_NOTIF           = 1ULL << 2, // transfer-bound notifications
+    NIXL_CAP_RECV_COMPLETION = 1ULL << 3, // NIC-driven target-side completion
+    NIXL_CAP_BATCHED_POST    = 1ULL << 4, // single-submission batched posts
+};
+
 
 struct nixlBackendOptionalArgs {
     // During postXfer, user might ask for a notification if supported
     nixl_blob_t notifMsg;
     bool        hasNotif = false;
     nixl_blob_t customParam;
+    // Traffic class name for backends with QoS-aware resource selection;
+    // empty means no restriction
+    std::string trafficClass;
+    // Optional trace context (up to 16 bytes) carried with the transfer's
+    // notification for distributed correlation; empty when unused
+    nixl_blob_t traceCtx;
 };
 
 using nixl_opt_b_args_t = nixlBackendOptionalArgs;
@@ -42,6 +61,9 @@ using nixl_opt_b_args_t = nixlBackendOptionalArgs;
 // User doesn't know about fields such as local_agent but can access it
 // after the backend is initialized by agent. If we needed to make it private
 // from the user, we should make nixlBackendEngine/nixlAgent friend classes.
+class nixlProgressExecutor;
+class nixlStagingPool;
+
 class nixlBackendInitParams {
     public:
         std::string       localAgent;
@@ -53,6 +75,21 @@ class nixlBackendInitParams {
         nixlTime::us_t    pthrDelay;
         nixl_thread_sync_t syncMode;
         bool enableTelemetry_;
+
+        // Agent-level shared progress executor; when set, backends should
+        // register pollers into it instead of spawning their own threads
+        nixlProgressExecutor* progressExecutor = nullptr;
+
+        // Agent-level pinned staging pool; when set, backends should draw
+        // internal staging/bounce memory from it (falling back to their
+        // own allocation when a pool alloc fails) instead of allocating
+        // pinned memory at first use. The agent registers the whole slab
+        // with the backend right after engine creation.
+        nixlStagingPool* stagingPool = nullptr;
+
+        // CPU set for the backend's progress/worker threads, applied at
+        // thread creation; empty leaves them unpinned
+        std::string progressCpuset;
 };
 
 // Pure virtual class to have a common pointer type
@@ -17,6 +17,8 @@
 #ifndef __BACKEND_ENGINE_H
 #define __BACKEND_ENGINE_H
 
+#include <atomic>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -26,17 +28,55 @@
 #include "nixl_types.h"
 #include "backend_aux.h"
 #include "telemetry_event.h"
+#include "common/mem_budget.h"
 
 constexpr size_t MAX_TELEMETRY_QUEUE_SIZE = 1000;
 
+// One prepared sub-request of a batched post (see postXferBatch). The
+// handle comes from a prior prepXfer and may be replaced by the post,
+// hence the double indirection; status carries the per-entry result.
+struct nixlBackendXferSpec {
+    nixl_xfer_op_t           operation;
+    const nixl_meta_dlist_t *local = nullptr;
+    const nixl_meta_dlist_t *remote = nullptr;
+    const std::string       *remoteAgent = nullptr;
+    nixlBackendReqH        **handle = nullptr;
+    const nixl_opt_b_args_t *optArgs = nullptr;
+    nixl_status_t            status = NIXL_ERR_NOT_POSTED;
+};
+
 // Base backend engine class for different backend implementations
 class nixlBackendEngine {
     private:
         // Members that cannot be modified by a child backend and parent bookkeep
         nixl_backend_t  backendType;
         nixl_b_params_t customParams;
-        std::vector<nixlTelemetryEvent> telemetryEvents_;
-        std::mutex telemetryEventsMutex_;
+        // Mutable so const data-path methods (prepXfer etc.) can record events
+        mutable std::vector<nixlTelemetryEvent> telemetryEvents_;
+        mutable std::mutex telemetryEventsMutex_;
+
+        // Live load counters maintained by the agent around post and
+        // completion; relaxed atomics, so snapshots are approximate but
+        // reads never contend with the data path
+        std::atomic<uint64_t> loadPosted_{0};
+        std::atomic<uint64_t> loadCompleted_{0};
+        std::atomic<uint64_t> loadInFlightBytes_{0};
+        std::atomic<uint64_t> loadEwmaUs_{0};
+
+        // Capability mask cache for getCapabilities; filled on the first
+        // call (the agent makes it at createBackend, before any transfers)
+        mutable nixl_backend_caps_t caps_ = 0;
+        mutable bool capsValid_ = false;
+
+        // Last internal-memory figure surfaced through telemetry; touched
+        // only by the flusher via getTelemetryEvents
+        uint64_t lastReportedInternalMem_ = 0;
+
+        // Per-native-code error counters fed by addErrorTelemetry, guarded
+        // by telemetryEventsMutex_ and published as cumulative
+        // "errh_<backend>_<code>" events on the periodic drain
+        mutable std::map<int64_t, uint64_t> errorHist_;
+        std::map<int64_t, uint64_t> errorHistPublished_; // flusher-only
 
     protected:
         // Members that can be accessed by the child (localAgent cannot be modified)
@@ -44,6 +84,23 @@ class nixlBackendEngine {
         const std::string localAgent;
         const bool enableTelemetry_;
 
+        // Accounting for backend-internal allocations (bounce buffers,
+        // request pools, staging slabs). Engines charge their allocators
+        // against this budget; the "internal_mem_cap" init param (bytes)
+        // sets a cap that makes growth paths fail gracefully instead of
+        // expanding unbounded. Usage is surfaced through telemetry.
+        nixlMemBudget internalMemBudget_;
+
+        // Hook behind reconfigure(): apply the given parameters to the
+        // running engine where safe (thread counts, thresholds, windows),
+        // without disturbing registrations or connections. Engines must
+        // validate the whole set first and apply nothing on rejection.
+        // Default: nothing is reconfigurable at runtime.
+        virtual nixl_status_t
+        applyConfig(const nixl_b_params_t &params) {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
         [[nodiscard]] nixl_status_t
         setInitParam(const std::string &key, const std::string &value) {
             if (customParams.emplace(key, value).second) {
@@ -62,7 +119,7 @@ class nixlBackendEngine {
         }
 
         void
-        addTelemetryEvent(const std::string &event_name, uint64_t value) {
+        addTelemetryEvent(const std::string &event_name, uint64_t value) const {
             if (!enableTelemetry_) return;
             if (telemetryEvents_.size() >= MAX_TELEMETRY_QUEUE_SIZE) return;
             std::lock_guard<std::mutex> lock(telemetryEventsMutex_);
@@ -74,12 +131,41 @@ class nixlBackendEngine {
                                           value);
         }
 
+        // Structured error reporting: emits one event per occurrence with
+        // the native (driver/provider) error code as its value, named
+        // "err_<backend>_<source>[_<peer>]" where source identifies the
+        // failing rail/worker, and feeds the per-code histogram surfaced on
+        // the periodic drain - so flapping links localize from telemetry
+        // instead of fleet-wide debug-log greps
+        void
+        addErrorTelemetry(int64_t native_code,
+                          const std::string &source,
+                          const std::string &peer = "") const {
+            if (!enableTelemetry_) return;
+            std::string name = "err_" + backendType + "_" + source;
+            if (!peer.empty())
+                name += "_" + peer;
+            addTelemetryEvent(name, static_cast<uint64_t>(native_code));
+            std::lock_guard<std::mutex> lock(telemetryEventsMutex_);
+            errorHist_[native_code]++;
+        }
+
     public:
         explicit nixlBackendEngine(const nixlBackendInitParams *init_params)
             : backendType(init_params->type),
               customParams(*init_params->customParams),
               localAgent(init_params->localAgent),
-              enableTelemetry_(init_params->enableTelemetry_) {}
+              enableTelemetry_(init_params->enableTelemetry_) {
+            const auto cap = customParams.find("internal_mem_cap");
+            if (cap != customParams.end()) {
+                try {
+                    internalMemBudget_.setCap(std::stoull(cap->second));
+                }
+                catch (const std::exception &) {
+                    // Malformed cap: keep accounting without enforcement
+                }
+            }
+        }
 
         nixlBackendEngine(nixlBackendEngine&&) = delete;
         nixlBackendEngine(const nixlBackendEngine&) = delete;
@@ -91,14 +177,115 @@ class nixlBackendEngine {
 
         std::vector<nixlTelemetryEvent>
         getTelemetryEvents() {
+            // Piggyback the internal-memory gauge on the periodic drain so
+            // growth shows up without a hook at every allocation site
+            const uint64_t internal_mem = internalMemBudget_.used();
+            if (internal_mem != lastReportedInternalMem_) {
+                lastReportedInternalMem_ = internal_mem;
+                addTelemetryEvent("internal_mem_used", internal_mem);
+            }
+            // Publish changed per-code error counters as cumulative events,
+            // from which a collector can diff per-backend error histograms
+            std::vector<std::pair<int64_t, uint64_t>> changed_errs;
+            {
+                std::lock_guard<std::mutex> lock(telemetryEventsMutex_);
+                for (const auto &entry : errorHist_) {
+                    uint64_t &published = errorHistPublished_[entry.first];
+                    if (published != entry.second) {
+                        published = entry.second;
+                        changed_errs.emplace_back(entry);
+                    }
+                }
+            }
+            for (const auto &entry : changed_errs)
+                addTelemetryEvent("errh_" + backendType + "_" + std::to_string(entry.first),
+                                  entry.second);
             std::lock_guard<std::mutex> lock(telemetryEventsMutex_);
             return std::move(telemetryEvents_);
         }
 
+        // Bytes currently charged by this engine's internal allocators
+        uint64_t
+        getInternalMemUsed() const {
+            return internalMemBudget_.used();
+        }
+
         bool getInitErr() const noexcept { return initErr; }
         const nixl_backend_t& getType() const noexcept { return backendType; }
         const nixl_b_params_t& getCustomParams() const noexcept { return customParams; }
 
+        // Applies a new set of custom parameters to a running engine via
+        // the applyConfig hook below; on success the accepted keys are
+        // merged into the stored params, so getCustomParams reflects the
+        // live configuration. Registrations and connections are untouched.
+        nixl_status_t
+        reconfigure(const nixl_b_params_t &params) {
+            const nixl_status_t ret = applyConfig(params);
+            if (ret == NIXL_SUCCESS)
+                for (const auto &p : params)
+                    customParams[p.first] = p.second;
+            return ret;
+        }
+
+        // Load accounting, called by the agent when a transfer is handed to
+        // the backend and when it reaches a terminal state. Transfers that
+        // complete inline at post time go through recordLoadInstant so the
+        // posted/completed rates stay meaningful without skewing the EWMA.
+        void recordLoadPosted(uint64_t bytes) {
+            loadPosted_.fetch_add(1, std::memory_order_relaxed);
+            loadInFlightBytes_.fetch_add(bytes, std::memory_order_relaxed);
+        }
+
+        void recordLoadCompleted(uint64_t bytes, uint64_t elapsed_us) {
+            loadCompleted_.fetch_add(1, std::memory_order_relaxed);
+            loadInFlightBytes_.fetch_sub(bytes, std::memory_order_relaxed);
+            // EWMA with 1/8 weight; a racing update may lose a sample,
+            // which is acceptable for a smoothed estimate
+            const uint64_t old_avg = loadEwmaUs_.load(std::memory_order_relaxed);
+            const uint64_t new_avg =
+                (old_avg == 0) ?
+                    elapsed_us :
+                    uint64_t(int64_t(old_avg) + (int64_t(elapsed_us) - int64_t(old_avg)) / 8);
+            loadEwmaUs_.store(new_avg, std::memory_order_relaxed);
+        }
+
+        void recordLoadInstant() {
+            loadPosted_.fetch_add(1, std::memory_order_relaxed);
+            loadCompleted_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void getLoad(nixlBackendLoad &load) const {
+            load.postedXfers = loadPosted_.load(std::memory_order_relaxed);
+            load.completedXfers = loadCompleted_.load(std::memory_order_relaxed);
+            load.inFlightXfers = load.postedXfers - load.completedXfers;
+            load.inFlightBytes = loadInFlightBytes_.load(std::memory_order_relaxed);
+            load.avgCompletionUs = loadEwmaUs_.load(std::memory_order_relaxed);
+        }
+
+        // Aggregated capability mask, composed from the supports*() hooks
+        // below on the first call and cached. The agent reads it once at
+        // createBackend, so the dispatch paths branch on plain bits instead
+        // of virtual probes per transfer.
+        nixl_backend_caps_t
+        getCapabilities() const {
+            if (!capsValid_) {
+                nixl_backend_caps_t caps = 0;
+                if (supportsRemote()) caps |= NIXL_CAP_REMOTE;
+                if (supportsLocal()) caps |= NIXL_CAP_LOCAL;
+                if (supportsNotif()) caps |= NIXL_CAP_NOTIF;
+                if (supportsRecvCompletion()) caps |= NIXL_CAP_RECV_COMPLETION;
+                if (supportsBatchedPost()) caps |= NIXL_CAP_BATCHED_POST;
+                caps_ = caps;
+                capsValid_ = true;
+            }
+            return caps_;
+        }
+
+        bool
+        hasCapability(nixl_backend_caps_t cap) const {
+            return (getCapabilities() & cap) != 0;
+        }
+
         // The support function determine which methods are necessary by the child backend, and
         // if they're called by mistake, they will return error if not implemented by backend.
 
@@ -112,6 +299,26 @@ class nixlBackendEngine {
         // pure virtual, and return errors, as parent shouldn't call if supportsNotif is false.
         virtual bool supportsNotif() const = 0;
 
+        // Determines if a backend delivers transfer-bound notifications
+        // ordered behind the data itself (RDMA-write-with-immediate
+        // style), so the target-side wakeup through getNotifs is driven
+        // by the NIC completing the data instead of a separate message
+        // sent after the initiator observes completion, which may trail
+        // the data by a full polling interval.
+        virtual bool supportsRecvCompletion() const { return false; }
+
+        // Determines if a backend implements postXferBatch natively, i.e.
+        // maps several prepared sub-requests onto one driver submission.
+        // The agent only batches posts towards engines that opt in here;
+        // the default postXferBatch below is just a convenience loop.
+        virtual bool supportsBatchedPost() const { return false; }
+
+        // Largest transfer the backend wants per posted operation, in
+        // bytes; 0 means no limit. The agent splits larger descriptors
+        // into chunks of at most this size through its auto-chunking
+        // pipeline, keeping completion and cancellation chunk-grained.
+        virtual size_t getMaxXferChunkSize() const { return 0; }
+
         virtual nixl_mem_list_t getSupportedMems() const = 0;  // TODO: Return by const-reference and mark noexcept?
 
 
@@ -123,6 +330,30 @@ class nixlBackendEngine {
                                            nixlBackendMD* &out) = 0;
         virtual nixl_status_t deregisterMem (nixlBackendMD* meta) = 0;
 
+        // Bulk registration of a whole descriptor list. The default loops
+        // over registerMem; backends whose drivers support batched
+        // registration can override it to amortize per-call overhead.
+        // On failure nothing is left registered and out is cleared.
+        virtual nixl_status_t
+        registerMems(const nixl_reg_dlist_t &descs,
+                     const nixl_mem_t &nixl_mem,
+                     std::vector<nixlBackendMD*> &out) {
+            out.clear();
+            out.reserve(descs.descCount());
+            for (auto &desc : descs) {
+                nixlBackendMD *md = nullptr;
+                const nixl_status_t ret = registerMem(desc, nixl_mem, md);
+                if (ret != NIXL_SUCCESS) {
+                    for (auto *done : out)
+                        deregisterMem(done);
+                    out.clear();
+                    return ret;
+                }
+                out.push_back(md);
+            }
+            return NIXL_SUCCESS;
+        }
+
         // Make connection to a remote node identified by the name into loaded conn infos
         // Child might just return 0, if making proactive connections are not necessary.
         // An agent might need to connect to itself for local operations.
@@ -150,12 +381,83 @@ class nixlBackendEngine {
                                         const nixl_opt_b_args_t* opt_args=nullptr
                                        ) const = 0;
 
+        // Posts a span of prepared sub-requests in one call, so engines can
+        // ring a single doorbell for N logical transfers (e.g. multi-iov
+        // driver submissions). Per-entry results land in each spec's
+        // status; the return is NIXL_SUCCESS when every entry completed
+        // inline, NIXL_IN_PROG when any is still in flight, and the first
+        // error otherwise, in which case later entries are left unposted.
+        virtual nixl_status_t
+        postXferBatch(std::vector<nixlBackendXferSpec> &specs) const {
+            nixl_status_t agg = NIXL_SUCCESS;
+            for (auto &spec : specs) {
+                spec.status = postXfer(spec.operation, *spec.local, *spec.remote,
+                                       *spec.remoteAgent, *spec.handle, spec.optArgs);
+                if (spec.status < 0)
+                    return spec.status;
+                if (spec.status == NIXL_IN_PROG)
+                    agg = NIXL_IN_PROG;
+            }
+            return agg;
+        }
+
         // Use a handle to progress backend engine and see if a transfer is completed or not
         virtual nixl_status_t checkXfer(nixlBackendReqH* handle) const = 0;
 
+        // Checks a span of handles in one call, so engines can drive their
+        // progress machinery once and harvest the remaining statuses from
+        // completion-flag reads instead of one progress pass per handle.
+        // Per-entry results land in statuses, index-aligned with handles
+        // and sized by the caller; the return is the first error, else
+        // NIXL_IN_PROG when any entry is still in flight, else
+        // NIXL_SUCCESS. Default: one checkXfer per handle.
+        virtual nixl_status_t
+        checkXferBatch(const std::vector<nixlBackendReqH *> &handles,
+                       std::vector<nixl_status_t> &statuses) const {
+            nixl_status_t agg = NIXL_SUCCESS;
+            for (size_t i = 0; i < handles.size(); i++) {
+                statuses[i] = checkXfer(handles[i]);
+                if ((statuses[i] < 0) && (agg >= 0))
+                    agg = statuses[i];
+                else if ((statuses[i] == NIXL_IN_PROG) && (agg == NIXL_SUCCESS))
+                    agg = NIXL_IN_PROG;
+            }
+            return agg;
+        }
+
         //Backend aborts the transfer if necessary, and destructs the relevant objects
         virtual nixl_status_t releaseReqH(nixlBackendReqH* handle) const = 0;
 
+        // Best-effort abort of an in-flight request: cancel whatever the
+        // driver allows and report the bytes known to have completed before
+        // the abort (0 when the backend cannot tell). The handle stays
+        // valid and must still be destroyed with releaseReqH. Default: no
+        // backend-level cancel, callers fall back to releaseReqH.
+        virtual nixl_status_t
+        abortReqH(nixlBackendReqH *handle, size_t &bytes_transferred) const {
+            bytes_transferred = 0;
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
+        // Indices, into the posted descriptor lists, of descriptors whose
+        // operations are not known to have completed. Queried once the
+        // handle is in a terminal error state, so the agent can hand the
+        // caller a retry subset instead of retransferring the whole batch.
+        // Default: the backend cannot attribute the failure.
+        virtual nixl_status_t
+        getFailedDescs(nixlBackendReqH *handle, std::vector<size_t> &indices) const {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
+        // Diagnostic hook for the agent's stall watchdog: dump whatever
+        // driver-level state the engine can reach cheaply (worker state,
+        // queue pointers, in-flight counts) to the log. Called from a
+        // progress path when a transfer is detected as stuck, so it must
+        // not block or disturb in-flight operations. Default: nothing to
+        // dump beyond the load counters the agent already reports.
+        virtual void
+        dumpDiagnostics() const {}
+
         // Create a GPU transfer request to GPU memory for GPU transfer.
         virtual nixl_status_t
         createGpuXferReq(const nixlBackendReqH &req_hndl,
@@ -231,6 +533,14 @@ class nixlBackendEngine {
             return NIXL_ERR_BACKEND;
         }
 
+        // Drains trace contexts that arrived with notifications since the
+        // last call, in arrival order; the agent records them in telemetry.
+        // Backends that don't carry trace contexts keep the default.
+        virtual nixl_status_t
+        getNotifTraceCtxs(std::vector<nixl_blob_t> &traces) {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
 
         // *** Optional virtual methods that are good to be implemented in any backend *** //
 
@@ -256,5 +566,23 @@ class nixlBackendEngine {
                          const nixl_opt_args_t *extra_params = nullptr) const {
             return NIXL_ERR_NOT_SUPPORTED;
         }
+
+        // Estimate the cost of a prospective transfer before a request
+        // handle exists; the agent uses it to pick the cheapest backend at
+        // request creation. Estimates should reflect live backend state
+        // (queue depth, measured bandwidth) where available. Backends that
+        // do not implement it keep their position in the fixed selection
+        // order.
+        virtual nixl_status_t
+        estimateXferCost(const nixl_xfer_op_t &operation,
+                         const nixl_meta_dlist_t &local,
+                         const nixl_meta_dlist_t &remote,
+                         const std::string &remote_agent,
+                         std::chrono::microseconds &duration,
+                         std::chrono::microseconds &err_margin,
+                         nixl_cost_t &method,
+                         const nixl_opt_args_t *extra_params = nullptr) const {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
 };
 #endif
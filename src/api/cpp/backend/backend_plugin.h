@@ -25,7 +25,8 @@
 class nixlUcxEngine;
 
 // Define the plugin API version
-#define NIXL_PLUGIN_API_VERSION 1
+// Version 2 adds get_backend_caps at the end of the interface struct
+#define NIXL_PLUGIN_API_VERSION 2
 
 // Define the plugin interface class
 class nixlBackendPlugin {
@@ -49,6 +50,11 @@ public:
 
     // Function to get supported backend mem types
     nixl_mem_list_t (*get_backend_mems)();
+
+    // Function to get the backend capability mask without instantiating an
+    // engine; 0 means unspecified, and the agent then reads the mask from
+    // the engine instance at createBackend
+    nixl_backend_caps_t (*get_backend_caps)();
 };
 
 // Macro to define exported C functions for the plugin
@@ -62,12 +68,14 @@ public:
            const char *name,
            const char *version,
            const nixl_b_params_t &params,
-           const nixl_mem_list_t &mem_list) {
+           const nixl_mem_list_t &mem_list,
+           nixl_backend_caps_t caps = 0) {
 
         static const char *plugin_name = name;
         static const char *plugin_version = version;
         static const nixl_b_params_t plugin_params = params;
         static const nixl_mem_list_t plugin_mems = mem_list;
+        static const nixl_backend_caps_t plugin_caps = caps;
 
         static nixlBackendPlugin plugin_instance = {api_version,
                                                     createEngine,
@@ -75,7 +83,8 @@ public:
                                                     []() { return plugin_name; },
                                                     []() { return plugin_version; },
                                                     []() { return plugin_params; },
-                                                    []() { return plugin_mems; }};
+                                                    []() { return plugin_mems; },
+                                                    []() { return plugin_caps; }};
 
         return &plugin_instance;
     }
@@ -24,6 +24,7 @@
 #include "nixl_types.h"
 #include "nixl_params.h"
 #include "nixl_descriptors.h"
+#include "nixl_reg_snapshot.h"
 #include <chrono>
 #include <memory>
 
@@ -36,6 +37,18 @@ class nixlAgent {
         /** @var  data  The members in agent class wrapped into single nixlAgentData member. */
         std::unique_ptr<nixlAgentData> data;
 
+        /* Deferred-init path used by constructNonBlocking: skips the comm
+         * setup the public constructor runs inline */
+        nixlAgent (const std::string &name,
+                   const nixlAgentConfig &cfg,
+                   bool deferred_init);
+
+        /* Runs one startup stage, stamping its result and wall time into
+         * the init report and telemetry; never throws */
+        nixl_status_t
+        runInitStage (nixl_init_stage_t stage,
+                      const std::vector<nixl_backend_t> &backends);
+
     public:
         /*** Initialization and Registering Methods ***/
 
@@ -56,6 +69,45 @@ class nixlAgent {
         nixlAgent(nixlAgent&&) noexcept = delete;
         nixlAgent &operator=(nixlAgent&&) noexcept = delete;
 
+        /**
+         * @brief  Construct an agent without blocking on its startup work.
+         *         Communication setup (metadata listener and comm thread),
+         *         plugin discovery, and creation of the requested backends
+         *         run on background threads; comm setup and the
+         *         plugin/backend chain run in parallel. The returned agent
+         *         becomes usable once checkInit reports NIXL_SUCCESS, and
+         *         each stage's wall time is recorded for startup cost
+         *         attribution (see nixl_init_report_t). Handles for the
+         *         staged backends are obtained through createBackend, which
+         *         hands out the already-created engine instead of failing.
+         *
+         * @param  name      A String name assigned to the Agent
+         * @param  cfg       Agent configuration of class type nixlAgentConfig
+         * @param  backends  Backend types to create with default parameters
+         *                   during the backends stage; backends that need
+         *                   custom parameters can be created afterwards
+         *                   through createBackend as usual
+         * @return Owned agent object, never null
+         */
+        static std::unique_ptr<nixlAgent>
+        constructNonBlocking (const std::string &name,
+                              const nixlAgentConfig &cfg,
+                              const std::vector<nixl_backend_t> &backends = {});
+
+        /**
+         * @brief  Check the progress of a constructNonBlocking startup.
+         *         Agents built with the blocking constructor report
+         *         NIXL_SUCCESS immediately; their report only carries the
+         *         comm stage, which the constructor runs inline.
+         *
+         * @param  report [out]  Optional per-stage status and timing
+         * @return NIXL_SUCCESS when all stages finished successfully,
+         *         NIXL_IN_PROG while any is still running, or the first
+         *         failed stage's error otherwise
+         */
+        nixl_status_t
+        checkInit (nixl_init_report_t *report = nullptr) const;
+
         /**
          * @brief  Discover the available supported plugins found in the plugin paths
          *
@@ -93,6 +145,22 @@ class nixlAgent {
                           nixl_mem_list_t &mems,
                           nixl_b_params_t &params) const;
 
+        /**
+         * @brief  Get a snapshot of a backend's live load: posted and completed
+         *         transfer counts, in-flight transfers and bytes, and a smoothed
+         *         post-to-completion time. The counters are maintained around
+         *         post and completion, so the snapshot is cheap (relaxed atomic
+         *         reads, no agent lock) and can be polled from a scheduling loop
+         *         as a backpressure signal.
+         *
+         * @param  backend       Backend handle to query
+         * @param  load [out]    Snapshot of the backend's load counters
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        getBackendLoad (const nixlBackendH* backend,
+                        nixlBackendLoad &load) const;
+
         /**
          * @brief  Instantiate a backend engine object based on the corresponding parameters
          *
@@ -105,6 +173,42 @@ class nixlAgent {
         createBackend (const nixl_backend_t &type,
                        const nixl_b_params_t &params,
                        nixlBackendH* &backend);
+
+        /**
+         * @brief  Apply new parameters to a running backend where the plugin
+         *         deems it safe (thread counts, thresholds, windows), keeping
+         *         its registrations and connections intact, so agents can be
+         *         tuned live instead of being torn down and re-registered.
+         *         The set is applied atomically: if any key cannot be changed
+         *         at runtime the call fails and nothing is modified. Plugins
+         *         that support no runtime changes return NIXL_ERR_NOT_SUPPORTED.
+         *
+         * @param  backend       Backend handle to reconfigure
+         * @param  params        Backend specific parameters to apply
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        reconfigureBackend (nixlBackendH* backend,
+                            const nixl_b_params_t &params);
+
+        /**
+         * @brief  Set the agent-level segmentation policy for one backend:
+         *         descriptors handed to it by createXferReq are split into
+         *         chunks of at most max_chunk_bytes, so a huge transfer
+         *         completes, cancels, and reports progress chunk by chunk
+         *         instead of all-or-nothing. Without an explicit policy the
+         *         backend's own advertised limit applies, which may be none.
+         *         Zero restores that default; non-zero values below the
+         *         agent's minimum chunk size are rejected. Only transfer
+         *         requests created after the call observe the new policy.
+         *
+         * @param  backend          Backend handle the policy applies to
+         * @param  max_chunk_bytes  Maximum bytes per backend operation
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        setXferChunkSize (const nixlBackendH* backend,
+                          size_t max_chunk_bytes);
         /**
          * @brief  Register a memory/storage with NIXL. If a list of backends hints is provided
          *         (via extra_params), the registration is limited to the specified backends.
@@ -130,6 +234,41 @@ class nixlAgent {
         deregisterMem (const nixl_reg_dlist_t &descs,
                        const nixl_opt_args_t* extra_params = nullptr);
 
+        /**
+         * @brief  Fence the backends that could still reference a deregistered
+         *         range: drains any deferred deregistrations and waits until
+         *         every transfer that was in flight on the relevant backends at
+         *         the time of this call has reached a terminal state. After it
+         *         returns NIXL_SUCCESS the memory described by descs can be
+         *         recycled safely. Only backends supporting the descriptor
+         *         list's memory type are fenced, or the ones given via
+         *         extra_params. The wait is bounded by the transfer stall
+         *         timeout (NIXL_XFER_STALL_TIMEOUT, or 30s when unset/zero).
+         *
+         * @param  descs         Descriptor list describing the range to quiesce
+         * @param  extra_params  Optional backend hints limiting the fence
+         * @return nixl_status_t NIXL_SUCCESS once quiesced, NIXL_ERR_BACKEND if
+         *                       the timeout expired with transfers still in flight
+         */
+        nixl_status_t
+        quiesceMem(const nixl_reg_dlist_t &descs,
+                   const nixl_opt_args_t *extra_params = nullptr);
+
+        /**
+         * @brief  Get the current read-only snapshot of the registered local
+         *         memory. The call is a single atomic pointer load, without
+         *         taking the agent lock, so application-side bookkeeping
+         *         (e.g. allocators asking whether a range is registered and
+         *         with which backends) never contends with the transfer
+         *         path. A new snapshot is published copy-on-write whenever
+         *         registrations change; the returned one stays valid and
+         *         self-consistent while held, see nixlRegSnapshot.
+         *
+         * @return nixl_reg_snapshot_ptr_t The latest registration snapshot
+         */
+        nixl_reg_snapshot_ptr_t
+        getRegSnapshot () const;
+
         /**
          * @brief  Query information about memory/storage with NIXL.
          *         The backend should be specified via extra_params.
@@ -157,6 +296,36 @@ class nixlAgent {
         makeConnection (const std::string &remote_agent,
                         const nixl_opt_args_t* extra_params = nullptr);
 
+        /**
+         * @brief  Kick off connection warmup towards many remote agents at once,
+         *         without blocking the caller. The connections are established in
+         *         the background, so a large peer mesh can be warmed during model
+         *         load instead of on the first transfer. Progress can be queried
+         *         through checkConnections. If a list of backend hints is provided
+         *         (via extra_params), the connections are made for the specified
+         *         backends.
+         *
+         * @param  remote_agents Names of the remote agents to connect to
+         * @param  extra_params  Optional additional parameters, such as backend hints
+         * @return nixl_status_t NIXL_IN_PROG if warmup was started
+         */
+        nixl_status_t
+        makeConnections(const std::vector<std::string> &remote_agents,
+                        const nixl_opt_args_t* extra_params = nullptr);
+
+        /**
+         * @brief  Query the state of connection warmup started by makeConnections
+         *         for the given remote agents.
+         *
+         * @param  remote_agents Names of the remote agents to query
+         * @return nixl_status_t NIXL_IN_PROG while any connection is still being
+         *                       established, NIXL_SUCCESS when all are connected,
+         *                       the first recorded error otherwise. Agents never
+         *                       passed to makeConnections report NIXL_ERR_NOT_FOUND.
+         */
+        nixl_status_t
+        checkConnections(const std::vector<std::string> &remote_agents) const;
+
         /*** Transfer Request Preparation ***/
         /**
          * @brief  Prepare a list of descriptors for a transfer request, so later elements
@@ -183,6 +352,25 @@ class nixlAgent {
                        const nixl_xfer_dlist_t &descs,
                        nixlDlistH* &dlist_hndl,
                        const nixl_opt_args_t* extra_params = nullptr) const;
+        /**
+         * @brief  Re-prepare an existing descriptor list handle in place after its
+         *         buffers were recycled to new addresses. The new descriptors are
+         *         re-resolved against the already-prepared backend metadata:
+         *         unchanged entries are untouched, and changed entries only need a
+         *         covering search within the registered regions, which is much
+         *         cheaper than releasing and re-preparing the handle. The list
+         *         must have the same length and memory type as the original
+         *         preparation, and all new addresses must fall within regions
+         *         that are (still) registered; otherwise the handle should be
+         *         released and prepared anew.
+         *
+         * @param  descs            The descriptor list with the updated addresses
+         * @param  dlist_hndl       The prepared descriptor list handle to update in place
+         * @return nixl_status_t    Error code if call was not successful
+         */
+        nixl_status_t
+        updateXferDlist (const nixl_xfer_dlist_t &descs,
+                         nixlDlistH* dlist_hndl) const;
         /**
          * @brief  Make a transfer request `req_handl` by selecting indices from already
          *         prepared descriptor list handles. NIXL automatically determines the backend
@@ -242,6 +430,186 @@ class nixlAgent {
                        nixlXferReqH* &req_hndl,
                        const nixl_opt_args_t* extra_params = nullptr) const;
 
+        /**
+         * @brief  Create a staged (two-leg pipelined) transfer request that
+         *         chains a storage backend and a memory/network backend through
+         *         a pinned DRAM staging area, e.g. an NVMe-to-VRAM restore via
+         *         posix/GDS and UCX as a single request instead of two
+         *         app-coordinated round trips. The staging area is split into a
+         *         double buffer and the descriptor lists are cut into chunks
+         *         fitting one slot; the storage leg of one chunk overlaps the
+         *         other leg of the previous one, so neither backend idles.
+         *         NIXL_READ restores storage into the final memory, NIXL_WRITE
+         *         dumps the final memory into storage. The returned handle
+         *         behaves as if posted through postXferReq: poll it with
+         *         getXferStatus and release it with releaseXferReq. The local
+         *         agent's own metadata must be loaded (as for any loopback
+         *         transfer), and remote_agent may be the local agent's name for
+         *         a same-node final side. A notification from extra_params is
+         *         delivered to remote_agent once all chunks complete.
+         *
+         * @param  operation      NIXL_READ (storage to memory) or NIXL_WRITE
+         * @param  storage_descs  Local storage-segment descriptor list (FILE/BLK/OBJ)
+         * @param  final_descs    Final memory descriptor list, aligned by index
+         * @param  staging_descs  Registered local DRAM staging area; the first
+         *                        descriptor is used and halved into two slots
+         * @param  remote_agent   Agent owning the final side (or self name)
+         * @param  req_hndl [out] Transfer request handle output
+         * @param  extra_params   Optional extra parameters, e.g. a notification
+         * @return nixl_status_t  Error code if call was not successful
+         */
+        nixl_status_t
+        createStagedXferReq (const nixl_xfer_op_t &operation,
+                             const nixl_xfer_dlist_t &storage_descs,
+                             const nixl_xfer_dlist_t &final_descs,
+                             const nixl_xfer_dlist_t &staging_descs,
+                             const std::string &remote_agent,
+                             nixlXferReqH* &req_hndl,
+                             const nixl_opt_args_t* extra_params = nullptr) const;
+
+        /**
+         * @brief  Register a routing policy consulted by makeXferReq and
+         *         createXferReq before the built-in backend selection, so
+         *         deployments can steer traffic classes (e.g., checkpoint
+         *         vs latency-sensitive) to specific backends without
+         *         per-call backend hints. An explicit backend list in
+         *         extra_params still takes precedence. Passing a null
+         *         callback removes the policy.
+         *
+         * @param  policy_cb        Callback returning a backend ranking for a transfer
+         * @return nixl_status_t    Error code if call was not successful
+         */
+        nixl_status_t
+        setXferPolicy (const nixl_xfer_policy_cb_t &policy_cb) const;
+
+        /**
+         * @brief  Limit the bytes this agent keeps in flight towards a remote
+         *         agent. Posts that would overflow the window are queued in
+         *         the agent scheduler and dispatched as earlier transfers to
+         *         that peer complete, protecting the receiver from incast
+         *         when many initiators target it at once. With backends in
+         *         extra_params the window applies per listed backend,
+         *         otherwise it is peer-wide. A deadline passed at post time
+         *         still forces dispatch once it expires, and a single
+         *         request larger than the window is admitted when it has the
+         *         window to itself. Passing zero removes the window.
+         *
+         * @param  remote_agent       Name of the destination agent
+         * @param  max_inflight_bytes Window size in bytes, 0 to remove
+         * @param  extra_params [in]  Optional backends to scope the window to
+         * @return nixl_status_t      Error code if call was not successful
+         */
+        nixl_status_t
+        setSendWindow (const std::string &remote_agent,
+                       uint64_t max_inflight_bytes,
+                       const nixl_opt_args_t* extra_params = nullptr) const;
+
+        /**
+         * @brief  Shape the aggregate bandwidth of one priority class with a
+         *         token bucket, so background bulk traffic (e.g. checkpoint
+         *         uploads posted as NIXL_XFER_PRIO_LOW) trickles at a set
+         *         rate instead of saturating the rails under serving
+         *         traffic. Posts of a shaped class whose bucket is drained
+         *         are queued in the agent scheduler like other deferred
+         *         requests, and auto-chunked transfers are paced chunk by
+         *         chunk, so a single huge transfer observes the rate too.
+         *         The rate can be changed at any time and applies to
+         *         traffic already in the scheduler; a deadline passed at
+         *         post time still forces dispatch once it expires. Passing
+         *         a zero rate removes the shaping of the class.
+         *
+         * @param  priority      Priority class to shape
+         * @param  bytes_per_sec Sustained rate in bytes per second, 0 to remove
+         * @param  burst_bytes   Bucket depth; 0 picks one second at the rate
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        setClassRate (const nixl_xfer_priority_t &priority,
+                      uint64_t bytes_per_sec,
+                      uint64_t burst_bytes = 0) const;
+
+        /**
+         * @brief  Configure capacity and watermarks for a memory tier, enabling
+         *         memory-pressure tracking for that memory type. Once the bytes
+         *         registered in the tier cross the high watermark, blocks
+         *         designated through designateEvictable are migrated out in the
+         *         background until estimated occupancy falls below the low
+         *         watermark. Migrations are batched loopback transfers, so the
+         *         agent's own metadata must be loaded back as a remote
+         *         (which registerMem does automatically for backends with
+         *         local support).
+         *
+         * @param  mem_type      Memory type of the tier (e.g., VRAM_SEG, DRAM_SEG)
+         * @param  cfg           Tier capacity and watermark fractions
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        configureTier (const nixl_mem_t &mem_type, const nixlTierConfig &cfg) const;
+
+        /**
+         * @brief  Designate blocks as eviction candidates of their tier. The
+         *         source and destination lists are aligned by index and both
+         *         sides must already be registered; candidates are migrated
+         *         FIFO when the source tier crosses its high watermark.
+         *
+         * @param  src_descs     Blocks in the pressured tier, eligible to move out
+         * @param  dst_descs     Pre-registered destination of each block
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        designateEvictable (const nixl_xfer_dlist_t &src_descs,
+                            const nixl_xfer_dlist_t &dst_descs) const;
+
+        /**
+         * @brief  Migrate blocks between tiers right away as one batched
+         *         loopback transfer. The returned handle behaves as if posted
+         *         through postXferReq: poll it with getXferStatus and release
+         *         it with releaseXferReq.
+         *
+         * @param  src_descs      Blocks to migrate
+         * @param  dst_descs      Destination of each block, aligned by index
+         * @param  req_hndl [out] Transfer request handle of the migration
+         * @param  extra_params   Optional extra parameters, as for createXferReq
+         * @return nixl_status_t  NIXL_IN_PROG or error code if call was not successful
+         */
+        nixl_status_t
+        migrateBlocks (const nixl_xfer_dlist_t &src_descs,
+                       const nixl_xfer_dlist_t &dst_descs,
+                       nixlXferReqH* &req_hndl,
+                       const nixl_opt_args_t* extra_params = nullptr) const;
+
+        /**
+         * @brief  Queue a background low-priority copy of blocks toward a
+         *         faster tier ahead of demand. The transfer is issued and
+         *         reaped by the tiering worker; there is no handle to manage.
+         *
+         * @param  src_descs     Blocks to prefetch
+         * @param  dst_descs     Destination of each block, aligned by index
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        prefetchBlocks (const nixl_xfer_dlist_t &src_descs,
+                        const nixl_xfer_dlist_t &dst_descs) const;
+
+        /**
+         * @brief  Exempt blocks from automatic eviction. Designated candidates
+         *         overlapping a pinned range stay queued until unpinned.
+         *
+         * @param  descs         Blocks to pin in their current tier
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        pinBlocks (const nixl_xfer_dlist_t &descs) const;
+
+        /**
+         * @brief  Remove a pin added by pinBlocks; pass the same descriptors.
+         *
+         * @param  descs         Blocks to unpin
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        unpinBlocks (const nixl_xfer_dlist_t &descs) const;
+
         /*** Operations on prepared Transfer Request ***/
 
         /**
@@ -278,14 +646,104 @@ class nixlAgent {
                      const nixl_opt_args_t* extra_params = nullptr) const;
 
         /**
-         * @brief  Check the status of transfer request `req_hndl`
+         * @brief  Submit a batch of transfer requests in a single call. The agent lock is
+         *         acquired once for the whole batch, and the requests are grouped per backend
+         *         engine so each backend can submit its share back to back within a single
+         *         progress pass. Each handle behaves as if posted through postXferReq, and
+         *         its individual status can be checked through getXferStatus afterwards.
+         *         If extra_params carry a notification, it is applied to every request in
+         *         the batch, same as posting each of them with those extra_params.
+         *
+         * @param  req_hndls     Transfer request handles obtained from makeXferReq/createXferReq
+         * @param  extra_params  Optional extra parameters applied to every posted request
+         * @return nixl_status_t Error code if posting any of the requests was not successful,
+         *                       while the rest of the batch is still attempted (best effort)
+         */
+        nixl_status_t
+        postXferReqBatch (const std::vector<nixlXferReqH*> &req_hndls,
+                          const nixl_opt_args_t* extra_params = nullptr) const;
+
+        /**
+         * @brief  Check the status of transfer request `req_hndl`. Optionally,
+         *         a time budget can be set through extra_params->progressBudget
+         *         to bound how long the call spends in backend progress: once
+         *         it is spent, remaining rails/chunks of a striped or
+         *         auto-chunked request are left for the next call and
+         *         NIXL_IN_PROG is returned.
          *
          * @param  req_hndl      Transfer request handle after postXferReq
+         * @param  extra_params  Optional extra parameters used in checking the status
          * @return nixl_status_t NIXL_IN_PROG or error code if call was not successful
          */
         nixl_status_t
-        getXferStatus (nixlXferReqH* req_hndl) const;
+        getXferStatus (nixlXferReqH* req_hndl,
+                       const nixl_opt_args_t* extra_params = nullptr) const;
+
+        /**
+         * @brief  Check the status of a batch of transfer requests in a single call. The
+         *         agent lock is acquired once for the whole batch, and in-flight requests
+         *         are grouped per backend engine so each backend drives its progress
+         *         machinery once and harvests the remaining statuses from completion-flag
+         *         reads, making the poll cost scale with completions rather than with the
+         *         number of outstanding requests. Each handle behaves as if polled through
+         *         getXferStatus. A progress budget through extra_params->progressBudget
+         *         bounds the whole batch: once spent, unpolled requests keep their previous
+         *         status until the next call.
+         *
+         * @param  req_hndls      Transfer request handles after postXferReq
+         * @param  statuses [out] Per-request statuses, index-aligned with req_hndls
+         * @param  extra_params   Optional extra parameters used in checking the statuses
+         * @return nixl_status_t  First error among the requests, else NIXL_IN_PROG while
+         *                        any request is still in flight, else NIXL_SUCCESS
+         */
+        nixl_status_t
+        getXferStatusBatch (const std::vector<nixlXferReqH*> &req_hndls,
+                            std::vector<nixl_status_t> &statuses,
+                            const nixl_opt_args_t* extra_params = nullptr) const;
+
+        /**
+         * @brief  Query partial completion of transfer request `req_hndl`.
+         *         The transfer status is refreshed as in getXferStatus, then
+         *         a progress snapshot is filled in: for striped or
+         *         auto-chunked requests, whose chunks complete independently,
+         *         it reports the bytes of every finished chunk, the leading
+         *         contiguous finished bytes in descriptor-list order
+         *         (watermark), and a per-chunk completion flag, so consumers
+         *         can start working on the completed prefix while the tail is
+         *         still in flight. Single-backend requests report
+         *         all-or-nothing.
+         *
+         * @param  req_hndl       Transfer request handle after postXferReq
+         * @param  progress [out] Output progress snapshot
+         * @return nixl_status_t  The transfer status (as getXferStatus);
+         *                        progress is filled also for NIXL_IN_PROG
+         */
+        nixl_status_t
+        getXferProgress (nixlXferReqH* req_hndl,
+                         nixl_xfer_progress_t &progress) const;
 
+        /**
+         * @brief  Query the subset of a failed transfer that did not complete.
+         *         Valid once getXferStatus has reported a terminal error for
+         *         `req_hndl`: the local and remote descriptors whose operations
+         *         the backend knows did not finish are returned as ready-to-use
+         *         retry lists for a new createXferReq, so a single failure
+         *         costs the failed descriptors' retransmission instead of the
+         *         whole batch. Returns NIXL_ERR_NOT_SUPPORTED when the backend
+         *         cannot attribute the failure (the whole request must then be
+         *         retried), and empty lists for a request that succeeded.
+         *
+         * @param  req_hndl           Transfer request handle after postXferReq
+         * @param  retry_local  [out] Local descriptors to retry; list memory
+         *                            type is overwritten to match the request
+         * @param  retry_remote [out] Remote descriptors to retry, aligned by
+         *                            index with retry_local
+         * @return nixl_status_t      Error code if call was not successful
+         */
+        nixl_status_t
+        getXferFailedDescs (const nixlXferReqH* req_hndl,
+                            nixl_xfer_dlist_t &retry_local,
+                            nixl_xfer_dlist_t &retry_remote) const;
 
         /**
          * @brief  Get the telemetry data associated with `req_hndl`.
@@ -319,6 +777,26 @@ class nixlAgent {
         nixl_status_t
         releaseXferReq (nixlXferReqH* req_hndl) const;
 
+        /**
+         * @brief  Cancel an in-flight transfer without waiting for it to finish,
+         *         propagating a backend-level abort where the driver supports one,
+         *         so abandoned transfers (e.g. dead speculative prefetches) stop
+         *         consuming rail bandwidth immediately. On success the request's
+         *         status becomes NIXL_ERR_CANCELED and the handle stays valid; it
+         *         must still be released with releaseXferReq. A request that was
+         *         never dispatched (deferred or dependency-suspended) is unqueued.
+         *         Returns NIXL_ERR_NOT_SUPPORTED when the backend has no abort
+         *         path, in which case the request is untouched and releaseXferReq
+         *         remains the (potentially blocking) way to cancel it.
+         *
+         * @param  req_hndl                Transfer request handle to cancel
+         * @param  bytes_transferred [out] Bytes known to have completed before the
+         *                                 abort; 0 when the backend cannot tell
+         * @return nixl_status_t          Error code if call was not successful
+         */
+        nixl_status_t
+        cancelXferReq (nixlXferReqH* req_hndl, size_t &bytes_transferred) const;
+
         /**
          * @brief  Create a GPU transfer request from a transfer request.
          *
@@ -364,6 +842,10 @@ class nixlAgent {
          * how many signals fit in each descriptor based on the descriptor length
          * and the signal size, then prepares each signal within every descriptor.
          *
+         * A slab prepared this way can back a device-side signal pool
+         * (nixlGpuSignalPool in the GPU device API), which lets device code
+         * allocate and recycle the prepared slots without further host calls.
+         *
          * @param  signal_descs  [in] Registered descriptor list for the signal memory.
          *                            Each descriptor can contain multiple signals.
          * @param  extra_params  [in] Extra parameters used in preparing the GPU signal.
@@ -390,7 +872,16 @@ class nixlAgent {
          * @brief  Add entries to the input notifications list (can be non-empty), which is a map
          *         from agent name to a list of notification received from that agent. Elements
          *         are released within the agent after this call. Optionally, a list of backends
-         *         can be mentioned in extra_params to only get those backends notifications.
+         *         can be mentioned in extra_params to only get those backends notifications,
+         *         and a time budget can be set through extra_params->progressBudget: once it
+         *         is spent, remaining backends are left for the next call, which resumes
+         *         where this one stopped.
+         *
+         *         Setting extra_params->notifTimeout turns an empty-handed call into a
+         *         hybrid wait: the agent keeps re-draining the backends, spinning hot at
+         *         first and then backing off into sleeps, until a notification lands in
+         *         notif_map or the timeout expires — poll-level latency under load, near
+         *         zero CPU when idle. The agent lock is dropped between passes.
          *
          * @param  notif_map     Input notifications list
          * @param  extra_params  Optional extra parameters used in getting notifications
@@ -400,6 +891,88 @@ class nixlAgent {
         getNotifs (nixl_notifs_t &notif_map,
                    const nixl_opt_args_t* extra_params = nullptr);
 
+        /**
+         * @brief  Zero-copy variant of getNotifs: the output map is cleared and
+         *         filled with views into an agent-owned buffer, avoiding the
+         *         per-notification copies of the string-based API. The views
+         *         (keys and payloads) are only valid until the next call to
+         *         getNotifsView on this agent. Optionally, a list of backends
+         *         can be mentioned in extra_params to only get those backends
+         *         notifications, and a time budget can be set through
+         *         extra_params->progressBudget as for getNotifs.
+         *
+         * @param  notif_map     Output notifications view map, cleared first
+         * @param  extra_params  Optional extra parameters used in getting notifications
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        getNotifsView (nixl_notifs_view_t &notif_map,
+                       const nixl_opt_args_t* extra_params = nullptr);
+
+        /**
+         * @brief  Create a sharded notification queue subscribed to the given
+         *         remote agents. Notifications from a subscribed agent are
+         *         routed into the queue by whichever thread polls getNotifs or
+         *         getNotifsView, instead of landing in that caller's map, and
+         *         are drained through getQueuedNotifs under the queue's own
+         *         lock — so multiple consumer threads each draining their own
+         *         queue do not contend on the agent lock or re-demultiplex a
+         *         shared map. Each remote agent can be claimed by at most one
+         *         queue; claiming an already routed agent fails the call.
+         *
+         * @param  remote_agents      Remote agent names to subscribe to, non-empty
+         * @param  queue_hndl [out]   Handle to the created notification queue
+         * @return nixl_status_t      Error code if call was not successful
+         */
+        nixl_status_t
+        createNotifQueue (const std::vector<std::string> &remote_agents,
+                          nixlNotifQueueH* &queue_hndl);
+
+        /**
+         * @brief  Drain a sharded notification queue into the input map (can be
+         *         non-empty), in the same form as getNotifs. Only the queue's
+         *         own lock is taken, so concurrent consumers scale; note the
+         *         queue only fills while some thread polls getNotifs or
+         *         getNotifsView.
+         *
+         * @param  queue_hndl    Notification queue to drain
+         * @param  notif_map     Input notifications list
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        getQueuedNotifs (nixlNotifQueueH* queue_hndl,
+                         nixl_notifs_t &notif_map);
+
+        /**
+         * @brief  Release a sharded notification queue. Undelivered
+         *         notifications are discarded; subsequent notifications from
+         *         the previously subscribed agents are delivered through
+         *         getNotifs again.
+         *
+         * @param  queue_hndl    Notification queue to be released
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        releaseNotifQueue (nixlNotifQueueH* queue_hndl);
+
+        /**
+         * @brief  Register notification subscription filters. With at least one
+         *         prefix registered, only incoming notifications whose payload
+         *         starts with one of the prefixes (binary-safe comparison) are
+         *         delivered through getNotifs/getNotifsView or routed to queues;
+         *         the rest — e.g. other replicas' broadcasts — are counted and
+         *         dropped at the drain point, before being queued or copied.
+         *         Replaces any previously registered filters; an empty vector
+         *         removes filtering. Transfer-bound notifications are matched
+         *         like standalone ones; the agent's internal control
+         *         notifications are not affected.
+         *
+         * @param  prefixes      Payload prefixes to subscribe to; empty clears
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        setNotifFilter (const std::vector<nixl_blob_t> &prefixes);
+
         /**
          * @brief  Generate a notification, not bound to a transfer, e.g., for control.
          *         Metadata of remote agent should be available before this call. The
@@ -447,6 +1020,30 @@ class nixlAgent {
                           nixl_blob_t &str,
                           const nixl_opt_args_t* extra_params = nullptr) const;
 
+        /**
+         * @brief  Get a sequence-numbered metadata delta for this agent, describing
+         *         descriptors added and removed since the previous delta. A remote agent
+         *         that already loaded this agent's metadata applies the delta in place
+         *         through loadRemoteMD, instead of re-parsing a full metadata blob.
+         *         Deltas are chained by sequence number; if the receiver detects a gap
+         *         it rejects the delta with NIXL_ERR_MISMATCH and a full metadata
+         *         exchange is required to resync. Added descriptors must already be
+         *         registered, while removed descriptors are applied best effort.
+         *         If `extra_params->backends` is non-empty, only those backends are
+         *         considered for the added descriptors.
+         *
+         * @param  added_descs   [in]  Descriptors registered since the last delta
+         * @param  removed_descs [in]  Descriptors deregistered since the last delta
+         * @param  str           [out] The serialized metadata delta blob
+         * @param  extra_params  [in]  Optional extra parameters used in getting the delta
+         * @return nixl_status_t       Error code if call was not successful
+         */
+        nixl_status_t
+        getLocalDeltaMD(const nixl_reg_dlist_t &added_descs,
+                        const nixl_reg_dlist_t &removed_descs,
+                        nixl_blob_t &str,
+                        const nixl_opt_args_t* extra_params = nullptr) const;
+
         /**
          * @brief  Load other agent's metadata and unpack it internally. Now the local
          *         agent can initiate transfers towards the remote agent.
@@ -459,6 +1056,61 @@ class nixlAgent {
         loadRemoteMD (const nixl_blob_t &remote_metadata,
                       std::string &agent_name);
 
+        /**
+         * @brief  Non-blocking variant of loadRemoteMD: parsing and loading of the
+         *         metadata blob run on a background thread, so connection setup can
+         *         overlap deserialization of large peers. Progress and the extracted
+         *         agent name are queried through getMDLoadStatus, and the handle must
+         *         be released with releaseMDLoadH.
+         *
+         * @param  remote_metadata  Serialized metadata blob to be loaded
+         * @param  handle     [out] Handle to query the load with
+         * @return nixl_status_t    Error code if call was not successful
+         */
+        nixl_status_t
+        loadRemoteMDAsync (const nixl_blob_t &remote_metadata,
+                           nixlMDLoadH* &handle);
+
+        /**
+         * @brief  Query a background metadata load started by loadRemoteMDAsync.
+         *         Returns NIXL_IN_PROG while the load is still running; once it
+         *         completes, returns its final status and fills in the agent name
+         *         extracted from the blob. Can be recalled after completion.
+         *
+         * @param  handle           Handle returned by loadRemoteMDAsync
+         * @param  agent_name [out] Agent name extracted from the loaded metadata blob
+         * @return nixl_status_t    NIXL_IN_PROG, or the final status of the load
+         */
+        nixl_status_t
+        getMDLoadStatus (nixlMDLoadH* handle,
+                         std::string &agent_name);
+
+        /**
+         * @brief  Release a handle returned by loadRemoteMDAsync, waiting for the
+         *         background load to finish first if it is still running.
+         *
+         * @param  handle        Handle returned by loadRemoteMDAsync
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        releaseMDLoadH (nixlMDLoadH* handle);
+
+        /**
+         * @brief  Hint that the listed agents will soon be contacted: their metadata
+         *         is fetched and loaded in the background, with the same delivery
+         *         options as fetchRemoteMD. Purely an optimization, so per-peer
+         *         failures are logged rather than returned; checkRemoteMD tells
+         *         whether a peer's metadata has arrived.
+         *
+         * @param  remote_names  Names of the remote agents to prefetch metadata for
+         * @param  extra_params  Optionally specify IP address and/or port, or
+         *                       metadata label, as in fetchRemoteMD
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        prefetchRemoteMD (const std::vector<std::string> &remote_names,
+                          const nixl_opt_args_t* extra_params = nullptr);
+
         /**
          * @brief  Invalidate the remote agent metadata cached locally. This will
          *         disconnect from that agent if already connected, and no more
@@ -470,6 +1122,35 @@ class nixlAgent {
         nixl_status_t
         invalidateRemoteMD (const std::string &remote_agent);
 
+        /**
+         * @brief  Capture the metadata of every loaded remote agent into a
+         *         checkpoint blob, as the last full metadata blob per peer
+         *         followed by the delta chain applied on top of it. A
+         *         restarted agent passes the blob to restoreMD to rebuild
+         *         its peer view locally instead of re-exchanging metadata
+         *         with every peer.
+         *
+         * @param  ckpt [out]    The serialized checkpoint blob
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        checkpointMD (nixl_blob_t &ckpt) const;
+
+        /**
+         * @brief  Replay a checkpoint blob from checkpointMD through
+         *         loadRemoteMD, restoring the peer metadata and connections
+         *         of the agent that produced it. Local memory must be
+         *         re-registered through registerMem first, since backend
+         *         registrations do not survive a process restart. Peers
+         *         that fail to load (e.g. gone since the checkpoint) are
+         *         skipped with a warning.
+         *
+         * @param  ckpt          Checkpoint blob from checkpointMD
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        restoreMD (const nixl_blob_t &ckpt);
+
         /*** Metadata handling through direct channels (p2p socket and ETCD) ***/
         /**
          * @brief  Send your own agent metadata to a remote location.
@@ -508,6 +1189,23 @@ class nixlAgent {
         sendLocalPartialMD(const nixl_reg_dlist_t &descs,
                            const nixl_opt_args_t* extra_params = nullptr) const;
 
+        /**
+         * @brief  Send a sequence-numbered metadata delta to a peer or central metadata
+         *         server, with the same delta semantics as getLocalDeltaMD. Delivery
+         *         options mirror sendLocalPartialMD: 'extra_params->ipAddr'/'port' select
+         *         a single peer, otherwise 'extra_params->metadataLabel' is required for
+         *         sending to the central metadata server.
+         *
+         * @param  added_descs   [in]  Descriptors registered since the last delta
+         * @param  removed_descs [in]  Descriptors deregistered since the last delta
+         * @param  extra_params  [in]  Optional extra parameters used in sending the delta
+         * @return nixl_status_t       Error code if call was not successful
+         */
+        nixl_status_t
+        sendLocalDeltaMD(const nixl_reg_dlist_t &added_descs,
+                         const nixl_reg_dlist_t &removed_descs,
+                         const nixl_opt_args_t* extra_params = nullptr) const;
+
         /**
          * @brief  Fetch other agent's metadata from a peer or central metadata server,
          *         then unpack it internally. When fetching from a peer, only the full metadata
@@ -555,6 +1253,33 @@ class nixlAgent {
         checkRemoteMD (const std::string remote_name,
                        const nixl_xfer_dlist_t &descs) const;
 
+        /**
+         * @brief  Progress the metadata/communication channel once, in agents
+         *         configured for user-driven comm progress (see the
+         *         userDrivenComm agent config). Accepts pending connections,
+         *         runs queued metadata commands, processes peer messages and
+         *         pumps in-progress sends, without blocking.
+         *
+         * @return nixl_status_t NIXL_ERR_NOT_SUPPORTED when the agent runs the
+         *                       listener thread instead
+         */
+        nixl_status_t
+        progressControlPlane ();
+
+        /**
+         * @brief  Get a pollable fd that becomes readable whenever the
+         *         communication channel has work for progressControlPlane
+         *         (socket readiness or queued commands), so an external event
+         *         loop can schedule the progress calls. Only available in
+         *         agents configured for user-driven comm progress.
+         *
+         * @param  fd [out]      The readiness fd; owned by the agent
+         * @return nixl_status_t NIXL_ERR_NOT_SUPPORTED when the agent runs the
+         *                       listener thread instead
+         */
+        nixl_status_t
+        getControlPlaneFd (int &fd) const;
+
 };
 
 #endif
@@ -0,0 +1,178 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_C_H
+#define _NIXL_C_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file nixl_c.h
+ * @brief Flat extern-C layer over the transfer hot path, for FFI consumers.
+ *
+ * Covers only the calls a data-plane sidecar makes per transfer — create,
+ * post, status, release, and notification draining — with POD arguments and
+ * no C++ types crossing the boundary, so language bindings need no glue
+ * objects or per-call copies on this path. Agent setup (configuration,
+ * memory registration, metadata exchange) stays on the full C++ API or an
+ * existing binding; the agent handle here is the nixlAgent pointer obtained
+ * from there.
+ *
+ * All calls are thread safe, matching the C++ API. Internal scratch is
+ * thread local, so the hot calls allocate nothing in steady state.
+ */
+
+/** Status codes; values mirror nixl_status_t in nixl_types.h */
+typedef int nixl_c_status_t;
+
+#define NIXL_C_IN_PROG 1
+#define NIXL_C_SUCCESS 0
+#define NIXL_C_ERR_NOT_POSTED (-1)
+#define NIXL_C_ERR_INVALID_PARAM (-2)
+#define NIXL_C_ERR_BACKEND (-3)
+#define NIXL_C_ERR_NOT_FOUND (-4)
+#define NIXL_C_ERR_MISMATCH (-5)
+#define NIXL_C_ERR_NOT_ALLOWED (-6)
+#define NIXL_C_ERR_REPOST_ACTIVE (-7)
+#define NIXL_C_ERR_UNKNOWN (-8)
+#define NIXL_C_ERR_NOT_SUPPORTED (-9)
+#define NIXL_C_ERR_REMOTE_DISCONNECT (-10)
+#define NIXL_C_ERR_CANCELED (-11)
+
+/** Memory segment types; values mirror nixl_mem_t */
+#define NIXL_C_MEM_DRAM 0
+#define NIXL_C_MEM_VRAM 1
+#define NIXL_C_MEM_BLK 2
+#define NIXL_C_MEM_OBJ 3
+#define NIXL_C_MEM_FILE 4
+
+/** Transfer operations; values mirror nixl_xfer_op_t */
+#define NIXL_C_OP_READ 0
+#define NIXL_C_OP_WRITE 1
+
+/** A nixlAgent*, obtained from the C++ API or an existing binding */
+typedef void *nixl_c_agent_h;
+
+/** A transfer request handle returned by nixl_c_xfer_create */
+typedef void *nixl_c_xfer_h;
+
+/** One transfer descriptor; the POD mirror of nixlBasicDesc */
+typedef struct nixl_c_desc {
+    uintptr_t addr; /**< Start address (or offset for storage segments) */
+    size_t len; /**< Length in bytes */
+    uint64_t dev_id; /**< Device/file id of the segment */
+} nixl_c_desc_t;
+
+/**
+ * One received notification. The pointers reference storage owned by the
+ * library and stay valid until the next nixl_c_get_notifs call on the same
+ * thread; copy them out before that if needed. Not NUL terminated.
+ */
+typedef struct nixl_c_notif {
+    const char *agent; /**< Name of the sending agent */
+    size_t agent_len;
+    const char *msg; /**< Notification payload */
+    size_t msg_len;
+} nixl_c_notif_t;
+
+/**
+ * Create a transfer request from POD descriptor arrays. Both sides must be
+ * registered/loaded through the regular API beforehand; backend selection
+ * follows the same rules as nixlAgent::createXferReq with no extra params.
+ *
+ * @param agent            Agent handle.
+ * @param op               NIXL_C_OP_READ or NIXL_C_OP_WRITE.
+ * @param local_descs      Local descriptors, local_count entries.
+ * @param local_count      Number of local descriptors.
+ * @param local_mem_type   NIXL_C_MEM_* type of the local descriptors.
+ * @param remote_descs     Remote descriptors, remote_count entries.
+ * @param remote_count     Number of remote descriptors.
+ * @param remote_mem_type  NIXL_C_MEM_* type of the remote descriptors.
+ * @param remote_agent     Remote agent name, remote_agent_len bytes.
+ * @param remote_agent_len Length of remote_agent, no NUL required.
+ * @param xfer_out         Receives the transfer handle on success.
+ */
+nixl_c_status_t
+nixl_c_xfer_create(nixl_c_agent_h agent,
+                   int op,
+                   const nixl_c_desc_t *local_descs,
+                   size_t local_count,
+                   int local_mem_type,
+                   const nixl_c_desc_t *remote_descs,
+                   size_t remote_count,
+                   int remote_mem_type,
+                   const char *remote_agent,
+                   size_t remote_agent_len,
+                   nixl_c_xfer_h *xfer_out);
+
+/**
+ * Post a created (or completed, for reposting) transfer request, optionally
+ * with a notification payload delivered to the remote agent on completion.
+ *
+ * @param agent     Agent handle.
+ * @param xfer      Transfer handle from nixl_c_xfer_create.
+ * @param notif_msg Notification payload, or NULL for no notification.
+ * @param notif_len Payload length in bytes.
+ *
+ * @return NIXL_C_SUCCESS when completed inline, NIXL_C_IN_PROG when posted,
+ *         or an error code.
+ */
+nixl_c_status_t
+nixl_c_xfer_post(nixl_c_agent_h agent,
+                 nixl_c_xfer_h xfer,
+                 const char *notif_msg,
+                 size_t notif_len);
+
+/**
+ * Check (and progress) a posted transfer.
+ *
+ * @return NIXL_C_SUCCESS when done, NIXL_C_IN_PROG while pending, or an
+ *         error code.
+ */
+nixl_c_status_t
+nixl_c_xfer_status(nixl_c_agent_h agent, nixl_c_xfer_h xfer);
+
+/** Release a transfer handle; aborts the transfer if still possible. */
+nixl_c_status_t
+nixl_c_xfer_release(nixl_c_agent_h agent, nixl_c_xfer_h xfer);
+
+/**
+ * Drain received notifications into a caller-provided array, zero copy: the
+ * entries point into library-owned storage (see nixl_c_notif_t lifetime).
+ * Notifications that do not fit in capacity are kept and returned by the
+ * next call; new ones are only fetched once the backlog is drained.
+ *
+ * @param agent     Agent handle.
+ * @param notifs    Output array, capacity entries.
+ * @param capacity  Size of the output array.
+ * @param count_out Receives the number of entries written.
+ */
+nixl_c_status_t
+nixl_c_get_notifs(nixl_c_agent_h agent,
+                  nixl_c_notif_t *notifs,
+                  size_t capacity,
+                  size_t *count_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _NIXL_C_H */
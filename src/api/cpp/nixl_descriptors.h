@@ -19,6 +19,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <new>
 #include <vector>
 #include <string>
 #include <algorithm>
@@ -138,6 +139,17 @@ public:
     /** @var blob for metadata information */
     nixl_blob_t metaInfo;
 
+    /** @var dmabuf file descriptor backing this buffer, or -1 if none.
+     *       Registration-time hint only: backends that support dmabuf
+     *       mapping (e.g. ucp_mem_map with a dmabuf fd, fi_mr_regattr
+     *       with FI_MR_DMABUF) register through the fd instead of the
+     *       raw address, avoiding peer-direct fallback paths. File
+     *       descriptors are process-local, so this field is neither
+     *       serialized nor compared. */
+    int dmabufFd = -1;
+    /** @var Offset of addr within the dmabuf, when dmabufFd is set */
+    size_t dmabufOffset = 0;
+
     /** @var Reuse parent constructor without the metadata */
     using nixlBasicDesc::nixlBasicDesc;
 
@@ -153,6 +165,22 @@ public:
                  const size_t &len,
                  const uint64_t &dev_id,
                  const nixl_blob_t &meta_info);
+    /**
+     * @brief Parametrized constructor for a dmabuf-backed nixlBlobDesc
+     *
+     * @param addr          Start of buffer, as mapped in this process
+     * @param len           Length of buffer
+     * @param devID         deviceID/BlockID/fileID
+     * @param dmabuf_fd     dmabuf file descriptor backing the buffer
+     * @param dmabuf_offset Offset of addr within the dmabuf
+     * @param meta_info     Metadata blob
+     */
+    nixlBlobDesc(const uintptr_t &addr,
+                 const size_t &len,
+                 const uint64_t &dev_id,
+                 int dmabuf_fd,
+                 const size_t &dmabuf_offset,
+                 const nixl_blob_t &meta_info = "");
     /**
      * @brief Constructor for nixlBlobDesc from nixlBasicDesc and metadata blob
      *
@@ -188,6 +216,212 @@ public:
     print(const std::string &suffix) const;
 };
 
+/**
+ * @class nixlStridedDesc
+ * @brief A strided descriptor: `count` equal blocks of `blockLen` bytes,
+ *        `pitch` bytes apart, starting at `addr`. Describes one logical
+ *        element of a strided tensor layout (e.g. a head-interleaved KV
+ *        block) compactly; nixlDescList::addStridedDesc expands it into
+ *        the per-block descriptors in one pass.
+ */
+class nixlStridedDesc {
+public:
+    /** @var Start of the first block */
+    uintptr_t addr;
+    /** @var Length of each block */
+    size_t blockLen;
+    /** @var Distance between consecutive block starts, >= blockLen */
+    size_t pitch;
+    /** @var Number of blocks */
+    size_t count;
+    /** @var deviceID/blockID/fileID, shared by all blocks */
+    uint64_t devId;
+
+    /**
+     * @brief Default constructor for nixlStridedDesc
+     *      Does not initialize members to zero
+     */
+    nixlStridedDesc() {};
+    /**
+     * @brief Parametrized constructor for nixlStridedDesc
+     *
+     * @param addr      Start of the first block
+     * @param block_len Length of each block
+     * @param pitch     Distance between consecutive block starts
+     * @param count     Number of blocks
+     * @param dev_id    deviceID/BlockID/fileID
+     */
+    nixlStridedDesc(const uintptr_t &addr,
+                    const size_t &block_len,
+                    const size_t &pitch,
+                    const size_t &count,
+                    const uint64_t &dev_id)
+        : addr(addr), blockLen(block_len), pitch(pitch), count(count), devId(dev_id) {}
+};
+
+/**
+ * @class nixlDescStorage
+ * @brief Contiguous descriptor storage with inline capacity for small
+ *        lists. The first N elements live inside the object, starting on
+ *        a cacheline boundary, so the dominant short lists avoid a heap
+ *        allocation per list; larger lists spill to the heap like a
+ *        std::vector would.
+ */
+template<class T, size_t N>
+class nixlDescStorage {
+private:
+    /** @var Inline element storage, aligned to a cacheline */
+    alignas(64) alignas(T) unsigned char inline_buf[sizeof(T) * N];
+    /** @var Start of the active storage (inline or heap) */
+    T *data_ptr;
+    /** @var Number of live elements */
+    size_t count;
+    /** @var Current capacity in elements */
+    size_t cap;
+
+    inline T *
+    inlineData() {
+        return reinterpret_cast<T *>(inline_buf);
+    }
+
+    void
+    grow(size_t min_cap) {
+        size_t new_cap = std::max(cap * 2, min_cap);
+        T *new_data = static_cast<T *>(::operator new(new_cap * sizeof(T)));
+        for (size_t i = 0; i < count; ++i) {
+            new (new_data + i) T(std::move(data_ptr[i]));
+            data_ptr[i].~T();
+        }
+        if (data_ptr != inlineData()) ::operator delete(data_ptr);
+        data_ptr = new_data;
+        cap = new_cap;
+    }
+
+public:
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    nixlDescStorage() : data_ptr(inlineData()), count(0), cap(N) {}
+
+    nixlDescStorage(const nixlDescStorage &other) : nixlDescStorage() {
+        reserve(other.count);
+        for (size_t i = 0; i < other.count; ++i)
+            new (data_ptr + i) T(other.data_ptr[i]);
+        count = other.count;
+    }
+
+    nixlDescStorage &
+    operator=(const nixlDescStorage &other) {
+        if (this != &other) {
+            clear();
+            reserve(other.count);
+            for (size_t i = 0; i < other.count; ++i)
+                new (data_ptr + i) T(other.data_ptr[i]);
+            count = other.count;
+        }
+        return *this;
+    }
+
+    ~nixlDescStorage() {
+        clear();
+        if (data_ptr != inlineData()) ::operator delete(data_ptr);
+    }
+
+    inline size_t
+    size() const {
+        return count;
+    }
+
+    inline T *
+    data() {
+        return data_ptr;
+    }
+
+    inline const T *
+    data() const {
+        return data_ptr;
+    }
+
+    void
+    reserve(size_t min_cap) {
+        if (min_cap > cap) grow(min_cap);
+    }
+
+    void
+    clear() {
+        for (size_t i = 0; i < count; ++i)
+            data_ptr[i].~T();
+        count = 0;
+    }
+
+    void
+    push_back(const T &val) {
+        if (count == cap) grow(count + 1);
+        new (data_ptr + count) T(val);
+        ++count;
+    }
+
+    void
+    resize(size_t new_count) {
+        if (new_count > count) {
+            reserve(new_count);
+            for (size_t i = count; i < new_count; ++i)
+                new (data_ptr + i) T();
+        } else {
+            for (size_t i = new_count; i < count; ++i)
+                data_ptr[i].~T();
+        }
+        count = new_count;
+    }
+
+    iterator
+    insert(iterator pos, const T &val) {
+        size_t index = pos - data_ptr; // push_back may reallocate
+        push_back(val);
+        std::rotate(data_ptr + index, data_ptr + count - 1, data_ptr + count);
+        return data_ptr + index;
+    }
+
+    iterator
+    erase(iterator pos) {
+        size_t index = pos - data_ptr;
+        std::move(data_ptr + index + 1, data_ptr + count, data_ptr + index);
+        data_ptr[count - 1].~T();
+        --count;
+        return data_ptr + index;
+    }
+
+    inline T &
+    operator[](size_t index) {
+        return data_ptr[index];
+    }
+
+    inline const T &
+    operator[](size_t index) const {
+        return data_ptr[index];
+    }
+
+    inline iterator
+    begin() {
+        return data_ptr;
+    }
+
+    inline iterator
+    end() {
+        return data_ptr + count;
+    }
+
+    inline const_iterator
+    begin() const {
+        return data_ptr;
+    }
+
+    inline const_iterator
+    end() const {
+        return data_ptr + count;
+    }
+};
+
 /**
  * @class nixlDescList
  * @brief A class for describing a list of descriptors, as a template based on
@@ -196,10 +430,13 @@ public:
 template<class T>
 class nixlDescList {
 protected:
+    /** @var Inline descriptor capacity before lists spill to the heap */
+    static constexpr size_t inline_desc_count = 8;
+
     /** @var NIXL memory type */
     nixl_mem_t type;
-    /** @var Vector for storing nixlDescs */
-    std::vector<T> descs;
+    /** @var Storage for nixlDescs, small-size optimized */
+    nixlDescStorage<T, inline_desc_count> descs;
 
 public:
     /**
@@ -275,22 +512,22 @@ public:
     /**
      * @brief Vector like iterators for const and non-const elements
      */
-    inline typename std::vector<T>::const_iterator
+    inline typename nixlDescStorage<T, inline_desc_count>::const_iterator
     begin() const {
         return descs.begin();
     }
 
-    inline typename std::vector<T>::const_iterator
+    inline typename nixlDescStorage<T, inline_desc_count>::const_iterator
     end() const {
         return descs.end();
     }
 
-    inline typename std::vector<T>::iterator
+    inline typename nixlDescStorage<T, inline_desc_count>::iterator
     begin() {
         return descs.begin();
     }
 
-    inline typename std::vector<T>::iterator
+    inline typename nixlDescStorage<T, inline_desc_count>::iterator
     end() {
         return descs.end();
     }
@@ -328,13 +565,48 @@ public:
     virtual void
     addDesc(const T &desc);
 
+    /**
+     * @brief Expand a strided descriptor into the list, appending one
+     *        descriptor per block. Storage for the whole expansion is
+     *        reserved up front, so strided tensor layouts are built in
+     *        one call instead of per-block addDesc loops on the user
+     *        side.
+     *
+     * @param  sdesc strided descriptor to expand
+     * @return nixl_status_t Error code if the strided shape is invalid
+     */
+    nixl_status_t
+    addStridedDesc(const nixlStridedDesc &sdesc);
+
     /**
      * @brief Remove descriptor from list at index
      *        Can throw std::out_of_range exception.
      */
-    void
+    virtual void
     remDesc(const int &index);
 
+    /**
+     * @brief Rebind the descriptor at [index] to a new start address in
+     *        place, keeping its length, device ID and any metadata. Allows
+     *        reusing an already validated list when only base pointers
+     *        change between steps, instead of rebuilding the list.
+     *
+     * @param  index Index of the descriptor to rebind
+     * @param  addr  New start address for the descriptor
+     * @return nixl_status_t Error code if index is out of bounds
+     */
+    virtual nixl_status_t
+    rebind(const unsigned int &index, const uintptr_t &addr);
+
+    /**
+     * @brief Shift the start address of every descriptor by a signed
+     *        offset in place, preserving count, lengths and device IDs.
+     *
+     * @param offset Signed value added to each descriptor's address
+     */
+    virtual void
+    rebind(const ptrdiff_t &offset);
+
     /**
      * @brief Convert a nixlDescList with metadata by trimming it to a
      *        nixlDescList of nixlBasicDesc elements
@@ -342,6 +614,48 @@ public:
     nixlDescList<nixlBasicDesc>
     trim() const;
 
+    /**
+     * @brief Union of two descriptor lists, with overlapping or adjacent
+     *        ranges on the same device coalesced into maximal descriptors.
+     *        Both lists must be sorted by (device ID, address) and of the
+     *        same memory type; the result holds nixlBasicDesc elements,
+     *        dropping any metadata like trim(). Runs as a single linear
+     *        merge over the two lists, so block-management math (e.g.
+     *        merging KV block sets) stays in C++ on the same structures
+     *        transfers use.
+     *
+     * @param  other  Sorted nixlDescList of the same memory type
+     * @param  result Receives the coalesced union; prior contents replaced
+     * @return nixl_status_t NIXL_ERR_MISMATCH on memory type mismatch,
+     *         NIXL_ERR_INVALID_PARAM if either list is not sorted
+     */
+    nixl_status_t
+    setUnion(const nixlDescList<T> &other, nixlDescList<nixlBasicDesc> &result) const;
+
+    /**
+     * @brief Byte ranges of this list not covered by `other`, i.e. the
+     *        blocks present here but not there. Same sortedness, memory
+     *        type and result conventions as setUnion; descriptors are
+     *        split where `other` partially covers them.
+     *
+     * @param  other  Sorted nixlDescList of the same memory type
+     * @param  result Receives the difference; prior contents replaced
+     * @return nixl_status_t Error code as in setUnion
+     */
+    nixl_status_t
+    setDifference(const nixlDescList<T> &other, nixlDescList<nixlBasicDesc> &result) const;
+
+    /**
+     * @brief Byte ranges covered by both this list and `other`. Same
+     *        sortedness, memory type and result conventions as setUnion.
+     *
+     * @param  other  Sorted nixlDescList of the same memory type
+     * @param  result Receives the intersection; prior contents replaced
+     * @return nixl_status_t Error code as in setUnion
+     */
+    nixl_status_t
+    setIntersection(const nixlDescList<T> &other, nixlDescList<nixlBasicDesc> &result) const;
+
     /**
      * @brief  Get the index of a descriptor that matches the `query`
      *
@@ -365,6 +679,82 @@ public:
     void
     print() const;
 };
+/**
+ * @class nixlDescListView
+ * @brief A non-owning, read-only view over the descriptors of a
+ *        nixlDescList. Cheap to copy and pass by value. The viewed list
+ *        must outlive the view, and structural changes to the list
+ *        (add/remove/resize) invalidate it.
+ */
+template<class T>
+class nixlDescListView {
+private:
+    /** @var NIXL memory type of the viewed list */
+    nixl_mem_t type;
+    /** @var Start of the viewed descriptor storage */
+    const T *data;
+    /** @var Number of viewed descriptors */
+    size_t count;
+
+public:
+    /**
+     * @brief Construct a view over an existing descriptor list,
+     *        without copying its storage
+     *
+     * @param d_list nixlDescList object to view
+     */
+    nixlDescListView(const nixlDescList<T> &d_list)
+        : type(d_list.getType()),
+          data(d_list.isEmpty() ? nullptr : &(*d_list.begin())),
+          count(d_list.descCount()) {}
+
+    /**
+     * @brief      Get NIXL memory type of the viewed list
+     */
+    inline nixl_mem_t
+    getType() const {
+        return type;
+    }
+
+    /**
+     * @brief       Get count of descriptors
+     */
+    inline int
+    descCount() const {
+        return count;
+    }
+
+    /**
+     * @brief Check if the view is empty or not
+     */
+    inline bool
+    isEmpty() const {
+        return (count == 0);
+    }
+
+    /**
+     * @brief Operator [] overloading, read-only descriptor access.
+     *        No bounds check is performed.
+     */
+    inline const T &
+    operator[](unsigned int index) const {
+        return data[index];
+    }
+
+    /**
+     * @brief Vector like const iterators
+     */
+    inline const T *
+    begin() const {
+        return data;
+    }
+
+    inline const T *
+    end() const {
+        return data + count;
+    }
+};
+
 /**
  * @brief A typedef for a nixlDescList<nixlBasicDesc>
  *        used for creating transfer descriptor lists
@@ -375,5 +765,15 @@ using nixl_xfer_dlist_t = nixlDescList<nixlBasicDesc>;
  *        used for creating registratoin descriptor lists
  */
 using nixl_reg_dlist_t = nixlDescList<nixlBlobDesc>;
+/**
+ * @brief A typedef for a nixlDescListView<nixlBasicDesc>
+ *        used for viewing transfer descriptor lists
+ */
+using nixl_xfer_dlist_view_t = nixlDescListView<nixlBasicDesc>;
+/**
+ * @brief A typedef for a nixlDescListView<nixlBlobDesc>
+ *        used for viewing registration descriptor lists
+ */
+using nixl_reg_dlist_view_t = nixlDescListView<nixlBlobDesc>;
 
 #endif
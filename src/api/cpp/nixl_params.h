@@ -61,6 +61,110 @@ class nixlAgentConfig {
          */
         std::chrono::microseconds etcdWatchTimeout;
 
+        /**
+         * @var Number of threads in the shared progress executor.
+         *      When non-zero, the agent runs a capped pool of progress threads
+         *      that backends register their pollers into, instead of each
+         *      backend spawning dedicated progress threads. Zero (default)
+         *      keeps the per-backend threading behavior.
+         */
+        uint32_t progExecutorThreads;
+
+        /**
+         * @var Back internal agent buffers (serdes working buffers and
+         *      similar metadata-path scratch) with a huge-page arena,
+         *      falling back to regular pages when none are available.
+         */
+        bool arenaHugePages;
+
+        /**
+         * @var NUMA node to bind the internal buffer arena to, or -1 to
+         *      leave placement to the default policy.
+         */
+        int arenaNumaNode;
+
+        /**
+         * @var Defer backend deregistration in deregisterMem. Regions
+         *      leave the local section immediately (no longer populated
+         *      into transfers), while the driver-level deregister calls
+         *      are batched per deregisterMem call and reclaimed one batch
+         *      at a time on the shared progress executor, smoothing the
+         *      latency spikes of bulk recycling. Only takes effect when
+         *      progExecutorThreads is non-zero.
+         */
+        bool deferredDereg;
+
+        /**
+         * @var CPU set for backend progress threads, as a comma separated
+         *      core list with ranges (e.g. "2,4-7"). Applied at thread
+         *      creation across backends that spawn progress threads and to
+         *      the shared progress executor. Empty leaves threads unpinned.
+         */
+        std::string progressCpuset;
+
+        /**
+         * @var CPU set for the listener/communication thread, same format
+         *      as progressCpuset. Empty leaves the thread unpinned.
+         */
+        std::string listenerCpuset;
+
+        /**
+         * @var CPU set for the telemetry writer thread, same format as
+         *      progressCpuset. Empty leaves the thread unpinned.
+         */
+        std::string telemetryCpuset;
+
+        /**
+         * @var SO_SNDBUF size in bytes for the metadata/notification
+         *      sockets, 0 to keep the kernel default. Larger buffers help
+         *      cross-datacenter metadata fetches that crawl at default
+         *      TCP windows.
+         */
+        int sockSndBuf;
+
+        /**
+         * @var SO_RCVBUF size in bytes for the metadata/notification
+         *      sockets, 0 to keep the kernel default.
+         */
+        int sockRcvBuf;
+
+        /**
+         * @var Disable Nagle's algorithm (TCP_NODELAY) on the
+         *      metadata/notification sockets. Enabled by default, since
+         *      Nagle can add tens of milliseconds to the small
+         *      notification messages exchanged over this channel.
+         */
+        bool sockNoDelay;
+
+        /**
+         * @var Enable SO_KEEPALIVE on the metadata/notification sockets,
+         *      so half-dead cross-datacenter peers are detected and
+         *      dropped instead of holding a stale connection.
+         */
+        bool sockKeepAlive;
+
+        /**
+         * @var Size in bytes of the agent-level pinned staging pool, 0
+         *      to disable. The slab is allocated, pre-faulted and locked
+         *      at agent construction and registered with every backend
+         *      at createBackend time; internal staging consumers (bounce
+         *      buffers, unaligned-IO staging) draw from it instead of
+         *      allocating pinned memory at first use, moving those
+         *      stalls to startup.
+         */
+        size_t stagingPoolBytes;
+
+        /**
+         * @var Run the metadata/communication channel without its own
+         *      thread: no listener thread is spawned, socket and etcd
+         *      progress happens inside user calls to
+         *      nixlAgent::progressControlPlane, and readiness is exposed
+         *      as a pollable fd through nixlAgent::getControlPlaneFd, so
+         *      runtimes owning all threads keep stray wakeups off
+         *      isolated cores.
+         */
+        bool userDrivenComm;
+
         /**
          * @brief  Agent configuration constructor for enabling various features.
          * @param use_prog_thread    flag to determine use of progress thread
@@ -72,6 +176,21 @@ class nixlAgentConfig {
          * @param lthr_delay_us      Optional delay for listener thread in us
          * @param capture_telemetry  Optional flag to enable telemetry capture
          * @param etcd_watch_timeout Optional timeout for etcd watch operations in microseconds
+         * @param prog_executor_threads Optional size of the shared progress executor pool
+         * @param arena_huge_pages   Optional flag to back internal buffers with huge pages
+         * @param arena_numa_node    Optional NUMA node for internal buffers, -1 for default
+         * @param deferred_dereg     Optional flag to defer backend deregistration to the
+         *                           shared progress executor
+         * @param progress_cpuset    Optional CPU set for progress threads, empty for unpinned
+         * @param listener_cpuset    Optional CPU set for the listener thread, empty for unpinned
+         * @param telemetry_cpuset   Optional CPU set for the telemetry thread, empty for unpinned
+         * @param sock_snd_buf       Optional SO_SNDBUF for comm sockets, 0 for kernel default
+         * @param sock_rcv_buf       Optional SO_RCVBUF for comm sockets, 0 for kernel default
+         * @param sock_no_delay      Optional flag to disable Nagle on comm sockets
+         * @param sock_keep_alive    Optional flag to enable TCP keepalive on comm sockets
+         * @param staging_pool_bytes Optional size of the pinned staging pool, 0 to disable
+         * @param user_driven_comm   Optional flag to progress the communication channel from
+         *                           user calls instead of a dedicated thread
          */
         nixlAgentConfig(const bool use_prog_thread,
                         const bool use_listen_thread = false,
@@ -82,7 +201,20 @@ class nixlAgentConfig {
                         const uint64_t lthr_delay_us = 100000,
                         const bool capture_telemetry = false,
                         const std::chrono::microseconds &etcd_watch_timeout =
-                            std::chrono::microseconds(5000000))
+                            std::chrono::microseconds(5000000),
+                        const uint32_t prog_executor_threads = 0,
+                        const bool arena_huge_pages = false,
+                        const int arena_numa_node = -1,
+                        const bool deferred_dereg = false,
+                        const std::string &progress_cpuset = "",
+                        const std::string &listener_cpuset = "",
+                        const std::string &telemetry_cpuset = "",
+                        const int sock_snd_buf = 0,
+                        const int sock_rcv_buf = 0,
+                        const bool sock_no_delay = true,
+                        const bool sock_keep_alive = false,
+                        const size_t staging_pool_bytes = 0,
+                        const bool user_driven_comm = false)
             : useProgThread(use_prog_thread),
               useListenThread(use_listen_thread),
               listenPort(port),
@@ -90,7 +222,20 @@ class nixlAgentConfig {
               captureTelemetry(capture_telemetry),
               pthrDelay(pthr_delay_us),
               lthrDelay(lthr_delay_us),
-              etcdWatchTimeout(etcd_watch_timeout) {}
+              etcdWatchTimeout(etcd_watch_timeout),
+              progExecutorThreads(prog_executor_threads),
+              arenaHugePages(arena_huge_pages),
+              arenaNumaNode(arena_numa_node),
+              deferredDereg(deferred_dereg),
+              progressCpuset(progress_cpuset),
+              listenerCpuset(listener_cpuset),
+              telemetryCpuset(telemetry_cpuset),
+              sockSndBuf(sock_snd_buf),
+              sockRcvBuf(sock_rcv_buf),
+              sockNoDelay(sock_no_delay),
+              sockKeepAlive(sock_keep_alive),
+              stagingPoolBytes(staging_pool_bytes),
+              userDrivenComm(user_driven_comm) {}
 
         /**
          * @brief Copy constructor for nixlAgentConfig object
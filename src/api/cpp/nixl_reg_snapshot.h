@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_REG_SNAPSHOT_H
+#define _NIXL_REG_SNAPSHOT_H
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "nixl_types.h"
+#include "nixl_descriptors.h"
+
+/**
+ * @class nixlRegSnapshot
+ * @brief Immutable snapshot of the agent's registered local memory, obtained
+ *        through nixlAgent::getRegSnapshot. The agent publishes a fresh
+ *        snapshot copy-on-write whenever registrations change, so queries
+ *        against a snapshot never take the agent lock and never contend
+ *        with the transfer path. A snapshot stays valid and self-consistent
+ *        for as long as the caller holds it, but reflects the registrations
+ *        of its publication time; the version stamp is monotonic, so two
+ *        snapshots with the same version are identical.
+ */
+class nixlRegSnapshot {
+    public:
+        /**
+         * @brief Monotonic publication version, bumped on every
+         *        registration change
+         */
+        uint64_t getVersion() const { return version; }
+
+        /**
+         * @brief  Whether `query` of memory type `mem` is fully covered by a
+         *         single registered region of at least one backend
+         *
+         * @param  mem   Memory type of the queried range
+         * @param  query Queried range; devId must match the registration
+         * @return bool  True if some backend's registration covers the range
+         */
+        bool isRegistered(const nixl_mem_t &mem, const nixlBasicDesc &query) const;
+
+        /**
+         * @brief  Names of the backends whose registration fully covers
+         *         `query` of memory type `mem`
+         *
+         * @param  mem            Memory type of the queried range
+         * @param  query          Queried range; devId must match the registration
+         * @param  backends [out] Backend names covering the range; cleared first
+         * @return nixl_status_t  NIXL_ERR_NOT_FOUND when no backend covers the
+         *                        range, NIXL_SUCCESS otherwise
+         */
+        nixl_status_t queryBackends(const nixl_mem_t &mem,
+                                    const nixlBasicDesc &query,
+                                    std::vector<nixl_backend_t> &backends) const;
+
+    private:
+        friend class nixlLocalSection; // Built by nixlLocalSection::makeSnapshot
+
+        // Sorted ranges of one (memory type, backend) section, with the same
+        // prefix-maximum interval index the live section keeps, so covering
+        // queries stay logarithmic with nested or overlapping registrations
+        struct snapshotRanges {
+            std::vector<nixlBasicDesc> descs;
+            std::vector<uintptr_t>     maxEnd;
+
+            bool covers(const nixlBasicDesc &query) const;
+        };
+
+        std::map<std::pair<nixl_mem_t, nixl_backend_t>, snapshotRanges> sections;
+        uint64_t version = 0;
+};
+
+/**
+ * @brief Shared pointer to an immutable registration snapshot
+ */
+using nixl_reg_snapshot_ptr_t = std::shared_ptr<const nixlRegSnapshot>;
+
+#endif
@@ -16,10 +16,13 @@
  */
 #ifndef _NIXL_TYPES_H
 #define _NIXL_TYPES_H
+#include <array>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <optional>
+#include <functional>
 #include <chrono>
 
 
@@ -28,6 +31,8 @@ class nixlSerDes;
 class nixlDlistH;
 class nixlBackendH;
 class nixlXferReqH;
+class nixlMDLoadH;
+class nixlNotifQueueH;
 class nixlAgentData;
 
 
@@ -122,6 +127,14 @@ using nixl_b_params_t = std::unordered_map<std::string, std::string>;
  */
 using nixl_notifs_t = std::unordered_map<std::string, std::vector<nixl_blob_t>>;
 
+/**
+ * @brief A typedef for a std::unordered_map<std::string_view, std::vector<std::string_view>>
+ *        to hold nixl_notifs_view_t, the zero-copy counterpart of nixl_notifs_t.
+ *        The views point into an agent-owned buffer and are only valid until
+ *        the next call that refills them (see nixlAgent::getNotifsView).
+ */
+using nixl_notifs_view_t = std::unordered_map<std::string_view, std::vector<std::string_view>>;
+
 /**
  * @brief A constant to define the default communication port.
  */
@@ -146,6 +159,18 @@ extern const std::string default_partial_metadata_label;
  */
 enum class nixl_cost_t {
     ANALYTICAL_BACKEND = 0, // Analytical backend cost estimate
+    MEASURED_AGENT = 1, // Measured from this agent's completed transfers
+};
+
+/**
+ * @enum nixl_xfer_priority_t
+ * @brief An enumeration of priority classes for transfer requests.
+ *        Lower values are more urgent.
+ */
+enum class nixl_xfer_priority_t {
+    NIXL_XFER_PRIO_HIGH = 0,
+    NIXL_XFER_PRIO_NORMAL = 1,
+    NIXL_XFER_PRIO_LOW = 2,
 };
 
 /**
@@ -214,6 +239,185 @@ struct nixlAgentOptionalArgs {
      */
     std::string metadataLabel;
 
+    /**
+     * @var completionCallback Optional callback invoked with the final status once a
+     *                         posted transfer request leaves NIXL_IN_PROG, instead of
+     *                         polling getXferStatus. It is invoked from an internal
+     *                         agent thread, or inline from the posting call if the
+     *                         transfer completes within the post. The request handle
+     *                         must not be released before the completion is delivered.
+     *                         Used in postXferReq / postXferReqBatch.
+     */
+    std::function<void(nixl_status_t)> completionCallback;
+
+    /**
+     * @var completionEventFd Optional eventfd(2) file descriptor that is signaled when
+     *                        a posted transfer request leaves NIXL_IN_PROG, so many
+     *                        outstanding transfers can be awaited through epoll with
+     *                        zero polling CPU. Set to a valid descriptor to enable;
+     *                        ownership of the descriptor stays with the caller.
+     *                        Used in postXferReq / postXferReqBatch.
+     */
+    int completionEventFd = -1;
+
+    /**
+     * @var priority Priority class of the transfer. Posts of a lower class are
+     *      deferred by the agent while transfers of a strictly higher class
+     *      are in flight, and dispatched once the higher classes drain; such
+     *      deferred posts return NIXL_IN_PROG like any other posted transfer.
+     *      Used in postXferReq / postXferReqBatch.
+     */
+    nixl_xfer_priority_t priority = nixl_xfer_priority_t::NIXL_XFER_PRIO_NORMAL;
+
+    /**
+     * @var deadline Optional deadline hint for a deferred transfer, relative
+     *      to the post time. A deferred request whose deadline has passed is
+     *      dispatched regardless of higher-priority traffic, bounding how
+     *      long a low class can starve. Zero (default) means no deadline.
+     *      Used in postXferReq / postXferReqBatch.
+     */
+    std::chrono::microseconds deadline = std::chrono::microseconds(0);
+
+    /**
+     * @var progressBudget Optional time budget for one polling call, bounding
+     *      the worst-case latency of the polling path. Once the budget is
+     *      spent, getXferStatus stops polling further rails/chunks of a
+     *      striped or auto-chunked request, and getNotifs/getNotifsView stop
+     *      draining further backends; the skipped work is picked up by the
+     *      next call. An individual backend progress call is never
+     *      interrupted, so the effective bound is the budget plus one backend
+     *      call. Zero (default) means no budget.
+     *      Used in getXferStatus / getNotifs / getNotifsView.
+     */
+    std::chrono::microseconds progressBudget = std::chrono::microseconds(0);
+
+    /**
+     * @var notifTimeout Optional wait bound for getNotifs. With a timeout
+     *      set, a call that finds no notifications does not return empty:
+     *      it keeps re-draining the backends, spinning hot for the first
+     *      few tens of microseconds (poll-level latency under load) and
+     *      then easing into a sleeping backoff (near-zero CPU when idle),
+     *      until a notification arrives or the timeout expires. The agent
+     *      lock is dropped between passes, so other threads' API calls
+     *      proceed while a consumer waits. Zero (default) keeps the
+     *      non-blocking single-pass behavior.
+     *      Used in getNotifs.
+     */
+    std::chrono::microseconds notifTimeout = std::chrono::microseconds(0);
+
+    /**
+     * @var enableStriping boolean to allow a large transfer to be striped across
+     *      several loaded backends (e.g. one NIC per backend), when more than one
+     *      backend has the required registrations on both sides. The descriptor
+     *      list is partitioned by bytes and completion is aggregated across the
+     *      rails; notification, if requested, is sent after all rails complete.
+     *      Used in createXferReq.
+     */
+    bool enableStriping = false;
+
+    /**
+     * @var enableIntegrity boolean to checksum the source descriptors with
+     *      CRC32C during posting and have the target verify the written
+     *      data on its notification path, catching silent wire corruption.
+     *      Requires a notification (which carries the checksum), a WRITE
+     *      operation, and DRAM segments on both sides.
+     *      Used in postXferReq / postXferReqBatch.
+     */
+    bool enableIntegrity = false;
+
+    /**
+     * @var enableInlineData boolean to let small WRITE transfers skip the
+     *      RDMA entirely: the source payload rides inside the notification
+     *      message and the target copies it into the destination
+     *      descriptors on its notification path, halving the latency of
+     *      transfer-then-notify patterns. Requires a notification and DRAM
+     *      segments on both sides; transfers above the inline threshold
+     *      fall back to the regular data path.
+     *      Used in postXferReq / postXferReqBatch.
+     */
+    bool enableInlineData = false;
+
+    /**
+     * @var dependsOn optional predecessor transfer request handle. The post
+     *      is accepted in a suspended state and dispatched automatically
+     *      once the predecessor leaves NIXL_IN_PROG, from the agent's
+     *      progress context, removing the host-side wait between dependent
+     *      transfers. The predecessor handle must remain valid (not
+     *      released) until the suspended request has been dispatched. If
+     *      the predecessor finishes with an error or is canceled, the
+     *      suspended request fails with NIXL_ERR_NOT_POSTED instead of
+     *      being dispatched.
+     *      Used in postXferReq / postXferReqBatch.
+     */
+    nixlXferReqH* dependsOn = nullptr;
+
+    /**
+     * @var orderedChannel optional FIFO channel id towards the remote agent,
+     *      or -1 (default) for unordered posts. Transfers posted to the same
+     *      (peer, channel id) complete visibly in order: each post is chained
+     *      behind the channel's previous request through the dependency
+     *      machinery, so a notification for transfer N implies transfers
+     *      1..N on that channel are visible, without application-level
+     *      flushes. The previous request's handle must remain valid (not
+     *      released) until its successor has been dispatched, and if it
+     *      fails or is canceled the successor fails with
+     *      NIXL_ERR_NOT_POSTED. Cannot be combined with dependsOn.
+     *      Used in postXferReq / postXferReqBatch.
+     */
+    int orderedChannel = -1;
+
+    /**
+     * @var relayAgent optional intermediate agent for relayed (multi-hop)
+     *      transfers in createXferReq, for targets the initiator cannot
+     *      reach directly. The data is pipelined through a registered DRAM
+     *      staging area on the named agent in chunks, double buffered so
+     *      writing one chunk to staging overlaps the relay forwarding the
+     *      previous one, instead of store-and-forward of whole buffers.
+     *      Requires a WRITE operation, the relay's metadata loaded locally,
+     *      the final target's metadata loaded on the relay, and both the
+     *      initiator and the relay polling getNotifs, which carries the
+     *      flow control. A notification, if requested, is delivered to the
+     *      final target by the relay after the last chunk.
+     */
+    std::string relayAgent;
+
+    /**
+     * @var asyncNotif boolean making genNotif stage the notification in a
+     *      per-thread ring instead of sending it inline, so the calling
+     *      thread never contends on the agent lock or backend connection
+     *      state. The agent's progress executor flushes the rings, in
+     *      staging order per thread. Requires a progress executor
+     *      (prog_executor_threads > 0); without one, or when the ring is
+     *      full, the notification is sent inline as usual. Send errors can
+     *      no longer be returned to the caller and are logged and counted
+     *      in error telemetry instead. No ordering is guaranteed relative
+     *      to notifications attached to posted transfers.
+     *      Used in genNotif.
+     */
+    bool asyncNotif = false;
+
+    /**
+     * @var trafficClass optional traffic class name handed to the backend
+     *      with the post. Backends with QoS support map it to a resource
+     *      subset; the libfabric backend restricts the transfer to the data
+     *      rails configured for the class through its "rail_classes" init
+     *      parameter, keeping e.g. checkpoint writes off rails shared with
+     *      collectives. An unknown class falls back to all selected rails.
+     *      Used in postXferReq / postXferReqBatch / createXferReq.
+     */
+    std::string trafficClass;
+
+    /**
+     * @var traceCtx optional trace context, up to 16 binary bytes (e.g. a
+     *      W3C trace-id/span-id pair), carried alongside the transfer's
+     *      notification through backends that support it and recorded in
+     *      the telemetry of both agents, so a source-side post can be
+     *      correlated with the target-side notification in an external
+     *      tracing system. Requires hasNotif. Empty disables tracing.
+     *      Used in createXferReq / makeXferReq / postXferReq / postXferReqBatch.
+     */
+    nixl_blob_t traceCtx;
+
     /**
      * @var Backend custom parameter
      */
@@ -225,6 +429,95 @@ struct nixlAgentOptionalArgs {
  */
 using nixl_opt_args_t = nixlAgentOptionalArgs;
 
+/**
+ * @brief Context describing a transfer, handed to a routing policy callback
+ *        during backend selection.
+ */
+struct nixlXferPolicyCtx {
+    /** @var Transfer operation */
+    nixl_xfer_op_t op;
+    /** @var Total bytes across the descriptor list */
+    size_t totalBytes;
+    /** @var Number of descriptors in the list */
+    int descCount;
+    /** @var Local side memory type */
+    nixl_mem_t localMemType;
+    /** @var Remote side memory type */
+    nixl_mem_t remoteMemType;
+    /** @var Name of the remote (or self) agent */
+    std::string remoteAgent;
+};
+
+/**
+ * @brief Routing policy callback, registered through nixlAgent::setXferPolicy.
+ *        Given a transfer's shape it returns backend type names in preference
+ *        order; the first named backend that holds the required registrations
+ *        on both sides is selected. Names that don't match a usable backend
+ *        are skipped, and an empty ranking (or no usable ranked backend)
+ *        falls back to the agent's built-in selection.
+ */
+using nixl_xfer_policy_cb_t =
+    std::function<std::vector<nixl_backend_t>(const nixlXferPolicyCtx &ctx)>;
+
+/**
+ * @brief Partial-completion snapshot of a transfer, returned by
+ *        nixlAgent::getXferProgress. Striped and auto-chunked requests
+ *        partition the descriptor list contiguously in order across their
+ *        chunks, so the watermark marks a prefix of the transfer that is
+ *        fully complete and safe to consume.
+ */
+struct nixlXferProgress {
+    /** @var Total bytes of the transfer */
+    size_t totalBytes = 0;
+    /** @var Bytes of the chunks that have completed */
+    size_t completedBytes = 0;
+    /** @var Leading contiguous completed bytes, in descriptor-list order */
+    size_t watermarkBytes = 0;
+    /** @var Per-chunk completion flags, in descriptor-list order */
+    std::vector<bool> chunkDone;
+};
+
+/**
+ * @brief A typedef for the nixlXferProgress snapshot
+ */
+using nixl_xfer_progress_t = nixlXferProgress;
+
+/**
+ * @brief Snapshot of a backend's live load, returned by
+ *        nixlAgent::getBackendLoad. Gives schedulers a direct
+ *        backpressure signal: queue depth is posted minus completed, and
+ *        the completion EWMA reflects how fast the backend is draining.
+ */
+struct nixlBackendLoad {
+    /** @var Transfers accepted by the backend so far */
+    uint64_t postedXfers = 0;
+    /** @var Transfers that have finished (including failed ones) */
+    uint64_t completedXfers = 0;
+    /** @var Transfers currently in flight */
+    uint64_t inFlightXfers = 0;
+    /** @var Bytes of the in-flight transfers */
+    uint64_t inFlightBytes = 0;
+    /** @var Exponentially weighted average of post-to-completion time in microseconds */
+    uint64_t avgCompletionUs = 0;
+};
+
+/**
+ * @brief Capacity and watermark configuration of one memory tier, set
+ *        through nixlAgent::configureTier. Watermarks are fractions of
+ *        the capacity: once the registered bytes of the tier's memory
+ *        type cross the high watermark, blocks designated through
+ *        nixlAgent::designateEvictable are migrated out in the background
+ *        until estimated occupancy falls below the low watermark.
+ */
+struct nixlTierConfig {
+    /** @var Capacity of the tier in bytes */
+    size_t capacityBytes = 0;
+    /** @var Occupancy fraction that triggers background eviction */
+    float highWatermark = 0.9;
+    /** @var Occupancy fraction eviction drives down to */
+    float lowWatermark = 0.7;
+};
+
 /**
  * @brief A typedef for a nixlGpuXferReqH
  */
@@ -240,6 +533,45 @@ using chrono_point_t = std::chrono::steady_clock::time_point;
  */
 using chrono_period_us_t = std::chrono::microseconds;
 
+/**
+ * @brief Stages of a non-blocking agent initialization started through
+ *        nixlAgent::constructNonBlocking. The comm stage covers the
+ *        metadata listener and communication thread setup, plugins covers
+ *        plugin discovery, and backends covers backend engine creation,
+ *        including any device or topology probing the plugins perform
+ *        internally during their init.
+ */
+typedef enum {
+    NIXL_INIT_STAGE_COMM = 0,
+    NIXL_INIT_STAGE_PLUGINS,
+    NIXL_INIT_STAGE_BACKENDS,
+    NIXL_INIT_STAGE_MAX
+} nixl_init_stage_t;
+
+/**
+ * @brief Per-stage progress of a non-blocking agent initialization,
+ *        filled by nixlAgent::checkInit. Stage durations are also
+ *        exported through telemetry as agent_init_<stage>_time events
+ *        for startup cost attribution.
+ */
+struct nixlInitReport {
+    struct stageState {
+        /** @var Whether the stage has finished, successfully or not */
+        bool done = false;
+        /** @var Stage result; NIXL_IN_PROG until the stage is done */
+        nixl_status_t status = NIXL_IN_PROG;
+        /** @var Stage wall time, valid once the stage is done */
+        chrono_period_us_t duration = chrono_period_us_t(0);
+    };
+    /** @var One entry per nixl_init_stage_t value */
+    std::array<stageState, NIXL_INIT_STAGE_MAX> stages;
+};
+
+/**
+ * @brief A typedef for a nixlInitReport
+ */
+using nixl_init_report_t = nixlInitReport;
+
 /**
  * @struct nixlXferTelemetry
  * @brief A structure for telemetry output from agent API
@@ -261,6 +593,26 @@ struct nixlXferTelemetry {
      */
     chrono_period_us_t xferDuration;
 
+    /**
+     * @var submitTime Time the backend post call returned, separating the
+     *      agent-side queueing/post overhead from wire time
+     */
+    chrono_point_t submitTime;
+
+    /**
+     * @var firstCompleteTime Time the first completion was observed; for a
+     *      striped transfer this is the first rail to finish, otherwise it
+     *      equals lastCompleteTime
+     */
+    chrono_point_t firstCompleteTime;
+
+    /**
+     * @var lastCompleteTime Time the whole transfer was observed complete.
+     *      Completions are observed on getXferStatus/checkXferReq calls, so
+     *      polling late inflates these the same way as xferDuration
+     */
+    chrono_point_t lastCompleteTime;
+
     /**
      * @var totalBytes Amount of bytes transferred in the request
      */
@@ -282,4 +282,354 @@ nixlGpuWriteSignal(void *signal, uint64_t value) {
     ucp_device_counter_write<static_cast<ucs_device_level_t>(level)>(signal, value);
 }
 
+/**
+ * @brief Device-side pool of prepared GPU signals.
+ *
+ * The pool carves one registered slab, prepared once with the host function
+ * @ref nixlAgent::prepGpuSignal, into fixed-size signal slots that device
+ * code can allocate and recycle without further host involvement. Free slots
+ * are kept on a lock-free stack of slot indices; @a free_indices must point
+ * to @a capacity uint32_t entries in device-accessible memory.
+ *
+ * Initialize with @ref nixlGpuSignalPoolInit before first use.
+ */
+struct nixlGpuSignalPool {
+    /** First signal slot of the prepared slab */
+    void *base;
+    /** Slot stride, from @ref nixlAgent::getGpuSignalSize */
+    size_t signal_size;
+    /** Number of slots in the slab */
+    uint32_t capacity;
+    /** Number of free slots currently on the stack */
+    uint32_t top;
+    /** Stack storage, @a capacity entries */
+    uint32_t *free_indices;
+};
+
+/** Marks a stack entry whose index has been claimed but not yet republished */
+#define NIXL_GPU_SIGNAL_POOL_EMPTY 0xffffffffu
+
+/**
+ * @brief Initialize a signal pool over a prepared slab.
+ *
+ * Must be called from a single thread, and the initialization must be made
+ * visible (e.g. via a kernel boundary or grid synchronization) before other
+ * threads allocate from the pool.
+ *
+ * @param pool         [out] Pool to initialize.
+ * @param base         [in]  First signal slot of the slab prepared with
+ *                           @ref nixlAgent::prepGpuSignal.
+ * @param signal_size  [in]  Slot stride, from @ref nixlAgent::getGpuSignalSize.
+ * @param capacity     [in]  Number of slots in the slab.
+ * @param free_indices [in]  Device memory for the free stack, capacity entries.
+ */
+__device__ inline void
+nixlGpuSignalPoolInit(nixlGpuSignalPool *pool,
+                      void *base,
+                      size_t signal_size,
+                      uint32_t capacity,
+                      uint32_t *free_indices) {
+    pool->base = base;
+    pool->signal_size = signal_size;
+    pool->capacity = capacity;
+    pool->top = capacity;
+    pool->free_indices = free_indices;
+    for (uint32_t i = 0; i < capacity; i++) {
+        free_indices[i] = i;
+    }
+    __threadfence();
+}
+
+/**
+ * @brief Allocate one signal slot from the pool.
+ *
+ * Safe to call concurrently with @ref nixlGpuSignalPoolFree: a claimed stack
+ * entry is marked empty until the recycler republishes it, so a slot is never
+ * handed out twice.
+ *
+ * @param pool [in] Pool to allocate from.
+ *
+ * @return Address of a prepared signal, or nullptr when the pool is exhausted.
+ */
+__device__ inline void *
+nixlGpuSignalPoolAlloc(nixlGpuSignalPool *pool) {
+    int pos = static_cast<int>(atomicSub(&pool->top, 1)) - 1;
+    if (pos < 0) {
+        atomicAdd(&pool->top, 1);
+        return nullptr;
+    }
+
+    uint32_t idx;
+    do {
+        idx = atomicExch(&pool->free_indices[pos], NIXL_GPU_SIGNAL_POOL_EMPTY);
+    } while (idx == NIXL_GPU_SIGNAL_POOL_EMPTY);
+
+    return static_cast<char *>(pool->base) + static_cast<size_t>(idx) * pool->signal_size;
+}
+
+/**
+ * @brief Recycle a signal slot back into the pool.
+ *
+ * The signal counter is reset to zero before the slot is republished, so the
+ * next owner starts from a clean signal without another host-side prepare.
+ *
+ * @param pool   [in] Pool the slot was allocated from.
+ * @param signal [in] Address returned by @ref nixlGpuSignalPoolAlloc.
+ */
+template<nixl_gpu_level_t level = nixl_gpu_level_t::THREAD>
+__device__ void
+nixlGpuSignalPoolFree(nixlGpuSignalPool *pool, void *signal) {
+    uint32_t idx = static_cast<uint32_t>(
+        (static_cast<char *>(signal) - static_cast<char *>(pool->base)) / pool->signal_size);
+
+    nixlGpuWriteSignal<level>(signal, 0);
+    __threadfence();
+
+    uint32_t pos = atomicAdd(&pool->top, 1);
+    while (atomicCAS(&pool->free_indices[pos], NIXL_GPU_SIGNAL_POOL_EMPTY, idx) !=
+           NIXL_GPU_SIGNAL_POOL_EMPTY) {
+    }
+}
+
+/**
+ * @brief Read a batch of signals in one call.
+ *
+ * @param count   [in]  Number of signals.
+ * @param signals [in]  Addresses of the signals.
+ * @param values  [out] Current value of each signal.
+ */
+template<nixl_gpu_level_t level = nixl_gpu_level_t::THREAD>
+__device__ void
+nixlGpuReadSignals(size_t count, const void *const *signals, uint64_t *values) {
+    for (size_t i = 0; i < count; i++) {
+        values[i] = nixlGpuReadSignal<level>(signals[i]);
+    }
+}
+
+/**
+ * @brief Count how many signals of a batch have reached a threshold.
+ *
+ * Single readiness query over many lightweight completion flags, instead of
+ * one @ref nixlGpuReadSignal call site per flag.
+ *
+ * @param count     [in] Number of signals.
+ * @param signals   [in] Addresses of the signals.
+ * @param threshold [in] A signal is ready when its value is >= threshold.
+ *
+ * @return Number of ready signals.
+ */
+template<nixl_gpu_level_t level = nixl_gpu_level_t::THREAD>
+__device__ size_t
+nixlGpuCountSignalsReady(size_t count, const void *const *signals, uint64_t threshold) {
+    size_t ready = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (nixlGpuReadSignal<level>(signals[i]) >= threshold) {
+            ready++;
+        }
+    }
+    return ready;
+}
+
+/**
+ * @brief GPU-resident transfer descriptor table, writable from kernels.
+ *
+ * Device code composes transfers by appending entries (descriptor index of
+ * the prepared request plus offsets and size) into the table, then fires
+ * the whole batch with @ref nixlGpuPostXferTableReq — no host round trip
+ * between picking blocks and posting. The storage is four plain
+ * device-memory arrays of @a capacity entries each, so the format is
+ * transport-agnostic; the UCX device path consumes it directly as the
+ * argument arrays of the multi-partial post.
+ *
+ * Appends are not validated; entries are checked lazily, at post time,
+ * against the descriptor count of the prepared request.
+ *
+ * Initialize with @ref nixlGpuXferTableInit before first use.
+ */
+struct nixlGpuXferTable {
+    /** Number of entries the arrays below can hold */
+    uint32_t capacity;
+    /** Number of appended entries; grows atomically */
+    uint32_t count;
+    /** Lazy-validation cursor: entries below it have already been checked */
+    uint32_t validated;
+    /** Per-entry descriptor index in the prepared request */
+    unsigned *desc_indices;
+    /** Per-entry transfer size in bytes */
+    size_t *sizes;
+    /** Per-entry offset within the local descriptor */
+    size_t *local_offsets;
+    /** Per-entry offset within the remote descriptor */
+    size_t *remote_offsets;
+};
+
+/**
+ * @brief Initialize a transfer descriptor table over device arrays.
+ *
+ * Must be called from a single thread, and the initialization must be made
+ * visible (e.g. via a kernel boundary or grid synchronization) before other
+ * threads append to the table.
+ *
+ * @param table          [out] Table to initialize.
+ * @param capacity       [in]  Number of entries in each array.
+ * @param desc_indices   [in]  Device memory for descriptor indices, capacity entries.
+ * @param sizes          [in]  Device memory for sizes, capacity entries.
+ * @param local_offsets  [in]  Device memory for local offsets, capacity entries.
+ * @param remote_offsets [in]  Device memory for remote offsets, capacity entries.
+ */
+__device__ inline void
+nixlGpuXferTableInit(nixlGpuXferTable *table,
+                     uint32_t capacity,
+                     unsigned *desc_indices,
+                     size_t *sizes,
+                     size_t *local_offsets,
+                     size_t *remote_offsets) {
+    table->capacity = capacity;
+    table->count = 0;
+    table->validated = 0;
+    table->desc_indices = desc_indices;
+    table->sizes = sizes;
+    table->local_offsets = local_offsets;
+    table->remote_offsets = remote_offsets;
+    __threadfence();
+}
+
+/**
+ * @brief Append one transfer entry to the table.
+ *
+ * Safe to call concurrently from any number of threads; each caller claims
+ * a distinct slot. The entry is not validated here, see
+ * @ref nixlGpuXferTableValidate.
+ *
+ * @param table         [in] Table to append to.
+ * @param desc_index    [in] Index of the memory descriptor in the prepared request.
+ * @param local_offset  [in] Offset within the local descriptor.
+ * @param remote_offset [in] Offset within the remote descriptor.
+ * @param size          [in] Size in bytes to transfer.
+ *
+ * @return true when the entry was appended, false when the table is full.
+ */
+__device__ inline bool
+nixlGpuXferTableAppend(nixlGpuXferTable *table,
+                       unsigned desc_index,
+                       size_t local_offset,
+                       size_t remote_offset,
+                       size_t size) {
+    uint32_t slot = atomicAdd(&table->count, 1);
+    if (slot >= table->capacity) {
+        atomicSub(&table->count, 1);
+        return false;
+    }
+
+    table->desc_indices[slot] = desc_index;
+    table->sizes[slot] = size;
+    table->local_offsets[slot] = local_offset;
+    table->remote_offsets[slot] = remote_offset;
+    __threadfence();
+    return true;
+}
+
+/**
+ * @brief Validate the entries appended since the last validation.
+ *
+ * Checks that every new entry names a descriptor of the prepared request
+ * and has a non-zero size. Entries already validated by a previous call are
+ * skipped, so interleaving appends and posts stays linear overall. All
+ * appends must be visible to the calling thread (same thread, or after a
+ * synchronization point).
+ *
+ * @param table     [in] Table to validate.
+ * @param num_descs [in] Descriptor count of the prepared request.
+ *
+ * @return NIXL_SUCCESS           All entries are valid.
+ * @return NIXL_ERR_INVALID_PARAM An entry is out of range; the table is
+ *                                left with @a validated at the offender.
+ */
+__device__ inline nixl_status_t
+nixlGpuXferTableValidate(nixlGpuXferTable *table, unsigned num_descs) {
+    const uint32_t count = table->count < table->capacity ? table->count : table->capacity;
+    for (uint32_t i = table->validated; i < count; i++) {
+        if ((table->desc_indices[i] >= num_descs) || (table->sizes[i] == 0)) {
+            table->validated = i;
+            return NIXL_ERR_INVALID_PARAM;
+        }
+    }
+    table->validated = count;
+    return NIXL_SUCCESS;
+}
+
+/**
+ * @brief Reset the table for reuse.
+ *
+ * Must be called from a single thread with no appends in flight.
+ *
+ * @param table [in] Table to reset.
+ */
+__device__ inline void
+nixlGpuXferTableReset(nixlGpuXferTable *table) {
+    table->count = 0;
+    table->validated = 0;
+    __threadfence();
+}
+
+/**
+ * @brief Post all entries of a transfer descriptor table.
+ *
+ * Lazily validates the table against the prepared request, then posts the
+ * batch through the partial-write path with an optional trailing signal.
+ * The table must not be appended to or reset until the post call returns;
+ * afterwards the entries may be recycled with @ref nixlGpuXferTableReset.
+ *
+ * @param req_hndl          [in]  Request handle the table entries index into.
+ * @param table             [in]  Table of transfer entries.
+ * @param num_descs         [in]  Descriptor count of the prepared request,
+ *                                used for lazy validation.
+ * @param signal_desc_index [in]  Index of the signal descriptor to be sent.
+ * @param signal_inc        [in]  Increment value for the signal. The signal will
+ *                                only be posted if signal_inc != 0.
+ * @param signal_offset     [in]  Offset of the signal to be sent.
+ * @param channel_id        [in]  Channel ID to use for the transfer.
+ * @param is_no_delay       [in]  Whether to use no-delay mode.
+ * @param xfer_status       [out] Status of the transfer. If not null, use @ref
+ *                                nixlGpuGetXferStatus to check for completion.
+ *
+ * @return NIXL_SUCCESS           The table is empty, nothing was posted.
+ * @return NIXL_IN_PROG           Transfer posted successfully.
+ * @return NIXL_ERR_INVALID_PARAM A table entry failed validation.
+ * @return NIXL_ERR_BACKEND       An error occurred in UCX backend.
+ */
+template<nixl_gpu_level_t level = nixl_gpu_level_t::THREAD>
+__device__ nixl_status_t
+nixlGpuPostXferTableReq(nixlGpuXferReqH req_hndl,
+                        nixlGpuXferTable *table,
+                        unsigned num_descs,
+                        unsigned signal_desc_index,
+                        uint64_t signal_inc,
+                        size_t signal_offset,
+                        unsigned channel_id = 0,
+                        bool is_no_delay = true,
+                        nixlGpuXferStatusH *xfer_status = nullptr) {
+    const nixl_status_t valid = nixlGpuXferTableValidate(table, num_descs);
+    if (valid != NIXL_SUCCESS) {
+        return valid;
+    }
+
+    if (table->count == 0) {
+        return NIXL_SUCCESS;
+    }
+
+    return nixlGpuPostPartialWriteXferReq<level>(req_hndl,
+                                                 table->count,
+                                                 table->desc_indices,
+                                                 table->sizes,
+                                                 table->local_offsets,
+                                                 table->remote_offsets,
+                                                 signal_desc_index,
+                                                 signal_inc,
+                                                 signal_offset,
+                                                 channel_id,
+                                                 is_no_delay,
+                                                 xfer_status);
+}
+
 #endif // _NIXL_DEVICE_CUH
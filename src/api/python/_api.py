@@ -602,6 +602,33 @@ class nixl_agent:
         else:
             return "ERR"
 
+    """
+    @brief Post a batch of transfer operations with a single call into the bindings.
+           The whole batch crosses the Python boundary once and the GIL is released
+           while the requests are posted, so schedulers submitting many transfers
+           per step avoid the per-request call and GIL overhead.
+
+    @param handles List of transfer handles, from make_prepped_xfer, or initialize_xfer.
+    @param notif_msgs Optional list of per-transfer notification messages; either empty,
+           or of the same length as handles (use b"" for entries without a message).
+    @return List with the status of each transfer ("DONE", "PROC", or "ERR"), in order.
+    """
+
+    def transfer_batch(
+        self, handles: list[nixl_xfer_handle], notif_msgs: list[bytes] = []
+    ) -> list[str]:
+        statuses = self.agent.postXferReqBatch(
+            [handle._handle for handle in handles], notif_msgs
+        )
+        return [
+            (
+                "DONE"
+                if status == nixlBind.NIXL_SUCCESS
+                else "PROC" if status == nixlBind.NIXL_IN_PROG else "ERR"
+            )
+            for status in statuses
+        ]
+
     """
     @brief Check the state of a transfer operation.
 
@@ -618,6 +645,29 @@ class nixl_agent:
         else:
             return "ERR"
 
+    """
+    @brief Check the state of a batch of transfer operations with a single call
+           into the bindings; the GIL is released while the requests are polled.
+
+    @param handles List of transfer handles, from make_prepped_xfer, or initialize_xfer.
+    @return List with the status of each transfer ("DONE", "PROC", or "ERR"), in order.
+    """
+
+    def check_xfer_state_batch(
+        self, handles: list[nixl_xfer_handle]
+    ) -> list[str]:
+        statuses = self.agent.getXferStatusBatch(
+            [handle._handle for handle in handles]
+        )
+        return [
+            (
+                "DONE"
+                if status == nixlBind.NIXL_SUCCESS
+                else "PROC" if status == nixlBind.NIXL_IN_PROG else "ERR"
+            )
+            for status in statuses
+        ]
+
     """
     @brief Get telemetry information of a transfer request.
            The output object has three time values fields in microseconds
@@ -981,6 +1031,33 @@ class nixl_agent:
 
         return new_descs
 
+    """
+    @brief Build a nixlXferDList in one pass from a device buffer and a block table,
+           without creating per-descriptor Python objects. The buffer can be a DLPack
+           capsule, an object implementing __dlpack__ (e.g. torch.Tensor), or one
+           exposing __cuda_array_interface__/__array_interface__. Intended for large
+           lists (e.g. 10k KV-cache blocks) where tuple construction dominates.
+           The caller must keep the buffer alive for the lifetime of the list.
+
+    @param region Buffer object the blocks point into.
+    @param blocks Nx2 numpy array of (address, length) rows, uint64 or int64.
+    @param mem_type Memory type of the descriptor list.
+    @param dev_id Device ID to use when the buffer protocol carries none
+           (array interfaces); DLPack metadata takes precedence. Default 0.
+    @return Transfer descriptor list, nixlXferDList.
+    """
+
+    def get_block_xfer_descs(
+        self,
+        region,
+        blocks: np.ndarray,
+        mem_type: str,
+        dev_id: int = 0,
+    ) -> nixlBind.nixlXferDList:
+        return nixlBind.nixlXferDList.fromBlocks(
+            self.nixl_mems[mem_type], region, blocks, dev_id
+        )
+
     """
     @brief Get nixlRegDList from different input types:
             a) list of 4 element tuples (address, len, device ID, meta info) alongside a mandatory memory type
@@ -20,6 +20,7 @@
 #include <pybind11/numpy.h>
 #include <pybind11/chrono.h>
 
+#include <cstring>
 #include <tuple>
 #include <iostream>
 
@@ -138,6 +139,115 @@ throw_nixl_exception(const nixl_status_t &status) {
     }
 }
 
+namespace {
+
+// Minimal DLPack ABI (stable since v0.2) for consuming capsules without a
+// vendored dlpack.h; layout-compatible with DLManagedTensor
+struct dlDevice {
+    int32_t device_type;
+    int32_t device_id;
+};
+
+struct dlDataType {
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+};
+
+struct dlTensor {
+    void *data;
+    dlDevice device;
+    int32_t ndim;
+    dlDataType dtype;
+    int64_t *shape;
+    int64_t *strides;
+    uint64_t byte_offset;
+};
+
+struct dlManagedTensor {
+    dlTensor dl_tensor;
+    void *manager_ctx;
+    void (*deleter)(dlManagedTensor *);
+};
+
+struct regionInfo {
+    uintptr_t addr;
+    size_t len;
+    uint64_t dev_id;
+};
+
+regionInfo
+regionFromDlpackCapsule(const py::capsule &cap) {
+    if (std::strcmp(cap.name(), "dltensor") != 0)
+        throw std::invalid_argument("DLPack capsule already consumed or of unknown type");
+
+    auto *mt = static_cast<dlManagedTensor *>(cap.get_pointer());
+    if (!mt)
+        throw std::invalid_argument("Invalid DLPack capsule");
+
+    const dlTensor &t = mt->dl_tensor;
+    size_t count = 1;
+    for (int32_t i = 0; i < t.ndim; i++)
+        count *= t.shape[i];
+    if (t.strides) {
+        int64_t expected = 1;
+        for (int32_t i = t.ndim - 1; i >= 0; i--) {
+            if (t.shape[i] > 1 && t.strides[i] != expected)
+                throw std::invalid_argument("DLPack tensor must be contiguous");
+            expected *= t.shape[i];
+        }
+    }
+
+    regionInfo info;
+    info.addr = (uintptr_t)t.data + t.byte_offset;
+    info.len = count * ((size_t)t.dtype.bits / 8) * t.dtype.lanes;
+    info.dev_id = (uint64_t)t.device.device_id;
+    return info;
+}
+
+regionInfo
+regionFromArrayInterface(const py::dict &iface, uint64_t dev_id) {
+    if (iface.contains("strides") && !iface["strides"].is_none())
+        throw std::invalid_argument("Array-interface buffer must be contiguous");
+
+    auto data = iface["data"].cast<py::tuple>();
+    auto shape = iface["shape"].cast<py::tuple>();
+    auto typestr = iface["typestr"].cast<std::string>();
+    if (typestr.size() < 3)
+        throw std::invalid_argument("Invalid array-interface typestr");
+
+    size_t count = 1;
+    for (const auto &dim : shape)
+        count *= dim.cast<size_t>();
+
+    regionInfo info;
+    info.addr = data[0].cast<uintptr_t>();
+    info.len = count * std::stoul(typestr.substr(2));
+    info.dev_id = dev_id; // the interface carries no device ordinal
+    return info;
+}
+
+// Resolve the base address, byte length and device of a buffer exposed as a
+// DLPack capsule, an object implementing __dlpack__, or one exposing
+// __cuda_array_interface__ / __array_interface__
+regionInfo
+getRegionInfo(const py::object &region, uint64_t dev_id) {
+    if (py::isinstance<py::capsule>(region))
+        return regionFromDlpackCapsule(region.cast<py::capsule>());
+    if (py::hasattr(region, "__dlpack__"))
+        return regionFromDlpackCapsule(region.attr("__dlpack__")().cast<py::capsule>());
+    if (py::hasattr(region, "__cuda_array_interface__"))
+        return regionFromArrayInterface(region.attr("__cuda_array_interface__").cast<py::dict>(),
+                                        dev_id);
+    if (py::hasattr(region, "__array_interface__"))
+        return regionFromArrayInterface(region.attr("__array_interface__").cast<py::dict>(),
+                                        dev_id);
+    throw std::invalid_argument("region must be a DLPack capsule or expose __dlpack__, "
+                                "__cuda_array_interface__ or __array_interface__");
+}
+
+} // namespace
+
 PYBIND11_MODULE(_bindings, m) {
 
     // TODO: each nixl class and/or function can be documented in place
@@ -261,6 +371,46 @@ PYBIND11_MODULE(_bindings, m) {
              }),
              py::arg("type"),
              py::arg("descs").noconvert())
+        .def_static(
+            "fromBlocks",
+            [](nixl_mem_t mem, py::object region, py::array blocks, uint64_t dev_id) {
+                regionInfo info = getRegionInfo(region, dev_id);
+
+                if (blocks.ndim() != 2 || blocks.shape(1) != 2)
+                    throw std::invalid_argument("blocks must be a Nx2 numpy array");
+                if (!py::dtype::of<uint64_t>().equal(blocks.dtype()) &&
+                    !py::dtype::of<int64_t>().equal(blocks.dtype()))
+                    throw std::invalid_argument(
+                        "blocks must be a Nx2 numpy array of uint64 or int64");
+                if (!(blocks.flags() & py::array::c_style))
+                    throw std::invalid_argument("blocks must be a C-contiguous numpy array");
+
+                const size_t n = blocks.shape(0);
+                const auto *buffer = static_cast<const uint64_t *>(blocks.data());
+                nixl_xfer_dlist_t new_list(mem, n);
+
+                // One pass over the raw block table; no per-descriptor Python
+                // objects are created or traversed
+                for (size_t i = 0; i < n; i++) {
+                    const uintptr_t addr = buffer[2 * i];
+                    const size_t len = buffer[2 * i + 1];
+                    if (addr < info.addr || (addr + len) > (info.addr + info.len))
+                        throw std::invalid_argument("block " + std::to_string(i) +
+                                                    " lies outside the provided region");
+                    new_list[i] = nixlBasicDesc(addr, len, info.dev_id);
+                }
+
+                return new_list;
+            },
+            py::arg("type"),
+            py::arg("region"),
+            py::arg("blocks").noconvert(),
+            py::arg("dev_id") = 0,
+            "Build a descriptor list in one pass from a device buffer (DLPack capsule, "
+            "object with __dlpack__, or __cuda_array_interface__/__array_interface__) "
+            "and a Nx2 (address, length) block table. The device ID is taken from the "
+            "DLPack metadata when available, otherwise from dev_id. The caller must "
+            "keep the buffer alive for the lifetime of the list.")
         .def("getType", &nixl_xfer_dlist_t::getType)
         .def("descCount", &nixl_xfer_dlist_t::descCount)
         .def("isEmpty", &nixl_xfer_dlist_t::isEmpty)
@@ -285,6 +435,17 @@ PYBIND11_MODULE(_bindings, m) {
                  list.addDesc(nixlBasicDesc(
                      desc[0].cast<uintptr_t>(), desc[1].cast<size_t>(), desc[2].cast<uint64_t>()));
              })
+        .def("addStridedDesc",
+             [](nixl_xfer_dlist_t &list,
+                uintptr_t addr,
+                size_t block_len,
+                size_t pitch,
+                size_t count,
+                uint64_t dev_id) {
+                 nixl_status_t ret = list.addStridedDesc(
+                     nixlStridedDesc(addr, block_len, pitch, count, dev_id));
+                 if (ret != NIXL_SUCCESS) throw_nixl_exception(ret);
+             })
         .def("index",
              [](nixl_xfer_dlist_t &list, const py::tuple &desc) {
                  int ret = (nixl_status_t)list.getIndex(nixlBasicDesc(
@@ -387,6 +548,17 @@ PYBIND11_MODULE(_bindings, m) {
                                            desc[2].cast<uint64_t>(),
                                            desc[3].cast<std::string>()));
              })
+        .def("addStridedDesc",
+             [](nixl_reg_dlist_t &list,
+                uintptr_t addr,
+                size_t block_len,
+                size_t pitch,
+                size_t count,
+                uint64_t dev_id) {
+                 nixl_status_t ret = list.addStridedDesc(
+                     nixlStridedDesc(addr, block_len, pitch, count, dev_id));
+                 if (ret != NIXL_SUCCESS) throw_nixl_exception(ret);
+             })
         .def("index",
              [](nixl_reg_dlist_t &list, const py::tuple &desc) {
                  int ret = list.getIndex(nixlBlobDesc(desc[0].cast<uintptr_t>(),
@@ -633,8 +805,14 @@ PYBIND11_MODULE(_bindings, m) {
                     extra_params.notifMsg = notif_msg;
                     extra_params.hasNotif = true;
                 }
-                nixl_status_t ret = agent.createXferReq(
-                    operation, local_descs, remote_descs, remote_agent, handle, &extra_params);
+                nixl_status_t ret;
+                {
+                    // Request creation can validate descriptors and select a
+                    // backend; let other Python threads run meanwhile
+                    py::gil_scoped_release release;
+                    ret = agent.createXferReq(
+                        operation, local_descs, remote_descs, remote_agent, handle, &extra_params);
+                }
 
                 throw_nixl_exception(ret);
                 return (uintptr_t)handle;
@@ -662,24 +840,77 @@ PYBIND11_MODULE(_bindings, m) {
             [](nixlAgent &agent, uintptr_t reqh, std::string notif_msg) -> nixl_status_t {
                 nixl_opt_args_t extra_params;
                 nixl_status_t ret;
-                if (notif_msg.size() > 0) {
-                    extra_params.notifMsg = notif_msg;
-                    extra_params.hasNotif = true;
-                    ret = agent.postXferReq((nixlXferReqH *)reqh, &extra_params);
-                } else {
-                    ret = agent.postXferReq((nixlXferReqH *)reqh);
+                {
+                    py::gil_scoped_release release;
+                    if (notif_msg.size() > 0) {
+                        extra_params.notifMsg = notif_msg;
+                        extra_params.hasNotif = true;
+                        ret = agent.postXferReq((nixlXferReqH *)reqh, &extra_params);
+                    } else {
+                        ret = agent.postXferReq((nixlXferReqH *)reqh);
+                    }
                 }
                 throw_nixl_exception(ret);
                 return ret;
             },
             py::arg("reqh"),
             py::arg("notif_msg") = std::string(""))
+        .def(
+            "postXferReqBatch",
+            [](nixlAgent &agent,
+               const std::vector<uintptr_t> &reqhs,
+               const std::vector<std::string> &notif_msgs) -> std::vector<nixl_status_t> {
+                if (!notif_msgs.empty() && notif_msgs.size() != reqhs.size())
+                    throw std::invalid_argument(
+                        "notif_msgs must be empty or match reqhs in length");
+
+                std::vector<nixl_status_t> rets(reqhs.size(), NIXL_SUCCESS);
+                {
+                    // One boundary crossing for the whole batch; posts run
+                    // back to back without GIL ping-pong between them
+                    py::gil_scoped_release release;
+                    for (size_t i = 0; i < reqhs.size(); i++) {
+                        if (!notif_msgs.empty() && notif_msgs[i].size() > 0) {
+                            nixl_opt_args_t extra_params;
+                            extra_params.notifMsg = notif_msgs[i];
+                            extra_params.hasNotif = true;
+                            rets[i] = agent.postXferReq((nixlXferReqH *)reqhs[i], &extra_params);
+                        } else {
+                            rets[i] = agent.postXferReq((nixlXferReqH *)reqhs[i]);
+                        }
+                    }
+                }
+                for (const nixl_status_t &ret : rets)
+                    throw_nixl_exception(ret);
+                return rets;
+            },
+            py::arg("reqhs"),
+            py::arg("notif_msgs") = std::vector<std::string>({}))
         .def("getXferStatus",
              [](nixlAgent &agent, uintptr_t reqh) -> nixl_status_t {
-                 nixl_status_t ret = agent.getXferStatus((nixlXferReqH *)reqh);
+                 nixl_status_t ret;
+                 {
+                     py::gil_scoped_release release;
+                     ret = agent.getXferStatus((nixlXferReqH *)reqh);
+                 }
                  throw_nixl_exception(ret);
                  return ret;
              })
+        .def(
+            "getXferStatusBatch",
+            [](nixlAgent &agent,
+               const std::vector<uintptr_t> &reqhs) -> std::vector<nixl_status_t> {
+                std::vector<nixl_status_t> rets(reqhs.size(), NIXL_SUCCESS);
+                {
+                    py::gil_scoped_release release;
+                    for (size_t i = 0; i < reqhs.size(); i++)
+                        rets[i] = agent.getXferStatus((nixlXferReqH *)reqhs[i]);
+                }
+                for (const nixl_status_t &ret : rets)
+                    throw_nixl_exception(ret);
+                return rets;
+            },
+            py::arg("reqhs"))
         .def(
             "getXferTelemetry",
             [](nixlAgent &agent, uintptr_t reqh) -> nixl_xfer_telem_t {
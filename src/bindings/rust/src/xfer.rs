@@ -15,6 +15,11 @@
 
 use super::*;
 
+use std::future::Future;
+use std::pin::Pin;
+use std::sync::Mutex;
+use std::task::{Context, Poll, Waker};
+
 #[repr(C)]
 #[derive(Debug, Copy, Clone, PartialEq)]
 pub enum XferOp {
@@ -109,6 +114,25 @@ impl XferRequest {
             }
         }
     }
+
+    /// Returns a future that resolves when this transfer reaches a terminal state
+    ///
+    /// Completion is signalled through the agent's completion-callback hook
+    /// rather than by polling, so awaiting many in-flight transfers does not
+    /// cost a blocking thread (or a busy core) per request. The future works
+    /// with any async runtime; dropping it before completion cancels the
+    /// callback registration.
+    pub fn completion(&self) -> XferFuture<'_> {
+        XferFuture {
+            req: self,
+            state: Arc::new(Mutex::new(XferFutureState {
+                status: None,
+                waker: None,
+            })),
+            registered: false,
+            finished: false,
+        }
+    }
 }
 
 // SAFETY: XferRequest can be sent between threads safely
@@ -128,3 +152,120 @@ impl Drop for XferRequest {
         }
     }
 }
+
+/// Shared state between an [`XferFuture`] and the agent's watcher thread
+struct XferFutureState {
+    status: Option<bindings::nixl_capi_status_t>,
+    waker: Option<Waker>,
+}
+
+/// Future returned by [`XferRequest::completion`]
+///
+/// Resolves with the final status of the transfer once the agent's watcher
+/// thread (or an inline check at registration time) observes completion.
+pub struct XferFuture<'a> {
+    req: &'a XferRequest,
+    state: Arc<Mutex<XferFutureState>>,
+    registered: bool,
+    finished: bool,
+}
+
+// SAFETY: `user_data` is the raw Arc reference leaked by `XferFuture::poll`
+// at registration; the C side invokes this exactly once, and we consume that
+// reference here.
+unsafe extern "C" fn xfer_completion_trampoline(
+    user_data: *mut std::os::raw::c_void,
+    status: bindings::nixl_capi_status_t,
+) {
+    let state = unsafe { Arc::from_raw(user_data as *const Mutex<XferFutureState>) };
+    let waker = {
+        let mut guard = state.lock().unwrap();
+        guard.status = Some(status);
+        guard.waker.take()
+    };
+    if let Some(waker) = waker {
+        waker.wake();
+    }
+}
+
+fn xfer_status_to_result(status: bindings::nixl_capi_status_t) -> Result<(), NixlError> {
+    match status {
+        NIXL_CAPI_SUCCESS => Ok(()),
+        _ => Err(NixlError::BackendError),
+    }
+}
+
+impl Future for XferFuture<'_> {
+    type Output = Result<(), NixlError>;
+
+    fn poll(self: Pin<&mut Self>, cx: &mut Context<'_>) -> Poll<Self::Output> {
+        let this = self.get_mut();
+
+        {
+            let mut guard = this.state.lock().unwrap();
+            if let Some(status) = guard.status {
+                this.finished = true;
+                return Poll::Ready(xfer_status_to_result(status));
+            }
+            guard.waker = Some(cx.waker().clone());
+        }
+
+        if !this.registered {
+            let user_data = Arc::into_raw(this.state.clone()) as *mut std::os::raw::c_void;
+            let status = unsafe {
+                nixl_capi_xfer_set_completion_cb(
+                    this.req.agent.write().unwrap().handle.as_ptr(),
+                    this.req.handle(),
+                    Some(xfer_completion_trampoline),
+                    user_data,
+                )
+            };
+            if status != NIXL_CAPI_SUCCESS {
+                // Registration failed; reclaim the reference we just leaked
+                unsafe {
+                    drop(Arc::from_raw(user_data as *const Mutex<XferFutureState>));
+                }
+                this.finished = true;
+                return Poll::Ready(Err(NixlError::BackendError));
+            }
+            this.registered = true;
+
+            // The callback fires inline when the transfer was already
+            // complete at registration; re-check before parking
+            let mut guard = this.state.lock().unwrap();
+            if let Some(status) = guard.status {
+                guard.waker = None;
+                drop(guard);
+                this.finished = true;
+                return Poll::Ready(xfer_status_to_result(status));
+            }
+        }
+
+        Poll::Pending
+    }
+}
+
+impl Drop for XferFuture<'_> {
+    fn drop(&mut self) {
+        if self.registered && !self.finished {
+            let mut user_data: *mut std::os::raw::c_void = std::ptr::null_mut();
+            let status = unsafe {
+                nixl_capi_xfer_cancel_completion_cb(
+                    self.req.agent.write().unwrap().handle.as_ptr(),
+                    self.req.handle(),
+                    &mut user_data,
+                )
+            };
+            if status == NIXL_CAPI_SUCCESS && !user_data.is_null() {
+                // Reclaim the reference held by the cancelled registration
+                unsafe {
+                    drop(Arc::from_raw(user_data as *const Mutex<XferFutureState>));
+                }
+            }
+            // On any other status the callback is firing (or has fired) and
+            // consumes the reference itself; the shared state stays alive
+            // until then, and the request handle is no longer touched by the
+            // watcher either way.
+        }
+    }
+}
@@ -409,6 +409,20 @@ nixl_capi_get_xfer_status(nixl_capi_agent_t agent, nixl_capi_xfer_req_t req_hndl
   return nixl_capi_stub_abort();
 }
 
+nixl_capi_status_t
+nixl_capi_xfer_set_completion_cb(nixl_capi_agent_t agent, nixl_capi_xfer_req_t req_hndl,
+                                 nixl_capi_xfer_cb_t cb, void* user_data)
+{
+  return nixl_capi_stub_abort();
+}
+
+nixl_capi_status_t
+nixl_capi_xfer_cancel_completion_cb(nixl_capi_agent_t agent, nixl_capi_xfer_req_t req_hndl,
+                                    void** user_data)
+{
+  return nixl_capi_stub_abort();
+}
+
 nixl_capi_status_t
 nixl_capi_query_xfer_backend(nixl_capi_agent_t agent,
                              nixl_capi_xfer_req_t req_hndl,
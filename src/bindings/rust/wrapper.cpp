@@ -24,8 +24,12 @@
 #include <exception>
 #include <iterator>
 #include <string>
+#include <utility>
 #include <vector>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 static nixl_thread_sync_t
 nixl_capi_thread_sync_to_nixl(nixl_capi_thread_sync_t sync) {
@@ -42,9 +46,25 @@ nixl_capi_thread_sync_to_nixl(nixl_capi_thread_sync_t sync) {
 }
 
 extern "C" {
+// Pending completion-callback registration, serviced by the agent's watcher
+// thread (see nixl_capi_xfer_set_completion_cb)
+struct nixl_capi_xfer_cb_entry {
+  nixlXferReqH* req;
+  nixl_capi_xfer_cb_t cb;
+  void* user_data;
+};
+
 // Internal struct definitions to match our opaque types
 struct nixl_capi_agent_s {
   nixlAgent* inner;
+  // Completion watcher: one lazily-started thread polls all registered
+  // requests and fires their callbacks, so bindings do not need a polling
+  // thread per in-flight transfer
+  std::thread watcher_thread;
+  std::mutex watcher_lock;
+  std::condition_variable watcher_cv;
+  std::vector<nixl_capi_xfer_cb_entry> watcher_entries;
+  bool watcher_stop = false;
 };
 
 struct nixl_capi_string_list_s {
@@ -100,6 +120,51 @@ struct nixl_capi_query_resp_list_s {
     std::vector<nixl_query_resp_t> responses;
 };
 
+// Polls the registered requests until each reaches a terminal state, then
+// fires its callback. Request handles are only dereferenced while holding
+// watcher_lock, so a successful cancel guarantees the handle is no longer
+// touched; callbacks themselves run unlocked and may re-register or cancel.
+static void
+nixl_capi_xfer_watcher_loop(nixl_capi_agent_t agent)
+{
+  std::unique_lock<std::mutex> lock(agent->watcher_lock);
+
+  while (!agent->watcher_stop) {
+    if (agent->watcher_entries.empty()) {
+      agent->watcher_cv.wait(lock, [agent] {
+        return agent->watcher_stop || !agent->watcher_entries.empty();
+      });
+      continue;
+    }
+
+    std::vector<std::pair<nixl_capi_xfer_cb_entry, nixl_capi_status_t>> done;
+    for (auto it = agent->watcher_entries.begin(); it != agent->watcher_entries.end();) {
+      nixl_status_t ret;
+      try {
+        ret = agent->inner->getXferStatus(it->req);
+      }
+      catch (...) {
+        ret = NIXL_ERR_BACKEND;
+      }
+      if (NIXL_IN_PROG == ret) {
+        ++it;
+        continue;
+      }
+      done.emplace_back(*it, ret == NIXL_SUCCESS ? NIXL_CAPI_SUCCESS : NIXL_CAPI_ERROR_BACKEND);
+      it = agent->watcher_entries.erase(it);
+    }
+
+    lock.unlock();
+    for (const auto& [entry, status] : done) {
+      entry.cb(entry.user_data, status);
+    }
+    if (done.empty()) {
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    lock.lock();
+  }
+}
+
 nixl_capi_status_t
 nixl_capi_create_agent(const char* name, nixl_capi_agent_t* agent)
 {
@@ -157,6 +222,14 @@ nixl_capi_destroy_agent(nixl_capi_agent_t agent) {
     }
 
     try {
+        {
+            std::lock_guard<std::mutex> lock(agent->watcher_lock);
+            agent->watcher_stop = true;
+            agent->watcher_cv.notify_one();
+        }
+        if (agent->watcher_thread.joinable()) {
+            agent->watcher_thread.join();
+        }
         delete agent->inner;
         delete agent;
         return NIXL_CAPI_SUCCESS;
@@ -1519,6 +1592,55 @@ nixl_capi_get_xfer_status(nixl_capi_agent_t agent, nixl_capi_xfer_req_t req_hndl
   }
 }
 
+nixl_capi_status_t
+nixl_capi_xfer_set_completion_cb(nixl_capi_agent_t agent, nixl_capi_xfer_req_t req_hndl,
+                                 nixl_capi_xfer_cb_t cb, void* user_data)
+{
+  if (!agent || !req_hndl || !req_hndl->req || !cb) {
+    return NIXL_CAPI_ERROR_INVALID_PARAM;
+  }
+
+  try {
+    // Already terminal: fire inline so the caller never waits on the watcher
+    nixl_status_t ret = agent->inner->getXferStatus(req_hndl->req);
+    if (NIXL_IN_PROG != ret) {
+      cb(user_data, ret == NIXL_SUCCESS ? NIXL_CAPI_SUCCESS : NIXL_CAPI_ERROR_BACKEND);
+      return NIXL_CAPI_SUCCESS;
+    }
+
+    std::lock_guard<std::mutex> lock(agent->watcher_lock);
+    if (!agent->watcher_thread.joinable()) {
+      agent->watcher_thread = std::thread(nixl_capi_xfer_watcher_loop, agent);
+    }
+    agent->watcher_entries.push_back({req_hndl->req, cb, user_data});
+    agent->watcher_cv.notify_one();
+    return NIXL_CAPI_SUCCESS;
+  }
+  catch (...) {
+    return NIXL_CAPI_ERROR_BACKEND;
+  }
+}
+
+nixl_capi_status_t
+nixl_capi_xfer_cancel_completion_cb(nixl_capi_agent_t agent, nixl_capi_xfer_req_t req_hndl,
+                                    void** user_data)
+{
+  if (!agent || !req_hndl || !user_data) {
+    return NIXL_CAPI_ERROR_INVALID_PARAM;
+  }
+
+  std::lock_guard<std::mutex> lock(agent->watcher_lock);
+  for (auto it = agent->watcher_entries.begin(); it != agent->watcher_entries.end(); ++it) {
+    if (it->req == req_hndl->req) {
+      *user_data = it->user_data;
+      agent->watcher_entries.erase(it);
+      return NIXL_CAPI_SUCCESS;
+    }
+  }
+  // Callback already fired, is about to fire, or was never registered
+  return NIXL_CAPI_ERROR_INVALID_STATE;
+}
+
 nixl_capi_status_t
 nixl_capi_query_xfer_backend(nixl_capi_agent_t agent,
                              nixl_capi_xfer_req_t req_hndl,
@@ -272,6 +272,25 @@ nixl_capi_status_t nixl_capi_post_xfer_req(
 
 nixl_capi_status_t nixl_capi_get_xfer_status(nixl_capi_agent_t agent, nixl_capi_xfer_req_t req_hndl);
 
+// Transfer-completion callback. `status` carries the final status of the
+// request. Invoked from an internal watcher thread owned by the agent, or
+// inline from nixl_capi_xfer_set_completion_cb when the transfer is already
+// complete at registration time.
+typedef void (*nixl_capi_xfer_cb_t)(void *user_data, nixl_capi_status_t status);
+
+// Register a callback fired exactly once when req_hndl reaches a terminal
+// state, so language bindings can expose event-driven (e.g. async/await)
+// transfer APIs without a polling thread per request. The request handle must
+// remain valid until the callback fires or the registration is cancelled.
+nixl_capi_status_t nixl_capi_xfer_set_completion_cb(
+    nixl_capi_agent_t agent, nixl_capi_xfer_req_t req_hndl, nixl_capi_xfer_cb_t cb, void *user_data);
+
+// Remove a pending registration, handing back its user_data pointer. Returns
+// NIXL_CAPI_ERROR_INVALID_STATE when the callback already fired or is about
+// to; the caller must then let the callback reclaim user_data.
+nixl_capi_status_t nixl_capi_xfer_cancel_completion_cb(
+    nixl_capi_agent_t agent, nixl_capi_xfer_req_t req_hndl, void **user_data);
+
 nixl_capi_status_t
 nixl_capi_query_xfer_backend(nixl_capi_agent_t agent,
                              nixl_capi_xfer_req_t req_hndl,
@@ -18,11 +18,20 @@
 #define __AGENT_DATA_H_
 
 #include "common/str_tools.h"
+#include "common/progress_executor.h"
+#include "common/staging_pool.h"
 #include "mem_section.h"
 #include "telemetry.h"
+#include "tiering.h"
 #include "stream/metadata_stream.h"
 #include "sync.h"
 
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <set>
+#include <tuple>
+
 
 #if HAVE_ETCD
 #include <etcd/SyncClient.hpp>
@@ -36,6 +45,10 @@ class SyncClient;
 
 using backend_list_t = std::vector<nixlBackendEngine*>;
 
+// Per-agent communication loop state (epoll set, per-peer send queues and
+// reassembly buffers); complete only in nixl_listener.cpp
+struct nixlCommState;
+
 //Internal typedef to define metadata communication request types
 //To be extended with ETCD operations
 enum nixl_comm_t {
@@ -50,15 +63,184 @@ enum nixl_comm_t {
 #endif // HAVE_ETCD
 };
 
+// Refcounted immutable metadata blob: serialized once and passed by
+// shared ownership through the comm queue and socket sends, so large MD
+// blobs are not copied per hop
+using nixl_md_ptr_t = std::shared_ptr<const nixl_blob_t>;
+
+// Bounded handoff between a thread serializing local MD and the comm loop
+// streaming it out (sendLocalMD socket path): the producer pushes chunks as
+// serdes emits them and the comm loop cuts one wire frame per chunk, so
+// socket writes overlap serialization instead of following it
+struct nixlMDStream {
+    // Producer-side chunking granularity and buffering bound
+    static constexpr size_t chunkBytes = 1 << 20;
+    static constexpr size_t maxChunks = 8;
+
+    void push(std::string &&chunk) {
+        std::unique_lock<std::mutex> ul(streamLock);
+        // Backpressure is advisory: the comm loop may itself be waiting on
+        // the agent lock the producer holds, so rather than risk a deadlock
+        // the producer resumes after a bounded wait
+        streamCv.wait_for(ul, std::chrono::milliseconds(10),
+                          [this] { return chunks.size() < maxChunks; });
+        producedBytes += chunk.size();
+        chunks.push_back(std::move(chunk));
+    }
+
+    void finish() {
+        std::lock_guard<std::mutex> lg(streamLock);
+        done = true;
+    }
+
+    // Consumer side, non-blocking: false when the producer has not caught
+    // up yet; final marks the last chunk, which is empty when the producer
+    // finished after the previous pop
+    bool pop(std::string &chunk, bool &final) {
+        std::lock_guard<std::mutex> lg(streamLock);
+        if (chunks.empty()) {
+            if (!done)
+                return false;
+            chunk.clear();
+            final = true;
+            return true;
+        }
+        chunk = std::move(chunks.front());
+        chunks.pop_front();
+        final = done && chunks.empty();
+        streamCv.notify_one();
+        return true;
+    }
+
+    // True when pop() would produce a frame right now
+    bool hasData() const {
+        std::lock_guard<std::mutex> lg(streamLock);
+        return done || !chunks.empty();
+    }
+
+    // Total bytes pushed; stable once the final chunk has been popped
+    size_t produced() const {
+        std::lock_guard<std::mutex> lg(streamLock);
+        return producedBytes;
+    }
+
+private:
+    mutable std::mutex streamLock;
+    std::condition_variable streamCv;
+    std::deque<std::string> chunks;
+    size_t producedBytes = 0;
+    bool done = false;
+};
+
+using nixl_md_stream_ptr_t = std::shared_ptr<nixlMDStream>;
+
 //Command to be sent to listener thread from NIXL API
 // 1) Command type
 // 2) IP Address
 // 3) Port
 // 4) Metadata to send (for sendLocalMD calls)
-using nixl_comm_req_t = std::tuple<nixl_comm_t, std::string, int, nixl_blob_t>;
+// 5) Metadata stream when the blob is still being serialized (SOCK_SEND only)
+using nixl_comm_req_t =
+    std::tuple<nixl_comm_t, std::string, int, nixl_md_ptr_t, nixl_md_stream_ptr_t>;
 
 using nixl_socket_peer_t = std::pair<std::string, int>;
 
+// Cached outcome of backend selection and descriptor matching for a transfer
+// shape that is re-issued through createXferReq. The original query dlists
+// are kept to rule out hash collisions on lookup.
+struct nixlXferPlan {
+    nixlBackendEngine  *engine = nullptr;
+    nixl_xfer_dlist_t  localDescs;
+    nixl_xfer_dlist_t  remoteDescs;
+    nixl_meta_dlist_t  initiatorDescs;
+    nixl_meta_dlist_t  targetDescs;
+    // Cost-driven selection is re-run once a plan is older than
+    // xferPlanReevalPeriod, so a backend whose load changed can win back
+    // the shape
+    chrono_point_t     createdAt;
+
+    nixlXferPlan(const nixl_mem_t &local_type, const nixl_mem_t &remote_type)
+        : localDescs(local_type), remoteDescs(remote_type),
+          initiatorDescs(local_type), targetDescs(remote_type) {}
+};
+
+// Relay-side bookkeeping of one in-flight hop-two forward (staging to
+// final target) of a relayed transfer; polled in the getNotifs path and
+// acked back to the initiator on completion
+struct nixlRelayForward {
+    nixlBackendEngine *engine = nullptr;
+    nixlBackendReqH   *handle = nullptr;
+    std::unique_ptr<nixl_meta_dlist_t> localDescs;
+    std::unique_ptr<nixl_meta_dlist_t> targetDescs;
+    std::string initiator;
+    std::string finalAgent;
+    uint64_t    token = 0;
+    uint32_t    chunk = 0;
+    bool        hasNotif = false;
+    nixl_blob_t notifMsg;
+};
+
+// One invalidated peer awaiting background teardown (see
+// invalidateRemoteData): the remote section already detached from the
+// maps, whose deletion unloads every cached MD through the backends, and
+// the engines still holding a connection to the peer
+struct nixlDeadPeer {
+    std::string name;
+    nixlRemoteSection *section = nullptr;
+    backend_list_t engines;
+};
+
+// Handle of one background remote metadata load (see loadRemoteMDAsync):
+// the worker fills agentName before the future resolves, the cached status
+// keeps getMDLoadStatus callable after the future has been consumed
+class nixlMDLoadH {
+    private:
+        std::future<nixl_status_t> result;
+        std::string                agentName;
+        nixl_status_t              status = NIXL_IN_PROG;
+
+    friend class nixlAgent;
+};
+
+// One consumer's notification shard (see nixlAgent::createNotifQueue):
+// whichever thread polls getNotifs routes notifications from the
+// subscribed remote agents into the shard under its own lock, so
+// consumers draining different shards contend neither with each other
+// nor with the poller's agent lock
+class nixlNotifQueueH {
+    private:
+        std::set<std::string> agents;
+        notif_list_t          queue;
+        std::mutex            lock;
+
+    friend class nixlAgent;
+    friend class nixlAgentData;
+};
+
+// One application thread's notification staging ring (see asyncNotif in
+// genNotif): the owning thread produces, the progress executor's flush
+// poller consumes, so staging a notification never takes a lock. Entries
+// are flushed in staging order per thread; a full ring falls back to the
+// inline send path.
+class nixlNotifRing {
+    private:
+        struct nixlStagedNotif {
+            std::string    agent;
+            nixl_blob_t    msg;
+            // Engines pinned by the caller's extra_params; empty means
+            // the target backend is resolved at flush time
+            backend_list_t engines;
+        };
+        static constexpr size_t ringSize = 256; // power of two
+
+        std::array<nixlStagedNotif, ringSize> slots;
+        std::atomic<size_t> head{0}; // consumer index
+        std::atomic<size_t> tail{0}; // producer index
+
+    friend class nixlAgent;
+    friend class nixlAgentData;
+};
+
 class nixlAgentData {
     private:
         std::string     name;
@@ -66,11 +248,52 @@ class nixlAgentData {
         nixlLock        lock;
         bool telemetryEnabled = false;
 
+        // Process-unique instance id, assigned at construction. Keys the
+        // per-thread async-notif ring cache in genNotif, so a recycled
+        // nixlAgentData allocation can never alias a destroyed agent's
+        // cached ring.
+        const uint64_t  instanceId;
+
         // some handle that can be used to instantiate an object from the lib
         std::map<std::string, void*> backendLibs;
 
         // Bookkeeping from backend type and memory type to backend engine
         backend_list_t                         notifEngines;
+
+        // Resume point for time-budgeted getNotifs/getNotifsView calls:
+        // when a call runs out of budget mid-list, the next one starts at
+        // the first undrained engine, so backends late in the list are
+        // not starved by repeatedly expiring budgets
+        size_t                                 notifPollRR = 0;
+
+        // Backing store for getNotifsView: notifications collected on the
+        // last call, which the returned string_views point into. Reused
+        // (and invalidated) on every call.
+        notif_list_t                           notifViewBuffer;
+
+        // Sharded notification consumers: each remote agent is claimed by
+        // at most one queue; routing runs under the agent lock in the
+        // getNotifs paths, pushes take only the shard's own lock
+        std::vector<nixlNotifQueueH*>          notifQueues;
+        std::unordered_map<std::string, nixlNotifQueueH*,
+                           std::hash<std::string>, strEqual> notifQueueRoutes;
+        // Subscription filters: with any prefix registered, only incoming
+        // notifications whose payload starts with one of them are staged;
+        // the rest are counted and dropped before any map/queue copy.
+        // Written by setNotifFilter and read by the drain paths, both
+        // under the agent lock. Internal control notifications (inline,
+        // integrity, relay) are consumed before the filter runs.
+        std::vector<nixl_blob_t>               notifFilters;
+        uint64_t                               notifFilterDrops = 0;
+        // Async notification staging (see asyncNotif): per-thread rings
+        // registered here on first use and drained in order by a lazily
+        // registered executor poller. Registration and the poller id are
+        // guarded by notifRingsLock; ring traffic itself is lock-free.
+        std::mutex                             notifRingsLock;
+        std::vector<std::shared_ptr<nixlNotifRing>> notifRings;
+        uint64_t                               notifPollerId = 0;
+        bool                                   notifPollerActive = false;
+
         backend_map_t                          backendEngines;
         std::array<backend_list_t, FILE_SEG+1> memToBackend;
 
@@ -84,12 +307,44 @@ class nixlAgentData {
         // Local section, and Remote sections and their available common backends
         nixlLocalSection*                                        memorySection;
 
+        // Copy-on-write registration snapshot for the lock-free query path:
+        // rebuilt from memorySection by the registration mutators and
+        // swapped in with an atomic store, so getRegSnapshot is a single
+        // atomic pointer load off the agent lock
+        std::shared_ptr<const nixlRegSnapshot>                   regSnapshot;
+        uint64_t                                                 regSnapshotVersion = 0;
+
         std::unordered_map<std::string,
                            std::unordered_map<nixl_backend_t, nixl_blob_t>,
                            std::hash<std::string>, strEqual>     remoteBackends;
         std::unordered_map<std::string, nixlRemoteSection*,
                            std::hash<std::string>, strEqual>     remoteSections;
 
+        // Sequence numbering for delta metadata updates: local seq is bumped
+        // per published delta, remote seqs track the last applied update per
+        // agent so gaps can be detected and trigger a full resync
+        uint64_t                                                 mdSeqNum = 0;
+
+        // Cached full serialized local MD, rebuilt in getLocalMDLocked only
+        // when the local section or connection info has changed since the
+        // previous build; reset wherever connMD or mdSeqNum are mutated
+        nixl_md_ptr_t                                            cachedLocalMD;
+        std::mutex                                               cachedLocalMDLock;
+        std::unordered_map<std::string, uint64_t,
+                           std::hash<std::string>, strEqual>     remoteMDSeq;
+        // CRC32C and size of the last applied full MD blob per agent, used
+        // by loadRemoteMD to skip re-parsing identical re-sends (reconnect
+        // storms re-push the same blob to every peer)
+        std::unordered_map<std::string, std::pair<uint32_t, size_t>,
+                           std::hash<std::string>, strEqual>     remoteMDDigest;
+
+        // Loaded peer metadata as received: the last full MD blob followed
+        // by the delta chain applied on top of it, per agent. Checkpointed
+        // by checkpointMD and replayed through loadRemoteMD on restore, so
+        // a restarted agent resumes its peer view without re-exchanging MD
+        std::unordered_map<std::string, std::vector<nixl_blob_t>,
+                           std::hash<std::string>, strEqual>     remoteMDCache;
+
         // State/methods for listener thread
         nixlMDStreamListener               *listener;
         std::map<nixl_socket_peer_t, int>  remoteSockets;
@@ -98,18 +353,325 @@ class nixlAgentData {
         std::mutex                         commLock;
         bool                               commThreadStop;
         bool                               useEtcd;
+        // Same-host fast path: publish serialized MD into a per-agent POSIX
+        // shared memory segment that colocated peers map directly, instead
+        // of a socket or etcd round-trip
+        bool                               useShmMD = false;
+        // eventfd waking the comm thread out of epoll_wait when commands
+        // are enqueued or the agent shuts down
+        int                                commWakeupFd = -1;
+        // Comm loop state; owned by commWorker in listener-thread mode and
+        // by the agent in user-driven mode (see progressControlPlane)
+        nixlCommState                      *commState = nullptr;
+
+        // Plan cache for createXferReq, keyed by the hash of the transfer
+        // shape, invalidated when local or remote registrations change
+        std::unordered_map<size_t, nixlXferPlan> xferPlanCache;
+        std::mutex                               xferPlanLock;
+        static constexpr size_t                  maxXferPlanCacheSize = 4096;
+        // Cached plans older than this are treated as misses, so the
+        // cost-driven backend selection is re-run against current load
+        static constexpr std::chrono::seconds    xferPlanReevalPeriod{5};
+
+        // Relayed (multi-hop) transfer state: initiator-side requests
+        // awaiting relay acks keyed by token, relay-side in-flight hop-two
+        // forwards, and the token sequence for new relayed requests
+        std::unordered_map<uint64_t, nixlXferReqH*> relayPending;
+        std::vector<nixlRelayForward>               relayForwards;
+        uint64_t                                    relayTokenSeq = 1;
+
+        // Ordered channels: last request posted per (peer, channel id).
+        // A new post on a channel chains behind this tail through the
+        // dependency edges, giving FIFO completion visibility per channel
+        std::map<std::pair<std::string, int>, nixlXferReqH*> channelTails;
+
+        // Deployment routing policy, consulted before the built-in backend
+        // selection in makeXferReq/createXferReq when set
+        nixl_xfer_policy_cb_t                    xferPolicyCb;
+
+        // Tiering engine, created lazily on the first tiering API call;
+        // registerMem/deregisterMem feed its per-tier usage accounting
+        std::unique_ptr<nixlTieringEngine>       tiering;
+
+        // In-flight metadata prefetches (see prefetchRemoteMD); drained at
+        // the top of the destructor since they capture the owning agent
+        std::vector<std::future<void>>           mdPrefetches;
+        std::mutex                               mdPrefetchLock;
+
+        // Minimum transfer size for which striping across backends is attempted
+        static constexpr size_t                  stripingMinBytes = 1 << 20;
+
+        // Largest WRITE that may ride inline in a notification message
+        // instead of going through the backend data path
+        static constexpr size_t                  inlineNotifMaxBytes = 4096;
+
+        // Largest trace context that may be attached to a transfer for
+        // distributed correlation (trace-id + span-id)
+        static constexpr size_t                  traceCtxMaxBytes = 16;
+
+        // Loopback copy tuning: below the threshold a single memcpy wins,
+        // above it the copy is split across up to this many helper threads
+        static constexpr size_t                  loopbackParallelMinBytes = 4 << 20;
+        static constexpr unsigned                loopbackMaxCopyThreads = 4;
+
+        // Size of the internal buffer arena when huge-page or NUMA policy
+        // is requested through the config
+        static constexpr size_t                  internalArenaBytes = 8 << 20;
+
+        // Shared progress executor handed to backends at creation, so the
+        // total progress thread count is capped by config instead of growing
+        // with the number of backends
+        std::unique_ptr<nixlProgressExecutor>    progressExecutor;
+
+        // Agent-level pinned staging pool (config stagingPoolBytes): the
+        // slab is allocated and locked at construction, registered with
+        // each backend at createBackend time (handles below, released in
+        // the destructor before the engines), and handed to backends
+        // through the init params so staging consumers draw pre-pinned
+        // memory instead of allocating at first use
+        nixlStagingPool                          stagingPool;
+        std::unordered_map<nixlBackendEngine*, nixlBackendMD*> stagingPoolMDs;
+
+        // Deferred deregistration state: each deregisterMem call pushes one
+        // epoch (backend plus the MDs it removed from the section) and a
+        // lazily registered executor poller reclaims one epoch per pass, so
+        // bulk recycling never stalls the caller on driver unmaps. Queue and
+        // poller registration are guarded by reclaimLock.
+        std::mutex                         reclaimLock;
+        std::deque<std::pair<nixlBackendEngine*,
+                             std::vector<nixlBackendMD*>>> reclaimQueue;
+        uint64_t                           reclaimPollerId = 0;
+        bool                               reclaimPollerActive = false;
+
+        // Deferred peer invalidation: invalidateRemoteData detaches the
+        // peer's section and backend list from the maps synchronously, so
+        // lookups miss immediately, and queues the expensive teardown
+        // (per-MD driver unloads in the section destructor plus backend
+        // disconnects) here; a lazily registered executor poller drains
+        // every queued peer in one pass, batching scale-down bursts.
+        // Queue and poller registration are guarded by invalidateLock.
+        std::mutex                         invalidateLock;
+        std::deque<nixlDeadPeer>           invalidateQueue;
+        uint64_t                           invalidatePollerId = 0;
+        bool                               invalidatePollerActive = false;
+
+        // Non-blocking init state (constructNonBlocking/checkInit): the
+        // report is stamped by runInitStage under initLock, and the stage
+        // threads are joined first thing in the agent destructor
+        std::mutex                         initLock;
+        nixl_init_report_t                 initReport;
+        bool                               initStarted = false;
+        std::vector<std::thread>           initThreads;
+        // Backends created by the staged init that createBackend has not
+        // handed out to the application yet
+        std::set<nixl_backend_t>           stagedBackends;
+
+        // Connection warmup state: peers queued by makeConnections with
+        // their backend hints, per-peer results, and the worker thread
+        // (started lazily) that establishes the connections in background
+        std::mutex                         connWarmupLock;
+        std::thread                        connWarmupThread;
+        std::deque<std::pair<std::string, std::vector<nixlBackendH*>>> connWarmupQueue;
+        std::unordered_map<std::string, nixl_status_t,
+                           std::hash<std::string>, strEqual> connWarmupStatus;
+        bool                               connWarmupStop = false;
+
+        // Priority scheduler state: in-flight posts per priority class and
+        // the queue of deferred lower-priority requests awaiting dispatch
+        std::mutex                         schedLock;
+        uint32_t                           prioInFlight[3] = {0, 0, 0};
+        std::deque<nixlXferReqH*>          deferredReqs;
+
+        // Per-(peer, backend) in-flight byte windows set by setSendWindow,
+        // enforced at post admission so excess requests queue in the
+        // scheduler instead of ballooning NIC buffers during incast. The
+        // backend key "" applies to every backend towards the peer. Both
+        // maps are guarded by schedLock.
+        std::map<std::pair<std::string, nixl_backend_t>, uint64_t> sendWindowMax;
+        std::map<std::pair<std::string, nixl_backend_t>, uint64_t> sendWindowUsed;
+
+        // Token-bucket shaping per priority class, set by setClassRate and
+        // guarded by schedLock. Tokens refill lazily from the elapsed time
+        // whenever a bucket is consulted; charging a request may drive the
+        // balance negative, which stalls further posts of the class until
+        // the refill catches up, so shaping holds for requests larger than
+        // the burst. Auto-chunked requests are charged chunk by chunk as
+        // the pipeline advances (see postChunkWindow), so a shaped bulk
+        // transfer trickles instead of bursting its full size at once.
+        struct nixlClassBucket {
+            uint64_t       bytesPerSec = 0; // 0 = class not shaped
+            uint64_t       burstBytes = 0;
+            double         tokens = 0;
+            chrono_point_t lastRefill;
+        };
+        nixlClassBucket                    classBuckets[3];
+
+        // Observed transfer size histogram (log2 buckets) behind the
+        // adaptive auto-chunk threshold, guarded by schedLock. Requests
+        // with descriptors far above the typical sizes seen here are
+        // split into pipeline chunks at creation time (see createXferReq)
+        uint64_t                           xferSizeHist[64] = {};
+        uint64_t                           xferSizeSamples = 0;
+
+        // Auto-chunk tuning: threshold floor, and the default that holds
+        // until enough size samples accumulate
+        static constexpr size_t            chunkMinBytes = 64ull << 20;
+        static constexpr size_t            chunkDefaultBytes = 256ull << 20;
+        static constexpr uint64_t          chunkMinSamples = 64;
+
+        // Per-backend chunk ceiling set through setXferChunkSize; absent
+        // entries fall back to the backend's own getMaxXferChunkSize.
+        // Guarded by schedLock like the rest of the chunking state
+        std::unordered_map<nixl_backend_t, size_t> chunkSizeOverride;
+
+        // Measured transfer cost table: every completed transfer is a
+        // calibration probe, feeding an EWMA of observed duration per
+        // (backend, local mem, remote mem, log2 size bucket). Entries with
+        // enough samples back estimateXferCost and backend selection with
+        // numbers measured on this deployment instead of analytical
+        // guesses. Guarded by xferCostLock.
+        struct xferCostEntry {
+            double durUs = 0; // EWMA of observed duration
+            double devUs = 0; // EWMA of absolute deviation, the err margin
+            uint64_t samples = 0;
+        };
+        using xfer_cost_key_t =
+            std::tuple<nixlBackendEngine*, nixl_mem_t, nixl_mem_t, int>;
+        std::map<xfer_cost_key_t, xferCostEntry> xferCostTable;
+        mutable std::mutex                 xferCostLock;
+        static constexpr uint64_t          xferCostMinSamples = 4;
+
+        // Stall watchdog: an in-flight request older than this (since its
+        // dispatch) fires a telemetry event and the backend diagnostic
+        // dump, once per post. Set by NIXL_XFER_STALL_TIMEOUT (in
+        // milliseconds); zero disables the watchdog
+        std::chrono::milliseconds          xferStallTimeout{30000};
+
+        // State/methods for the completion notification thread, started lazily
+        // on the first post that requests a completion callback or eventfd
+        std::thread                        completionThread;
+        std::vector<nixlXferReqH*>         completionQueue;
+        std::mutex                         completionLock;
+        bool                               completionThreadStop = false;
         std::unique_ptr<nixlTelemetry> telemetry_;
         void commWorker(nixlAgent* myAgent);
+        // Comm loop split for the user-driven mode: setup/teardown of the
+        // epoll set and etcd client, and one bounded progress pass
+        void setupCommState();
+        void teardownCommState();
+        void progressCommOnce(nixlAgent *myAgent, int timeout_ms);
+        nixl_status_t
+        getLocalMDLocked(nixl_md_ptr_t &md);
+        nixl_status_t
+        sendLocalMDStreamed(const std::string &ip, int port);
         void enqueueCommWork(nixl_comm_req_t request);
+        void wakeCommThread();
         void getCommWork(std::vector<nixl_comm_req_t> &req_list);
         nixl_status_t
+        publishLocalMDShm(const nixl_blob_t &md);
+        nixl_status_t
+        fetchRemoteMDShm(const std::string &remote_name, nixl_blob_t &md);
+        void unlinkLocalMDShm();
+        nixl_status_t
         loadConnInfo(const std::string &remote_name,
                      const nixl_backend_t &backend,
                      const nixl_blob_t &conn_info);
         nixl_status_t
         loadRemoteSections(const std::string &remote_name, nixlSerDes &sd);
         nixl_status_t
+        applyRemoteMDRemovals(const std::string &remote_name, nixlSerDes &sd);
+        nixl_status_t
         invalidateRemoteData(const std::string &remote_name);
+        nixl_status_t
+        postXferReqLocked(nixlXferReqH *req_hndl, const nixl_opt_args_t *extra_params);
+        nixl_status_t
+        runLoopbackCopy(nixlXferReqH *req_hndl);
+        nixl_status_t
+        dispatchXferReqLocked(nixlXferReqH *req_hndl);
+        nixl_status_t
+        failoverXferLocked(nixlXferReqH *req_hndl, std::set<nixlBackendEngine *> &tried);
+        nixl_status_t
+        appendIntegrityTrailer(nixlXferReqH *req_hndl);
+        void checkNotifIntegrity(notif_list_t &notif_list);
+        void routeNotifs(notif_list_t &notif_list);
+        void filterNotifs(notif_list_t &notif_list);
+        bool flushNotifRings();
+        nixl_status_t
+        sendStagedNotif(const std::string &remote_agent,
+                        const nixl_blob_t &msg,
+                        const backend_list_t &engines);
+        nixl_status_t
+        sendInlineNotif(nixlXferReqH *req_hndl);
+        void applyInlineNotifs(notif_list_t &notif_list);
+        nixl_status_t
+        createRelayXfer(const nixl_xfer_op_t &operation,
+                        const nixl_xfer_dlist_t &local_descs,
+                        const nixl_xfer_dlist_t &remote_descs,
+                        const std::string &remote_agent,
+                        const std::string &relay_agent,
+                        nixlXferReqH *&req_hndl);
+        nixl_status_t
+        advanceRelay(nixlXferReqH *req_hndl);
+        nixl_status_t
+        progressRelay(nixlXferReqH *req_hndl);
+        nixl_status_t
+        postRelayChunk(nixlXferReqH *req_hndl, int slot);
+        nixl_status_t
+        sendRelayCmd(nixlXferReqH *req_hndl, int slot);
+        void sendRelayAck(const std::string &initiator,
+                          uint64_t token,
+                          uint32_t chunk,
+                          nixl_status_t status);
+        void processRelayNotifs(notif_list_t &notif_list);
+        void progressRelayForwards();
+        nixl_status_t
+        createStagedXfer(const nixl_xfer_op_t &operation,
+                         const nixl_xfer_dlist_t &storage_descs,
+                         const nixl_xfer_dlist_t &final_descs,
+                         const nixl_xfer_dlist_t &staging_descs,
+                         const std::string &remote_agent,
+                         nixlXferReqH *&req_hndl);
+        nixl_status_t
+        advanceStaged(nixlXferReqH *req_hndl);
+        nixl_status_t
+        progressStaged(nixlXferReqH *req_hndl);
+        nixl_status_t
+        postStagedLeg(nixlXferReqH *req_hndl, int slot, bool draining);
+        void completeStagedChunk(nixlXferReqH *req_hndl, int slot);
+        bool schedGateClear(nixl_xfer_priority_t priority);
+        void classBucketRefill(nixlClassBucket &bucket);
+        bool classRateClear(nixl_xfer_priority_t priority);
+        void classRateCharge(nixl_xfer_priority_t priority, uint64_t bytes);
+        bool classRateTakeChunk(nixl_xfer_priority_t priority, uint64_t bytes);
+        void recordXferSize(size_t bytes);
+        void recordXferCost(nixlXferReqH *req_hndl);
+        nixl_status_t lookupXferCost(nixlBackendEngine *engine,
+                                     nixl_mem_t local_mem,
+                                     nixl_mem_t remote_mem,
+                                     size_t bytes,
+                                     std::chrono::microseconds &duration,
+                                     std::chrono::microseconds &err_margin) const;
+        size_t chunkThreshold();
+        size_t backendChunkLimit(nixlBackendEngine *engine);
+        bool sendWindowClear(nixlXferReqH *req_hndl);
+        void sendWindowCharge(nixlXferReqH *req_hndl);
+        void sendWindowRelease(nixlXferReqH *req_hndl);
+        void schedXferDone(nixlXferReqH *req_hndl);
+        void checkXferStall(nixlXferReqH *req_hndl);
+        void fireDepSuccessors(nixlXferReqH *req_hndl);
+        bool tryDispatchDeferred(nixlXferReqH *req_hndl);
+        void dropDeferred(nixlXferReqH *req_hndl);
+        void invalidateXferPlans();
+        void publishRegSnapshot();
+        bool reclaimOneEpoch();
+        void drainReclaimQueue();
+        void teardownDeadPeer(nixlDeadPeer &dead);
+        bool reclaimDeadPeers();
+        void connWarmupWorker(nixlAgent *myAgent);
+        void completionWorker();
+        void watchCompletion(nixlXferReqH *req_hndl);
+        void dropCompletion(nixlXferReqH *req_hndl);
+        void signalCompletion(nixlXferReqH *req_hndl);
 
     public:
         nixlAgentData(const std::string &name, const nixlAgentConfig &cfg);
@@ -121,6 +683,8 @@ class nixlAgentData {
         }
 
     friend class nixlAgent;
+    // For the chunk-granularity shaping gate in postChunkWindow
+    friend class nixlXferReqH;
 };
 
 class nixlBackendEngine;
@@ -15,10 +15,15 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <iostream>
 #include <chrono>
 #include <iostream>
+#include <limits>
 #include <numeric>
+#include <thread>
+#include <unistd.h>
+#include <sys/eventfd.h>
 
 #include "nixl.h"
 #include "serdes/serdes.h"
@@ -26,17 +31,110 @@
 #include "transfer_request.h"
 #include "agent_data.h"
 #include "plugin_manager.h"
+#include "common/nixl_arena.h"
+#include "common/nixl_crc32c.h"
 #include "common/nixl_log.h"
+#include "common/nixl_probes.h"
 #include "common/operators.h"
 #include "telemetry.h"
 #include "telemetry_event.h"
 
 constexpr char TELEMETRY_ENABLED_VAR[] = "NIXL_TELEMETRY_ENABLE";
 constexpr char TELEMETRY_DIR_VAR[] = "NIXL_TELEMETRY_DIR";
+constexpr char XFER_STALL_TIMEOUT_VAR[] = "NIXL_XFER_STALL_TIMEOUT";
 static const std::vector<std::vector<std::string>> illegal_plugin_combinations = {
     {"GDS", "GDS_MT"},
 };
 
+namespace {
+    // Integrity-mode trailer appended to notification payloads: the
+    // target-side (addr, len) pairs followed by a fixed footer, parsed
+    // from the end of the message
+    constexpr char integrityMagic[8] = {'N', 'I', 'X', 'L', 'C', 'R', 'C', '1'};
+    constexpr size_t integrityFooterLen = sizeof(integrityMagic) + 2 * sizeof(uint32_t);
+    constexpr size_t integrityRangeLen = 2 * sizeof(uint64_t);
+    constexpr uint32_t integrityMaxRanges = 65536;
+
+    bool parseIntegrityTrailer(const nixl_blob_t &msg, uint32_t &crc,
+                               size_t &ranges_off, uint32_t &count) {
+        if (msg.size() < integrityFooterLen)
+            return false;
+        if (memcmp(msg.data() + msg.size() - sizeof(integrityMagic),
+                   integrityMagic, sizeof(integrityMagic)) != 0)
+            return false;
+        const size_t footer_off = msg.size() - integrityFooterLen;
+        memcpy(&count, msg.data() + footer_off, sizeof(uint32_t));
+        memcpy(&crc, msg.data() + footer_off + sizeof(uint32_t), sizeof(uint32_t));
+        const size_t ranges_len = (size_t)count * integrityRangeLen;
+        if ((count > integrityMaxRanges) || (footer_off < ranges_len))
+            return false;
+        ranges_off = footer_off - ranges_len;
+        return true;
+    }
+
+    // Inline-data trailer: (addr u64, len u64, payload bytes) per target
+    // descriptor, then a footer holding the entry count, the full trailer
+    // length (variable payloads rule out a reverse walk) and a magic
+    constexpr char inlineMagic[8] = {'N', 'I', 'X', 'L', 'I', 'N', 'L', '1'};
+    constexpr size_t inlineFooterLen = sizeof(inlineMagic) + 2 * sizeof(uint32_t);
+
+    bool parseInlineTrailer(const nixl_blob_t &msg, size_t &trailer_off,
+                            uint32_t &count) {
+        if (msg.size() < inlineFooterLen)
+            return false;
+        if (memcmp(msg.data() + msg.size() - sizeof(inlineMagic),
+                   inlineMagic, sizeof(inlineMagic)) != 0)
+            return false;
+        const size_t footer_off = msg.size() - inlineFooterLen;
+        uint32_t trailer_len;
+        memcpy(&count, msg.data() + footer_off, sizeof(uint32_t));
+        memcpy(&trailer_len, msg.data() + footer_off + sizeof(uint32_t),
+               sizeof(uint32_t));
+        if ((trailer_len < inlineFooterLen) || (trailer_len > msg.size()))
+            return false;
+        trailer_off = msg.size() - trailer_len;
+        return true;
+    }
+
+    // Relayed transfer control messages, exchanged as whole notifications:
+    // a forward command (initiator -> relay) carries one staged chunk's
+    // ranges and final destination, an ack (relay -> initiator) frees the
+    // staging slot. Both start with their magic for cheap interception.
+    constexpr char relayCmdMagic[8] = {'N', 'I', 'X', 'L', 'R', 'L', 'Y', '1'};
+    constexpr char relayAckMagic[8] = {'N', 'I', 'X', 'L', 'R', 'L', 'A', '1'};
+    // staging addr, staging devId, len, final addr, final devId
+    constexpr size_t relayRangeLen = 5 * sizeof(uint64_t);
+    constexpr uint32_t relayMaxRanges = 65536;
+
+    template<typename T>
+    void relayPack(nixl_blob_t &msg, const T &val) {
+        msg.append(reinterpret_cast<const char *>(&val), sizeof(T));
+    }
+
+    template<typename T>
+    bool relayRead(const nixl_blob_t &msg, size_t &off, T &val) {
+        if (msg.size() - off < sizeof(T))
+            return false;
+        memcpy(&val, msg.data() + off, sizeof(T));
+        off += sizeof(T);
+        return true;
+    }
+
+    bool relayReadStr(const nixl_blob_t &msg, size_t &off, std::string &val) {
+        uint32_t len;
+        if (!relayRead(msg, off, len) || (msg.size() - off < len))
+            return false;
+        val.assign(msg.data() + off, len);
+        off += len;
+        return true;
+    }
+
+    bool isRelayMsg(const nixl_blob_t &msg, const char (&magic)[8]) {
+        return (msg.size() >= sizeof(magic)) &&
+               (memcmp(msg.data(), magic, sizeof(magic)) == 0);
+    }
+} // namespace
+
 /*** nixlEnumStrings namespace implementation in API ***/
 std::string nixlEnumStrings::memTypeStr(const nixl_mem_t &mem) {
     static std::array<std::string, FILE_SEG+1> nixl_mem_str = {
@@ -83,20 +181,31 @@ nixlXferReqH::updateRequestStats(std::unique_ptr<nixlTelemetry> &telemetry_pub,
 
     static const std::array<std::string, 3> nixl_post_status_str = {
         " Posted", " Posted and Completed", " Completed"};
-    auto duration = std::chrono::duration_cast<chrono_period_us_t>(
-        std::chrono::steady_clock::now() - telemetry.startTime);
+    auto now = std::chrono::steady_clock::now();
+    auto duration = std::chrono::duration_cast<chrono_period_us_t>(now - telemetry.startTime);
     if (stat_status == NIXL_TELEMETRY_POST) {
         telemetry.postDuration = duration;
+        telemetry.submitTime = now;
     } else if (stat_status == NIXL_TELEMETRY_POST_AND_FINISH) {
         telemetry.postDuration = duration;
         telemetry.xferDuration = duration;
+        telemetry.submitTime = now;
+        telemetry.lastCompleteTime = now;
     } else { // stat_status == NIXL_TELEMETRY_FINISH
         telemetry.xferDuration = duration;
+        telemetry.lastCompleteTime = now;
     }
+    // A striped request records the first rail completion in
+    // checkBackendStatus; otherwise first and last coincide
+    if (stat_status != NIXL_TELEMETRY_POST &&
+        telemetry.firstCompleteTime == chrono_point_t())
+        telemetry.firstCompleteTime = telemetry.lastCompleteTime;
 
     if (telemetry_pub && (stat_status != NIXL_TELEMETRY_POST)) {
         telemetry_pub->addPostTime(telemetry.postDuration);
-        telemetry_pub->addXferTime(duration, backendOp == NIXL_WRITE, telemetry.totalBytes);
+        telemetry_pub->addXferTime(
+            duration, backendOp == NIXL_WRITE, telemetry.totalBytes, engine->getType());
+        telemetry_pub->addPeerXfer(remoteAgent, backendOp == NIXL_WRITE, telemetry.totalBytes);
     }
 
     NIXL_TRACE << "[NIXL TELEMETRY]: From backend " << engine->getType()
@@ -105,11 +214,140 @@ nixlXferReqH::updateRequestStats(std::unique_ptr<nixlTelemetry> &telemetry_pub,
                << duration.count() << "us.";
 }
 
+nixl_status_t
+nixlXferReqH::checkBackendStatus(const chrono_point_t &deadline) {
+    // The deadline is checked between backend calls, never inside one, so a
+    // budgeted poll costs at most the budget plus one backend progress call
+    auto budget_spent = [&deadline]() {
+        return (deadline != chrono_point_t()) &&
+               (std::chrono::steady_clock::now() >= deadline);
+    };
+
+    if (!isStriped())
+        return engine->checkXfer(backendHandle);
+
+    if (chunked) {
+        // Poll the posted chunks only; unposted ones still carry
+        // NIXL_ERR_NOT_POSTED and are skipped until the pipeline
+        // reaches them
+        for (int i = 0; i < nextChunk; ++i) {
+            nixlXferReqH *child = stripeReqs[i];
+            if (child->status == NIXL_IN_PROG) {
+                child->status = child->engine->checkXfer(child->backendHandle);
+                if (child->status == NIXL_SUCCESS &&
+                    telemetry.firstCompleteTime == chrono_point_t())
+                    telemetry.firstCompleteTime = std::chrono::steady_clock::now();
+            }
+            if (child->status < 0)
+                return child->status;
+            // Unpolled chunks (and the pipeline refill) wait for the
+            // next call; with children unchecked the request cannot
+            // be settled yet
+            if (budget_spent())
+                return NIXL_IN_PROG;
+        }
+
+        // Top the pipeline back up with whatever the completions freed
+        // room for
+        nixl_status_t agg = postChunkWindow();
+        if (agg == NIXL_SUCCESS)
+            sendStripeNotif();
+        return agg;
+    }
+
+    nixl_status_t agg = NIXL_SUCCESS;
+    for (auto &child : stripeReqs) {
+        if (child->status == NIXL_IN_PROG) {
+            child->status = child->engine->checkXfer(child->backendHandle);
+            // First rail observed complete marks the start of the
+            // completion window in the timing breakdown
+            if (child->status == NIXL_SUCCESS &&
+                telemetry.firstCompleteTime == chrono_point_t())
+                telemetry.firstCompleteTime = std::chrono::steady_clock::now();
+        }
+        if (child->status < 0)
+            return child->status;
+        if (child->status == NIXL_IN_PROG)
+            agg = NIXL_IN_PROG;
+        if (budget_spent())
+            return NIXL_IN_PROG;
+    }
+
+    // All rails done, deliver the deferred notification
+    if (agg == NIXL_SUCCESS)
+        sendStripeNotif();
+    return agg;
+}
+
+void
+nixlXferReqH::sendStripeNotif() {
+    if (!hasNotif || notifSent)
+        return;
+
+    nixl_status_t ret = engine->genNotif(remoteAgent, notifMsg);
+    if (ret != NIXL_SUCCESS)
+        NIXL_ERROR << "Failed to send striped transfer notification to agent '"
+                   << remoteAgent << "' with status " << ret;
+    notifSent = true;
+}
+
+// Posts chunk children of an auto-chunked request until chunkPipelineDepth
+// are in flight or all chunks are out, and aggregates the overall status.
+// Called at dispatch and again from checkBackendStatus as posted chunks
+// drain, so the pipeline refills from whichever progress path observes a
+// completion. The notification is held back by the parent, so chunks are
+// posted without it.
+nixl_status_t
+nixlXferReqH::postChunkWindow() {
+    nixl_opt_b_args_t chunk_args;
+    chunk_args.hasNotif = false;
+    chunk_args.trafficClass = trafficClass;
+
+    int inflight = 0;
+    for (int i = 0; i < nextChunk; ++i)
+        if (stripeReqs[i]->status == NIXL_IN_PROG)
+            inflight++;
+
+    while ((nextChunk < static_cast<int>(stripeReqs.size())) &&
+           (inflight < chunkPipelineDepth)) {
+        nixlXferReqH *child = stripeReqs[nextChunk];
+
+        // Chunk-granularity shaping: a drained class bucket pauses the
+        // pipeline here, and the refill is picked up by whichever status
+        // poll next observes the request
+        uint64_t chunk_bytes = 0;
+        for (const auto &desc : *child->initiatorDescs)
+            chunk_bytes += desc.len;
+        if (sched && !sched->classRateTakeChunk(priority, chunk_bytes))
+            break;
+
+        nextChunk++;
+        child->status = child->engine->postXfer(child->backendOp,
+                                                *child->initiatorDescs,
+                                                *child->targetDescs,
+                                                child->remoteAgent,
+                                                child->backendHandle,
+                                                &chunk_args);
+        if (child->status < 0)
+            return child->status;
+        if (child->status == NIXL_IN_PROG)
+            inflight++;
+    }
+
+    if ((nextChunk < static_cast<int>(stripeReqs.size())) || (inflight > 0))
+        return NIXL_IN_PROG;
+    return NIXL_SUCCESS;
+}
+
 /*** nixlAgentData constructor/destructor, as part of nixlAgent's ***/
 nixlAgentData::nixlAgentData(const std::string &name, const nixlAgentConfig &cfg)
     : name(name),
       config(cfg),
-      lock(cfg.syncMode) {
+      lock(cfg.syncMode),
+      instanceId([] {
+          static std::atomic<uint64_t> next_id{1};
+          return next_id.fetch_add(1, std::memory_order_relaxed);
+      }()) {
 #if HAVE_ETCD
     if (getenv("NIXL_ETCD_ENDPOINTS")) {
         useEtcd = true;
@@ -121,10 +359,35 @@ nixlAgentData::nixlAgentData(const std::string &name, const nixlAgentConfig &cfg
 #else
     NIXL_DEBUG << "NIXL ETCD is excluded";
 #endif // HAVE_ETCD
+    if (getenv("NIXL_SHM_MD_ENABLE")) {
+        useShmMD = true;
+        NIXL_DEBUG << "NIXL shared memory metadata exchange is enabled";
+    }
     if (name.empty())
         throw std::invalid_argument("Agent needs a name");
 
+    // Internal buffer arena for the metadata path; configure() is a
+    // process-wide one-shot, further agents reuse the first segment
+    if (cfg.arenaHugePages || (cfg.arenaNumaNode >= 0))
+        nixlMemArena::configure(internalArenaBytes, cfg.arenaHugePages,
+                                cfg.arenaNumaNode);
+
+    // Pinned staging pool is carved out up front so the page faults and
+    // locking happen here rather than on the first staged transfer
+    if (cfg.stagingPoolBytes > 0) {
+        if (stagingPool.init(cfg.stagingPoolBytes))
+            NIXL_DEBUG << "Pinned staging pool of " << stagingPool.size()
+                       << " bytes allocated";
+        else
+            NIXL_WARN << "Failed to allocate " << cfg.stagingPoolBytes
+                      << " byte staging pool, internal staging falls back "
+                         "to on-demand allocation";
+    }
+
     memorySection = new nixlLocalSection();
+    // Publish the initial (empty) snapshot so getRegSnapshot never
+    // observes a null pointer
+    publishRegSnapshot();
     const char *telemetry_env_val = std::getenv(TELEMETRY_ENABLED_VAR);
     const char *telemetry_env_dir = std::getenv(TELEMETRY_DIR_VAR);
 
@@ -134,7 +397,8 @@ nixlAgentData::nixlAgentData(const std::string &name, const nixlAgentConfig &cfg
             telemetryEnabled = true;
             if (telemetry_env_dir != nullptr) {
                 std::string telemetry_file = std::string(telemetry_env_dir) + "/" + name;
-                telemetry_ = std::make_unique<nixlTelemetry>(telemetry_file, backendEngines);
+                telemetry_ = std::make_unique<nixlTelemetry>(
+                    telemetry_file, backendEngines, cfg.telemetryCpuset);
                 NIXL_DEBUG << "NIXL telemetry is enabled with output file: " << telemetry_file;
             } else {
                 NIXL_DEBUG << "NIXL telemetry is enabled without an output file";
@@ -155,19 +419,92 @@ nixlAgentData::nixlAgentData(const std::string &name, const nixlAgentConfig &cfg
         telemetryEnabled = true;
         NIXL_DEBUG << "Capturing NIXL telemetry based on config (without an output file)";
     }
+
+    const char *stall_env = std::getenv(XFER_STALL_TIMEOUT_VAR);
+    if (stall_env != nullptr) {
+        try {
+            xferStallTimeout = std::chrono::milliseconds(std::stoul(stall_env));
+        }
+        catch (const std::exception &) {
+            NIXL_WARN << "Invalid " << XFER_STALL_TIMEOUT_VAR << " value '" << stall_env
+                      << "', keeping " << xferStallTimeout.count() << "ms";
+        }
+    }
+
+    if (cfg.progExecutorThreads > 0)
+        progressExecutor = std::make_unique<nixlProgressExecutor>(
+            cfg.progExecutorThreads, cfg.pthrDelay ? cfg.pthrDelay : 1000, cfg.progressCpuset);
 }
 
 nixlAgentData::~nixlAgentData() {
+    // The tiering worker issues transfers through the agent API, so it
+    // must be gone before any agent state is torn down
+    tiering.reset();
+
+    // Metadata prefetches capture the owning agent; wait them out as well
+    {
+        std::lock_guard<std::mutex> guard(mdPrefetchLock);
+        for (auto &prefetch : mdPrefetches)
+            if (prefetch.valid())
+                prefetch.wait();
+        mdPrefetches.clear();
+    }
+
+    connWarmupStop = true;
+    if (connWarmupThread.joinable())
+        connWarmupThread.join();
+
+    completionThreadStop = true;
+    if (completionThread.joinable())
+        completionThread.join();
+
+    // Staged notifications are flushed before any backend goes away;
+    // removePoller returns only once the flush poller has stopped running
+    if (notifPollerActive) {
+        progressExecutor->removePoller(notifPollerId);
+        notifPollerActive = false;
+    }
+    flushNotifRings();
+
+    // Deferred deregistrations must be flushed before any backend goes
+    // away; removePoller returns only once the reclamation poller is
+    // guaranteed to no longer be running
+    if (reclaimPollerActive) {
+        progressExecutor->removePoller(reclaimPollerId);
+        reclaimPollerActive = false;
+    }
+    drainReclaimQueue();
+
+    // Queued peer invalidations likewise flush before any backend goes away
+    if (invalidatePollerActive) {
+        progressExecutor->removePoller(invalidatePollerId);
+        invalidatePollerActive = false;
+    }
+    reclaimDeadPeers();
+
     delete memorySection;
 
+    if (useShmMD)
+        unlinkLocalMDShm();
+
     // explicitly reset telemetry so i can publish backend events before destroying backends
     telemetry_.reset();
 
     for (auto & elm: remoteSections)
         delete elm.second;
 
+    // Staging slab registrations must be released before their engines go
+    for (auto & elm : stagingPoolMDs)
+        elm.first->deregisterMem(elm.second);
+    stagingPoolMDs.clear();
+
     for (auto & elm: backendEngines) {
         auto& plugin_manager = nixlPluginManager::getInstance();
+
+        // Shared engines are refcounted; only the last agent tears one down
+        if (plugin_manager.releaseSharedEngine(elm.second))
+            continue;
+
         auto plugin_handle = plugin_manager.getPlugin(elm.second->getType());
 
         if (plugin_handle) {
@@ -179,30 +516,167 @@ nixlAgentData::~nixlAgentData() {
     for (auto & elm: backendHandles)
         delete elm.second;
 
+    // Notification queues the user never released
+    for (auto & q : notifQueues)
+        delete q;
 }
 
 /*** nixlAgent implementation ***/
 nixlAgent::nixlAgent(const std::string &name, const nixlAgentConfig &cfg) :
+    nixlAgent(name, cfg, false)
+{
+    if (runInitStage(NIXL_INIT_STAGE_COMM, {}) != NIXL_SUCCESS)
+        throw std::runtime_error("communication setup failed for agent " + name);
+}
+
+nixlAgent::nixlAgent(const std::string &name, const nixlAgentConfig &cfg, bool deferred_init) :
     data(std::make_unique<nixlAgentData>(name, cfg))
 {
-    if(cfg.useListenThread) {
-        int my_port = cfg.listenPort;
-        if(my_port == 0) my_port = default_comm_port;
-        data->listener = new nixlMDStreamListener(my_port);
-        data->listener->setupListener();
+    (void)deferred_init; // stages are driven by the calling constructor/factory
+}
+
+nixl_status_t
+nixlAgent::runInitStage(nixl_init_stage_t stage, const std::vector<nixl_backend_t> &backends) {
+    static const char *stage_names[NIXL_INIT_STAGE_MAX] = {"comm", "plugins", "backends"};
+    nixl_status_t status = NIXL_SUCCESS;
+    auto start = std::chrono::steady_clock::now();
+
+    try {
+        switch (stage) {
+        case NIXL_INIT_STAGE_COMM:
+            if (data->config.useListenThread) {
+                int my_port = data->config.listenPort;
+                if (my_port == 0) my_port = default_comm_port;
+                data->listener = new nixlMDStreamListener(my_port);
+                data->listener->setupListener();
+            }
+
+            if (data->useEtcd || data->config.useListenThread) {
+                data->commWakeupFd = eventfd(0, EFD_NONBLOCK);
+                if (data->commWakeupFd < 0) {
+                    NIXL_ERROR_FUNC << "eventfd creation failed for comm thread";
+                    status = NIXL_ERR_BACKEND;
+                    break;
+                }
+                if (data->config.userDrivenComm) {
+                    // No comm thread: the caller pumps the loop through
+                    // progressControlPlane and waits on getControlPlaneFd
+                    data->setupCommState();
+                } else {
+                    data->commThreadStop = false;
+                    data->commThread =
+                        std::thread(&nixlAgentData::commWorker, data.get(), this);
+                }
+            }
+            break;
+        case NIXL_INIT_STAGE_PLUGINS:
+            // Discovery walks the plugin directories and parses manifests;
+            // engines are only created in the backends stage
+            nixlPluginManager::getInstance().getAvailablePluginNames();
+            break;
+        case NIXL_INIT_STAGE_BACKENDS:
+            for (const auto &type : backends) {
+                nixlBackendH *bknd_hndl = nullptr;
+                nixl_status_t ret = createBackend(type, nixl_b_params_t(), bknd_hndl);
+                if (ret == NIXL_SUCCESS) {
+                    std::lock_guard<std::mutex> guard(data->initLock);
+                    data->stagedBackends.insert(type);
+                } else if (status == NIXL_SUCCESS) {
+                    // Keep creating the remaining backends; the first
+                    // failure becomes the stage status
+                    status = ret;
+                }
+            }
+            break;
+        default:
+            status = NIXL_ERR_INVALID_PARAM;
+            break;
+        }
+    } catch (const std::exception &e) {
+        NIXL_ERROR_FUNC << "init stage '" << stage_names[stage] << "' failed: " << e.what();
+        status = NIXL_ERR_BACKEND;
     }
 
-    if (data->useEtcd || cfg.useListenThread) {
-        data->commThreadStop = false;
-        data->commThread =
-            std::thread(&nixlAgentData::commWorker, data.get(), this);
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    if (data->telemetry_)
+        data->telemetry_->addInitStageTime(stage_names[stage], duration);
+
+    std::lock_guard<std::mutex> guard(data->initLock);
+    auto &stage_state = data->initReport.stages[stage];
+    stage_state.status = status;
+    stage_state.duration = duration;
+    stage_state.done = true;
+    return status;
+}
+
+std::unique_ptr<nixlAgent>
+nixlAgent::constructNonBlocking(const std::string &name,
+                                const nixlAgentConfig &cfg,
+                                const std::vector<nixl_backend_t> &backends) {
+    std::unique_ptr<nixlAgent> agent(new nixlAgent(name, cfg, true));
+    nixlAgent *raw = agent.get();
+
+    std::lock_guard<std::mutex> guard(raw->data->initLock);
+    raw->data->initStarted = true;
+
+    // Comm setup has no ordering dependency on the plugin/backend chain,
+    // so the two run on separate threads; backends wait for discovery
+    raw->data->initThreads.emplace_back(
+        [raw] { raw->runInitStage(NIXL_INIT_STAGE_COMM, {}); });
+    raw->data->initThreads.emplace_back([raw, backends] {
+        raw->runInitStage(NIXL_INIT_STAGE_PLUGINS, {});
+        raw->runInitStage(NIXL_INIT_STAGE_BACKENDS, backends);
+    });
+    return agent;
+}
+
+nixl_status_t
+nixlAgent::checkInit(nixl_init_report_t *report) const {
+    std::lock_guard<std::mutex> guard(data->initLock);
+
+    if (report)
+        *report = data->initReport;
+
+    // Blocking construction finished everything inline
+    if (!data->initStarted)
+        return NIXL_SUCCESS;
+
+    nixl_status_t ret = NIXL_SUCCESS;
+    for (const auto &stage_state : data->initReport.stages) {
+        if (!stage_state.done)
+            return NIXL_IN_PROG;
+        if ((stage_state.status != NIXL_SUCCESS) && (ret == NIXL_SUCCESS))
+            ret = stage_state.status;
     }
+    return ret;
 }
 
 nixlAgent::~nixlAgent() {
+    // Startup threads may still be touching agent state
+    if (data) {
+        for (auto &thread : data->initThreads)
+            if (thread.joinable()) thread.join();
+    }
+
     if (data && (data->useEtcd || data->config.useListenThread)) {
-        data->commThreadStop = true;
-        if(data->commThread.joinable()) data->commThread.join();
+        if (data->config.userDrivenComm) {
+            data->teardownCommState();
+        } else {
+            data->commThreadStop = true;
+            // Wake the comm thread out of epoll_wait so it observes the stop flag
+            if (data->commWakeupFd >= 0) {
+                uint64_t val = 1;
+                if (write(data->commWakeupFd, &val, sizeof(val)) != sizeof(val))
+                    NIXL_PERROR << "failed to wake up comm thread for shutdown";
+            }
+            if(data->commThread.joinable()) data->commThread.join();
+        }
+        if (data->commWakeupFd >= 0) {
+            close(data->commWakeupFd);
+            data->commWakeupFd = -1;
+        }
 
         // Close remaining connections from comm thread
         for (auto &[remote, fd] : data->remoteSockets) {
@@ -219,7 +693,7 @@ nixlAgent::~nixlAgent() {
 nixl_status_t
 nixlAgent::getAvailPlugins (std::vector<nixl_backend_t> &plugins) {
     auto& plugin_manager = nixlPluginManager::getInstance();
-    plugins = plugin_manager.getLoadedPluginNames();
+    plugins = plugin_manager.getAvailablePluginNames();
     return NIXL_SUCCESS;
 }
 
@@ -269,12 +743,26 @@ nixlAgent::getBackendParams (const nixlBackendH* backend,
         return NIXL_ERR_INVALID_PARAM;
     }
 
-    NIXL_LOCK_GUARD(data->lock);
+    NIXL_SHARED_LOCK_GUARD(data->lock);
     mems   = backend->engine->getSupportedMems();
     params = backend->engine->getCustomParams();
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlAgent::getBackendLoad (const nixlBackendH* backend,
+                           nixlBackendLoad &load) const {
+    if (!backend) {
+        NIXL_ERROR_FUNC << "backend handle is not provided";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    // Counters are relaxed atomics on the engine; no agent lock so the
+    // snapshot stays cheap enough to poll from a scheduling loop
+    backend->engine->getLoad(load);
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::createBackend(const nixl_backend_t &type,
                          const nixl_b_params_t &params,
@@ -290,6 +778,13 @@ nixlAgent::createBackend(const nixl_backend_t &type,
     NIXL_LOCK_GUARD(data->lock);
     // Registering same type of backend is not supported, unlikely and prob error
     if (data->backendEngines.count(type) != 0) {
+        // Backends created by the non-blocking init path are handed out
+        // here instead of failing, so apps keep a single creation flow
+        std::lock_guard<std::mutex> init_guard(data->initLock);
+        if (data->stagedBackends.erase(type) != 0) {
+            bknd_hndl = data->backendHandles[type];
+            return NIXL_SUCCESS;
+        }
         NIXL_ERROR_FUNC << "backend already created for type '" << type << "'";
         return NIXL_ERR_INVALID_PARAM;
     }
@@ -315,6 +810,26 @@ nixlAgent::createBackend(const nixl_backend_t &type,
     init_params.pthrDelay = data->config.pthrDelay;
     init_params.syncMode = data->config.syncMode;
     init_params.enableTelemetry_ = data->telemetry_ != nullptr;
+    init_params.progressExecutor = data->progressExecutor.get();
+    init_params.stagingPool = data->stagingPool.active() ? &data->stagingPool : nullptr;
+    init_params.progressCpuset = data->config.progressCpuset;
+
+    // Agents may share one engine instance per process (e.g. one replica
+    // per agent on a dense host), halving NIC and progress thread usage;
+    // the instance is refcounted in the plugin manager. Sibling agents
+    // share the data plane and the engine's notification identity, so
+    // deployments needing per-agent identity should use distinct keys.
+    bool shared_engine = false;
+    bool shared_created = true;
+    std::string share_key;
+    {
+        auto param_it = params.find("shared_engine");
+        if (param_it != params.end())
+            shared_engine = (param_it->second == "true" || param_it->second == "1");
+        param_it = params.find("shared_engine_key");
+        if (param_it != params.end())
+            share_key = param_it->second;
+    }
 
     // First, try to load the backend as a plugin
     auto& plugin_manager = nixlPluginManager::getInstance();
@@ -322,41 +837,60 @@ nixlAgent::createBackend(const nixl_backend_t &type,
 
     if (plugin_handle) {
         // Plugin found, use it to create the backend
-        backend = plugin_handle->createEngine(&init_params);
+        if (shared_engine)
+            backend = plugin_manager.acquireSharedEngine(type, share_key,
+                                                         &init_params, shared_created);
+        else
+            backend = plugin_handle->createEngine(&init_params);
     } else {
         NIXL_ERROR_FUNC << "unsupported backend '" << type << "'";
         return NIXL_ERR_NOT_FOUND;
     }
 
+    // Shared engines must go back through the refcount, not delete
+    auto drop_backend = [&]() {
+        if (shared_engine)
+            plugin_manager.releaseSharedEngine(backend);
+        else
+            delete backend;
+    };
+
     if (backend) {
         if (backend->getInitErr()) {
-            delete backend;
+            drop_backend();
             NIXL_ERROR_FUNC << "backend initialization error for '" << type << "'";
             return NIXL_ERR_BACKEND;
         }
 
-        if (backend->supportsRemote()) {
-            if (!backend->supportsNotif()) {
-                delete backend;
+        if (backend->hasCapability(NIXL_CAP_REMOTE)) {
+            if (!backend->hasCapability(NIXL_CAP_NOTIF)) {
+                drop_backend();
                 NIXL_ERROR_FUNC << "backend '" << type << "' supportsRemote but not notifications";
                 return NIXL_ERR_BACKEND;
             }
 
             ret = backend->getConnInfo(str);
             if (ret != NIXL_SUCCESS) {
-                delete backend;
+                drop_backend();
                 NIXL_ERROR_FUNC << "failed to get connection info for '" << type << "' with status "
                                 << ret;
                 return ret;
             }
             data->connMD[type] = str;
+            // The cached serialized MD embeds the connection info
+            data->cachedLocalMD.reset();
         }
 
-        if (backend->supportsLocal()) {
+        if (backend->hasCapability(NIXL_CAP_LOCAL)) {
+            // A reused shared engine knows only its creator as local; the
+            // other sharing agents register as loopback peers over the
+            // same worker, keeping their own connection namespace
+            if (shared_engine && !shared_created && backend->hasCapability(NIXL_CAP_REMOTE))
+                backend->loadRemoteConnInfo(data->name, str);
             ret = backend->connect(data->name);
 
             if (NIXL_SUCCESS != ret) {
-                delete backend;
+                drop_backend();
                 NIXL_ERROR_FUNC
                     << "backend '" << type
                     << "' encountered error during intra-agent transfer setup with status " << ret;
@@ -366,7 +900,7 @@ nixlAgent::createBackend(const nixl_backend_t &type,
 
         bknd_hndl = new nixlBackendH(backend);
         if (!bknd_hndl) {
-            delete backend;
+            drop_backend();
             NIXL_ERROR_FUNC << "allocation of backend handle failed for '" << type << "'";
             return NIXL_ERR_BACKEND;
         }
@@ -381,7 +915,22 @@ nixlAgent::createBackend(const nixl_backend_t &type,
             backend_list->push_back(backend);
         }
 
-        if (backend->supportsRemote())
+        // Pre-register the staging slab so blocks the backend draws from
+        // the pool are already covered by a registration; a failure only
+        // loses the pre-registration, not the pool itself
+        if (data->stagingPool.active() &&
+            (std::find(mems.begin(), mems.end(), DRAM_SEG) != mems.end())) {
+            nixlBlobDesc slab((uintptr_t)data->stagingPool.base(),
+                              data->stagingPool.size(), 0);
+            nixlBackendMD *slab_md = nullptr;
+            if (backend->registerMem(slab, DRAM_SEG, slab_md) == NIXL_SUCCESS)
+                data->stagingPoolMDs[backend] = slab_md;
+            else
+                NIXL_WARN << "Staging pool registration failed for backend '"
+                          << type << "'";
+        }
+
+        if (backend->hasCapability(NIXL_CAP_REMOTE))
             data->notifEngines.push_back(backend);
 
         // TODO: Check if backend supports ProgThread
@@ -396,6 +945,57 @@ nixlAgent::createBackend(const nixl_backend_t &type,
     return NIXL_ERR_BACKEND;
 }
 
+nixl_status_t
+nixlAgent::reconfigureBackend (nixlBackendH* backend,
+                               const nixl_b_params_t &params) {
+    if (!backend) {
+        NIXL_ERROR_FUNC << "invalid backend handle argument";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    NIXL_LOCK_GUARD(data->lock);
+    const nixl_status_t ret = backend->engine->reconfigure(params);
+    if (ret != NIXL_SUCCESS) {
+        NIXL_ERROR_FUNC << "backend '" << backend->getType()
+                        << "' rejected the runtime reconfiguration with status " << ret;
+        data->addErrorTelemetry(ret);
+        return ret;
+    }
+
+    // Cached plans embed cost estimates made under the previous settings
+    data->invalidateXferPlans();
+    NIXL_INFO << "Reconfigured backend '" << backend->getType() << "' with " << params.size()
+              << " parameter(s)";
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::setXferChunkSize (const nixlBackendH* backend,
+                             size_t max_chunk_bytes) {
+    if (!backend) {
+        NIXL_ERROR_FUNC << "invalid backend handle argument";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    // A tiny ceiling would explode descriptor counts; the agent's chunk
+    // floor is the smallest sensible segmentation granularity
+    if ((max_chunk_bytes != 0) && (max_chunk_bytes < nixlAgentData::chunkMinBytes)) {
+        NIXL_ERROR_FUNC << "chunk size " << max_chunk_bytes << "B is below the minimum of "
+                        << nixlAgentData::chunkMinBytes << "B";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    std::lock_guard<std::mutex> sched_guard(data->schedLock);
+    if (max_chunk_bytes == 0)
+        data->chunkSizeOverride.erase(backend->getType());
+    else
+        data->chunkSizeOverride[backend->getType()] = max_chunk_bytes;
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::queryMem(const nixl_reg_dlist_t &descs,
                     std::vector<nixl_query_resp_t> &resp,
@@ -430,15 +1030,40 @@ nixlAgent::registerMem(const nixl_reg_dlist_t &descs,
             backend_list->push_back(elm->engine);
     }
 
+    // Driver-level registration dominates model-load time and is
+    // independent per backend, so it is fanned out first, one thread per
+    // backend; the shared section bookkeeping then runs serially on the
+    // pre-registered MDs
+    const size_t n_backends = backend_list->size();
+    std::vector<std::vector<nixlBackendMD*>> backend_mds(n_backends);
+    std::vector<nixl_status_t> reg_rets(n_backends, NIXL_SUCCESS);
+    if (n_backends > 1) {
+        std::vector<std::thread> reg_threads;
+        reg_threads.reserve(n_backends);
+        for (size_t i = 0; i < n_backends; ++i)
+            reg_threads.emplace_back([&, i]() {
+                reg_rets[i] = (*backend_list)[i]->registerMems(
+                                  descs, descs.getType(), backend_mds[i]);
+            });
+        for (auto &thread : reg_threads)
+            thread.join();
+    } else {
+        reg_rets[0] = (*backend_list)[0]->registerMems(
+                          descs, descs.getType(), backend_mds[0]);
+    }
+
     // Best effort, if at least one succeeds NIXL_SUCCESS is returned
     // Can become more sophisticated to have a soft error case
     for (size_t i=0; i<backend_list->size(); ++i) {
         nixlBackendEngine* backend = (*backend_list)[i];
+        if (reg_rets[i] != NIXL_SUCCESS)
+            continue;
         // meta_descs use to be passed to loadLocalData
         nixl_sec_dlist_t sec_descs(descs.getType());
-        ret = data->memorySection->addDescList(descs, backend, sec_descs);
+        ret = data->memorySection->addDescList(descs, backend, sec_descs,
+                                               &backend_mds[i]);
         if (ret == NIXL_SUCCESS) {
-            if (backend->supportsLocal()) {
+            if (backend->hasCapability(NIXL_CAP_LOCAL)) {
                 if (data->remoteSections.count(data->name) == 0)
                     data->remoteSections[data->name] =
                           new nixlRemoteSection(data->name);
@@ -459,14 +1084,18 @@ nixlAgent::registerMem(const nixl_reg_dlist_t &descs,
         delete backend_list;
 
     if (count > 0) {
+        data->publishRegSnapshot();
         // sum all the sizes of the descriptors using std::accumulate
-        if (data->telemetry_) {
+        if (data->telemetry_ || data->tiering) {
             uint64_t total_size = std::accumulate(
                 descs.begin(),
                 descs.end(),
                 uint64_t{0},
                 [](uint64_t sum, const nixlBlobDesc &desc) { return sum + desc.len; });
-            data->telemetry_->updateMemoryRegistered(total_size);
+            if (data->telemetry_)
+                data->telemetry_->updateMemoryRegistered(total_size);
+            if (data->tiering)
+                data->tiering->noteUsage(descs.getType(), int64_t(total_size));
         }
         return NIXL_SUCCESS;
     }
@@ -498,20 +1127,48 @@ nixlAgent::deregisterMem(const nixl_reg_dlist_t &descs,
             backend_set.insert(elm->engine);
     }
 
-    // Doing best effort, and returning err if any
+    // Doing best effort, and returning err if any. With deferred
+    // deregistration the regions still leave the section here (so they are
+    // excluded from populate right away), but the backend unmaps are queued
+    // as one reclamation epoch and run on the progress executor instead of
+    // stalling this call
+    const bool deferred = data->config.deferredDereg && data->progressExecutor;
     for (auto & backend : backend_set) {
-        ret = data->memorySection->remDescList(descs, backend);
+        std::vector<nixlBackendMD*> reclaimed;
+        ret = data->memorySection->remDescList(descs, backend,
+                                               deferred ? &reclaimed : nullptr);
         if (ret != NIXL_SUCCESS)
             bad_ret = ret;
+        else if (deferred && !reclaimed.empty()) {
+            std::lock_guard<std::mutex> guard(data->reclaimLock);
+            data->reclaimQueue.emplace_back(backend, std::move(reclaimed));
+        }
+    }
+
+    if (deferred) {
+        std::lock_guard<std::mutex> guard(data->reclaimLock);
+        if (!data->reclaimPollerActive && !data->reclaimQueue.empty()) {
+            nixlAgentData *d = data.get();
+            data->reclaimPollerId =
+                data->progressExecutor->addPoller([d]() { return d->reclaimOneEpoch(); });
+            data->reclaimPollerActive = true;
+        }
     }
+
+    // Cached transfer plans may reference the removed registrations
+    data->invalidateXferPlans();
+    data->publishRegSnapshot();
     if (bad_ret == NIXL_SUCCESS) {
-        if (data->telemetry_) {
+        if (data->telemetry_ || data->tiering) {
             uint64_t total_size = std::accumulate(
                 descs.begin(),
                 descs.end(),
                 uint64_t{0},
                 [](uint64_t sum, const nixlBlobDesc &desc) { return sum + desc.len; });
-            data->telemetry_->updateMemoryDeregistered(total_size);
+            if (data->telemetry_)
+                data->telemetry_->updateMemoryDeregistered(total_size);
+            if (data->tiering)
+                data->tiering->noteUsage(descs.getType(), -int64_t(total_size));
         }
     } else {
         NIXL_ERROR_FUNC << "deregistration failed on at least one backend with status " << bad_ret;
@@ -519,6 +1176,82 @@ nixlAgent::deregisterMem(const nixl_reg_dlist_t &descs,
     return bad_ret;
 }
 
+nixl_reg_snapshot_ptr_t
+nixlAgent::getRegSnapshot() const {
+    // A single acquire load pairs with the release store of the publisher;
+    // no agent lock is taken, so snapshot queries never contend with the
+    // transfer path
+    return std::atomic_load_explicit(&data->regSnapshot, std::memory_order_acquire);
+}
+
+nixl_status_t
+nixlAgent::quiesceMem(const nixl_reg_dlist_t &descs,
+                      const nixl_opt_args_t *extra_params) {
+    std::vector<nixlBackendEngine*> engines;
+
+    {
+        NIXL_SHARED_LOCK_GUARD(data->lock);
+        if (extra_params && !extra_params->backends.empty()) {
+            for (auto &elm : extra_params->backends)
+                engines.push_back(elm->engine);
+        } else {
+            // The range may already have left the memory section, so the
+            // selection goes by what each engine can address, not by what
+            // is currently registered
+            for (auto &elm : data->backendEngines) {
+                nixl_mem_list_t mems = elm.second->getSupportedMems();
+                if (std::find(mems.begin(), mems.end(), descs.getType()) != mems.end())
+                    engines.push_back(elm.second);
+            }
+        }
+    }
+
+    if (engines.empty()) {
+        NIXL_ERROR_FUNC << "no backends to quiesce for mem type '" << descs.getType() << "'";
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    // Queued deferred deregistrations may still hold backend mappings of
+    // the range; run them down before fencing the in-flight transfers
+    data->drainReclaimQueue();
+
+    // Epoch fence: snapshot each engine's monotonic posted counter and wait
+    // until its completed counter catches up. Transfers posted after this
+    // point cannot reference the deregistered range, so they are not waited
+    // for. The counters are relaxed atomics, so the wait never takes the
+    // agent lock and does not contend with the data path.
+    std::vector<uint64_t> fences(engines.size());
+    for (size_t i = 0; i < engines.size(); ++i) {
+        nixlBackendLoad load;
+        engines[i]->getLoad(load);
+        fences[i] = load.postedXfers;
+    }
+
+    const auto timeout = (data->xferStallTimeout.count() > 0) ?
+        data->xferStallTimeout : std::chrono::milliseconds(30000);
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    while (true) {
+        bool pending = false;
+        for (size_t i = 0; i < engines.size(); ++i) {
+            nixlBackendLoad load;
+            engines[i]->getLoad(load);
+            if (load.completedXfers < fences[i]) {
+                pending = true;
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    NIXL_ERROR_FUNC << "backend '" << engines[i]->getType()
+                                    << "' still has transfers in flight after "
+                                    << timeout.count() << "ms";
+                    return NIXL_ERR_BACKEND;
+                }
+            }
+        }
+        if (!pending)
+            return NIXL_SUCCESS;
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+}
+
 nixl_status_t
 nixlAgent::makeConnection(const std::string &remote_agent,
                           const nixl_opt_args_t* extra_params) {
@@ -571,6 +1304,82 @@ nixlAgent::makeConnection(const std::string &remote_agent,
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlAgent::makeConnections(const std::vector<std::string> &remote_agents,
+                           const nixl_opt_args_t* extra_params) {
+    std::vector<nixlBackendH*> backends;
+    if (extra_params)
+        backends = extra_params->backends;
+
+    std::lock_guard<std::mutex> guard(data->connWarmupLock);
+    for (const auto &remote_agent : remote_agents) {
+        // A peer already being warmed up is not queued twice
+        auto it = data->connWarmupStatus.find(remote_agent);
+        if ((it != data->connWarmupStatus.end()) && (it->second == NIXL_IN_PROG))
+            continue;
+        data->connWarmupStatus[remote_agent] = NIXL_IN_PROG;
+        data->connWarmupQueue.emplace_back(remote_agent, backends);
+    }
+
+    if (!data->connWarmupThread.joinable())
+        data->connWarmupThread =
+            std::thread(&nixlAgentData::connWarmupWorker, data.get(), this);
+
+    return NIXL_IN_PROG;
+}
+
+nixl_status_t
+nixlAgent::checkConnections(const std::vector<std::string> &remote_agents) const {
+    nixl_status_t ret = NIXL_SUCCESS;
+
+    std::lock_guard<std::mutex> guard(data->connWarmupLock);
+    for (const auto &remote_agent : remote_agents) {
+        auto it = data->connWarmupStatus.find(remote_agent);
+        if (it == data->connWarmupStatus.end()) {
+            NIXL_ERROR_FUNC << "no connection warmup was requested towards agent '"
+                            << remote_agent << "'";
+            return NIXL_ERR_NOT_FOUND;
+        }
+        if (it->second == NIXL_IN_PROG)
+            ret = NIXL_IN_PROG;
+        else if (it->second != NIXL_SUCCESS)
+            return it->second; // Errors take precedence over pending peers
+    }
+    return ret;
+}
+
+// Establishes queued warmup connections one peer at a time off the user's
+// critical path, reusing the single-peer makeConnection path so engines
+// see the usual agent locking
+void
+nixlAgentData::connWarmupWorker(nixlAgent *myAgent) {
+    while (!connWarmupStop) {
+        std::pair<std::string, std::vector<nixlBackendH*>> entry;
+        bool have_entry = false;
+        {
+            std::lock_guard<std::mutex> guard(connWarmupLock);
+            if (!connWarmupQueue.empty()) {
+                entry = std::move(connWarmupQueue.front());
+                connWarmupQueue.pop_front();
+                have_entry = true;
+            }
+        }
+
+        if (!have_entry) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        nixl_opt_args_t opt_args;
+        opt_args.backends = entry.second;
+        nixl_status_t ret = myAgent->makeConnection(
+            entry.first, entry.second.empty() ? nullptr : &opt_args);
+
+        std::lock_guard<std::mutex> guard(connWarmupLock);
+        connWarmupStatus[entry.first] = ret;
+    }
+}
+
 nixl_status_t
 nixlAgent::prepXferDlist (const std::string &agent_name,
                           const nixl_xfer_dlist_t &descs,
@@ -656,67 +1465,340 @@ nixlAgent::prepXferDlist (const std::string &agent_name,
 }
 
 nixl_status_t
-nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
-                        const nixlDlistH* local_side,
-                        const std::vector<int> &local_indices,
-                        const nixlDlistH* remote_side,
-                        const std::vector<int> &remote_indices,
-                        nixlXferReqH* &req_hndl,
-                        const nixl_opt_args_t* extra_params) const {
-
-    nixl_opt_b_args_t  opt_args;
-    nixl_status_t      ret;
-    int                desc_count = (int) local_indices.size();
-    nixlBackendEngine* backend    = nullptr;
-
-    req_hndl = nullptr;
-
-    if (!local_side || !remote_side) {
-        NIXL_ERROR_FUNC << "local or remote side handle is null";
-        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
-        return NIXL_ERR_INVALID_PARAM;
-    }
+nixlAgent::updateXferDlist (const nixl_xfer_dlist_t &descs,
+                            nixlDlistH* dlist_hndl) const {
+    nixl_status_t ret;
 
-    if ((!local_side->isLocal) || (remote_side->isLocal)) {
-        NIXL_ERROR_FUNC << "invalid sides (local must be local, remote must be remote)";
+    if (!dlist_hndl || dlist_hndl->descs.empty()) {
+        NIXL_ERROR_FUNC << "descriptor list handle is null or empty";
         data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
         return NIXL_ERR_INVALID_PARAM;
     }
 
     NIXL_LOCK_GUARD(data->lock);
-    // The remote was invalidated in between prepXferDlist and this call
-    if (data->remoteSections.count(remote_side->remoteAgent) == 0) {
-        NIXL_ERROR_FUNC << "remote agent '" << remote_side->remoteAgent
-                        << "' was invalidated in between prepXferDlist and this call";
+    if (!dlist_hndl->isLocal &&
+        (data->remoteSections.count(dlist_hndl->remoteAgent) == 0)) {
+        NIXL_ERROR_FUNC << "remote agent '" << dlist_hndl->remoteAgent
+                        << "' was invalidated after the handle was prepared";
         data->addErrorTelemetry(NIXL_ERR_NOT_FOUND);
         return NIXL_ERR_NOT_FOUND;
     }
 
-    if (extra_params && extra_params->backends.size() > 0) {
-        for (auto & elm : extra_params->backends) {
-            if ((local_side->descs.count(elm->engine) > 0) &&
-                (remote_side->descs.count(elm->engine) > 0)) {
-                backend = elm->engine;
-                break;
-            }
-        }
-    } else {
-        for (auto & loc_bknd : local_side->descs) {
-            for (auto & rem_bknd : remote_side->descs) {
-                if (loc_bknd.first == rem_bknd.first) {
-                    backend = loc_bknd.first;
-                    break;
-                }
-            }
-            if (backend)
-                break;
+    nixlMemSection* section = dlist_hndl->isLocal ?
+        static_cast<nixlMemSection*>(data->memorySection) :
+        static_cast<nixlMemSection*>(data->remoteSections[dlist_hndl->remoteAgent]);
+
+    // Backends whose regions no longer cover the new addresses are dropped
+    // from the handle, same as a failed populate during preparation
+    for (auto it = dlist_hndl->descs.begin(); it != dlist_hndl->descs.end();) {
+        ret = section->repopulate(descs, it->first, *it->second);
+        if (ret == NIXL_SUCCESS) {
+            ++it;
+        } else {
+            NIXL_WARN << "Dropping backend '" << it->first->getType()
+                      << "' from the descriptor list handle, re-resolution "
+                         "failed with status " << ret;
+            delete it->second;
+            it = dlist_hndl->descs.erase(it);
         }
     }
 
-    if (!backend) {
-        NIXL_ERROR_FUNC << "could not find a common backend in the specified or "
-                           "available list of backends for the prepped Dlists";
-        return NIXL_ERR_INVALID_PARAM;
+    if (dlist_hndl->descs.empty()) {
+        NIXL_ERROR_FUNC << "no backend could re-resolve the updated descriptors; "
+                           "the handle must be released and prepared anew";
+        data->addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+        return NIXL_ERR_NOT_FOUND;
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::setXferPolicy (const nixl_xfer_policy_cb_t &policy_cb) const {
+    NIXL_LOCK_GUARD(data->lock);
+    data->xferPolicyCb = policy_cb;
+    // Cached plans embed decisions made under the previous policy
+    data->invalidateXferPlans();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::setSendWindow (const std::string &remote_agent,
+                          uint64_t max_inflight_bytes,
+                          const nixl_opt_args_t* extra_params) const {
+    if (remote_agent.empty()) {
+        NIXL_ERROR_FUNC << "invalid empty remote agent name";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    // Backend-specific windows when backends are given, otherwise the
+    // peer-wide window ("" key) that covers all backends
+    std::vector<nixl_backend_t> keys;
+    if (extra_params && !extra_params->backends.empty())
+        for (auto &backend : extra_params->backends)
+            keys.push_back(backend->engine->getType());
+    else
+        keys.push_back("");
+
+    std::lock_guard<std::mutex> sched_guard(data->schedLock);
+    for (auto &key : keys) {
+        if (max_inflight_bytes == 0) {
+            data->sendWindowMax.erase({remote_agent, key});
+            // In-flight charges under the erased key settle through the
+            // clamped release, so the occupancy entry can go as well
+            data->sendWindowUsed.erase({remote_agent, key});
+        } else {
+            data->sendWindowMax[{remote_agent, key}] = max_inflight_bytes;
+        }
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::setClassRate (const nixl_xfer_priority_t &priority,
+                         uint64_t bytes_per_sec,
+                         uint64_t burst_bytes) const {
+    const int cls = static_cast<int>(priority);
+    if ((cls < 0) || (cls > static_cast<int>(nixl_xfer_priority_t::NIXL_XFER_PRIO_LOW))) {
+        NIXL_ERROR_FUNC << "invalid priority class " << cls;
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    std::lock_guard<std::mutex> sched_guard(data->schedLock);
+    auto &bucket = data->classBuckets[cls];
+    const bool was_shaped = (bucket.bytesPerSec != 0);
+    bucket.bytesPerSec = bytes_per_sec;
+    if (bytes_per_sec == 0) {
+        bucket.tokens = 0;
+        bucket.burstBytes = 0;
+        return NIXL_SUCCESS;
+    }
+
+    bucket.burstBytes = burst_bytes ? burst_bytes : bytes_per_sec;
+    if (was_shaped) {
+        // A live rate change keeps the accumulated balance (clamped into
+        // the new burst), so in-flight pacing adapts without a reset glitch
+        bucket.tokens = std::min(bucket.tokens, double(bucket.burstBytes));
+    } else {
+        bucket.tokens = double(bucket.burstBytes);
+        bucket.lastRefill = std::chrono::steady_clock::now();
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::configureTier (const nixl_mem_t &mem_type,
+                          const nixlTierConfig &cfg) const {
+    NIXL_LOCK_GUARD(data->lock);
+    if (!data->tiering)
+        data->tiering = std::make_unique<nixlTieringEngine>(this, data->name);
+    return data->tiering->configureTier(mem_type, cfg);
+}
+
+nixl_status_t
+nixlAgent::designateEvictable (const nixl_xfer_dlist_t &src_descs,
+                               const nixl_xfer_dlist_t &dst_descs) const {
+    NIXL_LOCK_GUARD(data->lock);
+    if (!data->tiering)
+        data->tiering = std::make_unique<nixlTieringEngine>(this, data->name);
+    return data->tiering->designate(src_descs, dst_descs);
+}
+
+nixl_status_t
+nixlAgent::migrateBlocks (const nixl_xfer_dlist_t &src_descs,
+                          const nixl_xfer_dlist_t &dst_descs,
+                          nixlXferReqH* &req_hndl,
+                          const nixl_opt_args_t* extra_params) const {
+    // A migration is a loopback transfer towards this agent itself, going
+    // through the regular path so backend selection, scheduling and
+    // telemetry all apply. Taking the agent lock here would deadlock.
+    req_hndl = nullptr;
+    nixl_status_t ret = createXferReq(NIXL_WRITE, src_descs, dst_descs,
+                                      data->name, req_hndl, extra_params);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    ret = postXferReq(req_hndl, extra_params);
+    if (ret < 0) {
+        releaseXferReq(req_hndl);
+        req_hndl = nullptr;
+    }
+    return ret;
+}
+
+nixl_status_t
+nixlAgent::prefetchBlocks (const nixl_xfer_dlist_t &src_descs,
+                           const nixl_xfer_dlist_t &dst_descs) const {
+    NIXL_LOCK_GUARD(data->lock);
+    if (!data->tiering)
+        data->tiering = std::make_unique<nixlTieringEngine>(this, data->name);
+    return data->tiering->prefetch(src_descs, dst_descs);
+}
+
+nixl_status_t
+nixlAgent::pinBlocks (const nixl_xfer_dlist_t &descs) const {
+    NIXL_LOCK_GUARD(data->lock);
+    if (!data->tiering)
+        data->tiering = std::make_unique<nixlTieringEngine>(this, data->name);
+    return data->tiering->pin(descs);
+}
+
+nixl_status_t
+nixlAgent::unpinBlocks (const nixl_xfer_dlist_t &descs) const {
+    NIXL_LOCK_GUARD(data->lock);
+    if (!data->tiering)
+        return NIXL_SUCCESS;
+    return data->tiering->unpin(descs);
+}
+
+nixl_status_t
+nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
+                        const nixlDlistH* local_side,
+                        const std::vector<int> &local_indices,
+                        const nixlDlistH* remote_side,
+                        const std::vector<int> &remote_indices,
+                        nixlXferReqH* &req_hndl,
+                        const nixl_opt_args_t* extra_params) const {
+
+    nixl_opt_b_args_t  opt_args;
+    nixl_status_t      ret;
+    int                desc_count = (int) local_indices.size();
+    nixlBackendEngine* backend    = nullptr;
+
+    req_hndl = nullptr;
+
+    if (!local_side || !remote_side) {
+        NIXL_ERROR_FUNC << "local or remote side handle is null";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    if ((!local_side->isLocal) || (remote_side->isLocal)) {
+        NIXL_ERROR_FUNC << "invalid sides (local must be local, remote must be remote)";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    NIXL_LOCK_GUARD(data->lock);
+    // The remote was invalidated in between prepXferDlist and this call
+    if (data->remoteSections.count(remote_side->remoteAgent) == 0) {
+        NIXL_ERROR_FUNC << "remote agent '" << remote_side->remoteAgent
+                        << "' was invalidated in between prepXferDlist and this call";
+        data->addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    if (extra_params && extra_params->backends.size() > 0) {
+        for (auto & elm : extra_params->backends) {
+            if ((local_side->descs.count(elm->engine) > 0) &&
+                (remote_side->descs.count(elm->engine) > 0)) {
+                backend = elm->engine;
+                break;
+            }
+        }
+    } else {
+        // Deployment routing policy first: the first ranked backend both
+        // sides were prepped for wins; otherwise the built-in selection
+        // below takes over
+        if (data->xferPolicyCb) {
+            nixlBackendEngine *common = nullptr;
+            for (auto & loc_bknd : local_side->descs) {
+                if (remote_side->descs.count(loc_bknd.first) > 0) {
+                    common = loc_bknd.first;
+                    break;
+                }
+            }
+
+            // Bytes and memory types are taken from any common backend's
+            // prepped lists; lengths are identical across backends prepped
+            // for the same query. Out-of-range indices skip the policy and
+            // are rejected by the validation further down.
+            size_t policy_bytes = 0;
+            bool indices_ok = (common != nullptr);
+            if (common) {
+                nixl_meta_dlist_t *ldescs = local_side->descs.at(common);
+                for (auto & idx : local_indices) {
+                    if ((idx < 0) || (idx >= ldescs->descCount())) {
+                        indices_ok = false;
+                        break;
+                    }
+                    policy_bytes += (*ldescs)[idx].len;
+                }
+            }
+
+            if (indices_ok) {
+                nixlXferPolicyCtx ctx;
+                ctx.op            = operation;
+                ctx.totalBytes    = policy_bytes;
+                ctx.descCount     = desc_count;
+                ctx.localMemType  = local_side->descs.at(common)->getType();
+                ctx.remoteMemType = remote_side->descs.at(common)->getType();
+                ctx.remoteAgent   = remote_side->remoteAgent;
+
+                for (const auto & name : data->xferPolicyCb(ctx)) {
+                    for (auto & loc_bknd : local_side->descs) {
+                        if ((loc_bknd.first->getType() == name) &&
+                            (remote_side->descs.count(loc_bknd.first) > 0)) {
+                            backend = loc_bknd.first;
+                            break;
+                        }
+                    }
+                    if (backend)
+                        break;
+                }
+                if (backend)
+                    NIXL_INFO << "Selected backend: " << backend->getType() << " (policy)";
+            }
+        }
+
+        // Among the backends both sides were prepped for, pick the one
+        // quoting the lowest cost for the full prepped lists (a proxy for
+        // the indexed subset, which is only assembled after selection).
+        // Backends without a cost model keep the map iteration order.
+        if (!backend) {
+            std::chrono::microseconds best_cost{0};
+            bool best_estimated = false;
+
+            for (auto & loc_bknd : local_side->descs) {
+                if (remote_side->descs.count(loc_bknd.first) == 0)
+                    continue;
+
+                std::chrono::microseconds duration{0}, err_margin{0};
+                nixl_cost_t method;
+                bool estimated =
+                    (loc_bknd.first->estimateXferCost(
+                         operation, *loc_bknd.second,
+                         *remote_side->descs.at(loc_bknd.first),
+                         remote_side->remoteAgent, duration, err_margin,
+                         method, extra_params) == NIXL_SUCCESS);
+
+                // Numbers measured on this deployment outrank the
+                // backend's analytical model, and give backends without
+                // any model a quote once their cells have samples
+                size_t cost_bytes = 0;
+                for (int i = 0; i < loc_bknd.second->descCount(); ++i)
+                    cost_bytes += (*loc_bknd.second)[i].len;
+                if (data->lookupXferCost(loc_bknd.first,
+                                         loc_bknd.second->getType(),
+                                         remote_side->descs.at(loc_bknd.first)->getType(),
+                                         cost_bytes, duration, err_margin) == NIXL_SUCCESS)
+                    estimated = true;
+
+                if (!backend || (estimated && !best_estimated) ||
+                    (estimated && best_estimated && (duration < best_cost))) {
+                    backend        = loc_bknd.first;
+                    best_cost      = duration;
+                    best_estimated = estimated;
+                }
+            }
+        }
+    }
+
+    if (!backend) {
+        NIXL_ERROR_FUNC << "could not find a common backend in the specified or "
+                           "available list of backends for the prepped Dlists";
+        return NIXL_ERR_INVALID_PARAM;
     }
 
     nixl_meta_dlist_t* local_descs  = local_side->descs.at(backend);
@@ -754,7 +1836,7 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
         opt_args.hasNotif = true;
     }
 
-    if ((opt_args.hasNotif) && (!backend->supportsNotif())) {
+    if ((opt_args.hasNotif) && (!backend->hasCapability(NIXL_CAP_NOTIF))) {
         NIXL_ERROR_FUNC << "the selected backend '" << backend->getType()
                         << "' does not support notifications";
         return NIXL_ERR_BACKEND;
@@ -816,6 +1898,16 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
     handle->hasNotif = opt_args.hasNotif;
     handle->backendOp = operation;
     handle->status = NIXL_ERR_NOT_POSTED;
+    if (extra_params) {
+        handle->trafficClass = extra_params->trafficClass;
+        if (extra_params->traceCtx.size() > nixlAgentData::traceCtxMaxBytes) {
+            NIXL_ERROR_FUNC << "trace context exceeds " << nixlAgentData::traceCtxMaxBytes
+                            << " bytes";
+            data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+            return NIXL_ERR_INVALID_PARAM;
+        }
+        handle->traceCtx = extra_params->traceCtx;
+    }
 
     if (data->telemetryEnabled) {
         handle->telemetry.totalBytes = total_bytes;
@@ -839,6 +1931,106 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
     return NIXL_SUCCESS;
 }
 
+// Hash of a transfer shape, used as the plan cache key in createXferReq
+static size_t
+hashXferShape(const nixl_xfer_dlist_t &local_descs,
+              const nixl_xfer_dlist_t &remote_descs,
+              const std::string &remote_agent,
+              const nixl_opt_args_t *extra_params) {
+    size_t seed = std::hash<std::string>()(remote_agent);
+    auto combine = [&seed](size_t value) {
+        seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+    };
+    auto combine_dlist = [&combine](const nixl_xfer_dlist_t &descs) {
+        combine(descs.getType());
+        combine(descs.descCount());
+        for (const auto &desc : descs) {
+            combine(desc.addr);
+            combine(desc.len);
+            combine(desc.devId);
+        }
+    };
+
+    combine_dlist(local_descs);
+    combine_dlist(remote_descs);
+
+    if (extra_params)
+        for (const auto &backend : extra_params->backends)
+            combine(std::hash<nixl_backend_t>()(backend->getType()));
+
+    return seed;
+}
+
+void
+nixlAgentData::invalidateXferPlans() {
+    std::lock_guard<std::mutex> cache_lock(xferPlanLock);
+    xferPlanCache.clear();
+}
+
+// Rebuilds the registration snapshot from the local section and swaps it
+// in. Called under the agent lock by the registration mutators; readers
+// load the pointer atomically, so they see either the old or the new
+// snapshot, never a partial one.
+void
+nixlAgentData::publishRegSnapshot() {
+    std::atomic_store_explicit(&regSnapshot,
+                               memorySection->makeSnapshot(++regSnapshotVersion),
+                               std::memory_order_release);
+}
+
+// Deregisters the MDs of one queued reclamation epoch, outside the agent
+// lock; returns whether an epoch was drained so the executor can back off
+// when the queue is empty
+bool
+nixlAgentData::reclaimOneEpoch() {
+    std::pair<nixlBackendEngine*, std::vector<nixlBackendMD*>> epoch;
+    {
+        std::lock_guard<std::mutex> guard(reclaimLock);
+        if (reclaimQueue.empty())
+            return false;
+        epoch = std::move(reclaimQueue.front());
+        reclaimQueue.pop_front();
+    }
+
+    for (auto *md : epoch.second)
+        epoch.first->deregisterMem(md);
+    return true;
+}
+
+void
+nixlAgentData::drainReclaimQueue() {
+    while (reclaimOneEpoch())
+        ;
+}
+
+// Tears one invalidated peer down outside the agent lock: deleting the
+// detached section unloads every cached MD through the backends, then
+// the engines drop their connections to the peer
+void
+nixlAgentData::teardownDeadPeer(nixlDeadPeer &dead) {
+    delete dead.section;
+    dead.section = nullptr;
+    for (auto *engine : dead.engines)
+        engine->disconnect(dead.name);
+}
+
+// Drains every queued peer invalidation in one pass, so a scale-down
+// burst of invalidations is torn down as one batch; returns whether
+// anything was reclaimed so the executor can back off on an empty queue
+bool
+nixlAgentData::reclaimDeadPeers() {
+    std::deque<nixlDeadPeer> batch;
+    {
+        std::lock_guard<std::mutex> guard(invalidateLock);
+        if (invalidateQueue.empty())
+            return false;
+        batch.swap(invalidateQueue);
+    }
+    for (auto &dead : batch)
+        teardownDeadPeer(dead);
+    return true;
+}
+
 nixl_status_t
 nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
                          const nixl_xfer_dlist_t &local_descs,
@@ -849,8 +2041,6 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
     nixl_status_t     ret1, ret2;
     nixl_opt_b_args_t opt_args;
 
-    std::unique_ptr<backend_set_t> backend_set = std::make_unique<backend_set_t>();
-
     req_hndl = nullptr;
 
     NIXL_SHARED_LOCK_GUARD(data->lock);
@@ -876,31 +2066,48 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
         total_bytes += local_descs[i].len;
     }
 
-    if (!extra_params || extra_params->backends.size() == 0) {
-        // Finding backends that support the corresponding memories
-        // locally and remotely, and find the common ones.
-        backend_set_t* local_set =
-            data->memorySection->queryBackends(local_descs.getType());
-        backend_set_t* remote_set =
-            data->remoteSections[remote_agent]->queryBackends(
-                                                remote_descs.getType());
-        if (!local_set || !remote_set) {
-            NIXL_ERROR_FUNC << "no backends found for local or remote for their "
-                               "corresponding memory type";
-            return NIXL_ERR_NOT_FOUND;
+    // Relayed transfers take their own creation path: the remote agent is
+    // reached through a staging area on the relay, not directly
+    if (extra_params && !extra_params->relayAgent.empty())
+        return data->createRelayXfer(operation, local_descs, remote_descs,
+                                     remote_agent, extra_params->relayAgent, req_hndl);
+
+    // Loopback: both sides of a same-agent host-to-host transfer live in
+    // this process, so the post is served by a direct memory copy instead
+    // of a backend round trip. Requests that carry a notification or name
+    // explicit backends keep the regular path; non-DRAM legs do too, since
+    // device copies need a backend to drive them.
+    if ((remote_agent == data->name) &&
+        (local_descs.getType() == DRAM_SEG) && (remote_descs.getType() == DRAM_SEG) &&
+        !(extra_params && (extra_params->hasNotif || !extra_params->backends.empty()))) {
+        std::unique_ptr<nixlXferReqH> handle = std::make_unique<nixlXferReqH>();
+        handle->initiatorDescs = new nixl_meta_dlist_t(local_descs.getType());
+        handle->targetDescs    = new nixl_meta_dlist_t(remote_descs.getType());
+
+        // The copy works on the user's addresses directly; no backend
+        // registration metadata is attached
+        for (int i = 0; i < local_descs.descCount(); ++i) {
+            nixlMetaDesc ldesc(local_descs[i].addr, local_descs[i].len, local_descs[i].devId);
+            nixlMetaDesc rdesc(remote_descs[i].addr, remote_descs[i].len, remote_descs[i].devId);
+            ldesc.metadataP = nullptr;
+            rdesc.metadataP = nullptr;
+            handle->initiatorDescs->addDesc(ldesc);
+            handle->targetDescs->addDesc(rdesc);
         }
 
-        for (auto & elm : *local_set)
-            if (remote_set->count(elm) != 0)
-                backend_set->insert(elm);
+        handle->remoteAgent = remote_agent;
+        handle->backendOp   = operation;
+        handle->status      = NIXL_ERR_NOT_POSTED;
+        handle->loopback    = true;
 
-        if (backend_set->empty()) {
-            NIXL_ERROR_FUNC << "no potential backend found to be able to do the transfer";
-            return NIXL_ERR_NOT_FOUND;
+        data->recordXferSize(total_bytes);
+        if (data->telemetryEnabled) {
+            handle->telemetry.totalBytes = total_bytes;
+            handle->telemetry.descCount  = handle->initiatorDescs->descCount();
         }
-    } else {
-        for (auto & elm : extra_params->backends)
-            backend_set->insert(elm->engine);
+
+        req_hndl = handle.release();
+        return NIXL_SUCCESS;
     }
 
     // TODO: when central KV is supported, add a call to fetchRemoteMD
@@ -912,27 +2119,256 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
 
     handle->targetDescs = new nixl_meta_dlist_t(remote_descs.getType());
 
-    // Currently we loop through and find first local match. Can use a
-    // preference list or more exhaustive search.
-    for (auto & backend : *backend_set) {
-        // If populate fails, it clears the resp before return
-        ret1 = data->memorySection->populate(
-                     local_descs, backend, *handle->initiatorDescs);
-        ret2 = data->remoteSections[remote_agent]->populate(
-                     remote_descs, backend, *handle->targetDescs);
-
-        if ((ret1 == NIXL_SUCCESS) && (ret2 == NIXL_SUCCESS)) {
-            NIXL_INFO << "Selected backend: " << backend->getType();
-            handle->engine = backend;
-            break;
+    // Striping is attempted for large enough transfers when requested;
+    // striped requests bypass the single-engine plan cache
+    const bool try_striping = extra_params && extra_params->enableStriping &&
+        (local_descs.descCount() > 1) &&
+        (total_bytes >= nixlAgentData::stripingMinBytes);
+
+    // Repeat transfer shapes skip backend selection and descriptor matching
+    // through the plan cache; the stored dlists rule out hash collisions
+    const size_t plan_key = hashXferShape(local_descs, remote_descs,
+                                          remote_agent, extra_params);
+    if (!try_striping) {
+        std::lock_guard<std::mutex> cache_lock(data->xferPlanLock);
+        auto plan_it = data->xferPlanCache.find(plan_key);
+        if ((plan_it != data->xferPlanCache.end()) &&
+            (plan_it->second.localDescs == local_descs) &&
+            (plan_it->second.remoteDescs == remote_descs) &&
+            (std::chrono::steady_clock::now() - plan_it->second.createdAt <
+             nixlAgentData::xferPlanReevalPeriod)) {
+            handle->engine          = plan_it->second.engine;
+            *handle->initiatorDescs = plan_it->second.initiatorDescs;
+            *handle->targetDescs    = plan_it->second.targetDescs;
         }
     }
 
     if (!handle->engine) {
-        NIXL_ERROR_FUNC << "no specified or potential backend had the required "
-                           "registrations to be able to do the transfer";
-        data->addErrorTelemetry(NIXL_ERR_NOT_FOUND);
-        return NIXL_ERR_NOT_FOUND;
+        backend_set_t backend_set;
+
+        // Backend probing below runs through thread-local scratch lists,
+        // cleared and reused across calls, so repeat shapes settle into zero
+        // steady-state allocations on this path; only the selected backend's
+        // lists are populated into the handle
+        static thread_local nixl_meta_dlist_t probe_local(DRAM_SEG);
+        static thread_local nixl_meta_dlist_t probe_remote(DRAM_SEG);
+        probe_local  = nixl_meta_dlist_t(local_descs.getType());
+        probe_remote = nixl_meta_dlist_t(remote_descs.getType());
+
+        if (!extra_params || extra_params->backends.size() == 0) {
+            // Finding backends that support the corresponding memories
+            // locally and remotely, and find the common ones.
+            backend_set_t* local_set =
+                data->memorySection->queryBackends(local_descs.getType());
+            backend_set_t* remote_set =
+                data->remoteSections[remote_agent]->queryBackends(
+                                                    remote_descs.getType());
+            if (!local_set || !remote_set) {
+                NIXL_ERROR_FUNC << "no backends found for local or remote for their "
+                                   "corresponding memory type";
+                return NIXL_ERR_NOT_FOUND;
+            }
+
+            for (auto & elm : *local_set)
+                if (remote_set->count(elm) != 0)
+                    backend_set.insert(elm);
+
+            if (backend_set.empty()) {
+                NIXL_ERROR_FUNC << "no potential backend found to be able to do the transfer";
+                return NIXL_ERR_NOT_FOUND;
+            }
+        } else {
+            for (auto & elm : extra_params->backends)
+                backend_set.insert(elm->engine);
+        }
+
+        // Multi-rail striping: collect every backend with the required
+        // registrations on both sides; two or more such rails split the bytes
+        if (try_striping) {
+            // Candidate rails are filtered through the scratch lists first;
+            // per-rail lists are only built once striping is known to apply
+            std::vector<nixlBackendEngine*> rails;
+            for (auto & backend : backend_set) {
+                ret1 = data->memorySection->populate(local_descs, backend, probe_local);
+                ret2 = data->remoteSections[remote_agent]->populate(
+                             remote_descs, backend, probe_remote);
+                if ((ret1 == NIXL_SUCCESS) && (ret2 == NIXL_SUCCESS))
+                    rails.push_back(backend);
+            }
+
+            if (rails.size() > 1) {
+                std::vector<std::unique_ptr<nixl_meta_dlist_t>> rail_local, rail_remote;
+                for (auto & backend : rails) {
+                    auto lmeta = std::make_unique<nixl_meta_dlist_t>(local_descs.getType());
+                    auto rmeta = std::make_unique<nixl_meta_dlist_t>(remote_descs.getType());
+                    data->memorySection->populate(local_descs, backend, *lmeta);
+                    data->remoteSections[remote_agent]->populate(
+                             remote_descs, backend, *rmeta);
+                    rail_local.push_back(std::move(lmeta));
+                    rail_remote.push_back(std::move(rmeta));
+                }
+                // Contiguous byte-balanced partition of the descriptor list;
+                // the last rail picks up the remainder
+                const size_t target = total_bytes / rails.size();
+                int idx = 0;
+                for (size_t r = 0; r < rails.size(); ++r) {
+                    auto child = std::make_unique<nixlXferReqH>();
+                    child->engine         = rails[r];
+                    child->initiatorDescs = new nixl_meta_dlist_t(local_descs.getType());
+                    child->targetDescs    = new nixl_meta_dlist_t(remote_descs.getType());
+                    size_t bytes = 0;
+                    while ((idx < local_descs.descCount()) &&
+                           ((bytes < target) || (r == rails.size() - 1))) {
+                        child->initiatorDescs->addDesc((*rail_local[r])[idx]);
+                        child->targetDescs->addDesc((*rail_remote[r])[idx]);
+                        bytes += local_descs[idx].len;
+                        idx++;
+                    }
+                    if (child->initiatorDescs->descCount() == 0)
+                        continue;
+                    child->remoteAgent = remote_agent;
+                    child->backendOp   = operation;
+                    child->status      = NIXL_ERR_NOT_POSTED;
+                    handle->stripeReqs.push_back(child.release());
+                }
+
+                if (handle->stripeReqs.size() > 1) {
+                    // Parent keeps the first rail's engine for notifications
+                    // and the full populated lists for telemetry
+                    handle->engine          = handle->stripeReqs.front()->engine;
+                    *handle->initiatorDescs = *rail_local[0];
+                    *handle->targetDescs    = *rail_remote[0];
+                    NIXL_INFO << "Striping transfer across "
+                              << handle->stripeReqs.size() << " backends";
+                } else {
+                    for (auto &child : handle->stripeReqs)
+                        delete child;
+                    handle->stripeReqs.clear();
+                }
+            }
+        }
+
+        // Deployment routing policy: the first ranked backend that holds
+        // the required registrations on both sides wins; if none does, the
+        // built-in selection below takes over
+        if (!handle->engine && data->xferPolicyCb) {
+            nixlXferPolicyCtx ctx;
+            ctx.op            = operation;
+            ctx.totalBytes    = total_bytes;
+            ctx.descCount     = local_descs.descCount();
+            ctx.localMemType  = local_descs.getType();
+            ctx.remoteMemType = remote_descs.getType();
+            ctx.remoteAgent   = remote_agent;
+
+            for (const auto & name : data->xferPolicyCb(ctx)) {
+                nixlBackendEngine *ranked = nullptr;
+                for (auto & backend : backend_set) {
+                    if (backend->getType() == name) {
+                        ranked = backend;
+                        break;
+                    }
+                }
+                if (!ranked)
+                    continue;
+
+                // Populated straight into the handle; populate clears the
+                // resp on failure, so a miss leaves the lists empty
+                ret1 = data->memorySection->populate(local_descs, ranked,
+                                                     *handle->initiatorDescs);
+                ret2 = data->remoteSections[remote_agent]->populate(
+                             remote_descs, ranked, *handle->targetDescs);
+                if ((ret1 != NIXL_SUCCESS) || (ret2 != NIXL_SUCCESS))
+                    continue;
+
+                handle->engine = ranked;
+                NIXL_INFO << "Selected backend: " << name << " (policy)";
+                break;
+            }
+        }
+
+        // Cost-driven selection: among the backends holding the required
+        // registrations on both sides, ask each for a cost estimate of this
+        // transfer and pick the cheapest. Backends without a cost model keep
+        // the legacy behavior of first-match, so a lone candidate or a set
+        // of unestimated candidates still selects in iteration order.
+        if (!handle->engine) {
+            std::chrono::microseconds best_cost{0};
+            bool best_estimated = false;
+            nixlBackendEngine *best = nullptr;
+
+            for (auto & backend : backend_set) {
+                // If populate fails, it clears the resp before return
+                ret1 = data->memorySection->populate(local_descs, backend, probe_local);
+                ret2 = data->remoteSections[remote_agent]->populate(
+                             remote_descs, backend, probe_remote);
+                if ((ret1 != NIXL_SUCCESS) || (ret2 != NIXL_SUCCESS))
+                    continue;
+
+                std::chrono::microseconds duration{0}, err_margin{0};
+                nixl_cost_t method;
+                bool estimated =
+                    (backend->estimateXferCost(operation, probe_local,
+                                               probe_remote, remote_agent,
+                                               duration, err_margin, method,
+                                               extra_params) == NIXL_SUCCESS);
+
+                // Measured numbers from this deployment outrank the
+                // backend's analytical model
+                size_t cost_bytes = 0;
+                for (int i = 0; i < probe_local.descCount(); ++i)
+                    cost_bytes += probe_local[i].len;
+                if (data->lookupXferCost(backend,
+                                         probe_local.getType(),
+                                         probe_remote.getType(),
+                                         cost_bytes, duration, err_margin) == NIXL_SUCCESS)
+                    estimated = true;
+
+                // Estimated candidates outrank unestimated ones; among the
+                // estimated the lowest duration wins, otherwise first match
+                const bool better = !best ||
+                    (estimated && !best_estimated) ||
+                    (estimated && best_estimated && (duration < best_cost));
+                if (better) {
+                    best            = backend;
+                    best_cost       = duration;
+                    best_estimated  = estimated;
+                }
+            }
+            if (best) {
+                // Probing already succeeded for this backend under the same
+                // lock, so the winner's populate cannot fail here
+                data->memorySection->populate(local_descs, best,
+                                              *handle->initiatorDescs);
+                data->remoteSections[remote_agent]->populate(
+                             remote_descs, best, *handle->targetDescs);
+                handle->engine = best;
+                NIXL_INFO << "Selected backend: " << best->getType()
+                          << (best_estimated ? " (cost-based)" : " (first match)");
+            }
+        }
+
+        if (!handle->engine) {
+            NIXL_ERROR_FUNC << "no specified or potential backend had the required "
+                               "registrations to be able to do the transfer";
+            data->addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+            return NIXL_ERR_NOT_FOUND;
+        }
+
+        if (!handle->isStriped()) {
+            // Remember the prepared plan for identical re-issues
+            std::lock_guard<std::mutex> cache_lock(data->xferPlanLock);
+            if (data->xferPlanCache.size() >= nixlAgentData::maxXferPlanCacheSize)
+                data->xferPlanCache.clear();
+            auto &plan = data->xferPlanCache
+                             .try_emplace(plan_key, local_descs.getType(), remote_descs.getType())
+                             .first->second;
+            plan.engine         = handle->engine;
+            plan.localDescs     = local_descs;
+            plan.remoteDescs    = remote_descs;
+            plan.initiatorDescs = *handle->initiatorDescs;
+            plan.targetDescs    = *handle->targetDescs;
+            plan.createdAt      = std::chrono::steady_clock::now();
+        }
     }
 
     if (extra_params) {
@@ -943,9 +2379,18 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
 
         if (extra_params->customParam.length() > 0)
             opt_args.customParam = extra_params->customParam;
+
+        handle->trafficClass = extra_params->trafficClass;
+        if (extra_params->traceCtx.size() > nixlAgentData::traceCtxMaxBytes) {
+            NIXL_ERROR_FUNC << "trace context exceeds " << nixlAgentData::traceCtxMaxBytes
+                            << " bytes";
+            data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+            return NIXL_ERR_INVALID_PARAM;
+        }
+        handle->traceCtx = extra_params->traceCtx;
     }
 
-    if (opt_args.hasNotif && (!handle->engine->supportsNotif())) {
+    if (opt_args.hasNotif && (!handle->engine->hasCapability(NIXL_CAP_NOTIF))) {
         NIXL_ERROR_FUNC << "the selected backend '" << handle->engine->getType()
                         << "' does not support notifications";
         data->addErrorTelemetry(NIXL_ERR_BACKEND);
@@ -958,28 +2403,156 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
     handle->notifMsg = opt_args.notifMsg;
     handle->hasNotif = opt_args.hasNotif;
 
+    // Every request's size feeds the histogram behind the adaptive
+    // auto-chunk threshold
+    data->recordXferSize(total_bytes);
+
+    // Auto-chunking: descriptors far above the sizes this agent usually
+    // moves are split into pipeline chunks on the selected engine, reusing
+    // the striping child machinery. Chunks are posted a few at a time (see
+    // postChunkWindow), so one multi-GB shard cannot monopolize the rail
+    // while smaller queued requests wait behind it.
+    if (!handle->isStriped()) {
+        // The adaptive threshold decides when outliers get chunked; the
+        // per-backend ceiling (setXferChunkSize, or the backend's own
+        // advertised limit) caps the size of any single backend op
+        size_t chunk_bytes = data->chunkThreshold();
+        const size_t backend_limit = data->backendChunkLimit(handle->engine);
+        if ((backend_limit != 0) && (backend_limit < chunk_bytes))
+            chunk_bytes = backend_limit;
+        bool oversized = false;
+        for (const auto &desc : *handle->initiatorDescs)
+            if (desc.len > chunk_bytes)
+                oversized = true;
+
+        if (oversized) {
+            auto new_child = [&]() {
+                auto child = std::make_unique<nixlXferReqH>();
+                child->engine         = handle->engine;
+                child->initiatorDescs = new nixl_meta_dlist_t(local_descs.getType());
+                child->targetDescs    = new nixl_meta_dlist_t(remote_descs.getType());
+                child->remoteAgent    = remote_agent;
+                child->backendOp      = operation;
+                child->status         = NIXL_ERR_NOT_POSTED;
+                return child;
+            };
+
+            // Contiguous re-partition into children of up to chunk_bytes;
+            // oversized descriptors are split at chunk boundaries, and a
+            // sub-range keeps the covering registration's metadata
+            auto child = new_child();
+            size_t bytes = 0;
+            for (int i = 0; i < handle->initiatorDescs->descCount(); ++i) {
+                nixlMetaDesc ldesc = (*handle->initiatorDescs)[i];
+                nixlMetaDesc rdesc = (*handle->targetDescs)[i];
+                while (ldesc.len > 0) {
+                    const size_t span = std::min(ldesc.len, chunk_bytes - bytes);
+                    nixlMetaDesc lspan = ldesc;
+                    nixlMetaDesc rspan = rdesc;
+                    lspan.len = span;
+                    rspan.len = span;
+                    child->initiatorDescs->addDesc(lspan);
+                    child->targetDescs->addDesc(rspan);
+                    ldesc.addr += span;
+                    ldesc.len  -= span;
+                    rdesc.addr += span;
+                    rdesc.len  -= span;
+                    bytes += span;
+                    if (bytes == chunk_bytes) {
+                        handle->stripeReqs.push_back(child.release());
+                        child = new_child();
+                        bytes = 0;
+                    }
+                }
+            }
+            if (child->initiatorDescs->descCount() > 0)
+                handle->stripeReqs.push_back(child.release());
+
+            if (handle->stripeReqs.size() > 1) {
+                handle->chunked = true;
+                handle->sched = data.get();
+                NIXL_INFO << "Auto-chunking " << total_bytes << "B transfer into "
+                          << handle->stripeReqs.size() << " chunks of up to "
+                          << chunk_bytes << "B";
+                if (data->telemetry_)
+                    data->telemetry_->updateChunkedRequestsNum(1);
+            } else {
+                for (auto &c : handle->stripeReqs)
+                    delete c;
+                handle->stripeReqs.clear();
+            }
+        }
+    }
+
     if (data->telemetryEnabled) {
         handle->telemetry.totalBytes = total_bytes;
         handle->telemetry.descCount = handle->initiatorDescs->descCount();
     }
 
-    ret1 = handle->engine->prepXfer (handle->backendOp,
-                                     *handle->initiatorDescs,
-                                     *handle->targetDescs,
-                                     handle->remoteAgent,
-                                     handle->backendHandle,
-                                     &opt_args);
-    if (ret1 != NIXL_SUCCESS) {
-        NIXL_ERROR_FUNC << "backend '" << handle->engine->getType()
-                        << "' failed to prepare the transfer request with status " << ret1;
-        data->addErrorTelemetry(ret1);
-        return ret1;
+    if (handle->isStriped()) {
+        // Each rail prepares its own slice; the parent holds the notification
+        // back until all rails complete, so rails are prepared without it
+        nixl_opt_b_args_t rail_args = opt_args;
+        rail_args.hasNotif = false;
+        rail_args.notifMsg.clear();
+        for (auto &child : handle->stripeReqs) {
+            ret1 = child->engine->prepXfer (child->backendOp,
+                                            *child->initiatorDescs,
+                                            *child->targetDescs,
+                                            child->remoteAgent,
+                                            child->backendHandle,
+                                            &rail_args);
+            if (ret1 != NIXL_SUCCESS) {
+                NIXL_ERROR_FUNC << "backend '" << child->engine->getType()
+                                << "' failed to prepare a striped transfer request with status "
+                                << ret1;
+                data->addErrorTelemetry(ret1);
+                return ret1;
+            }
+        }
+    } else {
+        ret1 = handle->engine->prepXfer (handle->backendOp,
+                                         *handle->initiatorDescs,
+                                         *handle->targetDescs,
+                                         handle->remoteAgent,
+                                         handle->backendHandle,
+                                         &opt_args);
+        if (ret1 != NIXL_SUCCESS) {
+            NIXL_ERROR_FUNC << "backend '" << handle->engine->getType()
+                            << "' failed to prepare the transfer request with status " << ret1;
+            data->addErrorTelemetry(ret1);
+            return ret1;
+        }
     }
 
     req_hndl = handle.release();
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlAgent::createStagedXferReq (const nixl_xfer_op_t &operation,
+                                const nixl_xfer_dlist_t &storage_descs,
+                                const nixl_xfer_dlist_t &final_descs,
+                                const nixl_xfer_dlist_t &staging_descs,
+                                const std::string &remote_agent,
+                                nixlXferReqH* &req_hndl,
+                                const nixl_opt_args_t* extra_params) const {
+    req_hndl = nullptr;
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    nixl_status_t ret = data->createStagedXfer(operation, storage_descs, final_descs,
+                                               staging_descs, remote_agent, req_hndl);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    // Carrying over notification to be used at post time
+    if (extra_params && extra_params->hasNotif) {
+        req_hndl->notifMsg = extra_params->notifMsg;
+        req_hndl->hasNotif = true;
+    }
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::estimateXferCost(const nixlXferReqH *req_hndl,
                             std::chrono::microseconds &duration,
@@ -1006,6 +2579,32 @@ nixlAgent::estimateXferCost(const nixlXferReqH *req_hndl,
         return NIXL_ERR_UNKNOWN;
     }
 
+    if (req_hndl->isStriped()) {
+        // Rails run concurrently, so the estimate is the slowest rail's
+        duration   = std::chrono::microseconds(0);
+        err_margin = std::chrono::microseconds(0);
+        for (auto &child : req_hndl->stripeReqs) {
+            std::chrono::microseconds child_dur, child_err;
+            ret = child->engine->estimateXferCost(child->backendOp,
+                                                  *child->initiatorDescs,
+                                                  *child->targetDescs,
+                                                  child->remoteAgent,
+                                                  child->backendHandle,
+                                                  child_dur,
+                                                  child_err,
+                                                  method,
+                                                  extra_params);
+            if (ret != NIXL_SUCCESS) {
+                NIXL_ERROR_FUNC << "backend '" << child->engine->getType()
+                                << "' failed to estimate the transfer cost with status " << ret;
+                return ret;
+            }
+            duration   = std::max(duration, child_dur);
+            err_margin = std::max(err_margin, child_err);
+        }
+        return NIXL_SUCCESS;
+    }
+
     ret = req_hndl->engine->estimateXferCost(req_hndl->backendOp,
                                              *req_hndl->initiatorDescs,
                                              *req_hndl->targetDescs,
@@ -1016,49 +2615,119 @@ nixlAgent::estimateXferCost(const nixlXferReqH *req_hndl,
                                              method,
                                              extra_params);
     if (ret != NIXL_SUCCESS) {
+        // Fall back to cost cells measured from this agent's completed
+        // transfers, so backends without an analytical model still give
+        // a quote once warmed up
+        size_t cost_bytes = 0;
+        for (int i = 0; i < req_hndl->initiatorDescs->descCount(); ++i)
+            cost_bytes += (*req_hndl->initiatorDescs)[i].len;
+        if (data->lookupXferCost(req_hndl->engine,
+                                 req_hndl->initiatorDescs->getType(),
+                                 req_hndl->targetDescs->getType(),
+                                 cost_bytes, duration, err_margin) == NIXL_SUCCESS) {
+            method = nixl_cost_t::MEASURED_AGENT;
+            return NIXL_SUCCESS;
+        }
         NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
                         << "' failed to estimate the transfer cost with status " << ret;
     }
     return ret;
 }
 
+// Shared posting path for postXferReq and postXferReqBatch, to be called
+// with the agent lock already held.
 nixl_status_t
-nixlAgent::postXferReq(nixlXferReqH *req_hndl,
-                       const nixl_opt_args_t* extra_params) const {
+nixlAgentData::postXferReqLocked(nixlXferReqH *req_hndl,
+                                 const nixl_opt_args_t* extra_params) {
     nixl_opt_b_args_t opt_args;
 
     opt_args.hasNotif = false;
 
-    if (!req_hndl) {
-        NIXL_ERROR_FUNC << "transfer request handle is null";
-        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
-        return NIXL_ERR_INVALID_PARAM;
-    }
-
-    if (data->telemetryEnabled) {
-        req_hndl->telemetry.startTime = std::chrono::steady_clock::now();
-    }
-
-    NIXL_SHARED_LOCK_GUARD(data->lock);
     // Check if the remote was invalidated before post/repost
-    if (data->remoteSections.count(req_hndl->remoteAgent) == 0) {
+    if (remoteSections.count(req_hndl->remoteAgent) == 0) {
         NIXL_ERROR_FUNC << "remote agent '" << req_hndl->remoteAgent
                         << "' was invalidated after transfer request creation";
-        data->addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+        addErrorTelemetry(NIXL_ERR_NOT_FOUND);
         return NIXL_ERR_NOT_FOUND;
     }
 
+    // A deferred request is logically in flight and cannot be reposted
+    if (req_hndl->deferred) {
+        NIXL_ERROR_FUNC << "transfer request is deferred by the scheduler "
+                           "and cannot be reposted";
+        return NIXL_ERR_REPOST_ACTIVE;
+    }
+
+    // Same for a request suspended on a dependency predecessor
+    if (req_hndl->depSuspended) {
+        NIXL_ERROR_FUNC << "transfer request is suspended on a predecessor "
+                           "and cannot be reposted";
+        return NIXL_ERR_REPOST_ACTIVE;
+    }
+
+    // Relayed transfers orchestrate their own pipeline, notifications and
+    // flow control; posting (re)starts it
+    if (req_hndl->relay) {
+        if (req_hndl->status == NIXL_IN_PROG) {
+            NIXL_ERROR_FUNC << "relayed transfer request is still in progress "
+                               "and cannot be reposted";
+            return NIXL_ERR_REPOST_ACTIVE;
+        }
+        if (extra_params && extra_params->hasNotif) {
+            req_hndl->notifMsg = extra_params->notifMsg;
+            req_hndl->hasNotif = true;
+        }
+        req_hndl->status = advanceRelay(req_hndl);
+        return req_hndl->status;
+    }
+
+    // Staged transfers likewise run their own two-leg pipeline
+    if (req_hndl->staged) {
+        if (req_hndl->status == NIXL_IN_PROG) {
+            NIXL_ERROR_FUNC << "staged transfer request is still in progress "
+                               "and cannot be reposted";
+            return NIXL_ERR_REPOST_ACTIVE;
+        }
+        if (extra_params && extra_params->hasNotif) {
+            req_hndl->notifMsg = extra_params->notifMsg;
+            req_hndl->hasNotif = true;
+        }
+        req_hndl->status = advanceStaged(req_hndl);
+        return req_hndl->status;
+    }
+
+    // Loopback transfers complete synchronously with a host memory copy;
+    // there is no backend engine behind them, so the notification and
+    // scheduler machinery below does not apply
+    if (req_hndl->loopback) {
+        if (extra_params && extra_params->hasNotif) {
+            NIXL_ERROR_FUNC << "loopback transfer requests have no backend "
+                               "to carry a notification";
+            addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+            return NIXL_ERR_INVALID_PARAM;
+        }
+        if (extra_params) {
+            req_hndl->completionCallback = extra_params->completionCallback;
+            req_hndl->completionEventFd  = extra_params->completionEventFd;
+        }
+        req_hndl->status = runLoopbackCopy(req_hndl);
+        if (telemetryEnabled && (req_hndl->status == NIXL_SUCCESS))
+            req_hndl->updateRequestStats(telemetry_, NIXL_TELEMETRY_POST_AND_FINISH);
+        return req_hndl->status;
+    }
+
     // We can't repost while a request is in progress
     if (req_hndl->status == NIXL_IN_PROG) {
-        req_hndl->status = req_hndl->engine->checkXfer(
-                                     req_hndl->backendHandle);
+        req_hndl->status = req_hndl->checkBackendStatus();
         if (req_hndl->status == NIXL_IN_PROG) {
             NIXL_ERROR_FUNC << "transfer request is still in progress and cannot be reposted";
             return NIXL_ERR_REPOST_ACTIVE;
         }
+        schedXferDone(req_hndl);
+        fireDepSuccessors(req_hndl);
 
         if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
-            data->invalidateRemoteData(req_hndl->remoteAgent);
+            invalidateRemoteData(req_hndl->remoteAgent);
             NIXL_ERROR_FUNC << "remote agent '" << req_hndl->remoteAgent
                             << "' was disconnected after transfer request creation";
             return NIXL_ERR_REMOTE_DISCONNECT;
@@ -1082,84 +2751,2464 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
             req_hndl->hasNotif = false;
             opt_args.hasNotif  = false;
         }
+
+        req_hndl->completionCallback = extra_params->completionCallback;
+        req_hndl->completionEventFd  = extra_params->completionEventFd;
+
+        if (!extra_params->trafficClass.empty())
+            req_hndl->trafficClass = extra_params->trafficClass;
+
+        if (!extra_params->traceCtx.empty()) {
+            if (extra_params->traceCtx.size() > nixlAgentData::traceCtxMaxBytes) {
+                NIXL_ERROR_FUNC << "trace context exceeds " << nixlAgentData::traceCtxMaxBytes
+                                << " bytes";
+                addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+                return NIXL_ERR_INVALID_PARAM;
+            }
+            req_hndl->traceCtx = extra_params->traceCtx;
+        }
     }
 
-    if (opt_args.hasNotif && (!req_hndl->engine->supportsNotif())) {
+    if (opt_args.hasNotif && (!req_hndl->engine->hasCapability(NIXL_CAP_NOTIF))) {
         NIXL_ERROR_FUNC << "the selected backend '" << req_hndl->engine->getType()
                         << "' does not support notifications";
-        data->addErrorTelemetry(NIXL_ERR_BACKEND);
+        addErrorTelemetry(NIXL_ERR_BACKEND);
         return NIXL_ERR_BACKEND;
     }
 
-    // If status is not NIXL_IN_PROG we can repost,
-    req_hndl->status = req_hndl->engine->postXfer(req_hndl->backendOp,
-                                                  *req_hndl->initiatorDescs,
-                                                  *req_hndl->targetDescs,
-                                                  req_hndl->remoteAgent,
-                                                  req_hndl->backendHandle,
-                                                  &opt_args);
+    // Integrity mode rides on the notification; the CRC trailer itself is
+    // appended at dispatch time (see appendIntegrityTrailer)
+    req_hndl->integrity = extra_params && extra_params->enableIntegrity;
+    if (req_hndl->integrity && !opt_args.hasNotif) {
+        NIXL_ERROR_FUNC << "integrity mode requires a notification to carry the checksum";
+        addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
 
-    if (req_hndl->status < 0) {
-        if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
-            NIXL_ERROR_FUNC << "remote agent '" << req_hndl->remoteAgent
-                            << "' was disconnected after transfer request creation";
-            data->invalidateRemoteData(req_hndl->remoteAgent);
-            return NIXL_ERR_REMOTE_DISCONNECT;
-        } else {
-            NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
-                            << "' failed to post the transfer request with status "
-                            << req_hndl->status;
+    // Inline-data hint: small enough WRITEs skip the backend data path and
+    // ship inside the notification; ineligible requests silently take the
+    // regular path since this is an optimization, not a semantic change
+    req_hndl->inlineData = false;
+    if (extra_params && extra_params->enableInlineData) {
+        if (!opt_args.hasNotif) {
+            NIXL_ERROR_FUNC << "inline data mode requires a notification to carry the payload";
+            addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+            return NIXL_ERR_INVALID_PARAM;
         }
+        if ((req_hndl->backendOp == NIXL_WRITE) && !req_hndl->isStriped() &&
+            (req_hndl->initiatorDescs->getType() == DRAM_SEG) &&
+            (req_hndl->targetDescs->getType() == DRAM_SEG)) {
+            size_t total = 0;
+            for (int i = 0; i < req_hndl->initiatorDescs->descCount(); ++i)
+                total += (*req_hndl->initiatorDescs)[i].len;
+            req_hndl->inlineData = (total <= inlineNotifMaxBytes);
+        }
+        if (!req_hndl->inlineData)
+            NIXL_DEBUG << "Inline data requested but request is not eligible, "
+                          "using the regular data path";
     }
 
-    if (data->telemetryEnabled) {
-        if (req_hndl->status < 0) {
-            data->addErrorTelemetry(req_hndl->status);
-        } else if (req_hndl->status == NIXL_IN_PROG) {
-            req_hndl->updateRequestStats(data->telemetry_, NIXL_TELEMETRY_POST);
+    // Dependency edge: suspend the post until the predecessor completes,
+    // then dispatch it from the progress path that observes the completion,
+    // removing the host-side wait between dependent transfers
+    if (extra_params && extra_params->dependsOn) {
+        nixlXferReqH *dep = extra_params->dependsOn;
+        if (dep == req_hndl) {
+            NIXL_ERROR_FUNC << "transfer request cannot depend on itself";
+            addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+            return NIXL_ERR_INVALID_PARAM;
+        }
+        if (dep->status < 0) {
+            NIXL_ERROR_FUNC << "dependency predecessor already finished with error status "
+                            << dep->status;
+            return NIXL_ERR_NOT_POSTED;
+        }
+        if ((dep->status == NIXL_IN_PROG) || dep->deferred || dep->depSuspended) {
+            req_hndl->depSuspended = true;
+            req_hndl->depPredecessor = dep;
+            req_hndl->status = NIXL_IN_PROG;
+            dep->depSuccessors.push_back(req_hndl);
+            // Have the completion thread poll the predecessor, so the edge
+            // fires even if the app never polls it itself
+            watchCompletion(dep);
+            return req_hndl->status;
+        }
+        // Predecessor already completed successfully; post right away
+    }
+
+    // Ordered channel: chain behind the channel's current tail, so posts
+    // on the same (peer, channel id) complete visibly in FIFO order
+    if (extra_params && (extra_params->orderedChannel >= 0)) {
+        if (extra_params->dependsOn) {
+            NIXL_ERROR_FUNC << "orderedChannel cannot be combined with dependsOn";
+            addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+            return NIXL_ERR_INVALID_PARAM;
+        }
+
+        req_hndl->onChannel = true;
+        req_hndl->channelKey = {req_hndl->remoteAgent, extra_params->orderedChannel};
+
+        auto tail_it = channelTails.find(req_hndl->channelKey);
+        nixlXferReqH *tail = (tail_it != channelTails.end()) ? tail_it->second : nullptr;
+
+        if (tail && (tail != req_hndl) && (tail->status < 0)) {
+            // Broken chain: the channel stays wedged on the failed tail
+            // until the application releases it
+            NIXL_ERROR_FUNC << "previous request on ordered channel "
+                            << extra_params->orderedChannel << " towards '"
+                            << req_hndl->remoteAgent << "' finished with error status "
+                            << tail->status;
+            return NIXL_ERR_NOT_POSTED;
+        }
+
+        channelTails[req_hndl->channelKey] = req_hndl;
+        if (tail && (tail != req_hndl) &&
+            ((tail->status == NIXL_IN_PROG) || tail->deferred || tail->depSuspended)) {
+            req_hndl->depSuspended = true;
+            req_hndl->depPredecessor = tail;
+            req_hndl->status = NIXL_IN_PROG;
+            tail->depSuccessors.push_back(req_hndl);
+            watchCompletion(tail);
+            return req_hndl->status;
+        }
+        // Channel idle (or tail settled successfully); post right away
+    }
+
+    // Scheduling class and optional deadline hint for this post
+    req_hndl->priority = extra_params ? extra_params->priority :
+                                        nixl_xfer_priority_t::NIXL_XFER_PRIO_NORMAL;
+    req_hndl->hasDeadline = extra_params && (extra_params->deadline.count() > 0);
+    if (req_hndl->hasDeadline)
+        req_hndl->schedDeadline = std::chrono::steady_clock::now() + extra_params->deadline;
+
+    // Bytes this post will occupy in the destination's send window, if one
+    // is configured; inline-data posts ride the notification channel and
+    // are not windowed
+    req_hndl->windowBytes = 0;
+    if (!req_hndl->inlineData) {
+        if (req_hndl->isStriped()) {
+            for (auto &child : req_hndl->stripeReqs)
+                for (const auto &desc : *child->initiatorDescs)
+                    req_hndl->windowBytes += desc.len;
         } else {
-            req_hndl->updateRequestStats(data->telemetry_, NIXL_TELEMETRY_POST_AND_FINISH);
+            for (const auto &desc : *req_hndl->initiatorDescs)
+                req_hndl->windowBytes += desc.len;
         }
     }
 
-    return req_hndl->status;
+    // Defer posts of a lower class while a strictly higher class is in
+    // flight, posts that would overflow the destination's send window, and
+    // posts of a class whose shaping bucket is drained; deferred requests
+    // are dispatched once the higher classes drain, the window opens up or
+    // the bucket refills, or once their deadline expires
+    {
+        std::lock_guard<std::mutex> sched_guard(schedLock);
+        if (!schedGateClear(req_hndl->priority) || !sendWindowClear(req_hndl) ||
+            !classRateClear(req_hndl->priority)) {
+            req_hndl->deferred = true;
+            req_hndl->status = NIXL_IN_PROG;
+            deferredReqs.push_back(req_hndl);
+            if (telemetry_)
+                telemetry_->updateDeferredRequestsNum(1);
+            return req_hndl->status;
+        }
+    }
+
+    return dispatchXferReqLocked(req_hndl);
 }
 
+// Executes a loopback request as a host memory copy: WRITEs copy initiator
+// to target, READs the reverse. Large transfers are split by flattened byte
+// range across a few helper threads so a multi-GB staging copy is not bound
+// to one core's memcpy bandwidth; small ones stay on the caller's thread.
 nixl_status_t
-nixlAgent::getXferStatus (nixlXferReqH *req_hndl) const {
+nixlAgentData::runLoopbackCopy(nixlXferReqH *req_hndl) {
+    const nixl_meta_dlist_t *src = req_hndl->initiatorDescs;
+    const nixl_meta_dlist_t *dst = req_hndl->targetDescs;
+    if (req_hndl->backendOp == NIXL_READ)
+        std::swap(src, dst);
+
+    size_t total = 0;
+    for (int i = 0; i < src->descCount(); ++i)
+        total += (*src)[i].len;
+
+    // Copies the [begin, end) byte range of the flattened transfer, walking
+    // the descriptor lists in order; src and dst lengths match per index
+    auto copy_span = [&](size_t begin, size_t end) {
+        size_t pos = 0;
+        for (int i = 0; (i < src->descCount()) && (begin < end); ++i) {
+            const size_t len = (*src)[i].len;
+            if (pos + len <= begin) {
+                pos += len;
+                continue;
+            }
+            const size_t off  = begin - pos;
+            const size_t span = std::min(len - off, end - begin);
+            memcpy(reinterpret_cast<void *>((*dst)[i].addr + off),
+                   reinterpret_cast<const void *>((*src)[i].addr + off),
+                   span);
+            begin += span;
+            pos += len;
+        }
+    };
 
-    NIXL_SHARED_LOCK_GUARD(data->lock);
-    // If the status is done, no need to recheck and no state changes.
-    // Same for users incorrectly recalling this method in error/done.
-    if (req_hndl->status == NIXL_IN_PROG) {
-        // Check if the remote was invalidated before completion
-        if (data->remoteSections.count(req_hndl->remoteAgent) == 0) {
-            NIXL_ERROR_FUNC << "remote agent '" << req_hndl->remoteAgent
-                            << "' was invalidated during transfer";
-            return NIXL_ERR_NOT_FOUND;
+    unsigned workers = 1;
+    if (total >= loopbackParallelMinBytes)
+        workers = std::max(1u, std::min(loopbackMaxCopyThreads,
+                                        std::thread::hardware_concurrency()));
+
+    if (workers <= 1) {
+        copy_span(0, total);
+        return NIXL_SUCCESS;
+    }
+
+    // The caller's thread takes the first share, the helpers the rest
+    const size_t share = (total + workers - 1) / workers;
+    std::vector<std::thread> helpers;
+    for (unsigned w = 1; w < workers; ++w)
+        helpers.emplace_back(copy_span, w * share, std::min(total, (w + 1) * share));
+    copy_span(0, share);
+    for (auto &helper : helpers)
+        helper.join();
+
+    return NIXL_SUCCESS;
+}
+
+// Computes CRC32C over the source descriptors and appends the integrity
+// trailer (target ranges + footer) to the notification message. Called at
+// dispatch time, so a repost re-checksums the current source contents.
+nixl_status_t
+nixlAgentData::appendIntegrityTrailer(nixlXferReqH *req_hndl) {
+    if (req_hndl->backendOp != NIXL_WRITE) {
+        NIXL_ERROR_FUNC << "integrity mode is only supported for WRITE transfers";
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+    if ((req_hndl->initiatorDescs->getType() != DRAM_SEG) ||
+        (req_hndl->targetDescs->getType() != DRAM_SEG)) {
+        NIXL_ERROR_FUNC << "integrity mode requires DRAM segments on both sides";
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    const nixl_meta_dlist_t &local  = *req_hndl->initiatorDescs;
+    const nixl_meta_dlist_t &remote = *req_hndl->targetDescs;
+
+    // A repost keeps the notification message; drop the previous trailer
+    // before appending the fresh one
+    {
+        uint32_t old_crc, old_count;
+        size_t old_off;
+        if (parseIntegrityTrailer(req_hndl->notifMsg, old_crc, old_off, old_count))
+            req_hndl->notifMsg.resize(old_off);
+    }
+
+    uint32_t crc = 0;
+    for (int i = 0; i < local.descCount(); ++i)
+        crc = nixlCrc32c(reinterpret_cast<const void*>(local[i].addr),
+                         local[i].len, crc);
+
+    nixl_blob_t &msg = req_hndl->notifMsg;
+    const uint32_t count = (uint32_t)remote.descCount();
+    for (int i = 0; i < remote.descCount(); ++i) {
+        const uint64_t addr = remote[i].addr;
+        const uint64_t len  = remote[i].len;
+        msg.append(reinterpret_cast<const char*>(&addr), sizeof(addr));
+        msg.append(reinterpret_cast<const char*>(&len), sizeof(len));
+    }
+    msg.append(reinterpret_cast<const char*>(&count), sizeof(count));
+    msg.append(reinterpret_cast<const char*>(&crc), sizeof(crc));
+    msg.append(integrityMagic, sizeof(integrityMagic));
+
+    return NIXL_SUCCESS;
+}
+
+// Target side of integrity mode: notifications carrying a CRC trailer are
+// re-checksummed over the written local ranges before delivery, and the
+// trailer is stripped so the application sees the original message. The
+// ranges were produced by a peer that loaded our metadata, so they point
+// at registered memory; a mismatch is logged and counted, the message is
+// still delivered.
+void
+nixlAgentData::checkNotifIntegrity(notif_list_t &notif_list) {
+    for (auto &elm : notif_list) {
+        uint32_t crc, count;
+        size_t ranges_off;
+        if (!parseIntegrityTrailer(elm.second, crc, ranges_off, count))
+            continue;
+
+        uint32_t actual = 0;
+        const char *ranges = elm.second.data() + ranges_off;
+        for (uint32_t i = 0; i < count; ++i) {
+            uint64_t addr, len;
+            memcpy(&addr, ranges + i * integrityRangeLen, sizeof(addr));
+            memcpy(&len, ranges + i * integrityRangeLen + sizeof(addr), sizeof(len));
+            actual = nixlCrc32c(reinterpret_cast<const void*>(addr), len, actual);
         }
 
-        req_hndl->status = req_hndl->engine->checkXfer(req_hndl->backendHandle);
-        if (req_hndl->status < 0) {
-            if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
-                data->invalidateRemoteData(req_hndl->remoteAgent);
-                return NIXL_ERR_REMOTE_DISCONNECT;
-            } else {
-                NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
-                                << "' returned error status " << req_hndl->status;
+        if (actual != crc) {
+            NIXL_ERROR << "Integrity check failed for notification from '"
+                       << elm.first << "': expected CRC32C 0x" << std::hex << crc
+                       << ", computed 0x" << actual << std::dec;
+            addErrorTelemetry(NIXL_ERR_MISMATCH);
+        }
+        elm.second.resize(ranges_off);
+    }
+}
+
+// Small-WRITE fast path: the source payload is packed into a trailer on
+// the notification message and sent through the backend's notification
+// channel instead of posting a transfer; the target copies it into place
+// on its notif path (applyInlineNotifs). Eligibility was checked at post.
+nixl_status_t
+nixlAgentData::sendInlineNotif(nixlXferReqH *req_hndl) {
+    const nixl_meta_dlist_t &local  = *req_hndl->initiatorDescs;
+    const nixl_meta_dlist_t &remote = *req_hndl->targetDescs;
+
+    nixl_blob_t msg = req_hndl->notifMsg;
+    const size_t base_len = msg.size();
+    for (int i = 0; i < local.descCount(); ++i) {
+        const uint64_t addr = remote[i].addr;
+        const uint64_t len  = local[i].len;
+        msg.append(reinterpret_cast<const char*>(&addr), sizeof(addr));
+        msg.append(reinterpret_cast<const char*>(&len), sizeof(len));
+        msg.append(reinterpret_cast<const char*>(local[i].addr), len);
+    }
+    const uint32_t count = (uint32_t)local.descCount();
+    const uint32_t trailer_len =
+        (uint32_t)(msg.size() - base_len) + (uint32_t)inlineFooterLen;
+    msg.append(reinterpret_cast<const char*>(&count), sizeof(count));
+    msg.append(reinterpret_cast<const char*>(&trailer_len), sizeof(trailer_len));
+    msg.append(inlineMagic, sizeof(inlineMagic));
+
+    return req_hndl->engine->genNotif(req_hndl->remoteAgent, msg);
+}
+
+// Target side of inline mode: copy each carried payload into its local
+// destination range, then strip the trailer so the application sees the
+// original notification. Runs before the integrity check, so an inlined
+// message can still carry (and pass) a checksum trailer underneath.
+void
+nixlAgentData::applyInlineNotifs(notif_list_t &notif_list) {
+    for (auto &elm : notif_list) {
+        size_t trailer_off;
+        uint32_t count;
+        if (!parseInlineTrailer(elm.second, trailer_off, count))
+            continue;
+
+        const char *pos = elm.second.data() + trailer_off;
+        const char *end = elm.second.data() + elm.second.size() - inlineFooterLen;
+        bool valid = true;
+        for (uint32_t i = 0; i < count; ++i) {
+            uint64_t addr, len;
+            if (pos + 2 * sizeof(uint64_t) > end) {
+                valid = false;
+                break;
+            }
+            memcpy(&addr, pos, sizeof(addr));
+            memcpy(&len, pos + sizeof(addr), sizeof(len));
+            pos += 2 * sizeof(uint64_t);
+            if (pos + len > end) {
+                valid = false;
+                break;
             }
+            memcpy(reinterpret_cast<void*>(addr), pos, len);
+            pos += len;
         }
-        if (data->telemetryEnabled) {
-            if (req_hndl->status == NIXL_SUCCESS) {
-                req_hndl->updateRequestStats(data->telemetry_, NIXL_TELEMETRY_FINISH);
-            } else if (req_hndl->status < 0) {
-                data->addErrorTelemetry(req_hndl->status);
+        if (!valid) {
+            NIXL_ERROR << "Malformed inline-data trailer in notification from '"
+                       << elm.first << "'";
+            addErrorTelemetry(NIXL_ERR_MISMATCH);
+        }
+        elm.second.resize(trailer_off);
+    }
+}
+
+// Creates a relayed (multi-hop) transfer request: the final target is
+// reached through a DRAM staging area on the relay agent. The descriptor
+// list is cut into chunks fitting half the staging area (double buffer)
+// and pre-split sub-ranges aligned across local/final lists; the pipeline
+// itself starts at post time. To be called with the agent lock held.
+nixl_status_t
+nixlAgentData::createRelayXfer(const nixl_xfer_op_t &operation,
+                               const nixl_xfer_dlist_t &local_descs,
+                               const nixl_xfer_dlist_t &remote_descs,
+                               const std::string &remote_agent,
+                               const std::string &relay_agent,
+                               nixlXferReqH *&req_hndl) {
+    if (operation != NIXL_WRITE) {
+        NIXL_ERROR_FUNC << "relayed transfers only support WRITE operations";
+        addErrorTelemetry(NIXL_ERR_NOT_SUPPORTED);
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+    if (remoteSections.count(relay_agent) == 0) {
+        NIXL_ERROR_FUNC << "metadata for relay agent '" << relay_agent << "' not found";
+        addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    // Hop-one backend: prepped locally for the source memory and holding
+    // the relay's DRAM staging registration, with notification support
+    // for the forward commands
+    backend_set_t *local_set = memorySection->queryBackends(local_descs.getType());
+    backend_set_t *relay_set =
+        remoteSections[relay_agent]->queryBackends(DRAM_SEG);
+    if (!local_set || !relay_set) {
+        NIXL_ERROR_FUNC << "no backends found for the source memory or the relay's DRAM";
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    nixlBackendEngine *engine = nullptr;
+    nixlSectionDesc staging;
+    auto lmeta = std::make_unique<nixl_meta_dlist_t>(local_descs.getType());
+    for (auto &backend : *local_set) {
+        if ((relay_set->count(backend) == 0) || !backend->hasCapability(NIXL_CAP_NOTIF))
+            continue;
+        if (remoteSections[relay_agent]->getStagingDesc(DRAM_SEG, backend, staging) !=
+            NIXL_SUCCESS)
+            continue;
+        if (memorySection->populate(local_descs, backend, *lmeta) == NIXL_SUCCESS) {
+            engine = backend;
+            break;
+        }
+    }
+    if (!engine) {
+        NIXL_ERROR_FUNC << "no common backend with a staging registration on relay agent '"
+                        << relay_agent << "'";
+        addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    const size_t slot_bytes = staging.len / 2;
+    if (slot_bytes == 0) {
+        NIXL_ERROR_FUNC << "staging registration on relay agent '" << relay_agent
+                        << "' is too small";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    auto handle = std::make_unique<nixlXferReqH>();
+    handle->relay = std::make_unique<nixlRelayState>(local_descs.getType(),
+                                                     remote_descs.getType());
+    nixlRelayState &rl = *handle->relay;
+    rl.relayAgent  = relay_agent;
+    rl.finalAgent  = remote_agent;
+    rl.slotBase[0] = staging.addr;
+    rl.slotBase[1] = staging.addr + slot_bytes;
+    rl.slotDevId   = staging.devId;
+    rl.slotBytes   = slot_bytes;
+
+    // Cut into sub-ranges no larger than a slot, aligned across the local
+    // and final lists, then group consecutive sub-ranges into chunks
+    int span_first = 0;
+    size_t chunk_bytes = 0;
+    for (int i = 0; i < lmeta->descCount(); ++i) {
+        size_t done = 0;
+        while (done < (*lmeta)[i].len) {
+            const size_t piece = std::min((*lmeta)[i].len - done, slot_bytes);
+            if (chunk_bytes + piece > slot_bytes) {
+                rl.chunks.push_back({span_first, rl.localDescs.descCount()});
+                span_first = rl.localDescs.descCount();
+                chunk_bytes = 0;
+            }
+            nixlMetaDesc ldesc = (*lmeta)[i];
+            ldesc.addr += done;
+            ldesc.len = piece;
+            rl.localDescs.addDesc(ldesc);
+            rl.finalDescs.addDesc(nixlBasicDesc(remote_descs[i].addr + done,
+                                                piece, remote_descs[i].devId));
+            chunk_bytes += piece;
+            done += piece;
+        }
+    }
+    if (rl.localDescs.descCount() > span_first)
+        rl.chunks.push_back({span_first, rl.localDescs.descCount()});
+
+    handle->engine         = engine;
+    handle->initiatorDescs = new nixl_meta_dlist_t(std::move(*lmeta));
+    handle->targetDescs    = new nixl_meta_dlist_t(DRAM_SEG);
+    handle->remoteAgent    = relay_agent;
+    handle->backendOp      = operation;
+    handle->status         = NIXL_ERR_NOT_POSTED;
+
+    rl.token = relayTokenSeq++;
+    relayPending[rl.token] = handle.get();
+
+    NIXL_INFO << "Created relayed transfer through '" << relay_agent << "' to '"
+              << remote_agent << "' in " << rl.chunks.size() << " chunks over backend "
+              << engine->getType();
+
+    req_hndl = handle.release();
+    return NIXL_SUCCESS;
+}
+
+// Posts hop one of the next chunk into the given free staging slot.
+// To be called with the agent lock held.
+nixl_status_t
+nixlAgentData::postRelayChunk(nixlXferReqH *req_hndl, int slot) {
+    nixlRelayState &rl = *req_hndl->relay;
+    const int chunk = rl.nextChunk;
+    const nixlRelayState::chunkSpan &span = rl.chunks[chunk];
+
+    // Hop-one lists: the chunk's local sub-ranges and their staging
+    // locations, packed back to back from the slot base
+    nixl_meta_dlist_t lmeta(rl.localDescs.getType());
+    nixl_xfer_dlist_t squery(DRAM_SEG);
+    uintptr_t off = 0;
+    for (int i = span.first; i < span.last; ++i) {
+        lmeta.addDesc(rl.localDescs[i]);
+        squery.addDesc(nixlBasicDesc(rl.slotBase[slot] + off,
+                                     rl.localDescs[i].len, rl.slotDevId));
+        off += rl.localDescs[i].len;
+    }
+
+    nixl_meta_dlist_t smeta(DRAM_SEG);
+    nixl_status_t ret =
+        remoteSections[rl.relayAgent]->populate(squery, req_hndl->engine, smeta);
+    if (ret != NIXL_SUCCESS) {
+        NIXL_ERROR_FUNC << "failed to resolve staging ranges on relay agent '"
+                        << rl.relayAgent << "' with status " << ret;
+        return ret;
+    }
+
+    if (rl.slotHandle[slot]) {
+        req_hndl->engine->releaseReqH(rl.slotHandle[slot]);
+        rl.slotHandle[slot] = nullptr;
+    }
+
+    ret = req_hndl->engine->prepXfer(NIXL_WRITE, lmeta, smeta, rl.relayAgent,
+                                     rl.slotHandle[slot]);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+    ret = req_hndl->engine->postXfer(NIXL_WRITE, lmeta, smeta, rl.relayAgent,
+                                     rl.slotHandle[slot]);
+    if (ret < 0)
+        return ret;
+
+    rl.slotChunk[slot] = chunk;
+    rl.slotAwaitingAck[slot] = false;
+    rl.nextChunk++;
+
+    // Immediate completion: hand the chunk to the relay right away
+    if (ret == NIXL_SUCCESS) {
+        ret = sendRelayCmd(req_hndl, slot);
+        if (ret < 0)
+            return ret;
+        rl.slotAwaitingAck[slot] = true;
+    }
+
+    return NIXL_SUCCESS;
+}
+
+// Fills free staging slots with the next chunks; returns the request's
+// aggregate status. To be called with the agent lock held.
+nixl_status_t
+nixlAgentData::advanceRelay(nixlXferReqH *req_hndl) {
+    nixlRelayState &rl = *req_hndl->relay;
+
+    if (rl.failStatus < 0)
+        return rl.failStatus;
+
+    // A repost after full completion restarts the pipeline
+    if ((rl.ackedChunks == (int)rl.chunks.size()) && (rl.nextChunk != 0)) {
+        rl.nextChunk = 0;
+        rl.ackedChunks = 0;
+        relayPending[rl.token] = req_hndl;
+    }
+
+    for (int s = 0; s < 2; ++s) {
+        if (rl.nextChunk >= (int)rl.chunks.size())
+            break;
+        if (rl.slotChunk[s] >= 0)
+            continue;
+        nixl_status_t ret = postRelayChunk(req_hndl, s);
+        if (ret < 0) {
+            rl.failStatus = ret;
+            addErrorTelemetry(ret);
+            return ret;
+        }
+    }
+
+    return (rl.ackedChunks == (int)rl.chunks.size()) ? NIXL_SUCCESS : NIXL_IN_PROG;
+}
+
+// Polls hop one of the occupied slots and hands completed chunks to the
+// relay; acks arrive through processRelayNotifs. To be called with the
+// agent lock held.
+nixl_status_t
+nixlAgentData::progressRelay(nixlXferReqH *req_hndl) {
+    nixlRelayState &rl = *req_hndl->relay;
+
+    if (rl.failStatus < 0)
+        return rl.failStatus;
+
+    for (int s = 0; s < 2; ++s) {
+        if ((rl.slotChunk[s] < 0) || rl.slotAwaitingAck[s])
+            continue;
+        nixl_status_t ret = req_hndl->engine->checkXfer(rl.slotHandle[s]);
+        if (ret == NIXL_IN_PROG)
+            continue;
+        if (ret < 0) {
+            NIXL_ERROR_FUNC << "hop one of relayed transfer failed with status " << ret;
+            rl.failStatus = ret;
+            addErrorTelemetry(ret);
+            return ret;
+        }
+        ret = sendRelayCmd(req_hndl, s);
+        if (ret < 0) {
+            rl.failStatus = ret;
+            addErrorTelemetry(ret);
+            return ret;
+        }
+        rl.slotAwaitingAck[s] = true;
+    }
+
+    return (rl.ackedChunks == (int)rl.chunks.size()) ? NIXL_SUCCESS : NIXL_IN_PROG;
+}
+
+// Sends the forward command for the chunk staged in the given slot: its
+// staging ranges, final destination ranges and, on the last chunk, the
+// user's notification for the final target.
+nixl_status_t
+nixlAgentData::sendRelayCmd(nixlXferReqH *req_hndl, int slot) {
+    nixlRelayState &rl = *req_hndl->relay;
+    const int chunk = rl.slotChunk[slot];
+    const nixlRelayState::chunkSpan &span = rl.chunks[chunk];
+    const bool last = (chunk == (int)rl.chunks.size() - 1);
+
+    nixl_blob_t msg(relayCmdMagic, sizeof(relayCmdMagic));
+    relayPack(msg, rl.token);
+    relayPack(msg, (uint32_t)chunk);
+    relayPack(msg, (uint32_t)rl.chunks.size());
+    relayPack(msg, (uint32_t)rl.finalAgent.size());
+    msg.append(rl.finalAgent);
+    relayPack(msg, (uint32_t)rl.finalDescs.getType());
+    relayPack(msg, (uint8_t)(last && req_hndl->hasNotif));
+    if (last && req_hndl->hasNotif) {
+        relayPack(msg, (uint32_t)req_hndl->notifMsg.size());
+        msg.append(req_hndl->notifMsg);
+    }
+
+    relayPack(msg, (uint32_t)(span.last - span.first));
+    uintptr_t off = 0;
+    for (int i = span.first; i < span.last; ++i) {
+        relayPack(msg, (uint64_t)(rl.slotBase[slot] + off));
+        relayPack(msg, (uint64_t)rl.slotDevId);
+        relayPack(msg, (uint64_t)rl.localDescs[i].len);
+        relayPack(msg, (uint64_t)rl.finalDescs[i].addr);
+        relayPack(msg, (uint64_t)rl.finalDescs[i].devId);
+        off += rl.localDescs[i].len;
+    }
+
+    return req_hndl->engine->genNotif(rl.relayAgent, msg);
+}
+
+// Acks a forwarded chunk back to its initiator, through any notification
+// engine connected to it
+void
+nixlAgentData::sendRelayAck(const std::string &initiator,
+                            uint64_t token,
+                            uint32_t chunk,
+                            nixl_status_t status) {
+    nixl_blob_t msg(relayAckMagic, sizeof(relayAckMagic));
+    relayPack(msg, token);
+    relayPack(msg, chunk);
+    relayPack(msg, (int32_t)status);
+
+    for (auto &eng : notifEngines)
+        if (eng->genNotif(initiator, msg) == NIXL_SUCCESS)
+            return;
+    NIXL_ERROR << "Could not ack relayed chunk " << chunk << " back to initiator '"
+               << initiator << "'";
+}
+
+// Polls the relay-side hop-two forwards and acks completed chunks back to
+// their initiators. To be called with the agent lock held.
+void
+nixlAgentData::progressRelayForwards() {
+    for (auto it = relayForwards.begin(); it != relayForwards.end();) {
+        nixl_status_t ret = it->engine->checkXfer(it->handle);
+        if (ret == NIXL_IN_PROG) {
+            ++it;
+            continue;
+        }
+
+        if ((ret == NIXL_SUCCESS) && it->hasNotif) {
+            nixl_status_t nret = it->engine->genNotif(it->finalAgent, it->notifMsg);
+            if (nret != NIXL_SUCCESS) {
+                NIXL_ERROR << "Failed to deliver relayed notification to '"
+                           << it->finalAgent << "' with status " << nret;
+                ret = nret;
+            }
+        }
+
+        sendRelayAck(it->initiator, it->token, it->chunk, ret);
+        it->engine->releaseReqH(it->handle);
+        it = relayForwards.erase(it);
+    }
+}
+
+// Intercepts relay control messages on the notification path: forward
+// commands start a hop-two transfer on this (relay) agent, acks free the
+// initiator-side staging slot and keep the pipeline moving. Both are
+// consumed here and never reach the application. To be called with the
+// agent lock held.
+void
+nixlAgentData::processRelayNotifs(notif_list_t &notif_list) {
+    for (auto it = notif_list.begin(); it != notif_list.end();) {
+        if (isRelayMsg(it->second, relayAckMagic)) {
+            size_t off = sizeof(relayAckMagic);
+            uint64_t token;
+            uint32_t chunk;
+            int32_t status;
+            if (relayRead(it->second, off, token) && relayRead(it->second, off, chunk) &&
+                relayRead(it->second, off, status)) {
+                auto pending = relayPending.find(token);
+                if (pending != relayPending.end()) {
+                    nixlXferReqH *req = pending->second;
+                    nixlRelayState &rl = *req->relay;
+                    if (status < 0) {
+                        NIXL_ERROR << "Relay agent '" << rl.relayAgent
+                                   << "' failed to forward chunk " << chunk
+                                   << " with status " << status;
+                        rl.failStatus = (nixl_status_t)status;
+                        req->status = rl.failStatus;
+                        relayPending.erase(pending);
+                        addErrorTelemetry(req->status);
+                    } else {
+                        for (int s = 0; s < 2; ++s) {
+                            if ((rl.slotChunk[s] == (int)chunk) && rl.slotAwaitingAck[s]) {
+                                rl.slotChunk[s] = -1;
+                                rl.slotAwaitingAck[s] = false;
+                                rl.ackedChunks++;
+                                break;
+                            }
+                        }
+                        req->status = advanceRelay(req);
+                        if (req->status != NIXL_IN_PROG) {
+                            relayPending.erase(pending);
+                            if (req->hasCompletionSignal())
+                                watchCompletion(req);
+                        }
+                    }
+                }
+            }
+            it = notif_list.erase(it);
+            continue;
+        }
+
+        if (!isRelayMsg(it->second, relayCmdMagic)) {
+            ++it;
+            continue;
+        }
+
+        // Forward command: resolve the staged ranges locally and the final
+        // ranges on the target, then post hop two
+        size_t off = sizeof(relayCmdMagic);
+        uint64_t token;
+        uint32_t chunk, total_chunks, final_mem, count;
+        uint8_t has_notif = 0;
+        std::string final_agent;
+        nixl_blob_t notif_msg;
+        bool valid = relayRead(it->second, off, token) &&
+            relayRead(it->second, off, chunk) && relayRead(it->second, off, total_chunks) &&
+            relayReadStr(it->second, off, final_agent) &&
+            relayRead(it->second, off, final_mem) && relayRead(it->second, off, has_notif);
+        if (valid && has_notif)
+            valid = relayReadStr(it->second, off, notif_msg);
+        if (valid)
+            valid = relayRead(it->second, off, count) && (count <= relayMaxRanges) &&
+                (it->second.size() - off >= (size_t)count * relayRangeLen);
+
+        nixl_status_t fwd_ret = valid ? NIXL_SUCCESS : NIXL_ERR_MISMATCH;
+
+        nixl_xfer_dlist_t squery(DRAM_SEG);
+        nixl_xfer_dlist_t fquery((nixl_mem_t)final_mem);
+        if (valid) {
+            for (uint32_t i = 0; i < count; ++i) {
+                uint64_t saddr, sdev, len, faddr, fdev;
+                relayRead(it->second, off, saddr);
+                relayRead(it->second, off, sdev);
+                relayRead(it->second, off, len);
+                relayRead(it->second, off, faddr);
+                relayRead(it->second, off, fdev);
+                squery.addDesc(nixlBasicDesc(saddr, len, sdev));
+                fquery.addDesc(nixlBasicDesc(faddr, len, fdev));
+            }
+            if (remoteSections.count(final_agent) == 0) {
+                NIXL_ERROR << "Relay command for unknown final agent '" << final_agent << "'";
+                fwd_ret = NIXL_ERR_NOT_FOUND;
+            }
+        }
+
+        if (fwd_ret == NIXL_SUCCESS) {
+            fwd_ret = NIXL_ERR_NOT_FOUND;
+            backend_set_t *local_set = memorySection->queryBackends(DRAM_SEG);
+            backend_set_t *final_set =
+                remoteSections[final_agent]->queryBackends((nixl_mem_t)final_mem);
+            if (local_set && final_set) {
+                for (auto &backend : *local_set) {
+                    if (final_set->count(backend) == 0)
+                        continue;
+                    nixlRelayForward fwd;
+                    fwd.localDescs = std::make_unique<nixl_meta_dlist_t>(DRAM_SEG);
+                    fwd.targetDescs =
+                        std::make_unique<nixl_meta_dlist_t>((nixl_mem_t)final_mem);
+                    if ((memorySection->populate(squery, backend, *fwd.localDescs) !=
+                         NIXL_SUCCESS) ||
+                        (remoteSections[final_agent]->populate(
+                             fquery, backend, *fwd.targetDescs) != NIXL_SUCCESS))
+                        continue;
+
+                    fwd_ret = backend->prepXfer(NIXL_WRITE, *fwd.localDescs,
+                                                *fwd.targetDescs, final_agent, fwd.handle);
+                    if (fwd_ret == NIXL_SUCCESS)
+                        fwd_ret = backend->postXfer(NIXL_WRITE, *fwd.localDescs,
+                                                    *fwd.targetDescs, final_agent,
+                                                    fwd.handle);
+                    if (fwd_ret < 0) {
+                        if (fwd.handle)
+                            backend->releaseReqH(fwd.handle);
+                        break;
+                    }
+
+                    fwd.engine     = backend;
+                    fwd.initiator  = it->first;
+                    fwd.finalAgent = final_agent;
+                    fwd.token      = token;
+                    fwd.chunk      = chunk;
+                    fwd.hasNotif   = has_notif;
+                    fwd.notifMsg   = std::move(notif_msg);
+                    if (fwd_ret == NIXL_SUCCESS) {
+                        // Completed inline; notify and ack right away
+                        if (fwd.hasNotif)
+                            backend->genNotif(fwd.finalAgent, fwd.notifMsg);
+                        sendRelayAck(fwd.initiator, token, chunk, NIXL_SUCCESS);
+                        backend->releaseReqH(fwd.handle);
+                    } else {
+                        relayForwards.push_back(std::move(fwd));
+                        fwd_ret = NIXL_SUCCESS;
+                    }
+                    break;
+                }
             }
         }
+
+        if (fwd_ret != NIXL_SUCCESS) {
+            NIXL_ERROR << "Could not forward relayed chunk " << chunk << " to '"
+                       << final_agent << "' with status " << fwd_ret;
+            addErrorTelemetry(fwd_ret);
+            sendRelayAck(it->first, token, chunk, fwd_ret);
+        }
+
+        it = notif_list.erase(it);
+    }
+}
+
+// Creates a staged (two-leg pipelined) transfer request: data moves
+// between local storage and the final memory through a caller-registered
+// DRAM staging area, with one backend per leg. The storage list is cut
+// into chunks fitting half the staging area (double buffer) and
+// pre-split sub-ranges aligned across the storage/final lists; the
+// pipeline itself starts at post time. To be called with the agent lock
+// held.
+nixl_status_t
+nixlAgentData::createStagedXfer(const nixl_xfer_op_t &operation,
+                                const nixl_xfer_dlist_t &storage_descs,
+                                const nixl_xfer_dlist_t &final_descs,
+                                const nixl_xfer_dlist_t &staging_descs,
+                                const std::string &remote_agent,
+                                nixlXferReqH *&req_hndl) {
+    const nixl_mem_t storage_type = storage_descs.getType();
+    if ((storage_type != FILE_SEG) && (storage_type != BLK_SEG) &&
+        (storage_type != OBJ_SEG)) {
+        NIXL_ERROR_FUNC << "staged transfers require a storage-type descriptor list";
+        addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    if ((staging_descs.getType() != DRAM_SEG) || (staging_descs.descCount() == 0)) {
+        NIXL_ERROR_FUNC << "staged transfers require a DRAM staging descriptor";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    if (storage_descs.descCount() != final_descs.descCount()) {
+        NIXL_ERROR_FUNC << "different descriptor list sizes (storage="
+                        << storage_descs.descCount() << ", final="
+                        << final_descs.descCount() << ")";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    for (int i = 0; i < storage_descs.descCount(); ++i) {
+        if (storage_descs[i].len != final_descs[i].len) {
+            NIXL_ERROR_FUNC << "length mismatch at index " << i;
+            return NIXL_ERR_INVALID_PARAM;
+        }
+    }
+
+    // Both legs run loopback-style against this agent's own sections, so
+    // the agent's metadata must be loaded onto itself (like migrateBlocks)
+    if (remoteSections.count(name) == 0) {
+        NIXL_ERROR_FUNC << "own metadata not loaded; required for the storage leg";
+        addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+        return NIXL_ERR_NOT_FOUND;
+    }
+    if (remoteSections.count(remote_agent) == 0) {
+        NIXL_ERROR_FUNC << "metadata for remote agent '" << remote_agent << "' not found";
+        addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    const size_t slot_bytes = staging_descs[0].len / 2;
+    if (slot_bytes == 0) {
+        NIXL_ERROR_FUNC << "staging descriptor is too small to double buffer";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    backend_set_t *staging_set = memorySection->queryBackends(DRAM_SEG);
+    backend_set_t *storage_set = remoteSections[name]->queryBackends(storage_type);
+    backend_set_t *final_set =
+        remoteSections[remote_agent]->queryBackends(final_descs.getType());
+    if (!staging_set || !storage_set || !final_set) {
+        NIXL_ERROR_FUNC << "no backends found for the staging, storage or final memory";
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    // One backend per leg, each holding the staging registration locally
+    // and its far side's descriptors
+    nixl_xfer_dlist_t probe_staging(DRAM_SEG);
+    probe_staging.addDesc(nixlBasicDesc(staging_descs[0].addr, slot_bytes,
+                                        staging_descs[0].devId));
+
+    nixlBackendEngine *storage_engine = nullptr;
+    auto smeta = std::make_unique<nixl_meta_dlist_t>(storage_type);
+    for (auto &backend : *staging_set) {
+        if (storage_set->count(backend) == 0)
+            continue;
+        nixl_meta_dlist_t probe_meta(DRAM_SEG);
+        if (memorySection->populate(probe_staging, backend, probe_meta) != NIXL_SUCCESS)
+            continue;
+        if (remoteSections[name]->populate(storage_descs, backend, *smeta) ==
+            NIXL_SUCCESS) {
+            storage_engine = backend;
+            break;
+        }
+    }
+    if (!storage_engine) {
+        NIXL_ERROR_FUNC << "no backend holds both the staging area and the "
+                           "storage descriptors";
+        addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    nixlBackendEngine *final_engine = nullptr;
+    for (auto &backend : *staging_set) {
+        if (final_set->count(backend) == 0)
+            continue;
+        nixl_meta_dlist_t probe_meta(DRAM_SEG);
+        if (memorySection->populate(probe_staging, backend, probe_meta) != NIXL_SUCCESS)
+            continue;
+        nixl_meta_dlist_t fmeta(final_descs.getType());
+        if (remoteSections[remote_agent]->populate(final_descs, backend, fmeta) ==
+            NIXL_SUCCESS) {
+            final_engine = backend;
+            break;
+        }
+    }
+    if (!final_engine) {
+        NIXL_ERROR_FUNC << "no backend holds both the staging area and the final "
+                           "descriptors on '" << remote_agent << "'";
+        addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    auto handle = std::make_unique<nixlXferReqH>();
+    handle->staged = std::make_unique<nixlStagedState>(storage_type,
+                                                       final_descs.getType());
+    nixlStagedState &st = *handle->staged;
+    st.storageEngine = storage_engine;
+    st.finalEngine   = final_engine;
+    st.finalAgent    = remote_agent;
+    st.slotBase[0]   = staging_descs[0].addr;
+    st.slotBase[1]   = staging_descs[0].addr + slot_bytes;
+    st.slotDevId     = staging_descs[0].devId;
+    st.slotBytes     = slot_bytes;
+
+    // Cut into sub-ranges no larger than a slot, aligned across the
+    // storage and final lists, then group consecutive sub-ranges into
+    // chunks
+    int span_first = 0;
+    size_t chunk_bytes = 0;
+    for (int i = 0; i < smeta->descCount(); ++i) {
+        size_t done = 0;
+        while (done < (*smeta)[i].len) {
+            const size_t piece = std::min((*smeta)[i].len - done, slot_bytes);
+            if (chunk_bytes + piece > slot_bytes) {
+                st.chunks.push_back({span_first, st.storageDescs.descCount()});
+                span_first = st.storageDescs.descCount();
+                chunk_bytes = 0;
+            }
+            nixlMetaDesc sdesc = (*smeta)[i];
+            sdesc.addr += done;
+            sdesc.len = piece;
+            st.storageDescs.addDesc(sdesc);
+            st.finalDescs.addDesc(nixlBasicDesc(final_descs[i].addr + done,
+                                                piece, final_descs[i].devId));
+            chunk_bytes += piece;
+            done += piece;
+        }
+    }
+    if (st.storageDescs.descCount() > span_first)
+        st.chunks.push_back({span_first, st.storageDescs.descCount()});
+
+    handle->engine         = storage_engine;
+    handle->initiatorDescs = new nixl_meta_dlist_t(std::move(*smeta));
+    handle->targetDescs    = new nixl_meta_dlist_t(final_descs.getType());
+    handle->remoteAgent    = remote_agent;
+    handle->backendOp      = operation;
+    handle->status         = NIXL_ERR_NOT_POSTED;
+
+    NIXL_INFO << "Created staged transfer between "
+              << nixlEnumStrings::memTypeStr(storage_type) << " storage and '"
+              << remote_agent << "' in " << st.chunks.size() << " chunks over backends "
+              << storage_engine->getType() << " and " << final_engine->getType();
+
+    req_hndl = handle.release();
+    return NIXL_SUCCESS;
+}
+
+// Posts one leg of a chunk through the given staging slot: the producer
+// leg (draining false) reads the next chunk into the slot, the consumer
+// leg (draining true) writes the slot's chunk out. Which engine serves
+// which leg depends on the transfer direction. To be called with the
+// agent lock held.
+nixl_status_t
+nixlAgentData::postStagedLeg(nixlXferReqH *req_hndl, int slot, bool draining) {
+    nixlStagedState &st = *req_hndl->staged;
+    const int chunk = draining ? st.slotChunk[slot] : st.nextChunk;
+    const nixlStagedState::chunkSpan &span = st.chunks[chunk];
+
+    // The producer always READs into staging and the consumer always
+    // WRITEs out of it; on a READ the storage engine produces, on a
+    // WRITE it consumes
+    const nixl_xfer_op_t leg_op = draining ? NIXL_WRITE : NIXL_READ;
+    const bool storage_leg = (req_hndl->backendOp == NIXL_READ) != draining;
+    nixlBackendEngine *engine = storage_leg ? st.storageEngine : st.finalEngine;
+    const std::string &agent = storage_leg ? name : st.finalAgent;
+
+    // Local side: the chunk's staging ranges, packed back to back from
+    // the slot base
+    nixl_xfer_dlist_t squery(DRAM_SEG);
+    uintptr_t off = 0;
+    for (int i = span.first; i < span.last; ++i) {
+        squery.addDesc(nixlBasicDesc(st.slotBase[slot] + off,
+                                     st.storageDescs[i].len, st.slotDevId));
+        off += st.storageDescs[i].len;
+    }
+
+    nixl_meta_dlist_t lmeta(DRAM_SEG);
+    nixl_status_t ret = memorySection->populate(squery, engine, lmeta);
+    if (ret != NIXL_SUCCESS) {
+        NIXL_ERROR_FUNC << "failed to resolve staging ranges for backend '"
+                        << engine->getType() << "' with status " << ret;
+        return ret;
+    }
+
+    // Far side: the storage sub-ranges were populated at creation time
+    // with the storage engine; the final ranges resolve per chunk
+    nixl_meta_dlist_t rmeta(storage_leg ? st.storageDescs.getType() :
+                                          st.finalDescs.getType());
+    if (storage_leg) {
+        for (int i = span.first; i < span.last; ++i)
+            rmeta.addDesc(st.storageDescs[i]);
+    } else {
+        nixl_xfer_dlist_t fquery(st.finalDescs.getType());
+        for (int i = span.first; i < span.last; ++i)
+            fquery.addDesc(st.finalDescs[i]);
+        ret = remoteSections[st.finalAgent]->populate(fquery, engine, rmeta);
+        if (ret != NIXL_SUCCESS) {
+            NIXL_ERROR_FUNC << "failed to resolve final ranges on '" << st.finalAgent
+                            << "' with status " << ret;
+            return ret;
+        }
+    }
+
+    if (st.slotHandle[slot]) {
+        st.slotEngine[slot]->releaseReqH(st.slotHandle[slot]);
+        st.slotHandle[slot] = nullptr;
+    }
+
+    ret = engine->prepXfer(leg_op, lmeta, rmeta, agent, st.slotHandle[slot]);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+    ret = engine->postXfer(leg_op, lmeta, rmeta, agent, st.slotHandle[slot]);
+    if (ret < 0)
+        return ret;
+
+    st.slotEngine[slot] = engine;
+    st.slotDraining[slot] = draining;
+    if (!draining) {
+        st.slotChunk[slot] = chunk;
+        st.nextChunk++;
+    }
+
+    // Immediate completion: flip straight to the consumer leg, or retire
+    // the chunk if this was it
+    if (ret == NIXL_SUCCESS) {
+        if (!draining)
+            return postStagedLeg(req_hndl, slot, true);
+        completeStagedChunk(req_hndl, slot);
+    }
+
+    return NIXL_SUCCESS;
+}
+
+// Retires the chunk whose consumer leg finished in the given slot and
+// frees the slot; the user notification goes out once, after the last
+// chunk has landed. To be called with the agent lock held.
+void
+nixlAgentData::completeStagedChunk(nixlXferReqH *req_hndl, int slot) {
+    nixlStagedState &st = *req_hndl->staged;
+
+    if (st.slotHandle[slot]) {
+        st.slotEngine[slot]->releaseReqH(st.slotHandle[slot]);
+        st.slotHandle[slot] = nullptr;
+    }
+    st.slotChunk[slot] = -1;
+    st.slotDraining[slot] = false;
+    st.doneChunks++;
+
+    if ((st.doneChunks == (int)st.chunks.size()) && req_hndl->hasNotif &&
+        !req_hndl->notifSent) {
+        nixl_status_t ret = st.finalEngine->genNotif(st.finalAgent,
+                                                     req_hndl->notifMsg);
+        if (ret < 0) {
+            NIXL_ERROR_FUNC << "failed to deliver staged transfer notification "
+                               "with status " << ret;
+            addErrorTelemetry(ret);
+        } else {
+            req_hndl->notifSent = true;
+        }
+    }
+}
+
+// Fills free staging slots with producer legs of the next chunks;
+// returns the request's aggregate status. To be called with the agent
+// lock held.
+nixl_status_t
+nixlAgentData::advanceStaged(nixlXferReqH *req_hndl) {
+    nixlStagedState &st = *req_hndl->staged;
+
+    if (st.failStatus < 0)
+        return st.failStatus;
+
+    // A repost after full completion restarts the pipeline
+    if ((st.doneChunks == (int)st.chunks.size()) && (st.nextChunk != 0)) {
+        st.nextChunk = 0;
+        st.doneChunks = 0;
+        req_hndl->notifSent = false;
+    }
+
+    for (int s = 0; s < 2; ++s) {
+        if (st.nextChunk >= (int)st.chunks.size())
+            break;
+        if (st.slotChunk[s] >= 0)
+            continue;
+        nixl_status_t ret = postStagedLeg(req_hndl, s, false);
+        if (ret < 0) {
+            st.failStatus = ret;
+            addErrorTelemetry(ret);
+            return ret;
+        }
+    }
+
+    return (st.doneChunks == (int)st.chunks.size()) ? NIXL_SUCCESS : NIXL_IN_PROG;
+}
+
+// Polls the in-flight legs of the occupied slots: a finished producer
+// leg flips to its consumer leg, a finished consumer leg retires the
+// chunk and the freed slot is refilled. To be called with the agent
+// lock held.
+nixl_status_t
+nixlAgentData::progressStaged(nixlXferReqH *req_hndl) {
+    nixlStagedState &st = *req_hndl->staged;
+
+    if (st.failStatus < 0)
+        return st.failStatus;
+
+    for (int s = 0; s < 2; ++s) {
+        if ((st.slotChunk[s] < 0) || !st.slotHandle[s])
+            continue;
+        nixl_status_t ret = st.slotEngine[s]->checkXfer(st.slotHandle[s]);
+        if (ret == NIXL_IN_PROG)
+            continue;
+        if (ret < 0) {
+            NIXL_ERROR_FUNC << (st.slotDraining[s] ? "consumer" : "producer")
+                            << " leg of staged transfer failed with status " << ret;
+            st.failStatus = ret;
+            addErrorTelemetry(ret);
+            return ret;
+        }
+        if (!st.slotDraining[s]) {
+            ret = postStagedLeg(req_hndl, s, true);
+            if (ret < 0) {
+                st.failStatus = ret;
+                addErrorTelemetry(ret);
+                return ret;
+            }
+        } else {
+            completeStagedChunk(req_hndl, s);
+        }
+    }
+
+    // Refill slots freed by retired chunks
+    for (int s = 0; s < 2; ++s) {
+        if (st.nextChunk >= (int)st.chunks.size())
+            break;
+        if (st.slotChunk[s] >= 0)
+            continue;
+        nixl_status_t ret = postStagedLeg(req_hndl, s, false);
+        if (ret < 0) {
+            st.failStatus = ret;
+            addErrorTelemetry(ret);
+            return ret;
+        }
+    }
+
+    return (st.doneChunks == (int)st.chunks.size()) ? NIXL_SUCCESS : NIXL_IN_PROG;
+}
+
+// Graceful degradation across backends: when a transfer hits a hard backend
+// error (a dead rail, a failed provider), re-resolve its still-registered
+// descriptors against another backend holding both sides and hand the
+// request back ready for a repost. Backends report no partial progress, so
+// the whole request is reissued; transfers are idempotent at this layer.
+// Engines already tried for this post are skipped through tried.
+// To be called with the agent lock held.
+nixl_status_t
+nixlAgentData::failoverXferLocked(nixlXferReqH *req_hndl,
+                                  std::set<nixlBackendEngine *> &tried) {
+    // Striped, relayed, staged and inline requests carry their own
+    // sub-state and are not failed over as a unit
+    if (req_hndl->isStriped() || req_hndl->relay || req_hndl->staged ||
+        req_hndl->inlineData)
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    tried.insert(req_hndl->engine);
+
+    const auto remote_it = remoteSections.find(req_hndl->remoteAgent);
+    if (remote_it == remoteSections.end())
+        return NIXL_ERR_NOT_FOUND;
+
+    // The populated lists keep the caller's descriptor boundaries, so the
+    // original ranges can be rebuilt without storing the request twice
+    nixl_xfer_dlist_t local_descs(req_hndl->initiatorDescs->getType());
+    nixl_xfer_dlist_t remote_descs(req_hndl->targetDescs->getType());
+    for (const auto &desc : *req_hndl->initiatorDescs)
+        local_descs.addDesc(desc);
+    for (const auto &desc : *req_hndl->targetDescs)
+        remote_descs.addDesc(desc);
+
+    for (auto &elm : backendEngines) {
+        nixlBackendEngine *candidate = elm.second;
+        if (tried.count(candidate))
+            continue;
+        if (req_hndl->hasNotif && !candidate->hasCapability(NIXL_CAP_NOTIF))
+            continue;
+
+        auto lmeta = std::make_unique<nixl_meta_dlist_t>(local_descs.getType());
+        auto rmeta = std::make_unique<nixl_meta_dlist_t>(remote_descs.getType());
+        if (memorySection->populate(local_descs, candidate, *lmeta) != NIXL_SUCCESS)
+            continue;
+        if (remote_it->second->populate(remote_descs, candidate, *rmeta) != NIXL_SUCCESS)
+            continue;
+
+        nixl_opt_b_args_t opt_args;
+        if (req_hndl->hasNotif) {
+            opt_args.notifMsg = req_hndl->notifMsg;
+            opt_args.hasNotif = true;
+        }
+
+        nixlBackendReqH *new_handle = nullptr;
+        const nixl_status_t ret = candidate->prepXfer(req_hndl->backendOp,
+                                                      *lmeta,
+                                                      *rmeta,
+                                                      req_hndl->remoteAgent,
+                                                      new_handle,
+                                                      &opt_args);
+        if (ret != NIXL_SUCCESS) {
+            tried.insert(candidate);
+            continue;
+        }
+
+        NIXL_WARN << "Failing over transfer from backend '" << req_hndl->engine->getType()
+                  << "' to '" << candidate->getType() << "' after status " << req_hndl->status;
+        if (telemetry_)
+            telemetry_->updateXferFailoverCount(req_hndl->engine->getType(), candidate->getType());
+
+        // The failed backend's handle is dropped only once the replacement
+        // is prepared; a release error is ignored since the rail is gone
+        if (req_hndl->backendHandle)
+            req_hndl->engine->releaseReqH(req_hndl->backendHandle);
+        req_hndl->engine = candidate;
+        req_hndl->backendHandle = new_handle;
+        *req_hndl->initiatorDescs = std::move(*lmeta);
+        *req_hndl->targetDescs = std::move(*rmeta);
+        req_hndl->status = NIXL_ERR_NOT_POSTED;
+        return NIXL_SUCCESS;
+    }
+
+    return NIXL_ERR_NOT_FOUND;
+}
+
+// Hands a request over to its backend(s), once admitted by the scheduler.
+// To be called with the agent lock held.
+nixl_status_t
+nixlAgentData::dispatchXferReqLocked(nixlXferReqH *req_hndl) {
+    nixl_opt_b_args_t opt_args;
+
+    if (req_hndl->integrity) {
+        const nixl_status_t iret = appendIntegrityTrailer(req_hndl);
+        if (iret != NIXL_SUCCESS) {
+            addErrorTelemetry(iret);
+            return iret;
+        }
+    }
+
+    if (req_hndl->inlineData) {
+        req_hndl->status = sendInlineNotif(req_hndl);
+        if (req_hndl->status < 0) {
+            NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
+                            << "' failed to send the inline notification with status "
+                            << req_hndl->status;
+            addErrorTelemetry(req_hndl->status);
+        } else if (telemetryEnabled) {
+            req_hndl->updateRequestStats(telemetry_, NIXL_TELEMETRY_POST_AND_FINISH);
+        }
+        return req_hndl->status;
+    }
+
+    if (req_hndl->hasNotif) {
+        opt_args.notifMsg = req_hndl->notifMsg;
+        opt_args.hasNotif = true;
+        opt_args.traceCtx = req_hndl->traceCtx;
+    }
+    opt_args.trafficClass = req_hndl->trafficClass;
+
+    // Source-side half of the distributed correlation pair; the target
+    // records the matching event when the notification arrives
+    if (telemetryEnabled && telemetry_ && opt_args.hasNotif && !req_hndl->traceCtx.empty())
+        telemetry_->addTraceEvent(req_hndl->traceCtx, true);
+
+    req_hndl->costPostTime = std::chrono::steady_clock::now();
+
+    NIXL_PROBE3(xfer_dispatch,
+                req_hndl,
+                req_hndl->telemetry.totalBytes,
+                req_hndl->stripeReqs.size());
+
+    if (req_hndl->isStriped()) {
+        // Rails/chunks are posted without the notification; the parent
+        // sends it once every child has completed
+        nixl_opt_b_args_t rail_args = opt_args;
+        rail_args.hasNotif = false;
+        rail_args.notifMsg.clear();
+        req_hndl->notifSent = false;
+        req_hndl->status = NIXL_SUCCESS;
+
+        if (req_hndl->chunked) {
+            // Pipelined posting: at most chunkPipelineDepth chunks ride
+            // the engine at once and completions feed in the rest (see
+            // checkBackendStatus), so other requests interleave with this
+            // one on the same rail
+            req_hndl->nextChunk = 0;
+            for (auto &child : req_hndl->stripeReqs)
+                child->status = NIXL_ERR_NOT_POSTED;
+            req_hndl->status = req_hndl->postChunkWindow();
+        } else {
+            // Rails sharing an engine that implements the batched entry point
+            // are handed over in one call: one driver doorbell for all of them
+            std::map<nixlBackendEngine *, std::vector<nixlXferReqH *>> batched;
+            for (auto &child : req_hndl->stripeReqs)
+                if (child->engine->hasCapability(NIXL_CAP_BATCHED_POST))
+                    batched[child->engine].push_back(child);
+            for (auto &[engine, rails] : batched) {
+                std::vector<nixlBackendXferSpec> specs;
+                specs.reserve(rails.size());
+                for (auto &child : rails)
+                    specs.push_back({child->backendOp, child->initiatorDescs,
+                                     child->targetDescs, &child->remoteAgent,
+                                     &child->backendHandle, &rail_args,
+                                     NIXL_ERR_NOT_POSTED});
+                engine->postXferBatch(specs);
+                for (size_t i = 0; i < rails.size(); ++i)
+                    rails[i]->status = specs[i].status;
+            }
+
+            for (auto &child : req_hndl->stripeReqs) {
+                if (!child->engine->hasCapability(NIXL_CAP_BATCHED_POST))
+                    child->status = child->engine->postXfer(child->backendOp,
+                                                            *child->initiatorDescs,
+                                                            *child->targetDescs,
+                                                            child->remoteAgent,
+                                                            child->backendHandle,
+                                                            &rail_args);
+                if (child->status < 0) {
+                    req_hndl->status = child->status;
+                    break;
+                }
+                if (child->status == NIXL_IN_PROG)
+                    req_hndl->status = NIXL_IN_PROG;
+            }
+        }
+        if (req_hndl->status == NIXL_SUCCESS)
+            req_hndl->sendStripeNotif();
+    } else {
+        // On a hard post error, try the next backend holding both sides'
+        // registrations before giving up
+        std::set<nixlBackendEngine *> failover_tried;
+        do {
+            req_hndl->status = req_hndl->engine->postXfer(req_hndl->backendOp,
+                                                          *req_hndl->initiatorDescs,
+                                                          *req_hndl->targetDescs,
+                                                          req_hndl->remoteAgent,
+                                                          req_hndl->backendHandle,
+                                                          &opt_args);
+        } while ((req_hndl->status < 0) && (req_hndl->status != NIXL_ERR_REMOTE_DISCONNECT) &&
+                 (failoverXferLocked(req_hndl, failover_tried) == NIXL_SUCCESS));
+    }
+
+    if (req_hndl->status < 0) {
+        if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
+            NIXL_ERROR_FUNC << "remote agent '" << req_hndl->remoteAgent
+                            << "' was disconnected after transfer request creation";
+            invalidateRemoteData(req_hndl->remoteAgent);
+            return NIXL_ERR_REMOTE_DISCONNECT;
+        } else {
+            NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
+                            << "' failed to post the transfer request with status "
+                            << req_hndl->status;
+        }
+    }
+
+    if (req_hndl->status == NIXL_IN_PROG) {
+        {
+            std::lock_guard<std::mutex> sched_guard(schedLock);
+            prioInFlight[static_cast<int>(req_hndl->priority)]++;
+            req_hndl->schedCounted = true;
+            // No-op when the request was pre-charged at admission
+            sendWindowCharge(req_hndl);
+        }
+        // Backend load accounting; striped rails are charged to their own
+        // engine and settled together at parent completion
+        req_hndl->loadCounted = true;
+        req_hndl->loadPostTime = std::chrono::steady_clock::now();
+        req_hndl->stallReported = false;
+        if (req_hndl->isStriped()) {
+            for (auto &child : req_hndl->stripeReqs) {
+                child->loadBytes = 0;
+                for (const auto &desc : *child->initiatorDescs)
+                    child->loadBytes += desc.len;
+                child->engine->recordLoadPosted(child->loadBytes);
+            }
+        } else {
+            req_hndl->loadBytes = 0;
+            for (const auto &desc : *req_hndl->initiatorDescs)
+                req_hndl->loadBytes += desc.len;
+            req_hndl->engine->recordLoadPosted(req_hndl->loadBytes);
+        }
+
+        // Class shaping charge; auto-chunked requests already paid chunk by
+        // chunk in postChunkWindow
+        if (!req_hndl->chunked) {
+            uint64_t bytes = 0;
+            if (req_hndl->isStriped())
+                for (auto &child : req_hndl->stripeReqs)
+                    bytes += child->loadBytes;
+            else
+                bytes = req_hndl->loadBytes;
+            std::lock_guard<std::mutex> sched_guard(schedLock);
+            classRateCharge(req_hndl->priority, bytes);
+        }
+    } else if (req_hndl->status == NIXL_SUCCESS) {
+        // Completed inline at post time: never in flight, but still counted
+        // so posted/completed rates reflect it
+        if (req_hndl->isStriped())
+            for (auto &child : req_hndl->stripeReqs)
+                child->engine->recordLoadInstant();
+        else
+            req_hndl->engine->recordLoadInstant();
+    }
+
+    // A pre-charged request that ended without going in flight gives its
+    // window occupancy back right away
+    if ((req_hndl->status != NIXL_IN_PROG) && req_hndl->windowCounted) {
+        std::lock_guard<std::mutex> sched_guard(schedLock);
+        sendWindowRelease(req_hndl);
+    }
+
+    if (req_hndl->status == NIXL_SUCCESS)
+        recordXferCost(req_hndl);
+
+    if (telemetryEnabled) {
+        if (req_hndl->status < 0) {
+            addErrorTelemetry(req_hndl->status);
+        } else if (req_hndl->status == NIXL_IN_PROG) {
+            req_hndl->updateRequestStats(telemetry_, NIXL_TELEMETRY_POST);
+        } else {
+            req_hndl->updateRequestStats(telemetry_, NIXL_TELEMETRY_POST_AND_FINISH);
+        }
+    }
+
+    return req_hndl->status;
+}
+
+// Stall watchdog: fires once per post when an in-flight request has aged
+// past the configured timeout, publishing a telemetry event and asking
+// the engine(s) involved for a diagnostic dump, so a stuck transfer
+// (dead NIC firmware, silent peer death) surfaces in the logs within
+// seconds instead of through application timeouts minutes later. To be
+// called from the progress paths with the agent lock held.
+void
+nixlAgentData::checkXferStall(nixlXferReqH *req_hndl) {
+    if ((xferStallTimeout.count() == 0) || req_hndl->stallReported ||
+        (req_hndl->loadPostTime == chrono_point_t()))
+        return;
+
+    const auto age = std::chrono::steady_clock::now() - req_hndl->loadPostTime;
+    if (age < xferStallTimeout)
+        return;
+    req_hndl->stallReported = true;
+
+    NIXL_WARN << "Transfer request towards '" << req_hndl->remoteAgent
+              << "' has been in flight for "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(age).count()
+              << "ms (" << req_hndl->loadBytes << "B); dumping backend diagnostics";
+    if (telemetry_)
+        telemetry_->updateStalledRequestsNum(1);
+
+    if (req_hndl->isStriped()) {
+        for (auto &child : req_hndl->stripeReqs)
+            if (child->status == NIXL_IN_PROG)
+                child->engine->dumpDiagnostics();
+    } else if (req_hndl->staged) {
+        req_hndl->staged->storageEngine->dumpDiagnostics();
+        req_hndl->staged->finalEngine->dumpDiagnostics();
+    } else if (req_hndl->engine) {
+        req_hndl->engine->dumpDiagnostics();
+    }
+}
+
+// Whether no strictly higher priority class is in flight.
+// To be called with schedLock held.
+bool
+nixlAgentData::schedGateClear(nixl_xfer_priority_t priority) {
+    for (int cls = 0; cls < static_cast<int>(priority); cls++)
+        if (prioInFlight[cls] > 0)
+            return false;
+    return true;
+}
+
+// Lazily refills a class shaping bucket from the time elapsed since the
+// last refill, capped at the configured burst. To be called with schedLock
+// held.
+void
+nixlAgentData::classBucketRefill(nixlClassBucket &bucket) {
+    const auto now = std::chrono::steady_clock::now();
+    const double elapsed =
+        std::chrono::duration_cast<std::chrono::duration<double>>(now - bucket.lastRefill)
+            .count();
+    bucket.lastRefill = now;
+    bucket.tokens = std::min(double(bucket.burstBytes),
+                             bucket.tokens + elapsed * double(bucket.bytesPerSec));
+}
+
+// Whether the class may post right now: an unshaped class always may, a
+// shaped one once its balance has recovered above zero. To be called with
+// schedLock held.
+bool
+nixlAgentData::classRateClear(nixl_xfer_priority_t priority) {
+    nixlClassBucket &bucket = classBuckets[static_cast<int>(priority)];
+    if (bucket.bytesPerSec == 0)
+        return true;
+    classBucketRefill(bucket);
+    return bucket.tokens > 0;
+}
+
+// Debits bytes from the class bucket; the balance may go negative so a
+// request larger than the burst still pays for its full size. To be called
+// with schedLock held.
+void
+nixlAgentData::classRateCharge(nixl_xfer_priority_t priority, uint64_t bytes) {
+    nixlClassBucket &bucket = classBuckets[static_cast<int>(priority)];
+    if (bucket.bytesPerSec == 0)
+        return;
+    classBucketRefill(bucket);
+    bucket.tokens -= double(bytes);
+}
+
+// Chunk-granularity gate for postChunkWindow: admits and debits one chunk,
+// or denies while the bucket is drained. Takes schedLock itself since the
+// chunk pipeline advances from the status polling paths.
+bool
+nixlAgentData::classRateTakeChunk(nixl_xfer_priority_t priority, uint64_t bytes) {
+    std::lock_guard<std::mutex> sched_guard(schedLock);
+    nixlClassBucket &bucket = classBuckets[static_cast<int>(priority)];
+    if (bucket.bytesPerSec == 0)
+        return true;
+    classBucketRefill(bucket);
+    if (bucket.tokens <= 0)
+        return false;
+    bucket.tokens -= double(bytes);
+    return true;
+}
+
+// Per-peer send window admission check; an unconfigured destination is
+// never gated. A backend-specific window takes precedence over the
+// peer-wide one, and a request larger than the whole window is admitted
+// once it has the window to itself. To be called with schedLock held.
+bool
+nixlAgentData::sendWindowClear(nixlXferReqH *req_hndl) {
+    if (req_hndl->windowCounted || (req_hndl->windowBytes == 0))
+        return true;
+    auto it = sendWindowMax.end();
+    if (req_hndl->engine)
+        it = sendWindowMax.find({req_hndl->remoteAgent, req_hndl->engine->getType()});
+    if (it == sendWindowMax.end())
+        it = sendWindowMax.find({req_hndl->remoteAgent, ""});
+    if (it == sendWindowMax.end())
+        return true;
+    const uint64_t used = sendWindowUsed[it->first];
+    if (used == 0)
+        return true;
+    return (used + req_hndl->windowBytes) <= it->second;
+}
+
+// Charges the request against its window, remembering the backend key so
+// the release matches even if the window is reconfigured meanwhile.
+// Idempotent; to be called with schedLock held.
+void
+nixlAgentData::sendWindowCharge(nixlXferReqH *req_hndl) {
+    if (req_hndl->windowCounted || (req_hndl->windowBytes == 0))
+        return;
+    auto it = sendWindowMax.end();
+    if (req_hndl->engine)
+        it = sendWindowMax.find({req_hndl->remoteAgent, req_hndl->engine->getType()});
+    if (it == sendWindowMax.end())
+        it = sendWindowMax.find({req_hndl->remoteAgent, ""});
+    if (it == sendWindowMax.end())
+        return;
+    req_hndl->windowCounted = true;
+    req_hndl->windowBknd = it->first.second;
+    const uint64_t used = (sendWindowUsed[it->first] += req_hndl->windowBytes);
+    if (telemetry_)
+        telemetry_->updateSendWindowOccupancy(req_hndl->remoteAgent, used);
+}
+
+// Returns the request's window occupancy; to be called with schedLock held
+void
+nixlAgentData::sendWindowRelease(nixlXferReqH *req_hndl) {
+    if (!req_hndl->windowCounted)
+        return;
+    req_hndl->windowCounted = false;
+    uint64_t &used = sendWindowUsed[{req_hndl->remoteAgent, req_hndl->windowBknd}];
+    used -= std::min(used, req_hndl->windowBytes);
+    if (telemetry_)
+        telemetry_->updateSendWindowOccupancy(req_hndl->remoteAgent, used);
+}
+
+// Records an observed transfer size in the log2 histogram behind the
+// adaptive auto-chunk threshold
+void
+nixlAgentData::recordXferSize(size_t bytes) {
+    if (bytes == 0)
+        return;
+    int bucket = 0;
+    while ((bytes >> (bucket + 1)) != 0)
+        bucket++;
+    std::lock_guard<std::mutex> sched_guard(schedLock);
+    xferSizeHist[bucket]++;
+    xferSizeSamples++;
+}
+
+// Adaptive auto-chunk threshold: the upper bound of the p90 bucket of the
+// observed size histogram, scaled up so only outliers get chunked, with a
+// floor so typical traffic never does. Until enough samples accumulate a
+// fixed default holds.
+size_t
+nixlAgentData::chunkThreshold() {
+    std::lock_guard<std::mutex> sched_guard(schedLock);
+    if (xferSizeSamples < chunkMinSamples)
+        return chunkDefaultBytes;
+
+    const uint64_t p90_count = (xferSizeSamples * 9 + 9) / 10;
+    uint64_t cum = 0;
+    int bucket = 0;
+    for (int b = 0; b < 64; ++b) {
+        cum += xferSizeHist[b];
+        if (cum >= p90_count) {
+            bucket = b;
+            break;
+        }
+    }
+    // 8x the p90 bucket's upper bound; a histogram already dominated by
+    // huge transfers effectively disables chunking
+    if (bucket >= 60)
+        return std::numeric_limits<size_t>::max();
+    return std::max(chunkMinBytes, size_t(1) << (bucket + 4));
+}
+
+// Effective per-backend chunk ceiling: the agent-level override when one
+// was set through setXferChunkSize, otherwise the backend's own
+// advertised limit; 0 means none
+size_t
+nixlAgentData::backendChunkLimit(nixlBackendEngine *engine) {
+    {
+        std::lock_guard<std::mutex> sched_guard(schedLock);
+        auto it = chunkSizeOverride.find(engine->getType());
+        if (it != chunkSizeOverride.end())
+            return it->second;
+    }
+    return engine->getMaxXferChunkSize();
+}
+
+// Folds a completed transfer into the measured cost table: every real
+// transfer doubles as a calibration probe for its (backend, mem pair,
+// size bucket) cell, so the table tracks this deployment's actual curves
+void
+nixlAgentData::recordXferCost(nixlXferReqH *req_hndl) {
+    // Composite and inline requests don't map to one backend data path
+    if (!req_hndl->engine || req_hndl->isStriped() || req_hndl->inlineData ||
+        (req_hndl->costPostTime == chrono_point_t()))
+        return;
+
+    size_t bytes = 0;
+    for (int i = 0; i < req_hndl->initiatorDescs->descCount(); ++i)
+        bytes += (*req_hndl->initiatorDescs)[i].len;
+    if (bytes == 0)
+        return;
+
+    const auto dur = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - req_hndl->costPostTime);
+
+    int bucket = 0;
+    while ((bytes >> (bucket + 1)) != 0)
+        bucket++;
+
+    const xfer_cost_key_t key{req_hndl->engine,
+                              req_hndl->initiatorDescs->getType(),
+                              req_hndl->targetDescs->getType(),
+                              bucket};
+    const double us = double(dur.count());
+
+    std::lock_guard<std::mutex> cost_guard(xferCostLock);
+    xferCostEntry &entry = xferCostTable[key];
+    if (entry.samples == 0) {
+        entry.durUs = us;
+    } else {
+        // 1/8 gain: smooth enough to ride out jitter, quick enough to
+        // track a congested or recovered path
+        entry.devUs += (std::abs(us - entry.durUs) - entry.devUs) / 8.0;
+        entry.durUs += (us - entry.durUs) / 8.0;
+    }
+    entry.samples++;
+}
+
+// Answers a cost query from the measured table; NOT_FOUND until the
+// matching cell has accumulated enough samples to be trustworthy
+nixl_status_t
+nixlAgentData::lookupXferCost(nixlBackendEngine *engine,
+                              nixl_mem_t local_mem,
+                              nixl_mem_t remote_mem,
+                              size_t bytes,
+                              std::chrono::microseconds &duration,
+                              std::chrono::microseconds &err_margin) const {
+    if (!engine || (bytes == 0))
+        return NIXL_ERR_NOT_FOUND;
+
+    int bucket = 0;
+    while ((bytes >> (bucket + 1)) != 0)
+        bucket++;
+
+    std::lock_guard<std::mutex> cost_guard(xferCostLock);
+    const auto it = xferCostTable.find({engine, local_mem, remote_mem, bucket});
+    if ((it == xferCostTable.end()) || (it->second.samples < xferCostMinSamples))
+        return NIXL_ERR_NOT_FOUND;
+
+    duration = std::chrono::microseconds(int64_t(it->second.durUs));
+    err_margin = std::chrono::microseconds(int64_t(it->second.devUs));
+    return NIXL_SUCCESS;
+}
+
+// Called when a counted request leaves NIXL_IN_PROG: releases its in-flight
+// slot and dispatches the deferred requests whose class gate has cleared
+void
+nixlAgentData::schedXferDone(nixlXferReqH *req_hndl) {
+    if (req_hndl->loadCounted) {
+        req_hndl->loadCounted = false;
+        const uint64_t elapsed_us =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                  req_hndl->loadPostTime)
+                .count();
+        if (req_hndl->isStriped())
+            for (auto &child : req_hndl->stripeReqs)
+                child->engine->recordLoadCompleted(child->loadBytes, elapsed_us);
+        else
+            req_hndl->engine->recordLoadCompleted(req_hndl->loadBytes, elapsed_us);
+    }
+
+    if (!req_hndl->schedCounted)
+        return;
+    req_hndl->schedCounted = false;
+
+    std::vector<nixlXferReqH*> ready;
+    {
+        std::lock_guard<std::mutex> sched_guard(schedLock);
+        sendWindowRelease(req_hndl);
+        prioInFlight[static_cast<int>(req_hndl->priority)]--;
+        for (auto it = deferredReqs.begin(); it != deferredReqs.end();) {
+            if (schedGateClear((*it)->priority) && sendWindowClear(*it) &&
+                classRateClear((*it)->priority)) {
+                (*it)->deferred = false;
+                // Pre-charge so several requests released by one completion
+                // cannot collectively overshoot the window
+                sendWindowCharge(*it);
+                ready.push_back(*it);
+                it = deferredReqs.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    for (auto &req : ready)
+        dispatchXferReqLocked(req);
+}
+
+// Dispatches the requests suspended on req_hndl once it has left
+// NIXL_IN_PROG; successors of a failed or canceled predecessor are failed
+// with NIXL_ERR_NOT_POSTED instead. To be called with the agent lock held.
+// Completion signals of inline-completed successors are still delivered by
+// the completion thread, outside the lock.
+void
+nixlAgentData::fireDepSuccessors(nixlXferReqH *req_hndl) {
+    if (req_hndl->depSuccessors.empty())
+        return;
+
+    std::vector<nixlXferReqH*> successors;
+    successors.swap(req_hndl->depSuccessors);
+
+    for (auto &succ : successors) {
+        if (!succ->depSuspended)
+            continue;
+        succ->depSuspended = false;
+        succ->depPredecessor = nullptr;
+
+        if (req_hndl->status < 0) {
+            NIXL_WARN << "Dependency predecessor finished with status " << req_hndl->status
+                      << ", failing the dependent transfer request";
+            succ->status = NIXL_ERR_NOT_POSTED;
+        } else {
+            succ->status = dispatchXferReqLocked(succ);
+        }
+
+        if (succ->hasCompletionSignal())
+            watchCompletion(succ);
+
+        // Chained edges: a successor that completed (or failed) inline
+        // releases its own dependents right away
+        if (succ->status != NIXL_IN_PROG)
+            fireDepSuccessors(succ);
+    }
+}
+
+// Dispatches a deferred request once its gate has cleared or its deadline
+// has expired; returns true if it was handed to the backend
+bool
+nixlAgentData::tryDispatchDeferred(nixlXferReqH *req_hndl) {
+    bool starved;
+    {
+        std::lock_guard<std::mutex> sched_guard(schedLock);
+        if (!req_hndl->deferred)
+            return false;
+
+        const bool gate_clear = schedGateClear(req_hndl->priority) &&
+            sendWindowClear(req_hndl) && classRateClear(req_hndl->priority);
+        const bool expired = req_hndl->hasDeadline &&
+            (std::chrono::steady_clock::now() >= req_hndl->schedDeadline);
+        if (!gate_clear && !expired)
+            return false;
+
+        starved = !gate_clear;
+        req_hndl->deferred = false;
+        deferredReqs.erase(std::remove(deferredReqs.begin(), deferredReqs.end(), req_hndl),
+                           deferredReqs.end());
+    }
+
+    if (starved && telemetry_)
+        telemetry_->updateStarvedRequestsNum(1);
+
+    dispatchXferReqLocked(req_hndl);
+    return true;
+}
+
+// Unqueues a deferred request that is being released before dispatch
+void
+nixlAgentData::dropDeferred(nixlXferReqH *req_hndl) {
+    std::lock_guard<std::mutex> sched_guard(schedLock);
+    if (!req_hndl->deferred)
+        return;
+    req_hndl->deferred = false;
+    deferredReqs.erase(std::remove(deferredReqs.begin(), deferredReqs.end(), req_hndl),
+                       deferredReqs.end());
+}
+
+// Polls the watched in-flight requests on behalf of the user, and delivers
+// eventfd/callback completions once they leave NIXL_IN_PROG, so users can
+// epoll many outstanding transfers instead of spinning on getXferStatus
+void
+nixlAgentData::completionWorker() {
+    std::vector<nixlXferReqH*> done_reqs;
+
+    while (!completionThreadStop) {
+        done_reqs.clear();
+        {
+            NIXL_SHARED_LOCK_GUARD(lock);
+            std::lock_guard<std::mutex> q_lock(completionLock);
+            for (auto it = completionQueue.begin(); it != completionQueue.end();) {
+                nixlXferReqH *req_hndl = *it;
+
+                // A suspended successor has nothing to poll until its
+                // predecessor fires it
+                if (req_hndl->depSuspended) {
+                    ++it;
+                    continue;
+                }
+
+                // Deferred requests have no backend status to poll yet;
+                // try to dispatch them instead
+                if (req_hndl->deferred && !tryDispatchDeferred(req_hndl)) {
+                    ++it;
+                    continue;
+                }
+
+                if (req_hndl->status == NIXL_IN_PROG) {
+                    // Same state transitions as getXferStatus
+                    if (remoteSections.count(req_hndl->remoteAgent) == 0) {
+                        req_hndl->status = NIXL_ERR_NOT_FOUND;
+                    } else if (req_hndl->relay) {
+                        req_hndl->status = progressRelay(req_hndl);
+                    } else if (req_hndl->staged) {
+                        req_hndl->status = progressStaged(req_hndl);
+                    } else {
+                        req_hndl->status = req_hndl->checkBackendStatus();
+                        if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
+                            invalidateRemoteData(req_hndl->remoteAgent);
+                        } else if (req_hndl->status < 0) {
+                            // Mid-stream hard error: settle the accounting,
+                            // then try another backend before failing over
+                            // to the user
+                            schedXferDone(req_hndl);
+                            std::set<nixlBackendEngine *> tried;
+                            if (failoverXferLocked(req_hndl, tried) == NIXL_SUCCESS)
+                                dispatchXferReqLocked(req_hndl);
+                        }
+                    }
+                }
+
+                if (req_hndl->status == NIXL_IN_PROG) {
+                    checkXferStall(req_hndl);
+                    ++it;
+                    continue;
+                }
+                NIXL_PROBE2(xfer_complete, req_hndl, req_hndl->status);
+                schedXferDone(req_hndl);
+                fireDepSuccessors(req_hndl);
+
+                if (req_hndl->status == NIXL_SUCCESS)
+                    recordXferCost(req_hndl);
+
+                if (telemetryEnabled) {
+                    if (req_hndl->status == NIXL_SUCCESS)
+                        req_hndl->updateRequestStats(telemetry_, NIXL_TELEMETRY_FINISH);
+                    else if (req_hndl->status < 0)
+                        addErrorTelemetry(req_hndl->status);
+                }
+
+                done_reqs.push_back(req_hndl);
+                it = completionQueue.erase(it);
+            }
+        }
+
+        // Deliver outside the agent lock, so callbacks are free to call
+        // back into the agent
+        for (auto &req_hndl : done_reqs)
+            signalCompletion(req_hndl);
+
+        if (config.pthrDelay > 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(config.pthrDelay));
+    }
+}
+
+void
+nixlAgentData::watchCompletion(nixlXferReqH *req_hndl) {
+    std::lock_guard<std::mutex> q_lock(completionLock);
+    // A request can be watched from several paths (for its own completion
+    // signal and as a dependency predecessor); keep a single entry
+    if (std::find(completionQueue.begin(), completionQueue.end(), req_hndl) !=
+        completionQueue.end())
+        return;
+    completionQueue.push_back(req_hndl);
+    if (!completionThread.joinable())
+        completionThread = std::thread(&nixlAgentData::completionWorker, this);
+}
+
+void
+nixlAgentData::dropCompletion(nixlXferReqH *req_hndl) {
+    std::lock_guard<std::mutex> q_lock(completionLock);
+    completionQueue.erase(std::remove(completionQueue.begin(),
+                                      completionQueue.end(), req_hndl),
+                          completionQueue.end());
+}
+
+void
+nixlAgentData::signalCompletion(nixlXferReqH *req_hndl) {
+    if (req_hndl->completionEventFd >= 0) {
+        uint64_t signal = 1;
+        ssize_t ret = write(req_hndl->completionEventFd, &signal, sizeof(signal));
+        if (ret != sizeof(signal))
+            NIXL_ERROR << "Failed to signal completion eventfd "
+                       << req_hndl->completionEventFd << " (errno " << errno << ")";
+    }
+
+    if (req_hndl->completionCallback)
+        req_hndl->completionCallback(req_hndl->status);
+}
+
+nixl_status_t
+nixlAgent::postXferReq(nixlXferReqH *req_hndl,
+                       const nixl_opt_args_t* extra_params) const {
+
+    if (!req_hndl) {
+        NIXL_ERROR_FUNC << "transfer request handle is null";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    NIXL_PROBE2(xfer_post, req_hndl, req_hndl->telemetry.totalBytes);
+
+    if (data->telemetryEnabled) {
+        req_hndl->telemetry.startTime = std::chrono::steady_clock::now();
+        // A repost reuses the handle; clear the previous run's phases
+        req_hndl->telemetry.submitTime = chrono_point_t();
+        req_hndl->telemetry.firstCompleteTime = chrono_point_t();
+        req_hndl->telemetry.lastCompleteTime = chrono_point_t();
+    }
+
+    nixl_status_t ret;
+    {
+        NIXL_SHARED_LOCK_GUARD(data->lock);
+        ret = data->postXferReqLocked(req_hndl, extra_params);
+        if ((ret == NIXL_IN_PROG) && req_hndl->hasCompletionSignal())
+            data->watchCompletion(req_hndl);
+    }
+
+    // Completed within the post, deliver the completion inline, outside the
+    // agent lock so the callback is free to call back into the agent
+    if ((ret != NIXL_IN_PROG) && req_hndl->hasCompletionSignal())
+        data->signalCompletion(req_hndl);
+
+    return ret;
+}
+
+nixl_status_t
+nixlAgent::postXferReqBatch(const std::vector<nixlXferReqH*> &req_hndls,
+                            const nixl_opt_args_t* extra_params) const {
+    nixl_status_t ret, bad_ret = NIXL_SUCCESS;
+
+    if (req_hndls.empty()) {
+        NIXL_ERROR_FUNC << "transfer request handle list is empty";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    for (const auto &req_hndl : req_hndls) {
+        if (!req_hndl) {
+            NIXL_ERROR_FUNC << "transfer request handle is null";
+            data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+            return NIXL_ERR_INVALID_PARAM;
+        }
+    }
+
+    if (data->telemetryEnabled) {
+        auto start_time = std::chrono::steady_clock::now();
+        for (auto &req_hndl : req_hndls) {
+            req_hndl->telemetry.startTime = start_time;
+            req_hndl->telemetry.submitTime = chrono_point_t();
+            req_hndl->telemetry.firstCompleteTime = chrono_point_t();
+            req_hndl->telemetry.lastCompleteTime = chrono_point_t();
+        }
+    }
+
+    // Group the requests per backend engine, so each backend receives its
+    // share of the batch back to back and can complete the posts within a
+    // single progress pass, instead of one pass per post.
+    std::unordered_map<nixlBackendEngine*, std::vector<nixlXferReqH*>> engine_reqs;
+    for (const auto &req_hndl : req_hndls)
+        engine_reqs[req_hndl->engine].push_back(req_hndl);
+
+    std::vector<nixlXferReqH*> done_reqs;
+    {
+        NIXL_SHARED_LOCK_GUARD(data->lock);
+        // Best effort, posting the rest of the batch even if one fails. Errors
+        // are returned through the per-request handles and the worst status.
+        for (auto & [engine, reqs] : engine_reqs) {
+            for (auto &req_hndl : reqs) {
+                ret = data->postXferReqLocked(req_hndl, extra_params);
+                if (ret < 0)
+                    bad_ret = ret;
+
+                if (req_hndl->hasCompletionSignal()) {
+                    if (ret == NIXL_IN_PROG)
+                        data->watchCompletion(req_hndl);
+                    else
+                        done_reqs.push_back(req_hndl);
+                }
+            }
+        }
+    }
+
+    for (auto &req_hndl : done_reqs)
+        data->signalCompletion(req_hndl);
+
+    return bad_ret;
+}
+
+nixl_status_t
+nixlAgent::getXferStatus (nixlXferReqH *req_hndl,
+                          const nixl_opt_args_t* extra_params) const {
+
+    // Turn the optional per-call budget into an absolute deadline before
+    // taking the lock, so time spent waiting for the lock counts against
+    // the budget too and the overall call latency stays bounded
+    chrono_point_t deadline;
+    if (extra_params && (extra_params->progressBudget.count() > 0))
+        deadline = std::chrono::steady_clock::now() + extra_params->progressBudget;
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    // If the status is done, no need to recheck and no state changes.
+    // Same for users incorrectly recalling this method in error/done.
+    if (req_hndl->status == NIXL_IN_PROG) {
+        // Check if the remote was invalidated before completion
+        if (data->remoteSections.count(req_hndl->remoteAgent) == 0) {
+            NIXL_ERROR_FUNC << "remote agent '" << req_hndl->remoteAgent
+                            << "' was invalidated during transfer";
+            return NIXL_ERR_NOT_FOUND;
+        }
+
+        // A suspended successor has no backend status until its
+        // predecessor completes and fires it
+        if (req_hndl->depSuspended)
+            return NIXL_IN_PROG;
+
+        // Relayed transfers have no backend handle of their own; progress
+        // the staging pipeline instead. Acks arrive through getNotifs.
+        if (req_hndl->relay) {
+            req_hndl->status = data->progressRelay(req_hndl);
+            return req_hndl->status;
+        }
+
+        // Same for staged transfers: progress the two-leg pipeline
+        if (req_hndl->staged) {
+            req_hndl->status = data->progressStaged(req_hndl);
+            return req_hndl->status;
+        }
+
+        // A deferred request has no backend status yet; dispatch it if its
+        // gate has cleared or its deadline has expired
+        if (req_hndl->deferred) {
+            if (!data->tryDispatchDeferred(req_hndl))
+                return NIXL_IN_PROG;
+            if (req_hndl->status != NIXL_IN_PROG)
+                return req_hndl->status;
+        }
+
+        req_hndl->status = req_hndl->checkBackendStatus(deadline);
+        if ((req_hndl->status < 0) && (req_hndl->status != NIXL_ERR_REMOTE_DISCONNECT)) {
+            // Mid-stream hard error: settle the accounting, then try to
+            // repost through another backend before reporting failure
+            data->schedXferDone(req_hndl);
+            std::set<nixlBackendEngine *> tried;
+            if (data->failoverXferLocked(req_hndl, tried) == NIXL_SUCCESS)
+                data->dispatchXferReqLocked(req_hndl);
+        }
+        if (req_hndl->status == NIXL_IN_PROG)
+            data->checkXferStall(req_hndl);
+        if (req_hndl->status != NIXL_IN_PROG) {
+            NIXL_PROBE2(xfer_complete, req_hndl, req_hndl->status);
+            data->schedXferDone(req_hndl);
+            data->fireDepSuccessors(req_hndl);
+        }
+        if (req_hndl->status < 0) {
+            if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
+                data->invalidateRemoteData(req_hndl->remoteAgent);
+                return NIXL_ERR_REMOTE_DISCONNECT;
+            } else {
+                NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
+                                << "' returned error status " << req_hndl->status;
+            }
+        }
+        if (req_hndl->status == NIXL_SUCCESS)
+            data->recordXferCost(req_hndl);
+
+        if (data->telemetryEnabled) {
+            if (req_hndl->status == NIXL_SUCCESS) {
+                req_hndl->updateRequestStats(data->telemetry_, NIXL_TELEMETRY_FINISH);
+            } else if (req_hndl->status < 0) {
+                data->addErrorTelemetry(req_hndl->status);
+            }
+        }
+    }
+
+    // If the status is error when entering this method, it was already logged
+    return req_hndl->status;
+}
+
+nixl_status_t
+nixlAgent::getXferStatusBatch(const std::vector<nixlXferReqH *> &req_hndls,
+                              std::vector<nixl_status_t> &statuses,
+                              const nixl_opt_args_t *extra_params) const {
+    if (req_hndls.empty()) {
+        NIXL_ERROR_FUNC << "transfer request handle list is empty";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    for (const auto &req_hndl : req_hndls) {
+        if (!req_hndl) {
+            NIXL_ERROR_FUNC << "transfer request handle is null";
+            data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+            return NIXL_ERR_INVALID_PARAM;
+        }
+    }
+
+    chrono_point_t deadline;
+    if (extra_params && (extra_params->progressBudget.count() > 0))
+        deadline = std::chrono::steady_clock::now() + extra_params->progressBudget;
+    auto budget_spent = [&deadline]() {
+        return (deadline != chrono_point_t()) &&
+               (std::chrono::steady_clock::now() >= deadline);
+    };
+
+    statuses.assign(req_hndls.size(), NIXL_IN_PROG);
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+
+    // Requests whose status can come from one per-engine harvest are
+    // grouped; everything with its own progress pipeline (relay, staged,
+    // striped) or without a backend status yet is refreshed individually,
+    // with the same state transitions as getXferStatus
+    std::unordered_map<nixlBackendEngine *, std::vector<size_t>> engine_reqs;
+    std::vector<size_t> settle_idx;
+    for (size_t i = 0; i < req_hndls.size(); i++) {
+        nixlXferReqH *req_hndl = req_hndls[i];
+        statuses[i] = req_hndl->status;
+        if (req_hndl->status != NIXL_IN_PROG)
+            continue;
+
+        if (data->remoteSections.count(req_hndl->remoteAgent) == 0) {
+            NIXL_ERROR_FUNC << "remote agent '" << req_hndl->remoteAgent
+                            << "' was invalidated during transfer";
+            statuses[i] = NIXL_ERR_NOT_FOUND;
+            continue;
+        }
+        if (req_hndl->depSuspended)
+            continue;
+        if (req_hndl->relay) {
+            req_hndl->status = data->progressRelay(req_hndl);
+            statuses[i] = req_hndl->status;
+            continue;
+        }
+        if (req_hndl->staged) {
+            req_hndl->status = data->progressStaged(req_hndl);
+            statuses[i] = req_hndl->status;
+            continue;
+        }
+        if (req_hndl->deferred) {
+            if (!data->tryDispatchDeferred(req_hndl))
+                continue;
+            if (req_hndl->status != NIXL_IN_PROG) {
+                statuses[i] = req_hndl->status;
+                continue;
+            }
+        }
+        if (req_hndl->isStriped()) {
+            req_hndl->status = req_hndl->checkBackendStatus(deadline);
+            settle_idx.push_back(i);
+            continue;
+        }
+        engine_reqs[req_hndl->engine].push_back(i);
+    }
+
+    // One progress-and-harvest pass per engine for the plain requests
+    std::vector<nixlBackendReqH *> handles;
+    std::vector<nixl_status_t> backend_status;
+    for (auto &[engine, indices] : engine_reqs) {
+        if (budget_spent())
+            break;
+        handles.clear();
+        for (size_t idx : indices)
+            handles.push_back(req_hndls[idx]->backendHandle);
+        backend_status.assign(indices.size(), NIXL_IN_PROG);
+        engine->checkXferBatch(handles, backend_status);
+        for (size_t j = 0; j < indices.size(); j++) {
+            req_hndls[indices[j]]->status = backend_status[j];
+            settle_idx.push_back(indices[j]);
+        }
+    }
+
+    // Completion bookkeeping for the refreshed requests, same state
+    // transitions as getXferStatus
+    for (size_t i : settle_idx) {
+        nixlXferReqH *req_hndl = req_hndls[i];
+        if ((req_hndl->status < 0) && (req_hndl->status != NIXL_ERR_REMOTE_DISCONNECT)) {
+            // Mid-stream hard error: settle the accounting, then try to
+            // repost through another backend before reporting failure
+            data->schedXferDone(req_hndl);
+            std::set<nixlBackendEngine *> tried;
+            if (data->failoverXferLocked(req_hndl, tried) == NIXL_SUCCESS)
+                data->dispatchXferReqLocked(req_hndl);
+        }
+        if (req_hndl->status == NIXL_IN_PROG)
+            data->checkXferStall(req_hndl);
+        if (req_hndl->status != NIXL_IN_PROG) {
+            NIXL_PROBE2(xfer_complete, req_hndl, req_hndl->status);
+            data->schedXferDone(req_hndl);
+            data->fireDepSuccessors(req_hndl);
+        }
+        if (req_hndl->status < 0) {
+            if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
+                data->invalidateRemoteData(req_hndl->remoteAgent);
+            } else {
+                NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
+                                << "' returned error status " << req_hndl->status;
+            }
+        }
+        if (req_hndl->status == NIXL_SUCCESS)
+            data->recordXferCost(req_hndl);
+
+        if (data->telemetryEnabled) {
+            if (req_hndl->status == NIXL_SUCCESS) {
+                req_hndl->updateRequestStats(data->telemetry_, NIXL_TELEMETRY_FINISH);
+            } else if (req_hndl->status < 0) {
+                data->addErrorTelemetry(req_hndl->status);
+            }
+        }
+        statuses[i] = req_hndl->status;
+    }
+
+    nixl_status_t agg = NIXL_SUCCESS;
+    for (const auto &status : statuses) {
+        if ((status < 0) && (agg >= 0))
+            agg = status;
+        else if ((status == NIXL_IN_PROG) && (agg == NIXL_SUCCESS))
+            agg = NIXL_IN_PROG;
+    }
+    return agg;
+}
+
+nixl_status_t
+nixlAgent::getXferProgress(nixlXferReqH *req_hndl,
+                           nixl_xfer_progress_t &progress) const {
+    // Refresh through the regular status path first, so completion
+    // bookkeeping (scheduler accounting, dependents, telemetry) stays in
+    // one place; then snapshot per-chunk completion under the lock
+    const nixl_status_t status = getXferStatus(req_hndl);
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+
+    progress.totalBytes     = 0;
+    progress.completedBytes = 0;
+    progress.watermarkBytes = 0;
+    progress.chunkDone.clear();
+
+    auto desc_bytes = [](const nixl_meta_dlist_t *descs) {
+        size_t bytes = 0;
+        for (const auto &desc : *descs)
+            bytes += desc.len;
+        return bytes;
+    };
+
+    if (req_hndl->isStriped()) {
+        // Both striping and auto-chunking partition the descriptor list
+        // contiguously in order, so leading completed children form a
+        // consumable prefix of the transfer
+        bool leading = true;
+        for (const auto *child : req_hndl->stripeReqs) {
+            const size_t bytes = desc_bytes(child->initiatorDescs);
+            const bool   done  = (child->status == NIXL_SUCCESS);
+            progress.totalBytes += bytes;
+            progress.chunkDone.push_back(done);
+            if (done)
+                progress.completedBytes += bytes;
+            if (leading && done)
+                progress.watermarkBytes += bytes;
+            else
+                leading = false;
+        }
+    } else {
+        const size_t bytes = desc_bytes(req_hndl->initiatorDescs);
+        const bool   done  = (req_hndl->status == NIXL_SUCCESS);
+        progress.totalBytes = bytes;
+        progress.chunkDone.push_back(done);
+        if (done) {
+            progress.completedBytes = bytes;
+            progress.watermarkBytes = bytes;
+        }
     }
 
-    // If the status is error when entering this method, it was already logged
-    return req_hndl->status;
+    return status;
+}
+
+nixl_status_t
+nixlAgent::getXferFailedDescs(const nixlXferReqH *req_hndl,
+                              nixl_xfer_dlist_t &retry_local,
+                              nixl_xfer_dlist_t &retry_remote) const {
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+
+    // Composite requests re-cut the descriptor lists, so backend indices
+    // would not map back to the user's lists
+    if (req_hndl->isStriped() || req_hndl->relay || req_hndl->staged || req_hndl->inlineData) {
+        NIXL_ERROR_FUNC << "failed-subset query is not supported for composite requests";
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    retry_local = nixl_xfer_dlist_t(req_hndl->initiatorDescs->getType());
+    retry_remote = nixl_xfer_dlist_t(req_hndl->targetDescs->getType());
+
+    if (req_hndl->status == NIXL_SUCCESS)
+        return NIXL_SUCCESS;
+
+    if ((req_hndl->status == NIXL_IN_PROG) || (req_hndl->status == NIXL_ERR_NOT_POSTED)) {
+        NIXL_ERROR_FUNC << "request is not in a terminal error state";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    if (!req_hndl->backendHandle) {
+        NIXL_ERROR_FUNC << "request has no backend handle to attribute the failure";
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    std::vector<size_t> indices;
+    const nixl_status_t ret = req_hndl->engine->getFailedDescs(req_hndl->backendHandle, indices);
+    if (ret != NIXL_SUCCESS) {
+        if (ret != NIXL_ERR_NOT_SUPPORTED)
+            NIXL_ERROR_FUNC << "backend failed-descriptor query returned " << ret;
+        return ret;
+    }
+
+    for (const size_t idx : indices) {
+        if (idx >= (size_t)req_hndl->initiatorDescs->descCount()) {
+            NIXL_ERROR_FUNC << "backend reported out-of-range descriptor index " << idx;
+            return NIXL_ERR_BACKEND;
+        }
+        retry_local.addDesc((*req_hndl->initiatorDescs)[idx]);
+        retry_remote.addDesc((*req_hndl->targetDescs)[idx]);
+    }
+    return NIXL_SUCCESS;
 }
 
 nixl_status_t
@@ -1182,8 +5231,18 @@ nixlAgent::getXferTelemetry(const nixlXferReqH *req_hndl, nixl_xfer_telem_t &tel
 nixl_status_t
 nixlAgent::queryXferBackend(const nixlXferReqH* req_hndl,
                             nixlBackendH* &backend) const {
-    NIXL_LOCK_GUARD(data->lock);
-    backend = data->backendHandles[req_hndl->engine->getType()];
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    // Loopback requests run as a direct copy and have no backend engine
+    if (!req_hndl->engine) {
+        NIXL_ERROR_FUNC << "request is not bound to a backend";
+        return NIXL_ERR_NOT_FOUND;
+    }
+    auto it = data->backendHandles.find(req_hndl->engine->getType());
+    if (it == data->backendHandles.end()) {
+        NIXL_ERROR_FUNC << "backend of request not found among created backends";
+        return NIXL_ERR_NOT_FOUND;
+    }
+    backend = it->second;
     return NIXL_SUCCESS;
 }
 
@@ -1191,28 +5250,183 @@ nixl_status_t
 nixlAgent::releaseXferReq(nixlXferReqH *req_hndl) const {
 
     NIXL_SHARED_LOCK_GUARD(data->lock);
+    // Stop watching the request if a completion notification is still
+    // pending, or if it is being polled as a dependency predecessor
+    data->dropCompletion(req_hndl);
+
+    // Drop the ordered-channel tail pointer if this handle still is it
+    if (req_hndl->onChannel) {
+        auto tail_it = data->channelTails.find(req_hndl->channelKey);
+        if ((tail_it != data->channelTails.end()) && (tail_it->second == req_hndl))
+            data->channelTails.erase(tail_it);
+    }
+
+    // A suspended successor was never handed to the backend; unregister it
+    // from its predecessor so the edge doesn't fire into a freed handle
+    if (req_hndl->depSuspended) {
+        auto &succs = req_hndl->depPredecessor->depSuccessors;
+        succs.erase(std::remove(succs.begin(), succs.end(), req_hndl), succs.end());
+        req_hndl->depSuspended = false;
+        req_hndl->depPredecessor = nullptr;
+        req_hndl->status = NIXL_ERR_CANCELED;
+    }
+
+    // A deferred request was never handed to the backend; just unqueue it
+    if (req_hndl->deferred) {
+        data->dropDeferred(req_hndl);
+        req_hndl->status = NIXL_ERR_CANCELED;
+    }
+
+    // A relayed transfer: forget the pending token so a late ack can't
+    // touch the freed handle; hop-one slot handles go with the destructor
+    if (req_hndl->relay) {
+        data->relayPending.erase(req_hndl->relay->token);
+        if (req_hndl->status == NIXL_IN_PROG)
+            req_hndl->status = NIXL_ERR_CANCELED;
+    }
+
+    // A staged transfer: the per-slot leg handles go with the destructor
+    if (req_hndl->staged && (req_hndl->status == NIXL_IN_PROG))
+        req_hndl->status = NIXL_ERR_CANCELED;
+
     //attempt to cancel request
     if(req_hndl->status == NIXL_IN_PROG) {
-        req_hndl->status = req_hndl->engine->checkXfer(
-                                     req_hndl->backendHandle);
+        req_hndl->status = req_hndl->checkBackendStatus();
 
         if(req_hndl->status == NIXL_IN_PROG) {
+            if (req_hndl->isStriped()) {
+                // Cancel every rail that is still in flight
+                for (auto &child : req_hndl->stripeReqs) {
+                    if (child->status != NIXL_IN_PROG)
+                        continue;
+                    nixl_status_t ret = child->engine->releaseReqH(child->backendHandle);
+                    if (ret < 0) {
+                        NIXL_ERROR_FUNC << "backend '" << child->engine->getType()
+                                        << "' could not release striped transfer request and "
+                                           "returned error status " << ret;
+                        return NIXL_ERR_REPOST_ACTIVE; // Might need renaming
+                    }
+                    child->backendHandle = nullptr;
+                }
+            } else {
+                req_hndl->status = req_hndl->engine->releaseReqH(
+                                             req_hndl->backendHandle);
+
+                if (req_hndl->status < 0) {
+                    NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
+                                    << "' could not release transfer request and returned error status "
+                                    << req_hndl->status;
+                    return NIXL_ERR_REPOST_ACTIVE; // Might need renaming
+                }
+                // just in case the backend doesn't set to NULL on success
+                // this will prevent calling releaseReqH again in destructor
+                req_hndl->backendHandle = nullptr;
+            }
+        }
+    }
+    data->schedXferDone(req_hndl);
+    // Releasing a predecessor with pending successors: fire them now (a
+    // canceled predecessor fails them), so none is left pointing at a
+    // freed handle
+    data->fireDepSuccessors(req_hndl);
+    delete req_hndl;
+    return NIXL_SUCCESS;
+}
 
-            req_hndl->status = req_hndl->engine->releaseReqH(
-                                         req_hndl->backendHandle);
+nixl_status_t
+nixlAgent::cancelXferReq(nixlXferReqH *req_hndl, size_t &bytes_transferred) const {
+    bytes_transferred = 0;
 
-            if (req_hndl->status < 0) {
-                NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
-                                << "' could not release transfer request and returned error status "
-                                << req_hndl->status;
-                return NIXL_ERR_REPOST_ACTIVE; // Might need renaming
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+
+    // Never dispatched: unqueue it, nothing has moved
+    if (req_hndl->depSuspended) {
+        auto &succs = req_hndl->depPredecessor->depSuccessors;
+        succs.erase(std::remove(succs.begin(), succs.end(), req_hndl), succs.end());
+        req_hndl->depSuspended = false;
+        req_hndl->depPredecessor = nullptr;
+        req_hndl->status = NIXL_ERR_CANCELED;
+        return NIXL_SUCCESS;
+    }
+    if (req_hndl->deferred) {
+        data->dropDeferred(req_hndl);
+        req_hndl->status = NIXL_ERR_CANCELED;
+        data->schedXferDone(req_hndl);
+        return NIXL_SUCCESS;
+    }
+
+    // A relayed transfer has no backend handle of its own; dropping the
+    // pending token stops the relay from progressing it further
+    if (req_hndl->relay) {
+        data->relayPending.erase(req_hndl->relay->token);
+        if (req_hndl->status == NIXL_IN_PROG)
+            req_hndl->status = NIXL_ERR_CANCELED;
+        data->schedXferDone(req_hndl);
+        return NIXL_SUCCESS;
+    }
+
+    // Same for a staged transfer; the per-slot leg handles go with the
+    // handle's release
+    if (req_hndl->staged) {
+        if (req_hndl->status == NIXL_IN_PROG)
+            req_hndl->status = NIXL_ERR_CANCELED;
+        data->schedXferDone(req_hndl);
+        return NIXL_SUCCESS;
+    }
+
+    if (req_hndl->status == NIXL_IN_PROG)
+        req_hndl->status = req_hndl->checkBackendStatus();
+
+    // Already settled: nothing left to abort
+    if (req_hndl->status != NIXL_IN_PROG) {
+        if (req_hndl->status == NIXL_SUCCESS)
+            bytes_transferred = req_hndl->loadBytes;
+        return NIXL_SUCCESS;
+    }
+
+    // Chunked pipelines repost the remaining chunks from completion paths;
+    // aborting midway would race those posts, so only releaseXferReq can
+    // take such a request down
+    if (req_hndl->chunked) {
+        NIXL_DEBUG << "cancelXferReq not supported for auto-chunked transfers";
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    nixl_status_t ret;
+    if (req_hndl->isStriped()) {
+        // All rails must support abort; probe with the first in-flight one
+        // so a half-canceled stripe set is never left behind
+        for (auto &child : req_hndl->stripeReqs) {
+            if (child->status != NIXL_IN_PROG)
+                continue;
+            size_t child_bytes = 0;
+            ret = child->engine->abortReqH(child->backendHandle, child_bytes);
+            if (ret == NIXL_ERR_NOT_SUPPORTED)
+                return ret;
+            if (ret != NIXL_SUCCESS) {
+                NIXL_ERROR_FUNC << "backend '" << child->engine->getType()
+                                << "' failed to abort striped transfer with status " << ret;
+                return ret;
             }
-            // just in case the backend doesn't set to NULL on success
-            // this will prevent calling releaseReqH again in destructor
-            req_hndl->backendHandle = nullptr;
+            child->status = NIXL_ERR_CANCELED;
+            bytes_transferred += child_bytes;
+        }
+    } else {
+        ret = req_hndl->engine->abortReqH(req_hndl->backendHandle, bytes_transferred);
+        if (ret != NIXL_SUCCESS) {
+            if (ret != NIXL_ERR_NOT_SUPPORTED)
+                NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
+                                << "' failed to abort transfer with status " << ret;
+            return ret;
         }
     }
-    delete req_hndl;
+
+    req_hndl->status = NIXL_ERR_CANCELED;
+    // Stop watching the request and free its scheduler/window capacity now,
+    // instead of when the handle is eventually released
+    data->dropCompletion(req_hndl);
+    data->schedXferDone(req_hndl);
+    data->fireDepSuccessors(req_hndl);
     return NIXL_SUCCESS;
 }
 
@@ -1338,9 +5552,199 @@ nixlAgent::releasedDlistH (nixlDlistH* dlist_hndl) const {
     return NIXL_SUCCESS;
 }
 
+// Drops notifications matching none of the registered subscription
+// prefixes, before any copy into a caller map or consumer queue; the
+// drop count feeds telemetry. No-op without registered filters. To be
+// called with the agent lock held, after the internal control
+// notifications (inline, integrity, relay) have been consumed.
+void
+nixlAgentData::filterNotifs(notif_list_t &notif_list) {
+    if (notifFilters.empty() || notif_list.empty())
+        return;
+
+    notif_list_t kept;
+    for (auto &elm : notif_list) {
+        bool match = false;
+        for (const auto &prefix : notifFilters) {
+            if (elm.second.compare(0, prefix.size(), prefix) == 0) {
+                match = true;
+                break;
+            }
+        }
+        if (match)
+            kept.push_back(std::move(elm));
+        else
+            notifFilterDrops++;
+    }
+
+    if (kept.size() != notif_list.size() && telemetryEnabled && telemetry_)
+        telemetry_->updateFilteredNotifsNum(notif_list.size() - kept.size());
+    notif_list.swap(kept);
+}
+
+// Moves notifications claimed by a sharded consumer queue out of
+// notif_list into that queue; unclaimed entries stay for the caller's
+// map. To be called with the agent lock held; only the shard lock is
+// taken per push, so consumers draining other shards are not blocked.
+void
+nixlAgentData::routeNotifs(notif_list_t &notif_list) {
+    if (notifQueueRoutes.empty())
+        return;
+
+    notif_list_t remainder;
+    for (auto &elm : notif_list) {
+        auto route = notifQueueRoutes.find(elm.first);
+        if (route == notifQueueRoutes.end()) {
+            remainder.push_back(std::move(elm));
+            continue;
+        }
+        std::lock_guard<std::mutex> shard_guard(route->second->lock);
+        route->second->queue.push_back(std::move(elm));
+    }
+    notif_list.swap(remainder);
+}
+
 nixl_status_t
 nixlAgent::getNotifs(nixl_notifs_t &notif_map,
                      const nixl_opt_args_t* extra_params) {
+    bool delivered = false;
+
+    // One locked drain pass over the notification backends; the hybrid
+    // wait below re-runs it with the lock dropped in between
+    auto drain_pass = [&]() -> nixl_status_t {
+        notif_list_t    bknd_notif_list;
+        nixl_status_t   ret, bad_ret=NIXL_SUCCESS;
+        backend_list_t* backend_list;
+
+        // Exclusive: single-threaded backends drain their notification lists
+        // without internal locking, so concurrent pollers cannot share the lock
+        NIXL_LOCK_GUARD(data->lock);
+        if (!extra_params || extra_params->backends.size() == 0) {
+            backend_list = &data->notifEngines;
+            if (backend_list->empty()) {
+                NIXL_ERROR_FUNC << "no backends support notifications";
+                return NIXL_ERR_BACKEND;
+            }
+        } else {
+            backend_list = new backend_list_t();
+            for (auto & elm : extra_params->backends)
+                if (elm->engine->hasCapability(NIXL_CAP_NOTIF))
+                    backend_list->push_back(elm->engine);
+
+            if (backend_list->empty()) {
+                NIXL_ERROR_FUNC << "none of specified backends support notifications";
+                delete backend_list;
+                return NIXL_ERR_BACKEND;
+            }
+        }
+
+        // Relay-side hop-two forwards ride on this polling path
+        data->progressRelayForwards();
+
+        // Optional per-call time budget: stop draining further backends once
+        // spent, leaving them for the next call. Budgeted calls on the agent's
+        // own list resume at the first undrained engine (see notifPollRR)
+        const bool budgeted = extra_params && (extra_params->progressBudget.count() > 0);
+        chrono_point_t deadline;
+        if (budgeted)
+            deadline = std::chrono::steady_clock::now() + extra_params->progressBudget;
+
+        const size_t n_engines = backend_list->size();
+        const size_t start = (budgeted && (backend_list == &data->notifEngines)) ?
+                             (data->notifPollRR % n_engines) : 0;
+        size_t drained = 0;
+
+        // Doing best effort, if any backend errors out we return
+        // error but proceed with the rest. We can add metadata about
+        // the backend to the msg, but user could put it themselves.
+        while (drained < n_engines) {
+            auto &eng = (*backend_list)[(start + drained) % n_engines];
+            ++drained;
+            bknd_notif_list.clear();
+            ret = eng->getNotifs(bknd_notif_list);
+            if (ret < 0) {
+                NIXL_ERROR_FUNC << "backend '" << eng->getType() << "' returned error status " << ret
+                                << " while getting notifications";
+                bad_ret=ret;
+            }
+
+            if (bknd_notif_list.size() > 0) {
+                data->applyInlineNotifs(bknd_notif_list);
+                data->checkNotifIntegrity(bknd_notif_list);
+                data->processRelayNotifs(bknd_notif_list);
+                data->filterNotifs(bknd_notif_list);
+                data->routeNotifs(bknd_notif_list);
+
+                NIXL_PROBE2(notif_delivered, eng, bknd_notif_list.size());
+
+                for (auto & elm: bknd_notif_list) {
+                    if (notif_map.count(elm.first) == 0)
+                        notif_map[elm.first] = std::vector<nixl_blob_t>();
+
+                    notif_map[elm.first].push_back(elm.second);
+                    delivered = true;
+                }
+            }
+
+            // Trace contexts that rode in with these notifs form the
+            // target-side half of the distributed correlation pair
+            if (data->telemetryEnabled && data->telemetry_) {
+                std::vector<nixl_blob_t> traces;
+                if (eng->getNotifTraceCtxs(traces) == NIXL_SUCCESS)
+                    for (const auto &trace : traces)
+                        data->telemetry_->addTraceEvent(trace, false);
+            }
+
+            if (budgeted && (std::chrono::steady_clock::now() >= deadline))
+                break;
+        }
+
+        if (backend_list == &data->notifEngines)
+            data->notifPollRR = (start + drained) % n_engines;
+
+        if (extra_params && extra_params->backends.size() > 0)
+            delete backend_list;
+
+        // If any backend had an error, it was already logged
+        return bad_ret;
+    };
+
+    const auto timeout = extra_params ? extra_params->notifTimeout :
+                                        std::chrono::microseconds(0);
+    if (timeout.count() == 0)
+        return drain_pass();
+
+    // Hybrid wait: re-drain hot for the first passes, giving poll-level
+    // delivery latency while traffic flows, then ease into a sleeping
+    // backoff that caps idle CPU. Routed notifications (sharded queues)
+    // do not end the wait, only ones landing in this caller's map do.
+    constexpr std::chrono::microseconds spin_budget(50);
+    constexpr std::chrono::microseconds backoff_cap(250);
+    const auto wait_start = std::chrono::steady_clock::now();
+    const auto wait_deadline = wait_start + timeout;
+    std::chrono::microseconds backoff(1);
+
+    while (true) {
+        nixl_status_t ret = drain_pass();
+        if (ret < 0 || delivered)
+            return ret;
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= wait_deadline)
+            return ret;
+
+        if (now - wait_start >= spin_budget) {
+            std::this_thread::sleep_for(std::min<std::chrono::microseconds>(
+                backoff,
+                std::chrono::duration_cast<std::chrono::microseconds>(wait_deadline - now)));
+            backoff = std::min(backoff * 2, backoff_cap);
+        }
+    }
+}
+
+nixl_status_t
+nixlAgent::getNotifsView(nixl_notifs_view_t &notif_map,
+                         const nixl_opt_args_t* extra_params) {
     notif_list_t    bknd_notif_list;
     nixl_status_t   ret, bad_ret=NIXL_SUCCESS;
     backend_list_t* backend_list;
@@ -1355,7 +5759,7 @@ nixlAgent::getNotifs(nixl_notifs_t &notif_map,
     } else {
         backend_list = new backend_list_t();
         for (auto & elm : extra_params->backends)
-            if (elm->engine->supportsNotif())
+            if (elm->engine->hasCapability(NIXL_CAP_NOTIF))
                 backend_list->push_back(elm->engine);
 
         if (backend_list->empty()) {
@@ -1365,10 +5769,27 @@ nixlAgent::getNotifs(nixl_notifs_t &notif_map,
         }
     }
 
-    // Doing best effort, if any backend errors out we return
-    // error but proceed with the rest. We can add metadata about
-    // the backend to the msg, but user could put it themselves.
-    for (auto & eng: *backend_list) {
+    // Views handed out on the previous call die here
+    notif_map.clear();
+    data->notifViewBuffer.clear();
+
+    // Relay-side hop-two forwards ride on this polling path
+    data->progressRelayForwards();
+
+    // Same optional per-call budget and resume point as getNotifs
+    const bool budgeted = extra_params && (extra_params->progressBudget.count() > 0);
+    chrono_point_t deadline;
+    if (budgeted)
+        deadline = std::chrono::steady_clock::now() + extra_params->progressBudget;
+
+    const size_t n_engines = backend_list->size();
+    const size_t start = (budgeted && (backend_list == &data->notifEngines)) ?
+                         (data->notifPollRR % n_engines) : 0;
+    size_t drained = 0;
+
+    while (drained < n_engines) {
+        auto &eng = (*backend_list)[(start + drained) % n_engines];
+        ++drained;
         bknd_notif_list.clear();
         ret = eng->getNotifs(bknd_notif_list);
         if (ret < 0) {
@@ -1377,17 +5798,34 @@ nixlAgent::getNotifs(nixl_notifs_t &notif_map,
             bad_ret=ret;
         }
 
-        if (bknd_notif_list.size() == 0)
-            continue;
+        data->applyInlineNotifs(bknd_notif_list);
+        data->checkNotifIntegrity(bknd_notif_list);
+        data->processRelayNotifs(bknd_notif_list);
+        data->filterNotifs(bknd_notif_list);
+        data->routeNotifs(bknd_notif_list);
 
-        for (auto & elm: bknd_notif_list) {
-            if (notif_map.count(elm.first) == 0)
-                notif_map[elm.first] = std::vector<nixl_blob_t>();
+        for (auto & elm: bknd_notif_list)
+            data->notifViewBuffer.push_back(std::move(elm));
 
-            notif_map[elm.first].push_back(elm.second);
+        if (data->telemetryEnabled && data->telemetry_) {
+            std::vector<nixl_blob_t> traces;
+            if (eng->getNotifTraceCtxs(traces) == NIXL_SUCCESS)
+                for (const auto &trace : traces)
+                    data->telemetry_->addTraceEvent(trace, false);
         }
+
+        if (budgeted && (std::chrono::steady_clock::now() >= deadline))
+            break;
     }
 
+    if (backend_list == &data->notifEngines)
+        data->notifPollRR = (start + drained) % n_engines;
+
+    // Build the views only once the buffer is final, so vector growth above
+    // cannot invalidate them (moved SSO strings relocate their bytes)
+    for (auto & elm: data->notifViewBuffer)
+        notif_map[std::string_view(elm.first)].push_back(std::string_view(elm.second));
+
     if (extra_params && extra_params->backends.size() > 0)
         delete backend_list;
 
@@ -1395,6 +5833,90 @@ nixlAgent::getNotifs(nixl_notifs_t &notif_map,
     return bad_ret;
 }
 
+nixl_status_t
+nixlAgent::createNotifQueue(const std::vector<std::string> &remote_agents,
+                            nixlNotifQueueH* &queue_hndl) {
+    if (remote_agents.empty()) {
+        NIXL_ERROR_FUNC << "no remote agents given to subscribe to";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    NIXL_LOCK_GUARD(data->lock);
+    for (const auto &agent : remote_agents) {
+        if (data->notifQueueRoutes.count(agent) != 0) {
+            NIXL_ERROR_FUNC << "agent '" << agent
+                            << "' is already routed to another notification queue";
+            data->addErrorTelemetry(NIXL_ERR_NOT_ALLOWED);
+            return NIXL_ERR_NOT_ALLOWED;
+        }
+    }
+
+    queue_hndl = new nixlNotifQueueH;
+    queue_hndl->agents.insert(remote_agents.begin(), remote_agents.end());
+    for (const auto &agent : queue_hndl->agents)
+        data->notifQueueRoutes[agent] = queue_hndl;
+    data->notifQueues.push_back(queue_hndl);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::getQueuedNotifs(nixlNotifQueueH* queue_hndl,
+                           nixl_notifs_t &notif_map) {
+    if (!queue_hndl) {
+        NIXL_ERROR_FUNC << "invalid queue handle argument";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    // Only the shard lock is taken, so concurrent consumers draining
+    // their own queues scale with the thread count
+    notif_list_t drained;
+    {
+        std::lock_guard<std::mutex> shard_guard(queue_hndl->lock);
+        drained.swap(queue_hndl->queue);
+    }
+    for (auto &elm : drained)
+        notif_map[elm.first].push_back(std::move(elm.second));
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::releaseNotifQueue(nixlNotifQueueH* queue_hndl) {
+    if (!queue_hndl) {
+        NIXL_ERROR_FUNC << "invalid queue handle argument";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    NIXL_LOCK_GUARD(data->lock);
+    for (const auto &agent : queue_hndl->agents)
+        data->notifQueueRoutes.erase(agent);
+    data->notifQueues.erase(
+        std::remove(data->notifQueues.begin(), data->notifQueues.end(), queue_hndl),
+        data->notifQueues.end());
+    delete queue_hndl;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::setNotifFilter(const std::vector<nixl_blob_t> &prefixes) {
+    for (const auto &prefix : prefixes) {
+        if (prefix.empty()) {
+            NIXL_ERROR_FUNC << "empty prefix matches everything; "
+                               "pass an empty vector to remove filtering";
+            data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+            return NIXL_ERR_INVALID_PARAM;
+        }
+    }
+
+    NIXL_LOCK_GUARD(data->lock);
+    if (!prefixes.empty() && data->notifFilters.empty())
+        NIXL_DEBUG << "notification filtering enabled with " << prefixes.size() << " prefixes";
+    data->notifFilters = prefixes;
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::genNotif(const std::string &remote_agent,
                     const nixl_blob_t &msg,
@@ -1409,7 +5931,7 @@ nixlAgent::genNotif(const std::string &remote_agent,
     } else {
         backend_list = &backend_list_value;
         for (auto &elm : extra_params->backends) {
-            if (elm->engine->supportsNotif()) {
+            if (elm->engine->hasCapability(NIXL_CAP_NOTIF)) {
                 backend_list->push_back(elm->engine);
             }
         }
@@ -1420,11 +5942,50 @@ nixlAgent::genNotif(const std::string &remote_agent,
         return NIXL_ERR_BACKEND;
     }
 
+    // Wait-free staging path: the notification is parked in this thread's
+    // ring and sent by the progress executor's flush poller, so the caller
+    // never contends on the agent lock or backend connection state. The
+    // ring is registered with the agent on first use.
+    if (extra_params && extra_params->asyncNotif && data->progressExecutor) {
+        // Keyed by the process-unique instance id, not the nixlAgentData
+        // address: a new agent allocated where a destroyed one lived must
+        // not pick up the old thread's stale ring
+        static thread_local std::unordered_map<uint64_t,
+                                               std::shared_ptr<nixlNotifRing>> rings;
+        auto &ring = rings[data->instanceId];
+        if (!ring) {
+            ring = std::make_shared<nixlNotifRing>();
+            std::lock_guard<std::mutex> guard(data->notifRingsLock);
+            data->notifRings.push_back(ring);
+            if (!data->notifPollerActive) {
+                nixlAgentData *d = data.get();
+                data->notifPollerId = data->progressExecutor->addPoller(
+                    [d]() { return d->flushNotifRings(); });
+                data->notifPollerActive = true;
+            }
+        }
+
+        const size_t tail = ring->tail.load(std::memory_order_relaxed);
+        if (tail - ring->head.load(std::memory_order_acquire) <
+            nixlNotifRing::ringSize) {
+            auto &slot = ring->slots[tail % nixlNotifRing::ringSize];
+            slot.agent = remote_agent;
+            slot.msg   = msg;
+            if (backend_list == &backend_list_value)
+                slot.engines = backend_list_value;
+            else
+                slot.engines.clear();
+            ring->tail.store(tail + 1, std::memory_order_release);
+            return NIXL_SUCCESS;
+        }
+        // Full ring: fall through to the inline send below
+    }
+
     NIXL_SHARED_LOCK_GUARD(data->lock);
 
     if (data->name == remote_agent) {
         for (const auto &eng : *backend_list) {
-            if (eng->supportsLocal()) {
+            if (eng->hasCapability(NIXL_CAP_LOCAL)) {
                 ret = eng->genNotif(remote_agent, msg);
                 if (ret < 0) {
                     NIXL_ERROR_FUNC << "backend '" << eng->getType() << "' returned error status "
@@ -1456,48 +6017,200 @@ nixlAgent::genNotif(const std::string &remote_agent,
     return NIXL_ERR_NOT_FOUND;
 }
 
+// Sends one staged notification, resolving the target backend at flush
+// time when the caller did not pin one. Mirrors the inline genNotif path.
+nixl_status_t
+nixlAgentData::sendStagedNotif(const std::string &remote_agent,
+                               const nixl_blob_t &msg,
+                               const backend_list_t &engines) {
+    const backend_list_t &backend_list = engines.empty() ? notifEngines : engines;
+
+    NIXL_SHARED_LOCK_GUARD(lock);
+
+    if (name == remote_agent) {
+        for (const auto &eng : backend_list)
+            if (eng->hasCapability(NIXL_CAP_LOCAL))
+                return eng->genNotif(remote_agent, msg);
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    const auto iter = remoteBackends.find(remote_agent);
+    if (iter != remoteBackends.end())
+        for (const auto &eng : backend_list)
+            if (iter->second.count(eng->getType()) != 0)
+                return eng->genNotif(remote_agent, msg);
+
+    return NIXL_ERR_NOT_FOUND;
+}
+
+// Poller body draining the asyncNotif staging rings in order. Send errors
+// can no longer be returned to the staging caller, so they are logged and
+// counted in error telemetry. Holding notifRingsLock across the drain only
+// blocks first-use ring registrations, never the staging fast path.
+bool
+nixlAgentData::flushNotifRings() {
+    bool progressed = false;
+
+    std::lock_guard<std::mutex> rings_guard(notifRingsLock);
+    for (auto &ring : notifRings) {
+        size_t head = ring->head.load(std::memory_order_relaxed);
+        const size_t tail = ring->tail.load(std::memory_order_acquire);
+        while (head != tail) {
+            auto &slot = ring->slots[head % nixlNotifRing::ringSize];
+            const nixl_status_t ret =
+                sendStagedNotif(slot.agent, slot.msg, slot.engines);
+            if (ret < 0) {
+                NIXL_ERROR << "async notification to agent '" << slot.agent
+                           << "' failed with status " << ret;
+                addErrorTelemetry(ret);
+            }
+            slot.agent.clear();
+            slot.msg.clear();
+            slot.engines.clear();
+            ++head;
+            ring->head.store(head, std::memory_order_release);
+            progressed = true;
+        }
+    }
+    return progressed;
+}
+
+// Returns the serialized full local MD by shared ownership, rebuilding it
+// only when the local section or connection info has changed since the
+// previous build. To be called with the agent lock held (shared suffices);
+// concurrent readers are serialized on the cache lock.
+nixl_status_t
+nixlAgentData::getLocalMDLocked (nixl_md_ptr_t &md) {
+    size_t conn_cnt;
+    nixl_backend_t nixl_backend;
+    nixl_status_t ret;
+
+    // connMD was populated when the backend was created
+    conn_cnt = connMD.size();
+
+    if (conn_cnt == 0) { // Error, no backend supports remote
+        NIXL_ERROR_FUNC << "no backends support remote operations";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    std::lock_guard<std::mutex> cache_guard(cachedLocalMDLock);
+    if (cachedLocalMD && !memorySection->isSerialDirty()) {
+        md = cachedLocalMD;
+        return NIXL_SUCCESS;
+    }
+
+    nixlSerDes sd;
+    ret = sd.addStr("Agent", name);
+    // Always returns SUCCESS, serdes class logs errors if necessary
+    if (ret) return NIXL_ERR_UNKNOWN;
+
+    // Full metadata resets the receiver's delta sequence baseline
+    ret = sd.addBuf("Seq", &mdSeqNum, sizeof(mdSeqNum));
+    if (ret) return NIXL_ERR_UNKNOWN;
+
+    ret = sd.addBuf("Conns", &conn_cnt, sizeof(conn_cnt));
+    if (ret) return NIXL_ERR_UNKNOWN;
+
+    for (auto &c : connMD) {
+        nixl_backend = c.first;
+        ret = sd.addStr("t", nixl_backend);
+        if (ret) break;
+        ret = sd.addStr("c", c.second);
+        if (ret) break;
+    }
+    if (ret) return NIXL_ERR_UNKNOWN;
+
+    ret = sd.addStr("", "MemSection");
+    if (ret) return NIXL_ERR_UNKNOWN;
+
+    ret = memorySection->serialize(&sd);
+    if (ret) {
+        NIXL_ERROR_FUNC << "serialization failed";
+        return ret;
+    }
+
+    cachedLocalMD = std::make_shared<const nixl_blob_t>(sd.exportStr());
+    memorySection->clearSerialDirty();
+    md = cachedLocalMD;
+    return NIXL_SUCCESS;
+}
+
+// Socket-path variant of getLocalMDLocked that overlaps a rebuild with the
+// transmission: serdes output is pushed chunk by chunk into a bounded
+// stream the comm loop drains concurrently, so the first bytes hit the
+// wire while the section list is still serializing and no full-size
+// temporary blob precedes the cache update. A current cache is sent as a
+// shared blob like before. To be called with the agent lock held (shared
+// suffices).
 nixl_status_t
-nixlAgent::getLocalMD (nixl_blob_t &str) const {
-    size_t conn_cnt;
-    nixl_backend_t nixl_backend;
+nixlAgentData::sendLocalMDStreamed (const std::string &ip, int port) {
+    size_t conn_cnt = connMD.size();
     nixl_status_t ret;
 
-    NIXL_LOCK_GUARD(data->lock);
-    // data->connMD was populated when the backend was created
-    conn_cnt = data->connMD.size();
-
     if (conn_cnt == 0) { // Error, no backend supports remote
         NIXL_ERROR_FUNC << "no backends support remote operations";
         return NIXL_ERR_INVALID_PARAM;
     }
 
+    std::lock_guard<std::mutex> cache_guard(cachedLocalMDLock);
+    if (cachedLocalMD && !memorySection->isSerialDirty()) {
+        enqueueCommWork(std::make_tuple(SOCK_SEND, ip, port, cachedLocalMD, nullptr));
+        return NIXL_SUCCESS;
+    }
+
+    // Queue the stream first so the comm loop connects and starts cutting
+    // frames while the serialization below is still running
+    auto stream = std::make_shared<nixlMDStream>();
+    enqueueCommWork(std::make_tuple(SOCK_SEND, ip, port, nullptr, stream));
+
+    nixl_blob_t full; // rebuilt cache blob, assembled from the same chunks
     nixlSerDes sd;
-    ret = sd.addStr("Agent", data->name);
-    // Always returns SUCCESS, serdes class logs errors if necessary
-    if (ret) return NIXL_ERR_UNKNOWN;
+    sd.setChunkSink(nixlMDStream::chunkBytes, [&](std::string &&chunk) {
+        full.append(chunk);
+        stream->push(std::move(chunk));
+        wakeCommThread();
+    });
 
-    ret = sd.addBuf("Conns", &conn_cnt, sizeof(conn_cnt));
-    if (ret) return NIXL_ERR_UNKNOWN;
+    ret = sd.addStr("Agent", name);
+    // Always returns SUCCESS, serdes class logs errors if necessary
+    if (!ret) ret = sd.addBuf("Seq", &mdSeqNum, sizeof(mdSeqNum));
+    if (!ret) ret = sd.addBuf("Conns", &conn_cnt, sizeof(conn_cnt));
 
-    for (auto &c : data->connMD) {
-        nixl_backend = c.first;
-        ret = sd.addStr("t", nixl_backend);
-        if (ret) break;
-        ret = sd.addStr("c", c.second);
+    for (auto &c : connMD) {
         if (ret) break;
+        ret = sd.addStr("t", c.first);
+        if (!ret) ret = sd.addStr("c", c.second);
     }
-    if (ret) return NIXL_ERR_UNKNOWN;
 
-    ret = sd.addStr("", "MemSection");
-    if (ret) return NIXL_ERR_UNKNOWN;
-
-    ret = data->memorySection->serialize(&sd);
+    if (!ret) ret = sd.addStr("", "MemSection");
+    if (!ret) ret = memorySection->serialize(&sd);
     if (ret) {
         NIXL_ERROR_FUNC << "serialization failed";
+        // Bytes may already be on the wire: finishing the stream truncated
+        // makes the peer fail the load and resync with a full MD request
+        stream->finish();
+        wakeCommThread();
         return ret;
     }
 
-    str = sd.exportStr();
+    sd.flushChunk();
+    stream->finish();
+    wakeCommThread();
+
+    cachedLocalMD = std::make_shared<const nixl_blob_t>(std::move(full));
+    memorySection->clearSerialDirty();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::getLocalMD (nixl_blob_t &str) const {
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    nixl_md_ptr_t md;
+    nixl_status_t ret = data->getLocalMDLocked(md);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+    // The public API keeps the by-value blob; internal senders share md
+    str = *md;
     return NIXL_SUCCESS;
 }
 
@@ -1509,7 +6222,7 @@ nixlAgent::getLocalPartialMD(const nixl_reg_dlist_t &descs,
     backend_list_t *backend_list;
     nixl_status_t ret;
 
-    NIXL_LOCK_GUARD(data->lock);
+    NIXL_SHARED_LOCK_GUARD(data->lock);
 
     if (!extra_params || extra_params->backends.size() == 0) {
         if (descs.descCount() != 0) {
@@ -1553,6 +6266,9 @@ nixlAgent::getLocalPartialMD(const nixl_reg_dlist_t &descs,
     // Always returns SUCCESS, serdes class logs errors if necessary
     if (ret) return NIXL_ERR_UNKNOWN;
 
+    ret = sd.addBuf("Seq", &data->mdSeqNum, sizeof(data->mdSeqNum));
+    if (ret) return NIXL_ERR_UNKNOWN;
+
     // Only add connection info if requested via extra_params or empty dlist
     size_t conn_cnt = ((extra_params && extra_params->includeConnInfo) || descs.descCount() == 0) ?
                       found_iters.size() : 0;
@@ -1580,6 +6296,88 @@ nixlAgent::getLocalPartialMD(const nixl_reg_dlist_t &descs,
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlAgent::getLocalDeltaMD(const nixl_reg_dlist_t &added_descs,
+                           const nixl_reg_dlist_t &removed_descs,
+                           nixl_blob_t &str,
+                           const nixl_opt_args_t* extra_params) const {
+    backend_list_t tmp_list;
+    backend_list_t *backend_list;
+    nixl_status_t ret;
+
+    NIXL_LOCK_GUARD(data->lock);
+
+    if (!extra_params || extra_params->backends.size() == 0) {
+        if (added_descs.descCount() != 0) {
+            backend_list = &data->memToBackend[added_descs.getType()];
+            if (backend_list->empty()) {
+                NIXL_ERROR_FUNC << "no available backends for mem type '"
+                                << added_descs.getType() << "'";
+                return NIXL_ERR_NOT_FOUND;
+            }
+        } else {
+            backend_list = &tmp_list;
+            for (const auto & elm : data->backendEngines)
+                backend_list->push_back(elm.second);
+        }
+    } else {
+        backend_list = &tmp_list;
+        for (const auto & elm : extra_params->backends)
+            backend_list->push_back(elm->engine);
+    }
+
+    backend_set_t selected_engines;
+    for (const auto &backend : *backend_list) {
+        if (data->connMD.count(backend->getType()) != 0)
+            selected_engines.insert(backend);
+    }
+
+    if (selected_engines.size() == 0 && added_descs.descCount() > 0) {
+        NIXL_ERROR_FUNC << "no backends support the added descriptors";
+        return NIXL_ERR_BACKEND;
+    }
+
+    nixlSerDes sd;
+    ret = sd.addStr("Agent", data->name);
+    // Always returns SUCCESS, serdes class logs errors if necessary
+    if (ret) return NIXL_ERR_UNKNOWN;
+
+    // Deltas are chained: this blob moves the receiver from prev_seq to seq
+    uint64_t prev_seq = data->mdSeqNum;
+    uint64_t seq = ++data->mdSeqNum;
+    // The cached full MD embeds the previous sequence baseline
+    data->cachedLocalMD.reset();
+    ret = sd.addBuf("Seq", &seq, sizeof(seq));
+    if (ret) return NIXL_ERR_UNKNOWN;
+
+    // Deltas carry no connection info, peers must have loaded full MD before
+    size_t conn_cnt = 0;
+    ret = sd.addBuf("Conns", &conn_cnt, sizeof(conn_cnt));
+    if (ret) return NIXL_ERR_UNKNOWN;
+
+    ret = sd.addStr("", "MemDelta");
+    if (ret) return NIXL_ERR_UNKNOWN;
+
+    ret = sd.addBuf("Prev", &prev_seq, sizeof(prev_seq));
+    if (ret) return NIXL_ERR_UNKNOWN;
+
+    // Additions reuse the partial MD section format, removals are plain descs
+    ret = data->memorySection->serializePartial(&sd, selected_engines, added_descs);
+    if (ret) {
+        NIXL_ERROR_FUNC << "serialization failed";
+        return ret;
+    }
+
+    ret = removed_descs.serialize(&sd);
+    if (ret) {
+        NIXL_ERROR_FUNC << "serialization failed";
+        return ret;
+    }
+
+    str = sd.exportStr();
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
                          std::string &agent_name) {
@@ -1588,7 +6386,13 @@ nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
     nixl_backend_t nixl_backend;
     nixl_status_t ret;
 
-    NIXL_LOCK_GUARD(data->lock);
+    // Hashed up front (hardware CRC32C, so far cheaper than a parse); a
+    // match against the last applied full MD from the same agent short
+    // circuits the deserialization below
+    const uint32_t md_digest = nixlCrc32c(remote_metadata.data(), remote_metadata.size());
+
+    // Parse the blob before taking the agent lock, so transfers posting
+    // under the shared lock are not stalled behind metadata deserialization
     ret = sd.importStr(remote_metadata);
     if (ret != NIXL_SUCCESS) {
         NIXL_ERROR_FUNC << "failed to deserialize remote metadata";
@@ -1601,6 +6405,7 @@ nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
         return NIXL_ERR_MISMATCH;
     }
 
+    // The local agent name is immutable after construction
     if (remote_agent == data->name) {
         NIXL_ERROR_FUNC << "remote agent name same as local agent, "
                            "no need to load metadata";
@@ -1609,6 +6414,13 @@ nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
 
     NIXL_DEBUG << "Loading remote metadata for agent: " << remote_agent;
 
+    uint64_t remote_seq;
+    ret = sd.getBuf("Seq", &remote_seq, sizeof(remote_seq));
+    if (ret != NIXL_SUCCESS) {
+        NIXL_ERROR_FUNC << "error getting metadata sequence number: " << ret;
+        return NIXL_ERR_MISMATCH;
+    }
+
     size_t conn_cnt;
     ret = sd.getBuf("Conns", &conn_cnt, sizeof(conn_cnt));
     if (ret != NIXL_SUCCESS) {
@@ -1616,7 +6428,8 @@ nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
         return NIXL_ERR_MISMATCH;
     }
 
-    int count = 0;
+    std::vector<std::pair<nixl_backend_t, nixl_blob_t>> conns;
+    conns.reserve(conn_cnt);
     for (size_t i = 0; i < conn_cnt; ++i) {
         nixl_backend = sd.getStr("t");
         conn_info = sd.getStr("c");
@@ -1625,12 +6438,17 @@ nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
             NIXL_ERROR_FUNC << "failed to deserialize remote metadata";
             return NIXL_ERR_MISMATCH;
         }
+        conns.emplace_back(std::move(nixl_backend), std::move(conn_info));
+    }
 
-        ret = data->loadConnInfo(remote_agent, nixl_backend, conn_info);
+    NIXL_LOCK_GUARD(data->lock);
+    int count = 0;
+    for (const auto &[backend_type, backend_conn_info] : conns) {
+        ret = data->loadConnInfo(remote_agent, backend_type, backend_conn_info);
         if (ret == NIXL_SUCCESS) {
             count++;
         } else if (ret != NIXL_ERR_NOT_SUPPORTED) {
-            NIXL_ERROR_FUNC << "error loading connection info for backend '" << nixl_backend
+            NIXL_ERROR_FUNC << "error loading connection info for backend '" << backend_type
                             << "' with status " << ret;
             return ret;
         }
@@ -1641,22 +6459,164 @@ nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
         return NIXL_ERR_BACKEND;
     }
 
-    if (sd.getStr("") != "MemSection") {
+    std::string marker = sd.getStr("");
+
+    if (marker == "MemDelta") {
+        uint64_t prev_seq;
+        ret = sd.getBuf("Prev", &prev_seq, sizeof(prev_seq));
+        if (ret != NIXL_SUCCESS) {
+            NIXL_ERROR_FUNC << "error getting delta base sequence number: " << ret;
+            return NIXL_ERR_MISMATCH;
+        }
+
+        if (data->remoteSections.count(remote_agent) == 0) {
+            NIXL_ERROR_FUNC << "received metadata delta from agent '" << remote_agent
+                            << "' before its full metadata, full exchange required";
+            return NIXL_ERR_NOT_FOUND;
+        }
+
+        auto seq_it = data->remoteMDSeq.find(remote_agent);
+        if ((seq_it == data->remoteMDSeq.end()) || (seq_it->second != prev_seq)) {
+            NIXL_ERROR_FUNC << "sequence gap in metadata delta from agent '" << remote_agent
+                            << "', full exchange required to resync";
+            return NIXL_ERR_MISMATCH;
+        }
+
+        ret = data->loadRemoteSections(remote_agent, sd);
+        if (ret == NIXL_SUCCESS)
+            ret = data->applyRemoteMDRemovals(remote_agent, sd);
+        if (ret != NIXL_SUCCESS) {
+            NIXL_ERROR_FUNC << "error applying metadata delta from agent '" << remote_agent
+                            << "' with status " << ret;
+            return ret;
+        }
+    } else if (marker == "MemSection") {
+        // Identical full-MD re-send: peers re-push their MD to every peer
+        // after a reconnect, and re-parsing megabytes of unchanged
+        // registrations is pure waste. The sequence check keeps the skip
+        // correct when deltas have been applied on top of the cached blob.
+        auto dig_it = data->remoteMDDigest.find(remote_agent);
+        auto seq_it = data->remoteMDSeq.find(remote_agent);
+        if ((dig_it != data->remoteMDDigest.end()) &&
+            (dig_it->second == std::make_pair(md_digest, remote_metadata.size())) &&
+            (seq_it != data->remoteMDSeq.end()) && (seq_it->second == remote_seq) &&
+            (data->remoteSections.count(remote_agent) != 0)) {
+            NIXL_DEBUG << "Metadata from agent '" << remote_agent
+                       << "' is unchanged (digest match), skipping reload";
+            agent_name = remote_agent;
+            return NIXL_SUCCESS;
+        }
+
+        ret = data->loadRemoteSections(remote_agent, sd);
+        if (ret != NIXL_SUCCESS) {
+            NIXL_ERROR_FUNC << "error loading remote metadata for agent '" << remote_agent
+                            << "' with status " << ret;
+            return ret;
+        }
+    } else {
         NIXL_ERROR_FUNC << "failed to deserialize remote metadata";
         return NIXL_ERR_MISMATCH;
     }
 
-    ret = data->loadRemoteSections(remote_agent, sd);
-    if (ret != NIXL_SUCCESS) {
-        NIXL_ERROR_FUNC << "error loading remote metadata for agent '" << remote_agent
-                        << "' with status " << ret;
-        return ret;
+    data->remoteMDSeq[remote_agent] = remote_seq;
+
+    // Keep the as-received blobs for checkpointMD: a full MD restarts the
+    // chain, a delta extends it
+    if (marker == "MemSection") {
+        data->remoteMDCache[remote_agent] = {remote_metadata};
+        data->remoteMDDigest[remote_agent] = {md_digest, remote_metadata.size()};
+    } else {
+        data->remoteMDCache[remote_agent].push_back(remote_metadata);
     }
 
     agent_name = remote_agent;
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlAgent::loadRemoteMDAsync (const nixl_blob_t &remote_metadata,
+                              nixlMDLoadH* &handle) {
+    if (remote_metadata.empty()) {
+        NIXL_ERROR_FUNC << "remote metadata is empty";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    handle = new nixlMDLoadH();
+    nixlMDLoadH *load = handle;
+    // loadRemoteMD parses without the agent lock and takes it only to
+    // apply the result, so the background load does not stall transfers
+    handle->result = std::async(std::launch::async, [this, load, remote_metadata]() {
+        return loadRemoteMD(remote_metadata, load->agentName);
+    });
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::getMDLoadStatus (nixlMDLoadH* handle,
+                            std::string &agent_name) {
+    if (!handle) {
+        NIXL_ERROR_FUNC << "load handle is not provided";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    if (handle->result.valid()) {
+        if (handle->result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            return NIXL_IN_PROG;
+        handle->status = handle->result.get();
+    }
+
+    agent_name = handle->agentName;
+    return handle->status;
+}
+
+nixl_status_t
+nixlAgent::releaseMDLoadH (nixlMDLoadH* handle) {
+    if (!handle) {
+        NIXL_ERROR_FUNC << "load handle is not provided";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    // The load keeps using the handle until it resolves; wait it out
+    if (handle->result.valid())
+        handle->result.wait();
+    delete handle;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::prefetchRemoteMD (const std::vector<std::string> &remote_names,
+                             const nixl_opt_args_t* extra_params) {
+    if (remote_names.empty()) {
+        NIXL_ERROR_FUNC << "no remote agent names provided";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    const bool have_params = (extra_params != nullptr);
+    const nixl_opt_args_t params = have_params ? *extra_params : nixl_opt_args_t();
+
+    std::lock_guard<std::mutex> guard(data->mdPrefetchLock);
+    // Reap finished prefetches so the list does not grow with every hint
+    data->mdPrefetches.erase(
+        std::remove_if(data->mdPrefetches.begin(),
+                       data->mdPrefetches.end(),
+                       [](std::future<void> &prefetch) {
+                           return prefetch.wait_for(std::chrono::seconds(0)) ==
+                               std::future_status::ready;
+                       }),
+        data->mdPrefetches.end());
+
+    for (const auto &name : remote_names) {
+        data->mdPrefetches.push_back(
+            std::async(std::launch::async, [this, name, params, have_params]() {
+                const nixl_status_t ret = fetchRemoteMD(name, have_params ? &params : nullptr);
+                if (ret != NIXL_SUCCESS)
+                    NIXL_WARN << "Metadata prefetch for agent '" << name
+                              << "' failed with status " << ret;
+            }));
+    }
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::invalidateRemoteMD(const std::string &remote_agent) {
     NIXL_LOCK_GUARD(data->lock);
@@ -1666,49 +6626,166 @@ nixlAgent::invalidateRemoteMD(const std::string &remote_agent) {
         return NIXL_ERR_INVALID_PARAM;
     }
 
-    nixl_status_t ret = NIXL_ERR_NOT_FOUND;
-    if (data->remoteSections.count(remote_agent) != 0) {
-        delete data->remoteSections[remote_agent];
-        data->remoteSections.erase(remote_agent);
-        ret = NIXL_SUCCESS;
+    // The peer leaves the maps synchronously; the section teardown and
+    // backend disconnects run in background (see invalidateRemoteData),
+    // so a scale-down burst of invalidations does not serialize section
+    // destruction inside the agent lock
+    nixl_status_t ret = data->invalidateRemoteData(remote_agent);
+    if (ret != NIXL_SUCCESS)
+        NIXL_ERROR_FUNC << "error invalidating remote metadata for agent '" << remote_agent
+                        << "' with status " << ret;
+    return ret;
+}
+
+nixl_status_t
+nixlAgent::checkpointMD (nixl_blob_t &ckpt) const {
+    nixlSerDes sd;
+    nixl_status_t ret;
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+
+    ret = sd.addStr("Agent", data->name);
+    if (ret) return NIXL_ERR_UNKNOWN;
+
+    size_t peer_cnt = data->remoteMDCache.size();
+    ret = sd.addBuf("NumPeers", &peer_cnt, sizeof(peer_cnt));
+    if (ret) return NIXL_ERR_UNKNOWN;
+
+    for (const auto &[peer, blobs] : data->remoteMDCache) {
+        ret = sd.addStr("Peer", peer);
+        if (ret) return NIXL_ERR_UNKNOWN;
+
+        size_t blob_cnt = blobs.size();
+        ret = sd.addBuf("NumMD", &blob_cnt, sizeof(blob_cnt));
+        if (ret) return NIXL_ERR_UNKNOWN;
+
+        for (const auto &blob : blobs) {
+            ret = sd.addStr("MD", blob);
+            if (ret) return NIXL_ERR_UNKNOWN;
+        }
+    }
+
+    ckpt = sd.exportStr();
+    NIXL_DEBUG << "Checkpointed metadata of " << peer_cnt << " peers into " << ckpt.size()
+               << " bytes";
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::restoreMD (const nixl_blob_t &ckpt) {
+    nixlSerDes sd;
+    nixl_status_t ret;
+
+    ret = sd.importStr(ckpt);
+    if (ret != NIXL_SUCCESS) {
+        NIXL_ERROR_FUNC << "failed to deserialize checkpoint blob";
+        return NIXL_ERR_MISMATCH;
+    }
+
+    const std::string ckpt_agent = sd.getStr("Agent");
+    if (ckpt_agent.empty()) {
+        NIXL_ERROR_FUNC << "error deserializing agent name from checkpoint";
+        return NIXL_ERR_MISMATCH;
+    }
+    if (ckpt_agent != data->name)
+        NIXL_WARN << "Restoring a checkpoint taken by agent '" << ckpt_agent << "' into agent '"
+                  << data->name << "'";
+
+    size_t peer_cnt;
+    ret = sd.getBuf("NumPeers", &peer_cnt, sizeof(peer_cnt));
+    if (ret != NIXL_SUCCESS) {
+        NIXL_ERROR_FUNC << "error deserializing peer count from checkpoint";
+        return NIXL_ERR_MISMATCH;
     }
 
-    if (data->remoteBackends.count(remote_agent) != 0) {
-        for (auto &it : data->remoteBackends[remote_agent]) {
-            data->backendEngines[it.first]->disconnect(remote_agent);
+    size_t restored = 0;
+    for (size_t i = 0; i < peer_cnt; ++i) {
+        const std::string peer = sd.getStr("Peer");
+        size_t blob_cnt;
+        if (peer.empty() || sd.getBuf("NumMD", &blob_cnt, sizeof(blob_cnt)) != NIXL_SUCCESS) {
+            NIXL_ERROR_FUNC << "error deserializing peer entry from checkpoint";
+            return NIXL_ERR_MISMATCH;
         }
 
-        data->remoteBackends.erase(remote_agent);
-        ret = NIXL_SUCCESS;
+        // A peer whose base blob fails still has its delta blobs consumed
+        // from the stream before moving on
+        bool peer_ok = true;
+        for (size_t j = 0; j < blob_cnt; ++j) {
+            const nixl_blob_t blob = sd.getStr("MD");
+            if (blob.empty()) {
+                NIXL_ERROR_FUNC << "error deserializing metadata blob from checkpoint";
+                return NIXL_ERR_MISMATCH;
+            }
+            if (!peer_ok)
+                continue;
+
+            std::string loaded_name;
+            const nixl_status_t load_ret = loadRemoteMD(blob, loaded_name);
+            if (load_ret != NIXL_SUCCESS) {
+                NIXL_WARN << "Skipping restore of peer '" << peer << "', blob " << j
+                          << " failed to load with status " << load_ret;
+                peer_ok = false;
+            }
+        }
+        if (peer_ok)
+            restored++;
     }
 
-    if (ret != NIXL_SUCCESS)
-        NIXL_ERROR_FUNC << "error invalidating remote metadata for agent '" << remote_agent
-                        << "' with status " << ret;
-    return ret;
+    NIXL_INFO << "Restored metadata of " << restored << "/" << peer_cnt
+              << " peers from checkpoint";
+    return NIXL_SUCCESS;
 }
 
 nixl_status_t
 nixlAgent::sendLocalMD (const nixl_opt_args_t* extra_params) const {
-    nixl_blob_t myMD;
-    nixl_status_t ret = getLocalMD(myMD);
+    // Socket-only push: overlap the serialization with the socket writes
+    // instead of building the full blob first. The shm side channel needs
+    // the assembled blob and the user-driven mode has nobody draining the
+    // stream concurrently, so both keep the path below.
+    if (extra_params && !extra_params->ipAddr.empty() && !data->useShmMD &&
+        !data->config.userDrivenComm) {
+        NIXL_SHARED_LOCK_GUARD(data->lock);
+        nixl_status_t ret = data->sendLocalMDStreamed(extra_params->ipAddr, extra_params->port);
+        if (ret < 0)
+            NIXL_ERROR_FUNC << "error streaming local metadata with status " << ret;
+        return ret;
+    }
+
+    nixl_md_ptr_t myMD;
+    nixl_status_t ret;
+    {
+        NIXL_SHARED_LOCK_GUARD(data->lock);
+        ret = data->getLocalMDLocked(myMD);
+    }
     if (ret < 0) {
         NIXL_ERROR_FUNC << "error getting local metadata with status " << ret;
         return ret;
     }
 
+    // Same-host fast path: publish into the shared memory segment in
+    // addition to (or instead of) the socket/etcd exchange
+    nixl_status_t shm_ret = NIXL_ERR_NOT_SUPPORTED;
+    if (data->useShmMD)
+        shm_ret = data->publishLocalMDShm(*myMD);
+
     // If IP is provided, use socket-based communication
     if (extra_params && !extra_params->ipAddr.empty()) {
-        data->enqueueCommWork(std::make_tuple(SOCK_SEND, extra_params->ipAddr, extra_params->port, std::move(myMD)));
+        data->enqueueCommWork(std::make_tuple(
+            SOCK_SEND, extra_params->ipAddr, extra_params->port, std::move(myMD), nullptr));
         return NIXL_SUCCESS;
     }
 
 #if HAVE_ETCD
     // If no IP is provided, use etcd (now via thread)
     if (data->useEtcd) {
-        data->enqueueCommWork(std::make_tuple(ETCD_SEND, default_metadata_label, 0, std::move(myMD)));
+        data->enqueueCommWork(
+            std::make_tuple(ETCD_SEND, default_metadata_label, 0, std::move(myMD), nullptr));
         return NIXL_SUCCESS;
     }
+#endif // HAVE_ETCD
+    if (shm_ret == NIXL_SUCCESS)
+        return NIXL_SUCCESS;
+#if HAVE_ETCD
     NIXL_ERROR_FUNC << "invalid parameters to be used for either socket or ETCD";
     return NIXL_ERR_INVALID_PARAM;
 #else
@@ -1730,7 +6807,9 @@ nixlAgent::sendLocalPartialMD(const nixl_reg_dlist_t &descs,
 
     // If IP is provided, use socket-based communication
     if (extra_params && !extra_params->ipAddr.empty()) {
-        data->enqueueCommWork(std::make_tuple(SOCK_SEND, extra_params->ipAddr, extra_params->port, std::move(myMD)));
+        data->enqueueCommWork(std::make_tuple(
+            SOCK_SEND, extra_params->ipAddr, extra_params->port,
+            std::make_shared<const nixl_blob_t>(std::move(myMD)), nullptr));
         return NIXL_SUCCESS;
     }
 
@@ -1741,7 +6820,57 @@ nixlAgent::sendLocalPartialMD(const nixl_reg_dlist_t &descs,
             NIXL_ERROR_FUNC << "metadata label is required for etcd send of local partial metadata";
             return NIXL_ERR_INVALID_PARAM;
         }
-        data->enqueueCommWork(std::make_tuple(ETCD_SEND, extra_params->metadataLabel, 0, std::move(myMD)));
+        data->enqueueCommWork(std::make_tuple(ETCD_SEND, extra_params->metadataLabel, 0,
+                                              std::make_shared<const nixl_blob_t>(std::move(myMD)),
+                                              nullptr));
+        return NIXL_SUCCESS;
+    }
+    NIXL_ERROR_FUNC << "invalid parameters to be used for either socket or ETCD";
+    return NIXL_ERR_INVALID_PARAM;
+#else
+    NIXL_ERROR_FUNC << "ETCD is not supported and socket information was not provided either";
+    return NIXL_ERR_NOT_SUPPORTED;
+#endif // HAVE_ETCD
+}
+
+nixl_status_t
+nixlAgent::sendLocalDeltaMD(const nixl_reg_dlist_t &added_descs,
+                            const nixl_reg_dlist_t &removed_descs,
+                            const nixl_opt_args_t* extra_params) const {
+    nixl_blob_t myMD;
+    nixl_status_t ret = getLocalDeltaMD(added_descs, removed_descs, myMD, extra_params);
+    if (ret < 0) {
+        NIXL_ERROR_FUNC << "error getting local metadata delta with status " << ret;
+        return ret;
+    }
+
+    // The shared memory segment always carries the full MD so a mapped
+    // read never depends on delta ordering; refresh it alongside the delta
+    if (data->useShmMD) {
+        nixl_md_ptr_t fullMD;
+        NIXL_SHARED_LOCK_GUARD(data->lock);
+        if (data->getLocalMDLocked(fullMD) == NIXL_SUCCESS)
+            data->publishLocalMDShm(*fullMD);
+    }
+
+    // If IP is provided, use socket-based communication
+    if (extra_params && !extra_params->ipAddr.empty()) {
+        data->enqueueCommWork(std::make_tuple(
+            SOCK_SEND, extra_params->ipAddr, extra_params->port,
+            std::make_shared<const nixl_blob_t>(std::move(myMD)), nullptr));
+        return NIXL_SUCCESS;
+    }
+
+#if HAVE_ETCD
+    // If no IP is provided, use etcd (now via thread)
+    if (data->useEtcd) {
+        if (!extra_params || extra_params->metadataLabel.empty()) {
+            NIXL_ERROR_FUNC << "metadata label is required for etcd send of local metadata delta";
+            return NIXL_ERR_INVALID_PARAM;
+        }
+        data->enqueueCommWork(std::make_tuple(ETCD_SEND, extra_params->metadataLabel, 0,
+                                              std::make_shared<const nixl_blob_t>(std::move(myMD)),
+                                              nullptr));
         return NIXL_SUCCESS;
     }
     NIXL_ERROR_FUNC << "invalid parameters to be used for either socket or ETCD";
@@ -1755,9 +6884,27 @@ nixlAgent::sendLocalPartialMD(const nixl_reg_dlist_t &descs,
 nixl_status_t
 nixlAgent::fetchRemoteMD (const std::string remote_name,
                           const nixl_opt_args_t* extra_params) {
+    // Same-host fast path: map the peer's shared memory segment and load
+    // its MD synchronously, skipping the comm thread round-trip. A miss
+    // (peer not colocated or not publishing) falls through to the
+    // socket/etcd paths below.
+    if (data->useShmMD && !remote_name.empty()) {
+        nixl_blob_t remote_md;
+        if (data->fetchRemoteMDShm(remote_name, remote_md) == NIXL_SUCCESS) {
+            std::string loaded_name;
+            nixl_status_t ret = loadRemoteMD(remote_md, loaded_name);
+            if (ret == NIXL_SUCCESS && loaded_name == remote_name)
+                return NIXL_SUCCESS;
+            NIXL_WARN << "Shared memory MD for agent '" << remote_name
+                      << "' could not be loaded (status " << ret
+                      << "), falling back to socket/etcd fetch";
+        }
+    }
+
     // If IP is provided, use socket-based communication
     if (extra_params && !extra_params->ipAddr.empty()) {
-        data->enqueueCommWork(std::make_tuple(SOCK_FETCH, extra_params->ipAddr, extra_params->port, ""));
+        data->enqueueCommWork(std::make_tuple(SOCK_FETCH, extra_params->ipAddr, extra_params->port,
+                                              std::make_shared<const nixl_blob_t>(), nullptr));
         return NIXL_SUCCESS;
     }
 
@@ -1767,7 +6914,9 @@ nixlAgent::fetchRemoteMD (const std::string remote_name,
         std::string metadata_label = extra_params && !extra_params->metadataLabel.empty() ?
                                      extra_params->metadataLabel :
                                      default_metadata_label;
-        data->enqueueCommWork(std::make_tuple(ETCD_FETCH, std::move(metadata_label), 0, remote_name));
+        data->enqueueCommWork(std::make_tuple(ETCD_FETCH, std::move(metadata_label), 0,
+                                              std::make_shared<const nixl_blob_t>(remote_name),
+                                              nullptr));
         return NIXL_SUCCESS;
     }
     NIXL_ERROR_FUNC << "invalid parameters to be used for either socket or ETCD";
@@ -1780,18 +6929,29 @@ nixlAgent::fetchRemoteMD (const std::string remote_name,
 
 nixl_status_t
 nixlAgent::invalidateLocalMD (const nixl_opt_args_t* extra_params) const {
+    // Withdraw the shared memory segment so colocated peers stop mapping
+    // stale metadata
+    if (data->useShmMD)
+        data->unlinkLocalMDShm();
+
     // If IP is provided, use socket-based communication
     if (extra_params && !extra_params->ipAddr.empty()) {
-        data->enqueueCommWork(std::make_tuple(SOCK_INVAL, extra_params->ipAddr, extra_params->port, ""));
+        data->enqueueCommWork(std::make_tuple(SOCK_INVAL, extra_params->ipAddr, extra_params->port,
+                                              std::make_shared<const nixl_blob_t>(), nullptr));
         return NIXL_SUCCESS;
     }
 
 #if HAVE_ETCD
     // If no IP is provided, use etcd via thread
     if (data->useEtcd) {
-        data->enqueueCommWork(std::make_tuple(ETCD_INVAL, "", 0, ""));
+        data->enqueueCommWork(std::make_tuple(
+            ETCD_INVAL, "", 0, std::make_shared<const nixl_blob_t>(), nullptr));
         return NIXL_SUCCESS;
     }
+#endif // HAVE_ETCD
+    if (data->useShmMD)
+        return NIXL_SUCCESS;
+#if HAVE_ETCD
     NIXL_ERROR_FUNC << "invalid parameters to be used for either socket or ETCD";
     return NIXL_ERR_INVALID_PARAM;
 #else
@@ -1803,17 +6963,21 @@ nixlAgent::invalidateLocalMD (const nixl_opt_args_t* extra_params) const {
 nixl_status_t
 nixlAgent::checkRemoteMD (const std::string remote_name,
                           const nixl_xfer_dlist_t &descs) const {
-    NIXL_LOCK_GUARD(data->lock);
-    if (data->remoteSections.count(remote_name) != 0) {
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    auto section_it = data->remoteSections.find(remote_name);
+    if (section_it != data->remoteSections.end()) {
         if (descs.descCount() == 0) {
             return NIXL_SUCCESS;
         } else {
             nixl_meta_dlist_t dummy(descs.getType());
-            // We only add to data->remoteBackends if data->backendEngines[backend] exists
-            for (const auto& [backend, conn_info] : data->remoteBackends[remote_name])
-                if (data->remoteSections[remote_name]->populate(
-                          descs, data->backendEngines[backend], dummy) == NIXL_SUCCESS)
-                    return NIXL_SUCCESS;
+            auto backends_it = data->remoteBackends.find(remote_name);
+            if (backends_it != data->remoteBackends.end()) {
+                // We only add to data->remoteBackends if data->backendEngines[backend] exists
+                for (const auto &[backend, conn_info] : backends_it->second)
+                    if (section_it->second->populate(
+                            descs, data->backendEngines.at(backend), dummy) == NIXL_SUCCESS)
+                        return NIXL_SUCCESS;
+            }
             dummy.clear();
         }
     }
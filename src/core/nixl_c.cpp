@@ -0,0 +1,175 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nixl_c.h"
+
+#include <string>
+#include <vector>
+
+#include "nixl.h"
+
+// Thin extern-C shim over the transfer hot path (see nixl_c.h). Scratch
+// state is thread local so the per-call work is free of steady-state
+// allocations: descriptor lists keep their capacity across calls, and the
+// notification view map owns the storage the returned pointers reference.
+
+namespace {
+
+// Flattened, partially drained notifications of the last getNotifsView
+// call on this thread; the backing view map must outlive the pointers
+// handed out through nixl_c_notif_t
+struct notifBacklog {
+    nixl_notifs_view_t views;
+    std::vector<nixl_c_notif_t> flat;
+    size_t cursor = 0;
+};
+
+bool
+validMemType(int mem_type) {
+    return mem_type >= DRAM_SEG && mem_type <= FILE_SEG;
+}
+
+} // namespace
+
+extern "C" {
+
+nixl_c_status_t
+nixl_c_xfer_create(nixl_c_agent_h agent,
+                   int op,
+                   const nixl_c_desc_t *local_descs,
+                   size_t local_count,
+                   int local_mem_type,
+                   const nixl_c_desc_t *remote_descs,
+                   size_t remote_count,
+                   int remote_mem_type,
+                   const char *remote_agent,
+                   size_t remote_agent_len,
+                   nixl_c_xfer_h *xfer_out) {
+    if (!agent || !xfer_out || !remote_agent || !local_descs || !remote_descs ||
+        local_count == 0 || remote_count == 0) {
+        return NIXL_C_ERR_INVALID_PARAM;
+    }
+    if ((op != NIXL_C_OP_READ && op != NIXL_C_OP_WRITE) || !validMemType(local_mem_type) ||
+        !validMemType(remote_mem_type)) {
+        return NIXL_C_ERR_INVALID_PARAM;
+    }
+
+    // Re-typing by assignment keeps the lists' heap capacity, so repeated
+    // calls on a thread stop allocating once the high-water mark is reached
+    static thread_local nixl_xfer_dlist_t local_list(DRAM_SEG);
+    static thread_local nixl_xfer_dlist_t remote_list(DRAM_SEG);
+    local_list = nixl_xfer_dlist_t(static_cast<nixl_mem_t>(local_mem_type));
+    remote_list = nixl_xfer_dlist_t(static_cast<nixl_mem_t>(remote_mem_type));
+
+    for (size_t i = 0; i < local_count; i++) {
+        local_list.addDesc(
+            nixlBasicDesc(local_descs[i].addr, local_descs[i].len, local_descs[i].dev_id));
+    }
+    for (size_t i = 0; i < remote_count; i++) {
+        remote_list.addDesc(
+            nixlBasicDesc(remote_descs[i].addr, remote_descs[i].len, remote_descs[i].dev_id));
+    }
+
+    nixlXferReqH *req = nullptr;
+    const nixl_status_t ret = static_cast<nixlAgent *>(agent)->createXferReq(
+        static_cast<nixl_xfer_op_t>(op),
+        local_list,
+        remote_list,
+        std::string(remote_agent, remote_agent_len),
+        req);
+    if (ret == NIXL_SUCCESS) {
+        *xfer_out = req;
+    }
+    return ret;
+}
+
+nixl_c_status_t
+nixl_c_xfer_post(nixl_c_agent_h agent,
+                 nixl_c_xfer_h xfer,
+                 const char *notif_msg,
+                 size_t notif_len) {
+    if (!agent || !xfer) {
+        return NIXL_C_ERR_INVALID_PARAM;
+    }
+
+    nixlXferReqH *req = static_cast<nixlXferReqH *>(xfer);
+    if (!notif_msg) {
+        return static_cast<nixlAgent *>(agent)->postXferReq(req);
+    }
+
+    static thread_local nixl_opt_args_t opt_args;
+    opt_args.hasNotif = true;
+    opt_args.notifMsg.assign(notif_msg, notif_len);
+    return static_cast<nixlAgent *>(agent)->postXferReq(req, &opt_args);
+}
+
+nixl_c_status_t
+nixl_c_xfer_status(nixl_c_agent_h agent, nixl_c_xfer_h xfer) {
+    if (!agent || !xfer) {
+        return NIXL_C_ERR_INVALID_PARAM;
+    }
+    return static_cast<nixlAgent *>(agent)->getXferStatus(static_cast<nixlXferReqH *>(xfer));
+}
+
+nixl_c_status_t
+nixl_c_xfer_release(nixl_c_agent_h agent, nixl_c_xfer_h xfer) {
+    if (!agent || !xfer) {
+        return NIXL_C_ERR_INVALID_PARAM;
+    }
+    return static_cast<nixlAgent *>(agent)->releaseXferReq(static_cast<nixlXferReqH *>(xfer));
+}
+
+nixl_c_status_t
+nixl_c_get_notifs(nixl_c_agent_h agent,
+                  nixl_c_notif_t *notifs,
+                  size_t capacity,
+                  size_t *count_out) {
+    if (!agent || !notifs || !count_out || capacity == 0) {
+        return NIXL_C_ERR_INVALID_PARAM;
+    }
+
+    static thread_local notifBacklog backlog;
+
+    // Only refetch once the previous batch is fully handed out, since the
+    // view map owns the strings the outstanding entries point into
+    if (backlog.cursor >= backlog.flat.size()) {
+        backlog.flat.clear();
+        backlog.cursor = 0;
+
+        const nixl_status_t ret =
+            static_cast<nixlAgent *>(agent)->getNotifsView(backlog.views);
+        if (ret != NIXL_SUCCESS) {
+            *count_out = 0;
+            return ret;
+        }
+
+        for (const auto &entry : backlog.views) {
+            for (const auto &msg : entry.second) {
+                backlog.flat.push_back(nixl_c_notif_t{
+                    entry.first.data(), entry.first.size(), msg.data(), msg.size()});
+            }
+        }
+    }
+
+    size_t count = 0;
+    while (count < capacity && backlog.cursor < backlog.flat.size()) {
+        notifs[count++] = backlog.flat[backlog.cursor++];
+    }
+    *count_out = count;
+    return NIXL_C_SUCCESS;
+}
+
+} // extern "C"
@@ -15,11 +15,13 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <fcntl.h>
 #include "nixl.h"
 #include "common/nixl_time.h"
 #include "common/str_tools.h"
 #include "agent_data.h"
+#include "common/nixl_affinity.h"
 #include "common/nixl_log.h"
 #if HAVE_ETCD
 #include <etcd/SyncClient.hpp>
@@ -27,7 +29,15 @@
 #include <future>
 #endif // HAVE_ETCD
 #include <absl/strings/str_format.h>
+#include <atomic>
+#include <deque>
+#include <netinet/tcp.h>
+#include <new>
 #include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 const std::string default_metadata_label = "metadata";
 
@@ -35,6 +45,27 @@ namespace {
 
 static const std::string invalid_label = "invalid";
 
+// Applies the configured TCP tuning to a connected comm socket; failures
+// only degrade performance, so they are logged and ignored
+void
+applySocketTuning(int fd, const nixlAgentConfig &config) {
+    if (config.sockSndBuf > 0 &&
+        setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &config.sockSndBuf, sizeof(config.sockSndBuf)) < 0)
+        NIXL_PERROR << "setsockopt(SO_SNDBUF) failed for comm socket fd " << fd;
+
+    if (config.sockRcvBuf > 0 &&
+        setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &config.sockRcvBuf, sizeof(config.sockRcvBuf)) < 0)
+        NIXL_PERROR << "setsockopt(SO_RCVBUF) failed for comm socket fd " << fd;
+
+    const int no_delay = config.sockNoDelay ? 1 : 0;
+    if (setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay)) < 0)
+        NIXL_PERROR << "setsockopt(TCP_NODELAY) failed for comm socket fd " << fd;
+
+    const int keep_alive = config.sockKeepAlive ? 1 : 0;
+    if (setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &keep_alive, sizeof(keep_alive)) < 0)
+        NIXL_PERROR << "setsockopt(SO_KEEPALIVE) failed for comm socket fd " << fd;
+}
+
 int connectToIP(std::string ip_addr, int port) {
 
     struct sockaddr_in listenerAddr;
@@ -97,14 +128,7 @@ int connectToIP(std::string ip_addr, int port) {
 }
 
 void
-sendCommMessage(int fd, const std::string& msg) {
-    size_t size = msg.size();
-    constexpr size_t iov_size = 2;
-    struct iovec iov[iov_size] = {
-        {&size, sizeof(size)},
-        {const_cast<char*>(msg.data()), msg.size()}
-    };
-
+sendCommIov(int fd, struct iovec *iov, size_t iov_size, size_t total) {
     for (size_t i = 0, offset = 0, sent = 0; i < iov_size;) {
         auto bytes = send(fd, static_cast<char *>(iov[i].iov_base) + offset, iov[i].iov_len - offset, 0);
         if (bytes < 0) {
@@ -116,7 +140,7 @@ sendCommMessage(int fd, const std::string& msg) {
                     absl::StrFormat("sendCommMessage(fd=%d) %zu/%zu bytes failed, errno=%d",
                                     fd,
                                     sent,
-                                    size + sizeof(size),
+                                    total + sizeof(total),
                                     errno));
         }
 
@@ -129,6 +153,33 @@ sendCommMessage(int fd, const std::string& msg) {
     }
 }
 
+void
+sendCommMessage(int fd, const std::string& msg) {
+    size_t size = msg.size();
+    constexpr size_t iov_size = 2;
+    struct iovec iov[iov_size] = {
+        {&size, sizeof(size)},
+        {const_cast<char*>(msg.data()), msg.size()}
+    };
+
+    sendCommIov(fd, iov, iov_size, size);
+}
+
+// Shared-ownership variant: the blob goes out as its own iov entry, so a
+// large MD payload is never concatenated into a temporary string
+void
+sendCommMessage(int fd, const std::string &header, const nixl_md_ptr_t &blob) {
+    size_t size = header.size() + blob->size();
+    constexpr size_t iov_size = 3;
+    struct iovec iov[iov_size] = {
+        {&size, sizeof(size)},
+        {const_cast<char*>(header.data()), header.size()},
+        {const_cast<char*>(blob->data()), blob->size()}
+    };
+
+    sendCommIov(fd, iov, iov_size, size);
+}
+
 bool
 recvCommMessageType(int fd, void *data, size_t size, bool force = false) {
     for (size_t received = 0; received < size;) {
@@ -178,13 +229,78 @@ recvCommMessage(int fd, std::string &msg) {
     return recvCommMessageType(fd, msg.data(), size, true);
 }
 
+// Chunked streaming for large payloads: a message bigger than one frame is
+// sent as a sequence of FRAG messages, each carrying the logical total and
+// this chunk's offset, and the comm loop pumps one frame per peer per pass.
+// A 50MB MD push thus never holds the listener thread for the whole blob
+// while other peers wait on a fetch. The receiver reassembles per peer and
+// runs the completed payload through the normal command path.
+constexpr size_t md_frame_size = 1 << 20;
+const std::string frag_label = "NIXLCOMM:FRAG";
+constexpr size_t frag_hdr_size = 2 * sizeof(uint64_t); // total, offset
+
+// Sentinel total for frames of a streamed send, whose full size is not
+// known until the producer finishes serializing; the final frame carries
+// the real total
+constexpr uint64_t frag_total_unknown = UINT64_MAX;
+
+// One queued outbound message; the blob stays shared, frames are cut from
+// it on the fly so nothing large is ever copied up front. A streamed send
+// has no blob: its payload arrives chunk by chunk from the serializing
+// thread and each chunk goes out as one frame.
+struct nixlPendingSend {
+    std::string header;
+    nixl_md_ptr_t blob; // may be empty for header-only messages
+    nixl_md_stream_ptr_t stream; // exclusive with blob
+    size_t offset = 0;
+
+    size_t
+    total() const {
+        return header.size() + (blob ? blob->size() : 0);
+    }
+
+    // True when a frame can be cut right now; a streamed send whose
+    // producer has not caught up yet has to wait for the next chunk
+    bool
+    ready() const {
+        return !stream || stream->hasData();
+    }
+};
+
+// Same-host metadata segment: a per-agent POSIX shm object holding the
+// agent's serialized MD behind a seqlock, so colocated peers can map and
+// copy it directly instead of going through a socket or etcd round-trip.
+// The segment only ever grows, so a reader that mapped an older (larger
+// or equal) size never faults; a torn read is caught by the sequence
+// recheck and retried.
+struct nixlMDShmHeader {
+    std::atomic<uint64_t> seq; // odd while the writer is copying
+    uint64_t size; // bytes of serialized MD following the header
+};
+
+std::string
+mdShmName(const std::string &agent_name) {
+    std::string name = "/nixl_md_" + agent_name;
+    // shm object names must not contain further slashes
+    std::replace(name.begin() + 1, name.end(), '/', '_');
+    return name;
+}
+
 #if HAVE_ETCD
 class nixlEtcdClient {
 private:
     std::unique_ptr<etcd::SyncClient> etcd;
     std::string namespace_prefix;
     std::vector<std::string> invalidated_agents;
+    // Agents whose metadata was re-published, with the new blob, queued by
+    // the watcher threads for an incremental reload in commWorker
+    std::vector<std::pair<std::string, nixl_blob_t>> updated_agents;
     std::mutex invalidated_agents_mutex;
+    // Local copy of fetched metadata, keyed by full etcd key and kept
+    // current by the agent watchers, so repeated fetches do not re-read
+    // full blobs from etcd
+    std::unordered_map<std::string, nixl_blob_t> md_cache;
+    std::mutex md_cache_mutex;
     std::unordered_map<std::string, std::unique_ptr<etcd::Watcher>,
                         std::hash<std::string>, strEqual> agentWatchers;
     std::chrono::microseconds watchTimeout_;
@@ -294,6 +410,19 @@ public:
         }
 
         std::string metadata_key = makeKey(agent_name, metadata_type);
+
+        // The watcher keeps cached entries current, so a hit is as fresh
+        // as a round-trip to etcd
+        {
+            std::lock_guard<std::mutex> lock(md_cache_mutex);
+            auto cached = md_cache.find(metadata_key);
+            if (cached != md_cache.end()) {
+                metadata = cached->second;
+                NIXL_DEBUG << "Serving key from local cache: " << metadata_key;
+                return NIXL_SUCCESS;
+            }
+        }
+
         try {
             etcd::Response response = etcd->get(metadata_key);
 
@@ -301,6 +430,8 @@ public:
                 metadata = response.value().as_string();
                 NIXL_DEBUG << "Successfully fetched key: " << metadata_key
                            << " (rev " << response.value().modified_index() << ")";
+                std::lock_guard<std::mutex> lock(md_cache_mutex);
+                md_cache[metadata_key] = metadata;
                 return NIXL_SUCCESS;
             } else {
                 NIXL_ERROR << "Failed to fetch key: " << metadata_key << " from etcd: " << response.error_message();
@@ -375,7 +506,12 @@ public:
         std::string metadata_key = makeKey(remote_agent, metadata_label);
         NIXL_DEBUG << "Metadata not found, setting up watch for: " << metadata_key;
 
-        return waitForMetadataFromEtcd(metadata_key, remote_metadata);
+        ret = waitForMetadataFromEtcd(metadata_key, remote_metadata);
+        if (ret == NIXL_SUCCESS) {
+            std::lock_guard<std::mutex> lock(md_cache_mutex);
+            md_cache[metadata_key] = remote_metadata;
+        }
+        return ret;
     }
 
     // Setup a watcher for an agent's metadata invalidation if it doesn't already exist
@@ -403,6 +539,19 @@ public:
                            << " (rev " << event.kv().modified_index() << ")";
                 std::lock_guard<std::mutex> lock(invalidated_agents_mutex);
                 invalidated_agents.push_back(agent_name);
+            } else if (event.event_type() == etcd::Event::EventType::PUT) {
+                // Re-published metadata: refresh the cache and queue an
+                // incremental reload for just this agent, instead of the
+                // peers re-reading the full blob from etcd
+                NIXL_DEBUG << "Watcher PUT: " << event.kv().key()
+                           << " (rev " << event.kv().modified_index() << ")";
+                nixl_blob_t new_md = event.kv().as_string();
+                {
+                    std::lock_guard<std::mutex> lock(md_cache_mutex);
+                    md_cache[event.kv().key()] = new_md;
+                }
+                std::lock_guard<std::mutex> lock(invalidated_agents_mutex);
+                updated_agents.emplace_back(agent_name, std::move(new_md));
             } else {
                 NIXL_ERROR << "Watcher for " << event.kv().key() << " received unexpected event from etcd: "
                            << event.event_type();
@@ -413,74 +562,328 @@ public:
         agentWatchers[agent_name] = std::make_unique<etcd::Watcher>(*etcd, agent_prefix, process_response);
     }
 
-    // Process invalidated agents from watchers
-    void processInvalidatedAgents(nixlAgent* my_agent) {
+    // Process invalidations and metadata updates queued by the watchers
+    void processWatcherEvents(nixlAgent* my_agent) {
         std::vector<std::string> tmp_invalidated_agents;
+        std::vector<std::pair<std::string, nixl_blob_t>> tmp_updated_agents;
         {
             std::lock_guard<std::mutex> lock(invalidated_agents_mutex);
             tmp_invalidated_agents = std::move(invalidated_agents);
+            tmp_updated_agents = std::move(updated_agents);
         }
         for (const auto &agent : tmp_invalidated_agents) {
             NIXL_DEBUG << "Invalidated agent: " << agent;
             agentWatchers.erase(agent);
+            dropCachedAgent(agent);
             nixl_status_t ret = my_agent->invalidateRemoteMD(agent);
             if (ret != NIXL_SUCCESS)
                 NIXL_ERROR << "Failed to invalidate remote metadata for agent: " << agent << ": " << ret;
             else
                 NIXL_DEBUG << "Successfully invalidated remote metadata for agent: " << agent;
         }
+        for (const auto &[agent, md] : tmp_updated_agents) {
+            std::string loaded_name;
+            nixl_status_t ret = my_agent->loadRemoteMD(md, loaded_name);
+            if (ret != NIXL_SUCCESS)
+                NIXL_ERROR << "Failed to reload updated metadata for agent: " << agent << ": " << ret;
+            else
+                NIXL_DEBUG << "Reloaded updated metadata for agent: " << agent;
+        }
+    }
+
+    // Drop all cached keys under an agent's prefix
+    void dropCachedAgent(const std::string &agent_name) {
+        const std::string prefix = makeKey(agent_name, "");
+        std::lock_guard<std::mutex> lock(md_cache_mutex);
+        for (auto it = md_cache.begin(); it != md_cache.end();) {
+            if (it->first.compare(0, prefix.size(), prefix) == 0)
+                it = md_cache.erase(it);
+            else
+                ++it;
+        }
     }
 };
 #endif // HAVE_ETCD
 
+// Adds a socket to the comm epoll set; hard failure, since a socket
+// outside the set would silently never be progressed
+void
+epollAdd(int epoll_fd, int fd, uint32_t events) {
+    struct epoll_event ev;
+    ev.events = events;
+    ev.data.fd = fd;
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0)
+        throw std::runtime_error("epoll_ctl add failed in comm thread");
+}
+
+// Sends the next chunk of a streamed message as one frame; returns true
+// when the message is done. Interim frames carry the frag_total_unknown
+// sentinel since the real size only exists once the producer finishes.
+bool
+sendNextStreamFrame(int fd, nixlPendingSend &ps) {
+    std::string chunk;
+    bool final = false;
+    if (!ps.stream->pop(chunk, final))
+        return false; // nothing to cut yet, the frame stays queued
+
+    const uint64_t wire_total =
+        final ? ps.header.size() + ps.stream->produced() : frag_total_unknown;
+    const uint64_t wire_offset = ps.offset;
+
+    std::string frame;
+    frame.reserve(frag_label.size() + frag_hdr_size + ps.header.size() + chunk.size());
+    frame.append(frag_label);
+    frame.append(reinterpret_cast<const char *>(&wire_total), sizeof(wire_total));
+    frame.append(reinterpret_cast<const char *>(&wire_offset), sizeof(wire_offset));
+    // The command header leads the first chunk so the reassembled payload
+    // runs through the normal command path
+    if (ps.offset == 0)
+        frame.append(ps.header);
+    frame.append(chunk);
+
+    sendCommMessage(fd, frame);
+    ps.offset += (ps.offset == 0 ? ps.header.size() : 0) + chunk.size();
+    return final;
+}
+
+// Sends the next frame of ps; returns true when the message is done
+bool
+sendNextFrame(int fd, nixlPendingSend &ps) {
+    if (ps.stream)
+        return sendNextStreamFrame(fd, ps);
+
+    const size_t total = ps.total();
+    const size_t len = std::min(md_frame_size, total - ps.offset);
+
+    std::string frame;
+    frame.reserve(frag_label.size() + frag_hdr_size + len);
+    frame.append(frag_label);
+    const uint64_t wire_total = total, wire_offset = ps.offset;
+    frame.append(reinterpret_cast<const char *>(&wire_total), sizeof(wire_total));
+    frame.append(reinterpret_cast<const char *>(&wire_offset), sizeof(wire_offset));
+
+    // The chunk may straddle the header/blob boundary
+    for (size_t pos = ps.offset, end = ps.offset + len; pos < end;) {
+        if (pos < ps.header.size()) {
+            const size_t n = std::min(end, ps.header.size()) - pos;
+            frame.append(ps.header.data() + pos, n);
+            pos += n;
+        } else {
+            const size_t n = end - pos;
+            frame.append(ps.blob->data() + (pos - ps.header.size()), n);
+            pos += n;
+        }
+    }
+
+    sendCommMessage(fd, frame);
+    ps.offset += len;
+    return ps.offset == total;
+}
+
 } // unnamed namespace
 
-void nixlAgentData::commWorker(nixlAgent* myAgent){
+// Comm loop state, shared between the listener-thread mode (owned across
+// commWorker) and the user-driven mode (owned by the agent and pumped from
+// progressControlPlane). Complete only in this translation unit.
+struct nixlCommState {
+    // The loop blocks in epoll_wait instead of spinning over the sockets:
+    // enqueueCommWork wakes it through commWakeupFd, the listening socket is
+    // level triggered, and remote sockets are edge triggered and fully
+    // drained on each event
+    int epoll_fd = -1;
+
+    // Reverse map of remoteSockets for event handling and logging
+    std::map<int, nixl_socket_peer_t> fdToPeer;
+
+    // Outbound messages being streamed in frames, per peer socket; later
+    // messages to the same peer queue behind so per-peer order is kept
+    std::map<int, std::deque<nixlPendingSend>> pendingSends;
+
+    // Inbound per-peer reassembly of FRAG sequences
+    struct nixlFragReassembly {
+        size_t total = 0;
+        std::string buf;
+    };
+    std::map<int, nixlFragReassembly> fragBufs;
+
+#if HAVE_ETCD
+    std::unique_ptr<nixlEtcdClient> etcdClient;
+#endif // HAVE_ETCD
+};
+
+namespace {
+
+// Small messages with no backlog go out directly; anything else is
+// queued for frame-by-frame streaming from the pump in progressCommOnce
+void
+queueCommSend(nixlCommState &st, int fd, std::string header, nixl_md_ptr_t blob = nullptr) {
+    const size_t total = header.size() + (blob ? blob->size() : 0);
+    auto pending = st.pendingSends.find(fd);
+    if (pending == st.pendingSends.end() && total <= md_frame_size) {
+        if (blob)
+            sendCommMessage(fd, header, blob);
+        else
+            sendCommMessage(fd, header);
+        return;
+    }
+    st.pendingSends[fd].push_back({std::move(header), std::move(blob)});
+}
+
+} // unnamed namespace
+
+void
+nixlAgentData::setupCommState() {
+    auto st = std::make_unique<nixlCommState>();
 
 #if HAVE_ETCD
-    std::unique_ptr<nixlEtcdClient> etcdClient = nullptr;
     // useEtcd is set in nixlAgent constructor and is true if NIXL_ETCD_ENDPOINTS is set
-    if(useEtcd) {
-        etcdClient = std::make_unique<nixlEtcdClient>(name, config.etcdWatchTimeout);
+    if (useEtcd) {
+        st->etcdClient = std::make_unique<nixlEtcdClient>(name, config.etcdWatchTimeout);
     }
 #endif // HAVE_ETCD
 
+    st->epoll_fd = epoll_create1(0);
+    if (st->epoll_fd < 0)
+        throw std::runtime_error("epoll_create1 failed for comm thread");
+
+    epollAdd(st->epoll_fd, commWakeupFd, EPOLLIN);
+    if (config.useListenThread)
+        epollAdd(st->epoll_fd, listener->getFd(), EPOLLIN);
+
+    commState = st.release();
+}
+
+void
+nixlAgentData::teardownCommState() {
+    if (!commState)
+        return;
+    if (commState->epoll_fd >= 0)
+        close(commState->epoll_fd);
+    delete commState;
+    commState = nullptr;
+}
+
+void nixlAgentData::commWorker(nixlAgent* myAgent){
+
+    nixlAffinity::applyToSelf(config.listenerCpuset);
+
+    setupCommState();
+
     while(!(commThreadStop)) {
-        std::vector<nixl_comm_req_t> work_queue;
-
-        // first, accept new connections
-        int new_fd = 0;
-
-        while(new_fd != -1 && config.useListenThread) {
-            new_fd = listener->acceptClient();
-            nixl_socket_peer_t accepted_client;
-
-            if(new_fd != -1){
-                // need to convert fd to IP address and add to client map
-                sockaddr_in client_address;
-                socklen_t client_addrlen = sizeof(client_address);
-                if (getpeername(new_fd, (sockaddr*)&client_address, &client_addrlen) == 0) {
-                    char client_ip[INET_ADDRSTRLEN];
-                    if (inet_ntop(AF_INET, &client_address.sin_addr, client_ip, INET_ADDRSTRLEN) ==
-                        nullptr) {
-                        NIXL_PERROR << "inet_ntop failed for client address";
-                        close(new_fd);
-                        throw std::runtime_error("inet_ntop failed for client address");
-                    }
-                    accepted_client.first = std::string(client_ip);
-                    accepted_client.second = client_address.sin_port;
-                } else {
-                    throw std::runtime_error("getpeername failed");
-                }
-                remoteSockets[accepted_client] = new_fd;
+#if HAVE_ETCD
+        // Bounded wait when etcd is in use, so agent invalidations coming
+        // from the watcher threads are processed in a timely manner
+        int timeout_ms =
+            commState->etcdClient ? std::max<int>(1, config.lthrDelay / 1000) : -1;
+#else
+        int timeout_ms = -1;
+#endif // HAVE_ETCD
+        progressCommOnce(myAgent, timeout_ms);
+    }
 
-                // make new socket nonblocking
-                int new_flags = fcntl(new_fd, F_GETFL, 0) | O_NONBLOCK;
+    teardownCommState();
+}
 
-                if (fcntl(new_fd, F_SETFL, new_flags) == -1)
-                    throw std::runtime_error("fcntl accept");
+// One pass of the comm loop: wait up to timeout_ms for socket events, then
+// run queued agent commands, drain readable peers, and pump pending frames
+void
+nixlAgentData::progressCommOnce(nixlAgent *myAgent, int timeout_ms) {
+    nixlCommState &st = *commState;
+    const int epoll_fd = st.epoll_fd;
+    auto &fdToPeer = st.fdToPeer;
+    auto &pendingSends = st.pendingSends;
+    auto &fragBufs = st.fragBufs;
+
+    constexpr int max_events = 64;
+    struct epoll_event events[max_events];
+
+    std::vector<nixl_comm_req_t> work_queue;
+
+    // Keep pumping frames of in-progress sends without blocking; a
+    // streamed send whose producer has not caught up yet waits in epoll
+    // instead, the producer wakes the loop through commWakeupFd per chunk
+    for (const auto &entry : pendingSends) {
+        if (!entry.second.empty() && entry.second.front().ready()) {
+            timeout_ms = 0;
+            break;
+        }
+    }
+    int nfds = epoll_wait(epoll_fd, events, max_events, timeout_ms);
+    if (nfds < 0) {
+        if (errno == EINTR)
+            return;
+        throw std::runtime_error("epoll_wait failed in comm thread");
+    }
+
+    {
+        std::vector<int> ready_socks;
+        for (int i = 0; i < nfds; ++i) {
+            int event_fd = events[i].data.fd;
+
+            if (event_fd == commWakeupFd) {
+                uint64_t val;
+                while (read(commWakeupFd, &val, sizeof(val)) > 0);
+                continue; // command queue is drained below
+            }
 
+            if (config.useListenThread && event_fd == listener->getFd()) {
+                // accept new connections
+                int new_fd = 0;
+
+                while(new_fd != -1) {
+                    new_fd = listener->acceptClient();
+                    nixl_socket_peer_t accepted_client;
+
+                    if(new_fd != -1){
+                        // need to convert fd to IP address and add to client map
+                        sockaddr_in client_address;
+                        socklen_t client_addrlen = sizeof(client_address);
+                        if (getpeername(new_fd, (sockaddr*)&client_address, &client_addrlen) == 0) {
+                            char client_ip[INET_ADDRSTRLEN];
+                            if (inet_ntop(AF_INET, &client_address.sin_addr, client_ip,
+                                          INET_ADDRSTRLEN) == nullptr) {
+                                NIXL_PERROR << "inet_ntop failed for client address";
+                                close(new_fd);
+                                throw std::runtime_error("inet_ntop failed for client address");
+                            }
+                            accepted_client.first = std::string(client_ip);
+                            accepted_client.second = client_address.sin_port;
+                        } else {
+                            throw std::runtime_error("getpeername failed");
+                        }
+                        remoteSockets[accepted_client] = new_fd;
+                        fdToPeer[new_fd] = accepted_client;
+
+                        // make new socket nonblocking
+                        int new_flags = fcntl(new_fd, F_GETFL, 0) | O_NONBLOCK;
+
+                        if (fcntl(new_fd, F_SETFL, new_flags) == -1)
+                            throw std::runtime_error("fcntl accept");
+
+                        applySocketTuning(new_fd, config);
+                        epollAdd(epoll_fd, new_fd, EPOLLIN | EPOLLET | EPOLLRDHUP);
+                    }
+                }
+                continue;
+            }
+
+            if (events[i].events & (EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+                // Peer went away, drop the socket
+                epoll_ctl(epoll_fd, EPOLL_CTL_DEL, event_fd, nullptr);
+                close(event_fd);
+                pendingSends.erase(event_fd);
+                fragBufs.erase(event_fd);
+                auto peer_it = fdToPeer.find(event_fd);
+                if (peer_it != fdToPeer.end()) {
+                    NIXL_DEBUG << "Dropping disconnected peer " << peer_it->second.first
+                               << ":" << peer_it->second.second;
+                    remoteSockets.erase(peer_it->second);
+                    fdToPeer.erase(peer_it);
+                }
+                continue;
             }
+
+            ready_socks.push_back(event_fd);
         }
 
         // second, do agent commands
@@ -489,7 +892,7 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
         for(const auto &request: work_queue) {
 
             // TODO: req_ip and req_port are relevant only for SOCK_*, need different request structure for ETCD_*
-            const auto &[req_command, req_ip, req_port, my_MD] = request;
+            const auto &[req_command, req_ip, req_port, my_MD, md_stream] = request;
 
             nixl_socket_peer_t req_sock = std::make_pair(req_ip, req_port);
 
@@ -507,6 +910,9 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
                         continue;
                     }
                     remoteSockets[req_sock] = new_client;
+                    fdToPeer[new_client] = req_sock;
+                    applySocketTuning(new_client, config);
+                    epollAdd(epoll_fd, new_client, EPOLLIN | EPOLLET | EPOLLRDHUP);
                     client_fd = new_client;
                 } else {
                     client_fd = client->second;
@@ -515,15 +921,22 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
 
             switch(req_command) {
             case SOCK_SEND: {
-                sendCommMessage(client_fd, "NIXLCOMM:LOAD" + my_MD);
+                // A streamed send always goes through the frame pump: the
+                // blob does not exist yet, chunks arrive as the producer
+                // serializes
+                if (md_stream)
+                    st.pendingSends[client_fd].push_back(
+                        {"NIXLCOMM:LOAD", nullptr, md_stream});
+                else
+                    queueCommSend(st, client_fd, "NIXLCOMM:LOAD", my_MD);
                 break;
             }
             case SOCK_FETCH: {
-                sendCommMessage(client_fd, "NIXLCOMM:SEND");
+                queueCommSend(st, client_fd, "NIXLCOMM:SEND");
                 break;
             }
             case SOCK_INVAL: {
-                sendCommMessage(client_fd, "NIXLCOMM:INVL" + name);
+                queueCommSend(st, client_fd, "NIXLCOMM:INVL" + name);
                 break;
             }
 #if HAVE_ETCD
@@ -538,7 +951,7 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
                     const std::string &metadata_label = req_ip;
 
                     // Use local storeMetadataInEtcd function
-                    nixl_status_t ret = etcdClient->storeMetadataInEtcd(name, metadata_label, my_MD);
+                    nixl_status_t ret = etcdClient->storeMetadataInEtcd(name, metadata_label, *my_MD);
                     if (ret != NIXL_SUCCESS) {
                         NIXL_ERROR << "Failed to store metadata in etcd: " << ret;
                     }
@@ -551,7 +964,7 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
                     }
 
                     const std::string &metadata_label = req_ip;
-                    const std::string &remote_agent = my_MD;
+                    const std::string &remote_agent = *my_MD;
 
                     // First try a direct get
                     nixl_blob_t remote_metadata;
@@ -598,72 +1011,166 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
             }
         }
 
-        // third, do remote commands
-        auto socket_iter = remoteSockets.begin();
-        while (socket_iter != remoteSockets.end()) {
+        // third, do remote commands on the sockets that became readable;
+        // edge triggered, so each socket is drained until it has no more
+        // complete messages
+        for (const auto &sock_fd : ready_socks) {
+            const nixl_socket_peer_t &peer = fdToPeer[sock_fd];
             std::string commands;
             std::vector<std::string> command_list;
             nixl_status_t ret;
 
-            if (!recvCommMessage(socket_iter->second, commands)) {
-                socket_iter++;
-                continue;
-            }
-
-            command_list = str_split_substr(commands, "NIXLCOMM:");
-
-            for(const auto &command : command_list) {
-
-                if(command.size() < 4) continue;
-
-                // always just 4 chars:
-                std::string header = command.substr(0, 4);
+            while (recvCommMessage(sock_fd, commands)) {
 
-                if(header == "LOAD") {
-                    std::string remote_md = command.substr(4);
-                    std::string remote_agent;
-                    ret = myAgent->loadRemoteMD(remote_md, remote_agent);
-                    if(ret != NIXL_SUCCESS) {
-                        NIXL_ERROR << "loadRemoteMD in listener thread failed for md from peer "
-                                   << socket_iter->first.first << ":" << socket_iter->first.second
-                                   << " with error " << ret;
+                // Reassemble a chunked message; the completed payload falls
+                // through to the normal command path
+                if (commands.compare(0, frag_label.size(), frag_label) == 0) {
+                    if (commands.size() < frag_label.size() + frag_hdr_size) {
+                        NIXL_ERROR << "Truncated FRAG frame from peer " << peer.first << ":"
+                                   << peer.second;
                         continue;
                     }
-                    // not sure what to do with remote_agent
-                } else if(header == "SEND") {
-                    nixl_blob_t my_MD;
-                    myAgent->getLocalMD(my_MD);
-
-                    sendCommMessage(socket_iter->second, std::string("NIXLCOMM:LOAD" + my_MD));
-                } else if(header == "INVL") {
-                    std::string remote_agent = command.substr(4);
-                    myAgent->invalidateRemoteMD(remote_agent);
-                    break;
-                } else {
-                    NIXL_ERROR << "Received socket message with bad header" + header + " from peer "
-                               << socket_iter->first.first << ":" << socket_iter->first.second;
+                    uint64_t total, offset;
+                    memcpy(&total, commands.data() + frag_label.size(), sizeof(total));
+                    memcpy(&offset,
+                           commands.data() + frag_label.size() + sizeof(total),
+                           sizeof(offset));
+
+                    auto &reasm = fragBufs[sock_fd];
+                    if (offset == 0) {
+                        reasm.total = total;
+                        reasm.buf.clear();
+                        if (total != frag_total_unknown)
+                            reasm.buf.reserve(total);
+                    }
+                    // A streamed send carries the sentinel until its final
+                    // frame reveals the real total
+                    if (reasm.buf.size() != offset ||
+                        (reasm.total != total && reasm.total != frag_total_unknown)) {
+                        NIXL_ERROR << "Out-of-sequence FRAG frame from peer " << peer.first
+                                   << ":" << peer.second << ", dropping reassembly";
+                        fragBufs.erase(sock_fd);
+                        continue;
+                    }
+                    reasm.total = total;
+                    reasm.buf.append(commands, frag_label.size() + frag_hdr_size,
+                                     std::string::npos);
+                    if (reasm.total == frag_total_unknown || reasm.buf.size() < reasm.total)
+                        continue;
+                    commands = std::move(reasm.buf);
+                    fragBufs.erase(sock_fd);
+                }
+
+                command_list = str_split_substr(commands, "NIXLCOMM:");
+
+                for(const auto &command : command_list) {
+
+                    if(command.size() < 4) continue;
+
+                    // always just 4 chars:
+                    std::string header = command.substr(0, 4);
+
+                    if(header == "LOAD") {
+                        std::string remote_md = command.substr(4);
+                        std::string remote_agent;
+                        ret = myAgent->loadRemoteMD(remote_md, remote_agent);
+                        if(ret != NIXL_SUCCESS) {
+                            NIXL_ERROR << "loadRemoteMD in listener thread failed for md from peer "
+                                       << peer.first << ":" << peer.second
+                                       << " with error " << ret;
+                            // A rejected metadata delta (gap or unknown base) is
+                            // resynced by requesting the peer's full metadata
+                            if (ret == NIXL_ERR_MISMATCH || ret == NIXL_ERR_NOT_FOUND)
+                                queueCommSend(st, sock_fd, "NIXLCOMM:SEND");
+                            continue;
+                        }
+                        // not sure what to do with remote_agent
+                    } else if(header == "SEND") {
+                        nixl_md_ptr_t my_MD;
+                        {
+                            NIXL_SHARED_LOCK_GUARD(lock);
+                            ret = getLocalMDLocked(my_MD);
+                        }
+                        if (ret != NIXL_SUCCESS) {
+                            NIXL_ERROR << "getLocalMD in listener thread failed for peer "
+                                       << peer.first << ":" << peer.second
+                                       << " with error " << ret;
+                            continue;
+                        }
+
+                        queueCommSend(st, sock_fd, "NIXLCOMM:LOAD", my_MD);
+                    } else if(header == "INVL") {
+                        std::string remote_agent = command.substr(4);
+                        myAgent->invalidateRemoteMD(remote_agent);
+                        break;
+                    } else {
+                        NIXL_ERROR << "Received socket message with bad header" + header
+                                   << " from peer " << peer.first << ":" << peer.second;
+                    }
                 }
             }
+        }
 
-            socket_iter++;
+        // Pump pending sends: one frame per peer per pass, so concurrently
+        // streamed messages interleave instead of going out back-to-back
+        for (auto it = pendingSends.begin(); it != pendingSends.end();) {
+            auto &queue = it->second;
+            if (!queue.empty() && sendNextFrame(it->first, queue.front()))
+                queue.pop_front();
+            it = queue.empty() ? pendingSends.erase(it) : std::next(it);
         }
 
 #if HAVE_ETCD
-        if (etcdClient) {
-            etcdClient->processInvalidatedAgents(myAgent);
+        if (st.etcdClient) {
+            st.etcdClient->processWatcherEvents(myAgent);
         }
 #endif // HAVE_ETCD
+    }
+}
 
-        nixlTime::us_t start = nixlTime::getUs();
-        while( (start + config.lthrDelay) > nixlTime::getUs()) {
-            std::this_thread::yield();
-        }
+nixl_status_t
+nixlAgent::progressControlPlane() {
+    if (!data->config.userDrivenComm || !data->commState) {
+        NIXL_ERROR_FUNC << "agent was not configured for user-driven comm progress";
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    try {
+        data->progressCommOnce(this, 0);
+    }
+    catch (const std::exception &e) {
+        NIXL_ERROR_FUNC << "control plane progress failed: " << e.what();
+        return NIXL_ERR_BACKEND;
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::getControlPlaneFd(int &fd) const {
+    if (!data->config.userDrivenComm || !data->commState) {
+        NIXL_ERROR_FUNC << "agent was not configured for user-driven comm progress";
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    fd = data->commState->epoll_fd;
+    return NIXL_SUCCESS;
+}
+
+// Wake the comm thread out of epoll_wait
+void nixlAgentData::wakeCommThread(){
+    if (commWakeupFd >= 0) {
+        uint64_t val = 1;
+        if (write(commWakeupFd, &val, sizeof(val)) != sizeof(val))
+            NIXL_PERROR << "failed to wake up comm thread";
     }
 }
 
 void nixlAgentData::enqueueCommWork(nixl_comm_req_t request){
-    std::lock_guard<std::mutex> lock(commLock);
-    commQueue.push_back(std::move(request));
+    {
+        std::lock_guard<std::mutex> lock(commLock);
+        commQueue.push_back(std::move(request));
+    }
+    wakeCommThread();
 }
 
 void nixlAgentData::getCommWork(std::vector<nixl_comm_req_t> &req_list){
@@ -672,6 +1179,115 @@ void nixlAgentData::getCommWork(std::vector<nixl_comm_req_t> &req_list){
     commQueue.clear();
 }
 
+nixl_status_t
+nixlAgentData::publishLocalMDShm(const nixl_blob_t &md) {
+    const std::string shm_name = mdShmName(name);
+
+    int fd = shm_open(shm_name.c_str(), O_CREAT | O_RDWR, 0600);
+    if (fd < 0) {
+        NIXL_PERROR << "shm_open failed for metadata segment " << shm_name;
+        return NIXL_ERR_BACKEND;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        NIXL_PERROR << "fstat failed for metadata segment " << shm_name;
+        close(fd);
+        return NIXL_ERR_BACKEND;
+    }
+
+    const bool fresh = (st.st_size == 0);
+    const size_t needed = sizeof(nixlMDShmHeader) + md.size();
+    // Grow-only, so concurrent readers that mapped the previous size
+    // cannot fault on a shrunk object
+    const size_t total = std::max<size_t>(needed, st.st_size);
+    if (total > static_cast<size_t>(st.st_size) && ftruncate(fd, total) < 0) {
+        NIXL_PERROR << "ftruncate failed for metadata segment " << shm_name;
+        close(fd);
+        return NIXL_ERR_BACKEND;
+    }
+
+    void *addr = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        NIXL_PERROR << "mmap failed for metadata segment " << shm_name;
+        return NIXL_ERR_BACKEND;
+    }
+
+    auto *hdr = static_cast<nixlMDShmHeader *>(addr);
+    if (fresh)
+        new (hdr) nixlMDShmHeader{};
+
+    // Seqlock write: odd sequence marks the copy in progress
+    const uint64_t seq = hdr->seq.load(std::memory_order_relaxed);
+    hdr->seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    hdr->size = md.size();
+    memcpy(reinterpret_cast<char *>(hdr + 1), md.data(), md.size());
+    std::atomic_thread_fence(std::memory_order_release);
+    hdr->seq.store(seq + 2, std::memory_order_relaxed);
+
+    munmap(addr, total);
+    NIXL_DEBUG << "Published " << md.size() << " bytes of local MD to " << shm_name;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgentData::fetchRemoteMDShm(const std::string &remote_name, nixl_blob_t &md) {
+    const std::string shm_name = mdShmName(remote_name);
+
+    int fd = shm_open(shm_name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        // The peer is not colocated or has not published; callers fall
+        // back to the socket or etcd path
+        NIXL_DEBUG << "No metadata segment " << shm_name << " for agent " << remote_name;
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || static_cast<size_t>(st.st_size) < sizeof(nixlMDShmHeader)) {
+        close(fd);
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    const size_t mapped = st.st_size;
+    void *addr = mmap(nullptr, mapped, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        NIXL_PERROR << "mmap failed for metadata segment " << shm_name;
+        return NIXL_ERR_BACKEND;
+    }
+
+    const auto *hdr = static_cast<const nixlMDShmHeader *>(addr);
+    nixl_status_t ret = NIXL_ERR_BACKEND;
+    for (int attempt = 0; attempt < 100; attempt++) {
+        const uint64_t seq = hdr->seq.load(std::memory_order_acquire);
+        if (seq & 1) // writer in progress
+            continue;
+        const size_t size = hdr->size;
+        if (size == 0 || sizeof(nixlMDShmHeader) + size > mapped)
+            continue; // concurrent grow; the size settles with the seqlock
+        md.assign(reinterpret_cast<const char *>(hdr + 1), size);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (hdr->seq.load(std::memory_order_relaxed) == seq) {
+            ret = NIXL_SUCCESS;
+            break;
+        }
+    }
+
+    munmap(addr, mapped);
+    if (ret != NIXL_SUCCESS)
+        NIXL_ERROR << "Could not get a consistent read of metadata segment " << shm_name;
+    return ret;
+}
+
+void
+nixlAgentData::unlinkLocalMDShm() {
+    const std::string shm_name = mdShmName(name);
+    if (shm_unlink(shm_name.c_str()) < 0 && errno != ENOENT)
+        NIXL_PERROR << "shm_unlink failed for metadata segment " << shm_name;
+}
+
 nixl_status_t
 nixlAgentData::loadConnInfo(const std::string &remote_name,
                             const nixl_backend_t &backend,
@@ -712,6 +1328,9 @@ nixlAgentData::loadRemoteSections(const std::string &remote_name, nixlSerDes &sd
         remoteSections[remote_name] = new nixlRemoteSection(remote_name);
     }
 
+    // A reload can replace metadata that cached transfer plans point at
+    invalidateXferPlans();
+
     const nixl_status_t ret = remoteSections[remote_name]->loadRemoteData(&sd, backendEngines);
     // TODO: can be more graceful, if just the new MD blob was improper
     if (ret != NIXL_SUCCESS) {
@@ -724,6 +1343,37 @@ nixlAgentData::loadRemoteSections(const std::string &remote_name, nixlSerDes &sd
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlAgentData::applyRemoteMDRemovals(const std::string &remote_name, nixlSerDes &sd) {
+    nixl_reg_dlist_t r_descs(&sd);
+    if (r_descs.descCount() == 0)
+        return NIXL_SUCCESS;
+
+    auto section = remoteSections.find(remote_name);
+    if (section == remoteSections.end())
+        return NIXL_ERR_NOT_FOUND;
+
+    // Removed metadata may be referenced by cached transfer plans
+    invalidateXferPlans();
+
+    // The delta does not carry per-backend removal lists, so the descs are
+    // removed from every common backend; missing entries are skipped
+    auto backends = remoteBackends.find(remote_name);
+    if (backends == remoteBackends.end())
+        return NIXL_SUCCESS;
+
+    nixl_status_t ret = NIXL_SUCCESS;
+    for (auto &elm : backends->second) {
+        auto eng = backendEngines.find(elm.first);
+        if (eng == backendEngines.end())
+            continue;
+        nixl_status_t rem_ret = section->second->remDescList(r_descs, eng->second);
+        if (rem_ret != NIXL_SUCCESS)
+            ret = rem_ret;
+    }
+    return ret;
+}
+
 nixl_status_t
 nixlAgentData::invalidateRemoteData(const std::string &remote_name) {
     if (remote_name == name) {
@@ -731,10 +1381,19 @@ nixlAgentData::invalidateRemoteData(const std::string &remote_name) {
         return NIXL_ERR_INVALID_PARAM;
     }
 
+    // Cached transfer plans may reference the invalidated remote metadata
+    invalidateXferPlans();
+    remoteMDSeq.erase(remote_name);
+    remoteMDCache.erase(remote_name);
+    remoteMDDigest.erase(remote_name);
+
     nixl_status_t ret = NIXL_ERR_NOT_FOUND;
+    nixlDeadPeer dead;
+    dead.name = remote_name;
+
     auto it_section = remoteSections.find(remote_name);
     if (it_section != remoteSections.end()) {
-        delete it_section->second;
+        dead.section = it_section->second;
         remoteSections.erase(it_section);
         ret = NIXL_SUCCESS;
     }
@@ -742,12 +1401,34 @@ nixlAgentData::invalidateRemoteData(const std::string &remote_name) {
     auto it_backends = remoteBackends.find(remote_name);
     if (it_backends != remoteBackends.end()) {
         for (auto &it : it_backends->second) {
-            backendEngines[it.first]->disconnect(remote_name);
+            auto eng = backendEngines.find(it.first);
+            if (eng != backendEngines.end())
+                dead.engines.push_back(eng->second);
         }
 
         remoteBackends.erase(it_backends);
         ret = NIXL_SUCCESS;
     }
 
-    return ret;
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    // The maps above are already cleared, so lookups and populate miss
+    // immediately. Deleting the section walks every cached MD through the
+    // backend unload path and disconnects can block on the driver, so with
+    // an executor available the teardown is queued and drained in batches
+    // off the caller (see reclaimDeadPeers)
+    if (progressExecutor) {
+        std::lock_guard<std::mutex> guard(invalidateLock);
+        invalidateQueue.push_back(std::move(dead));
+        if (!invalidatePollerActive) {
+            invalidatePollerId =
+                progressExecutor->addPoller([this]() { return reclaimDeadPeers(); });
+            invalidatePollerActive = true;
+        }
+    } else {
+        teardownDeadPeer(dead);
+    }
+
+    return NIXL_SUCCESS;
 }
@@ -116,6 +116,14 @@ std::map<nixl_backend_t, std::string> loadPluginList(const std::string& filename
 }
 
 std::shared_ptr<const nixlPluginHandle> nixlPluginManager::loadPluginFromPath(const std::string& plugin_path) {
+#ifdef NIXL_STATIC_PLUGINS_ONLY
+    // Every dlopen route funnels through here; rejecting the path is enough
+    // to keep a static-only binary from ever loading foreign code
+    NIXL_ERROR << "Runtime plugin loading is disabled (static plugins only), refusing "
+               << plugin_path;
+    return nullptr;
+#endif
+
     // Open the plugin file
     void* handle = dlopen(plugin_path.c_str(), RTLD_NOW | RTLD_LOCAL);
     if (!handle) {
@@ -160,14 +168,10 @@ void nixlPluginManager::loadPluginsFromList(const std::string& filename) {
 
     lock_guard lg(lock);
 
+    // Only record the name -> path mapping here; the library is dlopened
+    // on the first loadPlugin call that names it
     for (const auto& pair : plugins) {
-        const std::string& name = pair.first;
-        const std::string& path = pair.second;
-
-        auto plugin_handle = loadPluginFromPath(path);
-        if (plugin_handle) {
-            loaded_plugins_[name] = plugin_handle;
-        }
+        available_plugins_.emplace(pair.first, pair.second);
     }
 }
 
@@ -192,6 +196,13 @@ getPluginDir() {
 
 // PluginManager implementation
 nixlPluginManager::nixlPluginManager() {
+#ifdef NIXL_STATIC_PLUGINS_ONLY
+    // Locked-down deployments: no plugin file, no directory discovery;
+    // only the plugins linked in at build time are registered
+    registerBuiltinPlugins();
+    return;
+#endif
+
     // Force levels right before logging
 #ifdef NIXL_USE_PLUGIN_FILE
     NIXL_DEBUG << "Loading plugins from file: " << NIXL_USE_PLUGIN_FILE;
@@ -259,6 +270,20 @@ std::shared_ptr<const nixlPluginHandle> nixlPluginManager::loadPlugin(const std:
         return it->second;
     }
 
+    // Discovery recorded the library path without loading it; dlopen it now
+    auto avail_it = available_plugins_.find(plugin_name);
+    if (avail_it != available_plugins_.end()) {
+        auto plugin_handle = loadPluginFromPath(avail_it->second);
+        if (plugin_handle) {
+            loaded_plugins_[plugin_name] = plugin_handle;
+            return plugin_handle;
+        }
+        // Stale or broken library; drop it and fall back to the directory scan
+        NIXL_WARN << "Discovered plugin '" << plugin_name << "' failed to load from "
+                  << avail_it->second;
+        available_plugins_.erase(avail_it);
+    }
+
     // Try to load the plugin from all registered directories
     for (const auto& dir : plugin_dirs_) {
         // Handle path joining correctly with or without trailing slash
@@ -310,10 +335,14 @@ void nixlPluginManager::discoverPluginsFromDir(const std::string& dirpath) {
             // Extract plugin name
             std::string plugin_name = filename.substr(10, filename.size() - 13);
 
-            // Try to load the plugin
-            auto plugin = loadPlugin(plugin_name);
-            if (plugin) {
-                NIXL_INFO << "Discovered and loaded plugin: " << plugin_name;
+            // Record the candidate without dlopening it; loading is deferred
+            // until a backend names the plugin, so discovery stays cheap and
+            // unused plugin dependencies never enter the process
+            lock_guard lg(lock);
+            auto [avail_it, inserted] =
+                available_plugins_.emplace(plugin_name, entry.path().string());
+            if (inserted) {
+                NIXL_INFO << "Discovered plugin: " << plugin_name << " at " << avail_it->second;
             }
         }
     }
@@ -368,6 +397,80 @@ std::vector<nixl_backend_t> nixlPluginManager::getLoadedPluginNames() {
     return names;
 }
 
+std::vector<nixl_backend_t> nixlPluginManager::getAvailablePluginNames() {
+    lock_guard lg(lock);
+
+    std::vector<nixl_backend_t> names;
+    for (const auto& pair : loaded_plugins_) {
+        names.push_back(pair.first);
+    }
+    for (const auto& pair : available_plugins_) {
+        if (loaded_plugins_.count(pair.first) == 0) {
+            names.push_back(pair.first);
+        }
+    }
+    return names;
+}
+
+nixlBackendEngine* nixlPluginManager::acquireSharedEngine(const nixl_backend_t& type,
+                                                          const std::string& share_key,
+                                                          const nixlBackendInitParams* init_params,
+                                                          bool& created) {
+    created = false;
+    // loadPlugin takes the manager lock itself, so it must run outside ours
+    auto plugin = loadPlugin(type);
+    if (!plugin) {
+        NIXL_ERROR << "Cannot load plugin '" << type << "' for a shared engine";
+        return nullptr;
+    }
+
+    lock_guard lg(lock);
+
+    const auto key = std::make_pair(type, share_key);
+    auto it = shared_engines_.find(key);
+    if (it != shared_engines_.end()) {
+        it->second.refCount++;
+        return it->second.engine;
+    }
+
+    nixlBackendEngine* engine = plugin->createEngine(init_params);
+    if (!engine) {
+        return nullptr;
+    }
+
+    nixlSharedEngine entry;
+    entry.engine = engine;
+    entry.plugin = plugin;
+    entry.refCount = 1;
+    shared_engines_[key] = entry;
+    created = true;
+    return engine;
+}
+
+bool nixlPluginManager::releaseSharedEngine(nixlBackendEngine* engine) {
+    std::shared_ptr<const nixlPluginHandle> plugin;
+    {
+        lock_guard lg(lock);
+        for (auto it = shared_engines_.begin(); it != shared_engines_.end(); ++it) {
+            if (it->second.engine != engine) {
+                continue;
+            }
+            if (--it->second.refCount > 0) {
+                return true;
+            }
+            plugin = it->second.plugin;
+            shared_engines_.erase(it);
+            break;
+        }
+    }
+    if (!plugin) {
+        return false;
+    }
+    // Last reference gone; engine teardown can be slow, keep it unlocked
+    plugin->destroyEngine(engine);
+    return true;
+}
+
 void nixlPluginManager::registerStaticPlugin(const char* name, nixlStaticPluginCreatorFunc creator) {
     lock_guard lg(lock);
 
@@ -421,6 +524,14 @@ void nixlPluginManager::registerBuiltinPlugins() {
     NIXL_REGISTER_STATIC_PLUGIN(POSIX)
 #endif
 
+#ifdef STATIC_PLUGIN_CMA
+    NIXL_REGISTER_STATIC_PLUGIN(CMA)
+#endif
+
+#ifdef STATIC_PLUGIN_NVLINK
+    NIXL_REGISTER_STATIC_PLUGIN(NVLINK)
+#endif
+
 #ifdef STATIC_PLUGIN_GPUNETIO
     NIXL_REGISTER_STATIC_PLUGIN(GPUNETIO)
 #endif
@@ -61,9 +61,24 @@ struct nixlStaticPluginInfo {
     nixlStaticPluginCreatorFunc createFunc;
 };
 
+// One process-wide backend engine instance shared by several agents,
+// refcounted so it is destroyed when the last sharing agent goes away
+struct nixlSharedEngine {
+    nixlBackendEngine* engine = nullptr;
+    std::shared_ptr<const nixlPluginHandle> plugin;
+    unsigned int refCount = 0;
+};
+
 class nixlPluginManager {
 private:
     std::map<nixl_backend_t, std::shared_ptr<const nixlPluginHandle>> loaded_plugins_;
+    // Shared engine instances keyed by (backend type, share key); agents
+    // opt in through the "shared_engine" backend parameter
+    std::map<std::pair<nixl_backend_t, std::string>, nixlSharedEngine> shared_engines_;
+    // Plugins discovered on disk but not dlopened yet, name -> library path.
+    // Loading is deferred until a backend names the plugin, so processes only
+    // pull in the shared libraries they actually use.
+    std::map<nixl_backend_t, std::string> available_plugins_;
     std::vector<std::string> plugin_dirs_;
     std::vector<nixlStaticPluginInfo> static_plugins_;
     std::mutex lock;
@@ -101,6 +116,9 @@ public:
     // Get all loaded plugin names
     std::vector<nixl_backend_t> getLoadedPluginNames();
 
+    // Get all plugin names that can be loaded (loaded plus discovered)
+    std::vector<nixl_backend_t> getAvailablePluginNames();
+
     // Get backend options
     nixl_b_params_t getBackendOptions(const nixl_backend_t& type);
 
@@ -109,6 +127,20 @@ public:
 
     // Static Plugin Helpers
     const std::vector<nixlStaticPluginInfo>& getStaticPlugins();
+
+    // Returns the engine shared under (type, share key), bumping its
+    // refcount, creating it through the plugin on first acquire. created
+    // reports whether this call instantiated the engine (the caller's
+    // init params only take effect then). Returns nullptr on failure.
+    nixlBackendEngine* acquireSharedEngine(const nixl_backend_t& type,
+                                           const std::string& share_key,
+                                           const nixlBackendInitParams* init_params,
+                                           bool& created);
+
+    // Drops one reference on a shared engine, destroying it at zero.
+    // Returns false when the engine is not in the shared table (it is
+    // then owned by its single agent as usual).
+    bool releaseSharedEngine(nixlBackendEngine* engine);
 };
 
 #endif // __PLUGIN_MANAGER_H
@@ -23,9 +23,11 @@
 #include <cstring>
 #include <algorithm>
 
+#include "common/nixl_affinity.h"
 #include "common/nixl_log.h"
 #include "telemetry.h"
 #include "telemetry_event.h"
+#include "telemetry_segment.h"
 #include "util.h"
 
 using namespace std::chrono_literals;
@@ -33,8 +35,12 @@ namespace fs = std::filesystem;
 
 constexpr std::chrono::milliseconds DEFAULT_TELEMETRY_RUN_INTERVAL = 100ms;
 constexpr size_t DEFAULT_TELEMETRY_BUFFER_SIZE = 4096;
+constexpr size_t DEFAULT_TELEMETRY_SEGMENT_EVENTS = 65536;
+constexpr size_t DEFAULT_TELEMETRY_SEGMENT_FILES = 8;
 
-nixlTelemetry::nixlTelemetry(const std::string &file_path, backend_map_t &backend_map)
+nixlTelemetry::nixlTelemetry(const std::string &file_path,
+                             backend_map_t &backend_map,
+                             const std::string &cpuset)
     : pool_(1),
       writeTask_(pool_.get_executor(), DEFAULT_TELEMETRY_RUN_INTERVAL, false),
       file_(file_path),
@@ -42,6 +48,12 @@ nixlTelemetry::nixlTelemetry(const std::string &file_path, backend_map_t &backen
     if (file_path.empty()) {
         throw std::invalid_argument("Telemetry file path cannot be empty");
     }
+    if (!cpuset.empty()) {
+        asio::post(pool_, [cpuset]() { nixlAffinity::applyToSelf(cpuset); });
+    }
+    eventRing_ = std::make_unique<eventSlot[]>(eventRingSize_);
+    for (size_t i = 0; i < eventRingSize_; i++)
+        eventRing_[i].seq_.store(i, std::memory_order_relaxed);
     initializeTelemetry();
 }
 
@@ -59,6 +71,9 @@ nixlTelemetry::~nixlTelemetry() {
 
     if (buffer_) {
         writeEventHelper();
+        // Overflow collected since the last rotation still holds history;
+        // compact it into a final (possibly short) segment
+        rotateSegment();
         buffer_.reset();
     }
 }
@@ -78,8 +93,30 @@ nixlTelemetry::initializeTelemetry() {
     NIXL_INFO << "Telemetry enabled, using buffer path: " << full_file_path
               << " with size: " << buffer_size;
 
+    const bool hugepages = std::getenv(TELEMETRY_BUFFER_HUGEPAGES_VAR) ?
+        (std::stoul(std::getenv(TELEMETRY_BUFFER_HUGEPAGES_VAR)) != 0) :
+        false;
+
     buffer_ = std::make_unique<sharedRingBuffer<nixlTelemetryEvent>>(
-        full_file_path, true, TELEMETRY_VERSION, buffer_size);
+        full_file_path, true, TELEMETRY_VERSION, buffer_size, hugepages);
+
+    segmentEvents_ = std::getenv(TELEMETRY_SEGMENT_EVENTS_VAR) ?
+        std::stoul(std::getenv(TELEMETRY_SEGMENT_EVENTS_VAR)) :
+        DEFAULT_TELEMETRY_SEGMENT_EVENTS;
+    segmentFiles_ = std::getenv(TELEMETRY_SEGMENT_FILES_VAR) ?
+        std::stoul(std::getenv(TELEMETRY_SEGMENT_FILES_VAR)) :
+        DEFAULT_TELEMETRY_SEGMENT_FILES;
+
+    // Segments left by a previous run stay readable until the budget
+    // evicts them; numbering continues after them
+    if (segmentEvents_ != 0) {
+        pendingSegment_.reserve(segmentEvents_);
+        while (fs::exists(segmentPath(segmentSeq_)))
+            segmentSeq_++;
+        segmentOldest_ = segmentSeq_;
+        while ((segmentOldest_ > 0) && fs::exists(segmentPath(segmentOldest_ - 1)))
+            segmentOldest_--;
+    }
 
     auto run_interval = std::getenv(TELEMETRY_RUN_INTERVAL_VAR) ?
         std::chrono::milliseconds(std::stoul(std::getenv(TELEMETRY_RUN_INTERVAL_VAR))) :
@@ -92,19 +129,56 @@ nixlTelemetry::initializeTelemetry() {
     registerPeriodicTask(writeTask_);
 }
 
+// Claims a slot with a CAS on the head ticket and publishes it by bumping
+// the slot sequence, so producers never take a lock. Returns false and
+// drops the event when the ring is full.
 bool
-nixlTelemetry::writeEventHelper() {
-    std::vector<nixlTelemetryEvent> next_queue;
-    // assume next buffer will be the same size as the current one
-    next_queue.reserve(buffer_->capacity());
-    {
-        std::lock_guard<std::mutex> lock(mutex_);
-        events_.swap(next_queue);
+nixlTelemetry::pushEvent(nixlTelemetryEvent &&event) {
+    uint64_t pos = eventRingHead_.load(std::memory_order_relaxed);
+    eventSlot *slot;
+
+    for (;;) {
+        slot = &eventRing_[pos & (eventRingSize_ - 1)];
+        const uint64_t seq = slot->seq_.load(std::memory_order_acquire);
+        const int64_t dif = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+        if (dif == 0) {
+            if (eventRingHead_.compare_exchange_weak(pos, pos + 1,
+                                                     std::memory_order_relaxed))
+                break;
+        } else if (dif < 0) {
+            return false; // full; drop, like the downstream cyclic buffer
+        } else {
+            pos = eventRingHead_.load(std::memory_order_relaxed);
+        }
     }
-    for (auto &event : next_queue) {
-        // if full, ignore
-        buffer_->push(event);
+
+    slot->event_ = std::move(event);
+    slot->seq_.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool
+nixlTelemetry::writeEventHelper() {
+    // Drain published slots in ticket order; the flusher is the only
+    // consumer, so the tail needs no synchronization. The drained burst
+    // goes downstream as one batch with a single cursor bump, instead of
+    // bouncing the shared write cursor's cacheline once per event.
+    std::vector<nixlTelemetryEvent> ring_events;
+    uint64_t pos = eventRingTail_;
+    for (;;) {
+        eventSlot &slot = eventRing_[pos & (eventRingSize_ - 1)];
+        if (slot.seq_.load(std::memory_order_acquire) != pos + 1)
+            break;
+        ring_events.push_back(slot.event_);
+        slot.seq_.store(pos + eventRingSize_, std::memory_order_release);
+        pos++;
     }
+    eventRingTail_ = pos;
+    emitEvents(ring_events);
+
+    publishLatHists();
+    publishPeerMatrix();
+
     // collect all events and sort them by timestamp
     std::vector<nixlTelemetryEvent> all_events;
     for (auto &backend : backendMap_) {
@@ -121,12 +195,70 @@ nixlTelemetry::writeEventHelper() {
               [](const nixlTelemetryEvent &a, const nixlTelemetryEvent &b) {
                   return a.timestampUs_ < b.timestampUs_;
               });
-    for (auto &event : all_events) {
-        buffer_->push(event);
-    }
+    emitEvents(all_events);
     return true;
 }
 
+// Offers an event to the live ring; when the ring is full (collector
+// absent or behind during a burst) the event spills into the pending
+// segment instead of being dropped. Flusher thread only.
+void
+nixlTelemetry::emitEvent(const nixlTelemetryEvent &event) {
+    if (buffer_->push(event))
+        return;
+    if (segmentEvents_ == 0)
+        return; // rotation disabled: drop, as before
+    pendingSegment_.push_back(event);
+    if (pendingSegment_.size() >= segmentEvents_)
+        rotateSegment();
+}
+
+// Batched variant for burst drains: whatever fits goes into the live ring
+// under one version bump of the shared cursor, the remainder spills into
+// the pending segment like the single-event path. Flusher thread only.
+void
+nixlTelemetry::emitEvents(const std::vector<nixlTelemetryEvent> &events) {
+    if (events.empty())
+        return;
+
+    const size_t taken = buffer_->pushBatch(events.data(), events.size());
+    if (taken == events.size())
+        return;
+    if (segmentEvents_ == 0)
+        return; // rotation disabled: drop, as before
+
+    for (size_t i = taken; i < events.size(); i++) {
+        pendingSegment_.push_back(events[i]);
+        if (pendingSegment_.size() >= segmentEvents_)
+            rotateSegment();
+    }
+}
+
+std::string
+nixlTelemetry::segmentPath(uint64_t seq) const {
+    char suffix[16];
+    snprintf(suffix, sizeof(suffix), ".seg.%06lu", static_cast<unsigned long>(seq));
+    return file_ + suffix;
+}
+
+// Compacts the pending overflow into the next segment file and evicts the
+// oldest segments beyond the budget, bounding both loss and disk usage
+void
+nixlTelemetry::rotateSegment() {
+    if (pendingSegment_.empty())
+        return;
+
+    if (nixlTelemetrySegmentWrite(segmentPath(segmentSeq_), pendingSegment_)) {
+        segmentSeq_++;
+        std::error_code ec;
+        while (segmentSeq_ - segmentOldest_ > segmentFiles_) {
+            fs::remove(segmentPath(segmentOldest_), ec);
+            segmentOldest_++;
+        }
+    }
+    pendingSegment_.clear();
+}
+
 void
 nixlTelemetry::registerPeriodicTask(periodicTask &task) {
     task.timer_.expires_after(task.interval_);
@@ -148,14 +280,13 @@ void
 nixlTelemetry::updateData(const std::string &event_name,
                           nixl_telemetry_category_t category,
                           uint64_t value) {
-    // agent can be multi-threaded
-    std::lock_guard<std::mutex> lock(mutex_);
-    events_.emplace_back(std::chrono::duration_cast<std::chrono::microseconds>(
-                             std::chrono::system_clock::now().time_since_epoch())
-                             .count(),
-                         category,
-                         event_name,
-                         value);
+    // agent can be multi-threaded; the ring keeps this path lock-free
+    pushEvent(nixlTelemetryEvent(std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::system_clock::now().time_since_epoch())
+                                     .count(),
+                                 category,
+                                 event_name,
+                                 value));
 }
 
 // The next 4 methods might be removed, as addXferTime covers them.
@@ -189,6 +320,56 @@ nixlTelemetry::updateErrorCount(nixl_status_t error_type) {
         nixlEnumStrings::statusStr(error_type), nixl_telemetry_category_t::NIXL_TELEMETRY_ERROR, 1);
 }
 
+void
+nixlTelemetry::updateXferFailoverCount(const std::string &from_backend,
+                                       const std::string &to_backend) {
+    updateData("agent_xfer_failover_" + from_backend + "_to_" + to_backend,
+               nixl_telemetry_category_t::NIXL_TELEMETRY_BACKEND,
+               1);
+}
+
+void
+nixlTelemetry::updateDeferredRequestsNum(uint32_t deferred_requests_num) {
+    updateData("agent_deferred_requests_num",
+               nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+               deferred_requests_num);
+}
+
+void
+nixlTelemetry::updateStarvedRequestsNum(uint32_t starved_requests_num) {
+    updateData("agent_starved_requests_num",
+               nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+               starved_requests_num);
+}
+
+void
+nixlTelemetry::updateStalledRequestsNum(uint32_t stalled_requests_num) {
+    updateData("agent_stalled_requests_num",
+               nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+               stalled_requests_num);
+}
+
+void
+nixlTelemetry::updateChunkedRequestsNum(uint32_t chunked_requests_num) {
+    updateData("agent_chunked_requests_num",
+               nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+               chunked_requests_num);
+}
+
+void
+nixlTelemetry::updateFilteredNotifsNum(uint32_t filtered_notifs_num) {
+    updateData("agent_filtered_notifs_num",
+               nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+               filtered_notifs_num);
+}
+
+void
+nixlTelemetry::updateSendWindowOccupancy(const std::string &peer, uint64_t bytes) {
+    updateData("agent_send_window_" + peer,
+               nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+               bytes);
+}
+
 void
 nixlTelemetry::updateMemoryRegistered(uint64_t memory_registered) {
     updateData("agent_memory_registered",
@@ -203,8 +384,91 @@ nixlTelemetry::updateMemoryDeregistered(uint64_t memory_deregistered) {
                memory_deregistered);
 }
 
+// Maps a transfer to its histogram bucket: the size class is log2 of the
+// byte count in steps of four, the latency bucket is HDR-style with a
+// power-of-two segment and 2^latHistSubBits_ linear sub-buckets, so the
+// relative bucket error stays bounded across the whole latency range
+size_t
+nixlTelemetry::latHistIndex(uint64_t bytes, uint64_t lat_us) {
+    constexpr uint64_t sub = 1ULL << latHistSubBits_;
+
+    size_t size_bucket = 0;
+    if (bytes > 1)
+        size_bucket = std::min<size_t>((63 - __builtin_clzll(bytes)) / 4,
+                                       latHistSizeBuckets_ - 1);
+
+    size_t lat_bucket;
+    if (lat_us < sub) {
+        lat_bucket = lat_us;
+    } else {
+        const size_t msb = 63 - __builtin_clzll(lat_us);
+        const size_t seg = msb - latHistSubBits_ + 1;
+        lat_bucket = std::min((seg << latHistSubBits_) +
+                                  ((lat_us >> (msb - latHistSubBits_)) & (sub - 1)),
+                              latHistLatBuckets_ - 1);
+    }
+
+    return size_bucket * latHistLatBuckets_ + lat_bucket;
+}
+
+nixlTelemetry::latHistogram *
+nixlTelemetry::latHistLookup(const std::string &backend) {
+    // Slots fill in order and are published with a release store, so the
+    // common case is a short lock-free scan
+    for (auto &slot : latHists_) {
+        latHistogram *hist = slot.hist_.load(std::memory_order_acquire);
+        if (!hist)
+            break;
+        if (slot.name_ == backend)
+            return hist;
+    }
+
+    std::lock_guard<std::mutex> lock(latHistLock_);
+    for (auto &slot : latHists_) {
+        if (!slot.hist_.load(std::memory_order_relaxed)) {
+            latHistStore_.push_back(std::make_unique<latHistogram>());
+            slot.name_ = backend;
+            slot.hist_.store(latHistStore_.back().get(), std::memory_order_release);
+            return latHistStore_.back().get();
+        }
+        if (slot.name_ == backend)
+            return slot.hist_.load(std::memory_order_relaxed);
+    }
+    return nullptr; // all slots taken; histogram recording is skipped
+}
+
 void
-nixlTelemetry::addXferTime(std::chrono::microseconds xfer_time, bool is_write, uint64_t bytes) {
+nixlTelemetry::publishLatHists() {
+    const auto now_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::system_clock::now().time_since_epoch())
+                            .count();
+
+    for (auto &slot : latHists_) {
+        latHistogram *hist = slot.hist_.load(std::memory_order_acquire);
+        if (!hist)
+            break;
+        for (size_t i = 0; i < hist->counts_.size(); i++) {
+            const uint64_t count = hist->counts_[i].load(std::memory_order_relaxed);
+            if (count == hist->published_[i])
+                continue;
+            hist->published_[i] = count;
+            // ring overflow spills into a rotated segment
+            emitEvent(
+                nixlTelemetryEvent(now_us,
+                                   nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
+                                   "xlh_" + slot.name_ + "_s" +
+                                       std::to_string(i / latHistLatBuckets_) + "_b" +
+                                       std::to_string(i % latHistLatBuckets_),
+                                   count));
+        }
+    }
+}
+
+void
+nixlTelemetry::addXferTime(std::chrono::microseconds xfer_time,
+                           bool is_write,
+                           uint64_t bytes,
+                           const std::string &backend) {
     std::string bytes_name;
     std::string requests_name;
 
@@ -218,15 +482,102 @@ nixlTelemetry::addXferTime(std::chrono::microseconds xfer_time, bool is_write, u
     auto time = std::chrono::duration_cast<std::chrono::microseconds>(
                     std::chrono::system_clock::now().time_since_epoch())
                     .count();
-    std::lock_guard<std::mutex> lock(mutex_);
-    events_.emplace_back(time,
-                         nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
-                         "agent_xfer_time",
-                         xfer_time.count());
-    events_.emplace_back(
-        time, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, bytes_name.c_str(), bytes);
-    events_.emplace_back(
-        time, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, requests_name.c_str(), 1);
+    pushEvent(nixlTelemetryEvent(time,
+                                 nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
+                                 "agent_xfer_time",
+                                 xfer_time.count()));
+    pushEvent(nixlTelemetryEvent(
+        time, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, bytes_name, bytes));
+    pushEvent(nixlTelemetryEvent(
+        time, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, requests_name, 1));
+
+    if (auto *hist = latHistLookup(backend))
+        hist->counts_[latHistIndex(bytes, static_cast<uint64_t>(xfer_time.count()))].fetch_add(
+            1, std::memory_order_relaxed);
+}
+
+nixlTelemetry::peerCounters *
+nixlTelemetry::peerLookup(const std::string &peer) {
+    // Same scheme as latHistLookup: slots fill in order and are published
+    // with a release store, so the common case is a short lock-free scan
+    for (auto &slot : peerMatrix_) {
+        peerCounters *counters = slot.counters_.load(std::memory_order_acquire);
+        if (!counters)
+            break;
+        if (slot.name_ == peer)
+            return counters;
+    }
+
+    std::lock_guard<std::mutex> lock(peerLock_);
+    for (auto &slot : peerMatrix_) {
+        if (!slot.counters_.load(std::memory_order_relaxed)) {
+            peerStore_.push_back(std::make_unique<peerCounters>());
+            slot.name_ = peer;
+            slot.counters_.store(peerStore_.back().get(), std::memory_order_release);
+            return peerStore_.back().get();
+        }
+        if (slot.name_ == peer)
+            return slot.counters_.load(std::memory_order_relaxed);
+    }
+    return nullptr; // all slots taken; traffic matrix recording is skipped
+}
+
+void
+nixlTelemetry::publishPeerMatrix() {
+    static const std::array<std::string, peerCounterKinds_> counter_names = {
+        "peer_tx_bytes_", "peer_rx_bytes_", "peer_tx_requests_num_", "peer_rx_requests_num_"};
+
+    const auto now_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::system_clock::now().time_since_epoch())
+                            .count();
+
+    for (auto &slot : peerMatrix_) {
+        peerCounters *counters = slot.counters_.load(std::memory_order_acquire);
+        if (!counters)
+            break;
+        for (size_t i = 0; i < peerCounterKinds_; i++) {
+            const uint64_t count = counters->counts_[i].load(std::memory_order_relaxed);
+            if (count == counters->published_[i])
+                continue;
+            counters->published_[i] = count;
+            // ring overflow spills into a rotated segment
+            emitEvent(nixlTelemetryEvent(now_us,
+                                         nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+                                         counter_names[i] + slot.name_,
+                                         count));
+        }
+    }
+}
+
+void
+nixlTelemetry::addPeerXfer(const std::string &peer, bool is_write, uint64_t bytes) {
+    peerCounters *counters = peerLookup(peer);
+    if (!counters)
+        return;
+    const size_t base = is_write ? 0 : 1;
+    counters->counts_[base].fetch_add(bytes, std::memory_order_relaxed);
+    counters->counts_[base + 2].fetch_add(1, std::memory_order_relaxed);
+}
+
+void
+nixlTelemetry::addTraceEvent(const nixl_blob_t &trace_ctx, bool is_tx) {
+    // The fixed event ABI carries one u64 per event, so the up-to-16-byte
+    // context is split into low/high halves; readers reassemble by pairing
+    // the _lo/_hi events, which share a timestamp
+    uint64_t half = 0;
+    memcpy(&half, trace_ctx.data(), std::min(trace_ctx.size(), sizeof(half)));
+    updateData(is_tx ? "trace_ctx_tx_lo" : "trace_ctx_rx_lo",
+               nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+               half);
+    if (trace_ctx.size() > sizeof(half)) {
+        half = 0;
+        memcpy(&half,
+               trace_ctx.data() + sizeof(half),
+               std::min(trace_ctx.size() - sizeof(half), sizeof(half)));
+        updateData(is_tx ? "trace_ctx_tx_hi" : "trace_ctx_rx_hi",
+                   nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+                   half);
+    }
 }
 
 void
@@ -236,6 +587,13 @@ nixlTelemetry::addPostTime(std::chrono::microseconds post_time) {
                post_time.count());
 }
 
+void
+nixlTelemetry::addInitStageTime(const std::string &stage, std::chrono::microseconds duration) {
+    updateData("agent_init_" + stage + "_time",
+               nixl_telemetry_category_t::NIXL_TELEMETRY_SYSTEM,
+               duration.count());
+}
+
 std::string
 nixlEnumStrings::telemetryCategoryStr(const nixl_telemetry_category_t &category) {
     static std::array<std::string, 9> nixl_telemetry_category_str = {"NIXL_TELEMETRY_MEMORY",
@@ -22,6 +22,7 @@
 #include "mem_section.h"
 #include "nixl_types.h"
 
+#include <array>
 #include <string>
 #include <vector>
 #include <mutex>
@@ -49,7 +50,11 @@ struct periodicTask {
 
 class nixlTelemetry {
 public:
-    nixlTelemetry(const std::string &file_path, backend_map_t &backend_map);
+    // cpuset, when non-empty, pins the writer thread at startup (comma
+    // separated core list with ranges, e.g. "2,4-7")
+    nixlTelemetry(const std::string &file_path,
+                  backend_map_t &backend_map,
+                  const std::string &cpuset = "");
 
     ~nixlTelemetry();
 
@@ -64,13 +69,36 @@ public:
     void
     updateErrorCount(nixl_status_t error_type);
     void
+    updateXferFailoverCount(const std::string &from_backend, const std::string &to_backend);
+    void
+    updateDeferredRequestsNum(uint32_t num);
+    void
+    updateStarvedRequestsNum(uint32_t num);
+    void
+    updateStalledRequestsNum(uint32_t num);
+    void
+    updateChunkedRequestsNum(uint32_t num);
+    void
+    updateFilteredNotifsNum(uint32_t num);
+    void
+    updateSendWindowOccupancy(const std::string &peer, uint64_t bytes);
+    void
     updateMemoryRegistered(uint64_t memory_registered);
     void
     updateMemoryDeregistered(uint64_t memory_deregistered);
     void
-    addXferTime(std::chrono::microseconds transaction_time, bool is_write, uint64_t bytes);
+    addXferTime(std::chrono::microseconds transaction_time,
+                bool is_write,
+                uint64_t bytes,
+                const std::string &backend);
     void
     addPostTime(std::chrono::microseconds post_time);
+    void
+    addInitStageTime(const std::string &stage, std::chrono::microseconds duration);
+    void
+    addPeerXfer(const std::string &peer, bool is_write, uint64_t bytes);
+    void
+    addTraceEvent(const nixl_blob_t &trace_ctx, bool is_tx);
 
 private:
     void
@@ -81,9 +109,100 @@ private:
     updateData(const std::string &event_name, nixl_telemetry_category_t category, uint64_t value);
     bool
     writeEventHelper();
+    bool
+    pushEvent(nixlTelemetryEvent &&event);
     std::unique_ptr<sharedRingBuffer<nixlTelemetryEvent>> buffer_;
-    std::vector<nixlTelemetryEvent> events_;
-    std::mutex mutex_;
+
+    // Overflow spill path, flusher thread only: events the live ring cannot
+    // take during a burst collect in pendingSegment_ and rotate into
+    // compressed columnar segment files next to the ring (see
+    // telemetry_segment.h), keeping loss bounded by the segment budget
+    // while producers stay wait-free
+    void
+    emitEvent(const nixlTelemetryEvent &event);
+    void
+    emitEvents(const std::vector<nixlTelemetryEvent> &events);
+    void
+    rotateSegment();
+    std::string
+    segmentPath(uint64_t seq) const;
+    std::vector<nixlTelemetryEvent> pendingSegment_;
+    size_t segmentEvents_ = 0; // 0 disables rotation
+    size_t segmentFiles_ = 0;
+    uint64_t segmentSeq_ = 0; // next segment to write
+    uint64_t segmentOldest_ = 0; // oldest segment still on disk
+
+    // Producer side of the event path: a bounded lock-free MPSC ring with
+    // sequence-stamped slots. Producers claim a ticket with a CAS on the
+    // head and publish by bumping the slot sequence; the periodic flusher
+    // is the single consumer and restamps consumed slots one lap ahead.
+    // A full ring drops events, like the downstream cyclic buffer.
+    struct eventSlot {
+        std::atomic<uint64_t> seq_;
+        nixlTelemetryEvent event_;
+    };
+    static constexpr size_t eventRingSize_ = 4096; // must be a power of two
+    std::unique_ptr<eventSlot[]> eventRing_;
+    std::atomic<uint64_t> eventRingHead_{0};
+    uint64_t eventRingTail_ = 0; // flusher-only
+
+    // HDR-style transfer latency histograms, kept per backend and per log2
+    // size class. Recording is a relaxed atomic increment; the flusher
+    // publishes changed buckets as cumulative-count events named
+    // "xlh_<backend>_s<size>_b<bucket>", from which an external reader can
+    // derive arbitrary percentiles.
+    static constexpr size_t latHistSubBits_ = 5; // 32 sub-buckets per power of two
+    static constexpr size_t latHistLatBuckets_ = 24 << latHistSubBits_;
+    static constexpr size_t latHistSizeBuckets_ = 10; // log2(bytes) / 4, clamped
+    static constexpr size_t latHistSlots_ = 16; // max distinct backends
+
+    struct latHistogram {
+        std::array<std::atomic<uint64_t>, latHistSizeBuckets_ * latHistLatBuckets_> counts_{};
+        std::array<uint64_t, latHistSizeBuckets_ * latHistLatBuckets_> published_{}; // flusher-only
+    };
+
+    struct latHistSlot {
+        std::atomic<latHistogram *> hist_{nullptr};
+        std::string name_; // written once, before hist_ is published
+    };
+
+    static size_t
+    latHistIndex(uint64_t bytes, uint64_t lat_us);
+    latHistogram *
+    latHistLookup(const std::string &backend);
+    void
+    publishLatHists();
+
+    std::array<latHistSlot, latHistSlots_> latHists_;
+    std::vector<std::unique_ptr<latHistogram>> latHistStore_;
+    std::mutex latHistLock_; // guards slot creation only
+
+    // Per-peer traffic matrix: byte and request counters per remote agent,
+    // kept in a slot table like the latency histograms so recording is a
+    // lock-free scan plus relaxed increments. The flusher publishes changed
+    // counters as cumulative-count events named "peer_<counter>_<peer>",
+    // from which an external reader can render a traffic matrix per agent.
+    static constexpr size_t peerCounterKinds_ = 4; // tx/rx bytes, tx/rx requests
+    static constexpr size_t peerSlots_ = 64; // max distinct peers
+
+    struct peerCounters {
+        std::array<std::atomic<uint64_t>, peerCounterKinds_> counts_{};
+        std::array<uint64_t, peerCounterKinds_> published_{}; // flusher-only
+    };
+
+    struct peerSlot {
+        std::atomic<peerCounters *> counters_{nullptr};
+        std::string name_; // written once, before counters_ is published
+    };
+
+    peerCounters *
+    peerLookup(const std::string &peer);
+    void
+    publishPeerMatrix();
+
+    std::array<peerSlot, peerSlots_> peerMatrix_;
+    std::vector<std::unique_ptr<peerCounters>> peerStore_;
+    std::mutex peerLock_; // guards slot creation only
     asio::thread_pool pool_;
     periodicTask writeTask_;
     std::string file_;
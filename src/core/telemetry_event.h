@@ -17,14 +17,29 @@
 #ifndef _NIXL_TELEMETRY_H
 #define _NIXL_TELEMETRY_H
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <type_traits>
 
 #include "nixl_types.h"
 
 constexpr char TELEMETRY_BUFFER_SIZE_VAR[] = "NIXL_TELEMETRY_BUFFER_SIZE";
+// Non-zero asks for transparent hugepage backing of the shared buffer
+constexpr char TELEMETRY_BUFFER_HUGEPAGES_VAR[] = "NIXL_TELEMETRY_BUFFER_HUGEPAGES";
 constexpr char TELEMETRY_RUN_INTERVAL_VAR[] = "NIXL_TELEMETRY_RUN_INTERVAL";
+// Ring-overflow rotation: events per rotated segment file (0 disables
+// rotation and restores drop-on-full), and how many segments to keep
+constexpr char TELEMETRY_SEGMENT_EVENTS_VAR[] = "NIXL_TELEMETRY_SEGMENT_EVENTS";
+constexpr char TELEMETRY_SEGMENT_FILES_VAR[] = "NIXL_TELEMETRY_SEGMENT_FILES";
 
+/**
+ * Version of the telemetry record ABI. The on-disk/shared-memory layout of
+ * nixlTelemetryEvent (field order, widths and the static_asserts below) is a
+ * contract with out-of-band readers such as tools/nixl_telemetry_reader and
+ * examples/python/telemetry_reader.py; any layout change MUST bump this
+ * version, which openCyclicBuffer then rejects on mismatch.
+ */
 constexpr int TELEMETRY_VERSION = 1;
 constexpr size_t MAX_EVENT_NAME_LEN = 32;
 
@@ -32,7 +47,7 @@ constexpr size_t MAX_EVENT_NAME_LEN = 32;
  * @enum nixl_telemetry_category_t
  * @brief An enumeration of main telemetry event categories for easy filtering and aggregation
  */
-enum class nixl_telemetry_category_t {
+enum class nixl_telemetry_category_t : uint32_t {
     NIXL_TELEMETRY_MEMORY = 0, // Memory operations (register, deregister, allocation)
     NIXL_TELEMETRY_TRANSFER = 1, // Data transfer operations (read, write)
     NIXL_TELEMETRY_CONNECTION = 2, // Connection management (connect, disconnect)
@@ -71,4 +86,14 @@ struct nixlTelemetryEvent {
     }
 };
 
+// Layout contract for TELEMETRY_VERSION 1; see the comment on
+// TELEMETRY_VERSION before changing any of these
+static_assert(std::is_trivially_copyable<nixlTelemetryEvent>::value,
+              "telemetry records are copied through shared memory");
+static_assert(offsetof(nixlTelemetryEvent, timestampUs_) == 0 &&
+                  offsetof(nixlTelemetryEvent, category_) == 8 &&
+                  offsetof(nixlTelemetryEvent, eventName_) == 12 &&
+                  offsetof(nixlTelemetryEvent, value_) == 48 && sizeof(nixlTelemetryEvent) == 56,
+              "nixlTelemetryEvent layout changed; bump TELEMETRY_VERSION and update the readers");
+
 #endif // _NIXL_TELEMETRY_H
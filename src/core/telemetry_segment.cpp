@@ -0,0 +1,209 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/nixl_log.h"
+#include "common/nixl_lz.h"
+#include "telemetry_segment.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char segment_magic[8] = {'N', 'I', 'X', 'L', 'T', 'S', 'E', 'G'};
+
+struct columnView {
+    const uint8_t *data;
+    size_t size;
+};
+
+} // namespace
+
+bool
+nixlTelemetrySegmentWrite(const std::string &path, const std::vector<nixlTelemetryEvent> &events) {
+    const size_t count = events.size();
+
+    // Shred the row-form events into the four column arrays
+    std::vector<uint64_t> timestamps(count), values(count);
+    std::vector<uint32_t> categories(count);
+    std::vector<char> names(count * MAX_EVENT_NAME_LEN);
+    for (size_t i = 0; i < count; i++) {
+        timestamps[i] = events[i].timestampUs_;
+        categories[i] = static_cast<uint32_t>(events[i].category_);
+        values[i] = events[i].value_;
+        memcpy(&names[i * MAX_EVENT_NAME_LEN], events[i].eventName_, MAX_EVENT_NAME_LEN);
+    }
+
+    const columnView raw[TELEMETRY_SEGMENT_COLUMNS] = {
+        {reinterpret_cast<const uint8_t *>(timestamps.data()), count * sizeof(uint64_t)},
+        {reinterpret_cast<const uint8_t *>(categories.data()), count * sizeof(uint32_t)},
+        {reinterpret_cast<const uint8_t *>(names.data()), names.size()},
+        {reinterpret_cast<const uint8_t *>(values.data()), count * sizeof(uint64_t)},
+    };
+
+    nixlTelemetrySegmentHeader header{};
+    memcpy(header.magic, segment_magic, sizeof(header.magic));
+    header.version = TELEMETRY_VERSION;
+    header.count = static_cast<uint32_t>(count);
+
+    std::array<std::vector<uint8_t>, TELEMETRY_SEGMENT_COLUMNS> comp;
+    for (size_t i = 0; i < TELEMETRY_SEGMENT_COLUMNS; i++) {
+        header.rawSize[i] = raw[i].size;
+        comp[i].resize(nixlLzCompressBound(raw[i].size));
+        // A column that does not shrink is stored raw (compSize 0)
+        const size_t n = nixlLzCompress(raw[i].data, raw[i].size, comp[i].data(), comp[i].size());
+        header.compSize[i] = ((n != 0) && (n < raw[i].size)) ? n : 0;
+    }
+
+    // Write through a temporary name and rename, so a tailing reader never
+    // maps a half-written segment
+    const std::string tmp = path + ".tmp";
+    std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        NIXL_ERROR << "Failed to open telemetry segment for writing: " << tmp;
+        return false;
+    }
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (size_t i = 0; i < TELEMETRY_SEGMENT_COLUMNS; i++) {
+        if (header.compSize[i])
+            out.write(reinterpret_cast<const char *>(comp[i].data()), header.compSize[i]);
+        else
+            out.write(reinterpret_cast<const char *>(raw[i].data), raw[i].size);
+    }
+    out.close();
+
+    std::error_code ec;
+    if (!out) {
+        NIXL_ERROR << "Failed to write telemetry segment: " << tmp;
+        fs::remove(tmp, ec);
+        return false;
+    }
+    fs::rename(tmp, path, ec);
+    if (ec) {
+        NIXL_ERROR << "Failed to publish telemetry segment " << path << ": " << ec.message();
+        fs::remove(tmp, ec);
+        return false;
+    }
+    return true;
+}
+
+nixlTelemetrySegmentReader::nixlTelemetrySegmentReader(const std::string &path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+        throw std::runtime_error("Failed to open telemetry segment " + path + ": " +
+                                 strerror(errno));
+
+    struct stat st;
+    if ((fstat(fd, &st) == -1) ||
+        (static_cast<size_t>(st.st_size) < sizeof(nixlTelemetrySegmentHeader))) {
+        close(fd);
+        throw std::runtime_error("Telemetry segment too small: " + path);
+    }
+
+    mapSize_ = static_cast<size_t>(st.st_size);
+    map_ = mmap(nullptr, mapSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // the mapping keeps its own reference
+    if (map_ == MAP_FAILED) {
+        map_ = nullptr;
+        throw std::runtime_error("Failed to map telemetry segment " + path + ": " +
+                                 strerror(errno));
+    }
+
+    header_ = static_cast<const nixlTelemetrySegmentHeader *>(map_);
+    if (memcmp(header_->magic, segment_magic, sizeof(segment_magic)) != 0) {
+        munmap(map_, mapSize_);
+        throw std::runtime_error("Not a telemetry segment: " + path);
+    }
+    if (header_->version != static_cast<uint32_t>(TELEMETRY_VERSION)) {
+        munmap(map_, mapSize_);
+        throw std::runtime_error("Version mismatch: expected " +
+                                 std::to_string(TELEMETRY_VERSION) + ", got " +
+                                 std::to_string(header_->version));
+    }
+
+    // The stored payloads must fit the file and the raw columns must match
+    // the event count, so decode cannot run off the mapping
+    size_t stored = sizeof(nixlTelemetrySegmentHeader);
+    const size_t widths[TELEMETRY_SEGMENT_COLUMNS] = {
+        sizeof(uint64_t), sizeof(uint32_t), MAX_EVENT_NAME_LEN, sizeof(uint64_t)};
+    for (size_t i = 0; i < TELEMETRY_SEGMENT_COLUMNS; i++) {
+        if (header_->rawSize[i] != header_->count * widths[i]) {
+            munmap(map_, mapSize_);
+            throw std::runtime_error("Corrupt telemetry segment header: " + path);
+        }
+        stored += header_->compSize[i] ? header_->compSize[i] : header_->rawSize[i];
+    }
+    if (stored > mapSize_) {
+        munmap(map_, mapSize_);
+        throw std::runtime_error("Truncated telemetry segment: " + path);
+    }
+}
+
+nixlTelemetrySegmentReader::~nixlTelemetrySegmentReader() {
+    if (map_)
+        munmap(map_, mapSize_);
+}
+
+bool
+nixlTelemetrySegmentReader::decode(std::vector<nixlTelemetryEvent> &events) const {
+    const size_t count = header_->count;
+    const uint8_t *cursor = static_cast<const uint8_t *>(map_) + sizeof(*header_);
+
+    // Raw columns decode straight out of the mapping; compressed ones go
+    // through a scratch buffer
+    const uint8_t *col[TELEMETRY_SEGMENT_COLUMNS];
+    std::array<std::vector<uint8_t>, TELEMETRY_SEGMENT_COLUMNS> scratch;
+    for (size_t i = 0; i < TELEMETRY_SEGMENT_COLUMNS; i++) {
+        if (header_->compSize[i]) {
+            scratch[i].resize(header_->rawSize[i]);
+            if (nixlLzDecompress(cursor, header_->compSize[i], scratch[i].data(),
+                                 scratch[i].size()) != header_->rawSize[i]) {
+                NIXL_ERROR << "Corrupt telemetry segment column " << i;
+                return false;
+            }
+            col[i] = scratch[i].data();
+            cursor += header_->compSize[i];
+        } else {
+            col[i] = cursor;
+            cursor += header_->rawSize[i];
+        }
+    }
+
+    // Column starts are not alignment-preserving, so fields are assembled
+    // with memcpy instead of typed loads
+    events.reserve(events.size() + count);
+    for (size_t i = 0; i < count; i++) {
+        nixlTelemetryEvent event{};
+        uint32_t category;
+        memcpy(&event.timestampUs_, col[0] + i * sizeof(uint64_t), sizeof(uint64_t));
+        memcpy(&category, col[1] + i * sizeof(uint32_t), sizeof(uint32_t));
+        event.category_ = static_cast<nixl_telemetry_category_t>(category);
+        memcpy(event.eventName_, col[2] + i * MAX_EVENT_NAME_LEN, MAX_EVENT_NAME_LEN);
+        memcpy(&event.value_, col[3] + i * sizeof(uint64_t), sizeof(uint64_t));
+        events.push_back(event);
+    }
+    return true;
+}
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _TELEMETRY_SEGMENT_H
+#define _TELEMETRY_SEGMENT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "telemetry_event.h"
+
+// Rotated telemetry segments: when the live ring backs up during a burst,
+// the writer thread compacts the overflow into numbered files next to the
+// ring ("<ring>.seg.NNNNNN"), so history is bounded by the segment budget
+// instead of being dropped on wrap. Segments are columnar - the four event
+// fields are stored as contiguous arrays - and each column is LZ-compressed
+// (see nixl_lz.h), which collapses the heavily repeated event names.
+//
+// On-disk layout: nixlTelemetrySegmentHeader followed by the column
+// payloads back to back, in header order. A column whose compressed form
+// does not shrink is stored raw, marked by compSize == 0. Like the live
+// ring, the layout is an ABI with out-of-band readers; changes must bump
+// TELEMETRY_VERSION, which the reader rejects on mismatch.
+
+struct nixlTelemetrySegmentHeader {
+    char magic[8]; // "NIXLTSEG"
+    uint32_t version; // TELEMETRY_VERSION at write time
+    uint32_t count; // events in the segment
+    uint64_t rawSize[4]; // decoded bytes per column
+    uint64_t compSize[4]; // stored bytes per column; 0 = raw
+};
+
+static_assert(sizeof(nixlTelemetrySegmentHeader) == 80,
+              "segment header layout changed; bump TELEMETRY_VERSION and update the readers");
+
+// Columns in on-disk order: timestamps (u64), categories (u32), names
+// (MAX_EVENT_NAME_LEN each), values (u64)
+constexpr size_t TELEMETRY_SEGMENT_COLUMNS = 4;
+
+// Compacts events into a segment file, writing through a temporary name
+// and renaming so a tailing reader never maps a half-written segment.
+// Returns false (and logs) on IO failure; the events are then lost, as
+// they would have been without rotation.
+bool
+nixlTelemetrySegmentWrite(const std::string &path, const std::vector<nixlTelemetryEvent> &events);
+
+// mmap-backed segment reader: the file is mapped read-only and raw columns
+// decode straight out of the mapping, so following a segment directory
+// costs no read(2) copies. Throws std::runtime_error on open or validation
+// failure, like sharedRingBuffer.
+class nixlTelemetrySegmentReader {
+public:
+    explicit nixlTelemetrySegmentReader(const std::string &path);
+    ~nixlTelemetrySegmentReader();
+
+    // Non-copyable
+    nixlTelemetrySegmentReader(const nixlTelemetrySegmentReader &) = delete;
+    nixlTelemetrySegmentReader &
+    operator=(const nixlTelemetrySegmentReader &) = delete;
+
+    size_t
+    count() const {
+        return header_->count;
+    }
+
+    // Appends the segment's events to the vector in stored (timestamp)
+    // order; returns false on a corrupt column
+    bool
+    decode(std::vector<nixlTelemetryEvent> &events) const;
+
+private:
+    void *map_ = nullptr;
+    size_t mapSize_ = 0;
+    const nixlTelemetrySegmentHeader *header_ = nullptr;
+};
+
+#endif // _TELEMETRY_SEGMENT_H
@@ -0,0 +1,303 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "tiering.h"
+
+#include "nixl.h"
+#include "common/nixl_log.h"
+
+namespace {
+size_t
+dlistBytes(const nixl_xfer_dlist_t &descs) {
+    size_t bytes = 0;
+    for (const auto &desc : descs)
+        bytes += desc.len;
+    return bytes;
+}
+} // namespace
+
+nixlTieringEngine::nixlTieringEngine(const nixlAgent *agent,
+                                     const std::string &agent_name)
+    : agent(agent), agentName(agent_name) {}
+
+nixlTieringEngine::~nixlTieringEngine() {
+    {
+        std::lock_guard<std::mutex> guard(stateLock);
+        workerStop = true;
+    }
+    workCv.notify_all();
+    if (workerThread.joinable())
+        workerThread.join();
+
+    // Worker is gone; any still-running migrations are abandoned with
+    // their handles released (releaseXferReq cancels in-flight requests)
+    for (auto &move : inflight)
+        agent->releaseXferReq(move.req);
+}
+
+nixl_status_t
+nixlTieringEngine::configureTier(const nixl_mem_t &mem_type,
+                                 const nixlTierConfig &cfg) {
+    if (mem_type > FILE_SEG || cfg.capacityBytes == 0 ||
+        cfg.lowWatermark <= 0 || cfg.lowWatermark > cfg.highWatermark ||
+        cfg.highWatermark > 1.0) {
+        NIXL_ERROR_FUNC << "invalid tier configuration for mem type '"
+                        << mem_type << "'";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    std::lock_guard<std::mutex> guard(stateLock);
+    tiers[mem_type].cfg = cfg;
+    tiers[mem_type].configured = true;
+    return NIXL_SUCCESS;
+}
+
+void
+nixlTieringEngine::noteUsage(const nixl_mem_t &mem_type, int64_t delta) {
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> guard(stateLock);
+        tierState &tier = tiers[mem_type];
+        if (delta >= 0)
+            tier.usedBytes += delta;
+        else
+            tier.usedBytes -= std::min(tier.usedBytes, size_t(-delta));
+        // The deregistered blocks may be ones already evicted; the two
+        // cannot be matched up exactly, so just keep the invariant
+        if (tier.evictedBytes > tier.usedBytes)
+            tier.evictedBytes = tier.usedBytes;
+        wake = overHighWater(tier, 0) && !candidates.empty();
+    }
+    if (wake)
+        workCv.notify_all();
+}
+
+nixl_status_t
+nixlTieringEngine::designate(const nixl_xfer_dlist_t &src_descs,
+                             const nixl_xfer_dlist_t &dst_descs) {
+    if (src_descs.descCount() == 0 ||
+        src_descs.descCount() != dst_descs.descCount()) {
+        NIXL_ERROR_FUNC << "src and dst descriptor counts do not match";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(stateLock);
+        candidates.emplace_back(src_descs, dst_descs);
+        startWorkerLocked();
+    }
+    workCv.notify_all();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTieringEngine::pin(const nixl_xfer_dlist_t &descs) {
+    std::lock_guard<std::mutex> guard(stateLock);
+    for (const auto &desc : descs)
+        pinned.push_back(desc);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTieringEngine::unpin(const nixl_xfer_dlist_t &descs) {
+    std::lock_guard<std::mutex> guard(stateLock);
+    for (const auto &desc : descs)
+        for (auto it = pinned.begin(); it != pinned.end(); ++it)
+            if (*it == desc) {
+                pinned.erase(it);
+                break;
+            }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlTieringEngine::prefetch(const nixl_xfer_dlist_t &src_descs,
+                            const nixl_xfer_dlist_t &dst_descs) {
+    if (src_descs.descCount() == 0 ||
+        src_descs.descCount() != dst_descs.descCount()) {
+        NIXL_ERROR_FUNC << "src and dst descriptor counts do not match";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(stateLock);
+        prefetches.emplace_back(src_descs, dst_descs);
+        startWorkerLocked();
+    }
+    workCv.notify_all();
+    return NIXL_SUCCESS;
+}
+
+bool
+nixlTieringEngine::overlapsPinned(const nixl_xfer_dlist_t &descs) const {
+    for (const auto &desc : descs)
+        for (const auto &pin : pinned)
+            if (pin.devId == desc.devId && pin.overlaps(desc))
+                return true;
+    return false;
+}
+
+bool
+nixlTieringEngine::overHighWater(const tierState &tier,
+                                 size_t pending_bytes) const {
+    if (!tier.configured)
+        return false;
+    size_t gone = tier.evictedBytes + pending_bytes;
+    size_t occupancy = tier.usedBytes - std::min(tier.usedBytes, gone);
+    return occupancy > size_t(tier.cfg.highWatermark * tier.cfg.capacityBytes);
+}
+
+void
+nixlTieringEngine::startWorkerLocked() {
+    if (workerRunning)
+        return;
+    workerRunning = true;
+    workerThread = std::thread(&nixlTieringEngine::worker, this);
+}
+
+void
+nixlTieringEngine::worker() {
+    while (true) {
+        std::vector<blockMove> issue;
+        std::vector<bool> issue_evict;
+        std::vector<nixlXferReqH *> polls;
+
+        {
+            std::unique_lock<std::mutex> ul(stateLock);
+            bool pressure = false;
+            for (const auto &cand : candidates)
+                if (overHighWater(tiers[cand.src.getType()], 0)) {
+                    pressure = true;
+                    break;
+                }
+            // Fully idle: sleep until new work or pressure is signalled;
+            // otherwise wake periodically to poll in-flight migrations
+            if (!workerStop && inflight.empty() && prefetches.empty() &&
+                !pressure)
+                workCv.wait(ul);
+            else if (!workerStop)
+                workCv.wait_for(ul, workerPollPeriod);
+            if (workerStop)
+                return;
+
+            while (inflight.size() + issue.size() < maxInflight &&
+                   !prefetches.empty()) {
+                issue.push_back(std::move(prefetches.front()));
+                issue_evict.push_back(false);
+                prefetches.pop_front();
+            }
+
+            // Bytes already on their way out count against the watermark,
+            // so pressure is not over-reacted to
+            std::array<size_t, FILE_SEG + 1> pending{};
+            for (const auto &move : inflight)
+                if (move.isEviction)
+                    pending[move.srcMem] += move.bytes;
+
+            for (auto it = candidates.begin();
+                 it != candidates.end() &&
+                 inflight.size() + issue.size() < maxInflight;) {
+                const nixl_mem_t mem = it->src.getType();
+                if (!overHighWater(tiers[mem], pending[mem]))
+                    break;
+                if (overlapsPinned(it->src)) {
+                    // Pinned candidates stay queued for when they unpin
+                    ++it;
+                    continue;
+                }
+                pending[mem] += dlistBytes(it->src);
+                issue.push_back(std::move(*it));
+                issue_evict.push_back(true);
+                it = candidates.erase(it);
+            }
+
+            for (const auto &move : inflight)
+                polls.push_back(move.req);
+        }
+
+        // Agent calls below run without the engine lock held, the agent
+        // takes its own
+
+        std::vector<std::pair<nixlXferReqH *, nixl_status_t>> reaped;
+        for (auto *req : polls) {
+            const nixl_status_t ret = agent->getXferStatus(req);
+            if (ret == NIXL_IN_PROG)
+                continue;
+            if (ret < 0)
+                NIXL_WARN << "tier migration failed with status " << ret;
+            agent->releaseXferReq(req);
+            reaped.emplace_back(req, ret);
+        }
+
+        std::vector<inflightMove> started;
+        for (size_t i = 0; i < issue.size(); ++i) {
+            nixl_opt_args_t params;
+            params.hasNotif = false;
+            params.priority = nixl_xfer_priority_t::NIXL_XFER_PRIO_LOW;
+
+            inflightMove move;
+            move.srcMem = issue[i].src.getType();
+            move.bytes = dlistBytes(issue[i].src);
+            move.isEviction = issue_evict[i];
+
+            nixl_status_t ret = agent->createXferReq(NIXL_WRITE, issue[i].src,
+                                                     issue[i].dst, agentName,
+                                                     move.req, &params);
+            if (ret != NIXL_SUCCESS) {
+                NIXL_WARN << "tier migration setup failed with status " << ret
+                          << ", dropping the block move";
+                continue;
+            }
+            ret = agent->postXferReq(move.req, &params);
+            if (ret == NIXL_SUCCESS) {
+                // Completed within the post; a null handle marks it as
+                // already accounted below
+                agent->releaseXferReq(move.req);
+                move.req = nullptr;
+                if (move.isEviction)
+                    started.push_back(move);
+                continue;
+            }
+            if (ret < 0) {
+                NIXL_WARN << "tier migration post failed with status " << ret;
+                agent->releaseXferReq(move.req);
+                continue;
+            }
+            started.push_back(move);
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(stateLock);
+            for (const auto &[req, ret] : reaped) {
+                for (auto it = inflight.begin(); it != inflight.end(); ++it)
+                    if (it->req == req) {
+                        if (it->isEviction && ret == NIXL_SUCCESS)
+                            tiers[it->srcMem].evictedBytes += it->bytes;
+                        inflight.erase(it);
+                        break;
+                    }
+            }
+            for (auto &move : started) {
+                if (move.req == nullptr) {
+                    // Inline completion above, account it directly
+                    tiers[move.srcMem].evictedBytes += move.bytes;
+                    continue;
+                }
+                inflight.push_back(move);
+            }
+        }
+    }
+}
@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __TIERING_H_
+#define __TIERING_H_
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nixl_types.h"
+#include "nixl_descriptors.h"
+
+class nixlAgent;
+class nixlXferReqH;
+
+// Memory-pressure-aware block migration across the agent's own tiers
+// (e.g. VRAM to DRAM to file/object storage). Tracks registered bytes per
+// memory type against configured watermarks and migrates app-designated
+// blocks in the background as batched loopback transfers through the
+// regular createXferReq path, so any backend pair the agent already has
+// can serve a tier hop. Up to two migrations are kept in flight (double
+// buffering), issued at low priority so foreground transfers win the
+// scheduler gate.
+//
+// The worker thread only ever calls the agent's public API without
+// holding the engine lock; conversely noteUsage is called with the agent
+// lock held and only touches engine state, so the two locks never nest
+// in opposite orders.
+class nixlTieringEngine {
+public:
+    nixlTieringEngine(const nixlAgent *agent, const std::string &agent_name);
+    ~nixlTieringEngine();
+
+    nixl_status_t configureTier(const nixl_mem_t &mem_type, const nixlTierConfig &cfg);
+
+    // Registered-bytes accounting, hooked into registerMem/deregisterMem.
+    // Must not call back into the agent (its lock is held by the caller).
+    void noteUsage(const nixl_mem_t &mem_type, int64_t delta);
+
+    // Eviction candidates: src/dst lists aligned by index, migrated FIFO
+    // when the source tier crosses its high watermark
+    nixl_status_t designate(const nixl_xfer_dlist_t &src_descs,
+                            const nixl_xfer_dlist_t &dst_descs);
+
+    // Pinned ranges are skipped (left queued) by automatic eviction
+    nixl_status_t pin(const nixl_xfer_dlist_t &descs);
+    nixl_status_t unpin(const nixl_xfer_dlist_t &descs);
+
+    // Queues a background copy handled like an eviction but independent of
+    // watermark state; the engine owns and reaps the transfer handle
+    nixl_status_t prefetch(const nixl_xfer_dlist_t &src_descs,
+                           const nixl_xfer_dlist_t &dst_descs);
+
+private:
+    // Per-tier accounting. evictedBytes counts blocks migrated out whose
+    // source registration the app has not dropped yet; occupancy for
+    // watermark purposes is usedBytes - evictedBytes, and evictedBytes is
+    // clamped on deregistration since the two cannot be matched up exactly.
+    struct tierState {
+        nixlTierConfig cfg;
+        bool   configured   = false;
+        size_t usedBytes    = 0;
+        size_t evictedBytes = 0;
+    };
+
+    struct blockMove {
+        nixl_xfer_dlist_t src;
+        nixl_xfer_dlist_t dst;
+        blockMove(const nixl_xfer_dlist_t &s, const nixl_xfer_dlist_t &d)
+            : src(s), dst(d) {}
+    };
+
+    struct inflightMove {
+        nixlXferReqH *req = nullptr;
+        nixl_mem_t    srcMem;
+        size_t        bytes = 0;
+        bool          isEviction = false;
+    };
+
+    void startWorkerLocked();
+    void worker();
+    bool overlapsPinned(const nixl_xfer_dlist_t &descs) const;
+    // Occupancy the worker drives down to the low watermark; pending
+    // eviction bytes are counted as already gone
+    bool overHighWater(const tierState &tier, size_t pending_bytes) const;
+
+    const nixlAgent *agent;
+    std::string      agentName;
+
+    mutable std::mutex      stateLock;
+    std::condition_variable workCv;
+    std::thread             workerThread;
+    bool                    workerRunning = false;
+    bool                    workerStop    = false;
+
+    std::array<tierState, FILE_SEG + 1> tiers;
+    std::vector<nixlBasicDesc>          pinned;
+    std::deque<blockMove>               candidates;
+    std::deque<blockMove>               prefetches;
+    std::vector<inflightMove>           inflight;
+
+    // Double buffering: one migration drains while the next is posted
+    static constexpr size_t maxInflight = 2;
+    static constexpr std::chrono::milliseconds workerPollPeriod{10};
+};
+
+#endif
@@ -20,10 +20,103 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <functional>
+#include <vector>
 
 #include "nixl_types.h"
 #include "backend_engine.h"
 #include "telemetry.h"
+#include "common/object_pool.h"
+
+class nixlAgentData;
+
+// Initiator-side state of a relayed (multi-hop) transfer: the data is
+// pipelined through a staging area on the relay agent in chunks, double
+// buffered so hop one (initiator to staging) of one chunk overlaps hop two
+// (staging to final target, performed by the relay) of the previous one.
+// Flow control rides on the notification plumbing: hop-one completion
+// triggers a forward command to the relay, and the relay's ack frees the
+// staging slot (see nixlAgentData::advanceRelay/progressRelay).
+class nixlRelayState {
+public:
+    std::string relayAgent;
+    std::string finalAgent;
+    // Matches forward commands with relay acks across the wire
+    uint64_t    token = 0;
+
+    // Per-sub-range lists, aligned by index; descriptors larger than a
+    // staging slot are pre-split at creation time
+    nixl_meta_dlist_t  localDescs;
+    nixl_xfer_dlist_t  finalDescs;
+
+    // [first, last) sub-range window of each chunk
+    struct chunkSpan { int first; int last; };
+    std::vector<chunkSpan> chunks;
+
+    // Staging double buffer inside the relay's largest DRAM registration
+    uintptr_t slotBase[2] = {0, 0};
+    uint64_t  slotDevId = 0;
+    size_t    slotBytes = 0;
+
+    // Per-slot hop-one state: backend handle, carried chunk (-1 when
+    // free), and whether hop one finished and the relay ack is pending
+    nixlBackendReqH *slotHandle[2] = {nullptr, nullptr};
+    int  slotChunk[2] = {-1, -1};
+    bool slotAwaitingAck[2] = {false, false};
+
+    int  nextChunk = 0;
+    int  ackedChunks = 0;
+    nixl_status_t failStatus = NIXL_SUCCESS;
+
+    nixlRelayState(const nixl_mem_t &local_type, const nixl_mem_t &final_type)
+        : localDescs(local_type), finalDescs(final_type) {}
+};
+
+// State of a staged (two-leg pipelined) transfer on this agent: one backend
+// moves data between local storage and a pinned DRAM staging area, another
+// moves it between the staging area and the final memory (local or remote),
+// so e.g. an NVMe-to-VRAM restore runs as one request instead of two
+// app-coordinated ones. The staging area is double buffered and chunks
+// pipeline through the slots: the producer leg of one chunk (into staging)
+// overlaps the consumer leg of the previous one (out of staging); see
+// nixlAgentData::advanceStaged/progressStaged.
+class nixlStagedState {
+public:
+    // Which engine produces into / consumes out of staging depends on the
+    // direction: a READ restores storage to final memory, a WRITE dumps
+    // final memory to storage
+    nixlBackendEngine *storageEngine = nullptr;
+    nixlBackendEngine *finalEngine = nullptr;
+    std::string finalAgent;
+
+    // Per-sub-range lists, aligned by index; descriptors larger than a
+    // staging slot are pre-split at creation time
+    nixl_meta_dlist_t  storageDescs;
+    nixl_xfer_dlist_t  finalDescs;
+
+    // [first, last) sub-range window of each chunk
+    struct chunkSpan { int first; int last; };
+    std::vector<chunkSpan> chunks;
+
+    // Staging double buffer inside a caller-registered DRAM region
+    uintptr_t slotBase[2] = {0, 0};
+    uint64_t  slotDevId = 0;
+    size_t    slotBytes = 0;
+
+    // Per-slot state: the in-flight leg's handle and engine, carried chunk
+    // (-1 when free), and whether the slot is on its consumer leg
+    nixlBackendReqH   *slotHandle[2] = {nullptr, nullptr};
+    nixlBackendEngine *slotEngine[2] = {nullptr, nullptr};
+    int  slotChunk[2] = {-1, -1};
+    bool slotDraining[2] = {false, false};
+
+    int  nextChunk = 0;
+    int  doneChunks = 0;
+    nixl_status_t failStatus = NIXL_SUCCESS;
+
+    nixlStagedState(const nixl_mem_t &storage_type, const nixl_mem_t &final_type)
+        : storageDescs(storage_type), finalDescs(final_type) {}
+};
 
 enum nixl_telemetry_stat_status_t {
     NIXL_TELEMETRY_POST = 0,
@@ -32,8 +125,9 @@ enum nixl_telemetry_stat_status_t {
 };
 
 // Contains pointers to corresponding backend engine and its handler, and populated
-// and verified DescLists, and other state and metadata needed for a NIXL transfer
-class nixlXferReqH {
+// and verified DescLists, and other state and metadata needed for a NIXL transfer.
+// Handles are created and released per transfer, so their storage is pooled.
+class nixlXferReqH : public nixlPooledObject<nixlXferReqH> {
     private:
         nixlBackendEngine* engine         = nullptr;
         nixlBackendReqH*   backendHandle  = nullptr;
@@ -44,12 +138,122 @@ class nixlXferReqH {
         std::string        remoteAgent;
         nixl_blob_t        notifMsg;
         bool               hasNotif       = false;
+        // Traffic class handed to QoS-aware backends at dispatch; empty
+        // means unrestricted
+        std::string        trafficClass;
+        // Trace context carried with the notification for distributed
+        // correlation; empty when unused
+        nixl_blob_t        traceCtx;
+        // Integrity mode: a CRC32C trailer over the source descriptors is
+        // appended to the notification at dispatch time
+        bool               integrity      = false;
+        // Inline mode: the payload ships inside the notification and the
+        // backend transfer is skipped entirely
+        bool               inlineData     = false;
+        // Loopback mode: both sides live in this process's host memory, so
+        // the post is served by a direct memory copy; no backend engine or
+        // handle is attached to the request
+        bool               loopback       = false;
 
         nixl_xfer_op_t     backendOp;
         nixl_status_t      status;
 
+        // Post timestamp for the measured cost table; kept outside the
+        // telemetry struct so calibration works with telemetry disabled
+        chrono_point_t     costPostTime;
+
         nixl_xfer_telem_t telemetry;
 
+        // Scheduling state: posts of a lower class are deferred while a
+        // strictly higher class is in flight; an expired deadline forces
+        // dispatch. schedCounted tracks the in-flight accounting.
+        nixl_xfer_priority_t priority = nixl_xfer_priority_t::NIXL_XFER_PRIO_NORMAL;
+        chrono_point_t     schedDeadline;
+        bool               hasDeadline  = false;
+        bool               deferred     = false;
+        bool               schedCounted = false;
+
+        // Backend load accounting: set with schedCounted at dispatch and
+        // settled once at completion (see schedXferDone)
+        bool               loadCounted  = false;
+        uint64_t           loadBytes    = 0;
+        chrono_point_t     loadPostTime;
+
+        // Set once the stall watchdog has fired for the current post, so
+        // a stuck request dumps diagnostics only once per post
+        bool               stallReported = false;
+
+        // Per-peer send window accounting: bytes this request occupies and
+        // the backend key it was charged under ("" for the peer-wide window)
+        bool               windowCounted = false;
+        uint64_t           windowBytes   = 0;
+        nixl_backend_t     windowBknd;
+
+        // Set for relayed (multi-hop) transfers; such requests have no
+        // backend handle of their own, the per-slot hop-one handles live
+        // in the relay state
+        std::unique_ptr<nixlRelayState> relay;
+
+        // Set for staged (two-leg pipelined) transfers; the per-slot leg
+        // handles live in the staged state
+        std::unique_ptr<nixlStagedState> staged;
+
+        // Dependency edges: a post with dependsOn stays suspended until the
+        // predecessor leaves NIXL_IN_PROG, then is dispatched from whichever
+        // progress path observed the completion (see fireDepSuccessors).
+        // The predecessor owns the forward pointers; the back pointer lets a
+        // suspended successor unregister itself if released early.
+        std::vector<nixlXferReqH*> depSuccessors;
+        nixlXferReqH*      depPredecessor = nullptr;
+        bool               depSuspended   = false;
+
+        // Ordered-channel membership: posts on the same (peer, channel id)
+        // chain behind each other through the dependency edges above, so
+        // they complete visibly in FIFO order. The agent drops the channel
+        // tail pointer when this handle is released.
+        bool               onChannel = false;
+        std::pair<std::string, int> channelKey;
+
+        // Striped transfers carry one child request per rail; the parent has
+        // no backend handle of its own and aggregates the children's status.
+        // The notification, if any, is sent once all rails have completed.
+        std::vector<nixlXferReqH*> stripeReqs;
+        bool               notifSent = false;
+
+        // Auto-chunked transfers reuse the striping children for pipeline
+        // chunks of one oversized request on a single engine; at most
+        // chunkPipelineDepth chunks are posted at a time, and completions
+        // feed in the rest (see postChunkWindow), so other queued requests
+        // interleave with a large transfer instead of starving behind it
+        static constexpr int chunkPipelineDepth = 2;
+        bool               chunked   = false;
+        int                nextChunk = 0;
+        // Agent back-pointer of an auto-chunked request, so the chunk
+        // pipeline can consult the class shaping bucket per chunk (see
+        // nixlAgentData::classRateTakeChunk)
+        nixlAgentData      *sched = nullptr;
+
+        bool isStriped() const { return !stripeReqs.empty(); }
+
+        // Posts chunk children until the pipeline depth is reached or all
+        // chunks are out; returns the aggregate status
+        nixl_status_t postChunkWindow();
+
+        // Polls the backend(s); for striped requests aggregates the rails
+        // and triggers the deferred notification upon full completion.
+        // A non-default deadline stops the rail/chunk polling loop early,
+        // leaving the remaining children for the next call.
+        nixl_status_t checkBackendStatus(const chrono_point_t &deadline = chrono_point_t());
+        void sendStripeNotif();
+
+        // Optional completion notification sinks, set per post from opt args
+        std::function<void(nixl_status_t)> completionCallback;
+        int                completionEventFd = -1;
+
+        bool hasCompletionSignal() const {
+            return (completionEventFd >= 0) || (completionCallback != nullptr);
+        }
+
     public:
         inline nixlXferReqH() { }
 
@@ -59,6 +263,16 @@ class nixlXferReqH {
             delete targetDescs;
             if (backendHandle != nullptr)
                 engine->releaseReqH(backendHandle);
+            if (relay)
+                for (int s = 0; s < 2; ++s)
+                    if (relay->slotHandle[s])
+                        engine->releaseReqH(relay->slotHandle[s]);
+            if (staged)
+                for (int s = 0; s < 2; ++s)
+                    if (staged->slotHandle[s])
+                        staged->slotEngine[s]->releaseReqH(staged->slotHandle[s]);
+            for (auto &child : stripeReqs)
+                delete child;
         }
 
         void
@@ -66,9 +280,10 @@ class nixlXferReqH {
                            nixl_telemetry_stat_status_t stat_status);
 
         friend class nixlAgent;
+        friend class nixlAgentData;
 };
 
-class nixlDlistH {
+class nixlDlistH : public nixlPooledObject<nixlDlistH> {
     private:
         std::unordered_map<nixlBackendEngine*, nixl_meta_dlist_t*> descs;
 
@@ -59,6 +59,15 @@ public:
 };
 
 class nixlSecDescList : public nixlDescList<nixlSectionDesc> {
+private:
+    // Interval index over the sorted list: prefix maximum of (addr + len)
+    // within each devId run, so covering-range queries stay logarithmic
+    // even with nested or overlapping registrations
+    std::vector<uintptr_t> maxEnd;
+
+    void
+    rebuildMaxEnd(size_t from);
+
 public:
     explicit nixlSecDescList(const nixl_mem_t &type) : nixlDescList<nixlSectionDesc>(type, 0) {}
 
@@ -67,6 +76,15 @@ public:
     void
     addDesc(const nixlSectionDesc &desc) override;
 
+    // Trusted append: caller attests desc sorts at or after the current
+    // tail, so the insertion search is skipped and the interval index is
+    // extended in O(1). Order is only asserted in debug builds.
+    void
+    addSortedDesc(const nixlSectionDesc &desc);
+
+    void
+    remDesc(const int &index) override;
+
     bool
     verifySorted() const;
 
@@ -79,6 +97,14 @@ public:
     int
     getCoveringIndex(const nixlBasicDesc &query) const;
 
+    // Per-index rebind would break the sorted order the interval index
+    // relies on; a uniform shift preserves it and only moves maxEnd
+    nixl_status_t
+    rebind(const unsigned int &index, const uintptr_t &addr) override;
+
+    void
+    rebind(const ptrdiff_t &offset) override;
+
     void
     resize(const size_t &count) override;
 
@@ -105,23 +131,53 @@ class nixlMemSection {
                                 nixlBackendEngine* backend,
                                 nixl_meta_dlist_t &resp) const;
 
+        // In-place re-resolution of a previously populated resp after its
+        // buffers moved: unchanged descriptors are left untouched, changed
+        // ones are re-resolved with a covering search. resp must come from
+        // an earlier populate with the same length and memory type.
+        nixl_status_t repopulate (const nixl_xfer_dlist_t &query,
+                                  nixlBackendEngine* backend,
+                                  nixl_meta_dlist_t &resp) const;
+
 
         virtual ~nixlMemSection () = 0; // Making the class abstract
 };
 
 
 class nixlLocalSection : public nixlMemSection {
+    private:
+        // Set by the mutators below; the agent clears it once it has
+        // rebuilt its cached serialized metadata blob, so unchanged
+        // sections are not re-serialized on every getLocalMD/sendLocalMD
+        bool serialDirty = true;
+
     public:
+        bool isSerialDirty () const { return serialDirty; }
+        void clearSerialDirty () { serialDirty = false; }
+
+        // pre_registered, when given, holds one backend MD per element of
+        // mem_elms (from a prior registerMems call) whose ownership moves
+        // to the section; otherwise the memories are registered here
         nixl_status_t addDescList (const nixl_reg_dlist_t &mem_elms,
                                    nixlBackendEngine* backend,
-                                   nixl_sec_dlist_t &remote_self);
+                                   nixl_sec_dlist_t &remote_self,
+                                   const std::vector<nixlBackendMD*> *pre_registered = nullptr);
 
-        // Each nixlBasicDesc should be same as original registration region
+        // Each nixlBasicDesc should be same as original registration region.
+        // reclaimed, when given, receives the backend MDs of the removed
+        // regions (ownership moves to the caller) instead of deregistering
+        // them here, so the actual backend unmaps can be deferred
         nixl_status_t remDescList (const nixl_reg_dlist_t &mem_elms,
-                                   nixlBackendEngine* backend);
+                                   nixlBackendEngine* backend,
+                                   std::vector<nixlBackendMD*> *reclaimed = nullptr);
 
         nixl_status_t serialize(nixlSerDes* serializer) const;
 
+        // Immutable registration snapshot for the agent's lock-free query
+        // path (see nixlRegSnapshot); the version stamp comes from the
+        // caller, which owns the publication counter
+        std::shared_ptr<const nixlRegSnapshot> makeSnapshot (uint64_t version) const;
+
         nixl_status_t serializePartial(nixlSerDes* serializer,
                                        const backend_set_t &backends,
                                        const nixl_reg_dlist_t &mem_elms) const;
@@ -146,6 +202,18 @@ class nixlRemoteSection : public nixlMemSection {
         // When adding self as a remote agent for local operations
         nixl_status_t loadLocalData (const nixl_sec_dlist_t& mem_elms,
                                      nixlBackendEngine* backend);
+
+        // In-place removal for delta metadata updates; missing descs are
+        // skipped so removals stay idempotent across repeated deltas
+        nixl_status_t remDescList (const nixl_reg_dlist_t &mem_elms,
+                                   nixlBackendEngine* backend);
+
+        // Largest registered range of the given memory type on this remote,
+        // used as the staging area for relayed transfers
+        nixl_status_t getStagingDesc (const nixl_mem_t &mem,
+                                      nixlBackendEngine* backend,
+                                      nixlSectionDesc &resp) const;
+
         ~nixlRemoteSection();
 };
 
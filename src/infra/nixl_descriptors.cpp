@@ -18,6 +18,7 @@
 #include <functional>
 #include <stdexcept>
 #include <iostream>
+#include <vector>
 #include "nixl.h"
 #include "nixl_descriptors.h"
 #include "mem_section.h"
@@ -105,6 +106,18 @@ nixlBlobDesc::nixlBlobDesc(const uintptr_t &addr,
     this->metaInfo = meta_info;
 }
 
+nixlBlobDesc::nixlBlobDesc(const uintptr_t &addr,
+                           const size_t &len,
+                           const uint64_t &dev_id,
+                           int dmabuf_fd,
+                           const size_t &dmabuf_offset,
+                           const nixl_blob_t &meta_info) :
+                           nixlBasicDesc(addr, len, dev_id) {
+    this->metaInfo     = meta_info;
+    this->dmabufFd     = dmabuf_fd;
+    this->dmabufOffset = dmabuf_offset;
+}
+
 nixlBlobDesc::nixlBlobDesc(const nixlBasicDesc &desc,
                            const nixl_blob_t &meta_info) :
                            nixlBasicDesc(desc) {
@@ -146,6 +159,22 @@ void nixlBlobDesc::print(const std::string &suffix) const {
 // The template is used to select from nixlBasicDesc/nixlMetaDesc/nixlBlobDesc
 // There are no virtual functions, so the object is all data, no pointers.
 
+namespace {
+    // Wire-visible metadata of a descriptor, used by the run-length
+    // serializer to decide whether consecutive elements are identical
+    // up to their address; overload resolution picks the most derived
+    const nixl_blob_t desc_no_meta;
+    inline const nixl_blob_t &descWireMeta(const nixlBasicDesc &) { return desc_no_meta; }
+    inline const nixl_blob_t &descWireMeta(const nixlBlobDesc &desc) { return desc.metaInfo; }
+    inline const nixl_blob_t &descWireMeta(const nixlSectionDesc &desc) { return desc.metaBlob; }
+
+    // One record of the run-length encoded list format: the first
+    // descriptor of the run, the address step between elements, and the
+    // element count; the per-run metadata follows as a separate field
+    constexpr size_t desc_run_rec_size =
+        sizeof(nixlBasicDesc) + sizeof(int64_t) + sizeof(uint64_t);
+}
+
 template<class T> nixlDescList<T>::nixlDescList(const nixl_mem_t &type, const int &init_size) {
     static_assert (std::is_base_of<nixlBasicDesc, T>::value);
     this->type = type;
@@ -185,6 +214,40 @@ nixlDescList<T>::nixlDescList(nixlSerDes* deserializer) {
         str.copy(reinterpret_cast<char*>(descs.data()), str.size());
 
     } else if (std::is_same<nixlBlobDesc, T>::value) {
+        if (str=="nixlRDList") {
+            // Run-length encoded uniform ranges (see serialize);
+            // expanded back to the regular per-element representation
+            uint64_t n_runs;
+            if (deserializer->getBuf("r", &n_runs, sizeof(n_runs)))
+                return;
+            descs.reserve(n_desc);
+            for (uint64_t r = 0; r < n_runs; ++r) {
+                str = deserializer->getStr("");
+                if (str.size() != desc_run_rec_size) {
+                    descs.clear();
+                    return;
+                }
+                int64_t pitch;
+                uint64_t count;
+                str.copy(reinterpret_cast<char*>(&pitch), sizeof(pitch),
+                         sizeof(nixlBasicDesc));
+                str.copy(reinterpret_cast<char*>(&count), sizeof(count),
+                         sizeof(nixlBasicDesc) + sizeof(pitch));
+                if (count == 0 || count > n_desc - descs.size()) {
+                    descs.clear();
+                    return;
+                }
+                T elm(str.substr(0, sizeof(nixlBasicDesc)) + deserializer->getStr(""));
+                uintptr_t base_addr = elm.addr;
+                for (uint64_t i = 0; i < count; ++i) {
+                    elm.addr = base_addr + i * pitch;
+                    descs.push_back(elm);
+                }
+            }
+            if (descs.size() != n_desc)
+                descs.clear();
+            return;
+        }
         if (str!="nixlSDList")
             return;
         for (size_t i=0; i<n_desc; ++i) {
@@ -224,6 +287,25 @@ void nixlDescList<T>::addDesc (const T &desc) {
     descs.push_back(desc);
 }
 
+template <class T>
+nixl_status_t
+nixlDescList<T>::addStridedDesc(const nixlStridedDesc &sdesc) {
+    if (sdesc.count == 0 || sdesc.blockLen == 0 || sdesc.pitch < sdesc.blockLen)
+        return NIXL_ERR_INVALID_PARAM;
+
+    descs.reserve(descs.size() + sdesc.count);
+    T desc;
+    desc.len = sdesc.blockLen;
+    desc.devId = sdesc.devId;
+    // Going through the virtual addDesc keeps sorted subclasses correct;
+    // for plain lists it is a straight append into the reserved storage
+    for (size_t i = 0; i < sdesc.count; ++i) {
+        desc.addr = sdesc.addr + i * sdesc.pitch;
+        addDesc(desc);
+    }
+    return NIXL_SUCCESS;
+}
+
 template <class T>
 void nixlDescList<T>::remDesc (const int &index){
     if (((size_t) index >= descs.size()) || (index < 0))
@@ -237,6 +319,21 @@ nixlDescList<T>::resize(const size_t &count) {
     descs.resize(count);
 }
 
+template<class T>
+nixl_status_t
+nixlDescList<T>::rebind(const unsigned int &index, const uintptr_t &addr) {
+    if (index >= descs.size()) return NIXL_ERR_INVALID_PARAM;
+    descs[index].addr = addr;
+    return NIXL_SUCCESS;
+}
+
+template<class T>
+void
+nixlDescList<T>::rebind(const ptrdiff_t &offset) {
+    for (auto &desc : descs)
+        desc.addr += offset;
+}
+
 template <class T>
 nixlDescList<nixlBasicDesc> nixlDescList<T>::trim() const {
 
@@ -256,6 +353,147 @@ nixlDescList<nixlBasicDesc> nixlDescList<T>::trim() const {
     }
 }
 
+/*** Set operations on sorted descriptor lists ***/
+
+// The set operations treat a sorted list as a set of byte ranges per
+// device. Both inputs are first collapsed into maximal disjoint ranges in
+// one pass, which also validates sortedness; the actual union/difference/
+// intersection is then a linear merge over the disjoint ranges.
+
+namespace {
+
+// Appends the maximal disjoint (devId, range) intervals of a list to out,
+// merging overlapping or adjacent descriptors. Returns false if the list
+// is not sorted by (devId, addr).
+template <class T>
+bool coalesceSorted(const nixlDescList<T> &list, std::vector<nixlBasicDesc> &out) {
+    for (int i = 0; i < list.descCount(); ++i) {
+        const nixlBasicDesc &cur = list[i];
+        if ((i > 0) && ((cur.devId < list[i - 1].devId) ||
+                        ((cur.devId == list[i - 1].devId) && (cur.addr < list[i - 1].addr))))
+            return false;
+        if (!out.empty() && (out.back().devId == cur.devId) &&
+            (out.back().addr + out.back().len >= cur.addr)) {
+            uintptr_t end = std::max(out.back().addr + out.back().len, cur.addr + cur.len);
+            out.back().len = end - out.back().addr;
+        } else {
+            out.push_back(cur);
+        }
+    }
+    return true;
+}
+
+// Replaces the contents of result with the given ranges, keeping any heap
+// capacity result already has (re-typing assignment preserves it)
+void fillResult(const nixl_mem_t &type,
+                const std::vector<nixlBasicDesc> &ranges,
+                nixlDescList<nixlBasicDesc> &result) {
+    result = nixlDescList<nixlBasicDesc>(type);
+    for (const auto &range : ranges)
+        result.addDesc(range);
+}
+
+} // namespace
+
+template <class T>
+nixl_status_t
+nixlDescList<T>::setUnion(const nixlDescList<T> &other,
+                          nixlDescList<nixlBasicDesc> &result) const {
+    if (type != other.getType())
+        return NIXL_ERR_MISMATCH;
+
+    std::vector<nixlBasicDesc> a, b;
+    if (!coalesceSorted(*this, a) || !coalesceSorted(other, b))
+        return NIXL_ERR_INVALID_PARAM;
+
+    std::vector<nixlBasicDesc> merged;
+    merged.reserve(a.size() + b.size());
+    size_t i = 0, j = 0;
+    while ((i < a.size()) || (j < b.size())) {
+        const nixlBasicDesc &cur =
+            ((j == b.size()) || ((i < a.size()) && (a[i] < b[j]))) ? a[i++] : b[j++];
+        if (!merged.empty() && (merged.back().devId == cur.devId) &&
+            (merged.back().addr + merged.back().len >= cur.addr)) {
+            uintptr_t end = std::max(merged.back().addr + merged.back().len,
+                                     cur.addr + cur.len);
+            merged.back().len = end - merged.back().addr;
+        } else {
+            merged.push_back(cur);
+        }
+    }
+
+    fillResult(type, merged, result);
+    return NIXL_SUCCESS;
+}
+
+template <class T>
+nixl_status_t
+nixlDescList<T>::setDifference(const nixlDescList<T> &other,
+                               nixlDescList<nixlBasicDesc> &result) const {
+    if (type != other.getType())
+        return NIXL_ERR_MISMATCH;
+
+    std::vector<nixlBasicDesc> a, b;
+    if (!coalesceSorted(*this, a) || !coalesceSorted(other, b))
+        return NIXL_ERR_INVALID_PARAM;
+
+    std::vector<nixlBasicDesc> out;
+    size_t j = 0;
+    for (const auto &cur : a) {
+        uintptr_t start = cur.addr;
+        uintptr_t end = cur.addr + cur.len;
+        // Skip ranges entirely before this one; later ranges of `a` only
+        // move forward, so j never backtracks and the pass stays linear
+        while ((j < b.size()) && ((b[j].devId < cur.devId) ||
+               ((b[j].devId == cur.devId) && (b[j].addr + b[j].len <= start))))
+            ++j;
+        // The last overlapping range may also clip the next range of `a`,
+        // so scan with a lookahead index instead of advancing j past it
+        for (size_t k = j; (k < b.size()) && (b[k].devId == cur.devId) &&
+                           (b[k].addr < end); ++k) {
+            if (b[k].addr > start)
+                out.push_back(nixlBasicDesc(start, b[k].addr - start, cur.devId));
+            start = std::max(start, b[k].addr + b[k].len);
+        }
+        if (start < end)
+            out.push_back(nixlBasicDesc(start, end - start, cur.devId));
+    }
+
+    fillResult(type, out, result);
+    return NIXL_SUCCESS;
+}
+
+template <class T>
+nixl_status_t
+nixlDescList<T>::setIntersection(const nixlDescList<T> &other,
+                                 nixlDescList<nixlBasicDesc> &result) const {
+    if (type != other.getType())
+        return NIXL_ERR_MISMATCH;
+
+    std::vector<nixlBasicDesc> a, b;
+    if (!coalesceSorted(*this, a) || !coalesceSorted(other, b))
+        return NIXL_ERR_INVALID_PARAM;
+
+    std::vector<nixlBasicDesc> out;
+    size_t j = 0;
+    for (const auto &cur : a) {
+        uintptr_t end = cur.addr + cur.len;
+        while ((j < b.size()) && ((b[j].devId < cur.devId) ||
+               ((b[j].devId == cur.devId) && (b[j].addr + b[j].len <= cur.addr))))
+            ++j;
+        for (size_t k = j; (k < b.size()) && (b[k].devId == cur.devId) &&
+                           (b[k].addr < end); ++k) {
+            uintptr_t lo = std::max(cur.addr, b[k].addr);
+            uintptr_t hi = std::min(end, b[k].addr + b[k].len);
+            if (lo < hi)
+                out.push_back(nixlBasicDesc(lo, hi - lo, cur.devId));
+        }
+    }
+
+    fillResult(type, out, result);
+    return NIXL_SUCCESS;
+}
+
 template <class T>
 int nixlDescList<T>::getIndex(const nixlBasicDesc &query) const {
     auto itr = std::find(descs.begin(), descs.end(), query);
@@ -273,15 +511,53 @@ nixl_status_t nixlDescList<T>::serialize(nixlSerDes* serializer) const {
     if (std::is_same<nixlMetaDesc, T>::value)
         return NIXL_ERR_INVALID_PARAM;
 
+    bool blob_list = std::is_same<nixlBlobDesc, T>::value ||
+                     std::is_same<nixlSectionDesc, T>::value;
+    if (!blob_list && !std::is_same<nixlBasicDesc, T>::value)
+        return NIXL_ERR_INVALID_PARAM;
+
+    // Run-length scan for blob lists: KV pools and similar uniform
+    // registrations are fixed-size blocks at a regular stride with the
+    // same metadata, so consecutive elements that only differ by a
+    // constant address step collapse into one record per run
+    struct descRun { size_t first; uint64_t count; int64_t pitch; };
+    std::vector<descRun> runs;
+    if (blob_list) {
+        for (size_t i = 0; i < n_desc; ++i) {
+            if (!runs.empty()) {
+                auto &run = runs.back();
+                const T &head = descs[run.first];
+                const T &cur  = descs[i];
+                if (cur.len == head.len && cur.devId == head.devId &&
+                    descWireMeta(cur) == descWireMeta(head)) {
+                    int64_t step = static_cast<int64_t>(cur.addr) -
+                                   static_cast<int64_t>(descs[i - 1].addr);
+                    if (run.count == 1) {
+                        run.pitch = step;
+                        run.count++;
+                        continue;
+                    }
+                    if (step == run.pitch) {
+                        run.count++;
+                        continue;
+                    }
+                }
+            }
+            runs.push_back({i, 1, 0});
+        }
+    }
+    // The run format costs pitch+count extra per run, so only switch to
+    // it when runs average at least two elements; irregular lists keep
+    // the per-element format, as do all lists towards older receivers
+    bool run_encode = blob_list && n_desc >= 2 && runs.size() <= n_desc / 2;
+
     // For now very few descriptor types, if needed can add a name method to each
     // descriptor. std::string_view(typeid(T).name()) is compiler dependent
     if (std::is_same<nixlBasicDesc, T>::value)
         ret = serializer->addStr("nixlDList", "nixlBDList");
     // We serialize SectionDesc the same as BlobDesc so it will be deserialized as BlobDesc on the other side
-    else if (std::is_same<nixlBlobDesc, T>::value || std::is_same<nixlSectionDesc, T>::value)
-        ret = serializer->addStr("nixlDList", "nixlSDList");
     else
-        return NIXL_ERR_INVALID_PARAM;
+        ret = serializer->addStr("nixlDList", run_encode ? "nixlRDList" : "nixlSDList");
 
     if (ret) return ret;
 
@@ -301,6 +577,20 @@ nixl_status_t nixlDescList<T>::serialize(nixlSerDes* serializer) const {
                                  reinterpret_cast<const char*>(descs.data()),
                                  n_desc * sizeof(nixlBasicDesc)));
         if (ret) return ret;
+    } else if (run_encode) {
+        uint64_t n_runs = runs.size();
+        ret = serializer->addBuf("r", &n_runs, sizeof(n_runs));
+        if (ret) return ret;
+        for (auto &run : runs) {
+            const nixlBasicDesc &base = descs[run.first];
+            nixl_blob_t rec = base.serialize();
+            rec.append(reinterpret_cast<const char*>(&run.pitch), sizeof(run.pitch));
+            rec.append(reinterpret_cast<const char*>(&run.count), sizeof(run.count));
+            ret = serializer->addStr("", rec);
+            if (ret) return ret;
+            ret = serializer->addStr("", descWireMeta(descs[run.first]));
+            if (ret) return ret;
+        }
     } else { // already checked it can be only nixlBlobDesc or nixlSectionDesc
         for (auto & elm : descs) {
             ret = serializer->addStr("", elm.serialize());
@@ -344,15 +634,56 @@ template bool operator==<nixlBlobDesc>(const nixlDescList<nixlBlobDesc> &lhs,
 template bool operator==<nixlSectionDesc>(const nixlDescList<nixlSectionDesc> &lhs,
                                           const nixlDescList<nixlSectionDesc> &rhs);
 
-// nixlSecDescList keeps the elements sorted
+// nixlSecDescList keeps the elements sorted. Appends at the tail take a
+// single comparison against the last element: it proves the list stays
+// sorted, so the insertion search and interval-index rebuild are skipped.
+// Lists are commonly built in ascending order (deserialized sections,
+// bulk registrations), making this the dominant path.
 void
 nixlSecDescList::addDesc(const nixlSectionDesc &desc) {
     auto &vec = this->descs;
+    if ((vec.size() == 0) || !(desc < vec[vec.size() - 1])) {
+        addSortedDesc(desc);
+        return;
+    }
     auto itr = std::upper_bound(vec.begin(), vec.end(), desc);
-    if (itr == vec.end())
-        vec.push_back(desc);
+    size_t pos = itr - vec.begin();
+    vec.insert(itr, desc);
+    rebuildMaxEnd(pos);
+}
+
+void
+nixlSecDescList::addSortedDesc(const nixlSectionDesc &desc) {
+    auto &vec = this->descs;
+    assert((vec.size() == 0) || !(desc < vec[vec.size() - 1]));
+    uintptr_t end = desc.addr + desc.len;
+    size_t i = vec.size();
+    vec.push_back(desc);
+    if ((i > 0) && (vec[i - 1].devId == desc.devId))
+        maxEnd.push_back(std::max(maxEnd[i - 1], end));
     else
-        vec.insert(itr, desc);
+        maxEnd.push_back(end);
+}
+
+void
+nixlSecDescList::remDesc(const int &index) {
+    nixlDescList<nixlSectionDesc>::remDesc(index);
+    rebuildMaxEnd(index);
+}
+
+// Maintains the prefix maximum of interval ends per devId run, from the
+// first modified element onward
+void
+nixlSecDescList::rebuildMaxEnd(size_t from) {
+    const auto &vec = this->descs;
+    maxEnd.resize(vec.size());
+    for (size_t i = from; i < vec.size(); ++i) {
+        uintptr_t end = vec[i].addr + vec[i].len;
+        if ((i > 0) && (vec[i - 1].devId == vec[i].devId))
+            maxEnd[i] = std::max(maxEnd[i - 1], end);
+        else
+            maxEnd[i] = end;
+    }
 }
 
 bool
@@ -366,6 +697,18 @@ nixlSecDescList::verifySorted() const {
     return true;
 }
 
+nixl_status_t
+nixlSecDescList::rebind(const unsigned int &, const uintptr_t &) {
+    return NIXL_ERR_NOT_SUPPORTED;
+}
+
+void
+nixlSecDescList::rebind(const ptrdiff_t &offset) {
+    nixlDescList<nixlSectionDesc>::rebind(offset);
+    for (auto &end : maxEnd)
+        end += offset;
+}
+
 nixlSectionDesc &
 nixlSecDescList::operator[](unsigned int index) {
     nixlSectionDesc &ref = this->descs[index];
@@ -384,14 +727,33 @@ nixlSecDescList::getIndex(const nixlBasicDesc &query) const {
 
 int
 nixlSecDescList::getCoveringIndex(const nixlBasicDesc &query) const {
-    auto itr = std::lower_bound(this->descs.begin(), this->descs.end(), query);
-    if (itr != this->descs.end() && itr->covers(query))
-        return static_cast<int>(itr - this->descs.begin());
-    // If query and element don't have the same start address, try previous entry
-    if (itr != this->descs.begin()) {
-        auto prev_itr = std::prev(itr, 1);
-        if (prev_itr->covers(query)) return static_cast<int>(prev_itr - this->descs.begin());
-    }
+    const auto &vec = this->descs;
+    auto itr = std::lower_bound(vec.begin(), vec.end(), query);
+    if (itr != vec.end() && itr->covers(query))
+        return static_cast<int>(itr - vec.begin());
+    if (itr == vec.begin())
+        return -1;
+
+    // All preceding entries of the same devId start at or before the query.
+    // Within that run maxEnd is non-decreasing, so the first entry whose
+    // prefix maximum reaches the query end is the one extending that far,
+    // even when registrations are nested or overlapping.
+    size_t pos = itr - vec.begin();
+    nixlBasicDesc dev_floor(0, 0, query.devId);
+    size_t run_start =
+        std::lower_bound(vec.begin(), vec.begin() + pos, dev_floor) - vec.begin();
+    if ((run_start == pos) || (vec[run_start].devId != query.devId))
+        return -1;
+
+    uintptr_t query_end = query.addr + query.len;
+    auto cover_itr = std::lower_bound(maxEnd.begin() + run_start,
+                                      maxEnd.begin() + pos, query_end);
+    if (cover_itr == maxEnd.begin() + pos)
+        return -1;
+
+    size_t index = cover_itr - maxEnd.begin();
+    if (vec[index].covers(query))
+        return static_cast<int>(index);
     return -1;
 }
 
@@ -401,4 +763,6 @@ nixlSecDescList::resize(const size_t &count) {
         throw std::logic_error(
             "nixlSecDescList: to keep list sorted, resize growth is not allowed.");
     this->descs.resize(count);
+    // Truncation keeps the remaining prefix maxima valid
+    maxEnd.resize(count);
 }
@@ -87,17 +87,69 @@ nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
     return NIXL_SUCCESS;
 }
 
+nixl_status_t nixlMemSection::repopulate (const nixl_xfer_dlist_t &query,
+                                          nixlBackendEngine* backend,
+                                          nixl_meta_dlist_t &resp) const {
+
+    if ((query.getType() != resp.getType()) ||
+        (query.descCount() != resp.descCount()) || (query.descCount() == 0))
+        return NIXL_ERR_INVALID_PARAM;
+
+    // The section list is looked up lazily, only once a descriptor
+    // actually changed
+    const nixl_sec_dlist_t* base = nullptr;
+
+    for (int i = 0; i < query.descCount(); ++i) {
+        if (static_cast<const nixlBasicDesc &>(resp[i]) == query[i])
+            continue;
+
+        if (!base) {
+            auto it = sectionMap.find(std::make_pair(query.getType(), backend));
+            if (it == sectionMap.end())
+                return NIXL_ERR_NOT_FOUND;
+            base = it->second;
+        }
+
+        int s_index = base->getCoveringIndex(query[i]);
+        if (s_index < 0)
+            return NIXL_ERR_UNKNOWN;
+
+        static_cast<nixlBasicDesc &>(resp[i]) = query[i];
+        resp[i].metadataP = (*base)[s_index].metadataP;
+    }
+    return NIXL_SUCCESS;
+}
+
 /*** Class nixlLocalSection implementation ***/
 
 // Calls into backend engine to register the memories in the desc list
 nixl_status_t nixlLocalSection::addDescList (const nixl_reg_dlist_t &mem_elms,
                                              nixlBackendEngine* backend,
-                                             nixl_sec_dlist_t &remote_self) {
+                                             nixl_sec_dlist_t &remote_self,
+                                             const std::vector<nixlBackendMD*> *pre_registered) {
 
     if (!backend)
         return NIXL_ERR_INVALID_PARAM;
+    if (pre_registered &&
+        ((int)pre_registered->size() != mem_elms.descCount()))
+        return NIXL_ERR_INVALID_PARAM;
+
+    nixl_mem_t nixl_mem = mem_elms.getType();
+
+    // Registration goes through the backend's bulk entry point, so drivers
+    // that support batched registration see one call for the whole list.
+    // TODO: For now trusting the user, but there can be a more checks mode
+    //       where we find overlaps and split the memories or warn the user
+    std::vector<nixlBackendMD*> mds;
+    if (pre_registered) {
+        mds = *pre_registered;
+    } else {
+        nixl_status_t reg_ret = backend->registerMems(mem_elms, nixl_mem, mds);
+        if (reg_ret != NIXL_SUCCESS)
+            return reg_ret;
+    }
+
     // Find the MetaDesc list, or add it to the map
-    nixl_mem_t     nixl_mem     = mem_elms.getType();
     section_key_t  sec_key      = std::make_pair(nixl_mem, backend);
 
     auto it = sectionMap.find(sec_key);
@@ -111,15 +163,11 @@ nixl_status_t nixlLocalSection::addDescList (const nixl_reg_dlist_t &mem_elms,
     nixlSectionDesc local_sec, self_sec;
     nixlBasicDesc *lp = &local_sec;
     nixlBasicDesc *rp = &self_sec;
-    nixl_status_t ret;
+    nixl_status_t ret = NIXL_SUCCESS;
 
     int i;
     for (i = 0; i < mem_elms.descCount(); ++i) {
-        // TODO: For now trusting the user, but there can be a more checks mode
-        //       where we find overlaps and split the memories or warn the user
-        ret = backend->registerMem(mem_elms[i], nixl_mem, local_sec.metadataP);
-        if (ret != NIXL_SUCCESS)
-            break;
+        local_sec.metadataP = mds[i];
 
         if (backend->supportsLocal()) {
             ret = backend->loadLocalMD(local_sec.metadataP, self_sec.metadataP);
@@ -155,6 +203,9 @@ nixl_status_t nixlLocalSection::addDescList (const nixl_reg_dlist_t &mem_elms,
 
     // Abort in case of error
     if (ret != NIXL_SUCCESS) {
+        // MDs past the failing element were registered but never added
+        for (int j = i + 1; j < mem_elms.descCount(); ++j)
+            backend->deregisterMem(mds[j]);
         for (int j = 0; j < i; ++j) {
             int index = target->getIndex(mem_elms[j]);
 
@@ -169,11 +220,14 @@ nixl_status_t nixlLocalSection::addDescList (const nixl_reg_dlist_t &mem_elms,
         }
         remote_self.clear();
     }
+    if (ret == NIXL_SUCCESS)
+        serialDirty = true;
     return ret;
 }
 
 nixl_status_t nixlLocalSection::remDescList (const nixl_reg_dlist_t &mem_elms,
-                                             nixlBackendEngine *backend) {
+                                             nixlBackendEngine *backend,
+                                             std::vector<nixlBackendMD*> *reclaimed) {
     if (!backend)
         return NIXL_ERR_INVALID_PARAM;
     nixl_mem_t     nixl_mem     = mem_elms.getType();
@@ -194,7 +248,10 @@ nixl_status_t nixlLocalSection::remDescList (const nixl_reg_dlist_t &mem_elms,
     for (auto & elm : mem_elms) {
         int index = target->getIndex(elm);
         // Already checked, elm should always be found. Can add a check in debug mode.
-        backend->deregisterMem((*target)[index].metadataP);
+        if (reclaimed)
+            reclaimed->push_back((*target)[index].metadataP);
+        else
+            backend->deregisterMem((*target)[index].metadataP);
         target->remDesc(index);
     }
 
@@ -204,6 +261,7 @@ nixl_status_t nixlLocalSection::remDescList (const nixl_reg_dlist_t &mem_elms,
         memToBackend[nixl_mem].erase(backend);
     }
 
+    serialDirty = true;
     return NIXL_SUCCESS;
 }
 
@@ -284,6 +342,78 @@ nixl_status_t nixlLocalSection::serializePartial(nixlSerDes* serializer,
     return ret;
 }
 
+/*** Class nixlRegSnapshot implementation ***/
+
+// Same covering search as nixlSecDescList::getCoveringIndex, over the
+// snapshot's frozen copy of the sorted ranges and their prefix maxima
+bool
+nixlRegSnapshot::snapshotRanges::covers(const nixlBasicDesc &query) const {
+    auto itr = std::lower_bound(descs.begin(), descs.end(), query);
+    if (itr != descs.end() && itr->covers(query))
+        return true;
+    if (itr == descs.begin())
+        return false;
+
+    size_t pos = itr - descs.begin();
+    nixlBasicDesc dev_floor(0, 0, query.devId);
+    size_t run_start =
+        std::lower_bound(descs.begin(), descs.begin() + pos, dev_floor) - descs.begin();
+    if ((run_start == pos) || (descs[run_start].devId != query.devId))
+        return false;
+
+    uintptr_t query_end = query.addr + query.len;
+    auto cover_itr = std::lower_bound(maxEnd.begin() + run_start,
+                                      maxEnd.begin() + pos, query_end);
+    if (cover_itr == maxEnd.begin() + pos)
+        return false;
+    return descs[cover_itr - maxEnd.begin()].covers(query);
+}
+
+bool nixlRegSnapshot::isRegistered(const nixl_mem_t &mem,
+                                   const nixlBasicDesc &query) const {
+    for (auto it = sections.lower_bound({mem, nixl_backend_t()});
+         it != sections.end() && it->first.first == mem; ++it)
+        if (it->second.covers(query))
+            return true;
+    return false;
+}
+
+nixl_status_t nixlRegSnapshot::queryBackends(const nixl_mem_t &mem,
+                                             const nixlBasicDesc &query,
+                                             std::vector<nixl_backend_t> &backends) const {
+    backends.clear();
+    for (auto it = sections.lower_bound({mem, nixl_backend_t()});
+         it != sections.end() && it->first.first == mem; ++it)
+        if (it->second.covers(query))
+            backends.push_back(it->first.second);
+    return backends.empty() ? NIXL_ERR_NOT_FOUND : NIXL_SUCCESS;
+}
+
+std::shared_ptr<const nixlRegSnapshot>
+nixlLocalSection::makeSnapshot(uint64_t version) const {
+    auto snap = std::make_shared<nixlRegSnapshot>();
+    snap->version = version;
+    for (const auto &[sec_key, sec_list] : sectionMap) {
+        if (sec_list->descCount() == 0)
+            continue;
+        auto &ranges = snap->sections[{sec_key.first, sec_key.second->getType()}];
+        ranges.descs.reserve(sec_list->descCount());
+        ranges.maxEnd.reserve(sec_list->descCount());
+        // The section list is sorted, so the prefix maxima are built with
+        // the same per-devId-run recurrence as nixlSecDescList
+        for (const auto &desc : *sec_list) {
+            uintptr_t end = desc.addr + desc.len;
+            size_t i = ranges.descs.size();
+            ranges.descs.emplace_back(desc.addr, desc.len, desc.devId);
+            if ((i > 0) && (ranges.descs[i - 1].devId == desc.devId))
+                ranges.maxEnd.push_back(std::max(ranges.maxEnd[i - 1], end));
+            else
+                ranges.maxEnd.push_back(end);
+        }
+    }
+    return snap;
+}
+
 nixlLocalSection::~nixlLocalSection() {
     for (auto &[sec_key, dlist] : sectionMap) {
         nixlBackendEngine* eng = sec_key.second;
@@ -386,9 +516,64 @@ nixl_status_t nixlRemoteSection::loadLocalData (
     memToBackend[nixl_mem].insert(backend); // Fine to overwrite, it's a set
     nixl_sec_dlist_t *target = sectionMap[sec_key];
 
-    for (auto & elm: mem_elms)
-        target->addDesc(elm);
+    // mem_elms is itself a sorted section list, so appending in its order
+    // keeps a fresh target sorted and the attested fast path applies; a
+    // pre-existing target needs the merging insert
+    if (target->isEmpty()) {
+        for (auto & elm: mem_elms)
+            target->addSortedDesc(elm);
+    } else {
+        for (auto & elm: mem_elms)
+            target->addDesc(elm);
+    }
+
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlRemoteSection::remDescList (const nixl_reg_dlist_t &mem_elms,
+                                              nixlBackendEngine* backend) {
+    nixl_mem_t nixl_mem   = mem_elms.getType();
+    section_key_t sec_key = std::make_pair(nixl_mem, backend);
+    auto it = sectionMap.find(sec_key);
+    if (it==sectionMap.end())
+        return NIXL_SUCCESS; // Nothing loaded from this backend, nothing to remove
+    nixl_sec_dlist_t *target = it->second;
+
+    for (auto & elm : mem_elms) {
+        int index = target->getIndex(elm);
+        if (index < 0)
+            continue; // Unlike LocalSection, removal is best effort
+        backend->unloadMD((*target)[index].metadataP);
+        target->remDesc(index);
+    }
+
+    if (target->descCount()==0) {
+        delete target;
+        sectionMap.erase(sec_key);
+        memToBackend[nixl_mem].erase(backend);
+    }
+
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlRemoteSection::getStagingDesc (const nixl_mem_t &mem,
+                                                 nixlBackendEngine* backend,
+                                                 nixlSectionDesc &resp) const {
+    section_key_t sec_key = std::make_pair(mem, backend);
+    auto it = sectionMap.find(sec_key);
+    if (it == sectionMap.end())
+        return NIXL_ERR_NOT_FOUND;
+    const nixl_sec_dlist_t &target = *it->second;
+
+    // The biggest registered range gives the deepest staging pipeline
+    int best = -1;
+    for (int i = 0; i < target.descCount(); ++i)
+        if ((best < 0) || (target[i].len > target[best].len))
+            best = i;
+    if (best < 0)
+        return NIXL_ERR_NOT_FOUND;
 
+    resp = target[best];
     return NIXL_SUCCESS;
 }
 
@@ -0,0 +1,354 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cma_backend.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#include <absl/strings/str_format.h>
+#include "common/nixl_log.h"
+
+namespace {
+    // Request handle for CMA transfers. Posts complete synchronously, so
+    // the handle only carries the outcome back through checkXfer
+    struct nixlCmaBackendReqH : public nixlBackendReqH {
+        nixl_status_t status = NIXL_ERR_NOT_POSTED;
+    };
+
+#ifdef HAVE_CUDA
+    nixl_status_t cudaToNixl(cudaError_t err, const char* what) {
+        if (err == cudaSuccess) {
+            return NIXL_SUCCESS;
+        }
+        NIXL_ERROR << absl::StrFormat("%s failed: %s", what, cudaGetErrorString(err));
+        return NIXL_ERR_BACKEND;
+    }
+#endif
+}
+
+nixlCmaEngine::nixlCmaEngine(const nixlBackendInitParams *init_params)
+    : nixlBackendEngine(init_params) {
+    char hostname[HOST_NAME_MAX + 1] = {};
+    if (gethostname(hostname, HOST_NAME_MAX) != 0) {
+        NIXL_ERROR << absl::StrFormat("Failed to get hostname: %s", strerror(errno));
+        initErr = true;
+        return;
+    }
+    hostId_ = hostname;
+}
+
+nixl_status_t nixlCmaEngine::getConnInfo(std::string &str) const {
+    str = absl::StrFormat("%s:%d", hostId_, getpid());
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlCmaEngine::loadRemoteConnInfo(const std::string &remote_agent,
+                                                const std::string &remote_conn_info) {
+    auto sep = remote_conn_info.rfind(':');
+    if (sep == std::string::npos) {
+        NIXL_ERROR << absl::StrFormat("Malformed CMA conn info from agent %s", remote_agent);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    // CMA only works between processes on the same host; refusing the
+    // conn info here makes the agent fall back to a network-capable
+    // backend for off-host peers
+    if (remote_conn_info.substr(0, sep) != hostId_) {
+        NIXL_INFO << absl::StrFormat("Agent %s is on host %s, not %s - CMA not applicable",
+                                     remote_agent, remote_conn_info.substr(0, sep), hostId_);
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    pid_t pid;
+    try {
+        pid = std::stoi(remote_conn_info.substr(sep + 1));
+    } catch (const std::exception&) {
+        NIXL_ERROR << absl::StrFormat("Malformed CMA conn info from agent %s", remote_agent);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    std::lock_guard<std::mutex> lock(lock_);
+    peerPids_[remote_agent] = pid;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlCmaEngine::connect(const std::string &remote_agent) {
+    if (remote_agent == localAgent) {
+        return NIXL_SUCCESS;
+    }
+    std::lock_guard<std::mutex> lock(lock_);
+    return peerPids_.count(remote_agent) ? NIXL_SUCCESS : NIXL_ERR_NOT_FOUND;
+}
+
+nixl_status_t nixlCmaEngine::disconnect(const std::string &remote_agent) {
+    std::lock_guard<std::mutex> lock(lock_);
+    peerPids_.erase(remote_agent);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlCmaEngine::registerMem(const nixlBlobDesc &mem,
+                                         const nixl_mem_t &nixl_mem,
+                                         nixlBackendMD* &out) {
+    auto md = std::make_unique<nixlCmaBackendMD>(false);
+    md->memType = nixl_mem;
+    md->addr = mem.addr;
+    md->len = mem.len;
+
+    switch (nixl_mem) {
+        case DRAM_SEG:
+            break;
+#ifdef HAVE_CUDA
+        case VRAM_SEG: {
+            // Export an IPC handle now so getPublicData has it available
+            // when the registration is shared with peers
+            nixl_status_t status = cudaToNixl(
+                cudaIpcGetMemHandle(&md->ipcHandle, reinterpret_cast<void*>(mem.addr)),
+                "cudaIpcGetMemHandle");
+            if (status != NIXL_SUCCESS) {
+                return status;
+            }
+            break;
+        }
+#endif
+        default:
+            return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    out = md.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlCmaEngine::deregisterMem(nixlBackendMD* meta) {
+    delete static_cast<nixlCmaBackendMD*>(meta);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlCmaEngine::getPublicData(const nixlBackendMD* meta, std::string &str) const {
+    auto md = static_cast<const nixlCmaBackendMD*>(meta);
+#ifdef HAVE_CUDA
+    if (md->memType == VRAM_SEG) {
+        str.assign(reinterpret_cast<const char*>(&md->ipcHandle), sizeof(md->ipcHandle));
+        return NIXL_SUCCESS;
+    }
+#endif
+    (void)md;
+    str.clear();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlCmaEngine::loadLocalMD(nixlBackendMD* input, nixlBackendMD* &output) {
+    output = input;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlCmaEngine::loadRemoteMD(const nixlBlobDesc &input,
+                                          const nixl_mem_t &nixl_mem,
+                                          const std::string &remote_agent,
+                                          nixlBackendMD* &output) {
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (remote_agent != localAgent && peerPids_.count(remote_agent) == 0) {
+            return NIXL_ERR_NOT_FOUND;
+        }
+    }
+
+    auto md = std::make_unique<nixlCmaBackendMD>(true);
+    md->memType = nixl_mem;
+    md->addr = input.addr;
+    md->len = input.len;
+
+    switch (nixl_mem) {
+        case DRAM_SEG:
+            // The remote virtual address in the descriptor is all
+            // process_vm_readv/writev needs
+            break;
+#ifdef HAVE_CUDA
+        case VRAM_SEG: {
+            if (input.metaInfo.size() != sizeof(md->ipcHandle)) {
+                NIXL_ERROR << absl::StrFormat("Bad CUDA IPC handle size from agent %s: %zu",
+                                              remote_agent, input.metaInfo.size());
+                return NIXL_ERR_INVALID_PARAM;
+            }
+            memcpy(&md->ipcHandle, input.metaInfo.data(), sizeof(md->ipcHandle));
+            nixl_status_t status = cudaToNixl(
+                cudaIpcOpenMemHandle(&md->mappedBase, md->ipcHandle,
+                                     cudaIpcMemLazyEnablePeerAccess),
+                "cudaIpcOpenMemHandle");
+            if (status != NIXL_SUCCESS) {
+                return status;
+            }
+            break;
+        }
+#endif
+        default:
+            return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    output = md.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlCmaEngine::unloadMD(nixlBackendMD* input) {
+    auto md = static_cast<nixlCmaBackendMD*>(input);
+#ifdef HAVE_CUDA
+    if (md->mappedBase) {
+        cudaIpcCloseMemHandle(md->mappedBase);
+    }
+#endif
+    delete md;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlCmaEngine::prepXfer(const nixl_xfer_op_t &operation,
+                                      const nixl_meta_dlist_t &local,
+                                      const nixl_meta_dlist_t &remote,
+                                      const std::string &remote_agent,
+                                      nixlBackendReqH* &handle,
+                                      const nixl_opt_b_args_t* opt_args) const {
+    if (local.descCount() != remote.descCount() || local.descCount() == 0) {
+        NIXL_ERROR << absl::StrFormat("Mismatch in descriptor counts - local: %d, remote: %d",
+                                      local.descCount(), remote.descCount());
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    handle = new nixlCmaBackendReqH();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlCmaEngine::xferDram(const nixl_xfer_op_t &operation,
+                                      const std::vector<iovec> &local_iov,
+                                      const std::vector<iovec> &remote_iov,
+                                      pid_t peer_pid) const {
+    // One syscall moves up to IOV_MAX segments on each side
+    for (size_t done = 0; done < local_iov.size(); done += IOV_MAX) {
+        size_t batch = std::min<size_t>(IOV_MAX, local_iov.size() - done);
+        ssize_t expected = 0;
+        for (size_t i = done; i < done + batch; ++i) {
+            expected += local_iov[i].iov_len;
+        }
+
+        ssize_t ret = (operation == NIXL_READ) ?
+            process_vm_readv(peer_pid, &local_iov[done], batch, &remote_iov[done], batch, 0) :
+            process_vm_writev(peer_pid, &local_iov[done], batch, &remote_iov[done], batch, 0);
+
+        if (ret < 0) {
+            if (errno == EPERM) {
+                NIXL_ERROR << "process_vm access denied - peer not same-uid, or blocked by "
+                              "ptrace policy (kernel.yama.ptrace_scope)";
+            } else {
+                NIXL_ERROR << absl::StrFormat("process_vm transfer to pid %d failed: %s",
+                                              peer_pid, strerror(errno));
+            }
+            return NIXL_ERR_BACKEND;
+        }
+        if (ret != expected) {
+            NIXL_ERROR << absl::StrFormat("Partial process_vm transfer: %zd/%zd bytes",
+                                          ret, expected);
+            return NIXL_ERR_BACKEND;
+        }
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlCmaEngine::postXfer(const nixl_xfer_op_t &operation,
+                                      const nixl_meta_dlist_t &local,
+                                      const nixl_meta_dlist_t &remote,
+                                      const std::string &remote_agent,
+                                      nixlBackendReqH* &handle,
+                                      const nixl_opt_b_args_t* opt_args) const {
+    auto req = static_cast<nixlCmaBackendReqH*>(handle);
+    bool is_self = (remote_agent == localAgent);
+    pid_t peer_pid = getpid();
+
+    if (!is_self) {
+        std::lock_guard<std::mutex> lock(lock_);
+        auto it = peerPids_.find(remote_agent);
+        if (it == peerPids_.end()) {
+            return NIXL_ERR_INVALID_PARAM;
+        }
+        peer_pid = it->second;
+    }
+
+    std::vector<iovec> local_iov, remote_iov;
+
+    for (auto [local_it, remote_it] = std::make_pair(local.begin(), remote.begin());
+         local_it != local.end() && remote_it != remote.end();
+         ++local_it, ++remote_it) {
+        auto remote_md = static_cast<nixlCmaBackendMD*>(remote_it->metadataP);
+
+#ifdef HAVE_CUDA
+        if (remote_md && remote_md->memType == VRAM_SEG) {
+            // Translate the peer's device address into our IPC mapping;
+            // for self transfers the address is directly usable
+            void *target = remote_md->mappedBase ?
+                static_cast<char*>(remote_md->mappedBase) + (remote_it->addr - remote_md->addr) :
+                reinterpret_cast<void*>(remote_it->addr);
+            void *localp = reinterpret_cast<void*>(local_it->addr);
+
+            nixl_status_t status = cudaToNixl(
+                (operation == NIXL_READ) ?
+                    cudaMemcpy(localp, target, local_it->len, cudaMemcpyDefault) :
+                    cudaMemcpy(target, localp, local_it->len, cudaMemcpyDefault),
+                "cudaMemcpy");
+            if (status != NIXL_SUCCESS) {
+                req->status = status;
+                return status;
+            }
+            continue;
+        }
+#endif
+        if (local_it->len != remote_it->len) {
+            req->status = NIXL_ERR_INVALID_PARAM;
+            return NIXL_ERR_INVALID_PARAM;
+        }
+        local_iov.push_back({reinterpret_cast<void*>(local_it->addr), local_it->len});
+        remote_iov.push_back({reinterpret_cast<void*>(remote_it->addr), remote_it->len});
+    }
+
+    nixl_status_t status = NIXL_SUCCESS;
+    if (!local_iov.empty()) {
+        if (is_self) {
+            // Same process - a plain copy beats going through the kernel
+            for (size_t i = 0; i < local_iov.size(); ++i) {
+                if (operation == NIXL_READ) {
+                    memcpy(local_iov[i].iov_base, remote_iov[i].iov_base, local_iov[i].iov_len);
+                } else {
+                    memcpy(remote_iov[i].iov_base, local_iov[i].iov_base, local_iov[i].iov_len);
+                }
+            }
+        } else {
+            status = xferDram(operation, local_iov, remote_iov, peer_pid);
+        }
+    }
+
+    req->status = status;
+    return status;
+}
+
+nixl_status_t nixlCmaEngine::checkXfer(nixlBackendReqH* handle) const {
+    return static_cast<nixlCmaBackendReqH*>(handle)->status;
+}
+
+nixl_status_t nixlCmaEngine::releaseReqH(nixlBackendReqH* handle) const {
+    delete static_cast<nixlCmaBackendReqH*>(handle);
+    return NIXL_SUCCESS;
+}
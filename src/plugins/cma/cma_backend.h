@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CMA_BACKEND_H
+#define CMA_BACKEND_H
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include "backend/backend_engine.h"
+#include "common/str_tools.h"
+
+#ifdef HAVE_CUDA
+#include <cuda_runtime.h>
+#endif
+
+// Metadata for CMA registrations. Local entries record the registered
+// range; for VRAM the CUDA IPC handle is exported at registration time.
+// Remote VRAM entries additionally hold the base of the local IPC
+// mapping so target addresses can be translated into this process.
+class nixlCmaBackendMD : public nixlBackendMD {
+public:
+    nixl_mem_t memType;
+    uintptr_t  addr = 0;
+    size_t     len = 0;
+#ifdef HAVE_CUDA
+    cudaIpcMemHandle_t ipcHandle = {};
+    void *mappedBase = nullptr; // remote VRAM mapped into this process
+#endif
+
+    nixlCmaBackendMD(bool isPrivate) : nixlBackendMD(isPrivate) {}
+};
+
+// Intra-node backend for colocated processes: DRAM transfers go through
+// process_vm_readv/process_vm_writev (cross-memory attach), VRAM through
+// CUDA IPC mappings and device copies, so same-host traffic never touches
+// a NIC. Connection info carries the peer's host identity and pid, and
+// loading it fails for peers on a different host.
+class nixlCmaEngine : public nixlBackendEngine {
+public:
+    nixlCmaEngine(const nixlBackendInitParams *init_params);
+    ~nixlCmaEngine() = default;
+
+    bool supportsRemote() const override {
+        return true;
+    }
+
+    bool supportsLocal() const override {
+        return true;
+    }
+
+    bool supportsNotif() const override {
+        return false;
+    }
+
+    nixl_mem_list_t getSupportedMems() const override {
+#ifdef HAVE_CUDA
+        return {DRAM_SEG, VRAM_SEG};
+#else
+        return {DRAM_SEG};
+#endif
+    }
+
+    nixl_status_t getConnInfo(std::string &str) const override;
+    nixl_status_t loadRemoteConnInfo(const std::string &remote_agent,
+                                     const std::string &remote_conn_info) override;
+
+    nixl_status_t connect(const std::string &remote_agent) override;
+    nixl_status_t disconnect(const std::string &remote_agent) override;
+
+    nixl_status_t registerMem(const nixlBlobDesc &mem,
+                              const nixl_mem_t &nixl_mem,
+                              nixlBackendMD* &out) override;
+    nixl_status_t deregisterMem(nixlBackendMD* meta) override;
+
+    nixl_status_t getPublicData(const nixlBackendMD* meta, std::string &str) const override;
+    nixl_status_t loadLocalMD(nixlBackendMD* input, nixlBackendMD* &output) override;
+    nixl_status_t loadRemoteMD(const nixlBlobDesc &input,
+                               const nixl_mem_t &nixl_mem,
+                               const std::string &remote_agent,
+                               nixlBackendMD* &output) override;
+    nixl_status_t unloadMD(nixlBackendMD* input) override;
+
+    nixl_status_t prepXfer(const nixl_xfer_op_t &operation,
+                           const nixl_meta_dlist_t &local,
+                           const nixl_meta_dlist_t &remote,
+                           const std::string &remote_agent,
+                           nixlBackendReqH* &handle,
+                           const nixl_opt_b_args_t* opt_args=nullptr) const override;
+
+    nixl_status_t postXfer(const nixl_xfer_op_t &operation,
+                           const nixl_meta_dlist_t &local,
+                           const nixl_meta_dlist_t &remote,
+                           const std::string &remote_agent,
+                           nixlBackendReqH* &handle,
+                           const nixl_opt_b_args_t* opt_args=nullptr) const override;
+
+    nixl_status_t checkXfer(nixlBackendReqH* handle) const override;
+    nixl_status_t releaseReqH(nixlBackendReqH* handle) const override;
+
+private:
+    nixl_status_t xferDram(const nixl_xfer_op_t &operation,
+                           const std::vector<iovec> &local_iov,
+                           const std::vector<iovec> &remote_iov,
+                           pid_t peer_pid) const;
+
+    // Identity advertised through conn info; peers on other hosts are
+    // rejected at loadRemoteConnInfo
+    std::string hostId_;
+
+    mutable std::mutex lock_;
+    std::unordered_map<std::string, pid_t,
+                       std::hash<std::string>, strEqual> peerPids_;
+};
+
+#endif // CMA_BACKEND_H
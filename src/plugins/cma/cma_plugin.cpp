@@ -0,0 +1,44 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include "cma_backend.h"
+#include "backend/backend_plugin.h"
+
+// Plugin type alias for convenience
+using cma_plugin_t = nixlBackendPluginCreator<nixlCmaEngine>;
+
+#ifdef HAVE_CUDA
+static const nixl_mem_list_t cma_mems = {DRAM_SEG, VRAM_SEG};
+#else
+static const nixl_mem_list_t cma_mems = {DRAM_SEG};
+#endif
+
+#ifdef STATIC_PLUGIN_CMA
+nixlBackendPlugin *
+createStaticCMAPlugin() {
+    return cma_plugin_t::create(NIXL_PLUGIN_API_VERSION, "CMA", "0.1.0", {}, cma_mems);
+}
+#else
+extern "C" NIXL_PLUGIN_EXPORT nixlBackendPlugin *
+nixl_plugin_init() {
+    return cma_plugin_t::create(NIXL_PLUGIN_API_VERSION, "CMA", "0.1.0", {}, cma_mems);
+}
+
+extern "C" NIXL_PLUGIN_EXPORT void
+nixl_plugin_fini() {}
+#endif
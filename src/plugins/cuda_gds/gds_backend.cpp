@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 #include <cassert>
+#include <cstdint>
 #include <cufile.h>
 #include "gds_backend.h"
 #include "gds_utils.h"
@@ -30,6 +31,10 @@
 #define DEFAULT_MAX_REQUEST_SIZE (16 * 1024 * 1024)  // 16MB
 /** Create a batch pool of size 16 */
 #define DEFAULT_BATCH_POOL_SIZE 16
+/** Direct IO alignment required for the cuFile fast path */
+#define GDS_DIRECT_IO_ALIGNMENT 4096
+/** Number of pre-registered aligned bounce buffers */
+#define DEFAULT_BOUNCE_BUF_COUNT 8
 
 nixlGdsEngine::nixlGdsEngine(const nixlBackendInitParams* init_params)
     : nixlBackendEngine(init_params)
@@ -40,6 +45,8 @@ nixlGdsEngine::nixlGdsEngine(const nixlBackendInitParams* init_params)
     batch_pool_size = DEFAULT_BATCH_POOL_SIZE;
     batch_limit = DEFAULT_BATCH_LIMIT;
     max_request_size = DEFAULT_MAX_REQUEST_SIZE;
+    bounce_buf_count = DEFAULT_BOUNCE_BUF_COUNT;
+    bounce_stream = nullptr;
 
     // Read custom parameters if available
     nixl_b_params_t* custom_params = init_params->customParams;
@@ -76,6 +83,17 @@ nixlGdsEngine::nixlGdsEngine(const nixlBackendInitParams* init_params)
                 return;
             }
         }
+
+        // Configure bounce_buf_count (0 disables the bounce pool)
+        if (custom_params->count("bounce_buf_count") > 0) {
+            try {
+                bounce_buf_count = std::stoi((*custom_params)["bounce_buf_count"]);
+            } catch (const std::exception& e) {
+                NIXL_ERROR << "Invalid bounce_buf_count parameter: " << e.what();
+                this->initErr = true;
+                return;
+            }
+        }
     }
 
     this->initErr = false;
@@ -89,6 +107,34 @@ nixlGdsEngine::nixlGdsEngine(const nixlBackendInitParams* init_params)
         batch_pool.push_back(new nixlGdsIOBatch(batch_limit));
     }
 
+    // Initialize the bounce-buffer pool, best effort: if allocation or
+    // registration fails the engine still comes up and unaligned requests
+    // simply take cuFile's own fallback path
+    if (bounce_buf_count > 0) {
+        if (cudaStreamCreateWithFlags(&bounce_stream,
+                                      cudaStreamNonBlocking) != cudaSuccess) {
+            NIXL_WARN << "Failed to create bounce stream, "
+                      << "disabling the bounce-buffer pool";
+            bounce_stream = nullptr;
+            bounce_buf_count = 0;
+        }
+    }
+    for (unsigned int i = 0; i < bounce_buf_count; i++) {
+        void* buf = nullptr;
+        if (cudaMalloc(&buf, max_request_size) != cudaSuccess) {
+            NIXL_WARN << "Allocated only " << i << " of " << bounce_buf_count
+                      << " bounce buffers";
+            break;
+        }
+        CUfileError_t reg_err = cuFileBufRegister(buf, max_request_size, 0);
+        if (reg_err.err != CU_FILE_SUCCESS) {
+            cudaFree(buf);
+            NIXL_WARN << "cuFileBufRegister failed for bounce buffer " << i
+                      << ", error: " << reg_err.err;
+            break;
+        }
+        bounce_pool.push_back(buf);
+    }
 }
 
 nixl_status_t nixlGdsEngine::registerMem(const nixlBlobDesc &mem,
@@ -297,6 +343,88 @@ void nixlGdsEngine::returnBatchToPool(nixlGdsIOBatch* batch) const {
         batch_pool.push_back(batch);
 }
 
+void* nixlGdsEngine::getBounceFromPool() const {
+    const std::lock_guard<std::mutex> lock(bounce_pool_lock);
+    if (bounce_pool.empty())
+        return nullptr;
+    void* buf = bounce_pool.back();
+    bounce_pool.pop_back();
+    return buf;
+}
+
+void nixlGdsEngine::returnBounceToPool(void* buf) const {
+    const std::lock_guard<std::mutex> lock(bounce_pool_lock);
+    bounce_pool.push_back(buf);
+}
+
+// Redirects unaligned requests of one batch through aligned bounce
+// buffers. Memory addresses off the 4K direct-IO alignment are fixable
+// by staging; unaligned file offsets are not, those stay on cuFile's own
+// fallback, as do requests left over once the pool is drained. Write
+// copy-ins go through bounce_stream asynchronously so they overlap the
+// IO of the previously submitted batch; the caller synchronizes the
+// stream before submitting this batch.
+void nixlGdsEngine::stageBounceIn(nixlGdsBackendReqH* gds_handle,
+                                  size_t start_idx, size_t batch_size) const {
+    auto& requests = gds_handle->request_list;
+    for (size_t i = start_idx; i < start_idx + batch_size; i++) {
+        GdsTransferRequestH& req = requests[i];
+        if ((((uintptr_t)req.addr % GDS_DIRECT_IO_ALIGNMENT) == 0) ||
+            ((req.file_offset % GDS_DIRECT_IO_ALIGNMENT) != 0))
+            continue;
+
+        void* bounce = getBounceFromPool();
+        if (!bounce)
+            return;
+
+        if (req.op == CUFILE_WRITE) {
+            if (cudaMemcpyAsync(bounce, req.addr, req.size,
+                                cudaMemcpyDefault, bounce_stream) != cudaSuccess) {
+                returnBounceToPool(bounce);
+                continue;
+            }
+        }
+
+        gds_handle->bounce_list.push_back(
+            {i, bounce, req.addr, req.size, req.op == CUFILE_READ});
+        req.addr = bounce;
+    }
+}
+
+// Copies staged read data back to the user buffers (when copy_out is
+// set), restores the original addresses and returns the bounce buffers
+// to the pool.
+nixl_status_t nixlGdsEngine::finishBounce(nixlGdsBackendReqH* gds_handle,
+                                          bool copy_out) const {
+    nixl_status_t status = NIXL_SUCCESS;
+
+    if (gds_handle->bounce_list.empty())
+        return status;
+
+    bool copied = false;
+    for (const auto& staging : gds_handle->bounce_list) {
+        if (!copy_out || !staging.copy_out)
+            continue;
+        if (cudaMemcpyAsync(staging.user_addr, staging.bounce_addr,
+                            staging.size, cudaMemcpyDefault,
+                            bounce_stream) == cudaSuccess) {
+            copied = true;
+        } else {
+            NIXL_ERROR << "Bounce copy-out failed";
+            status = NIXL_ERR_BACKEND;
+        }
+    }
+    if (copied)
+        cudaStreamSynchronize(bounce_stream);
+
+    for (const auto& staging : gds_handle->bounce_list) {
+        gds_handle->request_list[staging.req_idx].addr = staging.user_addr;
+        returnBounceToPool(staging.bounce_addr);
+    }
+    gds_handle->bounce_list.clear();
+    return status;
+}
+
 nixl_status_t nixlGdsEngine::postXfer(const nixl_xfer_op_t &operation,
                                       const nixl_meta_dlist_t &local,
                                       const nixl_meta_dlist_t &remote,
@@ -319,6 +447,14 @@ nixl_status_t nixlGdsEngine::postXfer(const nixl_xfer_op_t &operation,
     while (current_req < request_list.size()) {
         size_t batch_size = std::min(request_list.size() - current_req,
                                      (size_t)batch_limit);
+
+        // Stage this batch's unaligned requests through the bounce pool;
+        // the async copy-ins overlap the IO of already submitted batches
+        // and only get synchronized right before this batch goes out
+        stageBounceIn(gds_handle, current_req, batch_size);
+        if (!gds_handle->bounce_list.empty())
+            cudaStreamSynchronize(bounce_stream);
+
         nixl_status_t status = createAndSubmitBatch(request_list, current_req,
                                                     batch_size, gds_handle->batch_io_list);
 
@@ -329,6 +465,7 @@ nixl_status_t nixlGdsEngine::postXfer(const nixl_xfer_op_t &operation,
                 returnBatchToPool(batch);
             }
             gds_handle->batch_io_list.clear();
+            finishBounce(gds_handle, false);
             return status;
         }
         current_req += batch_size;
@@ -397,6 +534,13 @@ nixl_status_t nixlGdsEngine::checkXfer(nixlBackendReqH* handle) const
     }
 
     gds_handle->batch_io_list.clear();
+
+    // All batches done: drain staged reads back to the user buffers and
+    // release the bounce buffers (without copy-back on failure)
+    nixl_status_t bounce_status = finishBounce(gds_handle, status == NIXL_SUCCESS);
+    if (status == NIXL_SUCCESS)
+        status = bounce_status;
+
     gds_handle->needs_prep = true;
     return status;
 }
@@ -406,6 +550,10 @@ nixl_status_t nixlGdsEngine::releaseReqH(nixlBackendReqH* handle) const
 
     nixlGdsBackendReqH *gds_handle = (nixlGdsBackendReqH *) handle;
 
+    // Bounce buffers still attached to an abandoned request go back to
+    // the pool without copy-back
+    finishBounce(gds_handle, false);
+
     delete gds_handle;
     gds_handle = nullptr;
 
@@ -421,6 +569,16 @@ nixlGdsEngine::~nixlGdsEngine() {
     }
     batch_pool.clear();
 
+    // Release the bounce-buffer pool
+    for (auto* buf : bounce_pool) {
+        cuFileBufDeregister(buf);
+        cudaFree(buf);
+    }
+    bounce_pool.clear();
+    if (bounce_stream) {
+        cudaStreamDestroy(bounce_stream);
+    }
+
     if (gds_utils) {
         gds_utils->closeGdsDriver();
         delete gds_utils;
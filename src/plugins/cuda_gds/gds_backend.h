@@ -67,10 +67,22 @@ class GdsTransferRequestH {
         }
 };
 
+// Aligned staging for one unaligned request: the cuFile IO runs on
+// bounce_addr while user_addr keeps the caller's original pointer for
+// copy-back and for restoring the request after completion
+struct gdsBounceStaging {
+    size_t req_idx;
+    void*  bounce_addr;
+    void*  user_addr;
+    size_t size;
+    bool   copy_out;
+};
+
 class nixlGdsBackendReqH : public nixlBackendReqH {
     public:
         std::vector<GdsTransferRequestH> request_list;
         std::vector<nixlGdsIOBatch*> batch_io_list;
+        std::vector<gdsBounceStaging> bounce_list;
         bool needs_prep;
 
         nixlGdsBackendReqH() {
@@ -95,6 +107,23 @@ class nixlGdsEngine : public nixlBackendEngine {
         unsigned int batch_limit;      // Added for configurable batch limit
         unsigned int max_request_size; // Added for configurable request size
 
+        // Bounce-buffer pool for unaligned memory addresses: cuFile falls
+        // back to a far slower path when the device pointer is not
+        // 4K-aligned, so such requests are staged through pre-registered
+        // aligned buffers at the cost of one memcpy. Copy-ins are issued
+        // asynchronously, overlapping the cuFile IO of the previous batch.
+        mutable std::mutex bounce_pool_lock;
+        mutable std::list<void*> bounce_pool;
+        unsigned int bounce_buf_count;
+        cudaStream_t bounce_stream;
+
+        void* getBounceFromPool() const;
+        void returnBounceToPool(void* buf) const;
+        void stageBounceIn(nixlGdsBackendReqH* gds_handle,
+                           size_t start_idx, size_t batch_size) const;
+        nixl_status_t finishBounce(nixlGdsBackendReqH* gds_handle,
+                                   bool copy_out) const;
+
         nixlGdsIOBatch* getBatchFromPool(unsigned int size) const;
         void returnBatchToPool(nixlGdsIOBatch* batch) const;
         nixl_status_t createAndSubmitBatch(const std::vector<GdsTransferRequestH>& requests,
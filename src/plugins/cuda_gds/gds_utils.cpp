@@ -171,14 +171,34 @@ nixl_status_t nixlGdsIOBatch::checkStatus()
     CUfileError_t       errBatch;
     unsigned int        nr = batch_size;
 
-    errBatch = cuFileBatchIOGetStatus(batch_handle, nr, &nr,
+    // min_nr = 0: poll without waiting, checkXfer drives the retries
+    errBatch = cuFileBatchIOGetStatus(batch_handle, 0, &nr,
                                       io_batch_events, NULL);
     if (errBatch.err != 0) {
         NIXL_ERROR << "Error in IO Batch Get Status";
         current_status = NIXL_ERR_BACKEND;
+        return current_status;
+    }
+
+    // The batch only succeeds if every entry completed cleanly: count the
+    // drained events and fail fast on per-entry errors
+    for (unsigned int i = 0; i < nr; i++) {
+        switch (io_batch_events[i].status) {
+            case CUFILE_COMPLETE:
+                entries_completed++;
+                break;
+            case CUFILE_FAILED:
+            case CUFILE_CANCELED:
+                NIXL_ERROR << "GDS batch entry failed with status "
+                           << io_batch_events[i].status;
+                current_status = NIXL_ERR_BACKEND;
+                return current_status;
+            default:
+                // Still queued or in flight
+                break;
+        }
     }
 
-    entries_completed += nr;
     if (entries_completed < (unsigned int)batch_size)
         current_status = NIXL_IN_PROG;
     else if (entries_completed > batch_size)
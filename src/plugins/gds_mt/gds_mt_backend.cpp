@@ -27,17 +27,17 @@
 #include <exception>
 #include <cstring>
 #include <variant>
-#include <future>
 #include <atomic>
 #include "common/nixl_log.h"
 #include "gds_mt_backend.h"
 #include "gds_mt_utils.h"
 #include "file/file_utils.h"
-#include <taskflow/taskflow.hpp>
 #include <unordered_map>
 
 namespace {
 const size_t default_thread_count = std::max (1u, std::thread::hardware_concurrency() / 2);
+constexpr size_t default_min_thread_count = 2;
+constexpr size_t default_queue_shards = 8;
 
 struct FileSegData {
     std::shared_ptr<gdsMtFileHandle> handle;
@@ -56,18 +56,21 @@ struct GdsMtTransferRequestH {
                            size_t s,
                            size_t offset,
                            CUfileHandle_t handle,
-                           CUfileOpcode_t operation)
+                           CUfileOpcode_t operation,
+                           size_t queue_shard)
         : addr{a},
           size{s},
           file_offset{offset},
           fh{handle},
-          op{operation} {}
+          op{operation},
+          shard{queue_shard} {}
 
     void *addr;
     size_t size;
     size_t file_offset;
     CUfileHandle_t fh;
     CUfileOpcode_t op;
+    size_t shard;
 };
 
 class nixlGdsMtMetadata : public nixlBackendMD {
@@ -98,31 +101,27 @@ public:
     ~nixlGdsMtBackendReqH();
 
     std::vector<GdsMtTransferRequestH> request_list;
-    tf::Taskflow taskflow;
-    std::future<void> running_transfer;
+    std::atomic<size_t> pending_tasks{0};
     std::atomic<nixl_status_t> overall_status;
 };
 
 size_t
-getThreadCount (const nixlBackendInitParams *init_params) {
-    size_t thread_count = default_thread_count;
-
-    nixl_b_params_t *custom_params = init_params->customParams;
-    if (custom_params) {
-        if (custom_params->count ("thread_count") > 0) {
-            try {
-                size_t tcount = std::stoul ((*custom_params)["thread_count"]);
-                if (tcount != 0) {
-                    thread_count = tcount;
-                }
-            }
-            catch (const std::exception &e) {
-                throw std::runtime_error ("GDS_MT: Invalid thread_count parameter: " +
-                                          std::string (e.what()));
+getSizeParam (const nixl_b_params_t *custom_params, const std::string &name, size_t def) {
+    size_t value = def;
+
+    if (custom_params && custom_params->count (name) > 0) {
+        try {
+            size_t parsed = std::stoul (custom_params->at (name));
+            if (parsed != 0) {
+                value = parsed;
             }
         }
+        catch (const std::exception &e) {
+            throw std::runtime_error ("GDS_MT: Invalid " + name +
+                                      " parameter: " + std::string (e.what()));
+        }
     }
-    return thread_count;
+    return value;
 }
 
 void
@@ -181,17 +180,63 @@ extractTransferParams (const nixlMetaDesc &mem_desc,
 } // namespace
 
 nixlGdsMtBackendReqH::~nixlGdsMtBackendReqH() {
-    if (running_transfer.valid()) {
-        running_transfer.wait();
+    // Queued tasks hold pointers into request_list; wait out any that are
+    // still in flight before the storage goes away.
+    while (pending_tasks.load (std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
     }
 }
 
 nixlGdsMtEngine::nixlGdsMtEngine (const nixlBackendInitParams *init_params)
     : nixlBackendEngine (init_params),
       gds_mt_utils_(),
-      thread_count_ (getThreadCount (init_params)),
-      executor_ (std::make_unique<tf::Executor> (thread_count_)) {
-    NIXL_DEBUG << "GDS_MIT: thread count=" << thread_count_;
+      thread_count_ (getSizeParam (init_params->customParams, "thread_count",
+                                   default_thread_count)),
+      thread_count_min_ (std::min (getSizeParam (init_params->customParams, "min_thread_count",
+                                                 default_min_thread_count),
+                                   thread_count_)),
+      queue_shards_ (getSizeParam (init_params->customParams, "queue_shards",
+                                   default_queue_shards)),
+      pool_ (std::make_unique<gdsMtThreadPool> (
+          thread_count_min_, thread_count_, queue_shards_, init_params->progressCpuset)) {
+    // Publish the effective pool geometry so it is visible through
+    // nixlAgent::getBackendParams; emplace fails harmlessly for keys the
+    // caller already supplied.
+    (void)setInitParam ("thread_count", std::to_string (thread_count_));
+    (void)setInitParam ("min_thread_count", std::to_string (thread_count_min_));
+    (void)setInitParam ("queue_shards", std::to_string (queue_shards_));
+    NIXL_DEBUG << "GDS_MT: threads min=" << thread_count_min_ << " max=" << thread_count_
+               << " queue shards=" << queue_shards_;
+}
+
+nixl_status_t
+nixlGdsMtEngine::applyConfig (const nixl_b_params_t &params) {
+    // Validate the whole set before touching anything
+    for (const auto &p : params) {
+        if (p.first != "thread_count") {
+            NIXL_ERROR << "GDS_MT: parameter '" << p.first << "' cannot be changed at runtime";
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+    }
+
+    size_t threads;
+    try {
+        threads = getSizeParam (&params, "thread_count", thread_count_);
+    }
+    catch (const std::exception &e) {
+        NIXL_ERROR << "GDS_MT: " << e.what();
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    if (threads < thread_count_min_) {
+        NIXL_ERROR << "GDS_MT: thread_count " << threads << " below the permanent worker count "
+                   << thread_count_min_;
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    thread_count_ = threads;
+    pool_->setMaxThreads (thread_count_);
+    NIXL_DEBUG << "GDS_MT: thread_count set to " << thread_count_ << " at runtime";
+    return NIXL_SUCCESS;
 }
 
 nixl_status_t
@@ -323,24 +368,21 @@ nixlGdsMtEngine::prepXfer (const nixl_xfer_op_t &operation,
             return param_status;
         }
 
+        // Shard by file descriptor so concurrent multi-file transfers land
+        // on different queues.
+        size_t queue_shard = (size_t)(is_local_file ? local[i].devId : remote[i].devId);
         gds_mt_handle->request_list.emplace_back (base_addr,
                                                   total_size,
                                                   base_offset,
                                                   cu_fhandle,
                                                   (operation == NIXL_READ) ? CUFILE_READ :
-                                                                             CUFILE_WRITE);
+                                                                             CUFILE_WRITE,
+                                                  queue_shard);
     }
 
     if (gds_mt_handle->request_list.empty()) {
         return NIXL_ERR_INVALID_PARAM;
     }
-    for (GdsMtTransferRequestH &req : gds_mt_handle->request_list) {
-        GdsMtTransferRequestH *captured_req = &req;
-        gds_mt_handle->taskflow.emplace (
-            [captured_req, overall_status = &gds_mt_handle->overall_status]() {
-                runCuFileOp (captured_req, overall_status);
-            });
-    }
 
     handle = gds_mt_handle.release();
     return NIXL_SUCCESS;
@@ -356,18 +398,27 @@ nixlGdsMtEngine::postXfer (const nixl_xfer_op_t &operation,
     nixlGdsMtBackendReqH *gds_mt_handle = (nixlGdsMtBackendReqH *)handle;
 
     gds_mt_handle->overall_status.store (NIXL_SUCCESS);
-    gds_mt_handle->running_transfer = executor_->run (gds_mt_handle->taskflow);
+    gds_mt_handle->pending_tasks.store (gds_mt_handle->request_list.size(),
+                                        std::memory_order_release);
+    for (GdsMtTransferRequestH &req : gds_mt_handle->request_list) {
+        GdsMtTransferRequestH *captured_req = &req;
+        pool_->submit (req.shard,
+                       [captured_req,
+                        overall_status = &gds_mt_handle->overall_status,
+                        pending = &gds_mt_handle->pending_tasks]() {
+                           runCuFileOp (captured_req, overall_status);
+                           pending->fetch_sub (1, std::memory_order_acq_rel);
+                       });
+    }
     return NIXL_IN_PROG;
 }
 
 nixl_status_t
 nixlGdsMtEngine::checkXfer (nixlBackendReqH *handle) const {
     nixlGdsMtBackendReqH *gds_mt_handle = (nixlGdsMtBackendReqH *)handle;
-    if (gds_mt_handle->running_transfer.wait_for (nixlTime::seconds (0)) !=
-        std::future_status::ready) {
+    if (gds_mt_handle->pending_tasks.load (std::memory_order_acquire) != 0) {
         return NIXL_IN_PROG;
     }
-    gds_mt_handle->running_transfer.get();
     return gds_mt_handle->overall_status.load();
 }
 
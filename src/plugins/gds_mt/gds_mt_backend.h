@@ -26,14 +26,12 @@
 #include <unordered_map>
 #include <cufile.h>
 #include "gds_mt_utils.h"
-#include "taskflow/core/executor.hpp"
 
 class nixlGdsMtEngine : public nixlBackendEngine {
 public:
     nixlGdsMtEngine (const nixlBackendInitParams *init_params);
-    // Note: The destructor of the TaskFlow executor runs wait_for_all() to
-    // wait for all submitted taskflows to complete and then notifies all worker
-    // threads to stop and join these threads.
+    // Note: The thread pool destructor drains any queued work and then
+    // stops and joins all worker threads.
     ~nixlGdsMtEngine() = default;
 
     nixlGdsMtEngine (const nixlGdsMtEngine &) = delete;
@@ -107,10 +105,19 @@ public:
     nixl_status_t
     queryMem(const nixl_reg_dlist_t &descs, std::vector<nixl_query_resp_t> &resp) const override;
 
+protected:
+    // Runtime reconfiguration: only thread_count (the elastic pool's
+    // upper bound) can be changed live; other keys are rejected and
+    // nothing is applied.
+    nixl_status_t
+    applyConfig (const nixl_b_params_t &params) override;
+
 private:
     gdsMtUtil gds_mt_utils_;
     std::unordered_map<int, std::weak_ptr<gdsMtFileHandle>> gds_mt_file_map_;
     size_t thread_count_;
-    std::unique_ptr<tf::Executor> executor_;
+    size_t thread_count_min_;
+    size_t queue_shards_;
+    std::unique_ptr<gdsMtThreadPool> pool_;
 };
 #endif
@@ -14,10 +14,20 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
+#include <chrono>
 #include <stdexcept>
+#include "common/nixl_affinity.h"
 #include "common/nixl_log.h"
 #include "gds_mt_utils.h"
 
+namespace {
+// How long an idle worker sleeps between queue scans, and how long a
+// transient worker stays idle before retiring.
+constexpr std::chrono::milliseconds pool_idle_wait (10);
+constexpr std::chrono::milliseconds pool_idle_grace (100);
+} // namespace
+
 gdsMtUtil::gdsMtUtil() {
     const CUfileError_t status = cuFileDriverOpen();
     if (status.err != CU_FILE_SUCCESS) {
@@ -68,3 +78,119 @@ gdsMtFileHandle::gdsMtFileHandle (int file_fd) : fd (file_fd) {
 gdsMtFileHandle::~gdsMtFileHandle() {
     cuFileHandleDeregister (cu_fhandle);
 }
+
+gdsMtThreadPool::gdsMtThreadPool (size_t min_threads,
+                                  size_t max_threads,
+                                  size_t num_shards,
+                                  const std::string &cpuset)
+    : min_threads_ (std::max<size_t> (1, min_threads)),
+      max_threads_ (std::max (max_threads, min_threads_)),
+      cpuset_ (cpuset),
+      shards_ (std::max<size_t> (1, num_shards)) {
+    workers_.reserve (min_threads_);
+    for (size_t i = 0; i < min_threads_; i++) {
+        live_threads_++;
+        workers_.emplace_back ([this, i]() { workerLoop (i % shards_.size(), false); });
+    }
+}
+
+gdsMtThreadPool::~gdsMtThreadPool() {
+    stop_.store (true, std::memory_order_release);
+    cv_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+    std::lock_guard<std::mutex> lock (workers_mtx_);
+    for (auto &worker : transient_workers_) {
+        worker.join();
+    }
+}
+
+bool
+gdsMtThreadPool::popTask (size_t start_shard, std::function<void()> &task) {
+    for (size_t i = 0; i < shards_.size(); i++) {
+        shard &s = shards_[(start_shard + i) % shards_.size()];
+        std::lock_guard<std::mutex> lock (s.mtx);
+        if (!s.queue.empty()) {
+            task = std::move (s.queue.front());
+            s.queue.pop_front();
+            queued_tasks_--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+gdsMtThreadPool::workerLoop (size_t start_shard, bool transient) {
+    nixlAffinity::applyToSelf (cpuset_);
+
+    auto idle_since = std::chrono::steady_clock::now();
+
+    while (true) {
+        std::function<void()> task;
+        if (popTask (start_shard, task)) {
+            task();
+            idle_since = std::chrono::steady_clock::now();
+            continue;
+        }
+        // Stop is only honored once every shard has drained, so tasks
+        // queued before destruction always run.
+        if (stop_.load (std::memory_order_acquire)) {
+            break;
+        }
+        if (transient && (std::chrono::steady_clock::now() - idle_since) > pool_idle_grace) {
+            break;
+        }
+        std::unique_lock<std::mutex> lock (cv_mtx_);
+        cv_.wait_for (lock, pool_idle_wait);
+    }
+
+    live_threads_--;
+    if (transient) {
+        retired_++;
+    }
+}
+
+void
+gdsMtThreadPool::reapRetired() {
+    // Called under workers_mtx_. Join only once every transient worker
+    // has retired, so a thread that is still running is never joined.
+    if (!transient_workers_.empty() && retired_.load() == transient_workers_.size()) {
+        for (auto &worker : transient_workers_) {
+            worker.join();
+        }
+        transient_workers_.clear();
+        retired_ = 0;
+    }
+}
+
+void
+gdsMtThreadPool::maybeScaleUp() {
+    if (queued_tasks_.load (std::memory_order_relaxed) <=
+        live_threads_.load (std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock (workers_mtx_);
+    reapRetired();
+    if (live_threads_.load (std::memory_order_relaxed) >=
+        max_threads_.load (std::memory_order_relaxed)) {
+        return;
+    }
+    live_threads_++;
+    transient_workers_.emplace_back (
+        [this, start = next_shard_++]() { workerLoop (start % shards_.size(), true); });
+}
+
+void
+gdsMtThreadPool::submit (size_t shard_hint, std::function<void()> task) {
+    shard &s = shards_[shard_hint % shards_.size()];
+    {
+        std::lock_guard<std::mutex> lock (s.mtx);
+        s.queue.push_back (std::move (task));
+    }
+    queued_tasks_++;
+    maybeScaleUp();
+    cv_.notify_one();
+}
@@ -19,6 +19,15 @@
 
 #include <fcntl.h>
 #include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 #include <nixl.h>
 #include <cufile.h>
 
@@ -60,4 +69,81 @@ public:
     gdsMtUtil();
     ~gdsMtUtil();
 };
+
+/*
+ * Elastic worker pool with per-file queue sharding.
+ *
+ * Tasks are enqueued to a shard selected by the caller (the engine passes
+ * the file descriptor, so each file gets its own queue modulo the shard
+ * count) and workers scan the shards round-robin from different starting
+ * points, so concurrent multi-file transfers do not serialize on a single
+ * queue. min_threads workers run for the lifetime of the pool; when more
+ * tasks are queued than there are live workers, transient workers are
+ * spawned up to max_threads and retire after an idle grace period.
+ */
+class gdsMtThreadPool {
+public:
+    // cpuset, when non-empty, pins every worker (permanent and transient)
+    // at thread start; comma separated core list with ranges, e.g. "2,4-7"
+    gdsMtThreadPool (size_t min_threads,
+                     size_t max_threads,
+                     size_t num_shards,
+                     const std::string &cpuset = "");
+    // Drains any queued work, then stops and joins all worker threads.
+    ~gdsMtThreadPool();
+
+    gdsMtThreadPool (const gdsMtThreadPool &) = delete;
+    gdsMtThreadPool &
+    operator= (const gdsMtThreadPool &) = delete;
+
+    void
+    submit (size_t shard_hint, std::function<void()> task);
+
+    size_t
+    liveThreads() const {
+        return live_threads_.load (std::memory_order_relaxed);
+    }
+    size_t
+    queuedTasks() const {
+        return queued_tasks_.load (std::memory_order_relaxed);
+    }
+
+    // Live-tunable upper bound of the pool: raising it allows new
+    // transient workers, lowering it lets the excess retire through the
+    // normal idle grace path. Clamped to the permanent worker count.
+    void
+    setMaxThreads (size_t max_threads) {
+        max_threads_.store (std::max (max_threads, min_threads_), std::memory_order_relaxed);
+    }
+
+private:
+    struct shard {
+        std::mutex mtx;
+        std::deque<std::function<void()>> queue;
+    };
+
+    void
+    workerLoop (size_t start_shard, bool transient);
+    bool
+    popTask (size_t start_shard, std::function<void()> &task);
+    void
+    maybeScaleUp();
+    void
+    reapRetired();
+
+    const size_t min_threads_;
+    std::atomic<size_t> max_threads_;
+    const std::string cpuset_;
+    std::vector<shard> shards_;
+    std::mutex cv_mtx_;
+    std::condition_variable cv_;
+    std::atomic<size_t> live_threads_{0};
+    std::atomic<size_t> queued_tasks_{0};
+    std::atomic<size_t> retired_{0};
+    std::atomic<bool> stop_{false};
+    std::mutex workers_mtx_;
+    std::vector<std::thread> workers_;
+    std::vector<std::thread> transient_workers_;
+    size_t next_shard_{0};
+};
 #endif
@@ -324,6 +324,7 @@ nixlDocaEngine::nixlDocaEngine(const nixlBackendInitParams *init_params)
     // We may need a GPU warmup with relevant DOCA engine kernels
     doca_kernel_write(0, nullptr, nullptr, 0);
     doca_kernel_read(0, nullptr, nullptr, 0);
+    doca_kernel_post_range(0, nullptr, 0, 1);
     nixlDocaEngineCheckCudaError(cudaStreamSynchronize(0), "stream synchronize");
 
     // Warmup
@@ -1163,6 +1164,7 @@ nixlDocaEngine::prepXfer(const nixl_xfer_op_t &operation,
 
         xferReqRingCpu[pos].last_rsvd = last_rsvd_flags;
         xferReqRingCpu[pos].last_posted = last_posted_flags;
+        xferReqRingCpu[pos].backendOp = operation;
 
         xferReqRingCpu[pos].qp_data = rdma_qp->qp_data->get_qp_gpu_dev();
         xferReqRingCpu[pos].qp_notif = rdma_qp->qp_notif->get_qp_gpu_dev();
@@ -1230,21 +1232,22 @@ nixlDocaEngine::postXfer(const nixl_xfer_op_t &operation,
                          const nixl_opt_b_args_t *opt_args) const {
     nixlDocaBckndReq *treq = (nixlDocaBckndReq *)handle;
 
+    if (operation != NIXL_READ && operation != NIXL_WRITE) return NIXL_ERR_INVALID_PARAM;
+
     for (uint32_t idx = treq->start_pos; idx < treq->end_pos; idx++) {
         xferReqRingCpu[idx].id = (lastPostedReq.fetch_add(1) & (DOCA_MAX_COMPLETION_INFLIGHT_MASK));
         completion_list_cpu[xferReqRingCpu[idx].id].xferReqRingGpu = xferReqRingGpu + idx;
         completion_list_cpu[xferReqRingCpu[idx].id].completed = 0;
+    }
 
-        switch (operation) {
-        case NIXL_READ:
-            doca_kernel_read(treq->stream, xferReqRingCpu[idx].qp_data, xferReqRingGpu, idx);
-            break;
-        case NIXL_WRITE:
-            doca_kernel_write(treq->stream, xferReqRingCpu[idx].qp_data, xferReqRingGpu, idx);
-            break;
-        default:
-            return NIXL_ERR_INVALID_PARAM;
-        }
+    // Single stream-ordered enqueue for the whole request: the range kernel
+    // reads op and QP per slot from the ring, so one launch rides the
+    // attached stream's dependencies instead of one host launch per slot
+    doca_error_t result = doca_kernel_post_range(
+        treq->stream, xferReqRingGpu, treq->start_pos, treq->end_pos - treq->start_pos);
+    if (result != DOCA_SUCCESS) {
+        NIXL_ERROR << "doca_kernel_post_range failed: " << doca_error_get_descr(result);
+        return NIXL_ERR_BACKEND;
     }
 
     return NIXL_IN_PROG;
@@ -1279,6 +1282,37 @@ nixlDocaEngine::releaseReqH(nixlBackendReqH *handle) const {
         return NIXL_IN_PROG;
 }
 
+nixl_status_t
+nixlDocaEngine::createGpuXferReq(const nixlBackendReqH &req_hndl,
+                                 const nixl_meta_dlist_t &local_descs,
+                                 const nixl_meta_dlist_t &remote_descs,
+                                 nixlGpuXferReqH &gpu_req_hndl) const {
+    const nixlDocaBckndReq *treq = (const nixlDocaBckndReq *)&req_hndl;
+
+    // The device-side post walks a single descriptor table and rings the
+    // doorbell once; requests that prepXfer split across several ring
+    // slots cannot be exported as one batch
+    if (treq->end_pos - treq->start_pos != 1) {
+        NIXL_ERROR << "GPU xfer request spans " << (treq->end_pos - treq->start_pos)
+                   << " descriptor tables - batch larger than " << DOCA_XFER_REQ_SIZE
+                   << " descriptors can't be GPU-initiated";
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    gpu_req_hndl = (nixlGpuXferReqH)(xferReqRingGpu + treq->start_pos);
+
+    NIXL_INFO << "DOCA createGpuXferReq pos " << treq->start_pos << " with "
+              << xferReqRingCpu[treq->start_pos].num << " descriptors";
+
+    return NIXL_SUCCESS;
+}
+
+void
+nixlDocaEngine::releaseGpuXferReq(nixlGpuXferReqH gpu_req_hndl) const {
+    // The handle aliases a ring slot owned by the backend; slot recycling
+    // is driven by the in_use flag the device-side wait clears
+}
+
 nixl_status_t
 nixlDocaEngine::getNotifs(notif_list_t &notif_list) {
     uint32_t recv_idx;
@@ -124,6 +124,16 @@ public:
     nixl_status_t
     releaseReqH(nixlBackendReqH *handle) const override;
 
+    // GPU-initiated path: export the staged descriptor table in GPU memory
+    // so device code can post the batch via gpunetio_gpu_xfer.cuh
+    nixl_status_t
+    createGpuXferReq(const nixlBackendReqH &req_hndl,
+                     const nixl_meta_dlist_t &local_descs,
+                     const nixl_meta_dlist_t &remote_descs,
+                     nixlGpuXferReqH &gpu_req_hndl) const override;
+    void
+    releaseGpuXferReq(nixlGpuXferReqH gpu_req_hndl) const override;
+
     nixl_status_t
     getNotifs(notif_list_t &notif_list);
     nixl_status_t
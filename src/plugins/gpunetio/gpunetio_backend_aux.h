@@ -217,6 +217,11 @@ doca_kernel_read(cudaStream_t stream,
                  struct docaXferReqGpu *xferReqRing,
                  uint32_t pos);
 doca_error_t
+doca_kernel_post_range(cudaStream_t stream,
+                       struct docaXferReqGpu *xferReqRing,
+                       uint32_t start,
+                       uint32_t count);
+doca_error_t
 doca_kernel_progress(cudaStream_t stream,
                      struct docaXferCompletion *completion_list,
                      struct docaNotif *notif_fill,
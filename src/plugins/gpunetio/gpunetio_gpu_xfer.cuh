@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GPUNETIO_GPU_XFER_CUH
+#define GPUNETIO_GPU_XFER_CUH
+
+#include <doca_gpunetio_dev_verbs_onesided.cuh>
+
+#include "gpunetio_backend_aux.h"
+
+/*
+ * Device-side batched post API for GPU-initiated transfers.
+ *
+ * The host prepares a descriptor table in GPU memory through the regular
+ * prepXfer path and exports it with nixlAgent::createGpuXferReq, which
+ * returns a pointer to the staged docaXferReqGpu. A consumer kernel can
+ * then post the whole batch - one WQE per descriptor, a single doorbell -
+ * without any host round trip, and poll for its completion in place.
+ *
+ * Both functions must be called by all threads of one block; WQE
+ * preparation is strided across the block like the host-launched post
+ * kernels. Batches are limited to one table (DOCA_XFER_REQ_SIZE
+ * descriptors); createGpuXferReq refuses larger requests.
+ */
+
+/**
+ * @brief Post every descriptor of a staged transfer request from device
+ * code, ringing the doorbell once for the whole batch.
+ *
+ * @param xreq - descriptor table returned by createGpuXferReq
+ */
+__device__ static inline void
+nixl_gpunetio_dev_post_xfer_batch(struct docaXferReqGpu *xreq) {
+    doca_gpu_dev_verbs_qp *qp = xreq->qp_data;
+    enum doca_gpu_dev_verbs_wqe_ctrl_flags cflag = DOCA_GPUNETIO_MLX5_WQE_CTRL_CQ_UPDATE;
+    uint32_t tot_wqe = xreq->num;
+    uint64_t wqe_idx = 0;
+    doca_gpu_dev_verbs_wqe *wqe_ptr;
+    uint32_t idx = 0;
+    __shared__ uint64_t base_wqe_idx;
+
+    if (threadIdx.x == 0) base_wqe_idx = doca_gpu_dev_verbs_reserve_wq_slots(qp, tot_wqe);
+    __syncthreads();
+
+    for (idx = threadIdx.x; idx < tot_wqe; idx += blockDim.x) {
+        wqe_idx = base_wqe_idx + idx;
+        wqe_ptr = doca_gpu_dev_verbs_get_wqe_ptr(qp, wqe_idx);
+
+        if (xreq->backendOp == NIXL_READ) {
+            doca_gpu_dev_verbs_wqe_prepare_read(qp,
+                                                wqe_ptr,
+                                                wqe_idx,
+                                                cflag,
+                                                (uint64_t)(xreq->rbuf[idx]),
+                                                xreq->rkey[idx],
+                                                (uint64_t)(xreq->lbuf[idx]),
+                                                xreq->lkey[idx],
+                                                xreq->size[idx]);
+        } else {
+            doca_gpu_dev_verbs_wqe_prepare_write(qp,
+                                                 wqe_ptr,
+                                                 wqe_idx,
+                                                 MLX5_OPCODE_RDMA_WRITE,
+                                                 cflag,
+                                                 0,
+                                                 (uint64_t)(xreq->rbuf[idx]),
+                                                 xreq->rkey[idx],
+                                                 (uint64_t)(xreq->lbuf[idx]),
+                                                 xreq->lkey[idx],
+                                                 xreq->size[idx]);
+        }
+    }
+    __syncthreads();
+
+    if ((idx - blockDim.x) == (tot_wqe - 1)) {
+        doca_gpu_dev_verbs_mark_wqes_ready(qp, base_wqe_idx, wqe_idx);
+        doca_gpu_dev_verbs_submit(qp, wqe_idx + 1);
+
+        DOCA_GPUNETIO_VOLATILE(xreq->last_wqe) = wqe_idx;
+        doca_gpu_dev_verbs_fence_release<DOCA_GPUNETIO_VERBS_SYNC_SCOPE_GPU>();
+        DOCA_GPUNETIO_VOLATILE(xreq->in_use) = 1;
+    }
+    __syncthreads();
+}
+
+/**
+ * @brief Wait on device for a batch posted with
+ * nixl_gpunetio_dev_post_xfer_batch to complete.
+ *
+ * @param xreq - descriptor table returned by createGpuXferReq
+ * @return 0 on success, -EIO when the final CQE reports an error
+ */
+__device__ static inline int
+nixl_gpunetio_dev_wait_xfer_batch(struct docaXferReqGpu *xreq) {
+    __shared__ int poll_status;
+
+    if (threadIdx.x == 0) {
+        poll_status = doca_gpu_dev_verbs_poll_cq_at(
+            doca_gpu_dev_verbs_qp_get_cq_sq(xreq->qp_data),
+            DOCA_GPUNETIO_VOLATILE(xreq->last_wqe));
+        DOCA_GPUNETIO_VOLATILE(xreq->in_use) = 0;
+    }
+    __syncthreads();
+
+    return poll_status;
+}
+
+/*
+ * CUDA graph support.
+ *
+ * Everything below (and the post/wait pair above) touches only device
+ * memory and the NIC doorbell, so kernels built on these functions can be
+ * captured into a CUDA graph and replayed every decode step with no host
+ * work per replay: slot reservation, WQE preparation, doorbell ring and
+ * CQ polling all re-arm themselves on each execution. The one host-side
+ * step - createGpuXferReq - stays outside the graph and is done once.
+ *
+ * Replays may rewrite buffer addresses and sizes between steps with
+ * nixl_gpunetio_dev_update_desc, as long as the new ranges stay inside
+ * the memory regions registered at prep time: the lkey/rkey entries are
+ * staged by the host and are not recomputed on device.
+ */
+
+/**
+ * @brief Rewrite one descriptor of a staged transfer request from device
+ * code, e.g. from a kernel recorded ahead of the posting kernel in the
+ * same graph. Single-threaded; the caller synchronizes before posting.
+ *
+ * @param xreq - descriptor table returned by createGpuXferReq
+ * @param idx - descriptor slot, must be below the count set at prep time
+ * @param lbuf - new local address, inside the registered local region
+ * @param rbuf - new remote address, inside the registered remote region
+ * @param size - new transfer size in bytes
+ */
+__device__ static inline void
+nixl_gpunetio_dev_update_desc(struct docaXferReqGpu *xreq,
+                              uint32_t idx,
+                              uintptr_t lbuf,
+                              uintptr_t rbuf,
+                              size_t size) {
+    xreq->lbuf[idx] = lbuf;
+    xreq->rbuf[idx] = rbuf;
+    xreq->size[idx] = size;
+}
+
+/**
+ * @brief Post a staged batch and wait for its completion in one call.
+ * Graph-capturable; must be called by all threads of one block.
+ *
+ * @param xreq - descriptor table returned by createGpuXferReq
+ * @return 0 on success, -EIO when the final CQE reports an error
+ */
+__device__ static inline int
+nixl_gpunetio_dev_post_xfer_batch_sync(struct docaXferReqGpu *xreq) {
+    nixl_gpunetio_dev_post_xfer_batch(xreq);
+    return nixl_gpunetio_dev_wait_xfer_batch(xreq);
+}
+
+#endif /* GPUNETIO_GPU_XFER_CUH */
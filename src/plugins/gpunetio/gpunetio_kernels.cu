@@ -223,6 +223,101 @@ kernel_write(doca_gpu_dev_verbs_qp *qp, struct docaXferReqGpu *xferReqRing, uint
 #endif
 }
 
+__global__ void
+kernel_post_range(struct docaXferReqGpu *xferReqRing, uint32_t start, uint32_t count) {
+    uint64_t wqe_idx = 0;
+    doca_gpu_dev_verbs_wqe *wqe_ptr;
+    enum doca_gpu_dev_verbs_wqe_ctrl_flags cflag = DOCA_GPUNETIO_MLX5_WQE_CTRL_CQ_UPDATE;
+    uint32_t tot_wqe, idx = 0;
+    __shared__ uint64_t base_wqe_idx;
+
+    // Warmup
+    if (xferReqRing == nullptr) return;
+
+    // One block per ring slot: a whole request enqueues with a single
+    // stream-ordered launch instead of one host launch per slot
+    uint32_t pos = (start + blockIdx.x) & DOCA_XFER_REQ_MASK;
+    doca_gpu_dev_verbs_qp *qp = xferReqRing[pos].qp_data;
+    bool is_read = (xferReqRing[pos].backendOp == NIXL_READ);
+
+    tot_wqe = xferReqRing[pos].num;
+
+    if (threadIdx.x == 0) {
+        if (is_read && qp->need_dump == true)
+            base_wqe_idx = doca_gpu_dev_verbs_reserve_wq_slots(qp, tot_wqe + 1);
+        else
+            base_wqe_idx = doca_gpu_dev_verbs_reserve_wq_slots(qp, tot_wqe);
+    }
+    __syncthreads();
+
+    for (idx = threadIdx.x; idx < tot_wqe; idx += blockDim.x) {
+        wqe_idx = base_wqe_idx + idx;
+        wqe_ptr = doca_gpu_dev_verbs_get_wqe_ptr(qp, wqe_idx);
+
+        if (is_read) {
+            doca_gpu_dev_verbs_wqe_prepare_read(qp,
+                                                wqe_ptr,
+                                                wqe_idx,
+                                                cflag,
+                                                (uint64_t)(xferReqRing[pos].rbuf[idx]),
+                                                xferReqRing[pos].rkey[idx],
+                                                (uint64_t)(xferReqRing[pos].lbuf[idx]),
+                                                xferReqRing[pos].lkey[idx],
+                                                xferReqRing[pos].size[idx]);
+        } else {
+            doca_gpu_dev_verbs_wqe_prepare_write(qp,
+                                                 wqe_ptr,
+                                                 wqe_idx,
+                                                 MLX5_OPCODE_RDMA_WRITE,
+                                                 cflag,
+                                                 0,
+                                                 (uint64_t)(xferReqRing[pos].rbuf[idx]),
+                                                 xferReqRing[pos].rkey[idx],
+                                                 (uint64_t)(xferReqRing[pos].lbuf[idx]),
+                                                 xferReqRing[pos].lkey[idx],
+                                                 xferReqRing[pos].size[idx]);
+        }
+    }
+    __syncthreads();
+
+    if ((idx - blockDim.x) == (tot_wqe - 1)) {
+        if (is_read && qp->need_dump == true) {
+            wqe_idx++;
+            wqe_ptr = doca_gpu_dev_verbs_get_wqe_ptr(qp, wqe_idx);
+
+            doca_gpu_dev_verbs_wqe_prepare_dump(qp,
+                                                wqe_ptr,
+                                                wqe_idx,
+                                                DOCA_GPUNETIO_MLX5_WQE_CTRL_CQ_UPDATE,
+                                                (uint64_t)(xferReqRing[pos].lbuf[tot_wqe - 1]),
+                                                xferReqRing[pos].lkey[tot_wqe - 1],
+                                                1);
+        }
+        doca_gpu_dev_verbs_mark_wqes_ready(qp, base_wqe_idx, wqe_idx);
+        doca_gpu_dev_verbs_submit(qp, wqe_idx + 1);
+
+        // Reads block on the final CQE like kernel_read does, so stream-ordered
+        // consumers launched after this kernel see the data in place
+        if (is_read) {
+            if (doca_gpu_dev_verbs_poll_cq_at(doca_gpu_dev_verbs_qp_get_cq_sq(qp), wqe_idx) != 0)
+                printf("kernel_post_range: Error CQE!\n");
+        }
+
+        DOCA_GPUNETIO_VOLATILE(xferReqRing[pos].last_wqe) = wqe_idx;
+        doca_gpu_dev_verbs_fence_release<DOCA_GPUNETIO_VERBS_SYNC_SCOPE_GPU>();
+        DOCA_GPUNETIO_VOLATILE(xferReqRing[pos].in_use) = 1;
+    }
+
+#if ENABLE_DEBUG == 1
+    if (threadIdx.x == 0)
+        printf(">>>>>>> CUDA rdma post_range kernel pos %d posted %d buffers from base_wqe_idx "
+               "%ld\n",
+               pos,
+               xferReqRing[pos].num,
+               base_wqe_idx);
+#endif
+}
+
 __global__ void
 kernel_progress(struct docaXferCompletion *completion_list,
                 struct docaNotif *notif_fill,
@@ -441,6 +536,32 @@ doca_kernel_read(cudaStream_t stream,
     return DOCA_SUCCESS;
 }
 
+doca_error_t
+doca_kernel_post_range(cudaStream_t stream,
+                       struct docaXferReqGpu *xferReqRing,
+                       uint32_t start,
+                       uint32_t count) {
+    cudaError_t result = cudaSuccess;
+
+    /* Check no previous CUDA errors */
+    result = cudaGetLastError();
+    if (result != cudaSuccess) {
+        fprintf(
+            stderr, "[%s:%d] cuda failed with %s", __FILE__, __LINE__, cudaGetErrorString(result));
+        return DOCA_ERROR_BAD_STATE;
+    }
+
+    kernel_post_range<<<count, DOCA_XFER_REQ_SIZE, 0, stream>>>(xferReqRing, start, count);
+    result = cudaGetLastError();
+    if (result != cudaSuccess) {
+        fprintf(
+            stderr, "[%s:%d] cuda failed with %s", __FILE__, __LINE__, cudaGetErrorString(result));
+        return DOCA_ERROR_BAD_STATE;
+    }
+
+    return DOCA_SUCCESS;
+}
+
 doca_error_t
 doca_kernel_progress(cudaStream_t stream,
                      struct docaXferCompletion *completion_list,
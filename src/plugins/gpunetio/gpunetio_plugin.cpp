@@ -69,6 +69,12 @@ get_backend_mems() {
     return mems;
 }
 
+// Function to get the backend capability mask
+static nixl_backend_caps_t
+get_backend_caps() {
+    return NIXL_CAP_REMOTE | NIXL_CAP_NOTIF;
+}
+
 // Static plugin structure
 static nixlBackendPlugin plugin = {NIXL_PLUGIN_API_VERSION,
                                    create_engine,
@@ -76,7 +82,8 @@ static nixlBackendPlugin plugin = {NIXL_PLUGIN_API_VERSION,
                                    get_plugin_name,
                                    get_plugin_version,
                                    get_backend_options,
-                                   get_backend_mems};
+                                   get_backend_mems,
+                                   get_backend_caps};
 
 #ifdef STATIC_PLUGIN_GPUNETIO
 
@@ -17,6 +17,9 @@
 #include "gusli_backend.h"
 #include "common/nixl_log.h"
 #include <absl/strings/str_format.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #define __LOG_ERR(format, ...)                                                                    \
     do {                                                                                          \
         NIXL_ERROR << absl::StrFormat(                                                            \
@@ -117,6 +120,16 @@ nixlGusliEngine::nixlGusliEngine(const nixlBackendInitParams *nixl_init)
     parseInitParams(nixl_init, gusli_params);
     lib_ = std::make_unique<gusli::global_clnt_context>(gusli_params);
     NIXL_ASSERT_ALWAYS(lib_->BREAKING_VERSION == 1);
+    worker_ = std::thread(&nixlGusliEngine::reaperLoop, this);
+}
+
+nixlGusliEngine::~nixlGusliEngine() {
+    {
+        const std::lock_guard<std::mutex> lock(worker_lock_);
+        worker_stop_ = true;
+    }
+    worker_cv_.notify_one();
+    if (worker_.joinable()) worker_.join();
 }
 
 nixl_status_t
@@ -188,6 +201,8 @@ public:
     enum gusli::io_error_codes
         pollableAsyncRV; // NIXL actively polls on rv instead of waiting for completion.
     enum gusli::io_type op; // USed for prints
+    // Written by the engine's reaper thread, read lock-free by checkXfer
+    std::atomic<nixl_status_t> asyncStatus{NIXL_IN_PROG};
     [[nodiscard]] virtual nixl_status_t
     exec(void) = 0;
     [[nodiscard]] virtual nixl_status_t
@@ -418,6 +433,53 @@ nixlGusliEngine::prepXfer(const nixl_xfer_op_t &op,
     return NIXL_SUCCESS;
 }
 
+// Drains the submission queue in one pass - everything that accumulated
+// since the previous pass goes to the gusli block queue back-to-back -
+// then reaps completions into the per-request atomic flags. Sleeps on the
+// condition variable when fully idle, paces polling while IOs are in air.
+void
+nixlGusliEngine::reaperLoop() {
+    using namespace std::chrono_literals;
+    std::unique_lock<std::mutex> lock(worker_lock_);
+    while (!worker_stop_) {
+        if (submit_queue_.empty()) {
+            if (inflight_.empty())
+                worker_cv_.wait(lock,
+                                [this]() { return worker_stop_ || !submit_queue_.empty(); });
+            else
+                worker_cv_.wait_for(lock, 50us, [this]() {
+                    return worker_stop_ || !submit_queue_.empty();
+                });
+            if (worker_stop_) break;
+        }
+
+        while (!submit_queue_.empty()) {
+            nixlGusliBackendReqHbase *req = submit_queue_.front();
+            submit_queue_.pop_front();
+            (void)req->exec(); // Always returns in-progress
+            inflight_.push_back(req);
+        }
+
+        for (auto it = inflight_.begin(); it != inflight_.end();) {
+            const nixl_status_t rv = (*it)->pollStatus();
+            if (rv != NIXL_IN_PROG) {
+                (*it)->asyncStatus.store(rv, std::memory_order_release);
+                it = inflight_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+void
+nixlGusliEngine::dropFromWorker(nixlGusliBackendReqHbase *req) const {
+    const std::lock_guard<std::mutex> lock(worker_lock_);
+    submit_queue_.erase(std::remove(submit_queue_.begin(), submit_queue_.end(), req),
+                        submit_queue_.end());
+    inflight_.erase(std::remove(inflight_.begin(), inflight_.end(), req), inflight_.end());
+}
+
 nixl_status_t
 nixlGusliEngine::postXfer(const nixl_xfer_op_t &operation,
                           const nixl_meta_dlist_t &local,
@@ -431,17 +493,27 @@ nixlGusliEngine::postXfer(const nixl_xfer_op_t &operation,
     (void)remote_agent;
     (void)opt_args;
     nixlGusliBackendReqHbase *req = (nixlGusliBackendReqHbase *)handle;
-    return req->exec();
+    req->asyncStatus.store(NIXL_IN_PROG, std::memory_order_relaxed);
+    {
+        const std::lock_guard<std::mutex> lock(worker_lock_);
+        submit_queue_.push_back(req);
+    }
+    worker_cv_.notify_one();
+    return NIXL_IN_PROG;
 }
 
 nixl_status_t
 nixlGusliEngine::checkXfer(nixlBackendReqH *handle) const {
     nixlGusliBackendReqHbase *req = (nixlGusliBackendReqHbase *)handle;
-    return req->pollStatus();
+    return req->asyncStatus.load(std::memory_order_acquire);
 }
 
 nixl_status_t
 nixlGusliEngine::releaseReqH(nixlBackendReqH *handle) const {
-    delete ((nixlGusliBackendReqHbase *)handle);
+    nixlGusliBackendReqHbase *req = (nixlGusliBackendReqHbase *)handle;
+    // The request may still sit in the worker's structures; in-air gusli
+    // IOs are auto-cancelled by the request destructor
+    dropFromWorker(req);
+    delete req;
     return NIXL_SUCCESS;
 }
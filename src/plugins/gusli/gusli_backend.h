@@ -19,13 +19,20 @@
 #define __GUSLI_BACKEND_H
 #include <nixl.h>
 #include <nixl_types.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include "backend/backend_engine.h"
 #include "gusli_client_api.hpp"
 
+class nixlGusliBackendReqHbase;
+
 class nixlGusliEngine : public nixlBackendEngine {
 public:
     nixlGusliEngine(const nixlBackendInitParams *init_params);
-    ~nixlGusliEngine() = default;
+    ~nixlGusliEngine();
 
     bool
     supportsNotif() const override {
@@ -96,6 +103,24 @@ public:
 private:
     std::unique_ptr<gusli::global_clnt_context> lib_;
 
+    // Submission/completion worker: postXfer only enqueues, the worker
+    // drains the queue and submits everything accumulated back-to-back
+    // (the block-store gateway sustains far higher IOPS on batched
+    // submission), then reaps completions into each request's atomic
+    // status flag, which checkXfer reads lock-free.
+    mutable std::mutex worker_lock_;
+    mutable std::condition_variable worker_cv_;
+    mutable std::deque<nixlGusliBackendReqHbase *> submit_queue_;
+    mutable std::vector<nixlGusliBackendReqHbase *> inflight_;
+    bool worker_stop_ = false;
+    std::thread worker_;
+
+    void
+    reaperLoop();
+    // Detaches a request from the worker before it is destroyed
+    void
+    dropFromWorker(nixlGusliBackendReqHbase *req) const;
+
     void
     parseInitParams(const nixlBackendInitParams *nixl_init,
                     gusli::global_clnt_context::init_params &gusli_params);
@@ -17,6 +17,8 @@
 #include <cassert>
 #include <cctype>
 #include <atomic>
+#include <chrono>
+#include <map>
 #include <errno.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
@@ -30,14 +32,93 @@
 #define NUM_CQES 1024
 #define HF3FS_DEFAULT_IOPOOL_SIZE 64
 #define HF3FS_MAX_IOPOOL_SIZE (1 << 20)
+#define HF3FS_READAHEAD_CQES 64
+// Upper bound on how many contiguous write descriptors get folded into one IO
+#define HF3FS_WRITE_AGG_MAX (64ULL * 1024 * 1024)
+// Shared USRBIO iov slot budget and the admission grace period
+#define HF3FS_DEFAULT_IOV_SLOTS 1024
+#define HF3FS_ARENA_WAIT_MS 100
 
 long nixlHf3fsEngine::page_size = sysconf(_SC_PAGESIZE);
 
+hf3fsIovArena::hf3fsIovArena(unsigned int slots)
+    : free_((long)slots),
+      total_(slots),
+      min_free_((long)slots) {}
+
+void
+hf3fsIovArena::takeLocked() {
+    free_--;
+    long used = (long)total_ - free_;
+    if (used > (long)peak_used_) {
+        peak_used_ = (unsigned int)used;
+    }
+    if (free_ < min_free_) {
+        min_free_ = free_;
+    }
+}
+
+void
+hf3fsIovArena::acquire() {
+    std::unique_lock<std::mutex> lock(lock_);
+    if (free_ <= 0) {
+        throttled_++;
+        // Bounded wait, woken as slots are released; after the grace
+        // period the slot is taken anyway so a request larger than the
+        // whole arena cannot deadlock against itself
+        cv_.wait_for(lock, std::chrono::milliseconds(HF3FS_ARENA_WAIT_MS), [this]() {
+            return free_ > 0;
+        });
+    }
+    takeLocked();
+}
+
+bool
+hf3fsIovArena::tryAcquire() {
+    const std::lock_guard<std::mutex> lock(lock_);
+    if (free_ <= 0) {
+        return false;
+    }
+    takeLocked();
+    return true;
+}
+
+void
+hf3fsIovArena::release() {
+    {
+        const std::lock_guard<std::mutex> lock(lock_);
+        free_++;
+    }
+    cv_.notify_one();
+}
+
+unsigned int
+hf3fsIovArena::highWatermark() const {
+    const std::lock_guard<std::mutex> lock(lock_);
+    return peak_used_;
+}
+
+long
+hf3fsIovArena::lowWatermark() const {
+    const std::lock_guard<std::mutex> lock(lock_);
+    return min_free_;
+}
+
+uint64_t
+hf3fsIovArena::throttledAcquires() const {
+    const std::lock_guard<std::mutex> lock(lock_);
+    return throttled_;
+}
+
 nixlHf3fsEngine::nixlHf3fsEngine(const nixlBackendInitParams *init_params)
     : nixlBackendEngine(init_params),
+      iov_arena(nullptr),
+      readahead(nullptr),
       mem_config(NIXL_HF3FS_MEM_CONFIG_AUTO),
       iopool_size(HF3FS_DEFAULT_IOPOOL_SIZE) {
     hf3fs_utils = new hf3fsUtil();
+    unsigned int readahead_window = 0;
+    unsigned int iov_slots = HF3FS_DEFAULT_IOV_SLOTS;
 
     this->initErr = false;
     if (hf3fs_utils->openHf3fsDriver() == NIXL_ERR_BACKEND) {
@@ -64,6 +145,18 @@ nixlHf3fsEngine::nixlHf3fsEngine(const nixlBackendInitParams *init_params)
                 return;
             }
         }
+        if (init_params->customParams->count("readahead_window") > 0) {
+            int window = atoi(init_params->customParams->at("readahead_window").c_str());
+            if (window > 0) {
+                readahead_window = window;
+            }
+        }
+        if (init_params->customParams->count("iov_slots") > 0) {
+            int slots = atoi(init_params->customParams->at("iov_slots").c_str());
+            if (slots > 0) {
+                iov_slots = slots;
+            }
+        }
         if (init_params->customParams->count("iopool_size") > 0) {
             int size = atoi(init_params->customParams->at("iopool_size").c_str());
             if (size > 0) {
@@ -86,6 +179,8 @@ nixlHf3fsEngine::nixlHf3fsEngine(const nixlBackendInitParams *init_params)
     }
 
     hf3fs_utils->mount_point = mount_point_cstr;
+    iov_arena = new hf3fsIovArena(iov_slots);
+    readahead = new nixlHf3fsReadahead(hf3fs_utils, readahead_window, iov_arena);
 
     for (unsigned int i = 0; i < iopool_size; i++) {
         auto io = new nixlHf3fsIO();
@@ -97,7 +192,202 @@ nixlHf3fsEngine::nixlHf3fsEngine(const nixlBackendInitParams *init_params)
         iopool.push_back(io);
     }
 
-    NIXL_DEBUG << "HF3FS: page size " << page_size << " iopool_size " << iopool_size;
+    NIXL_DEBUG << "HF3FS: page size " << page_size << " iopool_size " << iopool_size
+               << " readahead_window " << readahead_window << " iov_slots " << iov_slots;
+}
+
+nixlHf3fsReadahead::nixlHf3fsReadahead(hf3fsUtil *utils, unsigned int window, hf3fsIovArena *arena)
+    : utils_(utils),
+      window_(window),
+      arena_(arena) {
+    if (window_ == 0) {
+        return;
+    }
+    if (utils_->createIOR(&ior_, window_ * 2, true) != NIXL_SUCCESS) {
+        NIXL_WARN << "HF3FS: failed to create readahead IOR - readahead disabled";
+        window_ = 0;
+        return;
+    }
+    ior_ok_ = true;
+}
+
+nixlHf3fsReadahead::~nixlHf3fsReadahead() {
+    if (!ior_ok_) {
+        return;
+    }
+    const std::lock_guard<std::mutex> lock(lock_);
+    // Wait out in-flight speculative reads before tearing down their IOVs
+    int spins = 0;
+    while (inflight_ > 0 && spins++ < 1000) {
+        reapCompletions();
+        if (inflight_ > 0) {
+            sched_yield();
+        }
+    }
+    for (auto s : slabs_) {
+        utils_->destroyIOV(&s->iov);
+        arena_->release();
+        delete s;
+    }
+    slabs_.clear();
+    utils_->destroyIOR(&ior_);
+}
+
+void
+nixlHf3fsReadahead::dropSlab(slab *s) {
+    slabs_.remove(s);
+    utils_->destroyIOV(&s->iov);
+    arena_->release();
+    delete s;
+}
+
+bool
+nixlHf3fsReadahead::evictIdle() {
+    for (auto s : slabs_) {
+        if (s->ready) {
+            dropSlab(s);
+            return true;
+        }
+    }
+    return false;
+}
+
+nixlHf3fsReadahead::slab *
+nixlHf3fsReadahead::findSlab(int fd, size_t offset) const {
+    for (auto s : slabs_) {
+        if (s->fd == fd && s->offset == offset) {
+            return s;
+        }
+    }
+    return nullptr;
+}
+
+void
+nixlHf3fsReadahead::reapCompletions() {
+    if (inflight_ == 0) {
+        return;
+    }
+
+    hf3fs_cqe cqes[HF3FS_READAHEAD_CQES];
+    struct timespec ts;
+    // An already-expired deadline turns the wait into a poll
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    int num_completed = 0;
+    if (utils_->waitForIOs(&ior_, cqes, HF3FS_READAHEAD_CQES, 0, &ts, &num_completed) !=
+        NIXL_SUCCESS) {
+        return;
+    }
+
+    for (int i = 0; i < num_completed; i++) {
+        slab *s = (slab *)cqes[i].userdata;
+        inflight_--;
+        // Short reads (EOF), errors and slabs invalidated by a write are dropped
+        if (cqes[i].result < (long)s->size || s->stale) {
+            dropSlab(s);
+        } else {
+            s->ready = true;
+        }
+    }
+}
+
+void
+nixlHf3fsReadahead::issueFrom(int fd, size_t next_offset, size_t slab_size) {
+    if (window_ == 0 || slab_size == 0) {
+        return;
+    }
+
+    const std::lock_guard<std::mutex> lock(lock_);
+    reapCompletions();
+
+    bool posted = false;
+    for (unsigned int k = 0; k < window_; k++) {
+        size_t off = next_offset + (size_t)k * slab_size;
+        if (findSlab(fd, off) != nullptr) {
+            continue;
+        }
+        if (slabs_.size() >= (size_t)window_ * 2 && !evictIdle()) {
+            break;
+        }
+
+        // Speculative reads only take slots the request path is not using
+        if (!arena_->tryAcquire()) {
+            break;
+        }
+
+        auto s = new slab();
+        s->fd = fd;
+        s->offset = off;
+        s->size = slab_size;
+        if (utils_->createIOV(&s->iov, slab_size, slab_size) != NIXL_SUCCESS) {
+            arena_->release();
+            delete s;
+            break;
+        }
+        if (utils_->prepIO(&ior_, &s->iov, s->iov.base, off, slab_size, fd, true, s) !=
+            NIXL_SUCCESS) {
+            utils_->destroyIOV(&s->iov);
+            arena_->release();
+            delete s;
+            break;
+        }
+        slabs_.push_back(s);
+        inflight_++;
+        posted = true;
+    }
+
+    if (posted && utils_->postIOR(&ior_) != NIXL_SUCCESS) {
+        NIXL_DEBUG << "HF3FS: failed to post readahead IOR";
+    }
+}
+
+bool
+nixlHf3fsReadahead::tryServe(int fd, size_t offset, size_t size, void *dst) {
+    if (window_ == 0) {
+        return false;
+    }
+
+    const std::lock_guard<std::mutex> lock(lock_);
+    reapCompletions();
+
+    for (auto s : slabs_) {
+        if (s->fd != fd || !s->ready || s->stale) {
+            continue;
+        }
+        if (s->offset <= offset && offset + size <= s->offset + s->size) {
+            memcpy(dst, (uint8_t *)s->iov.base + (offset - s->offset), size);
+            // One-shot: the sequential stream will not come back for it
+            dropSlab(s);
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+nixlHf3fsReadahead::invalidate(int fd) {
+    if (window_ == 0) {
+        return;
+    }
+
+    const std::lock_guard<std::mutex> lock(lock_);
+    for (auto it = slabs_.begin(); it != slabs_.end();) {
+        slab *s = *it;
+        if (s->fd != fd) {
+            ++it;
+            continue;
+        }
+        if (s->ready) {
+            it = slabs_.erase(it);
+            utils_->destroyIOV(&s->iov);
+            arena_->release();
+            delete s;
+        } else {
+            // In flight: dropped when its completion arrives
+            s->stale = true;
+            ++it;
+        }
+    }
 }
 
 nixlHf3fsIO *
@@ -228,11 +518,28 @@ nixl_status_t nixlHf3fsEngine::deregisterMem (nixlBackendMD* meta)
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlHf3fsEngine::createIOVThrottled(struct hf3fs_iov *iov, size_t size, size_t block_size) const {
+    iov_arena->acquire();
+    auto status = hf3fs_utils->createIOV(iov, size, block_size);
+    if (status != NIXL_SUCCESS) {
+        iov_arena->release();
+    }
+    return status;
+}
+
+void
+nixlHf3fsEngine::destroyIOVThrottled(struct hf3fs_iov *iov) const {
+    hf3fs_utils->destroyIOV(iov);
+    // Wakes one queued request-path acquire, if any
+    iov_arena->release();
+}
+
 void nixlHf3fsEngine::cleanupIOList(nixlHf3fsBackendReqH *handle) const
 {
     for (auto prev_io : handle->io_list) {
-        if (prev_io->mem_type == NIXL_HF3FS_MEM_TYPE_DRAM) {
-            hf3fs_utils->destroyIOV(&prev_io->iov);
+        if (prev_io->mem_type == NIXL_HF3FS_MEM_TYPE_DRAM && !prev_io->cached) {
+            destroyIOVThrottled(&prev_io->iov);
         }
         putIOObj(prev_io);
     }
@@ -313,6 +620,7 @@ nixl_status_t nixlHf3fsEngine::prepXfer (const nixl_xfer_op_t &operation,
             nixl_mesg = "Error: Failed to get IO Object";
             goto cleanup_handle;
         }
+        io->cached = false;
 
         if (mem_md->type == NIXL_HF3FS_MEM_TYPE_DRAM_ZC) {
             nixlHf3fsDramZCMetadata *shm_md = (nixlHf3fsDramZCMetadata *)mem_md;
@@ -327,8 +635,28 @@ nixl_status_t nixlHf3fsEngine::prepXfer (const nixl_xfer_op_t &operation,
                 nixl_mesg = "Error: Failed to wrap memory as IOV";
                 goto cleanup_handle;
             }
+        } else if (is_read && readahead->tryServe(file_descriptor, offset, size, addr)) {
+            // The whole chunk was already fetched speculatively; nothing to submit
+            io->cached = true;
         } else {
-            status = hf3fs_utils->createIOV(&io->iov, size, size);
+            // Write-behind aggregation: fold the descriptors that continue
+            // this write contiguously in the same file into one slab, so an
+            // eviction of many small blocks goes out as a few large IOs
+            int last = i;
+            size_t agg_size = size;
+            if (!is_read && mem_md->type == NIXL_HF3FS_MEM_TYPE_DRAM) {
+                while (last + 1 < file_cnt &&
+                       (*file_list)[last + 1].devId == file_descriptor &&
+                       (size_t)(*file_list)[last + 1].addr == offset + agg_size &&
+                       ((nixlHf3fsMetadata *)(*mem_list)[last + 1].metadataP)->type ==
+                           NIXL_HF3FS_MEM_TYPE_DRAM &&
+                       agg_size + (*mem_list)[last + 1].len <= HF3FS_WRITE_AGG_MAX) {
+                    agg_size += (*mem_list)[last + 1].len;
+                    last++;
+                }
+            }
+
+            status = createIOVThrottled(&io->iov, agg_size, agg_size);
             if (status != NIXL_SUCCESS) {
                 putIOObj(io);
                 nixl_err = status;
@@ -341,7 +669,15 @@ nixl_status_t nixlHf3fsEngine::prepXfer (const nixl_xfer_op_t &operation,
             // TODO: Should the data copy in postXfer? User could still modify the data after
             // prepXfer
             if (!is_read) {
-                memcpy(io->iov.base, addr, size);
+                size_t copied = 0;
+                for (int j = i; j <= last; j++) {
+                    memcpy((uint8_t *)io->iov.base + copied,
+                           (void *)(*mem_list)[j].addr,
+                           (*mem_list)[j].len);
+                    copied += (*mem_list)[j].len;
+                }
+                size = agg_size;
+                i = last;
             }
         }
         // Store original memory address for later use during READ operations
@@ -382,8 +718,29 @@ nixl_status_t nixlHf3fsEngine::postXfer (const nixl_xfer_op_t &operation,
     if (UINT_MAX - hf3fs_handle->num_ios < hf3fs_handle->io_list.size()) {
         HF3FS_LOG_RETURN(NIXL_ERR_NOT_ALLOWED, "Error: more than UINT_MAX ios");
     }
+
+    uint32_t submitted = 0;
+    // fd -> (end of the request stream, last chunk size); feeds the readahead
+    std::map<int, std::pair<size_t, size_t>> read_tail;
     for (auto it = hf3fs_handle->io_list.begin(); it != hf3fs_handle->io_list.end(); ++it) {
         nixlHf3fsIO* io = *it;
+
+        if (io->is_read) {
+            if (readahead->enabled()) {
+                auto &tail = read_tail[io->fd];
+                if (io->offset + io->size > tail.first) {
+                    tail.first = io->offset + io->size;
+                    tail.second = io->size;
+                }
+            }
+        } else {
+            readahead->invalidate(io->fd);
+        }
+
+        if (io->cached) {
+            continue;
+        }
+
         void *addr = (io->mem_type == NIXL_HF3FS_MEM_TYPE_DRAM) ? io->iov.base : io->addr;
 
         status = hf3fs_utils->prepIO(
@@ -391,23 +748,37 @@ nixl_status_t nixlHf3fsEngine::postXfer (const nixl_xfer_op_t &operation,
         if (status != NIXL_SUCCESS) {
             HF3FS_LOG_RETURN(status, "Error: Failed to prepare IO");
         }
+        submitted++;
     }
 
-    status = hf3fs_utils->postIOR(&hf3fs_handle->ior);
-    if (status != NIXL_SUCCESS) {
-        HF3FS_LOG_RETURN(status, "Error: Failed to post IOR");
-    }
+    if (submitted > 0) {
+        status = hf3fs_utils->postIOR(&hf3fs_handle->ior);
+        if (status != NIXL_SUCCESS) {
+            HF3FS_LOG_RETURN(status, "Error: Failed to post IOR");
+        }
 
-    // postXfer may be called multiple times, so we need to check if the thread is already running
-    if (hf3fs_handle->io_status.thread == nullptr) {
-        hf3fs_handle->io_status.thread = new std::thread(waitForIOsThread, hf3fs_handle,
-                                                         hf3fs_utils);
+        // postXfer may be called multiple times, so we need to check if the thread is already
+        // running
         if (hf3fs_handle->io_status.thread == nullptr) {
-            HF3FS_LOG_RETURN(NIXL_ERR_BACKEND, "Error: Failed to create io thread");
+            hf3fs_handle->io_status.thread = new std::thread(waitForIOsThread, hf3fs_handle,
+                                                             hf3fs_utils);
+            if (hf3fs_handle->io_status.thread == nullptr) {
+                HF3FS_LOG_RETURN(NIXL_ERR_BACKEND, "Error: Failed to create io thread");
+            }
         }
     }
 
-    hf3fs_handle->num_ios += hf3fs_handle->io_list.size();
+    hf3fs_handle->num_ios += submitted;
+
+    // Keep the fabric pipe full behind this request stream
+    for (const auto &tail : read_tail) {
+        readahead->issueFrom(tail.first, tail.second.first, tail.second.second);
+    }
+
+    // Everything was served from the readahead cache
+    if (submitted == 0 && hf3fs_handle->completed_ios >= hf3fs_handle->num_ios) {
+        return NIXL_SUCCESS;
+    }
 
     return NIXL_IN_PROG;
 }
@@ -483,6 +854,10 @@ nixl_status_t nixlHf3fsEngine::checkXfer(nixlBackendReqH* handle) const
     }
 
     if (hf3fs_handle->io_status.thread == nullptr) {
+        // Every IO in this request was served from the readahead cache
+        if (hf3fs_handle->completed_ios >= hf3fs_handle->num_ios) {
+            return NIXL_SUCCESS;
+        }
         HF3FS_LOG_RETURN(NIXL_ERR_INVALID_PARAM,
             "Error: io thread is not initialized in checkXfer");
     }
@@ -515,6 +890,13 @@ nixl_status_t nixlHf3fsEngine::releaseReqH(nixlBackendReqH* handle) const
 
 nixlHf3fsEngine::~nixlHf3fsEngine() {
     destroyIOPool();
+    delete readahead;
+    if (iov_arena) {
+        NIXL_DEBUG << "HF3FS: iov arena high watermark " << iov_arena->highWatermark()
+                   << " low free watermark " << iov_arena->lowWatermark() << " throttled acquires "
+                   << iov_arena->throttledAcquires();
+        delete iov_arena;
+    }
     hf3fs_utils->closeHf3fsDriver();
     delete hf3fs_utils;
 }
@@ -23,7 +23,9 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include "common/uuid_v4.h"
+#include <condition_variable>
 #include <list>
+#include <mutex>
 #include <unordered_set>
 #include <thread>
 #include "hf3fs_utils.h"
@@ -86,10 +88,88 @@ class nixlHf3fsIO {
         bool is_read = false; // Whether this is a read operation
         size_t offset;    // Offset in the file
         nixl_hf3fs_mem_type mem_type;
+        bool cached = false; // Served from the readahead cache, nothing to submit
 
         nixlHf3fsIO() = default;
 };
 
+// Shared budget of USRBIO iov slots. Request-path allocations go through
+// acquire(), which queues (bounded wait) when the arena is exhausted and
+// is woken as slots are released, instead of letting createIOV fail into
+// a retry storm. Speculative users take tryAcquire() and simply back off.
+// High/low watermarks and the throttle count are kept for diagnostics.
+class hf3fsIovArena {
+    public:
+        hf3fsIovArena(unsigned int slots);
+
+        // Blocks while the arena is exhausted; after a grace period the
+        // slot is taken anyway (free may go negative), so one request
+        // larger than the whole arena cannot deadlock against itself
+        void acquire();
+        // Non-blocking variant for speculative allocations
+        bool tryAcquire();
+        void release();
+
+        unsigned int highWatermark() const;
+        long lowWatermark() const;
+        uint64_t throttledAcquires() const;
+
+    private:
+        void takeLocked();
+
+        mutable std::mutex lock_;
+        std::condition_variable cv_;
+        long free_;
+        unsigned int total_;
+        unsigned int peak_used_ = 0;
+        long min_free_;
+        uint64_t throttled_ = 0;
+};
+
+// Optional readahead stage: after each sequential READ the engine
+// speculatively fetches the next slabs of the file into dedicated IOVs on
+// a private IOR, and later requests that hit a completed slab are served
+// straight from memory without touching the fabric. Slabs are one-shot -
+// a hit consumes the slab - and writes to a file invalidate its slabs.
+class nixlHf3fsReadahead {
+    public:
+        nixlHf3fsReadahead(hf3fsUtil *utils, unsigned int window, hf3fsIovArena *arena);
+        ~nixlHf3fsReadahead();
+
+        bool enabled() const { return window_ > 0; }
+        // Speculatively read window slabs of slab_size starting at next_offset
+        void issueFrom(int fd, size_t next_offset, size_t slab_size);
+        // Copy [offset, offset + size) of fd to dst if a completed slab covers it
+        bool tryServe(int fd, size_t offset, size_t size, void *dst);
+        // Drop cached slabs of fd after it has been written to
+        void invalidate(int fd);
+
+    private:
+        class slab {
+            public:
+                hf3fs_iov iov;
+                int fd = -1;
+                size_t offset = 0;
+                size_t size = 0;
+                bool ready = false;
+                bool stale = false;
+        };
+
+        void reapCompletions();
+        void dropSlab(slab *s);
+        bool evictIdle();
+        slab *findSlab(int fd, size_t offset) const;
+
+        hf3fsUtil *utils_;
+        unsigned int window_;
+        hf3fsIovArena *arena_;
+        hf3fs_ior ior_;
+        bool ior_ok_ = false;
+        mutable std::mutex lock_;
+        std::list<slab *> slabs_; // oldest first
+        unsigned int inflight_ = 0;
+};
+
 class nixlH3fsThreadStatus {
     public:
         std::thread *thread = nullptr;
@@ -115,6 +195,8 @@ class nixlHf3fsBackendReqH : public nixlBackendReqH {
 class nixlHf3fsEngine : public nixlBackendEngine {
     private:
         hf3fsUtil *hf3fs_utils;
+        hf3fsIovArena *iov_arena;
+        nixlHf3fsReadahead *readahead;
         std::unordered_set<int> hf3fs_file_set;
         nixl_hf3fs_mem_config mem_config;
         static long page_size;
@@ -134,6 +216,12 @@ class nixlHf3fsEngine : public nixlBackendEngine {
         void
         putIOObj(nixlHf3fsIO *io) const;
 
+        // createIOV/destroyIOV with iov arena admission
+        nixl_status_t
+        createIOVThrottled(struct hf3fs_iov *iov, size_t size, size_t block_size) const;
+        void
+        destroyIOVThrottled(struct hf3fs_iov *iov) const;
+
         void cleanupIOList(nixlHf3fsBackendReqH *handle) const;
         void cleanupIOThread(nixlHf3fsBackendReqH *handle) const;
         static void waitForIOsThread(void* handle, void *utils);
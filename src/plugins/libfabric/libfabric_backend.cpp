@@ -19,6 +19,8 @@
 #include "libfabric_backend.h"
 #include "serdes/serdes.h"
 #include "common/nixl_log.h"
+#include "common/nixl_affinity.h"
+#include "common/nixl_gpu_addr_cache.h"
 
 #include <limits>
 #include <cstring>
@@ -57,10 +59,22 @@
 #ifdef HAVE_CUDA
 static int
 cudaQueryAddr(void *address, bool &is_dev, CUdevice &dev, CUcontext &ctx) {
+    // Consult the process-wide VA-range cache first; registrations with
+    // many descriptors per allocation then query the driver only once
+    nixlGpuAddrAttrs cached;
+    if (nixlGpuAddrCache::instance().lookup(address, cached)) {
+        is_dev = cached.isDev;
+        dev = (CUdevice)cached.dev;
+        ctx = (CUcontext)cached.ctx;
+        return 0;
+    }
+
     CUmemorytype mem_type = CU_MEMORYTYPE_HOST;
     uint32_t is_managed = 0;
-    CUpointer_attribute attr_type[4];
-    void *attr_data[4];
+    CUdeviceptr range_base = 0;
+    size_t range_size = 0;
+    CUpointer_attribute attr_type[6];
+    void *attr_data[6];
     CUresult result;
 
     attr_type[0] = CU_POINTER_ATTRIBUTE_MEMORY_TYPE;
@@ -71,10 +85,22 @@ cudaQueryAddr(void *address, bool &is_dev, CUdevice &dev, CUcontext &ctx) {
     attr_data[2] = &dev;
     attr_type[3] = CU_POINTER_ATTRIBUTE_CONTEXT;
     attr_data[3] = &ctx;
+    attr_type[4] = CU_POINTER_ATTRIBUTE_RANGE_START_ADDR;
+    attr_data[4] = &range_base;
+    attr_type[5] = CU_POINTER_ATTRIBUTE_RANGE_SIZE;
+    attr_data[5] = &range_size;
 
-    result = cuPointerGetAttributes(4, attr_type, attr_data, (CUdeviceptr)address);
+    result = cuPointerGetAttributes(6, attr_type, attr_data, (CUdeviceptr)address);
     is_dev = (mem_type == CU_MEMORYTYPE_DEVICE);
 
+    if ((CUDA_SUCCESS == result) && is_dev && range_base && range_size) {
+        nixlGpuAddrAttrs attrs;
+        attrs.isDev = is_dev;
+        attrs.dev = (int)dev;
+        attrs.ctx = (void *)ctx;
+        nixlGpuAddrCache::instance().insert((void *)range_base, range_size, attrs);
+    }
+
     return (CUDA_SUCCESS != result);
 }
 
@@ -223,11 +249,73 @@ nixlLibfabricBackendH::is_completed() const {
  * Constructor/Destructor
  *****************************************/
 
+// Parses the "rail_classes" init parameter ("class:rails[;class:rails]",
+// rails as comma-separated ids or a-b ranges) and registers each class
+// with the rail manager; malformed entries are skipped with a warning
+void
+nixlLibfabricEngine::parseRailClasses(const std::string &spec) {
+    size_t pos = 0;
+    while (pos < spec.size()) {
+        size_t end = spec.find(';', pos);
+        if (end == std::string::npos) {
+            end = spec.size();
+        }
+        std::string entry = spec.substr(pos, end - pos);
+        pos = end + 1;
+
+        size_t colon = entry.find(':');
+        if (colon == std::string::npos || colon == 0) {
+            NIXL_WARN << "Ignoring malformed rail class entry '" << entry << "'";
+            continue;
+        }
+
+        std::string name = entry.substr(0, colon);
+        std::vector<size_t> rails;
+        bool valid = true;
+        size_t rpos = colon + 1;
+        while (rpos <= entry.size()) {
+            size_t rend = entry.find(',', rpos);
+            if (rend == std::string::npos) {
+                rend = entry.size();
+            }
+            std::string token = entry.substr(rpos, rend - rpos);
+            rpos = rend + 1;
+            if (token.empty()) {
+                valid = false;
+                break;
+            }
+            try {
+                size_t dash = token.find('-');
+                if (dash != std::string::npos) {
+                    size_t first = std::stoull(token.substr(0, dash));
+                    size_t last = std::stoull(token.substr(dash + 1));
+                    for (size_t rail_id = first; valid && rail_id <= last; ++rail_id) {
+                        rails.push_back(rail_id);
+                    }
+                    valid = valid && (first <= last);
+                } else {
+                    rails.push_back(std::stoull(token));
+                }
+            }
+            catch (const std::exception &) {
+                valid = false;
+                break;
+            }
+        }
+
+        if (!valid || rails.empty() ||
+            rail_manager.setRailClass(name, rails) != NIXL_SUCCESS) {
+            NIXL_WARN << "Ignoring invalid rail class entry '" << entry << "'";
+        }
+    }
+}
+
 nixlLibfabricEngine::nixlLibfabricEngine(const nixlBackendInitParams *init_params)
     : nixlBackendEngine(init_params),
       cm_thread_stop_(false),
       progress_thread_enabled_(init_params->enableProgTh),
       progress_thread_delay_(std::chrono::microseconds(init_params->pthrDelay)),
+      progress_cpuset_(init_params->progressCpuset),
       rail_manager(NIXL_LIBFABRIC_DEFAULT_STRIPING_THRESHOLD) {
 
     NIXL_DEBUG << "Initializing Libfabric Backend with GPU Support";
@@ -262,11 +350,24 @@ nixlLibfabricEngine::nixlLibfabricEngine(const nixlBackendInitParams *init_param
         NIXL_DEBUG << "Using default striping threshold: " << striping_threshold_ << " bytes";
     }
 
+    // QoS rail partitioning: "class:rails[;class:rails]" where rails is a
+    // comma list of data rail ids or a-b ranges, e.g. "checkpoint:0,1;bulk:2-7".
+    // Transfers posted with a matching trafficClass stay on their subset.
+    std::string rail_classes_str;
+    if (getInitParam("rail_classes", rail_classes_str) == NIXL_SUCCESS) {
+        parseRailClasses(rail_classes_str);
+    }
+
     // Initialize Rail Manager which will discover the topology and create all rails.
     try {
         NIXL_DEBUG << "Rail Manager created with " << rail_manager.getNumDataRails()
                    << " data rails and " << rail_manager.getNumControlRails() << " control rails";
 
+        // Charge the request pools against the engine's internal-memory
+        // budget; with an "internal_mem_cap" init param set, pool expansion
+        // beyond the cap fails gracefully instead of growing unbounded
+        rail_manager.setMemBudget(&internalMemBudget_);
+
         // Set up callbacks on each rail using Engine's static callback functions
         size_t control_rail_id = 0;
         NIXL_DEBUG << "Set notification processor for control rail 0";
@@ -306,6 +407,24 @@ nixlLibfabricEngine::nixlLibfabricEngine(const nixlBackendInitParams *init_param
             NIXL_DEBUG << "Set XFER_ID callback for data rail " << data_rail_id;
         }
 
+        // CQ errors carry the native provider errno into telemetry tagged
+        // with the failing rail, so a flapping NIC localizes from the
+        // per-backend error histogram instead of fleet-wide log greps
+        for (size_t data_rail_id = 0; data_rail_id < rail_manager.getNumDataRails();
+             ++data_rail_id) {
+            rail_manager.getDataRail(data_rail_id)
+                .setErrorCallback([this, data_rail_id](int native_err) {
+                    addErrorTelemetry(native_err, "rail" + std::to_string(data_rail_id));
+                });
+        }
+        for (size_t ctrl_rail_id = 0; ctrl_rail_id < rail_manager.getNumControlRails();
+             ++ctrl_rail_id) {
+            rail_manager.getControlRail(ctrl_rail_id)
+                .setErrorCallback([this, ctrl_rail_id](int native_err) {
+                    addErrorTelemetry(native_err, "crail" + std::to_string(ctrl_rail_id));
+                });
+        }
+
         // Create self-connection
         std::vector<std::array<char, LF_EP_NAME_MAX_LEN>> data_endpoints(
             rail_manager.getNumDataRails());
@@ -735,6 +854,22 @@ nixlLibfabricEngine::registerMem(const nixlBlobDesc &mem,
     priv->gpu_device_id_ = mem.devId; // Store GPU device ID
 
 #ifdef HAVE_CUDA
+    // Staged-copy pipeline: when the provider cannot register device memory
+    // (no FI_HMEM), stream VRAM through pinned bounce buffers at transfer
+    // time instead of failing the whole registration.
+    if (nixl_mem == VRAM_SEG && !rail_manager.supportsHmem()) {
+        nixl_status_t status = initStagingBuffers(priv.get(), mem.devId);
+        if (status != NIXL_SUCCESS) {
+            NIXL_ERROR << "Failed to set up staged-copy pipeline for GPU " << mem.devId;
+            return status;
+        }
+        NIXL_INFO << "Provider lacks FI_HMEM: GPU " << mem.devId
+                  << " memory will be streamed through pinned staging buffers"
+                  << " (local-initiated transfers only)";
+        out = priv.release();
+        return NIXL_SUCCESS;
+    }
+
     // Handle CUDA memory registration with GPU Direct RDMA support
     if (nixl_mem == VRAM_SEG) {
         // For multi-GPU support, skip CUDA address workaround
@@ -784,7 +919,9 @@ nixlLibfabricEngine::registerMem(const nixlBlobDesc &mem,
                                                        mem.devId,
                                                        priv->rail_mr_list_,
                                                        priv->rail_key_list_,
-                                                       priv->selected_rails_);
+                                                       priv->selected_rails_,
+                                                       mem.dmabufFd,
+                                                       mem.dmabufOffset);
     if (status != NIXL_SUCCESS) {
         NIXL_ERROR << "Rail Manager registerMemory failed";
         return status;
@@ -804,6 +941,13 @@ nixlLibfabricEngine::registerMem(const nixlBlobDesc &mem,
 nixl_status_t
 nixlLibfabricEngine::deregisterMem(nixlBackendMD *meta) {
     auto *priv = static_cast<nixlLibfabricPrivateMetadata *>(meta);
+#ifdef HAVE_CUDA
+    if (priv->staged_) {
+        releaseStagingBuffers(priv);
+        delete priv;
+        return NIXL_SUCCESS;
+    }
+#endif
     // Use Rail Manager for centralized memory deregistration
     nixl_status_t status =
         rail_manager.deregisterMemory(priv->selected_rails_, priv->rail_mr_list_);
@@ -816,6 +960,242 @@ nixlLibfabricEngine::deregisterMem(nixlBackendMD *meta) {
     return status;
 }
 
+#ifdef HAVE_CUDA
+nixl_status_t
+nixlLibfabricEngine::initStagingBuffers(nixlLibfabricPrivateMetadata *priv, int gpu_id) {
+    cudaError_t cuda_ret = cudaSetDevice(gpu_id);
+    if (cuda_ret != cudaSuccess) {
+        NIXL_ERROR << "Failed to set CUDA device " << gpu_id << ": "
+                   << cudaGetErrorString(cuda_ret);
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    for (int i = 0; i < NIXL_LIBFABRIC_STAGING_NUM_BUFS; ++i) {
+        cuda_ret = cudaHostAlloc(
+            &priv->staging_buf_[i], NIXL_LIBFABRIC_STAGING_BUF_SIZE, cudaHostAllocPortable);
+        if (cuda_ret != cudaSuccess) {
+            NIXL_ERROR << "Failed to allocate pinned staging buffer " << i << ": "
+                       << cudaGetErrorString(cuda_ret);
+            releaseStagingBuffers(priv);
+            return NIXL_ERR_BACKEND;
+        }
+
+        // Staging buffers are host memory: register as DRAM on all rails
+        priv->staging_mr_list_[i].resize(rail_manager.getNumDataRails(), nullptr);
+        priv->staging_key_list_[i].resize(rail_manager.getNumDataRails(), 0);
+        nixl_status_t status = rail_manager.registerMemory(priv->staging_buf_[i],
+                                                           NIXL_LIBFABRIC_STAGING_BUF_SIZE,
+                                                           DRAM_SEG,
+                                                           0,
+                                                           priv->staging_mr_list_[i],
+                                                           priv->staging_key_list_[i],
+                                                           priv->staging_rails_[i]);
+        if (status != NIXL_SUCCESS) {
+            NIXL_ERROR << "Failed to register staging buffer " << i << " with rails";
+            releaseStagingBuffers(priv);
+            return status;
+        }
+    }
+
+    cuda_ret = cudaStreamCreateWithFlags(&priv->staging_stream_, cudaStreamNonBlocking);
+    if (cuda_ret != cudaSuccess) {
+        NIXL_ERROR << "Failed to create staging stream: " << cudaGetErrorString(cuda_ret);
+        releaseStagingBuffers(priv);
+        return NIXL_ERR_BACKEND;
+    }
+
+    priv->staged_ = true;
+    NIXL_DEBUG << "Staged-copy pipeline ready for GPU " << gpu_id << ": "
+               << NIXL_LIBFABRIC_STAGING_NUM_BUFS << " pinned buffers of "
+               << NIXL_LIBFABRIC_STAGING_BUF_SIZE << " bytes";
+    return NIXL_SUCCESS;
+}
+
+void
+nixlLibfabricEngine::releaseStagingBuffers(nixlLibfabricPrivateMetadata *priv) {
+    for (int i = 0; i < NIXL_LIBFABRIC_STAGING_NUM_BUFS; ++i) {
+        if (!priv->staging_rails_[i].empty()) {
+            rail_manager.deregisterMemory(priv->staging_rails_[i], priv->staging_mr_list_[i]);
+            priv->staging_rails_[i].clear();
+        }
+        if (priv->staging_buf_[i]) {
+            cudaFreeHost(priv->staging_buf_[i]);
+            priv->staging_buf_[i] = nullptr;
+        }
+    }
+    if (priv->staging_stream_) {
+        cudaStreamDestroy(priv->staging_stream_);
+        priv->staging_stream_ = nullptr;
+    }
+    priv->staged_ = false;
+}
+
+void
+nixlLibfabricEngine::waitStagingSlot(const std::atomic<bool> &busy) const {
+    while (busy.load(std::memory_order_acquire)) {
+        if (!progress_thread_enabled_) {
+            rail_manager.progressActiveDataRails();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+nixl_status_t
+nixlLibfabricEngine::stagedSubmitDescriptor(const nixl_xfer_op_t &operation,
+                                            nixlLibfabricPrivateMetadata *local_md,
+                                            void *vram_addr,
+                                            size_t transfer_size,
+                                            uint64_t remote_base_addr,
+                                            nixlLibfabricPublicMetadata *remote_md,
+                                            const std::shared_ptr<nixlLibfabricConnection> &conn,
+                                            nixlLibfabricBackendH *backend_handle) const {
+    cudaError_t cuda_ret = cudaSetDevice(local_md->gpu_device_id_);
+    if (cuda_ret != cudaSuccess) {
+        NIXL_ERROR << "Failed to set CUDA device " << local_md->gpu_device_id_ << ": "
+                   << cudaGetErrorString(cuda_ret);
+        return NIXL_ERR_BACKEND;
+    }
+
+    const size_t chunk_size = NIXL_LIBFABRIC_STAGING_BUF_SIZE;
+    const size_t num_chunks = (transfer_size + chunk_size - 1) / chunk_size;
+    cudaStream_t stream = local_md->staging_stream_;
+
+    // Tracks outstanding network operations per staging slot. Stack-scoped,
+    // so both slots are drained before returning.
+    std::atomic<bool> slot_busy[NIXL_LIBFABRIC_STAGING_NUM_BUFS] = {};
+
+    auto submit_chunk = [&](size_t slot, size_t offset, size_t size) -> nixl_status_t {
+        slot_busy[slot].store(true, std::memory_order_release);
+        std::atomic<bool> *busy_flag = &slot_busy[slot];
+        return rail_manager.prepareAndSubmitTransfer(
+            (operation == NIXL_WRITE) ? nixlLibfabricReq::WRITE : nixlLibfabricReq::READ,
+            local_md->staging_buf_[slot],
+            size,
+            remote_base_addr + offset,
+            local_md->staging_rails_[slot],
+            local_md->staging_mr_list_[slot],
+            remote_md->rail_remote_key_list_,
+            remote_md->remote_selected_endpoints_,
+            conn->rail_remote_addr_list_,
+            conn->agent_index_,
+            [backend_handle, busy_flag]() {
+                busy_flag->store(false, std::memory_order_release);
+                backend_handle->increment_completed_requests();
+            },
+            &(backend_handle->binary_notif));
+    };
+
+    NIXL_DEBUG << "Staged " << (operation == NIXL_WRITE ? "WRITE" : "READ") << " of "
+               << transfer_size << " bytes in " << num_chunks << " chunks";
+
+    if (operation == NIXL_WRITE) {
+        // D2H copy of chunk k overlaps the fi_write of chunk k-1
+        for (size_t k = 0; k < num_chunks; ++k) {
+            size_t slot = k % NIXL_LIBFABRIC_STAGING_NUM_BUFS;
+            size_t offset = k * chunk_size;
+            size_t size = std::min(chunk_size, transfer_size - offset);
+
+            // Wait until the write that last used this slot has completed
+            waitStagingSlot(slot_busy[slot]);
+
+            cuda_ret = cudaMemcpyAsync(local_md->staging_buf_[slot],
+                                       (char *)vram_addr + offset,
+                                       size,
+                                       cudaMemcpyDeviceToHost,
+                                       stream);
+            if (cuda_ret == cudaSuccess) {
+                cuda_ret = cudaStreamSynchronize(stream);
+            }
+            if (cuda_ret != cudaSuccess) {
+                NIXL_ERROR << "Staging D2H copy failed: " << cudaGetErrorString(cuda_ret);
+                waitStagingSlot(slot_busy[0]);
+                waitStagingSlot(slot_busy[1]);
+                return NIXL_ERR_BACKEND;
+            }
+
+            nixl_status_t status = submit_chunk(slot, offset, size);
+            if (status != NIXL_SUCCESS) {
+                slot_busy[slot].store(false, std::memory_order_release);
+                waitStagingSlot(slot_busy[0]);
+                waitStagingSlot(slot_busy[1]);
+                return status;
+            }
+        }
+    } else {
+        // Network read of chunk k overlaps the H2D copy of chunk k-1
+        for (size_t k = 0; k < num_chunks; ++k) {
+            size_t slot = k % NIXL_LIBFABRIC_STAGING_NUM_BUFS;
+            size_t offset = k * chunk_size;
+            size_t size = std::min(chunk_size, transfer_size - offset);
+
+            // Reclaim the slot: chunk k-2's read completed before its copy was
+            // issued, so syncing the stream makes the buffer reusable
+            if (k >= NIXL_LIBFABRIC_STAGING_NUM_BUFS) {
+                cuda_ret = cudaStreamSynchronize(stream);
+                if (cuda_ret != cudaSuccess) {
+                    NIXL_ERROR << "Staging H2D copy failed: " << cudaGetErrorString(cuda_ret);
+                    waitStagingSlot(slot_busy[0]);
+                    waitStagingSlot(slot_busy[1]);
+                    return NIXL_ERR_BACKEND;
+                }
+            }
+
+            nixl_status_t status = submit_chunk(slot, offset, size);
+            if (status != NIXL_SUCCESS) {
+                slot_busy[slot].store(false, std::memory_order_release);
+                waitStagingSlot(slot_busy[0]);
+                waitStagingSlot(slot_busy[1]);
+                return status;
+            }
+
+            if (k >= 1) {
+                size_t prev = (k - 1) % NIXL_LIBFABRIC_STAGING_NUM_BUFS;
+                size_t prev_offset = (k - 1) * chunk_size;
+                size_t prev_size = std::min(chunk_size, transfer_size - prev_offset);
+                waitStagingSlot(slot_busy[prev]);
+                cuda_ret = cudaMemcpyAsync((char *)vram_addr + prev_offset,
+                                           local_md->staging_buf_[prev],
+                                           prev_size,
+                                           cudaMemcpyHostToDevice,
+                                           stream);
+                if (cuda_ret != cudaSuccess) {
+                    NIXL_ERROR << "Staging H2D copy failed: " << cudaGetErrorString(cuda_ret);
+                    waitStagingSlot(slot_busy[0]);
+                    waitStagingSlot(slot_busy[1]);
+                    return NIXL_ERR_BACKEND;
+                }
+            }
+        }
+
+        // Tail: copy the last chunk out and drain the stream
+        size_t last = num_chunks - 1;
+        size_t last_slot = last % NIXL_LIBFABRIC_STAGING_NUM_BUFS;
+        size_t last_offset = last * chunk_size;
+        size_t last_size = std::min(chunk_size, transfer_size - last_offset);
+        waitStagingSlot(slot_busy[last_slot]);
+        cuda_ret = cudaMemcpyAsync((char *)vram_addr + last_offset,
+                                   local_md->staging_buf_[last_slot],
+                                   last_size,
+                                   cudaMemcpyHostToDevice,
+                                   stream);
+        if (cuda_ret == cudaSuccess) {
+            cuda_ret = cudaStreamSynchronize(stream);
+        }
+        if (cuda_ret != cudaSuccess) {
+            NIXL_ERROR << "Staging H2D copy failed: " << cudaGetErrorString(cuda_ret);
+            return NIXL_ERR_BACKEND;
+        }
+    }
+
+    // The slot flags are stack-scoped: drain all outstanding completions so
+    // no callback touches them after this frame unwinds
+    waitStagingSlot(slot_busy[0]);
+    waitStagingSlot(slot_busy[1]);
+    return NIXL_SUCCESS;
+}
+#endif // HAVE_CUDA
+
 nixl_status_t
 nixlLibfabricEngine::getPublicData(const nixlBackendMD *meta, std::string &str) const {
     const nixlLibfabricPrivateMetadata *priv =
@@ -934,6 +1314,7 @@ nixlLibfabricEngine::prepXfer(const nixl_xfer_op_t &operation,
         backend_handle->has_notif = true;
         backend_handle->binary_notif.setAgentName(localAgent);
         backend_handle->binary_notif.setMessage(opt_args->notifMsg);
+        backend_handle->binary_notif.setTraceCtx(opt_args->traceCtx);
         backend_handle->binary_notif.expected_completions = 0;
         NIXL_DEBUG << "Setting notification message: " << opt_args->notifMsg;
     }
@@ -1042,12 +1423,43 @@ nixlLibfabricEngine::postXfer(const nixl_xfer_op_t &operation,
         // Use descriptor's specific target address
         uint64_t remote_target_addr = remote[desc_idx].addr;
 
+#ifdef HAVE_CUDA
+        // Staged VRAM (provider without FI_HMEM): stream through the pinned
+        // bounce buffers instead of posting directly from device memory
+        if (local_md->staged_) {
+            nixl_status_t staged_status = stagedSubmitDescriptor(operation,
+                                                                 local_md,
+                                                                 transfer_addr,
+                                                                 transfer_size,
+                                                                 remote_target_addr,
+                                                                 remote_md,
+                                                                 conn_it->second,
+                                                                 backend_handle);
+            if (staged_status != NIXL_SUCCESS) {
+                NIXL_ERROR << "Staged transfer failed for descriptor " << desc_idx << " GPU "
+                           << gpu_id;
+                return staged_status;
+            }
+            continue;
+        }
+#endif
+
+        // QoS rail partitioning: a traffic class in the opt args restricts
+        // the transfer to the class's configured rail subset
+        std::vector<size_t> class_rails;
+        const std::vector<size_t> *xfer_rails = &local_md->selected_rails_;
+        if (opt_args && !opt_args->trafficClass.empty()) {
+            class_rails = rail_manager.filterRailsForClass(opt_args->trafficClass,
+                                                           local_md->selected_rails_);
+            xfer_rails = &class_rails;
+        }
+
         nixl_status_t status = rail_manager.prepareAndSubmitTransfer(
             op_type,
             transfer_addr,
             transfer_size,
             remote_target_addr,
-            local_md->selected_rails_,
+            *xfer_rails,
             local_md->rail_mr_list_,
             remote_md->rail_remote_key_list_,
             remote_md->remote_selected_endpoints_,
@@ -1252,6 +1664,16 @@ nixlLibfabricEngine::getNotifs(notif_list_t &notif_list) {
     return NIXL_IN_PROG;
 }
 
+nixl_status_t
+nixlLibfabricEngine::getNotifTraceCtxs(std::vector<nixl_blob_t> &traces) {
+    std::lock_guard<std::mutex> lock(notif_mutex_);
+    traces.insert(traces.end(),
+                  std::make_move_iterator(notifTraceList_.begin()),
+                  std::make_move_iterator(notifTraceList_.end()));
+    notifTraceList_.clear();
+    return NIXL_SUCCESS;
+}
+
 /****************************************
  * ConnectionManagement Thread Function
  *****************************************/
@@ -1287,6 +1709,7 @@ nixlLibfabricEngine::cmThread() {
 // Progress thread that continuously processes completions only on data rails
 nixl_status_t
 nixlLibfabricEngine::progressThread() {
+    nixlAffinity::applyToSelf(progress_cpuset_);
     NIXL_DEBUG << "PT: Thread started successfully for data rails only";
     // Main progress loop - continuously process completions only on data rails
     while (!progress_thread_stop_.load()) {
@@ -1373,6 +1796,14 @@ nixlLibfabricEngine::processNotification(const std::string &serialized_notif) {
     uint16_t xfer_id = binary_notif->xfer_id;
     uint32_t expected_completions = binary_notif->expected_completions;
 
+    // Surface the trace context on arrival; it is telemetry-only, so it
+    // does not wait for completion matching like the notification does
+    std::string trace_ctx = binary_notif->getTraceCtx();
+    if (!trace_ctx.empty()) {
+        std::lock_guard<std::mutex> lock(notif_mutex_);
+        notifTraceList_.push_back(std::move(trace_ctx));
+    }
+
     NIXL_TRACE << "Received notification from " << remote_name << " msg: " << msg
                << " XFER_ID=" << xfer_id << " expected_completions: " << expected_completions;
 
@@ -84,6 +84,17 @@ private:
     std::vector<char *> src_ep_names_; // Source endpoint names, one per rail
     std::vector<size_t> selected_rails_; // Rails selected based on memory topology
 
+#ifdef HAVE_CUDA
+    // Staged-copy pipeline state, used when the provider lacks FI_HMEM: VRAM
+    // is streamed through these pinned bounce buffers at transfer time
+    bool staged_ = false;
+    std::array<void *, NIXL_LIBFABRIC_STAGING_NUM_BUFS> staging_buf_ = {};
+    std::array<std::vector<struct fid_mr *>, NIXL_LIBFABRIC_STAGING_NUM_BUFS> staging_mr_list_;
+    std::array<std::vector<uint64_t>, NIXL_LIBFABRIC_STAGING_NUM_BUFS> staging_key_list_;
+    std::array<std::vector<size_t>, NIXL_LIBFABRIC_STAGING_NUM_BUFS> staging_rails_;
+    cudaStream_t staging_stream_ = nullptr;
+#endif
+
 public:
     nixlLibfabricPrivateMetadata() : nixlBackendMD(true), gpu_device_id_(-1) {}
     friend class nixlLibfabricEngine;
@@ -184,6 +195,9 @@ private:
     // Progress thread delay in microseconds
     std::chrono::microseconds progress_thread_delay_;
 
+    // CPU set the progress thread is pinned to; empty leaves it unpinned
+    std::string progress_cpuset_;
+
     // Rail Manager - Stack allocated for better performance (mutable for const methods)
     mutable nixlLibfabricRailManager rail_manager;
 
@@ -216,6 +230,9 @@ private:
     // Central notification storage
     std::mutex notif_mutex_;
     notif_list_t notifMainList_;
+    // Trace contexts received with notifications, drained by the agent
+    // for telemetry through getNotifTraceCtxs
+    std::vector<nixl_blob_t> notifTraceList_;
 
     // Receiver Side XFER_ID Tracking
     std::mutex receiver_tracking_mutex_;
@@ -291,6 +308,10 @@ private:
                        void *buffer,
                        std::shared_ptr<nixlLibfabricConnection> conn,
                        nixlBackendMD *&output);
+    // QoS rail partitioning: parse the "rail_classes" init parameter and
+    // register each traffic class with the rail manager
+    void
+    parseRailClasses(const std::string &spec);
 
 #ifdef HAVE_CUDA
     // CUDA context management methods
@@ -302,6 +323,24 @@ private:
     vramApplyCtx();
     void
     vramFiniCtx();
+
+    // Staged-copy pipeline for VRAM when the provider lacks FI_HMEM: pinned
+    // bounce buffers, double-buffered cudaMemcpyAsync overlapped with fi_write
+    nixl_status_t
+    initStagingBuffers(nixlLibfabricPrivateMetadata *priv, int gpu_id);
+    void
+    releaseStagingBuffers(nixlLibfabricPrivateMetadata *priv);
+    void
+    waitStagingSlot(const std::atomic<bool> &busy) const;
+    nixl_status_t
+    stagedSubmitDescriptor(const nixl_xfer_op_t &operation,
+                           nixlLibfabricPrivateMetadata *local_md,
+                           void *vram_addr,
+                           size_t transfer_size,
+                           uint64_t remote_base_addr,
+                           nixlLibfabricPublicMetadata *remote_md,
+                           const std::shared_ptr<nixlLibfabricConnection> &conn,
+                           nixlLibfabricBackendH *backend_handle) const;
 #endif
 
 public:
@@ -574,6 +613,18 @@ public:
     nixl_status_t
     genNotif(const std::string &remote_agent, const std::string &msg) const override;
 
+    /**
+     * @brief Drain trace contexts received with notifications
+     *
+     * Returns the trace contexts that arrived since the last call, in
+     * arrival order, for the agent to record in telemetry.
+     *
+     * @param[out] traces List the drained trace contexts are appended to
+     * @return NIXL_SUCCESS always
+     */
+    nixl_status_t
+    getNotifTraceCtxs(std::vector<nixl_blob_t> &traces) override;
+
     // Receiver Side XFER_ID Tracking Helper Methods
     /**
      * @brief Add received XFER_ID with counter-based matching
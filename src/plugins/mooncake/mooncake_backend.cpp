@@ -18,6 +18,8 @@
 #include "serdes/serdes.h"
 #include "common/nixl_log.h"
 
+#include <algorithm>
+
 #include <arpa/inet.h>
 #include <bits/stdint-uintn.h>
 #include <ifaddrs.h>
@@ -252,9 +254,13 @@ nixlMooncakeEngine::postXfer(const nixl_xfer_op_t &operation,
     }
     if (local.descCount() != remote.descCount()) return NIXL_ERR_INVALID_PARAM;
 
+    // The batch has a fixed capacity, so size it for the descriptor list
+    // being posted; large KV pulls would otherwise overflow the default
     const static size_t kMaxRequestCount = 1024;
+    size_t request_count = local.descCount();
     if (priv->batch_id == INVALID_BATCH) {
-        uint64_t batch_id = allocateBatchID(engine_, kMaxRequestCount);
+        uint64_t batch_id =
+            allocateBatchID(engine_, std::max(kMaxRequestCount, request_count));
         if (batch_id == INVALID_BATCH) {
             return NIXL_ERR_BACKEND;
         }
@@ -262,8 +268,7 @@ nixlMooncakeEngine::postXfer(const nixl_xfer_op_t &operation,
         priv->request_count = 0;
     }
 
-    size_t request_count = local.descCount();
-    transfer_request_t *request = new transfer_request_t[request_count];
+    std::vector<transfer_request_t> request(request_count);
     for (size_t index = 0; index < request_count; ++index) {
         if (local[index].len != remote[index].len) return NIXL_ERR_INVALID_PARAM;
         request[index].opcode = (operation == NIXL_READ) ? OPCODE_READ : OPCODE_WRITE;
@@ -277,11 +282,11 @@ nixlMooncakeEngine::postXfer(const nixl_xfer_op_t &operation,
         notify_msg_t notify_msg;
         notify_msg.name = const_cast<char *>(local_agent_name_.c_str());
         notify_msg.msg = const_cast<char *>(opt_args->notifMsg.c_str());
-        rc = submitTransferWithNotify(engine_, priv->batch_id, request, request_count, notify_msg);
+        rc = submitTransferWithNotify(
+            engine_, priv->batch_id, request.data(), request_count, notify_msg);
     } else {
-        rc = submitTransfer(engine_, priv->batch_id, request, request_count);
+        rc = submitTransfer(engine_, priv->batch_id, request.data(), request_count);
     }
-    delete[] request;
     if (rc) return NIXL_ERR_BACKEND;
     priv->request_count += request_count;
     return NIXL_IN_PROG;
@@ -290,15 +295,15 @@ nixlMooncakeEngine::postXfer(const nixl_xfer_op_t &operation,
 nixl_status_t
 nixlMooncakeEngine::checkXfer(nixlBackendReqH *handle) const {
     auto priv = (nixlMooncakeBackendReqH *)handle;
-    bool has_failed = false;
-    for (size_t index = 0; index < priv->request_count; ++index) {
-        transfer_status_t status;
-        int rc = getTransferStatus(engine_, priv->batch_id, index, &status);
-        if (rc || status.status == STATUS_FAILED)
-            has_failed = true;
-        else if (status.status == STATUS_PENDING || status.status == STATUS_WAITING)
-            return NIXL_IN_PROG;
-    }
+    // One aggregated poll over the whole batch: the engine folds the
+    // per-task states natively, so polling every task from here only adds
+    // request_count boundary crossings per check
+    transfer_status_t status;
+    int rc = getBatchTransferStatus(engine_, priv->batch_id, &status);
+    bool has_failed = (rc != 0) || (status.status == STATUS_FAILED);
+    if (!has_failed &&
+        (status.status == STATUS_PENDING || status.status == STATUS_WAITING))
+        return NIXL_IN_PROG;
     if (!has_failed) {
         // Each batch_id has the batch size, and cannot process more requests
         // than the batch size. So, free the batch id here to workaround the issue
@@ -0,0 +1,459 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nvlink_backend.h"
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <unistd.h>
+
+#include <absl/strings/str_format.h>
+#include "common/nixl_log.h"
+
+namespace {
+    // Request handle for NVLINK transfers. The post enqueues every
+    // descriptor copy on the direction stream and records this event
+    // behind them, so checkXfer is a single event query
+    struct nixlNvlinkBackendReqH : public nixlBackendReqH {
+        cudaEvent_t event = nullptr;
+        nixl_status_t status = NIXL_ERR_NOT_POSTED;
+    };
+
+    nixl_status_t cudaToNixl(cudaError_t err, const char* what) {
+        if (err == cudaSuccess) {
+            return NIXL_SUCCESS;
+        }
+        NIXL_ERROR << absl::StrFormat("%s failed: %s", what, cudaGetErrorString(err));
+        return NIXL_ERR_BACKEND;
+    }
+
+    nixl_status_t cuToNixl(CUresult err, const char* what) {
+        if (err == CUDA_SUCCESS) {
+            return NIXL_SUCCESS;
+        }
+        const char *msg = nullptr;
+        cuGetErrorString(err, &msg);
+        NIXL_ERROR << absl::StrFormat("%s failed: %s", what, msg ? msg : "unknown error");
+        return NIXL_ERR_BACKEND;
+    }
+}
+
+nixlNvlinkEngine::nixlNvlinkEngine(const nixlBackendInitParams *init_params)
+    : nixlBackendEngine(init_params) {
+    char hostname[HOST_NAME_MAX + 1] = {};
+    if (gethostname(hostname, HOST_NAME_MAX) != 0) {
+        NIXL_ERROR << absl::StrFormat("Failed to get hostname: %s", strerror(errno));
+        initErr = true;
+        return;
+    }
+    hostId_ = hostname;
+
+    if (cuToNixl(cuInit(0), "cuInit") != NIXL_SUCCESS) {
+        initErr = true;
+    }
+}
+
+nixlNvlinkEngine::~nixlNvlinkEngine() {
+    for (auto &stream : streams_) {
+        if (stream) {
+            cudaStreamDestroy(stream);
+        }
+    }
+}
+
+nixl_status_t nixlNvlinkEngine::getConnInfo(std::string &str) const {
+    str = absl::StrFormat("%s:%d", hostId_, getpid());
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlNvlinkEngine::loadRemoteConnInfo(const std::string &remote_agent,
+                                                   const std::string &remote_conn_info) {
+    auto sep = remote_conn_info.rfind(':');
+    if (sep == std::string::npos) {
+        NIXL_ERROR << absl::StrFormat("Malformed NVLINK conn info from agent %s", remote_agent);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    // NVLink/C2C peer mappings only exist within a host; refusing the
+    // conn info here makes the agent fall back to a network-capable
+    // backend for off-host peers
+    if (remote_conn_info.substr(0, sep) != hostId_) {
+        NIXL_INFO << absl::StrFormat("Agent %s is on host %s, not %s - NVLINK not applicable",
+                                     remote_agent, remote_conn_info.substr(0, sep), hostId_);
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    std::lock_guard<std::mutex> lock(lock_);
+    peers_[remote_agent] = true;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlNvlinkEngine::connect(const std::string &remote_agent) {
+    if (remote_agent == localAgent) {
+        return NIXL_SUCCESS;
+    }
+    std::lock_guard<std::mutex> lock(lock_);
+    return peers_.count(remote_agent) ? NIXL_SUCCESS : NIXL_ERR_NOT_FOUND;
+}
+
+nixl_status_t nixlNvlinkEngine::disconnect(const std::string &remote_agent) {
+    std::lock_guard<std::mutex> lock(lock_);
+    peers_.erase(remote_agent);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlNvlinkEngine::registerMem(const nixlBlobDesc &mem,
+                                            const nixl_mem_t &nixl_mem,
+                                            nixlBackendMD* &out) {
+    if (nixl_mem != VRAM_SEG) {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    auto md = std::make_unique<nixlNvlinkBackendMD>(false);
+    md->memType = nixl_mem;
+    md->addr = mem.addr;
+    md->len = mem.len;
+    md->devId = static_cast<int>(mem.devId);
+
+    // Export a shareable handle now so getPublicData has it available
+    // when the registration is shared with peers. Allocations that came
+    // from cuMemCreate export their VMM handle as a fabric handle, which
+    // stays importable over multi-node NVLink fabrics; anything else
+    // (plain cudaMalloc) falls back to legacy CUDA IPC.
+    CUmemGenericAllocationHandle alloc_handle;
+    CUresult ret = cuMemRetainAllocationHandle(&alloc_handle,
+                                               reinterpret_cast<void*>(mem.addr));
+    if (ret == CUDA_SUCCESS) {
+        ret = cuMemExportToShareableHandle(&md->fabricHandle, alloc_handle,
+                                           CU_MEM_HANDLE_TYPE_FABRIC, 0);
+        cuMemRelease(alloc_handle);
+        if (ret == CUDA_SUCCESS) {
+            md->kind = nixlNvlinkBackendMD::HANDLE_FABRIC;
+        }
+    }
+
+    if (md->kind == nixlNvlinkBackendMD::HANDLE_NONE) {
+        nixl_status_t status = cudaToNixl(
+            cudaIpcGetMemHandle(&md->ipcHandle, reinterpret_cast<void*>(mem.addr)),
+            "cudaIpcGetMemHandle");
+        if (status != NIXL_SUCCESS) {
+            return status;
+        }
+        md->kind = nixlNvlinkBackendMD::HANDLE_IPC;
+    }
+
+    out = md.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlNvlinkEngine::deregisterMem(nixlBackendMD* meta) {
+    delete static_cast<nixlNvlinkBackendMD*>(meta);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlNvlinkEngine::getPublicData(const nixlBackendMD* meta, std::string &str) const {
+    auto md = static_cast<const nixlNvlinkBackendMD*>(meta);
+
+    // Blob layout: kind byte, device ordinal, then the handle bytes of
+    // the matching kind
+    str.clear();
+    str.push_back(static_cast<char>(md->kind));
+    str.append(reinterpret_cast<const char*>(&md->devId), sizeof(md->devId));
+    if (md->kind == nixlNvlinkBackendMD::HANDLE_FABRIC) {
+        str.append(reinterpret_cast<const char*>(&md->fabricHandle), sizeof(md->fabricHandle));
+    } else {
+        str.append(reinterpret_cast<const char*>(&md->ipcHandle), sizeof(md->ipcHandle));
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlNvlinkEngine::loadLocalMD(nixlBackendMD* input, nixlBackendMD* &output) {
+    output = input;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlNvlinkEngine::importFabric(nixlNvlinkBackendMD *md) const {
+    nixl_status_t status = cuToNixl(
+        cuMemImportFromShareableHandle(&md->importedHandle, &md->fabricHandle,
+                                       CU_MEM_HANDLE_TYPE_FABRIC),
+        "cuMemImportFromShareableHandle");
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+
+    // Reserve a VA range of the registration's length rounded up to the
+    // allocation granularity, map the imported handle there, and grant
+    // this device read/write access
+    CUmemAllocationProp prop = {};
+    prop.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+    prop.requestedHandleTypes = CU_MEM_HANDLE_TYPE_FABRIC;
+    prop.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+    prop.location.id = md->devId;
+
+    size_t granularity = 0;
+    status = cuToNixl(
+        cuMemGetAllocationGranularity(&granularity, &prop, CU_MEM_ALLOC_GRANULARITY_MINIMUM),
+        "cuMemGetAllocationGranularity");
+    if (status != NIXL_SUCCESS) {
+        cuMemRelease(md->importedHandle);
+        md->importedHandle = 0;
+        return status;
+    }
+    md->mappedLen = ((md->len + granularity - 1) / granularity) * granularity;
+
+    CUdeviceptr base = 0;
+    status = cuToNixl(cuMemAddressReserve(&base, md->mappedLen, granularity, 0, 0),
+                      "cuMemAddressReserve");
+    if (status == NIXL_SUCCESS) {
+        status = cuToNixl(cuMemMap(base, md->mappedLen, 0, md->importedHandle, 0), "cuMemMap");
+    }
+    if (status == NIXL_SUCCESS) {
+        int dev = 0;
+        cudaGetDevice(&dev);
+        CUmemAccessDesc access = {};
+        access.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+        access.location.id = dev;
+        access.flags = CU_MEM_ACCESS_FLAGS_PROT_READWRITE;
+        status = cuToNixl(cuMemSetAccess(base, md->mappedLen, &access, 1), "cuMemSetAccess");
+    }
+
+    if (status != NIXL_SUCCESS) {
+        if (base) {
+            cuMemUnmap(base, md->mappedLen);
+            cuMemAddressFree(base, md->mappedLen);
+        }
+        cuMemRelease(md->importedHandle);
+        md->importedHandle = 0;
+        return status;
+    }
+
+    md->mappedBase = reinterpret_cast<void*>(base);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlNvlinkEngine::loadRemoteMD(const nixlBlobDesc &input,
+                                             const nixl_mem_t &nixl_mem,
+                                             const std::string &remote_agent,
+                                             nixlBackendMD* &output) {
+    if (nixl_mem != VRAM_SEG) {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    bool is_self = (remote_agent == localAgent);
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (!is_self && peers_.count(remote_agent) == 0) {
+            return NIXL_ERR_NOT_FOUND;
+        }
+    }
+
+    auto md = std::make_unique<nixlNvlinkBackendMD>(true);
+    md->memType = nixl_mem;
+    md->addr = input.addr;
+    md->len = input.len;
+
+    constexpr size_t hdr_size = 1 + sizeof(md->devId);
+    if (input.metaInfo.size() < hdr_size) {
+        NIXL_ERROR << absl::StrFormat("Bad NVLINK public data size from agent %s: %zu",
+                                      remote_agent, input.metaInfo.size());
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    md->kind = static_cast<nixlNvlinkBackendMD::handle_kind_t>(input.metaInfo[0]);
+    memcpy(&md->devId, input.metaInfo.data() + 1, sizeof(md->devId));
+    const char *handle_data = input.metaInfo.data() + hdr_size;
+    size_t handle_size = input.metaInfo.size() - hdr_size;
+
+    // Self transfers use the registered address directly, no import needed
+    if (is_self) {
+        output = md.release();
+        return NIXL_SUCCESS;
+    }
+
+    switch (md->kind) {
+        case nixlNvlinkBackendMD::HANDLE_FABRIC: {
+            if (handle_size != sizeof(md->fabricHandle)) {
+                NIXL_ERROR << absl::StrFormat("Bad fabric handle size from agent %s: %zu",
+                                              remote_agent, handle_size);
+                return NIXL_ERR_INVALID_PARAM;
+            }
+            memcpy(&md->fabricHandle, handle_data, sizeof(md->fabricHandle));
+            nixl_status_t status = importFabric(md.get());
+            if (status != NIXL_SUCCESS) {
+                return status;
+            }
+            break;
+        }
+        case nixlNvlinkBackendMD::HANDLE_IPC: {
+            if (handle_size != sizeof(md->ipcHandle)) {
+                NIXL_ERROR << absl::StrFormat("Bad CUDA IPC handle size from agent %s: %zu",
+                                              remote_agent, handle_size);
+                return NIXL_ERR_INVALID_PARAM;
+            }
+            memcpy(&md->ipcHandle, handle_data, sizeof(md->ipcHandle));
+            nixl_status_t status = cudaToNixl(
+                cudaIpcOpenMemHandle(&md->mappedBase, md->ipcHandle,
+                                     cudaIpcMemLazyEnablePeerAccess),
+                "cudaIpcOpenMemHandle");
+            if (status != NIXL_SUCCESS) {
+                return status;
+            }
+            break;
+        }
+        default:
+            NIXL_ERROR << absl::StrFormat("Unknown NVLINK handle kind %d from agent %s",
+                                          md->kind, remote_agent);
+            return NIXL_ERR_INVALID_PARAM;
+    }
+
+    output = md.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlNvlinkEngine::unloadMD(nixlBackendMD* input) {
+    auto md = static_cast<nixlNvlinkBackendMD*>(input);
+    if (md->mappedBase) {
+        if (md->kind == nixlNvlinkBackendMD::HANDLE_FABRIC) {
+            auto base = reinterpret_cast<CUdeviceptr>(md->mappedBase);
+            cuMemUnmap(base, md->mappedLen);
+            cuMemAddressFree(base, md->mappedLen);
+            cuMemRelease(md->importedHandle);
+        } else {
+            cudaIpcCloseMemHandle(md->mappedBase);
+        }
+    }
+    delete md;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlNvlinkEngine::getStream(const nixl_xfer_op_t &operation,
+                                          cudaStream_t &stream) const {
+    std::lock_guard<std::mutex> lock(lock_);
+    cudaStream_t &slot = streams_[(operation == NIXL_READ) ? 1 : 0];
+    if (!slot) {
+        nixl_status_t status = cudaToNixl(
+            cudaStreamCreateWithFlags(&slot, cudaStreamNonBlocking),
+            "cudaStreamCreateWithFlags");
+        if (status != NIXL_SUCCESS) {
+            return status;
+        }
+    }
+    stream = slot;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlNvlinkEngine::prepXfer(const nixl_xfer_op_t &operation,
+                                         const nixl_meta_dlist_t &local,
+                                         const nixl_meta_dlist_t &remote,
+                                         const std::string &remote_agent,
+                                         nixlBackendReqH* &handle,
+                                         const nixl_opt_b_args_t* opt_args) const {
+    if (local.descCount() != remote.descCount() || local.descCount() == 0) {
+        NIXL_ERROR << absl::StrFormat("Mismatch in descriptor counts - local: %d, remote: %d",
+                                      local.descCount(), remote.descCount());
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    auto req = std::make_unique<nixlNvlinkBackendReqH>();
+    nixl_status_t status = cudaToNixl(
+        cudaEventCreateWithFlags(&req->event, cudaEventDisableTiming),
+        "cudaEventCreateWithFlags");
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+
+    handle = req.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlNvlinkEngine::postXfer(const nixl_xfer_op_t &operation,
+                                         const nixl_meta_dlist_t &local,
+                                         const nixl_meta_dlist_t &remote,
+                                         const std::string &remote_agent,
+                                         nixlBackendReqH* &handle,
+                                         const nixl_opt_b_args_t* opt_args) const {
+    auto req = static_cast<nixlNvlinkBackendReqH*>(handle);
+
+    cudaStream_t stream;
+    nixl_status_t status = getStream(operation, stream);
+    if (status != NIXL_SUCCESS) {
+        req->status = status;
+        return status;
+    }
+
+    // Enqueue the whole descriptor batch back to back on the direction
+    // stream; the copies run over the NVLink/C2C peer mapping without
+    // further involvement from this thread
+    for (auto [local_it, remote_it] = std::make_pair(local.begin(), remote.begin());
+         local_it != local.end() && remote_it != remote.end();
+         ++local_it, ++remote_it) {
+        if (local_it->len != remote_it->len) {
+            req->status = NIXL_ERR_INVALID_PARAM;
+            return NIXL_ERR_INVALID_PARAM;
+        }
+        auto remote_md = static_cast<nixlNvlinkBackendMD*>(remote_it->metadataP);
+
+        // Translate the peer's device address into our mapping; for self
+        // transfers the address is directly usable
+        void *target = (remote_md && remote_md->mappedBase) ?
+            static_cast<char*>(remote_md->mappedBase) + (remote_it->addr - remote_md->addr) :
+            reinterpret_cast<void*>(remote_it->addr);
+        void *localp = reinterpret_cast<void*>(local_it->addr);
+
+        status = cudaToNixl(
+            (operation == NIXL_READ) ?
+                cudaMemcpyAsync(localp, target, local_it->len, cudaMemcpyDeviceToDevice, stream) :
+                cudaMemcpyAsync(target, localp, local_it->len, cudaMemcpyDeviceToDevice, stream),
+            "cudaMemcpyAsync");
+        if (status != NIXL_SUCCESS) {
+            req->status = status;
+            return status;
+        }
+    }
+
+    status = cudaToNixl(cudaEventRecord(req->event, stream), "cudaEventRecord");
+    if (status != NIXL_SUCCESS) {
+        req->status = status;
+        return status;
+    }
+
+    req->status = NIXL_IN_PROG;
+    return NIXL_IN_PROG;
+}
+
+nixl_status_t nixlNvlinkEngine::checkXfer(nixlBackendReqH* handle) const {
+    auto req = static_cast<nixlNvlinkBackendReqH*>(handle);
+    if (req->status != NIXL_IN_PROG) {
+        return req->status;
+    }
+
+    cudaError_t ret = cudaEventQuery(req->event);
+    if (ret == cudaErrorNotReady) {
+        return NIXL_IN_PROG;
+    }
+    req->status = cudaToNixl(ret, "cudaEventQuery");
+    return req->status;
+}
+
+nixl_status_t nixlNvlinkEngine::releaseReqH(nixlBackendReqH* handle) const {
+    auto req = static_cast<nixlNvlinkBackendReqH*>(handle);
+    if (req->event) {
+        cudaEventDestroy(req->event);
+    }
+    delete req;
+    return NIXL_SUCCESS;
+}
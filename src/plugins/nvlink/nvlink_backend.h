@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NVLINK_BACKEND_H
+#define NVLINK_BACKEND_H
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include "backend/backend_engine.h"
+#include "common/str_tools.h"
+
+// Metadata for NVLINK registrations. Local VRAM entries export a
+// shareable handle at registration time: a fabric VMM handle when the
+// allocation came from cuMemCreate with fabric support, legacy CUDA IPC
+// otherwise. Remote entries hold the local mapping of the peer's memory,
+// so target addresses translate into this process and every transfer is
+// a raw peer copy.
+class nixlNvlinkBackendMD : public nixlBackendMD {
+public:
+    // Export kind, tagged in the public blob so the importer picks the
+    // matching mapping path
+    enum handle_kind_t : uint8_t {
+        HANDLE_NONE = 0,
+        HANDLE_FABRIC = 1,
+        HANDLE_IPC = 2,
+    };
+
+    nixl_mem_t memType = VRAM_SEG;
+    uintptr_t addr = 0;
+    size_t len = 0;
+    int devId = 0;
+    handle_kind_t kind = HANDLE_NONE;
+    CUmemFabricHandle fabricHandle = {};
+    cudaIpcMemHandle_t ipcHandle = {};
+
+    // Remote-side mapping state; mappedBase stays null for self entries,
+    // whose addresses are directly usable
+    void *mappedBase = nullptr;
+    size_t mappedLen = 0;
+    CUmemGenericAllocationHandle importedHandle = 0; // fabric imports only
+
+    nixlNvlinkBackendMD(bool isPrivate) : nixlBackendMD(isPrivate) {}
+};
+
+// Dedicated intra-node GPU-to-GPU backend: peers on the same host export
+// their VRAM registrations as shareable VMM/IPC handles, the initiator
+// maps them once at MD load, and a post is a batch of cudaMemcpyAsync
+// peer copies on a per-direction stream closed by one event record. No
+// transport protocol sits on the data path, so NVLink/C2C moves at raw
+// link rate; off-host peers are rejected at loadRemoteConnInfo and fall
+// back to a network-capable backend.
+class nixlNvlinkEngine : public nixlBackendEngine {
+public:
+    nixlNvlinkEngine(const nixlBackendInitParams *init_params);
+    ~nixlNvlinkEngine();
+
+    bool supportsRemote() const override {
+        return true;
+    }
+
+    bool supportsLocal() const override {
+        return true;
+    }
+
+    bool supportsNotif() const override {
+        return false;
+    }
+
+    nixl_mem_list_t getSupportedMems() const override {
+        return {VRAM_SEG};
+    }
+
+    nixl_status_t getConnInfo(std::string &str) const override;
+    nixl_status_t loadRemoteConnInfo(const std::string &remote_agent,
+                                     const std::string &remote_conn_info) override;
+
+    nixl_status_t connect(const std::string &remote_agent) override;
+    nixl_status_t disconnect(const std::string &remote_agent) override;
+
+    nixl_status_t registerMem(const nixlBlobDesc &mem,
+                              const nixl_mem_t &nixl_mem,
+                              nixlBackendMD* &out) override;
+    nixl_status_t deregisterMem(nixlBackendMD* meta) override;
+
+    nixl_status_t getPublicData(const nixlBackendMD* meta, std::string &str) const override;
+    nixl_status_t loadLocalMD(nixlBackendMD* input, nixlBackendMD* &output) override;
+    nixl_status_t loadRemoteMD(const nixlBlobDesc &input,
+                               const nixl_mem_t &nixl_mem,
+                               const std::string &remote_agent,
+                               nixlBackendMD* &output) override;
+    nixl_status_t unloadMD(nixlBackendMD* input) override;
+
+    nixl_status_t prepXfer(const nixl_xfer_op_t &operation,
+                           const nixl_meta_dlist_t &local,
+                           const nixl_meta_dlist_t &remote,
+                           const std::string &remote_agent,
+                           nixlBackendReqH* &handle,
+                           const nixl_opt_b_args_t* opt_args=nullptr) const override;
+
+    nixl_status_t postXfer(const nixl_xfer_op_t &operation,
+                           const nixl_meta_dlist_t &local,
+                           const nixl_meta_dlist_t &remote,
+                           const std::string &remote_agent,
+                           nixlBackendReqH* &handle,
+                           const nixl_opt_b_args_t* opt_args=nullptr) const override;
+
+    nixl_status_t checkXfer(nixlBackendReqH* handle) const override;
+    nixl_status_t releaseReqH(nixlBackendReqH* handle) const override;
+
+private:
+    // Lazily created copy stream per transfer direction, so reads and
+    // writes do not serialize behind each other on one stream
+    nixl_status_t getStream(const nixl_xfer_op_t &operation, cudaStream_t &stream) const;
+
+    nixl_status_t importFabric(nixlNvlinkBackendMD *md) const;
+
+    // Identity advertised through conn info; peers on other hosts are
+    // rejected at loadRemoteConnInfo
+    std::string hostId_;
+
+    mutable std::mutex lock_;
+    mutable cudaStream_t streams_[2] = {nullptr, nullptr};
+    std::unordered_map<std::string, bool,
+                       std::hash<std::string>, strEqual> peers_;
+};
+
+#endif // NVLINK_BACKEND_H
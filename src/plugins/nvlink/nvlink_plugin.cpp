@@ -0,0 +1,40 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include "nvlink_backend.h"
+#include "backend/backend_plugin.h"
+
+// Plugin type alias for convenience
+using nvlink_plugin_t = nixlBackendPluginCreator<nixlNvlinkEngine>;
+
+static const nixl_mem_list_t nvlink_mems = {VRAM_SEG};
+
+#ifdef STATIC_PLUGIN_NVLINK
+nixlBackendPlugin *
+createStaticNVLINKPlugin() {
+    return nvlink_plugin_t::create(NIXL_PLUGIN_API_VERSION, "NVLINK", "0.1.0", {}, nvlink_mems);
+}
+#else
+extern "C" NIXL_PLUGIN_EXPORT nixlBackendPlugin *
+nixl_plugin_init() {
+    return nvlink_plugin_t::create(NIXL_PLUGIN_API_VERSION, "NVLINK", "0.1.0", {}, nvlink_mems);
+}
+
+extern "C" NIXL_PLUGIN_EXPORT void
+nixl_plugin_fini() {}
+#endif
@@ -21,13 +21,60 @@
 #include <absl/strings/str_format.h>
 #include <memory>
 #include <future>
+#include <mutex>
 #include <optional>
+#include <tuple>
 #include <vector>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <algorithm>
 
 namespace {
 
+constexpr std::size_t default_multipart_threshold = 32ull << 20;
+constexpr std::size_t default_part_size = 16ull << 20;
+constexpr std::size_t min_part_size_floor = 8ull << 20;
+constexpr std::size_t max_part_size = 512ull << 20;
+constexpr std::size_t default_max_parts_per_object = 16;
+constexpr std::size_t default_pack_max_bytes = 32ull << 20;
+constexpr std::uint32_t pack_index_magic = 0x4e58504b; // "NXPK"
+constexpr std::size_t default_hedge_percentile = 95;
+
+struct objPackEntry {
+    std::string key;
+    std::size_t offset;
+    std::size_t size;
+};
+
+// Appends the in-object index to a container buffer: per-entry
+// {key_len, key, offset, size} records followed by a fixed trailer
+// {index_offset, entry_count, magic}, so a container can be unpacked
+// without any out-of-band metadata
+void
+appendPackIndex(std::vector<char> &buf, const std::vector<objPackEntry> &entries) {
+    auto append = [&buf](const void *data, std::size_t len) {
+        const char *bytes = static_cast<const char *>(data);
+        buf.insert(buf.end(), bytes, bytes + len);
+    };
+
+    const std::uint64_t index_offset = buf.size();
+    for (const auto &entry : entries) {
+        const std::uint32_t key_len = entry.key.size();
+        append(&key_len, sizeof(key_len));
+        append(entry.key.data(), key_len);
+        const std::uint64_t offset = entry.offset;
+        const std::uint64_t size = entry.size;
+        append(&offset, sizeof(offset));
+        append(&size, sizeof(size));
+    }
+
+    const std::uint32_t entry_count = entries.size();
+    append(&index_offset, sizeof(index_offset));
+    append(&entry_count, sizeof(entry_count));
+    append(&pack_index_magic, sizeof(pack_index_magic));
+}
+
 std::size_t
 getNumThreads(nixl_b_params_t *custom_params) {
     return custom_params && custom_params->count("num_threads") > 0 ?
@@ -35,6 +82,40 @@ getNumThreads(nixl_b_params_t *custom_params) {
         std::max(1u, std::thread::hardware_concurrency() / 2);
 }
 
+// Scheduling priority of this backend's IO on the shared executor;
+// checkpoint-style writers can set "io_priority=low" to yield to fetches
+nixlIoExecutor::prio_t
+getIoPriority(nixl_b_params_t *custom_params) {
+    if (!custom_params || custom_params->count("io_priority") == 0)
+        return nixlIoExecutor::prio_t::NORMAL;
+
+    const std::string &prio = custom_params->at("io_priority");
+    if (prio == "high") return nixlIoExecutor::prio_t::HIGH;
+    if (prio == "low") return nixlIoExecutor::prio_t::LOW;
+    if (prio != "normal")
+        NIXL_WARN << "Unknown io_priority '" << prio << "', using normal";
+    return nixlIoExecutor::prio_t::NORMAL;
+}
+
+std::size_t
+getSizeParam(nixl_b_params_t *custom_params, const std::string &name, std::size_t default_value) {
+    return custom_params && custom_params->count(name) > 0 ? std::stoul(custom_params->at(name)) :
+                                                             default_value;
+}
+
+bool
+getHedgeGets(nixl_b_params_t *custom_params) {
+    if (!custom_params || custom_params->count("hedge_gets") == 0) return false;
+    const std::string &value = custom_params->at("hedge_gets");
+    return value == "true" || value == "1";
+}
+
+std::chrono::microseconds
+elapsedSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                 start);
+}
+
 bool
 isValidPrepXferParams(const nixl_xfer_op_t &operation,
                       const nixl_meta_dlist_t &local,
@@ -67,12 +148,68 @@ isValidPrepXferParams(const nixl_xfer_op_t &operation,
     return true;
 }
 
+// Shared between a primary GET, its hedge, and the poller that issues the
+// hedge: the first successful attempt wins and cancels the other, and the
+// operation only fails once every attempt has failed
+struct objHedgeState {
+    std::atomic<bool> done{false};
+    std::atomic<int> inFlight{1};
+    get_cancel_token_t primaryCancel = std::make_shared<std::atomic<bool>>(false);
+    get_cancel_token_t hedgeCancel = std::make_shared<std::atomic<bool>>(false);
+    // The hedge downloads into scratch so the losing primary never races
+    // the winner on the caller's buffer; allocated when the hedge fires
+    std::shared_ptr<std::vector<char>> scratch;
+};
+
+// Completion path shared by both attempts of a hedged GET. The winner
+// cancels the loser, feeds the latency window, and fulfills the promise;
+// a hedge win copies its scratch download into the destination first.
+void
+completeHedged(const std::shared_ptr<objHedgeState> &state,
+               const std::shared_ptr<std::promise<nixl_status_t>> &promise,
+               bool success,
+               bool from_hedge,
+               uintptr_t dest,
+               objHedgeTuner &tuner,
+               std::chrono::microseconds elapsed,
+               const std::function<void()> &on_success) {
+    if (success && !state->done.exchange(true)) {
+        if (from_hedge) {
+            state->primaryCancel->store(true, std::memory_order_relaxed);
+            std::memcpy(
+                reinterpret_cast<void *>(dest), state->scratch->data(), state->scratch->size());
+        } else {
+            state->hedgeCancel->store(true, std::memory_order_relaxed);
+        }
+        tuner.record(elapsed);
+        if (on_success) on_success();
+        promise->set_value(NIXL_SUCCESS);
+    } else if (!success && state->inFlight.fetch_sub(1) == 1 && !state->done.exchange(true)) {
+        promise->set_value(NIXL_ERR_BACKEND);
+    }
+}
+
+// One hedge-eligible GET of a request, tracked so checkXfer can reissue
+// it once it outlives the adaptive delay
+struct objHedgeOp {
+    std::string key;
+    uintptr_t dest;
+    size_t len;
+    size_t offset;
+    std::chrono::steady_clock::time_point start;
+    bool hedged = false;
+    std::shared_ptr<objHedgeState> state;
+    std::shared_ptr<std::promise<nixl_status_t>> promise;
+    std::function<void()> onSuccess;
+};
+
 class nixlObjBackendReqH : public nixlBackendReqH {
 public:
     nixlObjBackendReqH() = default;
     ~nixlObjBackendReqH() = default;
 
     std::vector<std::future<nixl_status_t>> statusFutures_;
+    std::vector<objHedgeOp> hedgeOps_;
 
     nixl_status_t
     getOverallStatus() {
@@ -116,8 +253,25 @@ public:
 
 nixlObjEngine::nixlObjEngine(const nixlBackendInitParams *init_params)
     : nixlBackendEngine(init_params),
-      executor_(std::make_shared<asioThreadPoolExecutor>(getNumThreads(init_params->customParams))),
-      s3Client_(std::make_shared<awsS3Client>(init_params->customParams, executor_)) {
+      executor_(std::make_shared<objSharedExecutor>(getNumThreads(init_params->customParams),
+                                                    getIoPriority(init_params->customParams))),
+      s3Client_(std::make_shared<awsS3Client>(init_params->customParams, executor_)),
+      multipartThreshold_(getSizeParam(
+          init_params->customParams, "multipart_threshold", default_multipart_threshold)),
+      maxPartsPerObject_(std::max<std::size_t>(
+          1,
+          getSizeParam(
+              init_params->customParams, "max_parts_per_object", default_max_parts_per_object))),
+      partTuner_(getSizeParam(init_params->customParams, "part_size", default_part_size),
+                 std::min(getSizeParam(init_params->customParams, "part_size", default_part_size),
+                          min_part_size_floor),
+                 max_part_size),
+      hedgeGets_(getHedgeGets(init_params->customParams)),
+      hedgeTuner_(getSizeParam(
+          init_params->customParams, "hedge_percentile", default_hedge_percentile)),
+      packThreshold_(getSizeParam(init_params->customParams, "pack_threshold", 0)),
+      packMaxBytes_(std::max<std::size_t>(
+          1, getSizeParam(init_params->customParams, "pack_max_bytes", default_pack_max_bytes))) {
     NIXL_INFO << "Object storage backend initialized with S3 client wrapper";
 }
 
@@ -125,8 +279,25 @@ nixlObjEngine::nixlObjEngine(const nixlBackendInitParams *init_params)
 nixlObjEngine::nixlObjEngine(const nixlBackendInitParams *init_params,
                              std::shared_ptr<iS3Client> s3_client)
     : nixlBackendEngine(init_params),
-      executor_(std::make_shared<asioThreadPoolExecutor>(std::thread::hardware_concurrency())),
-      s3Client_(s3_client) {
+      executor_(std::make_shared<objSharedExecutor>(std::thread::hardware_concurrency(),
+                                                    nixlIoExecutor::prio_t::NORMAL)),
+      s3Client_(s3_client),
+      multipartThreshold_(getSizeParam(
+          init_params->customParams, "multipart_threshold", default_multipart_threshold)),
+      maxPartsPerObject_(std::max<std::size_t>(
+          1,
+          getSizeParam(
+              init_params->customParams, "max_parts_per_object", default_max_parts_per_object))),
+      partTuner_(getSizeParam(init_params->customParams, "part_size", default_part_size),
+                 std::min(getSizeParam(init_params->customParams, "part_size", default_part_size),
+                          min_part_size_floor),
+                 max_part_size),
+      hedgeGets_(getHedgeGets(init_params->customParams)),
+      hedgeTuner_(getSizeParam(
+          init_params->customParams, "hedge_percentile", default_hedge_percentile)),
+      packThreshold_(getSizeParam(init_params->customParams, "pack_threshold", 0)),
+      packMaxBytes_(std::max<std::size_t>(
+          1, getSizeParam(init_params->customParams, "pack_max_bytes", default_pack_max_bytes))) {
     s3Client_->setExecutor(executor_);
     NIXL_INFO << "Object storage backend initialized with injected S3 client";
 }
@@ -208,6 +379,106 @@ nixlObjEngine::postXfer(const nixl_xfer_op_t &operation,
                         const nixl_opt_b_args_t *opt_args) const {
     nixlObjBackendReqH *req_h = static_cast<nixlObjBackendReqH *>(handle);
 
+    // Small writes deferred for packing into container objects: (key, ptr, len)
+    std::vector<std::tuple<std::string, uintptr_t, size_t>> pack_pending;
+    size_t pack_pending_bytes = 0;
+
+    // Packs a group of small descriptors into one container object with an
+    // in-object index and a single PUT, turning a burst of per-object
+    // requests into one. Groups of one are not worth the indirection and
+    // go through the regular per-object path.
+    auto flush_pack = [this, req_h](std::vector<std::tuple<std::string, uintptr_t, size_t>> &group) {
+        if (group.empty()) return;
+
+        auto status_promise = std::make_shared<std::promise<nixl_status_t>>();
+        req_h->statusFutures_.push_back(status_promise->get_future());
+
+        if (group.size() == 1) {
+            const auto &[key, ptr, len] = group.front();
+            {
+                std::lock_guard<std::mutex> lock(packLock_);
+                packIndex_.erase(key);
+            }
+            s3Client_->putObjectAsync(key, ptr, len, 0, [status_promise](bool success) {
+                status_promise->set_value(success ? NIXL_SUCCESS : NIXL_ERR_BACKEND);
+            });
+            group.clear();
+            return;
+        }
+
+        auto buf = std::make_shared<std::vector<char>>();
+        auto entries = std::make_shared<std::vector<objPackEntry>>();
+        entries->reserve(group.size());
+        for (const auto &[key, ptr, len] : group) {
+            const char *bytes = reinterpret_cast<const char *>(ptr);
+            entries->push_back({key, buf->size(), len});
+            buf->insert(buf->end(), bytes, bytes + len);
+        }
+        appendPackIndex(*buf, *entries);
+        group.clear();
+
+        const std::string container_key = absl::StrFormat(
+            "nixl-pack-%s-%lu", localAgent, packSeq_.fetch_add(1, std::memory_order_relaxed));
+
+        // The buffer stays alive in the callback capture until the PUT lands;
+        // the index only advertises the entries once the container is durable
+        s3Client_->putObjectAsync(
+            container_key,
+            reinterpret_cast<uintptr_t>(buf->data()),
+            buf->size(),
+            0,
+            [this, buf, entries, container_key, status_promise](bool success) {
+                if (success) {
+                    std::lock_guard<std::mutex> lock(packLock_);
+                    for (const auto &entry : *entries)
+                        packIndex_[entry.key] = {container_key, entry.offset, entry.size};
+                }
+                status_promise->set_value(success ? NIXL_SUCCESS : NIXL_ERR_BACKEND);
+            });
+    };
+
+    // Issues a ranged GET, optionally tracked for hedging: with hedge_gets
+    // enabled the op is recorded so checkXfer can reissue it on a second
+    // connection once it outlives the adaptive percentile delay
+    auto issue_get = [this, req_h](const std::string &key,
+                                   uintptr_t dest,
+                                   size_t len,
+                                   size_t off,
+                                   std::function<void()> on_success) {
+        auto status_promise = std::make_shared<std::promise<nixl_status_t>>();
+        req_h->statusFutures_.push_back(status_promise->get_future());
+
+        if (!hedgeGets_) {
+            s3Client_->getObjectAsync(
+                key, dest, len, off, [status_promise, on_success](bool success) {
+                    if (success && on_success) on_success();
+                    status_promise->set_value(success ? NIXL_SUCCESS : NIXL_ERR_BACKEND);
+                });
+            return;
+        }
+
+        auto state = std::make_shared<objHedgeState>();
+        const auto start = std::chrono::steady_clock::now();
+        req_h->hedgeOps_.push_back(
+            {key, dest, len, off, start, false, state, status_promise, on_success});
+        s3Client_->getObjectAsync(
+            key,
+            dest,
+            len,
+            off,
+            [this, state, status_promise, on_success, start](bool success) {
+                completeHedged(state,
+                               status_promise,
+                               success,
+                               false,
+                               0,
+                               hedgeTuner_,
+                               elapsedSince(start),
+                               on_success);
+            },
+            state->primaryCancel);
+    };
+
     for (int i = 0; i < local.descCount(); ++i) {
         const auto &local_desc = local[i];
         const auto &remote_desc = remote[i];
@@ -219,33 +490,145 @@ nixlObjEngine::postXfer(const nixl_xfer_op_t &operation,
             return NIXL_ERR_INVALID_PARAM;
         }
 
-        auto status_promise = std::make_shared<std::promise<nixl_status_t>>();
-        req_h->statusFutures_.push_back(status_promise->get_future());
-
         uintptr_t data_ptr = local_desc.addr;
         size_t data_len = local_desc.len;
         size_t offset = remote_desc.addr;
 
+        if (packThreshold_ > 0) {
+            if (operation == NIXL_WRITE && data_len < packThreshold_ && offset == 0) {
+                if (pack_pending_bytes + data_len > packMaxBytes_) {
+                    flush_pack(pack_pending);
+                    pack_pending_bytes = 0;
+                }
+                pack_pending.emplace_back(obj_key_search->second, data_ptr, data_len);
+                pack_pending_bytes += data_len;
+                continue;
+            }
+            if (operation == NIXL_WRITE) {
+                // A full rewrite through the regular path supersedes any
+                // packed copy of this object
+                std::lock_guard<std::mutex> lock(packLock_);
+                packIndex_.erase(obj_key_search->second);
+            } else {
+                std::optional<objPackLoc> loc;
+                {
+                    std::lock_guard<std::mutex> lock(packLock_);
+                    auto pack_it = packIndex_.find(obj_key_search->second);
+                    if (pack_it != packIndex_.end()) loc = pack_it->second;
+                }
+                if (loc && offset + data_len <= loc->size) {
+                    // Packed objects come back as ranged GETs within the container
+                    issue_get(loc->containerKey, data_ptr, data_len, loc->offset + offset, {});
+                    continue;
+                }
+            }
+        }
+
         // S3 client interface signals completion via a callback, but NIXL API polls request handle
-        // for the status code. Use future/promise pair to bridge the gap.
-        if (operation == NIXL_WRITE)
-            s3Client_->putObjectAsync(
-                obj_key_search->second, data_ptr, data_len, offset, [status_promise](bool success) {
-                    status_promise->set_value(success ? NIXL_SUCCESS : NIXL_ERR_BACKEND);
-                });
-        else
-            s3Client_->getObjectAsync(
-                obj_key_search->second, data_ptr, data_len, offset, [status_promise](bool success) {
-                    status_promise->set_value(success ? NIXL_SUCCESS : NIXL_ERR_BACKEND);
-                });
+        // for the status code. Use future/promise pairs to bridge the gap. Large descriptors fan
+        // out across multiple HTTP connections: ranged GETs for reads, a multipart upload for
+        // writes. Completed parts feed the part-size tuner.
+        if (operation == NIXL_WRITE) {
+            auto status_promise = std::make_shared<std::promise<nixl_status_t>>();
+            req_h->statusFutures_.push_back(status_promise->get_future());
+
+            if (data_len >= multipartThreshold_ && offset == 0) {
+                const size_t part_size = planPartSize(data_len);
+                const size_t num_parts = (data_len + part_size - 1) / part_size;
+                const auto start = std::chrono::steady_clock::now();
+                s3Client_->putObjectMultipartAsync(
+                    obj_key_search->second,
+                    data_ptr,
+                    data_len,
+                    part_size,
+                    [this, status_promise, data_len, num_parts, start](bool success) {
+                        if (success) partTuner_.record(data_len / num_parts, elapsedSince(start));
+                        status_promise->set_value(success ? NIXL_SUCCESS : NIXL_ERR_BACKEND);
+                    });
+            } else {
+                s3Client_->putObjectAsync(obj_key_search->second,
+                                          data_ptr,
+                                          data_len,
+                                          offset,
+                                          [status_promise](bool success) {
+                                              status_promise->set_value(success ? NIXL_SUCCESS :
+                                                                                  NIXL_ERR_BACKEND);
+                                          });
+            }
+        } else if (data_len >= multipartThreshold_) {
+            const size_t part_size = planPartSize(data_len);
+            for (size_t part_offset = 0; part_offset < data_len; part_offset += part_size) {
+                const size_t part_len = std::min(part_size, data_len - part_offset);
+                const auto start = std::chrono::steady_clock::now();
+                issue_get(obj_key_search->second,
+                          data_ptr + part_offset,
+                          part_len,
+                          offset + part_offset,
+                          [this, part_len, start]() {
+                              partTuner_.record(part_len, elapsedSince(start));
+                          });
+            }
+        } else {
+            issue_get(obj_key_search->second, data_ptr, data_len, offset, {});
+        }
     }
 
+    flush_pack(pack_pending);
+
     return NIXL_IN_PROG;
 }
 
+size_t
+nixlObjEngine::planPartSize(size_t data_len) const {
+    // The tuner sets the per-connection sweet spot; the parallelism cap
+    // keeps one object from fanning out into too many requests
+    const size_t min_for_cap = (data_len + maxPartsPerObject_ - 1) / maxPartsPerObject_;
+    return std::max(partTuner_.partSize(), min_for_cap);
+}
+
 nixl_status_t
 nixlObjEngine::checkXfer(nixlBackendReqH *handle) const {
     nixlObjBackendReqH *req_h = static_cast<nixlObjBackendReqH *>(handle);
+
+    // Hedge pass: reissue GETs that have outlived the adaptive percentile
+    // delay on a second connection, into scratch memory; the first attempt
+    // to complete wins and aborts the other
+    if (hedgeGets_ && !req_h->hedgeOps_.empty()) {
+        const auto delay = hedgeTuner_.delay();
+        if (delay.count() > 0) {
+            for (auto &op : req_h->hedgeOps_) {
+                if (op.hedged || op.state->done.load() || elapsedSince(op.start) < delay) continue;
+                op.hedged = true;
+                op.state->inFlight.fetch_add(1);
+                op.state->scratch = std::make_shared<std::vector<char>>(op.len);
+                NIXL_DEBUG << absl::StrFormat(
+                    "Hedging GET of %zu bytes from '%s' after %ld us", op.len, op.key, delay.count());
+
+                auto state = op.state;
+                auto promise = op.promise;
+                auto on_success = op.onSuccess;
+                const uintptr_t dest = op.dest;
+                const auto start = std::chrono::steady_clock::now();
+                s3Client_->getObjectAsync(
+                    op.key,
+                    reinterpret_cast<uintptr_t>(state->scratch->data()),
+                    op.len,
+                    op.offset,
+                    [this, state, promise, on_success, dest, start](bool success) {
+                        completeHedged(state,
+                                       promise,
+                                       success,
+                                       true,
+                                       dest,
+                                       hedgeTuner_,
+                                       elapsedSince(start),
+                                       on_success);
+                    },
+                    state->hedgeCancel);
+            }
+        }
+    }
+
     return req_h->getOverallStatus();
 }
 
@@ -20,8 +20,10 @@
 
 #include "obj_executor.h"
 #include "obj_s3_client.h"
+#include <atomic>
 #include <string>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include "backend/backend_engine.h"
 
@@ -103,9 +105,29 @@ public:
     }
 
 private:
-    std::shared_ptr<asioThreadPoolExecutor> executor_;
+    // Where a packed object lives inside its container object
+    struct objPackLoc {
+        std::string containerKey;
+        size_t offset;
+        size_t size;
+    };
+
+    size_t
+    planPartSize(size_t data_len) const;
+
+    std::shared_ptr<objSharedExecutor> executor_;
     std::shared_ptr<iS3Client> s3Client_;
     std::unordered_map<uint64_t, std::string> devIdToObjKey_;
+    size_t multipartThreshold_;
+    size_t maxPartsPerObject_;
+    mutable objPartTuner partTuner_;
+    bool hedgeGets_;
+    mutable objHedgeTuner hedgeTuner_;
+    size_t packThreshold_;
+    size_t packMaxBytes_;
+    mutable std::atomic<uint64_t> packSeq_{0};
+    mutable std::mutex packLock_;
+    mutable std::unordered_map<std::string, objPackLoc> packIndex_;
 };
 
 #endif // OBJ_BACKEND_H
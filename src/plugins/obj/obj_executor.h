@@ -19,33 +19,145 @@
 #define OBJ_EXECUTOR_H
 
 #include <aws/core/utils/threading/Executor.h>
-#include <asio.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <mutex>
 
-class asioThreadPoolExecutor : public Aws::Utils::Threading::Executor {
+#include "common/nixl_io_executor.h"
+
+/**
+ * Adapts the process-wide nixlIoExecutor to the AWS SDK executor interface.
+ * The backend no longer owns a thread pool: async S3 operations run as a
+ * bounded client of the shared pool, so multiple backend instances share
+ * one set of IO threads and checkpoint uploads submitted at LOW priority
+ * yield to higher-priority fetches from other backends.
+ */
+class objSharedExecutor : public Aws::Utils::Threading::Executor {
 public:
-    explicit asioThreadPoolExecutor(std::size_t num_threads) : pool_(num_threads) {}
+    objSharedExecutor(std::size_t max_inflight, nixlIoExecutor::prio_t prio)
+        : client_(nixlIoExecutor::getShared().registerClient(prio, max_inflight)) {}
+
+    ~objSharedExecutor() override {
+        WaitUntilStopped();
+    }
 
     void
     WaitUntilStopped() override {
-        pool_.stop();
-        pool_.join();
+        if (!stopped_.exchange(true))
+            nixlIoExecutor::getShared().unregisterClient(client_);
     }
 
     void
     waitUntilIdle() {
-        pool_.wait();
+        nixlIoExecutor::getShared().waitIdle(client_);
     }
 
 protected:
     bool
     SubmitToThread(std::function<void()> &&task) override {
-        asio::post(pool_, std::move(task));
+        if (stopped_.load()) return false;
+        nixlIoExecutor::getShared().submit(client_, std::move(task));
         return true;
     }
 
 private:
-    asio::thread_pool pool_;
+    const std::uint64_t client_;
+    std::atomic<bool> stopped_{false};
+};
+
+/**
+ * Derives the multipart part size from measured per-connection throughput.
+ * Completed parts feed an EWMA of bytes/second on one HTTP connection; the
+ * part size then targets roughly half a second per part, which keeps
+ * per-request overhead amortized while still fanning a single object out
+ * across enough connections to fill the instance network.
+ */
+class objPartTuner {
+public:
+    objPartTuner(std::size_t initial_part_size,
+                 std::size_t min_part_size,
+                 std::size_t max_part_size)
+        : minPartSize_(min_part_size),
+          maxPartSize_(max_part_size),
+          partSize_(clampPart(initial_part_size)) {}
+
+    std::size_t
+    partSize() const {
+        return partSize_.load(std::memory_order_relaxed);
+    }
+
+    void
+    record(std::size_t bytes, std::chrono::microseconds elapsed) {
+        if (bytes == 0 || elapsed.count() <= 0) return;
+
+        const std::uint64_t bw = bytes * 1000000ull / elapsed.count();
+        const std::uint64_t prev = bwEwma_.load(std::memory_order_relaxed);
+        const std::uint64_t next = prev == 0 ? bw : (prev * 7 + bw) / 8;
+        bwEwma_.store(next, std::memory_order_relaxed);
+
+        // ~500ms per part, rounded down to whole MiB
+        std::size_t target = static_cast<std::size_t>(next / 2);
+        target -= target % (1ull << 20);
+        partSize_.store(clampPart(target), std::memory_order_relaxed);
+    }
+
+private:
+    std::size_t
+    clampPart(std::size_t size) const {
+        return std::min(std::max(size, minPartSize_), maxPartSize_);
+    }
+
+    const std::size_t minPartSize_;
+    const std::size_t maxPartSize_;
+    std::atomic<std::uint64_t> bwEwma_{0};
+    std::atomic<std::size_t> partSize_;
+};
+
+/**
+ * Derives the hedging delay for ranged GETs from recent completion
+ * latencies. Winning attempts feed a sliding window and the delay is the
+ * configured percentile of that window, so a reissue only fires once a
+ * GET has outlived what almost all of its peers needed. Until enough
+ * samples accumulate the delay is zero, which disables hedging.
+ */
+class objHedgeTuner {
+public:
+    explicit objHedgeTuner(unsigned percentile)
+        : percentile_(std::min(99u, std::max(50u, percentile))) {}
+
+    void
+    record(std::chrono::microseconds elapsed) {
+        if (elapsed.count() <= 0) return;
+        std::lock_guard<std::mutex> lock(lock_);
+        samples_[next_++ % samples_.size()] = elapsed.count();
+        if (count_ < samples_.size()) ++count_;
+    }
+
+    std::chrono::microseconds
+    delay() const {
+        std::lock_guard<std::mutex> lock(lock_);
+        if (count_ < min_samples) return std::chrono::microseconds(0);
+        std::array<std::int64_t, window> sorted;
+        std::copy_n(samples_.begin(), count_, sorted.begin());
+        auto nth = sorted.begin() + (count_ - 1) * percentile_ / 100;
+        std::nth_element(sorted.begin(), nth, sorted.begin() + count_);
+        return std::chrono::microseconds(*nth);
+    }
+
+private:
+    static constexpr std::size_t window = 128;
+    static constexpr std::size_t min_samples = 16;
+
+    const unsigned percentile_;
+    mutable std::mutex lock_;
+    std::array<std::int64_t, window> samples_{};
+    std::size_t next_ = 0;
+    std::size_t count_ = 0;
 };
 
 #endif // OBJ_EXECUTOR_H
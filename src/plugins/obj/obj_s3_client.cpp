@@ -16,9 +16,13 @@
  */
 
 #include "obj_s3_client.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <optional>
 #include <string>
 #include <stdexcept>
+#include <vector>
 #include <cstdlib>
 #include <aws/s3/model/PutObjectRequest.h>
 #include <aws/s3/model/GetObjectRequest.h>
@@ -26,7 +30,15 @@
 #include <aws/s3/model/GetObjectResult.h>
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <aws/s3/model/HeadObjectResult.h>
+#include <aws/s3/model/HeadBucketRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
+#include <aws/s3/model/CompletedPart.h>
+#include <aws/s3/model/CompletedMultipartUpload.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
 #include <aws/core/http/Scheme.h>
+#include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/HttpResponse.h>
 #include <aws/core/auth/AWSCredentials.h>
 #include <aws/core/client/ClientConfiguration.h>
@@ -34,6 +46,7 @@
 #include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <absl/strings/str_format.h>
+#include "common/nixl_log.h"
 #include "nixl_types.h"
 
 namespace {
@@ -77,9 +90,34 @@ createClientConfiguration(nixl_b_params_t *custom_params) {
     auto ca_bundle_it = custom_params->find("ca_bundle");
     if (ca_bundle_it != custom_params->end()) config.caFile = ca_bundle_it->second;
 
+    // Keep pooled connections alive between transfer bursts instead of
+    // paying TCP/TLS setup on every burst
+    config.enableTcpKeepAlive = true;
+    auto max_connections_it = custom_params->find("max_connections");
+    if (max_connections_it != custom_params->end())
+        config.maxConnections = std::stoul(max_connections_it->second);
+
+    auto tcp_keepalive_it = custom_params->find("tcp_keepalive_interval_ms");
+    if (tcp_keepalive_it != custom_params->end())
+        config.tcpKeepAliveIntervalMs = std::stoul(tcp_keepalive_it->second);
+
     return config;
 }
 
+unsigned int
+getWarmConnections(nixl_b_params_t *custom_params) {
+    if (!custom_params) return 0;
+    auto it = custom_params->find("warm_connections");
+    return it != custom_params->end() ? std::stoul(it->second) : 0;
+}
+
+std::chrono::milliseconds
+getKeepaliveInterval(nixl_b_params_t *custom_params) {
+    if (!custom_params) return std::chrono::milliseconds(0);
+    auto it = custom_params->find("keepalive_interval_ms");
+    return std::chrono::milliseconds(it != custom_params->end() ? std::stoul(it->second) : 0);
+}
+
 std::optional<Aws::Auth::AWSCredentials>
 createAWSCredentials(nixl_b_params_t *custom_params) {
     if (!custom_params) return std::nullopt;
@@ -136,6 +174,44 @@ getBucketName(nixl_b_params_t *custom_params) {
                              "set AWS_DEFAULT_BUCKET environment variable");
 }
 
+// S3 caps multipart uploads at 10000 parts per object
+constexpr size_t max_multipart_parts = 10000;
+
+struct multipartUploadCtx {
+    Aws::String upload_id;
+    std::atomic<size_t> remaining{0};
+    std::atomic<bool> failed{false};
+    std::vector<Aws::S3::Model::CompletedPart> parts;
+};
+
+// Runs on the executor thread that saw the last part complete
+void
+finishMultipartUpload(Aws::S3::S3Client *client,
+                      const Aws::String &bucket,
+                      const Aws::String &key,
+                      const std::shared_ptr<multipartUploadCtx> &ctx,
+                      const put_object_callback_t &callback) {
+    if (ctx->failed.load()) {
+        Aws::S3::Model::AbortMultipartUploadRequest abort_request;
+        abort_request.WithBucket(bucket).WithKey(key).WithUploadId(ctx->upload_id);
+        client->AbortMultipartUpload(abort_request);
+        callback(false);
+        return;
+    }
+
+    Aws::S3::Model::CompletedMultipartUpload completed;
+    for (const auto &part : ctx->parts)
+        completed.AddParts(part);
+
+    Aws::S3::Model::CompleteMultipartUploadRequest complete_request;
+    complete_request.WithBucket(bucket)
+        .WithKey(key)
+        .WithUploadId(ctx->upload_id)
+        .WithMultipartUpload(completed);
+
+    callback(client->CompleteMultipartUpload(complete_request).IsSuccess());
+}
+
 } // namespace
 
 awsS3Client::awsS3Client(nixl_b_params_t *custom_params,
@@ -168,6 +244,67 @@ awsS3Client::awsS3Client(nixl_b_params_t *custom_params,
             config,
             Aws::Client::AWSAuthV4Signer::PayloadSigningPolicy::RequestDependent,
             use_virtual_addressing);
+
+    warmConnections_ = ::getWarmConnections(custom_params);
+    keepaliveInterval_ = ::getKeepaliveInterval(custom_params);
+
+    if (warmConnections_ > 0) warmPool();
+    if (keepaliveInterval_.count() > 0)
+        keepaliveThread_ = std::thread(&awsS3Client::keepaliveLoop, this);
+}
+
+awsS3Client::~awsS3Client() {
+    if (keepaliveThread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(keepaliveMtx_);
+            stopKeepalive_ = true;
+        }
+        keepaliveCv_.notify_all();
+        keepaliveThread_.join();
+    }
+}
+
+void
+awsS3Client::warmPool() {
+    // Concurrent async probes each grab their own connection from the
+    // SDK pool, so the TLS handshakes happen now rather than on the
+    // first transfer burst. Fire and forget; failures only cost warmth.
+    Aws::S3::Model::HeadBucketRequest request;
+    request.WithBucket(bucketName_);
+
+    for (unsigned int i = 0; i < warmConnections_; i++) {
+        s3Client_->HeadBucketAsync(
+            request,
+            [](const Aws::S3::S3Client *,
+               const Aws::S3::Model::HeadBucketRequest &,
+               const Aws::S3::Model::HeadBucketOutcome &outcome,
+               const std::shared_ptr<const Aws::Client::AsyncCallerContext> &) {
+                if (!outcome.IsSuccess())
+                    NIXL_DEBUG << "S3 connection warm-up probe failed: "
+                               << outcome.GetError().GetMessage();
+            },
+            nullptr);
+    }
+}
+
+void
+awsS3Client::keepaliveLoop() {
+    std::unique_lock<std::mutex> lock(keepaliveMtx_);
+    while (!stopKeepalive_) {
+        if (keepaliveCv_.wait_for(lock, keepaliveInterval_, [this]() { return stopKeepalive_; }))
+            break;
+
+        lock.unlock();
+        // Re-warm the pool and check endpoint health in one go
+        warmPool();
+
+        Aws::S3::Model::HeadBucketRequest request;
+        request.WithBucket(bucketName_);
+        auto outcome = s3Client_->HeadBucket(request);
+        if (!outcome.IsSuccess())
+            NIXL_WARN << "S3 keep-alive health check failed: " << outcome.GetError().GetMessage();
+        lock.lock();
+    }
 }
 
 void
@@ -209,12 +346,105 @@ awsS3Client::putObjectAsync(std::string_view key,
         nullptr);
 }
 
+void
+awsS3Client::putObjectMultipartAsync(std::string_view key,
+                                     uintptr_t data_ptr,
+                                     size_t data_len,
+                                     size_t part_size,
+                                     put_object_callback_t callback) {
+    if (part_size == 0) part_size = data_len;
+    if ((data_len + part_size - 1) / part_size > max_multipart_parts)
+        part_size = (data_len + max_multipart_parts - 1) / max_multipart_parts;
+
+    const size_t num_parts = (data_len + part_size - 1) / part_size;
+    if (num_parts < 2) {
+        putObjectAsync(key, data_ptr, data_len, 0, std::move(callback));
+        return;
+    }
+
+    Aws::S3::Model::CreateMultipartUploadRequest create_request;
+    create_request.WithBucket(bucketName_).WithKey(Aws::String(key));
+
+    // The create callback fans the parts out; the callback of the last part
+    // to complete finishes (or aborts) the upload.
+    Aws::S3::S3Client *client = s3Client_.get();
+    Aws::String bucket = bucketName_;
+    s3Client_->CreateMultipartUploadAsync(
+        create_request,
+        [client, bucket, key = Aws::String(key), data_ptr, data_len, part_size, num_parts, callback](
+            const Aws::S3::S3Client *,
+            const Aws::S3::Model::CreateMultipartUploadRequest &,
+            const Aws::S3::Model::CreateMultipartUploadOutcome &outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext> &) {
+            if (!outcome.IsSuccess()) {
+                callback(false);
+                return;
+            }
+
+            auto ctx = std::make_shared<multipartUploadCtx>();
+            ctx->upload_id = outcome.GetResult().GetUploadId();
+            ctx->remaining = num_parts;
+            ctx->parts.resize(num_parts);
+
+            for (size_t p = 0; p < num_parts; p++) {
+                const size_t part_offset = p * part_size;
+                const size_t part_len = std::min(part_size, data_len - part_offset);
+
+                Aws::S3::Model::UploadPartRequest part_request;
+                part_request.WithBucket(bucket)
+                    .WithKey(key)
+                    .WithUploadId(ctx->upload_id)
+                    .WithPartNumber(static_cast<int>(p) + 1);
+
+                auto part_stream_buf =
+                    Aws::MakeShared<Aws::Utils::Stream::PreallocatedStreamBuf>(
+                        "UploadPartStreamBuf",
+                        reinterpret_cast<unsigned char *>(data_ptr + part_offset),
+                        part_len);
+                auto part_stream = Aws::MakeShared<Aws::IOStream>("UploadPartInputStream",
+                                                                  part_stream_buf.get());
+                part_request.SetBody(part_stream);
+                part_request.SetContentLength(part_len);
+
+                client->UploadPartAsync(
+                    part_request,
+                    [client, bucket, key, ctx, p, part_stream_buf, part_stream, callback](
+                        const Aws::S3::S3Client *,
+                        const Aws::S3::Model::UploadPartRequest &,
+                        const Aws::S3::Model::UploadPartOutcome &part_outcome,
+                        const std::shared_ptr<const Aws::Client::AsyncCallerContext> &) {
+                        if (part_outcome.IsSuccess())
+                            ctx->parts[p]
+                                .WithPartNumber(static_cast<int>(p) + 1)
+                                .WithETag(part_outcome.GetResult().GetETag());
+                        else
+                            ctx->failed = true;
+
+                        if (ctx->remaining.fetch_sub(1) == 1)
+                            finishMultipartUpload(client, bucket, key, ctx, callback);
+                    },
+                    nullptr);
+            }
+        },
+        nullptr);
+}
+
 void
 awsS3Client::getObjectAsync(std::string_view key,
                             uintptr_t data_ptr,
                             size_t data_len,
                             size_t offset,
                             get_object_callback_t callback) {
+    getObjectAsync(key, data_ptr, data_len, offset, std::move(callback), nullptr);
+}
+
+void
+awsS3Client::getObjectAsync(std::string_view key,
+                            uintptr_t data_ptr,
+                            size_t data_len,
+                            size_t offset,
+                            get_object_callback_t callback,
+                            get_cancel_token_t cancel) {
     auto preallocated_stream_buf = Aws::MakeShared<Aws::Utils::Stream::PreallocatedStreamBuf>(
         "GetObjectStreamBuf", reinterpret_cast<unsigned char *>(data_ptr), data_len);
     auto stream_factory = Aws::MakeShared<Aws::IOStreamFactory>(
@@ -228,6 +458,14 @@ awsS3Client::getObjectAsync(std::string_view key,
         .WithRange(absl::StrFormat("bytes=%d-%d", offset, offset + data_len - 1));
     request.SetResponseStreamFactory(*stream_factory.get());
 
+    // The SDK polls this handler while the body streams, so flipping the
+    // token aborts the transfer and frees its connection instead of
+    // finishing a download whose result is no longer wanted
+    if (cancel)
+        request.SetContinueRequestHandler([cancel](const Aws::Http::HttpRequest *) {
+            return !cancel->load(std::memory_order_relaxed);
+        });
+
     s3Client_->GetObjectAsync(
         request,
         [callback,
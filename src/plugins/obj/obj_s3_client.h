@@ -18,9 +18,14 @@
 #ifndef OBJ_S3_CLIENT_H
 #define OBJ_S3_CLIENT_H
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string_view>
+#include <thread>
 #include <cstdint>
 #include <aws/s3/S3Client.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -29,6 +34,8 @@
 
 using put_object_callback_t = std::function<void(bool success)>;
 using get_object_callback_t = std::function<void(bool success)>;
+// Shared flag aborting an in-flight GET when set to true
+using get_cancel_token_t = std::shared_ptr<std::atomic<bool>>;
 
 /**
  * Abstract interface for S3 client operations.
@@ -60,6 +67,26 @@ public:
                    size_t offset,
                    put_object_callback_t callback) = 0;
 
+    /**
+     * Asynchronously put a large object to S3 as a multipart upload.
+     * Parts are uploaded concurrently on the executor and the object only
+     * becomes visible once every part has landed. The default falls back
+     * to a single put for implementations without multipart support.
+     * @param key The object key
+     * @param data_ptr Pointer to the data to upload
+     * @param data_len Length of the data in bytes
+     * @param part_size Size of each part except possibly the last
+     * @param callback Callback function to handle the result
+     */
+    virtual void
+    putObjectMultipartAsync(std::string_view key,
+                            uintptr_t data_ptr,
+                            size_t data_len,
+                            size_t part_size,
+                            put_object_callback_t callback) {
+        putObjectAsync(key, data_ptr, data_len, 0, std::move(callback));
+    }
+
     /**
      * Asynchronously get an object from S3.
      * @param key The object key
@@ -75,6 +102,28 @@ public:
                    size_t offset,
                    get_object_callback_t callback) = 0;
 
+    /**
+     * Variant of getObjectAsync carrying a cancellation token. Setting the
+     * token to true aborts the transfer mid-body, used to reap the losing
+     * attempt of a hedged GET. The default ignores the token for
+     * implementations without cancellation support.
+     * @param key The object key
+     * @param data_ptr Pointer to the buffer to store the downloaded data
+     * @param data_len Maximum length of data to read
+     * @param offset Offset within the object to start reading from
+     * @param callback Callback function to handle the result
+     * @param cancel Token that aborts the transfer when set
+     */
+    virtual void
+    getObjectAsync(std::string_view key,
+                   uintptr_t data_ptr,
+                   size_t data_len,
+                   size_t offset,
+                   get_object_callback_t callback,
+                   get_cancel_token_t cancel) {
+        getObjectAsync(key, data_ptr, data_len, offset, std::move(callback));
+    }
+
     /**
      * Check if the object exists.
      * @param key The object key
@@ -97,6 +146,8 @@ public:
     awsS3Client(nixl_b_params_t *custom_params,
                 std::shared_ptr<Aws::Utils::Threading::Executor> executor = nullptr);
 
+    ~awsS3Client() override;
+
     void
     setExecutor(std::shared_ptr<Aws::Utils::Threading::Executor> executor) override;
 
@@ -107,6 +158,13 @@ public:
                    size_t offset,
                    put_object_callback_t callback) override;
 
+    void
+    putObjectMultipartAsync(std::string_view key,
+                            uintptr_t data_ptr,
+                            size_t data_len,
+                            size_t part_size,
+                            put_object_callback_t callback) override;
+
     void
     getObjectAsync(std::string_view key,
                    uintptr_t data_ptr,
@@ -114,13 +172,36 @@ public:
                    size_t offset,
                    get_object_callback_t callback) override;
 
+    void
+    getObjectAsync(std::string_view key,
+                   uintptr_t data_ptr,
+                   size_t data_len,
+                   size_t offset,
+                   get_object_callback_t callback,
+                   get_cancel_token_t cancel) override;
+
     bool
     checkObjectExists(std::string_view key) override;
 
 private:
+    // Open warm_connections_ connections up front by issuing concurrent
+    // HeadBucket probes, so the first transfer burst skips TCP/TLS setup
+    void
+    warmPool();
+    // Periodically re-probes the bucket to keep pooled connections from
+    // idling out and to surface endpoint health problems early
+    void
+    keepaliveLoop();
+
     std::unique_ptr<Aws::SDKOptions, std::function<void(Aws::SDKOptions *)>> awsOptions_;
     std::unique_ptr<Aws::S3::S3Client> s3Client_;
     Aws::String bucketName_;
+    unsigned int warmConnections_ = 0;
+    std::chrono::milliseconds keepaliveInterval_{0};
+    std::mutex keepaliveMtx_;
+    std::condition_variable keepaliveCv_;
+    bool stopKeepalive_ = false;
+    std::thread keepaliveThread_;
 };
 
 #endif // OBJ_S3_CLIENT_H
@@ -19,10 +19,12 @@
 #include <cmath>
 #include <errno.h>
 #include <stdexcept>
+#include <unistd.h>
 #include "posix_backend.h"
 #include <absl/log/log.h>
 #include <absl/strings/str_format.h>
 #include "common/nixl_log.h"
+#include "common/nixl_lz.h"
 #include "queue_factory_impl.h"
 #include "nixl_types.h"
 #include "file/file_utils.h"
@@ -107,6 +109,72 @@ namespace {
         }
         return queue_t::AIO;
     }
+
+    nixl_status_t fullPwrite(int fd, const void* buf, size_t len, off_t offset) {
+        const char* p = static_cast<const char*>(buf);
+        while (len > 0) {
+            ssize_t ret = pwrite(fd, p, len, offset);
+            if (ret < 0) {
+                if (errno == EINTR) continue;
+                NIXL_PERROR << "pwrite failed in compression path";
+                return NIXL_ERR_BACKEND;
+            }
+            p += ret;
+            offset += ret;
+            len -= ret;
+        }
+        return NIXL_SUCCESS;
+    }
+
+    nixl_status_t fullPread(int fd, void* buf, size_t len, off_t offset) {
+        char* p = static_cast<char*>(buf);
+        while (len > 0) {
+            ssize_t ret = pread(fd, p, len, offset);
+            if (ret <= 0) {
+                if (ret < 0 && errno == EINTR) continue;
+                NIXL_PERROR << "pread failed in compression path";
+                return NIXL_ERR_BACKEND;
+            }
+            p += ret;
+            offset += ret;
+            len -= ret;
+        }
+        return NIXL_SUCCESS;
+    }
+
+    static nixlPosixUringConfig getUringConfig(const nixl_b_params_t* custom_params) {
+        nixlPosixUringConfig config;
+        if (!custom_params) {
+            return config;
+        }
+
+        if (custom_params->count("use_sqpoll") > 0) {
+            const auto& value = custom_params->at("use_sqpoll");
+            config.sqpoll = (value == "true" || value == "1");
+        }
+
+        if (custom_params->count("sqpoll_idle_ms") > 0) {
+            try {
+                config.sqpoll_idle_ms = std::stoul(custom_params->at("sqpoll_idle_ms"));
+            } catch (const std::exception&) {
+                NIXL_WARN << absl::StrFormat("Invalid sqpoll_idle_ms value '%s' - using default %u",
+                                             custom_params->at("sqpoll_idle_ms"),
+                                             config.sqpoll_idle_ms);
+            }
+        }
+
+        if (custom_params->count("uring_num_rings") > 0) {
+            try {
+                config.num_rings = std::stoul(custom_params->at("uring_num_rings"));
+            } catch (const std::exception&) {
+                NIXL_WARN << absl::StrFormat("Invalid uring_num_rings value '%s'"
+                                             " - using one ring per NUMA node",
+                                             custom_params->at("uring_num_rings"));
+            }
+        }
+
+        return config;
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -117,24 +185,46 @@ nixlPosixBackendReqH::nixlPosixBackendReqH(const nixl_xfer_op_t &op,
                                            const nixl_meta_dlist_t &loc,
                                            const nixl_meta_dlist_t &rem,
                                            const nixl_opt_b_args_t* args,
-                                           const nixl_b_params_t* params)
+                                           const nixl_b_params_t* params,
+                                           const nixlPosixFixedRes* fixed_res,
+                                           const nixlPosixUringConfig& uring_config,
+                                           const nixlPosixEngine* engine)
     : operation(op)
-    , local(loc)
-    , remote(rem)
+    , local(loc.getType())
+    , remote(rem.getType())
     , opt_args(args)
     , custom_params_(params)
-    , queue_depth_(loc.descCount())
+    , queue_depth_(0)
+    , fixed_res_(fixed_res)
+    , uring_config_(uring_config)
     , queue_type_(getQueueType(params)) {
     if (queue_type_ == nixlPosixQueue::queue_t::UNSUPPORTED) {
         throw exception(absl::StrFormat("Unsupported queue type"), NIXL_ERR_NOT_SUPPORTED);
     }
 
-    if (local.descCount() == 0 || remote.descCount() == 0) {
+    if (loc.descCount() == 0 || rem.descCount() == 0) {
         throw exception(
-            absl::StrFormat("Invalid descriptor count - local: %zu, remote: %zu", local.descCount(), remote.descCount()),
+            absl::StrFormat("Invalid descriptor count - local: %zu, remote: %zu", loc.descCount(), rem.descCount()),
             NIXL_ERR_INVALID_PARAM);
     }
 
+    engine_ = engine;
+    compress_ = engine != nullptr && args != nullptr && args->customParam == "compress";
+    compIsWrite_ = (op == NIXL_WRITE);
+    if (compress_) {
+        // The (fd, offset) block map must line up between the write and
+        // later reads, so compressed requests keep the caller's block
+        // granularity (no coalescing) and bypass the async queue; the
+        // compression workers issue the I/O themselves
+        local = loc;
+        remote = rem;
+        queue_depth_ = local.descCount();
+        return;
+    }
+
+    coalesceDescs(loc, rem);
+    queue_depth_ = local.descCount();
+
     nixl_status_t status = initQueues();
     if (status != NIXL_SUCCESS) {
         throw exception(absl::StrFormat("Failed to initialize queues: %s", to_string(queue_type_)),
@@ -142,6 +232,34 @@ nixlPosixBackendReqH::nixlPosixBackendReqH(const nixl_xfer_op_t &op,
     }
 }
 
+void nixlPosixBackendReqH::coalesceDescs(const nixl_meta_dlist_t &loc,
+                                         const nixl_meta_dlist_t &rem) {
+    auto loc_it = loc.begin();
+    auto rem_it = rem.begin();
+    nixlMetaDesc run_loc = *loc_it;
+    nixlMetaDesc run_rem = *rem_it;
+
+    for (++loc_it, ++rem_it; loc_it != loc.end() && rem_it != rem.end(); ++loc_it, ++rem_it) {
+        // Extend the current run only when both the memory addresses and
+        // the file offsets follow on directly, so the merged operation is
+        // a single contiguous read/write on the same fd
+        bool adjacent = rem_it->devId == run_rem.devId &&
+                        run_rem.addr + run_rem.len == rem_it->addr &&
+                        run_loc.addr + run_loc.len == loc_it->addr;
+        if (adjacent) {
+            run_loc.len += loc_it->len;
+            run_rem.len += rem_it->len;
+        } else {
+            local.addDesc(run_loc);
+            remote.addDesc(run_rem);
+            run_loc = *loc_it;
+            run_rem = *rem_it;
+        }
+    }
+    local.addDesc(run_loc);
+    remote.addDesc(run_rem);
+}
+
 
 nixl_status_t nixlPosixBackendReqH::initQueues() {
     try {
@@ -150,7 +268,8 @@ nixl_status_t nixlPosixBackendReqH::initQueues() {
                 queue = QueueFactory::createAioQueue(queue_depth_, operation);
                 break;
             case nixlPosixQueue::queue_t::URING:
-                queue = QueueFactory::createUringQueue(queue_depth_, operation);
+                queue = QueueFactory::createUringQueue(queue_depth_, operation, local, remote,
+                                                       fixed_res_, uring_config_);
                 break;
             default:
                 NIXL_ERROR << absl::StrFormat("Invalid queue type: %s", to_string(queue_type_));
@@ -167,6 +286,9 @@ nixl_status_t nixlPosixBackendReqH::initQueues() {
 }
 
 nixl_status_t nixlPosixBackendReqH::prepXfer() {
+    if (compress_)
+        return NIXL_SUCCESS; // no queue to prepare, workers run at post time
+
     for (auto [local_it, remote_it] = std::make_pair(local.begin(), remote.begin());
          local_it != local.end() && remote_it != remote.end();
          ++local_it, ++remote_it) {
@@ -187,20 +309,135 @@ nixl_status_t nixlPosixBackendReqH::prepXfer() {
 }
 
 nixl_status_t nixlPosixBackendReqH::checkXfer() {
+    if (compress_)
+        return checkCompressed();
     return queue->checkCompleted();
 }
 
 nixl_status_t nixlPosixBackendReqH::postXfer() {
+    if (compress_)
+        return postCompressed();
     return queue->submit (local, remote);
 }
 
+// -----------------------------------------------------------------------------
+// Compression transform stage
+// -----------------------------------------------------------------------------
+
+nixl_status_t nixlPosixBackendReqH::postCompressed() {
+    if (compRunning_) {
+        NIXL_ERROR << "Compressed transfer reposted while still in progress";
+        return NIXL_ERR_REPOST_ACTIVE;
+    }
+    joinCompWorkers();
+
+    compNextOp_.store(0);
+    compOpsDone_.store(0);
+    compFailed_.store(0);
+    compRunning_ = true;
+
+    const size_t workers = std::min<size_t>(compMaxWorkers_, local.descCount());
+    compWorkers_.reserve(workers);
+    for (size_t i = 0; i < workers; ++i)
+        compWorkers_.emplace_back(&nixlPosixBackendReqH::compWorker, this);
+    return NIXL_IN_PROG;
+}
+
+nixl_status_t nixlPosixBackendReqH::checkCompressed() {
+    if (!compRunning_)
+        return compFailed_.load() ? NIXL_ERR_BACKEND : NIXL_SUCCESS;
+    if (compOpsDone_.load() < static_cast<uint32_t>(local.descCount()))
+        return NIXL_IN_PROG;
+    joinCompWorkers();
+    compRunning_ = false;
+    return compFailed_.load() ? NIXL_ERR_BACKEND : NIXL_SUCCESS;
+}
+
+void nixlPosixBackendReqH::compWorker() {
+    const uint32_t op_count = local.descCount();
+    // Blocks are claimed with an atomic ticket, so the pool naturally
+    // overlaps compression of one block with the I/O of the others
+    for (uint32_t i = compNextOp_.fetch_add(1); i < op_count; i = compNextOp_.fetch_add(1)) {
+        nixl_status_t status = compIsWrite_ ? compWriteOp(i) : compReadOp(i);
+        if (status != NIXL_SUCCESS)
+            compFailed_.store(1);
+        compOpsDone_.fetch_add(1);
+    }
+}
+
+nixl_status_t nixlPosixBackendReqH::compWriteOp(int op_idx) {
+    const nixlMetaDesc &loc = local[op_idx];
+    const nixlMetaDesc &rem = remote[op_idx];
+    const int fd = static_cast<int>(rem.devId);
+
+    std::vector<uint8_t> buf(nixlLzCompressBound(loc.len));
+    const size_t comp_len = nixlLzCompress(reinterpret_cast<const void*>(loc.addr),
+                                           loc.len, buf.data(), buf.size());
+
+    nixlPosixCompBlock block;
+    block.rawLen = loc.len;
+    nixl_status_t status;
+    if (comp_len > 0 && comp_len < loc.len) {
+        block.compLen = comp_len;
+        status = fullPwrite(fd, buf.data(), comp_len, rem.addr);
+    } else {
+        // Incompressible block, stored raw within the same region
+        block.compLen = loc.len;
+        status = fullPwrite(fd, reinterpret_cast<const void*>(loc.addr), loc.len, rem.addr);
+    }
+    if (status == NIXL_SUCCESS)
+        engine_->recordCompBlock(fd, rem.addr, block);
+    return status;
+}
+
+nixl_status_t nixlPosixBackendReqH::compReadOp(int op_idx) {
+    const nixlMetaDesc &loc = local[op_idx];
+    const nixlMetaDesc &rem = remote[op_idx];
+    const int fd = static_cast<int>(rem.devId);
+
+    nixlPosixCompBlock block;
+    if (!engine_->lookupCompBlock(fd, rem.addr, block) || block.compLen == block.rawLen) {
+        // Stored raw, or written without the transform: plain read
+        return fullPread(fd, reinterpret_cast<void*>(loc.addr), loc.len, rem.addr);
+    }
+
+    if (block.rawLen > loc.len) {
+        NIXL_ERROR << absl::StrFormat(
+            "Compressed block of %zu raw bytes does not fit destination of %zu",
+            block.rawLen, loc.len);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    std::vector<uint8_t> buf(block.compLen);
+    nixl_status_t status = fullPread(fd, buf.data(), block.compLen, rem.addr);
+    if (status != NIXL_SUCCESS)
+        return status;
+
+    const size_t raw_len = nixlLzDecompress(buf.data(), block.compLen,
+                                            reinterpret_cast<void*>(loc.addr), loc.len);
+    if (raw_len != block.rawLen) {
+        NIXL_ERROR << absl::StrFormat("Corrupt compressed block at fd %d offset %zu",
+                                      fd, static_cast<size_t>(rem.addr));
+        return NIXL_ERR_BACKEND;
+    }
+    return NIXL_SUCCESS;
+}
+
+void nixlPosixBackendReqH::joinCompWorkers() {
+    for (auto &worker : compWorkers_)
+        if (worker.joinable())
+            worker.join();
+    compWorkers_.clear();
+}
+
 // -----------------------------------------------------------------------------
 // POSIX Engine Implementation
 // -----------------------------------------------------------------------------
 
 nixlPosixEngine::nixlPosixEngine(const nixlBackendInitParams* init_params)
     : nixlBackendEngine(init_params)
-    , queue_type_(getQueueType(init_params->customParams)) {
+    , queue_type_(getQueueType(init_params->customParams))
+    , uringConfig_(getUringConfig(init_params->customParams)) {
     if (queue_type_ == nixlPosixQueue::queue_t::UNSUPPORTED) {
         initErr = true;
         NIXL_ERROR << absl::StrFormat(
@@ -216,13 +453,61 @@ nixl_status_t nixlPosixEngine::registerMem(const nixlBlobDesc &mem,
                                            const nixl_mem_t &nixl_mem,
                                            nixlBackendMD* &out) {
     auto supported_mems = getSupportedMems();
-    if (std::find(supported_mems.begin(), supported_mems.end(), nixl_mem) != supported_mems.end())
-        return NIXL_SUCCESS;
+    if (std::find(supported_mems.begin(), supported_mems.end(), nixl_mem) == supported_mems.end())
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    auto md = std::make_unique<nixlPosixMetadata>();
+    md->memType_ = nixl_mem;
+    // File registrations always remember their fd, so compression block
+    // metadata can be dropped when the registration goes away
+    if (nixl_mem == FILE_SEG)
+        md->fd_ = static_cast<int>(mem.devId);
+
+    // With io_uring queues, remember the registration so new rings can pin
+    // it as a fixed buffer / fixed-file slot. Past the caps the entry is
+    // simply not tracked and its I/O uses the plain submission path
+    if (queue_type_ == nixlPosixQueue::queue_t::URING) {
+        std::lock_guard<std::mutex> lock(fixedResLock_);
+        if (nixl_mem == DRAM_SEG && fixedRes_.buffers.size() < maxFixedBufs_) {
+            md->addr_ = mem.addr;
+            md->len_ = mem.len;
+            md->tracked_ = true;
+            fixedRes_.buffers.push_back({reinterpret_cast<void*>(mem.addr), mem.len});
+        } else if (nixl_mem == FILE_SEG && fixedRes_.files.size() < maxFixedFiles_) {
+            md->fd_ = static_cast<int>(mem.devId);
+            md->tracked_ = true;
+            fixedRes_.files.push_back(md->fd_);
+        }
+    }
 
-    return NIXL_ERR_NOT_SUPPORTED;
+    out = md.release();
+    return NIXL_SUCCESS;
 }
 
-nixl_status_t nixlPosixEngine::deregisterMem(nixlBackendMD *) {
+nixl_status_t nixlPosixEngine::deregisterMem(nixlBackendMD *meta) {
+    auto md = static_cast<nixlPosixMetadata*>(meta);
+    if (md && md->tracked_) {
+        std::lock_guard<std::mutex> lock(fixedResLock_);
+        if (md->memType_ == DRAM_SEG) {
+            auto &bufs = fixedRes_.buffers;
+            for (auto it = bufs.begin(); it != bufs.end(); ++it) {
+                if (reinterpret_cast<uintptr_t>(it->iov_base) == md->addr_ &&
+                    it->iov_len == md->len_) {
+                    bufs.erase(it);
+                    break;
+                }
+            }
+        } else {
+            auto &files = fixedRes_.files;
+            auto it = std::find(files.begin(), files.end(), md->fd_);
+            if (it != files.end())
+                files.erase(it);
+        }
+    }
+    // Stale block shapes would corrupt reads if the fd number is reused
+    if (md && md->memType_ == FILE_SEG && md->fd_ >= 0)
+        dropCompBlocks(md->fd_);
+    delete md;
     return NIXL_SUCCESS;
 }
 
@@ -251,12 +536,28 @@ nixl_status_t nixlPosixEngine::prepXfer(const nixl_xfer_op_t &operation,
                 return NIXL_ERR_INVALID_PARAM;
         }
 
-        auto posix_handle = std::make_unique<nixlPosixBackendReqH>(operation, local, remote, opt_args, &params);
+        // Hold the registration lock while the handle builds its queue, so
+        // the ring pins a consistent snapshot of the fixed resource tables
+        std::unique_ptr<nixlPosixBackendReqH> posix_handle;
+        {
+            std::lock_guard<std::mutex> lock(fixedResLock_);
+            posix_handle = std::make_unique<nixlPosixBackendReqH>(operation, local, remote,
+                                                                  opt_args, &params, &fixedRes_,
+                                                                  uringConfig_, this);
+        }
         nixl_status_t status = posix_handle->prepXfer();
         if (status != NIXL_SUCCESS) {
             return status;
         }
 
+        // Track how well adjacent descriptors coalesced into larger ops;
+        // the ratio of the two counters is the merge ratio
+        if (posix_handle->opCount() < local.descCount()) {
+            addTelemetryEvent("posix_descs_total", local.descCount());
+            addTelemetryEvent("posix_descs_coalesced",
+                              local.descCount() - posix_handle->opCount());
+        }
+
         handle = posix_handle.release();
         return NIXL_SUCCESS;
     } catch (const nixlPosixBackendReqH::exception& e) {
@@ -18,38 +18,101 @@
 #ifndef POSIX_BACKEND_H
 #define POSIX_BACKEND_H
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 #include <absl/strings/str_format.h>
 #include "backend/backend_engine.h"
 #include "posix_queue.h"
 
+class nixlPosixEngine;
+
+// On-disk shape of one compressed block, kept by the engine keyed by
+// (fd, file offset) so the read path knows how many bytes to fetch and
+// what size to expand them to. compLen == rawLen marks a block that did
+// not compress and was stored raw.
+struct nixlPosixCompBlock {
+    size_t rawLen = 0;
+    size_t compLen = 0;
+};
+
+// Metadata kept per registration so deregisterMem can drop the matching
+// entry from the engine's fixed resource tables. tracked_ is false when
+// the entry was not added (registration limits hit, or AIO queues in use)
+class nixlPosixMetadata : public nixlBackendMD {
+public:
+    nixl_mem_t memType_;
+    uintptr_t  addr_ = 0;     // DRAM_SEG registrations
+    size_t     len_ = 0;
+    int        fd_ = -1;      // FILE_SEG registrations
+    bool       tracked_ = false;
+
+    nixlPosixMetadata() : nixlBackendMD(true) {}
+};
+
 class nixlPosixBackendReqH : public nixlBackendReqH {
 private:
     const nixl_xfer_op_t            &operation;      // The transfer operation (read/write)
-    const nixl_meta_dlist_t         &local;          // Local memory descriptor list
-    const nixl_meta_dlist_t         &remote;         // Remote memory descriptor list
+    nixl_meta_dlist_t               local;           // Coalesced local descriptor list
+    nixl_meta_dlist_t               remote;          // Coalesced remote descriptor list
     const nixl_opt_b_args_t         *opt_args;       // Optional backend-specific arguments
     const nixl_b_params_t           *custom_params_; // Custom backend parameters
-    const int                       queue_depth_;    // Queue depth for async I/O
+    int                             queue_depth_;    // Queue depth for async I/O
+    const nixlPosixFixedRes         *fixed_res_;     // Engine fixed buffer/file tables
+    const nixlPosixUringConfig      uring_config_;   // io_uring submission tuning
     std::unique_ptr<nixlPosixQueue> queue;           // Async I/O queue instance
     const nixlPosixQueue::queue_t   queue_type_;     // Type of queue used
 
     nixl_status_t initQueues();                      // Initialize async I/O queue
 
+    // Compression transform state (opted into per request with
+    // customParam "compress"): the async queue is bypassed and a small
+    // worker pool compresses each chunk and issues its pwrite directly,
+    // so compression of one chunk overlaps the I/O of the previous ones.
+    // Reads fetch the compressed bytes and expand them into place.
+    bool                     compress_ = false;
+    bool                     compIsWrite_ = false;
+    static constexpr size_t  compMaxWorkers_ = 4;
+    const nixlPosixEngine    *engine_ = nullptr;     // For the block shape map
+    std::vector<std::thread> compWorkers_;
+    std::atomic<uint32_t>    compNextOp_{0};
+    std::atomic<uint32_t>    compOpsDone_{0};
+    std::atomic<int>         compFailed_{0};
+    bool                     compRunning_ = false;
+
+    nixl_status_t postCompressed();
+    nixl_status_t checkCompressed();
+    void compWorker();
+    nixl_status_t compWriteOp(int op_idx);
+    nixl_status_t compReadOp(int op_idx);
+    void joinCompWorkers();
+
+    // Merge runs of descriptors that are contiguous both in memory and in
+    // the file into single larger operations (common for sequential spill)
+    void coalesceDescs(const nixl_meta_dlist_t &loc, const nixl_meta_dlist_t &rem);
+
 public:
     nixlPosixBackendReqH(const nixl_xfer_op_t &operation,
                          const nixl_meta_dlist_t &local,
                          const nixl_meta_dlist_t &remote,
                          const nixl_opt_b_args_t* opt_args,
-                         const nixl_b_params_t* custom_params);
-    ~nixlPosixBackendReqH() {};
+                         const nixl_b_params_t* custom_params,
+                         const nixlPosixFixedRes* fixed_res = nullptr,
+                         const nixlPosixUringConfig& uring_config = {},
+                         const nixlPosixEngine* engine = nullptr);
+    ~nixlPosixBackendReqH() { joinCompWorkers(); };
 
     nixl_status_t postXfer();
     nixl_status_t prepXfer();
     nixl_status_t checkXfer();
 
+    // Number of operations after coalescing, for merge-ratio telemetry
+    int opCount() const { return queue_depth_; }
+
     // Exception classes
     class exception: public std::exception {
         private:
@@ -65,6 +128,24 @@ class nixlPosixEngine : public nixlBackendEngine {
 private:
     const nixlPosixQueue::queue_t queue_type_;
 
+    // Registered resources handed to each io_uring queue at creation:
+    // DRAM regions become fixed buffers, file descriptors go into the
+    // fixed-file table. Bounded so we stay within kernel registration
+    // limits; registrations past the cap simply use the plain I/O path
+    static constexpr size_t maxFixedBufs_ = 1024; // UIO_MAXIOV
+    static constexpr size_t maxFixedFiles_ = 1024;
+    mutable std::mutex fixedResLock_;
+    nixlPosixFixedRes fixedRes_;
+
+    // Submission-side io_uring tuning parsed once from the init params
+    const nixlPosixUringConfig uringConfig_;
+
+    // Block metadata of the compression transform: what shape each
+    // compressed block has on disk, keyed by (fd, file offset). Entries
+    // for an fd are dropped when its registration goes away
+    mutable std::mutex compLock_;
+    mutable std::map<std::pair<int, uint64_t>, nixlPosixCompBlock> compBlocks_;
+
 public:
     nixlPosixEngine(const nixlBackendInitParams* init_params);
     virtual ~nixlPosixEngine() = default;
@@ -127,6 +208,27 @@ public:
         output = input;
         return NIXL_SUCCESS;
     }
+
+    void recordCompBlock(int fd, uint64_t offset, const nixlPosixCompBlock &block) const {
+        std::lock_guard<std::mutex> lock(compLock_);
+        compBlocks_[{fd, offset}] = block;
+    }
+
+    bool lookupCompBlock(int fd, uint64_t offset, nixlPosixCompBlock &block) const {
+        std::lock_guard<std::mutex> lock(compLock_);
+        auto it = compBlocks_.find({fd, offset});
+        if (it == compBlocks_.end())
+            return false;
+        block = it->second;
+        return true;
+    }
+
+    void dropCompBlocks(int fd) const {
+        std::lock_guard<std::mutex> lock(compLock_);
+        auto it = compBlocks_.lower_bound({fd, 0});
+        while (it != compBlocks_.end() && it->first.first == fd)
+            it = compBlocks_.erase(it);
+    }
 };
 
 #endif // POSIX_BACKEND_H
@@ -19,6 +19,20 @@
 #include "posix_backend.h"
 #include "backend/backend_plugin.h"
 
+namespace {
+nixl_b_params_t
+get_posix_options() {
+    nixl_b_params_t params;
+    params["use_aio"] = "false";
+    params["use_uring"] = "false";
+    params["use_sqpoll"] = "false";
+    params["sqpoll_idle_ms"] = "100";
+    params["uring_num_rings"] = "0"; // 0 = one ring per NUMA node
+
+    return params;
+}
+} // namespace
+
 // Plugin type alias for convenience
 using posix_plugin_t = nixlBackendPluginCreator<nixlPosixEngine>;
 
@@ -26,13 +40,13 @@ using posix_plugin_t = nixlBackendPluginCreator<nixlPosixEngine>;
 nixlBackendPlugin *
 createStaticPOSIXPlugin() {
     return posix_plugin_t::create(
-        NIXL_PLUGIN_API_VERSION, "POSIX", "0.1.0", {}, {DRAM_SEG, FILE_SEG});
+        NIXL_PLUGIN_API_VERSION, "POSIX", "0.1.0", get_posix_options(), {DRAM_SEG, FILE_SEG});
 }
 #else
 extern "C" NIXL_PLUGIN_EXPORT nixlBackendPlugin *
 nixl_plugin_init() {
     return posix_plugin_t::create(
-        NIXL_PLUGIN_API_VERSION, "POSIX", "0.1.0", {}, {DRAM_SEG, FILE_SEG});
+        NIXL_PLUGIN_API_VERSION, "POSIX", "0.1.0", get_posix_options(), {DRAM_SEG, FILE_SEG});
 }
 
 extern "C" NIXL_PLUGIN_EXPORT void
@@ -21,6 +21,30 @@
 #include "nixl_types.h"
 #include "backend/backend_aux.h"
 #include <sys/types.h>
+#include <sys/uio.h>
+#include <vector>
+
+// Resources registered with the engine that a queue may pin into the kernel
+// at creation time: DRAM regions registered as io_uring fixed buffers and
+// file descriptors kept in the fixed-file table. Queues that cannot make use
+// of them (AIO) simply ignore the tables.
+struct nixlPosixFixedRes {
+    std::vector<iovec> buffers;
+    std::vector<int>   files;
+};
+
+// io_uring submission-side tuning, parsed from the plugin's init params.
+// With sqpoll enabled the kernel polls the submission queue from its own
+// thread (IORING_SETUP_SQPOLL), so io_uring_submit avoids the syscall as
+// long as the poller has not idled out.
+struct nixlPosixUringConfig {
+    bool     sqpoll = false;
+    unsigned sqpoll_idle_ms = 100; // sq_thread_idle before the poller sleeps
+    // Number of rings a request's operations are sharded across, routed by
+    // the NUMA node of each source buffer. 0 picks one ring per NUMA node
+    // of the host; 1 keeps the single-ring behavior
+    unsigned num_rings = 0;
+};
 
 // Abstract base class for async I/O operations
 class nixlPosixQueue {
@@ -39,26 +39,51 @@ namespace {
     template <typename Mode, typename Enable = void>
     struct funcImpl;
 
+// The enabled specialization names io_uring types, flags and queue classes
+// that only exist when liburing headers are present. Those are non-dependent
+// names, so the compiler rejects them at parse time even though the
+// specialization is never instantiated in the AIO-only build — keep the
+// whole specialization behind the guard.
+#ifdef HAVE_LIBURING
     template <typename Mode>
     struct funcImpl<Mode, std::enable_if_t<std::is_same<Mode, uringEnabled>::value>> {
-        static std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation) {
-            // Initialize io_uring parameters with basic configuration
-            // Start with basic parameters, no special flags
-            // We can add optimizations like SQPOLL later
+        static std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation,
+                                                                const nixl_meta_dlist_t &local,
+                                                                const nixl_meta_dlist_t &remote,
+                                                                const nixlPosixFixedRes* fixed_res,
+                                                                const nixlPosixUringConfig& uring_cfg) {
             struct io_uring_params params = {};
-            return std::make_unique<class UringQueue>(num_entries, params, operation);
+            if (uring_cfg.sqpoll) {
+                params.flags |= IORING_SETUP_SQPOLL;
+                params.sq_thread_idle = uring_cfg.sqpoll_idle_ms;
+            }
+            unsigned num_rings = UringShardedQueue::resolveNumRings(uring_cfg, num_entries);
+            if (num_rings > 1) {
+                return std::make_unique<UringShardedQueue>(num_rings, params, operation,
+                                                           local, remote, fixed_res);
+            }
+            return std::make_unique<UringQueue>(num_entries, params, operation, fixed_res);
         }
 
         static bool isUringAvailable() {
             return true;
         }
     };
+#endif
 
     template <typename Mode>
     struct funcImpl<Mode, std::enable_if_t<std::is_same<Mode, uringDisabled>::value>> {
-        static std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation) {
+        static std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation,
+                                                                const nixl_meta_dlist_t &local,
+                                                                const nixl_meta_dlist_t &remote,
+                                                                const nixlPosixFixedRes* fixed_res,
+                                                                const nixlPosixUringConfig& uring_cfg) {
             (void)num_entries;
             (void)operation;
+            (void)local;
+            (void)remote;
+            (void)fixed_res;
+            (void)uring_cfg;
             throw nixlPosixBackendReqH::exception("Attempting to create io_uring queue when support is not compiled in",
                                                   NIXL_ERR_NOT_SUPPORTED);
         }
@@ -74,8 +99,13 @@ std::unique_ptr<nixlPosixQueue> QueueFactory::createAioQueue(int num_entries, ni
     return std::make_unique<aioQueue>(num_entries, operation);
 }
 
-std::unique_ptr<nixlPosixQueue> QueueFactory::createUringQueue(int num_entries, nixl_xfer_op_t operation) {
-    return funcImpl<uringMode>::createUringQueue(num_entries, operation);
+std::unique_ptr<nixlPosixQueue> QueueFactory::createUringQueue(int num_entries, nixl_xfer_op_t operation,
+                                                               const nixl_meta_dlist_t &local,
+                                                               const nixl_meta_dlist_t &remote,
+                                                               const nixlPosixFixedRes* fixed_res,
+                                                               const nixlPosixUringConfig& uring_cfg) {
+    return funcImpl<uringMode>::createUringQueue(num_entries, operation, local, remote,
+                                                 fixed_res, uring_cfg);
 }
 
 bool QueueFactory::isUringAvailable() {
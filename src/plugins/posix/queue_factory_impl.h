@@ -23,7 +23,13 @@
 namespace QueueFactory {
     std::unique_ptr<nixlPosixQueue> createAioQueue(int num_entries, nixl_xfer_op_t operation);
 
-    std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation);
+    // The descriptor lists are consulted up front so multi-ring configs can
+    // shard the operations by buffer NUMA node at queue creation
+    std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation,
+                                                     const nixl_meta_dlist_t &local,
+                                                     const nixl_meta_dlist_t &remote,
+                                                     const nixlPosixFixedRes* fixed_res = nullptr,
+                                                     const nixlPosixUringConfig& uring_cfg = {});
 
     bool isUringAvailable();
 };
@@ -19,6 +19,7 @@
 #define URING_QUEUE_H
 
 #include <liburing.h>
+#include <memory>
 #include "posix_queue.h"
 #include <absl/strings/str_format.h>
 
@@ -34,10 +35,30 @@ class UringQueue : public nixlPosixQueue {
         const int num_entries;         // Total number of entries expected in this ring
         int num_completed;             // Number of completed operations so far
         io_uring_prep_func_t prep_op;  // Pointer to prep function
+        const bool is_read;            // Whether this queue issues reads or writes
+
+        // Snapshot of the engine's registered resources, pinned into this
+        // ring at creation. Lookup failures or registration errors fall back
+        // to the unregistered prep path per operation.
+        std::vector<iovec> fixed_bufs;
+        std::vector<int>   fixed_files;
+        bool bufs_registered;          // io_uring_register_buffers succeeded
+        bool files_registered;         // io_uring_register_files succeeded
 
         // Initialize the queue with the given parameters
         nixl_status_t init(int num_entries, const struct io_uring_params& params);
 
+        // Register the fixed resource snapshot with the ring, clearing the
+        // corresponding flag (falling back to plain submission) on failure
+        void registerFixedRes(const nixlPosixFixedRes& fixed_res);
+
+        // Index of the registered buffer fully containing [buf, buf+len),
+        // or -1 when the range is not covered by a single fixed buffer
+        int fixedBufIndex(const void* buf, size_t len) const;
+
+        // Slot of fd in the fixed-file table, or -1 when not registered
+        int fixedFileIndex(int fd) const;
+
         // Delete copy and move operations to prevent accidental copying of kernel resources
         UringQueue(const UringQueue&) = delete;
         UringQueue& operator=(const UringQueue&) = delete;
@@ -45,7 +66,8 @@ class UringQueue : public nixlPosixQueue {
         UringQueue& operator=(UringQueue&&) = delete;
 
     public:
-        UringQueue(int num_entries, const struct io_uring_params& params, nixl_xfer_op_t operation);
+        UringQueue(int num_entries, const struct io_uring_params& params, nixl_xfer_op_t operation,
+                   const nixlPosixFixedRes* fixed_res = nullptr);
         ~UringQueue();
         nixl_status_t
         submit (const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote) override;
@@ -53,4 +75,38 @@ class UringQueue : public nixlPosixQueue {
         nixl_status_t prepIO(int fd, void* buf, size_t len, off_t offset) override;
 };
 
+// Fans one request's operations out across several rings, routing each
+// operation to a shard by the NUMA node of its DRAM buffer. A single ring
+// funnels every completion through one core; on multi-socket hosts the
+// per-node shards keep submission and completion processing local to the
+// memory being moved. The operation-to-shard split is fixed at creation,
+// so each shard is a plain UringQueue sized to exactly its share.
+class UringShardedQueue : public nixlPosixQueue {
+    private:
+        std::vector<std::unique_ptr<UringQueue>> shards;
+        std::vector<nixl_meta_dlist_t> shard_local;
+        std::vector<nixl_meta_dlist_t> shard_remote;
+
+        UringShardedQueue(const UringShardedQueue&) = delete;
+        UringShardedQueue& operator=(const UringShardedQueue&) = delete;
+        UringShardedQueue(UringShardedQueue&&) = delete;
+        UringShardedQueue& operator=(UringShardedQueue&&) = delete;
+
+    public:
+        UringShardedQueue(unsigned num_rings, const struct io_uring_params& params,
+                          nixl_xfer_op_t operation,
+                          const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote,
+                          const nixlPosixFixedRes* fixed_res = nullptr);
+
+        // Effective ring count for a request of num_entries operations:
+        // the configured value (0 means one per NUMA node), never more
+        // than the operation count
+        static unsigned resolveNumRings(const nixlPosixUringConfig& uring_cfg, int num_entries);
+
+        nixl_status_t
+        submit (const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote) override;
+        nixl_status_t checkCompleted() override;
+        nixl_status_t prepIO(int fd, void* buf, size_t len, off_t offset) override;
+};
+
 #endif // URING_QUEUE_H
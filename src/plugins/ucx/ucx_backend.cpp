@@ -16,14 +16,26 @@
  */
 
 #include "ucx_backend.h"
+#include "common/nixl_affinity.h"
 #include "common/nixl_log.h"
+#include "common/nixl_gpu_addr_cache.h"
+#include "common/nixl_probes.h"
+#include "common/object_pool.h"
+#include "common/progress_executor.h"
 #include "serdes/serdes.h"
 #include "common/nixl_log.h"
 #include "ucx/gpu_xfer_req_h.h"
 
+#include <algorithm>
+#include <fstream>
 #include <optional>
 #include <limits>
+#include <set>
 #include <future>
+#include <string_view>
+#include <climits>
+#include <cstdlib>
+#include <dirent.h>
 #include <string.h>
 #include <unistd.h>
 #include "absl/strings/numbers.h"
@@ -136,9 +148,21 @@ public:
 static int cudaQueryAddr(void *address, bool &is_dev,
                          CUdevice &dev, CUcontext &ctx)
 {
+    // Attribute lookups go through the process-wide VA-range cache, so a
+    // multi-descriptor registration hits the driver once per allocation
+    nixlGpuAddrAttrs cached;
+    if (nixlGpuAddrCache::instance().lookup(address, cached)) {
+        is_dev = cached.isDev;
+        dev = (CUdevice)cached.dev;
+        ctx = (CUcontext)cached.ctx;
+        return 0;
+    }
+
     CUmemorytype mem_type = CU_MEMORYTYPE_HOST;
     uint32_t is_managed = 0;
-#define NUM_ATTRS 4
+    CUdeviceptr range_base = 0;
+    size_t range_size = 0;
+#define NUM_ATTRS 6
     CUpointer_attribute attr_type[NUM_ATTRS];
     void *attr_data[NUM_ATTRS];
     CUresult result;
@@ -151,11 +175,25 @@ static int cudaQueryAddr(void *address, bool &is_dev,
     attr_data[2] = &dev;
     attr_type[3] = CU_POINTER_ATTRIBUTE_CONTEXT;
     attr_data[3] = &ctx;
+    attr_type[4] = CU_POINTER_ATTRIBUTE_RANGE_START_ADDR;
+    attr_data[4] = &range_base;
+    attr_type[5] = CU_POINTER_ATTRIBUTE_RANGE_SIZE;
+    attr_data[5] = &range_size;
 
-    result = cuPointerGetAttributes(4, attr_type, attr_data, (CUdeviceptr)address);
+    result = cuPointerGetAttributes(NUM_ATTRS, attr_type, attr_data, (CUdeviceptr)address);
 
     is_dev = (mem_type == CU_MEMORYTYPE_DEVICE);
 
+    // Cache the whole allocation the descriptor falls in, so sibling
+    // descriptors of the same allocation don't query the driver again
+    if ((CUDA_SUCCESS == result) && is_dev && range_base && range_size) {
+        nixlGpuAddrAttrs attrs;
+        attrs.isDev = is_dev;
+        attrs.dev = (int)dev;
+        attrs.ctx = (void *)ctx;
+        nixlGpuAddrCache::instance().insert((void *)range_base, range_size, attrs);
+    }
+
     return (CUDA_SUCCESS != result);
 }
 
@@ -272,6 +310,13 @@ void nixlUcxEngine::vramFiniCtx()
 class nixlUcxIntReq {
 public:
     std::unique_ptr<std::string> amBuffer;
+    // Payload bytes of this request, for abort-time reporting of what
+    // completed; 0 for control requests (flush, notifications)
+    size_t xferSize = 0;
+    // Index of the descriptor this request carries, into the posted
+    // lists, for failed-subset attribution; UINT32_MAX for control
+    // requests
+    uint32_t descIdx = UINT32_MAX;
 
     bool
     is_complete() const {
@@ -328,18 +373,29 @@ static void _internalRequestReset(nixlUcxIntReq *req) {
  * Backend request management
 *****************************************/
 
-class nixlUcxBackendH : public nixlBackendReqH {
+class nixlUcxBackendH : public nixlBackendReqH, public nixlPooledObject<nixlUcxBackendH> {
 private:
     std::vector<nixlUcxIntReq *> requests_;
     nixlUcxWorker *worker;
     size_t worker_id;
+    // Whether this handle is counted in the engine's per-worker depth
+    bool in_flight_ = false;
+    // Bytes of requests that completed inline at post time, folded into
+    // the abort-time transferred-bytes report
+    size_t completedBytes_ = 0;
 
     // Notification to be sent after completion of all requests
     struct Notif {
 	    std::string agent;
 	    nixl_blob_t payload;
-	    Notif(const std::string& remote_agent, const nixl_blob_t& msg)
-		    : agent(remote_agent), payload(msg) {}
+	    // Trace context riding with the notification; empty when unused
+	    nixl_blob_t trace;
+	    // Connection slot captured at post time so checkXfer resolves the
+	    // connection by index rather than hashing the agent name
+	    size_t conn_id;
+	    Notif(const std::string& remote_agent, const nixl_blob_t& msg,
+		  const nixl_blob_t& trace, size_t conn_id)
+		    : agent(remote_agent), payload(msg), trace(trace), conn_id(conn_id) {}
     };
     std::optional<Notif> notif;
 
@@ -362,11 +418,31 @@ public:
         requests_.push_back(req);
     }
 
+    void
+    addCompletedBytes(size_t bytes) {
+        completedBytes_ += bytes;
+    }
+
     virtual bool
     isComposite() const {
         return false;
     }
 
+    // Best-effort cancel: incomplete requests are canceled through UCX,
+    // while completed ones and inline completions are tallied into
+    // bytes_transferred. The handle stays intact for releaseReqH.
+    virtual nixl_status_t
+    abort(size_t &bytes_transferred) {
+        bytes_transferred = completedBytes_;
+        for (nixlUcxIntReq *req : requests_) {
+            if (req->is_complete())
+                bytes_transferred += req->xferSize;
+            else
+                worker->reqCancel((nixlUcxReq)req);
+        }
+        return NIXL_SUCCESS;
+    }
+
     virtual nixl_status_t
     release() {
         // TODO: Error log: uncompleted requests found! Cancelling ...
@@ -383,16 +459,33 @@ public:
         return NIXL_SUCCESS;
     }
 
+    // Descriptors whose requests are still held by the handle, i.e. not
+    // observed complete: status() releases completed requests as it sees
+    // them, so once the handle is in a terminal error state the remainder
+    // is exactly the subset that did not finish
+    void
+    getFailedDescs(std::vector<size_t> &indices) const {
+        for (const nixlUcxIntReq *req : requests_) {
+            if (!req->is_complete() && (req->descIdx != UINT32_MAX)) {
+                indices.push_back(req->descIdx);
+            }
+        }
+    }
+
+    // do_progress=false harvests completion flags only, for callers that
+    // have already driven this handle's worker (see checkXferBatch)
     virtual nixl_status_t
-    status() {
+    status(bool do_progress = true) {
         if (requests_.empty()) {
             /* No pending transmissions */
             return NIXL_SUCCESS;
         }
 
         /* Maximum progress */
-        while (worker->progress())
-            ;
+        if (do_progress) {
+            while (worker->progress())
+                ;
+        }
 
         /* Go over all request updating their status */
         nixl_status_t out_ret = NIXL_SUCCESS;
@@ -444,6 +537,16 @@ public:
     size_t getWorkerId() const {
         return worker_id;
     }
+
+    bool
+    inFlight() const {
+        return in_flight_;
+    }
+
+    void
+    setInFlight(bool in_flight) {
+        in_flight_ = in_flight;
+    }
 };
 
 /****************************************
@@ -503,6 +606,7 @@ public:
     void
     operator()() {
         tlsThread() = this;
+        nixlAffinity::applyToSelf(engine_->getProgressCpuset());
         init_();
         threadActive_->set_value();
         run();
@@ -544,8 +648,10 @@ public:
     nixlUcxSharedThread(const nixlUcxEngine *engine,
                         std::function<void()> init,
                         size_t num_workers,
-                        nixlTime::us_t delay)
-        : nixlUcxThread(engine, std::move(init), num_workers) {
+                        nixlTime::us_t delay,
+                        nixlTime::us_t spin = 0)
+        : nixlUcxThread(engine, std::move(init), num_workers),
+          spin_(std::chrono::microseconds(spin)) {
         if (pipe(controlPipe_) < 0) {
             throw std::runtime_error("Couldn't create progress thread control pipe");
         }
@@ -589,6 +695,29 @@ protected:
         bool timeout = true;
         bool pthr_stop = false;
         while (!pthr_stop) {
+            /* Spin phase: while transfers are completing, keep driving the
+             * workers without arming them, extending the budget after every
+             * completed pass. Once the budget expires without progress, fall
+             * through to the arm/poll path below so an idle agent costs no
+             * CPU. The control pipe is only checked after poll(), so shutdown
+             * can be delayed by at most one spin budget. */
+            if (spin_.count() > 0) {
+                auto deadline = std::chrono::steady_clock::now() + spin_;
+                do {
+                    bool progressed = false;
+                    for (nixlUcxWorker *worker : getWorkers()) {
+                        while (worker->progress())
+                            progressed = true;
+                    }
+                    if (progressed) {
+                        deadline = std::chrono::steady_clock::now() + spin_;
+                        /* Events may have fired while spinning; re-arm every
+                         * worker before blocking */
+                        timeout = true;
+                    }
+                } while (std::chrono::steady_clock::now() < deadline);
+            }
+
             for (size_t i = 0; i < pollFds_.size() - 1; i++) {
                 if (!(pollFds_[i].revents & POLLIN) && !timeout) continue;
                 pollFds_[i].revents = 0;
@@ -622,6 +751,7 @@ protected:
 
 private:
     std::chrono::milliseconds delay_;
+    std::chrono::microseconds spin_;
     int controlPipe_[2];
     std::vector<pollfd> pollFds_;
 };
@@ -633,8 +763,13 @@ nixlUcxThreadEngine::nixlUcxThreadEngine(const nixlBackendInitParams &init_param
     }
 
     size_t num_workers = getWorkers().size();
+    nixlTime::us_t spin = nixl_b_params_get(init_params.customParams, "pthr_spin_us", 0);
     thread_ = std::make_unique<nixlUcxSharedThread>(
-        this, [this]() { nixlUcxEngine::vramApplyCtx(); }, num_workers, init_params.pthrDelay);
+        this,
+        [this]() { nixlUcxEngine::vramApplyCtx(); },
+        num_workers,
+        init_params.pthrDelay,
+        spin);
     for (size_t i = 0; i < num_workers; i++) {
         thread_->addWorker(getWorkers()[i].get(), i);
     }
@@ -673,6 +808,58 @@ nixlUcxThreadEngine::getNotifs(notif_list_t &notif_list) {
     return NIXL_SUCCESS;
 }
 
+/****************************************
+ * Shared executor engine
+ ****************************************/
+
+nixlUcxExecutorEngine::nixlUcxExecutorEngine(const nixlBackendInitParams &init_params)
+    : nixlUcxEngine(init_params),
+      executor_(init_params.progressExecutor) {
+    if (!nixlUcxMtLevelIsSupported(nixl_ucx_mt_t::WORKER)) {
+        throw std::invalid_argument("UCX library does not support multi-threading");
+    }
+
+    pollerId_ = executor_->addPoller([this]() { return progressOnce(); });
+}
+
+nixlUcxExecutorEngine::~nixlUcxExecutorEngine() {
+    // Returns only once the poller cannot be running anymore
+    executor_->removePoller(pollerId_);
+}
+
+bool
+nixlUcxExecutorEngine::progressOnce() {
+    // Executor threads are shared, so the CUDA context is (re)applied
+    // from the poller itself when it changes
+    if (ctxReapply_.exchange(false))
+        nixlUcxEngine::vramApplyCtx();
+    return progress() > 0;
+}
+
+int
+nixlUcxExecutorEngine::vramApplyCtx() {
+    ctxReapply_ = true;
+    return nixlUcxEngine::vramApplyCtx();
+}
+
+void
+nixlUcxExecutorEngine::appendNotif(std::string remote_name, std::string msg) {
+    // Unlike the dedicated thread engine, the notification can arrive on
+    // any executor thread, so it always goes through the locked list
+    const std::lock_guard<std::mutex> lock(notifMtx_);
+    notifExec_.push_back(std::make_pair(std::move(remote_name), std::move(msg)));
+}
+
+nixl_status_t
+nixlUcxExecutorEngine::getNotifs(notif_list_t &notif_list) {
+    if (!notif_list.empty()) return NIXL_ERR_INVALID_PARAM;
+
+    getNotifsImpl(notif_list);
+    const std::lock_guard<std::mutex> lock(notifMtx_);
+    moveNotifList(notifExec_, notif_list);
+    return NIXL_SUCCESS;
+}
+
 /****************************************
  * Threadpool engine
  ****************************************/
@@ -702,7 +889,7 @@ public:
     complete(nixl_status_t status);
 
     nixl_status_t
-    status() override;
+    status(bool do_progress = true) override;
 
     friend std::ostream &
     operator<<(std::ostream &os, const nixlUcxChunkBackendH &chunk) {
@@ -747,11 +934,11 @@ nixlUcxChunkBackendH::complete(nixl_status_t status) {
 }
 
 nixl_status_t
-nixlUcxChunkBackendH::status() {
+nixlUcxChunkBackendH::status(bool do_progress) {
     // First check if entire request was cancelled or failed
     nixl_status_t status = sharedState_->status.load();
     if (status == NIXL_SUCCESS) {
-        status = nixlUcxBackendH::status();
+        status = nixlUcxBackendH::status(do_progress);
     }
     return status;
 }
@@ -803,6 +990,14 @@ public:
         return true;
     }
 
+    nixl_status_t
+    abort(size_t &bytes_transferred) override {
+        // Chunks are owned by the threadpool workers; canceling them from
+        // outside would race their progress loops
+        bytes_transferred = 0;
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
     nixl_status_t
     release() override {
         NIXL_TRACE << *this << " releasing";
@@ -819,15 +1014,17 @@ public:
     }
 
     nixl_status_t
-    status() override {
-        while (getWorker()->progress())
-            ;
+    status(bool do_progress = true) override {
+        if (do_progress) {
+            while (getWorker()->progress())
+                ;
+        }
 
         if (sharedState_->pendingReqs.load()) {
             return NIXL_IN_PROG;
         }
 
-        nixl_status_t status = nixlUcxBackendH::status();
+        nixl_status_t status = nixlUcxBackendH::status(do_progress);
         if (status != NIXL_SUCCESS) {
             return status;
         }
@@ -853,8 +1050,11 @@ private:
 
 class nixlUcxDedicatedThread : public nixlUcxThread {
 public:
-    nixlUcxDedicatedThread(nixlUcxEngine *engine, std::function<void()> init, asio::io_context &io)
+    nixlUcxDedicatedThread(nixlUcxThreadPoolEngine *engine,
+                           std::function<void()> init,
+                           asio::io_context &io)
         : nixlUcxThread(engine, std::move(init), 1),
+          pool_(engine),
           io_(io) {}
 
     static nixlUcxDedicatedThread *
@@ -867,18 +1067,29 @@ public:
         requests_.push_back(handle);
     }
 
+    // Asks the thread to exit once its in-flight requests are drained; the
+    // run loop observes the flag within one idle wait period
+    void
+    requestStop() {
+        stopRequested_.store(true, std::memory_order_relaxed);
+    }
+
 protected:
     void
     run() override {
         auto guard = asio::make_work_guard(io_);
+        stopRequested_.store(false, std::memory_order_relaxed);
         NIXL_DEBUG << "dedicated " << *this << " running";
 
         while (!io_.stopped()) {
+            if (stopRequested_.load(std::memory_order_relaxed) && requests_.empty()) {
+                break;
+            }
             if (!requests_.empty()) {
                 io_.poll_one();
             } else {
                 NIXL_TRACE << "dedicated " << *this << " waiting for requests";
-                io_.run_one();
+                io_.run_one_for(std::chrono::milliseconds(10));
             }
 
             if (requests_.empty()) {
@@ -891,6 +1102,7 @@ protected:
                     NIXL_TRACE << "dedicated " << *this << " completing " << *(*it)
                                << " with status: " << status;
                     (*it)->complete(status);
+                    pool_->chunkCompleted();
                     it = requests_.erase(it);
                 } else {
                     ++it;
@@ -901,9 +1113,10 @@ protected:
         if (!requests_.empty()) {
             NIXL_WARN << "dedicated " << *this << " dropping " << requests_.size()
                       << " requests on exit";
-            for (auto it = requests_.begin(); it != requests_.end();) {
+            for (auto it = requests_.begin(); it != requests_.end(); ++it) {
                 NIXL_INFO << "dropping " << *(*it);
                 (*it)->complete(NIXL_ERR_BACKEND);
+                pool_->chunkCompleted();
             }
             requests_.clear();
         }
@@ -912,8 +1125,10 @@ protected:
     }
 
 private:
+    nixlUcxThreadPoolEngine *pool_;
     asio::io_context &io_;
     std::vector<nixlUcxChunkBackendH *> requests_;
+    std::atomic<bool> stopRequested_{false};
 };
 
 nixlUcxThreadPoolEngine::nixlUcxThreadPoolEngine(const nixlBackendInitParams &init_params)
@@ -923,12 +1138,19 @@ nixlUcxThreadPoolEngine::nixlUcxThreadPoolEngine(const nixlBackendInitParams &in
     NIXL_ASSERT(numSharedWorkers_ > 0);
 
     splitBatchSize_ = nixl_b_params_get(init_params.customParams, "split_batch_size", 1024);
+    minDedicatedThreads_ =
+        std::min((size_t)nixl_b_params_get(init_params.customParams, "min_threads", 1),
+                 num_threads);
+    poolGrowBacklog_ = nixl_b_params_get(init_params.customParams, "pool_grow_backlog", 2);
+    poolShrinkIdleUs_ =
+        nixl_b_params_get(init_params.customParams, "pool_shrink_idle_us", 5000000);
 
     auto init = [this]() { nixlUcxEngine::vramApplyCtx(); };
 
     if (init_params.enableProgTh) {
+        nixlTime::us_t spin = nixl_b_params_get(init_params.customParams, "pthr_spin_us", 0);
         sharedThread_ = std::make_unique<nixlUcxSharedThread>(
-            this, init, numSharedWorkers_, init_params.pthrDelay);
+            this, init, numSharedWorkers_, init_params.pthrDelay, spin);
         for (size_t i = 0; i < numSharedWorkers_; i++) {
             sharedThread_->addWorker(getWorkers()[i].get(), i);
         }
@@ -938,6 +1160,8 @@ nixlUcxThreadPoolEngine::nixlUcxThreadPoolEngine(const nixlBackendInitParams &in
     if (num_threads > 0) {
         io_.reset(new asio::io_context());
         dedicatedThreads_.reserve(num_threads);
+        // All threads start up for burst readiness; the pool shrinks
+        // towards min_threads once traffic goes idle
         for (size_t i = 0; i < num_threads; ++i) {
             size_t worker_id = numSharedWorkers_ + i;
             dedicatedThreads_.emplace_back(
@@ -945,6 +1169,8 @@ nixlUcxThreadPoolEngine::nixlUcxThreadPoolEngine(const nixlBackendInitParams &in
             dedicatedThreads_.back()->addWorker(getWorker(worker_id).get(), worker_id);
             dedicatedThreads_.back()->start();
         }
+        activeDedicatedThreads_ = num_threads;
+        lastPoolActivityUs_.store(nixlTime::getUs(), std::memory_order_relaxed);
     }
 }
 
@@ -955,12 +1181,58 @@ nixlUcxThreadPoolEngine::~nixlUcxThreadPoolEngine() {
 
     if (io_) {
         io_->stop();
-        for (auto &thread : dedicatedThreads_) {
-            thread->join();
+        for (size_t i = 0; i < activeDedicatedThreads_; ++i) {
+            dedicatedThreads_[i]->join();
         }
     }
 }
 
+// Grows the pool by one thread when the posted-but-uncompleted chunk
+// backlog outpaces the active threads. Called from the posting path, so
+// an idle pool never grows.
+void
+nixlUcxThreadPoolEngine::adjustPoolSize() const {
+    std::lock_guard<std::mutex> lock(poolResizeMutex_);
+    uint64_t backlog = chunkBacklog_.load(std::memory_order_relaxed);
+    if ((activeDedicatedThreads_ < dedicatedThreads_.size()) &&
+        (backlog > poolGrowBacklog_ * activeDedicatedThreads_)) {
+        dedicatedThreads_[activeDedicatedThreads_]->start();
+        ++activeDedicatedThreads_;
+        addTelemetryEvent("ucx_pool_active_threads", activeDedicatedThreads_);
+        NIXL_INFO << "Thread pool grew to " << activeDedicatedThreads_
+                  << " dedicated thread(s), chunk backlog " << backlog;
+    }
+}
+
+// Retires the last active thread after a quiet period, one thread per
+// period so bursts shortly after a shrink still find most of the pool
+void
+nixlUcxThreadPoolEngine::shrinkIfIdle() const {
+    if (dedicatedThreads_.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(poolResizeMutex_);
+    if ((activeDedicatedThreads_ <= minDedicatedThreads_) ||
+        (chunkBacklog_.load(std::memory_order_relaxed) != 0)) {
+        return;
+    }
+
+    nixlTime::us_t now = nixlTime::getUs();
+    if (now - lastPoolActivityUs_.load(std::memory_order_relaxed) < poolShrinkIdleUs_) {
+        return;
+    }
+
+    auto *thread =
+        static_cast<nixlUcxDedicatedThread *>(dedicatedThreads_[activeDedicatedThreads_ - 1].get());
+    thread->requestStop();
+    thread->join();
+    --activeDedicatedThreads_;
+    lastPoolActivityUs_.store(now, std::memory_order_relaxed);
+    addTelemetryEvent("ucx_pool_active_threads", activeDedicatedThreads_);
+    NIXL_INFO << "Thread pool shrank to " << activeDedicatedThreads_ << " dedicated thread(s)";
+}
+
 nixl_status_t
 nixlUcxThreadPoolEngine::prepXfer(const nixl_xfer_op_t &operation,
                                   const nixl_meta_dlist_t &local,
@@ -1003,6 +1275,10 @@ nixlUcxThreadPoolEngine::sendXferRange(const nixl_xfer_op_t &operation,
     size_t chunk_size = comp_handle->getChunkSize();
     NIXL_TRACE << "sending " << *comp_handle;
 
+    chunkBacklog_.fetch_add(comp_handle->getNumChunks(), std::memory_order_relaxed);
+    lastPoolActivityUs_.store(nixlTime::getUs(), std::memory_order_relaxed);
+    adjustPoolSize();
+
     std::promise<void> promise;
     std::future<void> future = promise.get_future();
     std::atomic<size_t> remaining{comp_handle->getNumChunks()};
@@ -1024,6 +1300,7 @@ nixlUcxThreadPoolEngine::sendXferRange(const nixl_xfer_op_t &operation,
             if (ret != NIXL_SUCCESS) {
                 status.store(ret);
                 chunk_handle->complete(ret);
+                chunkCompleted();
             } else {
                 NIXL_TRACE << "dedicated " << *thread << " sent " << *chunk_handle;
                 thread->addRequest(chunk_handle);
@@ -1047,13 +1324,15 @@ nixlUcxThreadPoolEngine::vramApplyCtx() {
         sharedThread_->start();
     }
     if (io_) {
+        // Only the active prefix of the pool is running
+        std::lock_guard<std::mutex> lock(poolResizeMutex_);
         io_->stop();
-        for (auto &thread : dedicatedThreads_) {
-            thread->join();
+        for (size_t i = 0; i < activeDedicatedThreads_; ++i) {
+            dedicatedThreads_[i]->join();
         }
         io_->restart();
-        for (auto &thread : dedicatedThreads_) {
-            thread->start();
+        for (size_t i = 0; i < activeDedicatedThreads_; ++i) {
+            dedicatedThreads_[i]->start();
         }
     }
     return nixlUcxEngine::vramApplyCtx();
@@ -1077,12 +1356,128 @@ nixlUcxThreadPoolEngine::getNotifs(notif_list_t &notif_list) {
         progress();
     }
 
+    // The agent polls notifications periodically, which makes this a
+    // convenient place to retire idle pool threads
+    shrinkIfIdle();
+
     getNotifsImpl(notif_list);
     std::lock_guard<std::mutex> lock(notifMutex_);
     moveNotifList(notifThread_, notif_list);
     return NIXL_SUCCESS;
 }
 
+/****************************************
+ * Topology-aware device defaults
+ *****************************************/
+
+// When no device_list is given, pick the RDMA devices that are PCIe-closest
+// to the GPUs instead of letting traffic cross sockets. Proximity is scored
+// by how deep the NIC's and GPU's resolved sysfs device paths share a prefix
+// (same root complex / switch scores deeper than same machine), the sysfs
+// equivalent of the hwloc common-ancestor walk the libfabric plugin does —
+// without taking the hwloc dependency into this plugin.
+
+namespace {
+
+std::string
+sysfsRealPath(const std::string &link) {
+    char buf[PATH_MAX];
+    if (!realpath(link.c_str(), buf))
+        return "";
+    return buf;
+}
+
+// Number of whole path components two resolved sysfs device paths share
+size_t
+commonPathDepth(const std::string &a, const std::string &b) {
+    size_t depth = 0;
+    size_t n = std::min(a.size(), b.size());
+    for (size_t i = 0; (i < n) && (a[i] == b[i]); i++) {
+        if (a[i] == '/')
+            depth++;
+    }
+    return depth;
+}
+
+// Resolved device paths of the NVIDIA display/3D controllers on the bus
+std::vector<std::string>
+sysfsGpuPaths() {
+    std::vector<std::string> gpus;
+    DIR *dir = opendir("/sys/bus/pci/devices");
+    if (!dir)
+        return gpus;
+
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != nullptr) {
+        if (ent->d_name[0] == '.')
+            continue;
+        std::string base = std::string("/sys/bus/pci/devices/") + ent->d_name;
+        std::string vendor, dev_class;
+        std::ifstream vendor_f(base + "/vendor"), class_f(base + "/class");
+        if (!(vendor_f >> vendor) || !(class_f >> dev_class))
+            continue;
+        if ((vendor != "0x10de") || (dev_class.compare(0, 4, "0x03") != 0))
+            continue;
+        std::string path = sysfsRealPath(base);
+        if (!path.empty())
+            gpus.push_back(std::move(path));
+    }
+    closedir(dir);
+    return gpus;
+}
+
+// Returns the GPU-local subset of the RDMA devices, or an empty vector when
+// there is nothing to restrict (no GPUs, a single NIC, proximity unknown, or
+// every NIC equally close)
+std::vector<std::string>
+ucxTopoSelectDevices() {
+    std::vector<std::pair<std::string, std::string>> nics; // name, device path
+    DIR *dir = opendir("/sys/class/infiniband");
+    if (!dir)
+        return {};
+
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != nullptr) {
+        if (ent->d_name[0] == '.')
+            continue;
+        std::string path =
+            sysfsRealPath(std::string("/sys/class/infiniband/") + ent->d_name + "/device");
+        if (!path.empty())
+            nics.emplace_back(ent->d_name, std::move(path));
+    }
+    closedir(dir);
+
+    if (nics.size() < 2)
+        return {};
+    std::sort(nics.begin(), nics.end());
+
+    const std::vector<std::string> gpus = sysfsGpuPaths();
+    if (gpus.empty())
+        return {};
+
+    std::vector<size_t> scores;
+    size_t best = 0;
+    for (const auto &nic : nics) {
+        size_t score = 0;
+        for (const auto &gpu : gpus)
+            score = std::max(score, commonPathDepth(nic.second, gpu));
+        scores.push_back(score);
+        best = std::max(best, score);
+    }
+
+    std::vector<std::string> picked;
+    for (size_t i = 0; i < nics.size(); i++)
+        if (scores[i] == best)
+            picked.push_back(nics[i].first);
+
+    // All NICs equally close (single-socket boxes): nothing to restrict
+    if (picked.size() == nics.size())
+        return {};
+    return picked;
+}
+
+} // namespace
+
 /****************************************
  * Constructor/Destructor
  *****************************************/
@@ -1093,6 +1488,8 @@ nixlUcxEngine::create(const nixlBackendInitParams &init_params) {
     size_t num_threads = nixl_b_params_get(init_params.customParams, "num_threads", 0);
     if (num_threads > 0) {
         engine = new nixlUcxThreadPoolEngine(init_params);
+    } else if (init_params.enableProgTh && init_params.progressExecutor) {
+        engine = new nixlUcxExecutorEngine(init_params);
     } else if (init_params.enableProgTh) {
         engine = new nixlUcxThreadEngine(init_params);
     } else {
@@ -1110,9 +1507,26 @@ nixlUcxEngine::nixlUcxEngine(const nixlBackendInitParams &init_params)
     if (custom_params->count("device_list")!=0)
         devs = str_split((*custom_params)["device_list"], ", ");
 
+    // No explicit device list: default to the GPU-local NICs when PCIe
+    // proximity singles some out, and record the decision in the params
+    // so getBackendParams shows what was picked
+    if (devs.empty()) {
+        devs = ucxTopoSelectDevices();
+        if (!devs.empty()) {
+            const std::string joined = absl::StrJoin(devs, ",");
+            NIXL_INFO << "No device_list given; restricting UCX to GPU-local NICs"
+                      << " by PCIe proximity: " << joined;
+            if (setInitParam("device_list", joined) != NIXL_SUCCESS)
+                NIXL_DEBUG << "device_list already present in params, selection not recorded";
+        }
+    }
+
     size_t num_workers = nixl_b_params_get(custom_params, "num_workers", 1);
     size_t num_threads = nixl_b_params_get(custom_params, "num_threads", 0);
 
+    mrCacheBudget = nixl_b_params_get(custom_params, "mr_cache_size", size_t(0));
+    progressCpuset_ = init_params.progressCpuset;
+
     if (num_workers <= num_threads) {
         /* There must be at least one shared worker */
         num_workers = num_threads + 1;
@@ -1127,21 +1541,54 @@ nixlUcxEngine::nixlUcxEngine(const nixlBackendInitParams &init_params)
         err_handling_mode = ucx_err_mode_from_string(err_handling_mode_it->second);
     }
 
+    // Per-backend-handle override of the context-wide eager/rendezvous
+    // switch point; applies to all workers of this engine
+    std::string rndv_thresh;
+    const auto rndv_it = custom_params->find("rndv_thresh");
+    if (rndv_it != custom_params->end()) {
+        rndv_thresh = rndv_it->second;
+    }
+
     uc = std::make_unique<nixlUcxContext>(devs,
                                           sizeof(nixlUcxIntReq),
                                           _internalRequestInit,
                                           _internalRequestFini,
                                           init_params.enableProgTh,
                                           num_workers,
-                                          init_params.syncMode);
+                                          init_params.syncMode,
+                                          rndv_thresh);
 
     for (size_t i = 0; i < num_workers; i++) {
         uws.emplace_back(std::make_unique<nixlUcxWorker>(*uc, err_handling_mode));
     }
 
+    pinnedWorkers_ = std::make_unique<std::atomic<bool>[]>(uws.size());
+    workerDepths_ = std::make_unique<std::atomic<uint64_t>[]>(uws.size());
+
+    notifBatchBytes_ = nixl_b_params_get(custom_params, "notif_batch_bytes", 0);
+    notifBatchDelayUs_ = nixl_b_params_get(custom_params, "notif_batch_delay_us", 500);
+    recvCompletion_ = nixl_b_params_get(custom_params, "enable_recv_completion", 0) != 0;
+
+    const auto eager_it = custom_params->find("am_eager_thresh");
+    if (eager_it != custom_params->end()) {
+        if (eager_it->second == "auto") {
+            amEagerMode_ = am_eager_mode_t::adaptive;
+        } else {
+            try {
+                amEagerThresh_ = std::stoul(eager_it->second);
+                amEagerMode_ = am_eager_mode_t::fixed;
+            }
+            catch (const std::exception &) {
+                NIXL_WARN << "Invalid am_eager_thresh value '" << eager_it->second
+                          << "', keeping always-eager notifications";
+            }
+        }
+    }
+
     auto &uw = uws.front();
     workerAddr = uw->epAddr();
     uw->regAmCallback(NOTIF_STR, notifAmCb, this);
+    uw->regAmCallback(NOTIF_BATCH, notifBatchAmCb, this);
 
     // Temp fixup
     if (getenv("NIXL_DISABLE_CUDA_ADDR_WA")) {
@@ -1168,10 +1615,31 @@ tlsSharedWorkerMap() {
     return map;
 }
 
+// Workers this thread owns exclusively through the "pin_worker" custom param.
+// Kept separate from tlsSharedWorkerMap so a pin by another thread cannot be
+// mistaken for our own.
+static std::unordered_map<const nixlUcxEngine *, size_t> &
+tlsPinnedWorkerMap() {
+    static thread_local std::unordered_map<const nixlUcxEngine *, size_t> map;
+    return map;
+}
+
 // Through parent destructor the unregister will be called.
 nixlUcxEngine::~nixlUcxEngine() {
+    /* Push out any notifications still waiting on their batch threshold */
+    if (notifBatchBytes_ > 0) {
+        const std::lock_guard<std::mutex> lock(notifBatchLock_);
+        for (auto &[agent, batch] : notifBatches_) {
+            if (!batch.msgs.empty()) {
+                notifFlushBatch(agent, batch);
+            }
+        }
+    }
+
+    mrCacheFlush();
     vramFiniCtx();
     tlsSharedWorkerMap().erase(this);
+    tlsPinnedWorkerMap().erase(this);
 }
 
 /****************************************
@@ -1192,8 +1660,20 @@ nixl_status_t nixlUcxEngine::connect(const std::string &remote_agent) {
         return loadRemoteConnInfo(remote_agent, workerAddr);
     }
 
-    return (remoteConnMap.find(remote_agent) == remoteConnMap.end()) ? NIXL_ERR_NOT_FOUND :
-                                                                       NIXL_SUCCESS;
+    auto search = remoteConnMap.find(remote_agent);
+    if (search == remoteConnMap.end()) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    // Fast path after a peer restart: if any endpoint has hit a connection
+    // error, rebuild the endpoints from the cached worker address instead
+    // of a full disconnect/connect cycle
+    for (size_t wid = 0; wid < uws.size(); wid++) {
+        if (search->second->getEp(wid)->checkTxState() != NIXL_SUCCESS) {
+            return reconnectConnection(search->second);
+        }
+    }
+    return NIXL_SUCCESS;
 }
 
 nixl_status_t nixlUcxEngine::disconnect(const std::string &remote_agent) {
@@ -1204,6 +1684,7 @@ nixl_status_t nixlUcxEngine::disconnect(const std::string &remote_agent) {
     }
 
     // thread safety?
+    connTable_[search->second->connId_] = nullptr;
     remoteConnMap.erase(search);
     return NIXL_SUCCESS;
 }
@@ -1214,12 +1695,21 @@ nixl_status_t nixlUcxEngine::loadRemoteConnInfo (const std::string &remote_agent
     size_t size = remote_conn_info.size();
     std::vector<char> addr(size);
 
-    if(remoteConnMap.count(remote_agent)) {
-        return NIXL_ERR_INVALID_PARAM;
+    auto search = remoteConnMap.find(remote_agent);
+    if (search != remoteConnMap.end()) {
+        // Listener-driven refresh: the same address is idempotent, a new
+        // address means the peer restarted, so re-establish the endpoints
+        // in place and keep the connection slot and loaded MDs valid
+        if (search->second->remoteAddr == remote_conn_info) {
+            return NIXL_SUCCESS;
+        }
+        search->second->remoteAddr = remote_conn_info;
+        return reconnectConnection(search->second);
     }
 
     nixlSerDes::_stringToBytes(addr.data(), remote_conn_info, size);
     std::shared_ptr<nixlUcxConnection> conn = std::make_shared<nixlUcxConnection>();
+    auto eps = std::make_shared<ucx_ep_vector_t>();
     bool error = false;
     for (auto &uw: uws) {
         auto result = uw->connect(addr.data(), size);
@@ -1227,27 +1717,168 @@ nixl_status_t nixlUcxEngine::loadRemoteConnInfo (const std::string &remote_agent
             error = true;
             break;
         }
-        conn->eps.push_back(std::move(*result));
+        eps->push_back(std::move(*result));
     }
 
     if (error)
         return NIXL_ERR_BACKEND;
 
     conn->remoteAgent = remote_agent;
+    conn->remoteAddr = remote_conn_info;
+    conn->connId_ = connTable_.size();
+    connTable_.push_back(conn);
+
+    // EP failures carry the native ucs_status_t into telemetry, tagged
+    // with the worker and peer, so link flaps localize without log greps
+    for (size_t wid = 0; wid < eps->size(); wid++)
+        (*eps)[wid]->setErrNotify([this, remote_agent, wid](ucs_status_t status) {
+            addErrorTelemetry(status, "worker" + std::to_string(wid), remote_agent);
+        });
+
+    conn->publishEps(std::move(eps));
 
     remoteConnMap.insert({remote_agent, conn});
 
     return NIXL_SUCCESS;
 }
 
+// Rebuilds the endpoints from the cached remote worker address and rebinds
+// the rkeys of every MD loaded over the connection, so failover takes the
+// wire-level reconnect time instead of disconnect/connect plus remote MD
+// invalidation. Runs on the data path under the agent's shared lock, so
+// several posters can observe the same disconnect concurrently: the
+// per-connection lock elects a single winner to rebuild, and losers just
+// re-check the endpoints the winner published. Every loaded MD gets its
+// (endpoints, rkeys) pair rebound and published atomically BEFORE the
+// connection swaps in the new snapshot, so a concurrent reader always sees
+// a matched generation. In-flight requests on the old endpoints already
+// carry the connection error and are unaffected; their snapshot stays
+// alive until the last holder drops it.
+nixl_status_t
+nixlUcxEngine::reconnectConnection(const ucx_connection_ptr_t &conn) const {
+    const auto failed_eps = conn->getEps();
+
+    std::lock_guard<std::mutex> guard(conn->reconnectLock_);
+    if (conn->getEps() != failed_eps) {
+        // Lost the race: another poster already swapped in fresh endpoints.
+        // Report their state instead of reconnecting a second time.
+        for (size_t wid = 0; wid < uws.size(); wid++) {
+            if (conn->getEp(wid)->checkTxState() != NIXL_SUCCESS)
+                return NIXL_ERR_BACKEND;
+        }
+        return NIXL_SUCCESS;
+    }
+
+    size_t size = conn->remoteAddr.size();
+    std::vector<char> addr(size);
+    nixlSerDes::_stringToBytes(addr.data(), conn->remoteAddr, size);
+
+    auto eps = std::make_shared<ucx_ep_vector_t>();
+    for (auto &uw : uws) {
+        auto result = uw->connect(addr.data(), size);
+        if (!result.ok()) {
+            return NIXL_ERR_BACKEND;
+        }
+        eps->push_back(std::move(*result));
+    }
+
+    // Rebind the error observers the swap is about to drop
+    for (size_t wid = 0; wid < eps->size(); wid++)
+        (*eps)[wid]->setErrNotify(
+            [this, remote_agent = conn->remoteAgent, wid](ucs_status_t status) {
+                addErrorTelemetry(status, "worker" + std::to_string(wid), remote_agent);
+            });
+
+    try {
+        std::vector<char> rkey;
+        for (nixlUcxPublicMetadata *md : conn->loadedMds) {
+            rkey.resize(md->rkeyBlob.size());
+            nixlSerDes::_stringToBytes(rkey.data(), md->rkeyBlob, rkey.size());
+            md->bindRkeys(eps, rkey.data());
+        }
+    }
+    catch (const std::runtime_error &e) {
+        NIXL_ERROR << e.what();
+        return NIXL_ERR_BACKEND;
+    }
+
+    conn->publishEps(eps);
+
+    NIXL_INFO << "Re-established " << uws.size() << " endpoint(s) and rebound "
+              << conn->loadedMds.size() << " loaded MD(s) to agent " << conn->remoteAgent;
+    return NIXL_SUCCESS;
+}
+
 /****************************************
  * Memory management
 *****************************************/
+nixlUcxPrivateMetadata *
+nixlUcxEngine::mrCacheLookup(const nixl_mem_t &nixl_mem, const nixlBlobDesc &mem) {
+    std::lock_guard<std::mutex> lock(mrCacheLock);
+    auto it = mrCacheMap.find(mr_cache_key_t{nixl_mem, mem.addr, mem.len});
+    if (it == mrCacheMap.end())
+        return nullptr;
+
+    nixlUcxPrivateMetadata *md = it->second->md;
+    mrCacheBytes -= md->mem.getSize();
+    mrCacheLru.erase(it->second);
+    mrCacheMap.erase(it);
+    return md;
+}
+
+bool
+nixlUcxEngine::mrCacheInsert(nixlUcxPrivateMetadata *priv) {
+    size_t len = priv->mem.getSize();
+    if (len > mrCacheBudget)
+        return false; // Range alone exceeds the budget, deregister normally
+
+    std::lock_guard<std::mutex> lock(mrCacheLock);
+    mr_cache_key_t key{priv->memType,
+                       reinterpret_cast<uintptr_t>(priv->mem.getBase()), len};
+    if (mrCacheMap.count(key) != 0)
+        return false; // Same range deregistered twice, keep the older entry
+
+    while ((mrCacheBytes + len > mrCacheBudget) && !mrCacheLru.empty()) {
+        nixlUcxMrCacheEntry &victim = mrCacheLru.back();
+        mrCacheBytes -= victim.md->mem.getSize();
+        uc->memDereg(victim.md->mem);
+        delete victim.md;
+        mrCacheMap.erase(victim.key);
+        mrCacheLru.pop_back();
+    }
+
+    mrCacheLru.push_front(nixlUcxMrCacheEntry{key, priv});
+    mrCacheMap[key] = mrCacheLru.begin();
+    mrCacheBytes += len;
+    return true;
+}
+
+void
+nixlUcxEngine::mrCacheFlush() {
+    std::lock_guard<std::mutex> lock(mrCacheLock);
+    for (auto &entry : mrCacheLru) {
+        uc->memDereg(entry.md->mem);
+        delete entry.md;
+    }
+    mrCacheLru.clear();
+    mrCacheMap.clear();
+    mrCacheBytes = 0;
+}
+
 nixl_status_t nixlUcxEngine::registerMem (const nixlBlobDesc &mem,
                                           const nixl_mem_t &nixl_mem,
                                           nixlBackendMD* &out)
 {
+    if (mrCacheBudget > 0) {
+        nixlUcxPrivateMetadata *cached = mrCacheLookup(nixl_mem, mem);
+        if (cached != nullptr) {
+            out = cached;
+            return NIXL_SUCCESS;
+        }
+    }
+
     auto priv = std::make_unique<nixlUcxPrivateMetadata>();
+    priv->memType = nixl_mem;
 
     if (nixl_mem == VRAM_SEG) {
         bool need_restart;
@@ -1261,7 +1892,8 @@ nixl_status_t nixlUcxEngine::registerMem (const nixlBlobDesc &mem,
     }
 
     // TODO: Add nixl_mem check?
-    const int ret = uc->memReg((void*) mem.addr, mem.len, priv->mem, nixl_mem);
+    const int ret = uc->memReg((void*) mem.addr, mem.len, priv->mem, nixl_mem,
+                               mem.dmabufFd, mem.dmabufOffset);
     if (ret) {
         return NIXL_ERR_BACKEND;
     }
@@ -1277,6 +1909,9 @@ nixl_status_t nixlUcxEngine::registerMem (const nixlBlobDesc &mem,
 nixl_status_t nixlUcxEngine::deregisterMem (nixlBackendMD* meta)
 {
     nixlUcxPrivateMetadata *priv = (nixlUcxPrivateMetadata*) meta;
+    if ((mrCacheBudget > 0) && mrCacheInsert(priv))
+        return NIXL_SUCCESS; // Kept mapped for re-registration
+
     uc->memDereg(priv->mem);
     delete priv;
     return NIXL_SUCCESS;
@@ -1310,9 +1945,9 @@ nixlUcxEngine::internalMDHelper (const nixl_blob_t &blob,
         std::vector<char> addr(size);
         nixlSerDes::_stringToBytes(addr.data(), blob, size);
 
-        for (size_t wid = 0; wid < uws.size(); wid++) {
-            md->addRkey(*md->conn->getEp(wid), addr.data());
-        }
+        md->bindRkeys(md->conn->getEps(), addr.data());
+        md->rkeyBlob = blob;
+        md->conn->loadedMds.push_back(md.get());
 
         output = (nixlBackendMD *)md.release();
 
@@ -1346,6 +1981,10 @@ nixl_status_t nixlUcxEngine::loadRemoteMD (const nixlBlobDesc &input,
 nixl_status_t nixlUcxEngine::unloadMD (nixlBackendMD* input) {
 
     nixlUcxPublicMetadata *md = (nixlUcxPublicMetadata*) input; //typecast?
+    if (md->conn) {
+        auto &mds = md->conn->loadedMds;
+        mds.erase(std::remove(mds.begin(), mds.end(), md), mds.end());
+    }
     delete md;
 
     return NIXL_SUCCESS;
@@ -1356,16 +1995,23 @@ nixl_status_t nixlUcxEngine::unloadMD (nixlBackendMD* input) {
 *****************************************/
 
 static nixl_status_t
-_retHelper(nixl_status_t ret, nixlUcxBackendH *hndl, nixlUcxReq &req, ucx_connection_ptr_t conn) {
+_retHelper(nixl_status_t ret,
+           nixlUcxBackendH *hndl,
+           nixlUcxReq &req,
+           ucx_connection_ptr_t conn,
+           size_t xfer_size = 0) {
     /* if transfer wasn't immediately completed */
     switch(ret) {
     case NIXL_IN_PROG:
         // TODO: this cast does not look safe
         // We need to allocate a vector of nixlUcxIntReq and set nixlUcxReqt
+        ((nixlUcxIntReq *)req)->xferSize = xfer_size;
         hndl->append((nixlUcxIntReq *)req);
         nixlUcxReqSetConnection(req, conn);
+        break;
     case NIXL_SUCCESS:
-        // Nothing to do
+        // Inline completion: count it for abort-time reporting
+        hndl->addCompletedBytes(xfer_size);
         break;
     default:
         // Error. Release all previously initiated ops and exit:
@@ -1380,7 +2026,14 @@ size_t
 nixlUcxEngine::getWorkerId() const {
     auto it = tlsSharedWorkerMap().find(this);
     if (it == tlsSharedWorkerMap().end()) {
-        size_t index = sharedWorkerIndex_.fetch_add(1) % getSharedWorkersSize();
+        // Skip workers pinned to other threads; if everything is pinned, fall
+        // back to plain round-robin rather than spinning forever.
+        size_t index;
+        size_t attempts = 0;
+        do {
+            index = sharedWorkerIndex_.fetch_add(1) % getSharedWorkersSize();
+        } while (pinnedWorkers_[index].load(std::memory_order_relaxed) &&
+                 ++attempts < getSharedWorkersSize());
         it = tlsSharedWorkerMap().emplace(this, index).first;
         NIXL_DEBUG << "engine " << this << " bound shared worker " << index << " to thread "
                    << std::this_thread::get_id();
@@ -1417,6 +2070,59 @@ nixlUcxEngine::getWorkerIdFromOptArgs(const nixl_opt_b_args_t *opt_args) const n
     }
 }
 
+std::optional<size_t>
+nixlUcxEngine::pinWorkerFromOptArgs(const nixl_opt_b_args_t *opt_args) const noexcept {
+    if (!opt_args || opt_args->customParam.empty()) {
+        return std::nullopt;
+    }
+
+    if (opt_args->customParam.find("pin_worker") == std::string::npos) {
+        return std::nullopt;
+    }
+
+    auto it = tlsPinnedWorkerMap().find(this);
+    if (it != tlsPinnedWorkerMap().end()) {
+        return it->second;
+    }
+
+    for (size_t i = 0; i < getSharedWorkersSize(); i++) {
+        bool expected = false;
+        if (pinnedWorkers_[i].compare_exchange_strong(expected, true)) {
+            tlsPinnedWorkerMap().emplace(this, i);
+            tlsSharedWorkerMap()[this] = i;
+            NIXL_DEBUG << "engine " << this << " pinned worker " << i << " to thread "
+                       << std::this_thread::get_id();
+            return i;
+        }
+    }
+
+    NIXL_WARN << "pin_worker requested but all " << getSharedWorkersSize()
+              << " shared workers are already pinned";
+    return std::nullopt;
+}
+
+void
+nixlUcxEngine::workerDepthPosted(nixlUcxBackendH *handle) const {
+    if (handle->inFlight()) {
+        return;
+    }
+    handle->setInFlight(true);
+    size_t worker_id = handle->getWorkerId();
+    uint64_t depth = workerDepths_[worker_id].fetch_add(1, std::memory_order_relaxed) + 1;
+    addTelemetryEvent("ucx_worker" + std::to_string(worker_id) + "_depth", depth);
+}
+
+void
+nixlUcxEngine::workerDepthDone(nixlUcxBackendH *handle) const {
+    if (!handle->inFlight()) {
+        return;
+    }
+    handle->setInFlight(false);
+    size_t worker_id = handle->getWorkerId();
+    uint64_t depth = workerDepths_[worker_id].fetch_sub(1, std::memory_order_relaxed) - 1;
+    addTelemetryEvent("ucx_worker" + std::to_string(worker_id) + "_depth", depth);
+}
+
 nixl_status_t nixlUcxEngine::prepXfer (const nixl_xfer_op_t &operation,
                                        const nixl_meta_dlist_t &local,
                                        const nixl_meta_dlist_t &remote,
@@ -1430,7 +2136,9 @@ nixl_status_t nixlUcxEngine::prepXfer (const nixl_xfer_op_t &operation,
     }
 
     /* TODO: try to get from a pool first */
-    const auto opt_worker_id = getWorkerIdFromOptArgs(opt_args);
+    const auto pinned_worker_id = pinWorkerFromOptArgs(opt_args);
+    const auto opt_worker_id =
+        pinned_worker_id ? pinned_worker_id : getWorkerIdFromOptArgs(opt_args);
     size_t worker_id = opt_worker_id.value_or(getWorkerId());
     auto *ucx_handle = new nixlUcxBackendH(getWorker(worker_id).get(), worker_id);
 
@@ -1450,8 +2158,42 @@ nixl_status_t nixlUcxEngine::estimateXferCost (const nixl_xfer_op_t &operation,
                                                const nixl_opt_args_t* opt_args) const
 {
     nixlUcxBackendH *intHandle = (nixlUcxBackendH *)handle;
-    size_t workerId = intHandle->getWorkerId();
 
+    return estimateXferCostImpl(
+        local, remote, intHandle->getWorkerId(), duration, err_margin, method);
+}
+
+nixl_status_t
+nixlUcxEngine::estimateXferCost(const nixl_xfer_op_t &operation,
+                                const nixl_meta_dlist_t &local,
+                                const nixl_meta_dlist_t &remote,
+                                const std::string &remote_agent,
+                                std::chrono::microseconds &duration,
+                                std::chrono::microseconds &err_margin,
+                                nixl_cost_t &method,
+                                const nixl_opt_args_t *opt_args) const {
+    // Selection-time estimate: no request handle exists yet, so estimate
+    // against the shared worker the calling thread would be assigned
+    const size_t worker_id = getWorkerId();
+
+    nixl_status_t ret = estimateXferCostImpl(local, remote, worker_id, duration, err_margin, method);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    // Fold in the live queue depth: in-flight requests on the same worker
+    // serialize progress, so a loaded worker quotes proportionally more
+    const uint64_t depth = workerDepths_[worker_id].load(std::memory_order_relaxed);
+    duration += duration * depth;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlUcxEngine::estimateXferCostImpl(const nixl_meta_dlist_t &local,
+                                    const nixl_meta_dlist_t &remote,
+                                    size_t workerId,
+                                    std::chrono::microseconds &duration,
+                                    std::chrono::microseconds &err_margin,
+                                    nixl_cost_t &method) const {
     if (local.descCount() != remote.descCount()) {
         NIXL_ERROR << "Local (" << local.descCount() << ") and remote (" << remote.descCount()
                    << ") descriptor lists differ in size for cost estimation";
@@ -1521,7 +2263,10 @@ nixlUcxEngine::sendXferRange(const nixl_xfer_op_t &operation,
 
         lmd = (nixlUcxPrivateMetadata*) local[i].metadataP;
         rmd = (nixlUcxPublicMetadata*) remote[i].metadataP;
-        auto &ep = rmd->conn->getEp(workerId);
+        // One atomic fetch pairs the endpoint with the rkeys unpacked for
+        // it, even if the connection reconnects mid-post
+        const auto binding = rmd->binding();
+        nixlUcxEp &ep = *(*binding->eps)[workerId];
 
         if (lsize != rsize) {
             return NIXL_ERR_INVALID_PARAM;
@@ -1529,18 +2274,22 @@ nixlUcxEngine::sendXferRange(const nixl_xfer_op_t &operation,
 
         switch (operation) {
         case NIXL_READ:
-            ret = ep->read(raddr, rmd->getRkey(workerId), laddr, lmd->mem, lsize, req);
+            ret = ep.read(raddr, *binding->rkeys[workerId], laddr, lmd->mem, lsize, req);
             break;
         case NIXL_WRITE:
-            ret = ep->write(laddr, lmd->mem, raddr, rmd->getRkey(workerId), lsize, req);
+            ret = ep.write(laddr, lmd->mem, raddr, *binding->rkeys[workerId], lsize, req);
             break;
         default:
             return NIXL_ERR_INVALID_PARAM;
         }
 
-        if (_retHelper(ret, intHandle, req, rmd->conn)) {
+        if (_retHelper(ret, intHandle, req, rmd->conn, lsize)) {
             return ret;
         }
+
+        if (ret == NIXL_IN_PROG) {
+            ((nixlUcxIntReq *)req)->descIdx = i;
+        }
     }
 
     /*
@@ -1578,65 +2327,187 @@ nixlUcxEngine::postXfer(const nixl_xfer_op_t &operation,
     // TODO: assert that handle is empty/completed, as we can't post request before completion
 
     ret = sendXferRange(operation, local, remote, remote_agent, handle, 0, lcnt);
-    if (ret != NIXL_SUCCESS) {
-        return ret;
+    if (ret == NIXL_SUCCESS) {
+        ret = int_handle->status();
+    }
+
+    if (ret == NIXL_ERR_REMOTE_DISCONNECT) {
+        // Transparent requeue after a connection reset: drop the failed
+        // requests, re-establish the endpoints from the cached address and
+        // post the batch once more
+        auto rmd = (nixlUcxPublicMetadata *)remote[0].metadataP;
+        int_handle->release();
+        ret = reconnectConnection(rmd->conn);
+        if (ret == NIXL_SUCCESS) {
+            NIXL_WARN << "Requeued transfer to " << remote_agent << " after connection reset";
+            ret = sendXferRange(operation, local, remote, remote_agent, handle, 0, lcnt);
+            if (ret == NIXL_SUCCESS) {
+                ret = int_handle->status();
+            }
+        }
     }
 
-    ret = int_handle->status();
     if (opt_args && opt_args->hasNotif) {
         if (ret == NIXL_SUCCESS) {
             nixlUcxReq req;
             auto rmd = (nixlUcxPublicMetadata *)remote[0].metadataP;
-            ret = notifSendPriv(
-                remote_agent, opt_args->notifMsg, req, rmd->conn->getEp(int_handle->getWorkerId()));
+            ret = notifSendPriv(remote_agent,
+                                opt_args->notifMsg,
+                                req,
+                                rmd->conn,
+                                int_handle->getWorkerId(),
+                                opt_args->traceCtx);
             if (_retHelper(ret, int_handle, req, rmd->conn)) {
                 return ret;
             }
 
             ret = int_handle->status();
         } else if (ret == NIXL_IN_PROG) {
-            int_handle->notification().emplace(remote_agent, opt_args->notifMsg);
+            auto rmd = (nixlUcxPublicMetadata *)remote[0].metadataP;
+            if (recvCompletion_ &&
+                getWorker(int_handle->getWorkerId())->fence() == NIXL_SUCCESS) {
+                // Receive-side completion: the fence orders the notif AM
+                // behind the data on each endpoint, so sending it now gives
+                // write-with-immediate semantics — the target sees the notif
+                // only once the data has landed, without waiting for us to
+                // poll the transfer to completion first. The AM request
+                // joins the handle, so the transfer reports done only after
+                // the notif is on the wire.
+                nixlUcxReq req;
+                nixl_status_t notif_ret = notifSendPriv(remote_agent,
+                                                        opt_args->notifMsg,
+                                                        req,
+                                                        rmd->conn,
+                                                        int_handle->getWorkerId(),
+                                                        opt_args->traceCtx);
+                if (_retHelper(notif_ret, int_handle, req, rmd->conn)) {
+                    return notif_ret;
+                }
+            } else {
+                int_handle->notification().emplace(
+                    remote_agent, opt_args->notifMsg, opt_args->traceCtx, rmd->conn->connId());
+            }
         }
     }
 
+    if (ret == NIXL_IN_PROG) {
+        workerDepthPosted(int_handle);
+    }
+
     return ret;
 }
 
 nixl_status_t nixlUcxEngine::checkXfer (nixlBackendReqH* handle) const
 {
+    return checkXferImpl(handle, true);
+}
+
+nixl_status_t
+nixlUcxEngine::checkXferBatch(const std::vector<nixlBackendReqH *> &handles,
+                              std::vector<nixl_status_t> &statuses) const {
+    // Drive each distinct worker's progress machinery once up front, then
+    // harvest every handle from completion-flag reads, so polling N
+    // outstanding requests costs one progress pass per worker instead of
+    // one per request
+    std::set<nixlUcxWorker *> seen;
+    for (auto *handle : handles) {
+        nixlUcxWorker *worker = ((nixlUcxBackendH *)handle)->getWorker();
+        if (worker && seen.insert(worker).second) {
+            while (worker->progress())
+                ;
+        }
+    }
+
+    nixl_status_t agg = NIXL_SUCCESS;
+    for (size_t i = 0; i < handles.size(); i++) {
+        statuses[i] = checkXferImpl(handles[i], false);
+        if ((statuses[i] < 0) && (agg >= 0))
+            agg = statuses[i];
+        else if ((statuses[i] == NIXL_IN_PROG) && (agg == NIXL_SUCCESS))
+            agg = NIXL_IN_PROG;
+    }
+    return agg;
+}
+
+nixl_status_t
+nixlUcxEngine::checkXferImpl(nixlBackendReqH *handle, bool do_progress) const {
     nixlUcxBackendH *intHandle = (nixlUcxBackendH *)handle;
     auto& notif = intHandle->notification();
-    nixl_status_t handle_status = intHandle->status();
+    nixl_status_t handle_status = intHandle->status(do_progress);
+
+    // The agent polls only while in progress, so this fires once per
+    // request when the completion is first observed
+    if (handle_status != NIXL_IN_PROG)
+        NIXL_PROBE2(ucx_xfer_done, handle, handle_status);
 
     if ((handle_status != NIXL_SUCCESS) || !notif.has_value()) {
         if (handle_status != NIXL_IN_PROG) { // error flow
             notif.reset();
+            workerDepthDone(intHandle);
         }
 
         return handle_status;
     }
 
-    ucx_connection_ptr_t conn = getConnection(notif->agent);
+    ucx_connection_ptr_t conn = getConnection(notif->conn_id);
     if (!conn) {
         notif.reset();
         return NIXL_ERR_NOT_FOUND;
     }
 
     nixlUcxReq req;
-    nixl_status_t status =
-        notifSendPriv(notif->agent, notif->payload, req, conn->getEp(intHandle->getWorkerId()));
+    nixl_status_t status = notifSendPriv(
+        notif->agent, notif->payload, req, conn, intHandle->getWorkerId(), notif->trace);
     notif.reset();
     status = _retHelper(status, intHandle, req, conn);
     if (status != NIXL_SUCCESS) {
+        workerDepthDone(intHandle);
         return status;
     }
 
-    return intHandle->status();
+    status = intHandle->status();
+    if (status != NIXL_IN_PROG) {
+        workerDepthDone(intHandle);
+    }
+    return status;
+}
+
+nixl_status_t
+nixlUcxEngine::abortReqH(nixlBackendReqH *handle, size_t &bytes_transferred) const {
+    nixlUcxBackendH *intHandle = (nixlUcxBackendH *)handle;
+    nixl_status_t status = intHandle->abort(bytes_transferred);
+    // Free the per-worker depth slot right away; the flag guard keeps the
+    // eventual releaseReqH from decrementing twice
+    if (status == NIXL_SUCCESS)
+        workerDepthDone(intHandle);
+    return status;
+}
+
+nixl_status_t
+nixlUcxEngine::getFailedDescs(nixlBackendReqH *handle, std::vector<size_t> &indices) const {
+    nixlUcxBackendH *intHandle = (nixlUcxBackendH *)handle;
+    // Composite handles keep their requests in per-chunk children whose
+    // lifetime is tied to the worker threads; not attributed for now
+    if (intHandle->isComposite()) {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+    intHandle->getFailedDescs(indices);
+    return NIXL_SUCCESS;
+}
+
+// Stall-watchdog hook: print each worker's UCP state so a wedged
+// transfer can be traced to the transport level from the agent log
+void
+nixlUcxEngine::dumpDiagnostics() const {
+    NIXL_WARN << "Dumping state of " << uws.size() << " UCX worker(s)";
+    for (auto &uw : uws)
+        uw->dumpInfo();
 }
 
 nixl_status_t nixlUcxEngine::releaseReqH(nixlBackendReqH* handle) const
 {
     nixlUcxBackendH *intHandle = (nixlUcxBackendH *)handle;
+    workerDepthDone(intHandle);
     nixl_status_t status = intHandle->release();
 
     /* TODO: return to a pool instead. */
@@ -1669,21 +2540,27 @@ nixlUcxEngine::createGpuXferReq(const nixlBackendReqH &req_hndl,
     }
 
     size_t workerId = intHandle->getWorkerId();
-    nixlUcxEp *ep = remoteMd->conn->getEp(workerId).get();
+    // Guards keep the endpoint snapshot and every rkey binding alive for
+    // the duration of the call, even across a concurrent reconnect
+    auto ep_guard = remoteMd->conn->getEp(workerId);
+    nixlUcxEp *ep = ep_guard.get();
 
     std::vector<nixlUcxMem> local_mems;
     std::vector<const nixl::ucx::rkey *> remote_rkeys;
     std::vector<uint64_t> remote_addrs;
+    std::vector<nixlUcxPublicMetadata::ep_binding_ptr_t> binding_guards;
     local_mems.reserve(local_descs.descCount());
     remote_rkeys.reserve(remote_descs.descCount());
     remote_addrs.reserve(remote_descs.descCount());
+    binding_guards.reserve(remote_descs.descCount());
 
     for (size_t i = 0; i < static_cast<size_t>(local_descs.descCount()); i++) {
         auto localMd = static_cast<nixlUcxPrivateMetadata *>(local_descs[i].metadataP);
         auto remoteMdDesc = static_cast<nixlUcxPublicMetadata *>(remote_descs[i].metadataP);
 
         local_mems.push_back(localMd->mem);
-        remote_rkeys.push_back(&remoteMdDesc->getRkey(workerId));
+        binding_guards.push_back(remoteMdDesc->binding());
+        remote_rkeys.push_back(binding_guards.back()->rkeys[workerId].get());
         remote_addrs.push_back(static_cast<uint64_t>(remote_descs[i].addr));
     }
 
@@ -1755,22 +2632,81 @@ int nixlUcxEngine::progress() {
  * Notifications
 *****************************************/
 
+void
+nixlUcxConnection::recordAmSize(size_t len) const {
+    const size_t bucket =
+        std::min(AM_HIST_BUCKETS - 1, static_cast<size_t>(len ? 64 - __builtin_clzll(len) : 0));
+    amSizeHist_[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    if ((amSends_.fetch_add(1, std::memory_order_relaxed) + 1) % AM_ADAPT_PERIOD != 0) {
+        return;
+    }
+
+    // Re-derive the threshold: the smallest bucket boundary covering 90%
+    // of the recorded payloads, then halve the counts so old traffic
+    // decays and the threshold can track a shifting mix
+    uint64_t total = 0;
+    for (auto &count : amSizeHist_) {
+        total += count.load(std::memory_order_relaxed);
+    }
+
+    const uint64_t target = total - total / 10;
+    uint64_t cum = 0;
+    for (size_t b = 0; b < AM_HIST_BUCKETS; b++) {
+        const uint32_t count = amSizeHist_[b].load(std::memory_order_relaxed);
+        cum += count;
+        if (cum >= target) {
+            amEagerThresh_.store(size_t(1) << b, std::memory_order_relaxed);
+            break;
+        }
+    }
+
+    for (auto &count : amSizeHist_) {
+        count.store(count.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+    }
+}
+
+uint32_t
+nixlUcxEngine::amSendFlags(const nixlUcxConnection &conn, size_t len) const {
+    switch (amEagerMode_) {
+    case am_eager_mode_t::fixed:
+        return len <= amEagerThresh_ ? UCP_AM_SEND_FLAG_EAGER : UCP_AM_SEND_FLAG_RNDV;
+    case am_eager_mode_t::adaptive:
+        conn.recordAmSize(len);
+        return len <= conn.amEagerThresh() ? UCP_AM_SEND_FLAG_EAGER : UCP_AM_SEND_FLAG_RNDV;
+    case am_eager_mode_t::always_eager:
+    default:
+        return UCP_AM_SEND_FLAG_EAGER;
+    }
+}
+
 //agent will provide cached msg
 nixl_status_t
 nixlUcxEngine::notifSendPriv(const std::string &remote_agent,
                              const std::string &msg,
                              nixlUcxReq &req,
-                             const std::unique_ptr<nixlUcxEp> &ep) const {
+                             const ucx_connection_ptr_t &conn,
+                             size_t worker_id,
+                             const nixl_blob_t &trace) const {
     nixlSerDes ser_des;
     nixl_status_t ret;
 
     ser_des.addStr("name", localAgent);
     ser_des.addStr("msg", msg);
+    // Optional trailing field, absent in traffic from untraced senders so
+    // the wire format stays compatible in both directions
+    if (!trace.empty())
+        ser_des.addStr("trc", trace);
     // TODO: replace with mpool for performance
 
     auto buffer = std::make_unique<std::string>(ser_des.exportStr());
-    ret = ep->sendAm(
-        NOTIF_STR, NULL, 0, (void *)buffer->data(), buffer->size(), UCP_AM_SEND_FLAG_EAGER, req);
+    ret = conn->getEp(worker_id)->sendAm(NOTIF_STR,
+                                         NULL,
+                                         0,
+                                         (void *)buffer->data(),
+                                         buffer->size(),
+                                         amSendFlags(*conn, buffer->size()),
+                                         req);
     if (ret == NIXL_IN_PROG) {
         nixlUcxIntReq* nReq = (nixlUcxIntReq*)req;
         nReq->amBuffer = std::move(buffer);
@@ -1784,36 +2720,207 @@ nixlUcxEngine::getConnection(const std::string &remote_agent) const {
     return (search != remoteConnMap.end()) ? search->second : nullptr;
 }
 
+ucx_connection_ptr_t
+nixlUcxEngine::getConnection(size_t conn_id) const {
+    return (conn_id < connTable_.size()) ? connTable_[conn_id] : nullptr;
+}
+
 void
 nixlUcxEngine::appendNotif(std::string remote_name, std::string msg) {
     notifMainList.emplace_back(std::move(remote_name), std::move(msg));
 }
 
+void
+nixlUcxEngine::recordNotifTrace(nixl_blob_t trace) {
+    std::lock_guard<std::mutex> guard(notifTraceLock_);
+    notifTraceList_.push_back(std::move(trace));
+}
+
+nixl_status_t
+nixlUcxEngine::getNotifTraceCtxs(std::vector<nixl_blob_t> &traces) {
+    std::lock_guard<std::mutex> guard(notifTraceLock_);
+    traces.insert(traces.end(),
+                  std::make_move_iterator(notifTraceList_.begin()),
+                  std::make_move_iterator(notifTraceList_.end()));
+    notifTraceList_.clear();
+    return NIXL_SUCCESS;
+}
+
+namespace {
+
+// Notification AMs are parsed in place out of the UCX receive buffer: the
+// serdes import path would copy the whole payload twice (ser_str and the
+// serdes working buffer) before building the delivered strings, per
+// notification. The eager buffer is only valid for the duration of the
+// callback, so the final name/msg strings are the one unavoidable copy;
+// from there they are moved, never copied, through getNotifs into the
+// agent's view buffer.
+
+constexpr std::string_view notifSerdesHeader = "nixlSerDes|";
+
+// One field of a TAGGED nixlSerDes blob: tag, 8-byte length, payload, '|'
+bool
+viewNotifField(const char *buf, size_t size, size_t &offset,
+               std::string_view tag, std::string_view &out) {
+    if (((offset + tag.size() + sizeof(size_t)) > size) ||
+        (memcmp(buf + offset, tag.data(), tag.size()) != 0))
+        return false;
+    offset += tag.size();
+    size_t len;
+    memcpy(&len, buf + offset, sizeof(size_t));
+    offset += sizeof(size_t);
+    if ((len > size) || ((offset + len + 1) > size) || (buf[offset + len] != '|'))
+        return false;
+    out = std::string_view(buf + offset, len);
+    offset += len + 1;
+    return true;
+}
+
+bool
+viewNotifHeader(const char *buf, size_t size, size_t &offset) {
+    if ((size < notifSerdesHeader.size()) ||
+        (memcmp(buf, notifSerdesHeader.data(), notifSerdesHeader.size()) != 0))
+        return false;
+    offset = notifSerdesHeader.size();
+    return true;
+}
+
+} // namespace
+
 ucs_status_t
 nixlUcxEngine::notifAmCb(void *arg, const void *header,
                          size_t header_length, void *data,
                          size_t length,
                          const ucp_am_recv_param_t *param)
 {
+    const char *buf = (const char *)data;
+    nixlUcxEngine* engine = (nixlUcxEngine*) arg;
+
+    // send_am should be forcing EAGER protocol
+    NIXL_ASSERT(!(param->recv_attr & UCP_AM_RECV_ATTR_FLAG_RNDV));
+    NIXL_ASSERT(header_length == 0) << "header_length " << header_length;
+
+    NIXL_PROBE2(ucx_notif_recv, engine, length);
+
+    std::string_view remote_name, msg, trace;
+    size_t offset;
+    if (viewNotifHeader(buf, length, offset) &&
+        viewNotifField(buf, length, offset, "name", remote_name) &&
+        viewNotifField(buf, length, offset, "msg", msg)) {
+        // Optional trailing trace context from a traced sender
+        if ((offset < length) && viewNotifField(buf, length, offset, "trc", trace))
+            engine->recordNotifTrace(std::string(trace));
+        engine->appendNotif(std::string(remote_name), std::string(msg));
+        return UCS_OK;
+    }
+
+    // Unexpected encoding (e.g. a binary-format sender): take the serdes
+    // slow path rather than dropping the notification
     nixlSerDes ser_des;
+    ser_des.importStr(std::string(buf, length));
+    engine->appendNotif(ser_des.getStr("name"), ser_des.getStr("msg"));
+    std::string slow_trace = ser_des.getStr("trc");
+    if (!slow_trace.empty())
+        engine->recordNotifTrace(std::move(slow_trace));
+    return UCS_OK;
+}
 
-    std::string ser_str( (char*) data, length);
+ucs_status_t
+nixlUcxEngine::notifBatchAmCb(void *arg, const void *header,
+                              size_t header_length, void *data,
+                              size_t length,
+                              const ucp_am_recv_param_t *param)
+{
+    const char *buf = (const char *)data;
     nixlUcxEngine* engine = (nixlUcxEngine*) arg;
 
     // send_am should be forcing EAGER protocol
     NIXL_ASSERT(!(param->recv_attr & UCP_AM_RECV_ATTR_FLAG_RNDV));
     NIXL_ASSERT(header_length == 0) << "header_length " << header_length;
 
-    ser_des.importStr(ser_str);
+    std::string_view name_view, count_view, msg;
+    size_t offset;
+    if (viewNotifHeader(buf, length, offset) &&
+        viewNotifField(buf, length, offset, "name", name_view) &&
+        viewNotifField(buf, length, offset, "n", count_view) &&
+        (count_view.size() == sizeof(size_t))) {
+        size_t count;
+        memcpy(&count, count_view.data(), sizeof(count));
+        std::string remote_name(name_view);
+        for (size_t i = 0; i < count; i++) {
+            if (!viewNotifField(buf, length, offset, "msg", msg))
+                break;
+            engine->appendNotif(remote_name, std::string(msg));
+        }
+        return UCS_OK;
+    }
+
+    nixlSerDes ser_des;
+    ser_des.importStr(std::string(buf, length));
     std::string remote_name = ser_des.getStr("name");
-    std::string msg = ser_des.getStr("msg");
+    size_t count = 0;
+    ser_des.getBuf("n", &count, sizeof(count));
 
-    engine->appendNotif(std::move(remote_name), std::move(msg));
+    for (size_t i = 0; i < count; i++) {
+        engine->appendNotif(remote_name, ser_des.getStr("msg"));
+    }
     return UCS_OK;
 }
 
+// Caller must hold notifBatchLock_
+nixl_status_t
+nixlUcxEngine::notifFlushBatch(const std::string &remote_agent,
+                               nixlUcxNotifBatch &batch) const {
+    auto conn = getConnection(remote_agent);
+    if (!conn) {
+        batch.msgs.clear();
+        batch.bytes = 0;
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    nixlSerDes ser_des;
+    ser_des.addStr("name", localAgent);
+    size_t count = batch.msgs.size();
+    ser_des.addBuf("n", &count, sizeof(count));
+    for (const auto &msg : batch.msgs) {
+        ser_des.addStr("msg", msg);
+    }
+    batch.msgs.clear();
+    batch.bytes = 0;
+
+    auto buffer = std::make_unique<std::string>(ser_des.exportStr());
+    nixlUcxReq req;
+    nixl_status_t ret = conn->getEp(getWorkerId())->sendAm(
+        NOTIF_BATCH, NULL, 0, (void *)buffer->data(), buffer->size(),
+        amSendFlags(*conn, buffer->size()), req);
+    if (ret == NIXL_IN_PROG) {
+        nixlUcxIntReq *int_req = (nixlUcxIntReq *)req;
+        int_req->amBuffer = std::move(buffer);
+        /* do not track the request, same as the unbatched genNotif path */
+        getWorker(getWorkerId())->reqRelease(req);
+        ret = NIXL_SUCCESS;
+    }
+    return ret;
+}
+
+void
+nixlUcxEngine::notifFlushExpired() const {
+    if (notifBatchBytes_ == 0) {
+        return;
+    }
+
+    const std::lock_guard<std::mutex> lock(notifBatchLock_);
+    nixlTime::us_t now = nixlTime::getUs();
+    for (auto &[agent, batch] : notifBatches_) {
+        if (!batch.msgs.empty() && now - batch.firstUs >= notifBatchDelayUs_) {
+            notifFlushBatch(agent, batch);
+        }
+    }
+}
+
 void
 nixlUcxEngine::getNotifsImpl(notif_list_t &notif_list) {
+    notifFlushExpired();
     moveNotifList(notifMainList, notif_list);
 }
 
@@ -1837,7 +2944,23 @@ nixl_status_t nixlUcxEngine::genNotif(const std::string &remote_agent, const std
         return NIXL_ERR_NOT_FOUND;
     }
 
-    ret = notifSendPriv(remote_agent, msg, req, conn->getEp(getWorkerId()));
+    if (notifBatchBytes_ > 0) {
+        const std::lock_guard<std::mutex> lock(notifBatchLock_);
+        auto &batch = notifBatches_[remote_agent];
+        if (batch.msgs.empty()) {
+            batch.firstUs = nixlTime::getUs();
+        }
+        batch.bytes += msg.size();
+        batch.msgs.push_back(msg);
+
+        if (batch.bytes >= notifBatchBytes_ ||
+            nixlTime::getUs() - batch.firstUs >= notifBatchDelayUs_) {
+            return notifFlushBatch(remote_agent, batch);
+        }
+        return NIXL_SUCCESS;
+    }
+
+    ret = notifSendPriv(remote_agent, msg, req, conn, getWorkerId());
     switch(ret) {
     case NIXL_IN_PROG:
         /* do not track the request */
@@ -28,6 +28,10 @@
 #include <chrono>
 #include <poll.h>
 #include <optional>
+#include <list>
+#include <map>
+#include <tuple>
+#include <array>
 
 #include "nixl.h"
 #include "backend/backend_engine.h"
@@ -38,16 +42,87 @@
 #include "ucx/rkey.h"
 #include "ucx/ucx_utils.h"
 
-enum ucx_cb_op_t { NOTIF_STR };
+// Single-backend profile (-Dsingle_backend=UCX): the leaf engine classes
+// are marked final so LTO can devirtualize the hot-path calls made
+// through the nixlBackendEngine interface. The base nixlUcxEngine cannot
+// carry it, since the progress-mode engines below derive from it.
+#ifdef NIXL_SINGLE_BACKEND_UCX
+#define NIXL_UCX_ENGINE_FINAL final
+#else
+#define NIXL_UCX_ENGINE_FINAL
+#endif
+
+enum ucx_cb_op_t { NOTIF_STR, NOTIF_BATCH };
+
+class nixlUcxPublicMetadata;
+
+using ucx_ep_vector_t = std::vector<std::unique_ptr<nixlUcxEp>>;
+using ucx_ep_vector_ptr_t = std::shared_ptr<const ucx_ep_vector_t>;
 
 class nixlUcxConnection : public nixlBackendConnMD {
     private:
         std::string remoteAgent;
-        std::vector<std::unique_ptr<nixlUcxEp>> eps;
+        // Endpoints per worker, published as an immutable snapshot and
+        // swapped wholesale on reconnect (atomic shared_ptr), so readers
+        // on the shared-lock data path never observe a torn vector or a
+        // destroyed endpoint: a snapshot they hold stays alive until they
+        // drop it, and requests on old endpoints keep carrying the
+        // connection error as before
+        ucx_ep_vector_ptr_t eps_;
+        // Serializes reconnection: a single winner rebuilds the
+        // endpoints, losers re-check the state of what it published
+        mutable std::mutex reconnectLock_;
+
+        void
+        publishEps(ucx_ep_vector_ptr_t eps) noexcept {
+            std::atomic_store_explicit(&eps_, std::move(eps), std::memory_order_release);
+        }
+
+        // Index into the engine's flat connection table, assigned at
+        // loadRemoteConnInfo time so hot paths can avoid hashing agent names
+        size_t connId_ = 0;
+        // Raw remote worker address as received, kept so endpoints can be
+        // re-established in place after a peer restart
+        std::string remoteAddr;
+        // Public MDs loaded over this connection; their rkeys are rebound
+        // when the endpoints are re-established
+        std::vector<nixlUcxPublicMetadata *> loadedMds;
+
+        // Adaptive eager/rendezvous control for AMs to this peer: a log2
+        // histogram of payload sizes, periodically folded into the eager
+        // threshold that keeps ~90% of messages on the eager path. Racy
+        // relaxed updates only skew the histogram, never break it.
+        static constexpr size_t AM_HIST_BUCKETS = 32;
+        static constexpr uint64_t AM_ADAPT_PERIOD = 256;
+        mutable std::array<std::atomic<uint32_t>, AM_HIST_BUCKETS> amSizeHist_{};
+        mutable std::atomic<uint64_t> amSends_{0};
+        mutable std::atomic<size_t> amEagerThresh_{16384};
+
+        void
+        recordAmSize(size_t len) const;
 
     public:
-        [[nodiscard]] const std::unique_ptr<nixlUcxEp>& getEp(size_t ep_id) const noexcept {
-            return eps[ep_id];
+        [[nodiscard]] size_t
+        amEagerThresh() const noexcept {
+            return amEagerThresh_.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] ucx_ep_vector_ptr_t
+        getEps() const noexcept {
+            return std::atomic_load_explicit(&eps_, std::memory_order_acquire);
+        }
+
+        // Lifetime-guarded accessor: the aliased pointer keeps the whole
+        // endpoint snapshot alive for as long as the caller holds it
+        [[nodiscard]] std::shared_ptr<nixlUcxEp>
+        getEp(size_t ep_id) const noexcept {
+            auto eps = getEps();
+            return std::shared_ptr<nixlUcxEp>(eps, (*eps)[ep_id].get());
+        }
+
+        [[nodiscard]] size_t
+        connId() const noexcept {
+            return connId_;
         }
 
     friend class nixlUcxEngine;
@@ -59,6 +134,7 @@ using ucx_connection_ptr_t = std::shared_ptr<nixlUcxConnection>;
 class nixlUcxPrivateMetadata : public nixlBackendMD {
     private:
         nixlUcxMem mem;
+        nixl_mem_t memType;
         nixl_blob_t rkeyStr;
 
     public:
@@ -75,22 +151,45 @@ class nixlUcxPrivateMetadata : public nixlBackendMD {
 // A public metadata has to implement put, and only has the remote metadata
 class nixlUcxPublicMetadata : public nixlBackendMD {
 public:
+    // Rkeys are only valid against the endpoint generation they were
+    // unpacked for, so both travel together in one immutable binding: a
+    // reader never pairs an rkey with an endpoint from a different
+    // generation, and the binding keeps its endpoints alive while any
+    // reader still holds it.
+    struct epBinding {
+        ucx_ep_vector_ptr_t eps;
+        std::vector<std::unique_ptr<nixl::ucx::rkey>> rkeys;
+    };
+    using ep_binding_ptr_t = std::shared_ptr<const epBinding>;
+
     nixlUcxPublicMetadata() : nixlBackendMD(false) {}
 
-    [[nodiscard]] const nixl::ucx::rkey &
-    getRkey(size_t id) const {
-        return *rkeys_[id];
+    [[nodiscard]] ep_binding_ptr_t
+    binding() const noexcept {
+        return std::atomic_load_explicit(&binding_, std::memory_order_acquire);
     }
 
+    // Unpacks the packed rkey blob against every endpoint of the given
+    // snapshot and publishes the new (eps, rkeys) pair atomically
     void
-    addRkey(const nixlUcxEp &ep, const void *rkey_buffer) {
-        rkeys_.emplace_back(std::make_unique<nixl::ucx::rkey>(ep, rkey_buffer));
+    bindRkeys(const ucx_ep_vector_ptr_t &eps, const void *rkey_buffer) {
+        auto binding = std::make_shared<epBinding>();
+        binding->eps = eps;
+        for (const auto &ep : *eps)
+            binding->rkeys.emplace_back(std::make_unique<nixl::ucx::rkey>(*ep, rkey_buffer));
+        std::atomic_store_explicit(&binding_,
+                                   ep_binding_ptr_t(std::move(binding)),
+                                   std::memory_order_release);
     }
 
     ucx_connection_ptr_t conn;
+    // Packed rkey blob this MD was loaded from; unpacked rkeys are bound
+    // to an endpoint, so the blob is kept to rebind them after the
+    // connection's endpoints are re-established
+    nixl_blob_t rkeyBlob;
 
 private:
-    std::vector<std::unique_ptr<nixl::ucx::rkey>> rkeys_;
+    ep_binding_ptr_t binding_;
 };
 
 // Forward declaration of CUDA context
@@ -100,6 +199,7 @@ private:
 // will be part of NIXL installation - we can have
 // HAVE_CUDA in h-files
 class nixlUcxCudaCtx;
+class nixlUcxBackendH;
 class nixlUcxCudaDevicePrimaryCtx;
 using nixlUcxCudaDevicePrimaryCtxPtr = std::shared_ptr<nixlUcxCudaDevicePrimaryCtx>;
 
@@ -125,6 +225,11 @@ public:
         return true;
     }
 
+    bool
+    supportsRecvCompletion() const override {
+        return recvCompletion_;
+    }
+
     nixl_mem_list_t
     getSupportedMems() const override;
 
@@ -178,6 +283,16 @@ public:
                      nixl_cost_t &method,
                      const nixl_opt_args_t *opt_args = nullptr) const override;
 
+    nixl_status_t
+    estimateXferCost(const nixl_xfer_op_t &operation,
+                     const nixl_meta_dlist_t &local,
+                     const nixl_meta_dlist_t &remote,
+                     const std::string &remote_agent,
+                     std::chrono::microseconds &duration,
+                     std::chrono::microseconds &err_margin,
+                     nixl_cost_t &method,
+                     const nixl_opt_args_t *opt_args = nullptr) const override;
+
     nixl_status_t
     postXfer(const nixl_xfer_op_t &operation,
              const nixl_meta_dlist_t &local,
@@ -189,8 +304,20 @@ public:
     nixl_status_t
     checkXfer(nixlBackendReqH *handle) const override;
     nixl_status_t
+    checkXferBatch(const std::vector<nixlBackendReqH *> &handles,
+                   std::vector<nixl_status_t> &statuses) const override;
+    nixl_status_t
     releaseReqH(nixlBackendReqH *handle) const override;
 
+    nixl_status_t
+    abortReqH(nixlBackendReqH *handle, size_t &bytes_transferred) const override;
+
+    nixl_status_t
+    getFailedDescs(nixlBackendReqH *handle, std::vector<size_t> &indices) const override;
+
+    void
+    dumpDiagnostics() const override;
+
     nixl_status_t
     createGpuXferReq(const nixlBackendReqH &req_hndl,
                      const nixl_meta_dlist_t &local_descs,
@@ -215,16 +342,52 @@ public:
     getNotifs(notif_list_t &notif_list) override;
     nixl_status_t
     genNotif(const std::string &remote_agent, const std::string &msg) const override;
+    nixl_status_t
+    getNotifTraceCtxs(std::vector<nixl_blob_t> &traces) override;
+
+    // Records a trace context that arrived with a notification; drained
+    // by the agent through getNotifTraceCtxs
+    void
+    recordNotifTrace(nixl_blob_t trace);
 
     // public function for UCX worker to mark connections as connected
     nixl_status_t
     checkConn(const std::string &remote_agent);
 
+    // CPU set progress threads pin themselves to at startup, from the
+    // agent configuration; empty leaves them unpinned
+    const std::string &
+    getProgressCpuset() const noexcept {
+        return progressCpuset_;
+    }
+
 private:
     // Helper to extract worker_id from opt_args->customParam or nullopt if not found
     [[nodiscard]] std::optional<size_t>
     getWorkerIdFromOptArgs(const nixl_opt_b_args_t *opt_args) const noexcept;
 
+    // Helper to honor a "pin_worker" request in opt_args->customParam: claims a
+    // shared worker exclusively for the calling thread, or nullopt if not requested
+    // (or no worker is left to claim)
+    [[nodiscard]] std::optional<size_t>
+    pinWorkerFromOptArgs(const nixl_opt_b_args_t *opt_args) const noexcept;
+
+    // Per-worker in-flight handle accounting, published via telemetry
+    void
+    workerDepthPosted(nixlUcxBackendH *handle) const;
+    void
+    workerDepthDone(nixlUcxBackendH *handle) const;
+
+    // Per-segment endpoint cost estimation shared by both
+    // estimateXferCost overloads
+    nixl_status_t
+    estimateXferCostImpl(const nixl_meta_dlist_t &local,
+                         const nixl_meta_dlist_t &remote,
+                         size_t worker_id,
+                         std::chrono::microseconds &duration,
+                         std::chrono::microseconds &err_margin,
+                         nixl_cost_t &method) const;
+
 protected:
     const std::vector<std::unique_ptr<nixlUcxWorker>> &
     getWorkers() const {
@@ -285,21 +448,101 @@ private:
               size_t length,
               const ucp_am_recv_param_t *param);
 
+    static ucs_status_t
+    notifBatchAmCb(void *arg,
+                   const void *header,
+                   size_t header_length,
+                   void *data,
+                   size_t length,
+                   const ucp_am_recv_param_t *param);
+
+    /* Notification batching for genNotif: when notif_batch_bytes is set,
+     * notifs to the same remote agent are coalesced into a single AM and
+     * flushed once the batch reaches the byte threshold or outlives
+     * notif_batch_delay_us. The receive side unpacks batches into the
+     * regular notification list, so getNotifs is unaffected. */
+    struct nixlUcxNotifBatch {
+        std::vector<std::string> msgs;
+        size_t bytes = 0;
+        nixlTime::us_t firstUs = 0;
+    };
+
+    nixl_status_t
+    notifFlushBatch(const std::string &remote_agent, nixlUcxNotifBatch &batch) const;
+
+    void
+    notifFlushExpired() const;
+
+    // Shared body of checkXfer and checkXferBatch; do_progress=false skips
+    // the handle's own worker progress pass and only harvests flags
+    nixl_status_t
+    checkXferImpl(nixlBackendReqH *handle, bool do_progress) const;
+
     nixl_status_t
     notifSendPriv(const std::string &remote_agent,
                   const std::string &msg,
                   nixlUcxReq &req,
-                  const std::unique_ptr<nixlUcxEp> &ep) const;
+                  const ucx_connection_ptr_t &conn,
+                  size_t worker_id,
+                  const nixl_blob_t &trace = {}) const;
+
+    // Eager/rendezvous flag for an AM of the given payload size, per the
+    // "am_eager_thresh" policy below
+    uint32_t
+    amSendFlags(const nixlUcxConnection &conn, size_t len) const;
+
+    // Fast endpoint re-establishment after a peer restart: rebuilds the
+    // connection's endpoints from its cached worker address and rebinds
+    // the rkeys of all MDs loaded over it, so the agent's connection slot
+    // and loaded MD handles stay valid
+    nixl_status_t
+    reconnectConnection(const ucx_connection_ptr_t &conn) const;
 
     ucx_connection_ptr_t
     getConnection(const std::string &remote_agent) const;
 
+    ucx_connection_ptr_t
+    getConnection(size_t conn_id) const;
+
     /* UCX data */
     std::unique_ptr<nixlUcxContext> uc;
     std::vector<std::unique_ptr<nixlUcxWorker>> uws;
     std::string workerAddr;
+    std::string progressCpuset_;
     mutable std::atomic<size_t> sharedWorkerIndex_;
 
+    /* Thread-to-worker affinity: a worker claimed through the "pin_worker"
+     * custom param is excluded from the shared round-robin rotation, so the
+     * owning thread posts and progresses it without contending with other
+     * threads on the worker lock. Depths count in-flight handles per worker
+     * and are published as telemetry events. */
+    mutable std::unique_ptr<std::atomic<bool>[]> pinnedWorkers_;
+    mutable std::unique_ptr<std::atomic<uint64_t>[]> workerDepths_;
+
+    /* Registration cache: recently deregistered ranges are kept mapped, up
+     * to the "mr_cache_size" byte budget, and reused when the same range is
+     * registered again, turning the ucp_mem_map cost into a map lookup.
+     * Disabled by default (budget 0): a cached entry is only valid while the
+     * VA still maps the same allocation, so it should be enabled when the
+     * application recycles buffers from a pool instead of freeing them. */
+    using mr_cache_key_t = std::tuple<nixl_mem_t, uintptr_t, size_t>;
+    struct nixlUcxMrCacheEntry {
+        mr_cache_key_t key;
+        nixlUcxPrivateMetadata *md;
+    };
+    size_t mrCacheBudget{0};
+    size_t mrCacheBytes{0};
+    std::mutex mrCacheLock;
+    std::list<nixlUcxMrCacheEntry> mrCacheLru; // front is most recent
+    std::map<mr_cache_key_t, std::list<nixlUcxMrCacheEntry>::iterator> mrCacheMap;
+
+    nixlUcxPrivateMetadata *
+    mrCacheLookup(const nixl_mem_t &nixl_mem, const nixlBlobDesc &mem);
+    bool
+    mrCacheInsert(nixlUcxPrivateMetadata *priv);
+    void
+    mrCacheFlush();
+
     /* CUDA data*/
     std::unique_ptr<nixlUcxCudaCtx> cudaCtx; // Context matching specific device
     bool cuda_addr_wa;
@@ -311,9 +554,43 @@ private:
     /* Notifications */
     notif_list_t notifMainList;
 
+    /* Trace contexts that rode in with notifications, surfaced to the
+     * agent's telemetry only; arrival order is kept but entries are not
+     * paired with individual notifications. Guarded by its own lock since
+     * the AM callbacks can run under different progress models. */
+    mutable std::mutex notifTraceLock_;
+    std::vector<nixl_blob_t> notifTraceList_;
+
+    /* Receive-side completion mode ("enable_recv_completion"): transfer
+     * notifications are fenced behind the data on the posting worker and
+     * sent right away, instead of being held until the initiator observes
+     * completion, so the target wakeup is driven by the NIC delivering
+     * the data. Opt-in: the notif can arrive even if the transfer later
+     * fails, which send-on-completion rules out. */
+    bool recvCompletion_ = false;
+
+    /* Eager/rendezvous policy for notification AMs ("am_eager_thresh"):
+     * unset keeps the historical always-eager behavior, a byte value
+     * applies a fixed threshold, and "auto" adapts per peer from the
+     * observed payload-size histogram kept on the connection. */
+    enum class am_eager_mode_t { always_eager, fixed, adaptive };
+    am_eager_mode_t amEagerMode_ = am_eager_mode_t::always_eager;
+    size_t amEagerThresh_ = 0;
+
+    /* genNotif batching state, see notifFlushBatch() */
+    size_t notifBatchBytes_ = 0;
+    nixlTime::us_t notifBatchDelayUs_ = 500;
+    mutable std::mutex notifBatchLock_;
+    mutable std::unordered_map<std::string, nixlUcxNotifBatch> notifBatches_;
+
     // Map of agent name to saved nixlUcxConnection info
     std::unordered_map<std::string, ucx_connection_ptr_t, std::hash<std::string>, strEqual>
         remoteConnMap;
+
+    // Flat integer-ID view of remoteConnMap: each connection gets a stable
+    // slot at loadRemoteConnInfo time, so the data path resolves it by index
+    // instead of hashing the agent name. Disconnected slots are left null.
+    std::vector<ucx_connection_ptr_t> connTable_;
 };
 
 class nixlUcxThread;
@@ -321,7 +598,7 @@ class nixlUcxThread;
 /**
  * Represents an engine with a single progress thread for all shared workers
  */
-class nixlUcxThreadEngine : public nixlUcxEngine {
+class nixlUcxThreadEngine NIXL_UCX_ENGINE_FINAL : public nixlUcxEngine {
 public:
     nixlUcxThreadEngine(const nixlBackendInitParams &init_params);
     ~nixlUcxThreadEngine();
@@ -342,11 +619,45 @@ private:
     notif_list_t notifPthr_;
 };
 
+class nixlProgressExecutor;
+
+/**
+ * Represents an engine progressed by the agent's shared executor instead of
+ * a dedicated thread: a single poller driving all shared workers is
+ * registered at construction and removed at destruction. The executor runs
+ * a poller on one thread at a time, so worker access stays serialized.
+ */
+class nixlUcxExecutorEngine NIXL_UCX_ENGINE_FINAL : public nixlUcxEngine {
+public:
+    nixlUcxExecutorEngine(const nixlBackendInitParams &init_params);
+    ~nixlUcxExecutorEngine();
+
+    nixl_status_t
+    getNotifs(notif_list_t &notif_list) override;
+
+protected:
+    int
+    vramApplyCtx() override;
+
+    void
+    appendNotif(std::string remote_name, std::string msg) override;
+
+private:
+    bool
+    progressOnce();
+
+    nixlProgressExecutor *executor_;
+    uint64_t pollerId_;
+    std::atomic<bool> ctxReapply_{false};
+    std::mutex notifMtx_;
+    notif_list_t notifExec_;
+};
+
 namespace asio {
 class io_context;
 }
 
-class nixlUcxThreadPoolEngine : public nixlUcxEngine {
+class nixlUcxThreadPoolEngine NIXL_UCX_ENGINE_FINAL : public nixlUcxEngine {
 public:
     nixlUcxThreadPoolEngine(const nixlBackendInitParams &init_params);
     ~nixlUcxThreadPoolEngine();
@@ -367,6 +678,12 @@ public:
     nixl_status_t
     getNotifs(notif_list_t &notif_list) override;
 
+    // Completion-side hook for dedicated threads to retire chunk backlog
+    void
+    chunkCompleted() const noexcept {
+        chunkBacklog_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
 protected:
     int
     vramApplyCtx() override;
@@ -384,6 +701,17 @@ protected:
                   size_t end_idx) const override;
 
 private:
+    /* Adaptive pool sizing: the started dedicated threads always form a
+     * prefix of dedicatedThreads_. The pool grows one thread at a time
+     * when the chunk backlog per active thread exceeds "pool_grow_backlog"
+     * and shrinks back towards "min_threads" once no composite traffic has
+     * been posted for "pool_shrink_idle_us". Resizes are published as
+     * telemetry events. */
+    void
+    adjustPoolSize() const;
+    void
+    shrinkIfIdle() const;
+
     std::unique_ptr<asio::io_context> io_;
     std::unique_ptr<nixlUcxThread> sharedThread_;
     std::vector<std::unique_ptr<nixlUcxThread>> dedicatedThreads_;
@@ -391,6 +719,13 @@ private:
     std::mutex notifMutex_;
     notif_list_t notifThread_;
     size_t splitBatchSize_;
+    size_t minDedicatedThreads_;
+    uint64_t poolGrowBacklog_;
+    nixlTime::us_t poolShrinkIdleUs_;
+    mutable size_t activeDedicatedThreads_ = 0;
+    mutable std::atomic<uint64_t> chunkBacklog_{0};
+    mutable std::atomic<uint64_t> lastPoolActivityUs_{0};
+    mutable std::mutex poolResizeMutex_;
 };
 
 #endif
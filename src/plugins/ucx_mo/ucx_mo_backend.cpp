@@ -16,6 +16,7 @@
  */
 #include <stdlib.h>
 #include <cassert>
+#include <atomic>
 
 
 // Local includes
@@ -33,6 +34,8 @@ using namespace std;
 #ifdef HAVE_CUDA
 
 #include <cuda_runtime.h>
+#include <cctype>
+#include <fstream>
 
 static uint32_t _getNumVramDevices()
 {
@@ -46,6 +49,24 @@ static uint32_t _getNumVramDevices()
     }
 }
 
+static int _getGpuNumaNode(uint32_t dev)
+{
+    char bus_id[32];
+
+    if (cudaDeviceGetPCIBusId(bus_id, sizeof(bus_id), dev) != cudaSuccess) {
+        return -1;
+    }
+    for (char *p = bus_id; *p; p++) {
+        *p = tolower(*p);
+    }
+
+    std::ifstream f(std::string("/sys/bus/pci/devices/") + bus_id + "/numa_node");
+    int node = -1;
+    if (!(f >> node)) {
+        return -1;
+    }
+    return node;
+}
 
 #else
 
@@ -53,6 +74,11 @@ static uint32_t _getNumVramDevices(){
     return 0;
 }
 
+static int _getGpuNumaNode(uint32_t)
+{
+    return -1;
+}
+
 #endif
 
 /****************************************
@@ -65,6 +91,7 @@ private:
     class dlMatrixElem {
     public:
         bool in_use, in_progress;
+        size_t lidx, ridx;
         nixl_meta_dlist_t *ldescs;
         nixl_meta_dlist_t *rdescs;
         nixlBackendReqH *ucx_req;
@@ -72,6 +99,8 @@ private:
         dlMatrixElem() {
             in_use = false;
             in_progress = false;
+            lidx = 0;
+            ridx = 0;
             ldescs = nullptr;
             rdescs = nullptr;
             ucx_req = nullptr;
@@ -82,6 +111,20 @@ private:
 
     dl_matrix_t dlMatrix;
 
+    // Flat view of the in-use matrix elements, built at prep time, so post/
+    // check/release don't scan the (mostly empty) l_eng x r_eng matrix.
+    // Pointers are stable as dlMatrix is never resized after construction.
+    std::vector<dlMatrixElem*> activeElems;
+    // Children still in flight; completed ones are swap-removed so each
+    // poll only probes the remainder
+    std::vector<dlMatrixElem*> pendingElems;
+
+    // Aggregated completion state: in-flight child count and the sticky
+    // parent status word, so a completed (or failed) request is answered
+    // without probing any child
+    std::atomic<size_t> remaining;
+    nixl_status_t parentStatus;
+
     std::string remoteAgent;
     bool notifNeed;
     std::string notifMsg;
@@ -89,6 +132,8 @@ public:
     nixlUcxMoRequestH(size_t l_eng_cnt, size_t r_eng_cnt) :
         dlMatrix(l_eng_cnt, std::vector<dlMatrixElem>(r_eng_cnt, dlMatrixElem()))
     {
+        remaining = 0;
+        parentStatus = NIXL_SUCCESS;
         notifNeed = false;
     }
 
@@ -129,6 +174,52 @@ nixlUcxMoEngine::getEngCnt()
     return _engineCnt;
 }
 
+void
+nixlUcxMoEngine::buildGpuEngMap()
+{
+    // Default: identity mapping, same behavior as before
+    gpuEngMap.resize(_gpuCnt);
+    for (uint32_t g = 0; g < _gpuCnt; g++) {
+        gpuEngMap[g] = g % _engineCnt;
+    }
+
+    // Group GPUs by the NUMA node of their PCIe slot. If the node of any
+    // GPU is unknown (no CUDA, VM without exposed topology), keep the
+    // identity mapping rather than guessing.
+    std::map<int, std::vector<uint32_t>> node_gpus;
+    for (uint32_t g = 0; g < _gpuCnt; g++) {
+        int node = _getGpuNumaNode(g);
+        if (node < 0) {
+            return;
+        }
+        node_gpus[node].push_back(g);
+    }
+    if (node_gpus.size() < 2) {
+        return;
+    }
+
+    // Partition engine indices across NUMA nodes proportionally to their
+    // GPU count, so a GPU's traffic goes through an engine whose worker
+    // and bounce buffers live on the same side of the root complex
+    // instead of crossing sockets.
+    uint32_t eng_base = 0;
+    for (auto &ng : node_gpus) {
+        std::vector<uint32_t> &gpus = ng.second;
+        uint32_t share = (_engineCnt * gpus.size()) / _gpuCnt;
+        if (share == 0) {
+            share = 1;
+        }
+        eng_base = eng_base % _engineCnt;
+        if (eng_base + share > _engineCnt) {
+            share = _engineCnt - eng_base;
+        }
+        for (size_t j = 0; j < gpus.size(); j++) {
+            gpuEngMap[gpus[j]] = eng_base + (j % share);
+        }
+        eng_base += share;
+    }
+}
+
 int32_t
 nixlUcxMoEngine::getEngIdx(nixl_mem_t type, uint64_t devId)
 {
@@ -138,6 +229,9 @@ nixlUcxMoEngine::getEngIdx(nixl_mem_t type, uint64_t devId)
         if (!(devId < _gpuCnt)) {
             return -1;
         }
+        if (devId < gpuEngMap.size()) {
+            return gpuEngMap[devId];
+        }
     case DRAM_SEG:
         break;
     default:
@@ -187,16 +281,106 @@ nixlUcxMoEngine::nixlUcxMoEngine(const nixlBackendInitParams* init_params):
     }
 
     setEngCnt(num_ucx_engines);
-    // Initialize required number of engines
-    for (uint32_t i = 0; i < getEngCnt(); i++) {
-        auto e = nixlUcxEngine::create(*init_params);
-        if (e->getInitErr()) {
-            this->initErr = true;
-            // TODO: Log error
-            return;
+    buildGpuEngMap();
+
+    // Engines are created lazily on first use; keep a private copy of
+    // the init params (the caller owns the originals) so deferred
+    // construction outlives this call
+    engCustomParams = *init_params->customParams;
+    engInitParams = *init_params;
+    engInitParams.customParams = &engCustomParams;
+    engines.resize(getEngCnt());
+
+    // Pre-warm hints: comma separated "l:r" engine-index pairs (engine
+    // index == GPU ordinal in the default mapping) whose channels are
+    // wired up at connect() time instead of on first transfer
+    if (custom_params->count("warm_pairs")) {
+        const string &s = (*custom_params)["warm_pairs"];
+        size_t pos = 0;
+        while (pos < s.length()) {
+            size_t colon = s.find(':', pos);
+            size_t comma = s.find(',', pos);
+            if (comma == string::npos) {
+                comma = s.length();
+            }
+            if ((colon == string::npos) || (colon > comma)) {
+                this->initErr = true;
+                // TODO: Log error
+                return;
+            }
+            uint32_t l = strtoul(s.substr(pos, colon - pos).c_str(), nullptr, 0);
+            uint32_t r = strtoul(s.substr(colon + 1, comma - colon - 1).c_str(),
+                                 nullptr, 0);
+            warmPairs.push_back({l, r});
+            pos = comma + 1;
         }
-        engines.push_back(std::move(e));
     }
+
+    // Notifications always flow through engine 0; create it up front so
+    // the notification path never races the lazy-creation lock
+    if (ensureEngine(0) != NIXL_SUCCESS) {
+        this->initErr = true;
+        // TODO: Log error
+        return;
+    }
+}
+
+nixl_status_t
+nixlUcxMoEngine::ensureEngine(uint32_t eidx) const
+{
+    std::lock_guard<std::mutex> guard(engLock);
+
+    if (engines[eidx]) {
+        return NIXL_SUCCESS;
+    }
+
+    auto e = nixlUcxEngine::create(engInitParams);
+    if (e->getInitErr()) {
+        // TODO: Log error
+        return NIXL_ERR_BACKEND;
+    }
+    engines[eidx] = std::move(e);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlUcxMoEngine::ensureChannel(nixlUcxMoConnection &conn,
+                               uint32_t lidx, uint32_t ridx) const
+{
+    nixl_status_t status = ensureEngine(lidx);
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+
+    std::lock_guard<std::mutex> guard(engLock);
+
+    if (conn.channels.count({lidx, ridx})) {
+        return NIXL_SUCCESS;
+    }
+
+    status = engines[lidx]->loadRemoteConnInfo(getEngName(conn.remoteAgent, ridx),
+                                               conn.engConnInfo[ridx]);
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+    conn.channels.insert({lidx, ridx});
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlUcxMoEngine::ensureIntMd(nixlUcxMoPublicMetadata *md, uint32_t lidx) const
+{
+    std::lock_guard<std::mutex> guard(engLock);
+
+    if (md->int_mds[lidx]) {
+        return NIXL_SUCCESS;
+    }
+
+    nixlBlobDesc input;
+    input.metaInfo = md->rkeyBlob;
+    return engines[lidx]->loadRemoteMD(input, md->memType,
+                                       getEngName(md->agent, md->eidx),
+                                       md->int_mds[lidx]);
 }
 
 nixl_mem_list_t
@@ -217,6 +401,15 @@ nixlUcxMoEngine::getConnInfo(std::string &str) const
     nixlSerDes sd;
     nixl_status_t status;
 
+    // Conn info must cover every engine a peer may target, so exporting
+    // local MD materializes the remaining lazy engines
+    for (uint32_t i = 0; i < _engineCnt; i++) {
+        status = ensureEngine(i);
+        if (NIXL_SUCCESS != status) {
+            return status;
+        }
+    }
+
     // Serialize the number of engines
     size_t sz = engines.size();
     sd.addBuf("Count", &sz, sizeof(sz));
@@ -267,15 +460,11 @@ nixlUcxMoEngine::loadRemoteConnInfo (const string  &remote_agent,
 
     conn.num_engines = sz;
 
+    // The remote addresses are only recorded here; engine-pair channels
+    // are wired up lazily from them on the first transfer touching the
+    // pair (or at connect() for pre-warmed pairs)
     for(size_t idx = 0; idx < sz; idx++) {
-        string cinfo;
-        cinfo = sd.getStr("Value");
-        for (auto &e : engines) {
-            status = e->loadRemoteConnInfo(getEngName(remote_agent, idx), cinfo);
-            if (status != NIXL_SUCCESS) {
-                return status;
-            }
-        }
+        conn.engConnInfo.push_back(sd.getStr("Value"));
     }
 
     remoteConnMap[remote_agent] = conn;
@@ -295,9 +484,16 @@ nixlUcxMoEngine::connect(const string &remote_agent)
 
     nixlUcxMoConnection &conn = it->second;
 
-    for (auto &e : engines) {
-        for (uint32_t idx = 0; idx < conn.num_engines; idx++) {
-            status = e->connect(getEngName(remote_agent, idx));
+    // Notifications ride channel (0,0); wire it up together with any
+    // pre-warm hints, the rest of the matrix comes up on first use
+    status = ensureChannel(conn, 0, 0);
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+
+    for (auto &p : warmPairs) {
+        if ((p.first < _engineCnt) && (p.second < conn.num_engines)) {
+            status = ensureChannel(conn, p.first, p.second);
             if (status != NIXL_SUCCESS) {
                 return status;
             }
@@ -319,10 +515,16 @@ nixlUcxMoEngine::disconnect(const string &remote_agent)
 
     nixlUcxMoConnection &conn = it->second;
 
+    // Only channels that were actually wired up exist in the children;
+    // an engine that never touched this peer reports NOT_FOUND, which is
+    // the expected outcome under lazy instantiation
     for (auto &e : engines) {
+        if (!e) {
+            continue;
+        }
         for (uint32_t idx = 0; idx < conn.num_engines; idx++) {
             status = e->disconnect(getEngName(remote_agent, idx));
-            if (status != NIXL_SUCCESS) {
+            if ((status != NIXL_SUCCESS) && (status != NIXL_ERR_NOT_FOUND)) {
                 return status;
             }
         }
@@ -353,6 +555,11 @@ nixlUcxMoEngine::registerMem (const nixlBlobDesc &mem,
         return NIXL_ERR_INVALID_PARAM;
     }
 
+    status = ensureEngine(eidx);
+    if (NIXL_SUCCESS != status) {
+        return status;
+    }
+
     priv->memType = nixl_mem;
     priv->eidx = eidx;
     status = engines[eidx]->registerMem(mem, nixl_mem, priv->md);
@@ -402,7 +609,6 @@ nixlUcxMoEngine::internalMDHelper (const nixl_blob_t &blob,
     nixlSerDes sd;
     nixl_blob_t ucx_blob;
     nixl_status_t status;
-    nixlBlobDesc input_int;
 
     auto md = std::make_unique<nixlUcxMoPublicMetadata>();
 
@@ -431,17 +637,12 @@ nixlUcxMoEngine::internalMDHelper (const nixl_blob_t &blob,
         return status;
     }
 
-    for (auto &e : engines) {
-        nixlBackendMD *int_md;
-        input_int.metaInfo = ucx_blob;
-        status = e->loadRemoteMD(input_int, nixl_mem,
-                                 getEngName(agent, md->eidx),
-                                 int_md);
-        if (status != NIXL_SUCCESS) {
-            return status;
-        }
-        md->int_mds.push_back(int_md);
-    }
+    // The rkey is only recorded here; per-engine slots are filled lazily
+    // on the first transfer pairing that local engine with this region
+    md->int_mds.assign(_engineCnt, nullptr);
+    md->rkeyBlob = ucx_blob;
+    md->memType = nixl_mem;
+    md->agent = agent;
 
     output = md.release();
     return NIXL_SUCCESS;
@@ -471,6 +672,9 @@ nixlUcxMoEngine::unloadMD (nixlBackendMD* input)
 
     nixlUcxMoPublicMetadata *md = (nixlUcxMoPublicMetadata *)input;
     for (size_t i = 0; i < md->int_mds.size(); i++) {
+        if (!md->int_mds[i]) {
+            continue;
+        }
         status = engines[i]->unloadMD(md->int_mds[i]);
         if (NIXL_SUCCESS != status) {
             return status;
@@ -491,8 +695,7 @@ nixlUcxMoEngine::prepXfer (const nixl_xfer_op_t &operation,
                            nixlBackendReqH* &handle,
                            const nixl_opt_b_args_t *opt_args) const
 {
-    size_t lidx, ridx;
-    size_t lidx_max, ridx_max;
+    size_t prepped;
 
     // Number of local and remote descriptors must match
     int des_cnt = local.descCount();
@@ -514,7 +717,7 @@ nixlUcxMoEngine::prepXfer (const nixl_xfer_op_t &operation,
     if(it == remoteConnMap.end()) {
         return NIXL_ERR_INVALID_PARAM;
     }
-    const nixlUcxMoConnection &conn = it->second;
+    nixlUcxMoConnection &conn = it->second;
 
     /* Allocate request and fill communication distribution matrix */
     size_t l_eng_cnt = engines.size();
@@ -542,12 +745,28 @@ nixlUcxMoEngine::prepXfer (const nixl_xfer_op_t &operation,
             goto err_clean_req;
         }
 
+        /* First transfer touching this engine pair instantiates the
+         * child engine, its channel and the per-engine rkey */
+        {
+            nixl_status_t ret = ensureChannel(conn, lidx, ridx);
+            if (NIXL_SUCCESS != ret) {
+                return ret;
+            }
+            ret = ensureIntMd(rmd, lidx);
+            if (NIXL_SUCCESS != ret) {
+                return ret;
+            }
+        }
+
         /* Allocate internal dlists if needed */
         if (!req->dlMatrix[lidx][ridx].in_use) {
             req->dlMatrix[lidx][ridx].in_use = true;
+            req->dlMatrix[lidx][ridx].lidx = lidx;
+            req->dlMatrix[lidx][ridx].ridx = ridx;
             req->dlMatrix[lidx][ridx].ldescs = new nixl_meta_dlist_t(local.getType());
 
             req->dlMatrix[lidx][ridx].rdescs = new nixl_meta_dlist_t(remote.getType());
+            req->activeElems.push_back(&req->dlMatrix[lidx][ridx]);
         }
 
         nixlMetaDesc ldesc = local[i];
@@ -559,23 +778,18 @@ nixlUcxMoEngine::prepXfer (const nixl_xfer_op_t &operation,
         req->dlMatrix[lidx][ridx].rdescs->addDesc(rdesc);
     }
 
-    // Prepare UCX requests!
-    for(lidx = 0; lidx < req->dlMatrix.size(); lidx++) {
-        for(ridx = 0; ridx < req->dlMatrix[lidx].size(); ridx++) {
-            nixl_status_t ret;
+    // Prepare UCX requests, one batched pass over the active children only
+    for(prepped = 0; prepped < req->activeElems.size(); prepped++) {
+        auto *elem = req->activeElems[prepped];
+        nixl_status_t ret;
 
-            if (!req->dlMatrix[lidx][ridx].in_use) {
-                // Skip unused matrix elements
-                continue;
-            }
-            ret = engines[lidx]->prepXfer(operation,
-                                          *req->dlMatrix[lidx][ridx].ldescs,
-                                          *req->dlMatrix[lidx][ridx].rdescs,
-                                          getEngName(remote_agent, ridx),
-                                          req->dlMatrix[lidx][ridx].ucx_req);
-            if (NIXL_SUCCESS != ret) {
-                goto err_clean_sub_req;
-            }
+        ret = engines[elem->lidx]->prepXfer(operation,
+                                            *elem->ldescs,
+                                            *elem->rdescs,
+                                            getEngName(remote_agent, elem->ridx),
+                                            elem->ucx_req);
+        if (NIXL_SUCCESS != ret) {
+            goto err_clean_sub_req;
         }
     }
 
@@ -585,22 +799,9 @@ nixlUcxMoEngine::prepXfer (const nixl_xfer_op_t &operation,
 
 err_clean_sub_req:
     /* Release only allocated requests */
-    lidx_max = lidx + 1;
-    ridx_max = ridx;
-    for(lidx = 0; lidx < lidx_max; lidx++) {
-        for(ridx = 0; ridx < ridx_max; ridx++) {
-            nixl_status_t ret;
-
-            if (!req->dlMatrix[lidx][ridx].in_use) {
-                // Skip unused matrix elements
-                continue;
-            }
-
-            engines[lidx]->releaseReqH(req->dlMatrix[lidx][ridx].ucx_req);
-            if (NIXL_SUCCESS != ret) {
-                // TODO: Output error, but still continue trying to fix others
-            }
-        }
+    for(size_t i = 0; i < prepped; i++) {
+        auto *elem = req->activeElems[i];
+        engines[elem->lidx]->releaseReqH(elem->ucx_req);
     }
 
 err_clean_req:
@@ -618,39 +819,39 @@ nixlUcxMoEngine::postXfer (const nixl_xfer_op_t &operation,
                            const nixl_opt_b_args_t *opt_args) const
 {
     nixlUcxMoRequestH *req = (nixlUcxMoRequestH *)handle;
-    bool in_progress = false;
 
-    for(size_t lidx = 0; lidx < req->dlMatrix.size(); lidx++) {
-        for(size_t ridx = 0; ridx < req->dlMatrix[lidx].size(); ridx++) {
-            nixl_status_t ret;
+    // Batched posting: one pass over the active children, accumulating the
+    // aggregate in-flight count for completion tracking
+    req->pendingElems.clear();
+    req->parentStatus = NIXL_SUCCESS;
 
-            if (!req->dlMatrix[lidx][ridx].in_use) {
-                // Skip unused matrix elements
-                continue;
-            }
+    for (auto *elem : req->activeElems) {
+        nixl_status_t ret;
 
-            ret = engines[lidx]->postXfer(operation,
-                                          *req->dlMatrix[lidx][ridx].ldescs,
-                                          *req->dlMatrix[lidx][ridx].rdescs,
-                                          getEngName(remote_agent, ridx),
-                                          req->dlMatrix[lidx][ridx].ucx_req);
-
-            /* if transfer wasn't immediately completed */
-            switch(ret) {
-            case NIXL_IN_PROG:
-                req->dlMatrix[lidx][ridx].in_progress = true;
-                in_progress = true;
-            case NIXL_SUCCESS:
-                // Nothing to do
-                break;
-            default:
-                // Error.
-                return ret;
-            }
+        ret = engines[elem->lidx]->postXfer(operation,
+                                            *elem->ldescs,
+                                            *elem->rdescs,
+                                            getEngName(remote_agent, elem->ridx),
+                                            elem->ucx_req);
+
+        /* if transfer wasn't immediately completed */
+        switch(ret) {
+        case NIXL_IN_PROG:
+            elem->in_progress = true;
+            req->pendingElems.push_back(elem);
+        case NIXL_SUCCESS:
+            // Nothing to do
+            break;
+        default:
+            // Error.
+            req->parentStatus = ret;
+            return ret;
         }
     }
 
-    if (in_progress) {
+    req->remaining.store(req->pendingElems.size(), std::memory_order_relaxed);
+
+    if (!req->pendingElems.empty()) {
         // The transfers are performed via parallel UCX workers (meaning QPs).
         // This doesn't allow piggybacking the notification in postXfer. We
         // can only send it after all workers are flushed, in checkXfer().
@@ -679,34 +880,42 @@ nixl_status_t
 nixlUcxMoEngine::checkXfer (nixlBackendReqH *handle) const
 {
     nixlUcxMoRequestH *req = (nixlUcxMoRequestH *)handle;
-    nixl_status_t out_ret = NIXL_SUCCESS;
 
-    for(size_t lidx = 0; lidx < req->dlMatrix.size(); lidx++) {
-        for(size_t ridx = 0; ridx < req->dlMatrix[lidx].size(); ridx++) {
-            nixl_status_t ret;
+    // A child error is sticky; answer without re-probing
+    if (req->parentStatus < 0) {
+        return req->parentStatus;
+    }
 
-            if (!req->dlMatrix[lidx][ridx].in_progress) {
-                // Skip not-in-progress matrix elements
-                continue;
-            }
+    // Probe only the children still in flight; completed ones were
+    // swap-removed on a previous poll
+    for (size_t i = 0; i < req->pendingElems.size();) {
+        dlMatrixElem *elem = req->pendingElems[i];
+        nixl_status_t ret;
 
-            ret = engines[lidx]->checkXfer(req->dlMatrix[lidx][ridx].ucx_req);
-            switch (ret) {
-            case NIXL_SUCCESS:
-                /* Mark as completed */
-                req->dlMatrix[lidx][ridx].in_progress = false;
-                break;
-            case NIXL_IN_PROG:
-                out_ret = NIXL_IN_PROG;
-                break;
-            default:
-                /* Any other ret value is unexpected */
-                return ret;
-            }
+        ret = engines[elem->lidx]->checkXfer(elem->ucx_req);
+        switch (ret) {
+        case NIXL_SUCCESS:
+            /* Mark as completed and drop from the pending set */
+            elem->in_progress = false;
+            req->pendingElems[i] = req->pendingElems.back();
+            req->pendingElems.pop_back();
+            req->remaining.fetch_sub(1, std::memory_order_relaxed);
+            break;
+        case NIXL_IN_PROG:
+            i++;
+            break;
+        default:
+            /* Any other ret value is unexpected */
+            req->parentStatus = ret;
+            return ret;
         }
     }
 
-    if ((NIXL_SUCCESS == out_ret) && req->notifNeed) {
+    if (req->remaining.load(std::memory_order_relaxed) > 0) {
+        return NIXL_IN_PROG;
+    }
+
+    if (req->notifNeed) {
         nixl_status_t ret;
 
         // Now as all UCX backends (workers) have been flushed,
@@ -716,9 +925,12 @@ nixlUcxMoEngine::checkXfer (nixlBackendReqH *handle) const
             /* Return error, TODO: add output */
             return ret;
         }
+        // Only send it once; repeated polls of a completed request are
+        // answered from the aggregate state above
+        req->notifNeed = false;
     }
 
-    return out_ret;
+    return NIXL_SUCCESS;
 }
 
 nixl_status_t
@@ -727,20 +939,13 @@ nixlUcxMoEngine::releaseReqH(nixlBackendReqH* handle) const
     nixlUcxMoRequestH *req = (nixlUcxMoRequestH *)handle;
     nixl_status_t out_ret = NIXL_SUCCESS;
 
-    for(size_t lidx = 0; lidx < req->dlMatrix.size(); lidx++) {
-        for(size_t ridx = 0; ridx < req->dlMatrix[lidx].size(); ridx++) {
-            nixl_status_t ret;
-
-            if (!req->dlMatrix[lidx][ridx].in_use) {
-                // Skip unused matrix elements
-                continue;
-            }
+    for (auto *elem : req->activeElems) {
+        nixl_status_t ret;
 
-            ret = engines[lidx]->releaseReqH(req->dlMatrix[lidx][ridx].ucx_req);
-            if (NIXL_SUCCESS != ret) {
-                // TODO: Output error, but still continue trying to fix others
-                out_ret = ret;
-            }
+        ret = engines[elem->lidx]->releaseReqH(elem->ucx_req);
+        if (NIXL_SUCCESS != ret) {
+            // TODO: Output error, but still continue trying to fix others
+            out_ret = ret;
         }
     }
 
@@ -753,7 +958,9 @@ nixlUcxMoEngine::progress()
     int ret = 0;
     // Iterate over all elements cancelling each one
     for ( auto &e : engines ) {
-        ret += e->progress();
+        if (e) {
+            ret += e->progress();
+        }
     }
     return ret;
 }
@@ -767,5 +974,17 @@ nixlUcxMoEngine::getNotifs(notif_list_t &notif_list)
 nixl_status_t
 nixlUcxMoEngine::genNotif(const string &remote_agent, const string &msg) const
 {
+    // connect() wires channel (0,0) up, but a notification can legally be
+    // the first operation towards a peer
+    auto it = remoteConnMap.find(remote_agent);
+    if (it == remoteConnMap.end()) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    nixl_status_t status = ensureChannel(it->second, 0, 0);
+    if (NIXL_SUCCESS != status) {
+        return status;
+    }
+
     return engines[0]->genNotif(getEngName(remote_agent, 0), msg);
 }
@@ -24,6 +24,8 @@
 #include <mutex>
 #include <cassert>
 #include <memory>
+#include <set>
+#include <utility>
 
 #include "nixl.h"
 #include "ucx_backend.h"
@@ -36,6 +38,11 @@ class nixlUcxMoConnection : public nixlBackendConnMD {
     private:
         std::string remoteAgent;
         uint32_t num_engines;
+        // Remote per-engine worker addresses, kept verbatim so lazily
+        // created channels can be wired up on first use
+        std::vector<std::string> engConnInfo;
+        // (local engine, remote engine) channels already wired up
+        std::set<std::pair<uint32_t, uint32_t>> channels;
 
     public:
         // Extra information required for UCX connections
@@ -70,7 +77,13 @@ class nixlUcxMoPublicMetadata : public nixlBackendMD
 {
     uint32_t eidx;
     nixlUcxMoConnection conn;
+    // Per local engine, filled lazily on the first transfer touching that
+    // engine; slots stay null until then
     std::vector<nixlBackendMD*> int_mds;
+    // Inputs needed to fill a slot lazily
+    nixl_blob_t rkeyBlob;
+    nixl_mem_t memType;
+    std::string agent;
 
 public:
     nixlUcxMoPublicMetadata() : nixlBackendMD(false) {}
@@ -87,19 +100,39 @@ class nixlUcxMoEngine : public nixlBackendEngine {
 private:
     uint32_t _engineCnt;
     uint32_t _gpuCnt;
+    // GPU -> engine index mapping biased towards NUMA/PCIe-local engines
+    std::vector<uint32_t> gpuEngMap;
     int setEngCnt(uint32_t host_engines);
     uint32_t getEngCnt();
+    void buildGpuEngMap();
     int32_t getEngIdx(nixl_mem_t type, uint64_t devId);
     std::string getEngName(const std::string &baseName, uint32_t eidx) const;
     std::string getEngBase(const std::string &engName);
     bool pthrOn;
 
-    // UCX backends data
-    std::vector<std::unique_ptr<nixlUcxEngine>> engines;
+    // UCX backends data; slots are filled lazily by ensureEngine() on
+    // first use, so a replica touching two GPUs on a dense box doesn't
+    // pay worker setup for all of them at init
+    mutable std::vector<std::unique_ptr<nixlUcxEngine>> engines;
+    // Private copy of the init params (and the custom params they point
+    // into, which the caller owns) for deferred engine construction
+    nixlBackendInitParams engInitParams;
+    nixl_b_params_t engCustomParams;
+    mutable std::mutex engLock;
+    // Pre-warm hints: (local engine, remote engine) index pairs whose
+    // channels are wired up at connect() time instead of on first transfer
+    std::vector<std::pair<uint32_t, uint32_t>> warmPairs;
     // Map of agent name to saved nixlUcxConnection info
     using remote_conn_map_t = std::map<std::string, nixlUcxMoConnection>;
     using remote_comm_it_t = remote_conn_map_t::iterator;
-    remote_conn_map_t remoteConnMap;
+    mutable remote_conn_map_t remoteConnMap;
+
+    // Lazy instantiation helpers; all are idempotent and cheap once the
+    // engine/channel/metadata slot exists
+    nixl_status_t ensureEngine(uint32_t eidx) const;
+    nixl_status_t ensureChannel(nixlUcxMoConnection &conn,
+                                uint32_t lidx, uint32_t ridx) const;
+    nixl_status_t ensureIntMd(nixlUcxMoPublicMetadata *md, uint32_t lidx) const;
 
     // Memory helper
     nixl_status_t internalMDHelper (const nixl_blob_t &blob,
@@ -26,7 +26,14 @@
 
 template<typename T> class sharedRingBuffer {
 public:
-    sharedRingBuffer(const std::string &name, bool create, int version, size_t size = 0);
+    // hugepages requests best-effort transparent hugepage backing for the
+    // mapping on creation; the whole mapping is pre-faulted either way, so
+    // the first burst of pushes takes no minor faults
+    sharedRingBuffer(const std::string &name,
+                     bool create,
+                     int version,
+                     size_t size = 0,
+                     bool hugepages = false);
     ~sharedRingBuffer();
 
     // Non-copyable
@@ -36,6 +43,12 @@ public:
 
     bool
     push(const T &item);
+    // Batched publication: copies up to count items and advances the
+    // shared producer cursor once, so a burst pays a single release store
+    // instead of one per item. Returns how many items were queued,
+    // bounded by the free space; the rest is the caller's to spill.
+    size_t
+    pushBatch(const T *items, size_t count);
     bool
     pop(T &item);
     size_t
@@ -67,10 +80,13 @@ private:
     createCyclicBuffer(const std::string &name, int version);
     void
     openCyclicBuffer(const std::string &name, int version);
+    void
+    prepareMapping(void *ptr, size_t total);
 
     bufferHeader *header_;
     T *data_;
     size_t bufferSize_;
+    bool hugepages_;
 };
 
 #include "cyclic_buffer.tpp"
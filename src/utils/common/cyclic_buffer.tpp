@@ -26,10 +26,15 @@
 #include "util.h"
 
 template<typename T>
-sharedRingBuffer<T>::sharedRingBuffer(const std::string &name, bool create, int version, size_t size)
+sharedRingBuffer<T>::sharedRingBuffer(const std::string &name,
+                                      bool create,
+                                      int version,
+                                      size_t size,
+                                      bool hugepages)
     : header_(nullptr),
       data_(nullptr),
-      bufferSize_(size) {
+      bufferSize_(size),
+      hugepages_(hugepages) {
 
     if (create) {
         createCyclicBuffer(name, version);
@@ -61,6 +66,23 @@ sharedRingBuffer<T>::push(const T &item) {
     return true;
 }
 
+template<typename T>
+size_t
+sharedRingBuffer<T>::pushBatch(const T *items, size_t count) {
+    size_t write_pos = header_->write_pos.load(std::memory_order_relaxed);
+    size_t read_pos = header_->read_pos.load(std::memory_order_acquire);
+    size_t free_slots = (read_pos - write_pos - 1) & header_->mask;
+
+    if (count > free_slots) count = free_slots;
+
+    for (size_t i = 0; i < count; i++)
+        data_[(write_pos + i) & header_->mask] = items[i];
+
+    // One cursor bump publishes the whole batch
+    header_->write_pos.store((write_pos + count) & header_->mask, std::memory_order_release);
+    return count;
+}
+
 template<typename T>
 bool
 sharedRingBuffer<T>::pop(T &item) {
@@ -164,6 +186,8 @@ sharedRingBuffer<T>::createCyclicBuffer(const std::string &name, int version) {
         throw std::runtime_error("Failed to map file memory");
     }
 
+    prepareMapping(ptr, getTotalSize());
+
     header_ = static_cast<bufferHeader *>(ptr);
     data_ = reinterpret_cast<T *>(static_cast<char *>(ptr) + sizeof(bufferHeader));
 
@@ -172,6 +196,25 @@ sharedRingBuffer<T>::createCyclicBuffer(const std::string &name, int version) {
     header_->expected_version = version;
 }
 
+// Best-effort hugepage backing and pre-faulting of a fresh mapping:
+// touching every page up front moves the minor faults (and the THP
+// collapse, when the madvise takes effect) out of the first burst of
+// pushes on the hot path
+template<typename T>
+void
+sharedRingBuffer<T>::prepareMapping(void *ptr, size_t total) {
+#ifdef MADV_HUGEPAGE
+    if (hugepages_ && (madvise(ptr, total, MADV_HUGEPAGE) != 0))
+        NIXL_DEBUG << "MADV_HUGEPAGE not applied to shared buffer: " << strerror(errno);
+#endif
+
+    const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    volatile char *bytes = static_cast<volatile char *>(ptr);
+    // Read-modify-write dirties each page without changing its content
+    for (size_t off = 0; off < total; off += page)
+        bytes[off] = bytes[off];
+}
+
 template<typename T>
 void
 sharedRingBuffer<T>::openCyclicBuffer(const std::string &name, int version) {
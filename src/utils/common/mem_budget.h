@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_MEM_BUDGET_H
+#define _NIXL_MEM_BUDGET_H
+
+#include <atomic>
+#include <cstdint>
+
+// Byte accounting for backend-internal allocations (bounce buffers, request
+// pools, staging slabs). Growth paths call tryReserve and back off when a
+// configured cap would be exceeded, so pools degrade gracefully instead of
+// growing until the process is OOM-killed; memory that already exists is
+// recorded with charge. A zero cap means unlimited, accounting only.
+class nixlMemBudget {
+public:
+    void
+    setCap(uint64_t bytes) {
+        cap_.store(bytes, std::memory_order_relaxed);
+    }
+
+    uint64_t
+    cap() const {
+        return cap_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t
+    used() const {
+        return used_.load(std::memory_order_relaxed);
+    }
+
+    // Charges bytes unless the cap would be exceeded; returns false (and
+    // charges nothing) on rejection
+    bool
+    tryReserve(uint64_t bytes) {
+        const uint64_t cap = cap_.load(std::memory_order_relaxed);
+        uint64_t used = used_.load(std::memory_order_relaxed);
+        do {
+            if (cap != 0 && used + bytes > cap) {
+                return false;
+            }
+        } while (!used_.compare_exchange_weak(
+            used, used + bytes, std::memory_order_relaxed, std::memory_order_relaxed));
+        return true;
+    }
+
+    // Unconditional charge, for memory that is already allocated
+    void
+    charge(uint64_t bytes) {
+        used_.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void
+    release(uint64_t bytes) {
+        used_.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> used_{0};
+    std::atomic<uint64_t> cap_{0};
+};
+
+#endif // _NIXL_MEM_BUDGET_H
@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nixl_affinity.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_split.h"
+#include "nixl_log.h"
+
+namespace nixlAffinity {
+
+bool
+applyToSelf(const std::string &cpuset) {
+    if (cpuset.empty()) {
+        return true;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    int cores = 0;
+
+    for (absl::string_view item : absl::StrSplit(cpuset, ',', absl::SkipEmpty())) {
+        int first, last;
+        size_t dash = item.find('-');
+        if (dash == absl::string_view::npos) {
+            if (!absl::SimpleAtoi(item, &first)) {
+                NIXL_WARN << "Malformed cpuset entry '" << item << "' in '" << cpuset << "'";
+                return false;
+            }
+            last = first;
+        } else {
+            if (!absl::SimpleAtoi(item.substr(0, dash), &first) ||
+                !absl::SimpleAtoi(item.substr(dash + 1), &last) || (last < first)) {
+                NIXL_WARN << "Malformed cpuset range '" << item << "' in '" << cpuset << "'";
+                return false;
+            }
+        }
+        for (int core = first; core <= last; core++) {
+            if ((core < 0) || (core >= CPU_SETSIZE)) {
+                NIXL_WARN << "Core " << core << " out of range in cpuset '" << cpuset << "'";
+                return false;
+            }
+            CPU_SET(core, &set);
+            cores++;
+        }
+    }
+
+    if (cores == 0) {
+        NIXL_WARN << "Cpuset '" << cpuset << "' names no core";
+        return false;
+    }
+
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+        NIXL_WARN << "Failed to apply cpuset '" << cpuset << "' to thread";
+        return false;
+    }
+    return true;
+}
+
+} // namespace nixlAffinity
@@ -0,0 +1,34 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_AFFINITY_H
+#define _NIXL_AFFINITY_H
+
+#include <string>
+
+namespace nixlAffinity {
+
+// Pins the calling thread to the cores given as a comma separated list
+// with ranges (e.g. "2,4-7"). An empty cpuset is a no-op that returns
+// true. Returns false (with a warning logged) when the cpuset is
+// malformed, names no valid core, or the affinity call fails; the thread
+// then keeps its previous affinity.
+bool
+applyToSelf(const std::string &cpuset);
+
+} // namespace nixlAffinity
+
+#endif
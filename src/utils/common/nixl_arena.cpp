@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nixl_arena.h"
+
+#include <atomic>
+#include <cerrno>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "nixl_log.h"
+
+namespace {
+    // Requests stay cache-line aligned so arena-backed buffers never
+    // false-share with neighbors
+    constexpr size_t arenaAlign = 64;
+
+    std::atomic<nixlMemArena*> arenaInstance{nullptr};
+
+    size_t alignUp(size_t val) {
+        return (val + arenaAlign - 1) & ~(arenaAlign - 1);
+    }
+} // namespace
+
+nixlMemArena::nixlMemArena(char* base, size_t size) : base(base), size(size) {
+    freeRanges.push_back({base, size});
+}
+
+bool nixlMemArena::configure(size_t bytes, bool huge_pages, int numa_node) {
+    if (arenaInstance.load(std::memory_order_acquire)) {
+        NIXL_WARN << "Internal arena already configured, ignoring new policy";
+        return false;
+    }
+
+    void* seg = MAP_FAILED;
+    if (huge_pages) {
+        seg = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (seg == MAP_FAILED)
+            NIXL_WARN << "Huge page arena allocation failed (errno=" << errno
+                      << "), falling back to regular pages";
+    }
+    if (seg == MAP_FAILED)
+        seg = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (seg == MAP_FAILED) {
+        NIXL_PERROR << "Internal arena mmap of " << bytes << " bytes failed";
+        return false;
+    }
+
+    if (numa_node >= 0) {
+#ifdef __NR_mbind
+        // MPOL_BIND without pulling in a libnuma dependency
+        constexpr int mpolBind = 2;
+        unsigned long nodemask = 1UL << numa_node;
+        if (syscall(__NR_mbind, seg, bytes, mpolBind, &nodemask,
+                    sizeof(nodemask) * 8, 0) != 0)
+            NIXL_WARN << "NUMA binding of internal arena to node " << numa_node
+                      << " failed (errno=" << errno << ")";
+#else
+        NIXL_WARN << "NUMA binding not supported on this platform";
+#endif
+    }
+
+    arenaInstance.store(new nixlMemArena(static_cast<char*>(seg), bytes),
+                        std::memory_order_release);
+    NIXL_DEBUG << "Internal arena configured: " << bytes << " bytes, huge_pages="
+               << huge_pages << ", numa_node=" << numa_node;
+    return true;
+}
+
+nixlMemArena* nixlMemArena::instance() {
+    return arenaInstance.load(std::memory_order_acquire);
+}
+
+void* nixlMemArena::alloc(size_t bytes) {
+    bytes = alignUp(bytes);
+    std::lock_guard<std::mutex> guard(lock);
+    for (auto it = freeRanges.begin(); it != freeRanges.end(); ++it) {
+        if (it->len < bytes)
+            continue;
+        char* addr = it->addr;
+        it->addr += bytes;
+        it->len -= bytes;
+        if (it->len == 0)
+            freeRanges.erase(it);
+        return addr;
+    }
+    return nullptr; // exhausted, caller falls back to the heap
+}
+
+void nixlMemArena::free(void* ptr, size_t bytes) {
+    bytes = alignUp(bytes);
+    char* addr = static_cast<char*>(ptr);
+    std::lock_guard<std::mutex> guard(lock);
+
+    // Insert sorted by address, then merge with both neighbors
+    auto it = freeRanges.begin();
+    while ((it != freeRanges.end()) && (it->addr < addr))
+        ++it;
+    it = freeRanges.insert(it, {addr, bytes});
+
+    if ((it + 1 != freeRanges.end()) && (it->addr + it->len == (it + 1)->addr)) {
+        it->len += (it + 1)->len;
+        freeRanges.erase(it + 1);
+    }
+    if ((it != freeRanges.begin()) &&
+        ((it - 1)->addr + (it - 1)->len == it->addr)) {
+        (it - 1)->len += it->len;
+        freeRanges.erase(it);
+    }
+}
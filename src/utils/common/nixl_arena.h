@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_ARENA_H
+#define _NIXL_ARENA_H
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/*
+ * Process-wide arena for internal metadata-path buffers, backed by a
+ * single mmap'ed segment that can be placed on huge pages and bound to a
+ * NUMA node. The agent configures it once from nixlAgentConfig; until
+ * then (and whenever the arena is exhausted) nixlArenaAllocator falls
+ * back to the regular heap, so the arena is strictly an optimization.
+ *
+ * Allocation is first-fit over a sorted, coalesced free list under a
+ * mutex; the metadata path allocates rarely enough that contention is
+ * not a concern. The segment is never unmapped, so pointers handed out
+ * stay valid for the process lifetime.
+ */
+class nixlMemArena {
+    public:
+        // One-time setup; returns false (leaving the heap fallback in
+        // place) if a segment is already configured or mmap fails.
+        // huge_pages requests MAP_HUGETLB and falls back to regular
+        // pages; numa_node >= 0 binds the segment to that node.
+        static bool configure(size_t bytes, bool huge_pages, int numa_node);
+
+        // Null until configure() succeeds
+        static nixlMemArena* instance();
+
+        void* alloc(size_t bytes);
+        void free(void* ptr, size_t bytes);
+        bool owns(const void* ptr) const {
+            const char* p = static_cast<const char*>(ptr);
+            return (p >= base) && (p < base + size);
+        }
+
+    private:
+        nixlMemArena(char* base, size_t size);
+        ~nixlMemArena() = default; // segment lives for the process lifetime
+
+        struct nixlFreeRange {
+            char*  addr;
+            size_t len;
+        };
+
+        std::mutex                 lock;
+        std::vector<nixlFreeRange> freeRanges; // sorted by addr, coalesced
+        char*                      base;
+        size_t                     size;
+};
+
+// Minimal std-allocator over the arena; heap fallback keeps containers
+// working before configure() and after exhaustion
+template<typename T>
+struct nixlArenaAllocator {
+    using value_type = T;
+
+    nixlArenaAllocator() = default;
+    template<typename U>
+    nixlArenaAllocator(const nixlArenaAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        nixlMemArena* arena = nixlMemArena::instance();
+        if (arena) {
+            void* ptr = arena->alloc(n * sizeof(T));
+            if (ptr)
+                return static_cast<T*>(ptr);
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        nixlMemArena* arena = nixlMemArena::instance();
+        if (arena && arena->owns(ptr)) {
+            arena->free(ptr, n * sizeof(T));
+            return;
+        }
+        ::operator delete(ptr);
+    }
+};
+
+template<typename T, typename U>
+bool operator==(const nixlArenaAllocator<T>&, const nixlArenaAllocator<U>&) noexcept {
+    return true;
+}
+template<typename T, typename U>
+bool operator!=(const nixlArenaAllocator<T>&, const nixlArenaAllocator<U>&) noexcept {
+    return false;
+}
+
+#endif
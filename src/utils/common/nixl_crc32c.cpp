@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nixl_crc32c.h"
+
+#ifdef __SSE4_2__
+#include <nmmintrin.h>
+
+uint32_t nixlCrc32c(const void* buf, size_t len, uint32_t crc) {
+    const uint8_t* p = static_cast<const uint8_t*>(buf);
+    crc = ~crc;
+    while ((len > 0) && (reinterpret_cast<uintptr_t>(p) & 7)) {
+        crc = _mm_crc32_u8(crc, *p++);
+        len--;
+    }
+    while (len >= 8) {
+        crc = static_cast<uint32_t>(
+            _mm_crc32_u64(crc, *reinterpret_cast<const uint64_t*>(p)));
+        p += 8;
+        len -= 8;
+    }
+    while (len-- > 0)
+        crc = _mm_crc32_u8(crc, *p++);
+    return ~crc;
+}
+
+#else // software fallback
+
+namespace {
+    struct nixlCrc32cTable {
+        uint32_t entries[256];
+        nixlCrc32cTable() {
+            for (uint32_t i = 0; i < 256; i++) {
+                uint32_t val = i;
+                for (int bit = 0; bit < 8; bit++)
+                    val = (val & 1) ? (val >> 1) ^ 0x82f63b78u : (val >> 1);
+                entries[i] = val;
+            }
+        }
+    };
+    const nixlCrc32cTable crcTable;
+} // namespace
+
+uint32_t nixlCrc32c(const void* buf, size_t len, uint32_t crc) {
+    const uint8_t* p = static_cast<const uint8_t*>(buf);
+    crc = ~crc;
+    while (len-- > 0)
+        crc = crcTable.entries[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+    return ~crc;
+}
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nixl_gpu_addr_cache.h"
+
+#include <mutex>
+
+nixlGpuAddrCache &
+nixlGpuAddrCache::instance() {
+    // Lives in the common shared library, so all plugins of the process
+    // share one cache
+    static nixlGpuAddrCache cache;
+    return cache;
+}
+
+bool
+nixlGpuAddrCache::lookup(const void *addr, nixlGpuAddrAttrs &attrs) const {
+    const uintptr_t a = (uintptr_t)addr;
+    std::shared_lock<std::shared_mutex> guard(lock);
+
+    auto it = ranges.upper_bound(a);
+    if (it == ranges.begin())
+        return false;
+    --it;
+    if (a >= it->second.base + it->second.size)
+        return false;
+
+    attrs = it->second.attrs;
+    return true;
+}
+
+void
+nixlGpuAddrCache::insert(const void *base, size_t size, const nixlGpuAddrAttrs &attrs) {
+    if (size == 0)
+        return;
+    const uintptr_t b = (uintptr_t)base;
+    std::unique_lock<std::shared_mutex> guard(lock);
+
+    // Drop any stale entries overlapping the new range, so an address
+    // reused by a fresh allocation can't resolve to old attributes
+    auto it = ranges.upper_bound(b);
+    if (it != ranges.begin()) {
+        --it;
+        if (b >= it->second.base + it->second.size)
+            ++it;
+    }
+    while (it != ranges.end() && (it->second.base < b + size))
+        it = ranges.erase(it);
+
+    ranges[b] = {b, size, attrs};
+}
+
+void
+nixlGpuAddrCache::invalidate(const void *addr) {
+    const uintptr_t a = (uintptr_t)addr;
+    std::unique_lock<std::shared_mutex> guard(lock);
+
+    auto it = ranges.upper_bound(a);
+    if (it == ranges.begin())
+        return;
+    --it;
+    if (a < it->second.base + it->second.size)
+        ranges.erase(it);
+}
+
+void
+nixlGpuAddrCache::clear() {
+    std::unique_lock<std::shared_mutex> guard(lock);
+    ranges.clear();
+}
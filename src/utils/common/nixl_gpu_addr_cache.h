@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_GPU_ADDR_CACHE_H
+#define _NIXL_GPU_ADDR_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <shared_mutex>
+
+// Attributes of a GPU allocation as reported by the driver. Driver handle
+// types are kept opaque (ordinal/void*) so this header stays CUDA-agnostic
+// and usable from every plugin.
+struct nixlGpuAddrAttrs {
+    bool  isDev = false;    // device (VRAM) memory, as opposed to host
+    int   dev   = -1;       // device ordinal
+    void *ctx   = nullptr;  // owning driver context
+};
+
+// Process-wide cache of VA-range -> GPU allocation attributes. Pointer
+// attribute queries (cuPointerGetAttributes and friends) are expensive and
+// every backend needs them per registered descriptor; caching per
+// allocation range turns a 10k-descriptor registration into one driver
+// query per distinct allocation. Backends consult lookup() first and
+// insert() the full allocation range ([range base, range size) from the
+// driver, not the queried descriptor) on a miss.
+class nixlGpuAddrCache {
+public:
+    static nixlGpuAddrCache &instance();
+
+    // Returns true and fills attrs if addr falls inside a cached range
+    bool lookup(const void *addr, nixlGpuAddrAttrs &attrs) const;
+
+    // Caches [base, base + size); an overlapping earlier entry (e.g. a
+    // freed and re-split allocation) is replaced
+    void insert(const void *base, size_t size, const nixlGpuAddrAttrs &attrs);
+
+    // Drops the range containing addr, if any; for use on deregistration
+    // of memory the caller knows was freed
+    void invalidate(const void *addr);
+
+    void clear();
+
+private:
+    nixlGpuAddrCache() = default;
+
+    struct rangeEntry {
+        uintptr_t        base;
+        size_t           size;
+        nixlGpuAddrAttrs attrs;
+    };
+
+    // Keyed by range base; lookups are read-mostly so a shared mutex keeps
+    // concurrent registrations from serializing on cache hits
+    std::map<uintptr_t, rangeEntry> ranges;
+    mutable std::shared_mutex       lock;
+};
+
+#endif
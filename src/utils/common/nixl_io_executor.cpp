@@ -0,0 +1,211 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nixl_io_executor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+#include "nixl_log.h"
+
+nixlIoExecutor &
+nixlIoExecutor::getShared() {
+    static nixlIoExecutor shared([]() -> size_t {
+        const char *env = getenv("NIXL_IO_EXECUTOR_THREADS");
+        if (env) {
+            int threads = atoi(env);
+            if (threads > 0)
+                return threads;
+            NIXL_WARN << "Ignoring invalid NIXL_IO_EXECUTOR_THREADS value '" << env << "'";
+        }
+        return std::max(2u, std::thread::hardware_concurrency() / 2);
+    }());
+    return shared;
+}
+
+nixlIoExecutor::nixlIoExecutor(size_t num_threads) {
+    if (num_threads == 0)
+        num_threads = 1;
+
+    workers.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; i++)
+        workers.push_back(std::make_unique<nixlIoWorker>());
+
+    threads.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; i++)
+        threads.emplace_back(&nixlIoExecutor::workerLoop, this, i);
+
+    NIXL_DEBUG << "IO executor started with " << num_threads << " threads";
+}
+
+nixlIoExecutor::~nixlIoExecutor() {
+    stopFlag = true;
+    for (auto &worker : workers)
+        worker->cv.notify_all();
+    for (auto &thread : threads)
+        thread.join();
+}
+
+uint64_t
+nixlIoExecutor::registerClient(prio_t prio, size_t max_inflight) {
+    std::lock_guard<std::mutex> guard(clientsLock);
+    const uint64_t id = nextClientId++;
+    clients[id] = {prio, max_inflight};
+    return id;
+}
+
+void
+nixlIoExecutor::unregisterClient(uint64_t client) {
+    waitIdle(client);
+    std::lock_guard<std::mutex> guard(clientsLock);
+    clients.erase(client);
+}
+
+void
+nixlIoExecutor::submit(uint64_t client, task_t task) {
+    prio_t prio;
+    {
+        std::lock_guard<std::mutex> guard(clientsLock);
+        auto it = clients.find(client);
+        if (it == clients.end()) {
+            NIXL_ERROR << "IO executor submit for unknown client " << client;
+            return;
+        }
+        nixlIoClient &state = it->second;
+        if ((state.maxInflight > 0) && (state.inflight >= state.maxInflight)) {
+            // Over the cap: held back until one of its tasks completes
+            state.heldBack.push_back(std::move(task));
+            return;
+        }
+        state.inflight++;
+        prio = state.prio;
+    }
+    enqueue(client, prio, std::move(task));
+}
+
+void
+nixlIoExecutor::waitIdle(uint64_t client) {
+    std::unique_lock<std::mutex> guard(clientsLock);
+    idleCv.wait(guard, [this, client]() {
+        auto it = clients.find(client);
+        return (it == clients.end()) ||
+               ((it->second.inflight == 0) && it->second.heldBack.empty());
+    });
+}
+
+void
+nixlIoExecutor::enqueue(uint64_t client, prio_t prio, task_t task) {
+    const size_t target = nextWorker++ % workers.size();
+    nixlIoWorker &worker = *workers[target];
+    {
+        std::lock_guard<std::mutex> guard(worker.lock);
+        worker.tasks[size_t(prio)].push_back({client, std::move(task)});
+        worker.queued++;
+    }
+    worker.cv.notify_one();
+}
+
+// Releases one held-back task of the client, if any, and wakes waiters
+void
+nixlIoExecutor::onTaskDone(uint64_t client) {
+    task_t next;
+    prio_t prio = prio_t::NORMAL;
+    {
+        std::lock_guard<std::mutex> guard(clientsLock);
+        auto it = clients.find(client);
+        if (it != clients.end()) {
+            nixlIoClient &state = it->second;
+            if (!state.heldBack.empty()) {
+                next = std::move(state.heldBack.front());
+                state.heldBack.pop_front();
+                prio = state.prio;
+                // inflight stays: the released task takes this slot
+            } else {
+                state.inflight--;
+            }
+        }
+    }
+    idleCv.notify_all();
+    if (next)
+        enqueue(client, prio, std::move(next));
+}
+
+bool
+nixlIoExecutor::popLocal(size_t self, nixlQueuedTask &out) {
+    nixlIoWorker &worker = *workers[self];
+    std::lock_guard<std::mutex> guard(worker.lock);
+    for (auto &queue : worker.tasks) {
+        if (!queue.empty()) {
+            out = std::move(queue.front());
+            queue.pop_front();
+            worker.queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Takes the highest-priority task from the most loaded peer.
+// try_lock keeps stealing from peers that are busy dispatching.
+bool
+nixlIoExecutor::stealTask(size_t self, nixlQueuedTask &out) {
+    size_t victim = self;
+    size_t victim_size = 0;
+    for (size_t i = 0; i < workers.size(); i++) {
+        if (i == self)
+            continue;
+        if (workers[i]->queued > victim_size) {
+            victim = i;
+            victim_size = workers[i]->queued;
+        }
+    }
+    if (victim == self)
+        return false;
+
+    nixlIoWorker &worker = *workers[victim];
+    std::unique_lock<std::mutex> guard(worker.lock, std::try_to_lock);
+    if (!guard.owns_lock())
+        return false;
+    for (auto &queue : worker.tasks) {
+        if (!queue.empty()) {
+            out = std::move(queue.back());
+            queue.pop_back();
+            worker.queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+nixlIoExecutor::workerLoop(size_t self) {
+    nixlIoWorker &worker = *workers[self];
+
+    while (!stopFlag) {
+        nixlQueuedTask task;
+        if (popLocal(self, task) || stealTask(self, task)) {
+            task.fn();
+            onTaskDone(task.client);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> guard(worker.lock);
+        worker.cv.wait_for(guard, std::chrono::milliseconds(10), [this, &worker]() {
+            return stopFlag.load() || (worker.queued > 0);
+        });
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_IO_EXECUTOR_H
+#define _NIXL_IO_EXECUTOR_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Shared IO task executor: one pool of threads that storage backends
+ * submit blocking IO work into, instead of each backend spinning its own
+ * pool. Tasks are spread across per-thread queues and an idle thread
+ * steals from the most loaded peer, so the pool balances itself.
+ *
+ * Backends register as clients with a scheduling priority and an
+ * in-flight task cap. Within a queue higher-priority tasks always run
+ * first (checkpoint IO submitted LOW yields to KV-fetch IO submitted
+ * HIGH), and a client over its cap has further submissions held back
+ * and released one-for-one as its tasks complete, bounding how much of
+ * the pool any one backend can occupy.
+ */
+class nixlIoExecutor {
+    public:
+        using task_t = std::function<void()>;
+
+        enum class prio_t { HIGH = 0, NORMAL = 1, LOW = 2 };
+        static constexpr size_t numPrios = 3;
+
+        // Process-wide instance shared by every backend in the process,
+        // sized once from NIXL_IO_EXECUTOR_THREADS (default: half the
+        // hardware threads, at least 2)
+        static nixlIoExecutor &getShared();
+
+        nixlIoExecutor(size_t num_threads);
+        ~nixlIoExecutor();
+
+        nixlIoExecutor(const nixlIoExecutor&) = delete;
+        nixlIoExecutor& operator=(const nixlIoExecutor&) = delete;
+
+        // Registers a client and returns its id; max_inflight bounds the
+        // client's concurrently queued/running tasks (0 means unbounded)
+        uint64_t registerClient(prio_t prio, size_t max_inflight);
+        // Waits out the client's tasks, then forgets it
+        void unregisterClient(uint64_t client);
+
+        void submit(uint64_t client, task_t task);
+        // Blocks until the client has no queued, held-back or running tasks
+        void waitIdle(uint64_t client);
+
+        size_t numThreads() const { return threads.size(); }
+
+    private:
+        struct nixlQueuedTask {
+            uint64_t client;
+            task_t fn;
+        };
+
+        // Per-thread state; the lock covers the priority queues
+        struct nixlIoWorker {
+            std::mutex lock;
+            std::condition_variable cv;
+            std::array<std::deque<nixlQueuedTask>, numPrios> tasks;
+            size_t queued = 0;
+        };
+
+        struct nixlIoClient {
+            prio_t prio;
+            size_t maxInflight;
+            size_t inflight = 0;
+            std::deque<task_t> heldBack;
+        };
+
+        void workerLoop(size_t self);
+        bool popLocal(size_t self, nixlQueuedTask &out);
+        bool stealTask(size_t self, nixlQueuedTask &out);
+        void enqueue(uint64_t client, prio_t prio, task_t task);
+        void onTaskDone(uint64_t client);
+
+        std::vector<std::unique_ptr<nixlIoWorker>> workers;
+        std::vector<std::thread> threads;
+        std::atomic<bool> stopFlag{false};
+        std::atomic<size_t> nextWorker{0};
+
+        std::mutex clientsLock;
+        std::condition_variable idleCv;
+        std::unordered_map<uint64_t, nixlIoClient> clients;
+        uint64_t nextClientId = 1;
+};
+
+#endif
@@ -0,0 +1,203 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nixl_lz.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+constexpr size_t hashBits = 13;
+constexpr size_t maxOffset = 0xFFFF;
+// Format rules: the last 5 bytes are always literals and no match may
+// extend into the last 5, nor start within the last 12
+constexpr size_t lastLiterals = 5;
+constexpr size_t matchMargin = 12;
+constexpr size_t minMatch = 4;
+
+inline uint32_t
+read32(const uint8_t *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t
+hash4(uint32_t v) {
+    return (v * 2654435761u) >> (32 - hashBits);
+}
+
+// Emits one sequence (literals followed by an optional match); returns
+// false when it would overrun the output buffer
+bool
+emitSequence(uint8_t *&op,
+             const uint8_t *oend,
+             const uint8_t *literals,
+             size_t lit_len,
+             size_t offset,
+             size_t match_len) {
+    // Upper bound on this sequence: token, length extensions, literals, offset
+    if (size_t(oend - op) < 1 + lit_len / 255 + lit_len + 2 + match_len / 255 + 2)
+        return false;
+
+    uint8_t *token = op++;
+    if (lit_len >= 15) {
+        *token = 0xF0;
+        size_t rem = lit_len - 15;
+        for (; rem >= 255; rem -= 255)
+            *op++ = 255;
+        *op++ = uint8_t(rem);
+    } else {
+        *token = uint8_t(lit_len << 4);
+    }
+    memcpy(op, literals, lit_len);
+    op += lit_len;
+
+    if (match_len == 0) // final literal run
+        return true;
+
+    *op++ = uint8_t(offset & 0xFF);
+    *op++ = uint8_t(offset >> 8);
+    size_t mrem = match_len - minMatch;
+    if (mrem >= 15) {
+        *token |= 15;
+        mrem -= 15;
+        for (; mrem >= 255; mrem -= 255)
+            *op++ = 255;
+        *op++ = uint8_t(mrem);
+    } else {
+        *token |= uint8_t(mrem);
+    }
+    return true;
+}
+
+} // namespace
+
+size_t
+nixlLzCompressBound(size_t src_len) {
+    return src_len + src_len / 255 + 16;
+}
+
+size_t
+nixlLzCompress(const void *src, size_t src_len, void *dst, size_t dst_cap) {
+    if (src_len == 0 || dst_cap == 0)
+        return 0;
+
+    const uint8_t *base = static_cast<const uint8_t *>(src);
+    const uint8_t *ip = base;
+    const uint8_t *iend = base + src_len;
+    const uint8_t *anchor = base;
+    uint8_t *out = static_cast<uint8_t *>(dst);
+    uint8_t *op = out;
+    uint8_t *oend = out + dst_cap;
+
+    if (src_len > matchMargin) {
+        // Positions are stored +1 so 0 means an empty slot
+        std::vector<uint32_t> table(size_t(1) << hashBits, 0);
+        const uint8_t *mflimit = iend - matchMargin;
+        const uint8_t *matchlimit = iend - lastLiterals;
+
+        while (ip < mflimit) {
+            uint32_t h = hash4(read32(ip));
+            const uint8_t *ref = base + table[h] - 1;
+            bool candidate = table[h] != 0;
+            table[h] = uint32_t(ip - base) + 1;
+
+            if (!candidate || size_t(ip - ref) > maxOffset || read32(ref) != read32(ip)) {
+                ++ip;
+                continue;
+            }
+
+            const uint8_t *mstart = ip;
+            const uint8_t *r = ref + minMatch;
+            ip += minMatch;
+            while (ip < matchlimit && *ip == *r) {
+                ++ip;
+                ++r;
+            }
+
+            if (!emitSequence(op, oend, anchor, size_t(mstart - anchor),
+                              size_t(mstart - ref), size_t(ip - mstart)))
+                return 0;
+            anchor = ip;
+        }
+    }
+
+    if (!emitSequence(op, oend, anchor, size_t(iend - anchor), 0, 0))
+        return 0;
+    return size_t(op - out);
+}
+
+size_t
+nixlLzDecompress(const void *src, size_t src_len, void *dst, size_t dst_cap) {
+    const uint8_t *ip = static_cast<const uint8_t *>(src);
+    const uint8_t *iend = ip + src_len;
+    uint8_t *out = static_cast<uint8_t *>(dst);
+    uint8_t *op = out;
+    uint8_t *oend = out + dst_cap;
+
+    while (ip < iend) {
+        const uint8_t token = *ip++;
+
+        size_t lit_len = token >> 4;
+        if (lit_len == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend)
+                    return 0;
+                b = *ip++;
+                lit_len += b;
+            } while (b == 255);
+        }
+        if (size_t(iend - ip) < lit_len || size_t(oend - op) < lit_len)
+            return 0;
+        memcpy(op, ip, lit_len);
+        op += lit_len;
+        ip += lit_len;
+
+        if (ip >= iend) // final literal run
+            break;
+
+        if (size_t(iend - ip) < 2)
+            return 0;
+        const size_t offset = size_t(ip[0]) | (size_t(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > size_t(op - out))
+            return 0;
+
+        size_t match_len = (token & 15) + minMatch;
+        if ((token & 15) == 15) {
+            uint8_t b;
+            do {
+                if (ip >= iend)
+                    return 0;
+                b = *ip++;
+                match_len += b;
+            } while (b == 255);
+        }
+        if (size_t(oend - op) < match_len)
+            return 0;
+
+        // Byte-wise copy: matches may overlap their own output
+        const uint8_t *match = op - offset;
+        for (size_t i = 0; i < match_len; ++i)
+            op[i] = match[i];
+        op += match_len;
+    }
+    return size_t(op - out);
+}
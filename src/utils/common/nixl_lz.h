@@ -0,0 +1,39 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __NIXL_LZ_H_
+#define __NIXL_LZ_H_
+
+#include <cstddef>
+
+// Dependency-free LZ77 codec producing LZ4 block format, used as the
+// transform stage of compressed storage offload paths. Greedy hash-chain
+// matching tuned for throughput over ratio, which is the right trade for
+// bandwidth-bound spill tiers. Blocks written by nixlLzCompress can also
+// be decoded by any stock LZ4 block decoder.
+
+// Worst-case compressed size for src_len input bytes
+size_t nixlLzCompressBound(size_t src_len);
+
+// Compresses src_len bytes into dst. Returns the compressed length, or 0
+// if the output does not fit in dst_cap (callers then store the raw form)
+size_t nixlLzCompress(const void *src, size_t src_len, void *dst, size_t dst_cap);
+
+// Decompresses src_len compressed bytes into dst. Returns the decompressed
+// length, or 0 on corrupt input or when the output exceeds dst_cap
+size_t nixlLzDecompress(const void *src, size_t src_len, void *dst, size_t dst_cap);
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_PROBES_H
+#define _NIXL_PROBES_H
+
+/*
+ * USDT static tracepoints on the transfer hot path, under the "nixl"
+ * provider. Built in with -Dusdt (define NIXL_ENABLE_USDT, needs
+ * sys/sdt.h from systemtap-sdt-dev); an uninstrumented probe is a single
+ * nop, and when the option is off the macros compile to nothing, so
+ * production builds pay nothing unless a tracer (perf, bpftrace,
+ * perfetto) attaches.
+ */
+#ifdef NIXL_ENABLE_USDT
+
+#include <sys/sdt.h>
+
+#define NIXL_PROBE(name) DTRACE_PROBE(nixl, name)
+#define NIXL_PROBE1(name, a1) DTRACE_PROBE1(nixl, name, a1)
+#define NIXL_PROBE2(name, a1, a2) DTRACE_PROBE2(nixl, name, a1, a2)
+#define NIXL_PROBE3(name, a1, a2, a3) DTRACE_PROBE3(nixl, name, a1, a2, a3)
+
+#else
+
+#define NIXL_PROBE(name) \
+    do {                 \
+    } while (0)
+#define NIXL_PROBE1(name, a1) \
+    do {                      \
+    } while (0)
+#define NIXL_PROBE2(name, a1, a2) \
+    do {                          \
+    } while (0)
+#define NIXL_PROBE3(name, a1, a2, a3) \
+    do {                              \
+    } while (0)
+
+#endif // NIXL_ENABLE_USDT
+
+#endif // _NIXL_PROBES_H
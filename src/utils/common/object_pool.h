@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_OBJECT_POOL_H
+#define _NIXL_OBJECT_POOL_H
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/**
+ * @class nixlObjectPool
+ * @brief Fixed-size-block arena with a freelist, for objects that are
+ *        allocated and released per operation on the datapath, such as
+ *        transfer request handles. Blocks are carved out of slabs, reuse is
+ *        LIFO (cache friendly), and memory is only returned to the system
+ *        on destruction.
+ */
+template<typename T, size_t blocks_per_slab = 256>
+class nixlObjectPool {
+    static constexpr size_t alignment = alignof(std::max_align_t);
+    static constexpr size_t blockSize =
+        ((sizeof(T) + alignment - 1) / alignment) * alignment;
+
+public:
+    nixlObjectPool() = default;
+
+    ~nixlObjectPool() {
+        for (auto &slab : slabs)
+            ::operator delete(slab);
+    }
+
+    nixlObjectPool(const nixlObjectPool &) = delete;
+    nixlObjectPool &operator=(const nixlObjectPool &) = delete;
+
+    void *allocate() {
+        std::lock_guard<std::mutex> lock(poolLock);
+        if (freeList.empty())
+            growSlab();
+        void *block = freeList.back();
+        freeList.pop_back();
+        return block;
+    }
+
+    void release(void *block) noexcept {
+        if (!block)
+            return;
+        std::lock_guard<std::mutex> lock(poolLock);
+        freeList.push_back(block);
+    }
+
+private:
+    void growSlab() {
+        char *slab = static_cast<char *>(::operator new(blockSize * blocks_per_slab));
+        slabs.push_back(slab);
+        freeList.reserve(freeList.size() + blocks_per_slab);
+        for (size_t i = 0; i < blocks_per_slab; ++i)
+            freeList.push_back(slab + i * blockSize);
+    }
+
+    std::mutex          poolLock;
+    std::vector<char *> slabs;
+    std::vector<void *> freeList;
+};
+
+/**
+ * @class nixlPooledObject
+ * @brief Mixin giving a class pooled operator new/delete backed by a static
+ *        per-type nixlObjectPool. Subclasses of T fall back to the regular
+ *        heap (their size differs), relying on sized deallocation and a
+ *        virtual destructor to route the matching delete. Usage:
+ *        class myReqH : public nixlBackendReqH, public nixlPooledObject<myReqH>
+ */
+template<typename T, size_t blocks_per_slab = 256>
+class nixlPooledObject {
+public:
+    static void *operator new(std::size_t size) {
+        if (size != sizeof(T))
+            return ::operator new(size);
+        return pool().allocate();
+    }
+
+    static void operator delete(void *ptr, std::size_t size) noexcept {
+        if (size != sizeof(T)) {
+            ::operator delete(ptr);
+            return;
+        }
+        pool().release(ptr);
+    }
+
+private:
+    static nixlObjectPool<T, blocks_per_slab> &pool() {
+        static nixlObjectPool<T, blocks_per_slab> instance;
+        return instance;
+    }
+};
+
+#endif
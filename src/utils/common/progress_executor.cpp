@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "progress_executor.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "nixl_affinity.h"
+#include "nixl_log.h"
+
+nixlProgressExecutor::nixlProgressExecutor(size_t num_threads,
+                                           uint64_t max_sleep_us,
+                                           const std::string &cpuset)
+    : maxSleepUs(max_sleep_us ? max_sleep_us : 1),
+      cpuset(cpuset) {
+    if (num_threads == 0)
+        num_threads = 1;
+
+    workers.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; i++)
+        workers.push_back(std::make_unique<nixlExecWorker>());
+
+    threads.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; i++)
+        threads.emplace_back(&nixlProgressExecutor::workerLoop, this, i);
+
+    NIXL_DEBUG << "Progress executor started with " << num_threads << " threads";
+}
+
+nixlProgressExecutor::~nixlProgressExecutor() {
+    stopFlag = true;
+    for (auto &thread : threads)
+        thread.join();
+}
+
+uint64_t
+nixlProgressExecutor::addPoller(poller_t poller) {
+    const uint64_t id = nextPollerId++;
+
+    // Assign to the currently least loaded thread
+    size_t target = 0;
+    size_t target_size = SIZE_MAX;
+    for (size_t i = 0; i < workers.size(); i++) {
+        std::lock_guard<std::mutex> guard(workers[i]->lock);
+        if (workers[i]->pollers.size() < target_size) {
+            target = i;
+            target_size = workers[i]->pollers.size();
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(workers[target]->lock);
+    workers[target]->pollers.push_back({id, std::move(poller)});
+    return id;
+}
+
+void
+nixlProgressExecutor::removePoller(uint64_t id) {
+    // Worker locks are held while pollers run, so once the entry is erased
+    // under the lock the poller can no longer be executing
+    for (auto &worker : workers) {
+        std::lock_guard<std::mutex> guard(worker->lock);
+        auto &queue = worker->pollers;
+        auto it = std::find_if(queue.begin(), queue.end(),
+                               [id](const nixlPollerSlot &slot) { return slot.id == id; });
+        if (it != queue.end()) {
+            queue.erase(it);
+            return;
+        }
+    }
+}
+
+// Moves one poller from the most loaded peer into this thread's queue.
+// try_lock keeps stealing from blocking peers that are mid-progress.
+bool
+nixlProgressExecutor::stealInto(size_t self) {
+    size_t victim = self;
+    size_t victim_size = 1; // only steal from peers with more than one poller
+    for (size_t i = 0; i < workers.size(); i++) {
+        if (i == self)
+            continue;
+        std::unique_lock<std::mutex> guard(workers[i]->lock, std::try_to_lock);
+        if (guard.owns_lock() && (workers[i]->pollers.size() > victim_size)) {
+            victim = i;
+            victim_size = workers[i]->pollers.size();
+        }
+    }
+    if (victim == self)
+        return false;
+
+    std::unique_lock<std::mutex> victim_guard(workers[victim]->lock, std::try_to_lock);
+    if (!victim_guard.owns_lock() || (workers[victim]->pollers.size() <= 1))
+        return false;
+
+    nixlPollerSlot slot = std::move(workers[victim]->pollers.back());
+    workers[victim]->pollers.pop_back();
+    victim_guard.unlock();
+
+    std::lock_guard<std::mutex> guard(workers[self]->lock);
+    workers[self]->pollers.push_back(std::move(slot));
+    return true;
+}
+
+void
+nixlProgressExecutor::workerLoop(size_t self) {
+    nixlAffinity::applyToSelf(cpuset);
+
+    nixlExecWorker &worker = *workers[self];
+    uint64_t sleep_us = 1;
+
+    while (!stopFlag) {
+        bool progressed = false;
+        bool idle;
+        {
+            std::lock_guard<std::mutex> guard(worker.lock);
+            for (auto &slot : worker.pollers)
+                if (slot.fn())
+                    progressed = true;
+            idle = worker.pollers.empty();
+        }
+
+        if (idle && stealInto(self))
+            continue;
+
+        if (progressed) {
+            sleep_us = 1;
+            std::this_thread::yield();
+        } else {
+            // Exponential backoff while the pollers are quiet
+            std::this_thread::sleep_for(std::chrono::microseconds(sleep_us));
+            sleep_us = std::min(sleep_us * 2, maxSleepUs);
+        }
+    }
+}
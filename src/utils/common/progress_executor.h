@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_PROGRESS_EXECUTOR_H
+#define _NIXL_PROGRESS_EXECUTOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Shared progress executor: a small, fixed-size pool of threads that backends
+ * register pollers into, instead of each backend spawning its own progress
+ * threads. A poller is a callable returning true when it made progress.
+ *
+ * Each poller is owned by exactly one executor thread at a time; an idle
+ * thread steals pollers from the most loaded peer, so the pool balances
+ * itself without ever running the same poller concurrently. Threads back off
+ * exponentially (up to the configured cap) while their pollers report no
+ * progress, keeping the idle CPU cost near zero.
+ *
+ * removePoller() returns only once the poller is guaranteed not to be
+ * running, so callers may destroy the polled state right after it returns.
+ */
+class nixlProgressExecutor {
+    public:
+        using poller_t = std::function<bool()>;
+
+        // cpuset, when non-empty, pins every executor thread at startup
+        // (comma separated core list with ranges, e.g. "2,4-7")
+        nixlProgressExecutor(size_t num_threads,
+                             uint64_t max_sleep_us,
+                             const std::string &cpuset = "");
+        ~nixlProgressExecutor();
+
+        nixlProgressExecutor(const nixlProgressExecutor&) = delete;
+        nixlProgressExecutor& operator=(const nixlProgressExecutor&) = delete;
+
+        // Registers a poller and returns its id for later removal
+        uint64_t addPoller(poller_t poller);
+        void removePoller(uint64_t id);
+
+    private:
+        struct nixlPollerSlot {
+            uint64_t id;
+            poller_t fn;
+        };
+
+        // Per-thread state; the lock covers the poller queue and is held
+        // while the queue's pollers run
+        struct nixlExecWorker {
+            std::mutex lock;
+            std::deque<nixlPollerSlot> pollers;
+        };
+
+        void workerLoop(size_t self);
+        bool stealInto(size_t self);
+
+        std::vector<std::unique_ptr<nixlExecWorker>> workers;
+        std::vector<std::thread> threads;
+        std::atomic<bool> stopFlag{false};
+        std::atomic<uint64_t> nextPollerId{1};
+        uint64_t maxSleepUs;
+        std::string cpuset;
+};
+
+#endif
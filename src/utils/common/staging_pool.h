@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_STAGING_POOL_H
+#define _NIXL_STAGING_POOL_H
+
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Agent-level pinned staging pool: one page-aligned slab allocated,
+// pre-faulted and mlock'ed up front, then carved into blocks by a
+// first-fit allocator. Internal staging consumers (backend bounce
+// buffers, unaligned-IO staging, the agent's own staging paths) draw
+// from it instead of allocating pinned memory at first use, moving the
+// page-fault and pinning stalls to startup. The agent registers the
+// whole slab with each backend at createBackend time, so blocks handed
+// out are already covered by a registration.
+class nixlStagingPool {
+public:
+    nixlStagingPool() = default;
+
+    ~nixlStagingPool() {
+        destroy();
+    }
+
+    nixlStagingPool(const nixlStagingPool &) = delete;
+    nixlStagingPool &
+    operator=(const nixlStagingPool &) = delete;
+
+    // Allocates, pre-faults and best-effort-locks the slab; on failure
+    // the pool stays disabled. An mlock failure is not fatal: the memory
+    // is already faulted in, and backend registration pins it where the
+    // transport requires pinning.
+    bool
+    init(size_t bytes) {
+        if (base_ || (bytes == 0)) {
+            return false;
+        }
+        const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_ = (bytes + page - 1) & ~(page - 1);
+        if (posix_memalign(&base_, page, size_) != 0) {
+            base_ = nullptr;
+            size_ = 0;
+            return false;
+        }
+        std::memset(base_, 0, size_);
+        locked_ = (mlock(base_, size_) == 0);
+        blocks_.push_back({0, size_, true});
+        return true;
+    }
+
+    void
+    destroy() {
+        if (!base_) {
+            return;
+        }
+        if (locked_) {
+            munlock(base_, size_);
+        }
+        std::free(base_);
+        base_ = nullptr;
+        size_ = 0;
+        blocks_.clear();
+    }
+
+    [[nodiscard]] bool
+    active() const {
+        return base_ != nullptr;
+    }
+
+    [[nodiscard]] void *
+    base() const {
+        return base_;
+    }
+
+    [[nodiscard]] size_t
+    size() const {
+        return size_;
+    }
+
+    // First-fit block allocation; returns nullptr when no free block
+    // fits, so consumers fall back to their own allocation path
+    [[nodiscard]] void *
+    alloc(size_t bytes, size_t align = 64) {
+        if (!base_ || (bytes == 0)) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> guard(lock_);
+        for (size_t i = 0; i < blocks_.size(); i++) {
+            if (!blocks_[i].free_) {
+                continue;
+            }
+            const size_t aligned = (blocks_[i].off + align - 1) & ~(align - 1);
+            const size_t pad = aligned - blocks_[i].off;
+            if (pad + bytes > blocks_[i].len) {
+                continue;
+            }
+            // Split off the tail remainder, keep the alignment pad
+            // inside the allocated block so release() can coalesce it
+            const size_t remainder = blocks_[i].len - pad - bytes;
+            if (remainder > 0) {
+                blocks_.insert(blocks_.begin() + i + 1,
+                               {blocks_[i].off + pad + bytes, remainder, true});
+                blocks_[i].len = pad + bytes;
+            }
+            blocks_[i].free_ = false;
+            return static_cast<char *>(base_) + aligned;
+        }
+        return nullptr;
+    }
+
+    // Returns a block to the pool, coalescing with free neighbors.
+    // addr may point anywhere inside the block (alignment pad included).
+    void
+    release(void *addr) {
+        if (!base_ || !addr) {
+            return;
+        }
+        const size_t off = static_cast<size_t>(static_cast<char *>(addr) -
+                                               static_cast<char *>(base_));
+        std::lock_guard<std::mutex> guard(lock_);
+        for (size_t i = 0; i < blocks_.size(); i++) {
+            if (blocks_[i].free_ || (off < blocks_[i].off) ||
+                (off >= blocks_[i].off + blocks_[i].len)) {
+                continue;
+            }
+            blocks_[i].free_ = true;
+            if ((i + 1 < blocks_.size()) && blocks_[i + 1].free_) {
+                blocks_[i].len += blocks_[i + 1].len;
+                blocks_.erase(blocks_.begin() + i + 1);
+            }
+            if ((i > 0) && blocks_[i - 1].free_) {
+                blocks_[i - 1].len += blocks_[i].len;
+                blocks_.erase(blocks_.begin() + i);
+            }
+            return;
+        }
+    }
+
+private:
+    struct block {
+        size_t off;
+        size_t len;
+        bool free_;
+    };
+
+    void *base_ = nullptr;
+    size_t size_ = 0;
+    bool locked_ = false;
+    std::mutex lock_;
+    // Sorted by offset; neighbors are coalesced on release
+    std::vector<block> blocks_;
+};
+
+#endif // _NIXL_STAGING_POOL_H
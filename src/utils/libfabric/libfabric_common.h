@@ -35,6 +35,7 @@
 // Libfabric configuration constants
 #define NIXL_LIBFABRIC_DEFAULT_CONTROL_RAILS 1
 #define NIXL_LIBFABRIC_CQ_SREAD_TIMEOUT_MS 1000
+#define NIXL_LIBFABRIC_CQ_BATCH_SIZE 16 // Max completions reaped per fi_cq_read
 #define NIXL_LIBFABRIC_DEFAULT_STRIPING_THRESHOLD (128 * 1024) // 128KB
 #define LF_EP_NAME_MAX_LEN 56
 
@@ -43,6 +44,10 @@
 #define NIXL_LIBFABRIC_DATA_REQUESTS_PER_RAIL 1024 // WRITE/read operations (no buffers)
 #define NIXL_LIBFABRIC_SEND_RECV_BUFFER_SIZE 8192
 
+// Staged-copy pipeline for VRAM on providers without FI_HMEM
+#define NIXL_LIBFABRIC_STAGING_BUF_SIZE (4 * 1024 * 1024) // Pinned bounce buffer size
+#define NIXL_LIBFABRIC_STAGING_NUM_BUFS 2 // Double buffering for copy/write overlap
+
 // Retry configuration constants
 #define NIXL_LIBFABRIC_MAX_RETRIES 10
 #define NIXL_LIBFABRIC_EFA_RETRY_DELAY_US 100
@@ -104,6 +109,8 @@ struct BinaryNotification {
     uint32_t message_length; // Actual length of message data
     uint16_t xfer_id; // 16-bit postXfer ID (unique per postXfer call)
     uint32_t expected_completions; // Total write requests for this xfer_id
+    uint8_t trace_ctx[16]; // Optional trace context for distributed correlation
+    uint32_t trace_ctx_len; // Actual trace context length, 0 when untraced
 
     /** @brief Clear all fields to zero */
     void
@@ -140,6 +147,23 @@ struct BinaryNotification {
     getMessage() const {
         return std::string(message, message_length);
     }
+
+    /** @brief Set trace context with bounds checking, empty clears it */
+    void
+    setTraceCtx(const std::string &trace) {
+        trace_ctx_len = std::min(trace.length(), sizeof(trace_ctx));
+        memcpy(trace_ctx, trace.data(), trace_ctx_len);
+        if (trace_ctx_len < sizeof(trace_ctx)) {
+            memset(trace_ctx + trace_ctx_len, 0, sizeof(trace_ctx) - trace_ctx_len);
+        }
+    }
+
+    /** @brief Get trace context as string, empty when untraced */
+    std::string
+    getTraceCtx() const {
+        return std::string(reinterpret_cast<const char *>(trace_ctx),
+                           std::min(static_cast<size_t>(trace_ctx_len), sizeof(trace_ctx)));
+    }
 };
 
 // Global XFER_ID management
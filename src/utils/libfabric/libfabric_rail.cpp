@@ -18,12 +18,12 @@
 
 #include "libfabric_rail.h"
 #include "common/nixl_log.h"
+#include "common/nixl_probes.h"
 #include "serdes/serdes.h"
 #include "libfabric_common.h"
 
 #include <cstring>
 #include <stdexcept>
-#include <stack>
 
 // RequestPool Base Class Implementation
 
@@ -31,23 +31,84 @@ RequestPool::RequestPool(size_t pool_size, size_t rail_id)
     : rail_id_(rail_id),
       initial_pool_size_(pool_size) {
     initializeBasePool(pool_size);
+    // Construction is single-threaded; subclass init (buffer assignment etc.)
+    // happens before the pool sees any traffic
+    publishRequests(0);
 }
 
 void
 RequestPool::initializeBasePool(size_t pool_size) {
     size_t current_size = requests_.size();
+    // Deque growth keeps references to existing elements valid, so free-list
+    // pointers held by other threads stay usable across expansion. New
+    // requests are NOT pushed onto the free list here: subclasses finish
+    // initializing them (e.g. buffer assignment) and then publishRequests(),
+    // since lock-free allocation can pop them the moment they are visible.
     requests_.resize(current_size + pool_size);
 
     for (size_t i = current_size; i < requests_.size(); ++i) {
         requests_[i].rail_id = rail_id_;
         requests_[i].pool_index = i; // Set the pool index for deque compatibility
         requests_[i].in_use = false;
-        free_indices_.push(i);
     }
+    total_count_.store(requests_.size(), std::memory_order_release);
 
     NIXL_INFO << "InitializeBasePool - Rail " << rail_id_
-              << " completed. Total requests: " << requests_.size()
-              << " Free requests: " << free_indices_.size();
+              << " completed. Total requests: " << requests_.size();
+}
+
+RequestPool::~RequestPool() {
+    if (mem_budget_) {
+        mem_budget_->release(charged_bytes_);
+    }
+}
+
+void
+RequestPool::setMemBudget(nixlMemBudget *budget) {
+    mem_budget_ = budget;
+    // Record the footprint that exists already; only growth is enforced
+    budgetCharge(requests_.size() * sizeof(nixlLibfabricReq));
+}
+
+bool
+RequestPool::budgetReserve(size_t bytes) {
+    if (!mem_budget_) {
+        return true;
+    }
+    if (!mem_budget_->tryReserve(bytes)) {
+        return false;
+    }
+    charged_bytes_ += bytes;
+    return true;
+}
+
+void
+RequestPool::budgetCharge(size_t bytes) {
+    if (!mem_budget_) {
+        return;
+    }
+    mem_budget_->charge(bytes);
+    charged_bytes_ += bytes;
+}
+
+void
+RequestPool::publishRequests(size_t first_index) {
+    for (size_t i = first_index; i < requests_.size(); ++i) {
+        pushFree(&requests_[i]);
+    }
+}
+
+void
+RequestPool::pushFree(nixlLibfabricReq *req) const {
+    FreeListHead head = free_head_.load(std::memory_order_relaxed);
+    FreeListHead desired;
+    desired.ptr = req;
+    do {
+        req->free_next = head.ptr;
+        desired.tag = head.tag + 1;
+    } while (!free_head_.compare_exchange_weak(
+        head, desired, std::memory_order_release, std::memory_order_relaxed));
+    free_count_.fetch_add(1, std::memory_order_relaxed);
 }
 
 void
@@ -57,9 +118,7 @@ RequestPool::release(nixlLibfabricReq *req) const {
         return;
     }
 
-    std::lock_guard<std::mutex> lock(pool_mutex_);
-
-    // GUARD: Check if already released
+    // GUARD: Check if already released (best effort without the old lock)
     if (!req->in_use) {
         NIXL_WARN << "Attempt to double-release request XFER_ID=" << req->xfer_id << " on rail "
                   << rail_id_ << " - ignoring to prevent corruption";
@@ -76,23 +135,11 @@ RequestPool::release(nixlLibfabricReq *req) const {
     req->completion_callback = nullptr;
     memset(&req->ctx, 0, sizeof(fi_context));
 
-    // Use pool_index instead of pointer arithmetic for deque compatibility
-    size_t idx = req->pool_index;
-
-    // Validate the index is within bounds
-    if (idx >= requests_.size()) {
-        NIXL_ERROR << "Release Req on Rail " << rail_id_ << " invalid pool index " << idx
-                   << " for request release (pool size=" << requests_.size() << ")";
-        return;
-    }
-
-    free_indices_.push(idx);
+    pushFree(req);
 }
 
 nixlLibfabricReq *
 RequestPool::findByContext(void *context) const {
-    std::lock_guard<std::mutex> lock(pool_mutex_);
-
     if (!context) {
         return nullptr;
     }
@@ -107,24 +154,45 @@ RequestPool::findByContext(void *context) const {
 
 size_t
 RequestPool::getActiveRequestCount() const {
-    std::lock_guard<std::mutex> lock(pool_mutex_);
-    return requests_.size() - free_indices_.size();
+    return total_count_.load(std::memory_order_acquire) -
+        free_count_.load(std::memory_order_relaxed);
 }
 
 size_t
 RequestPool::getPoolUtilization() const {
-    std::lock_guard<std::mutex> lock(pool_mutex_);
-    return ((requests_.size() - free_indices_.size()) * 100) / requests_.size();
+    size_t total = total_count_.load(std::memory_order_acquire);
+    return ((total - free_count_.load(std::memory_order_relaxed)) * 100) / total;
 }
 
 nixlLibfabricReq *
 RequestPool::allocateReq() {
-    std::lock_guard<std::mutex> lock(pool_mutex_);
+    while (true) {
+        // Fast path: lock-free pop from the Treiber stack
+        FreeListHead head = free_head_.load(std::memory_order_acquire);
+        while (head.ptr) {
+            FreeListHead next;
+            next.ptr = head.ptr->free_next;
+            next.tag = head.tag + 1;
+            if (free_head_.compare_exchange_weak(
+                    head, next, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                nixlLibfabricReq *req = head.ptr;
+                free_count_.fetch_sub(1, std::memory_order_relaxed);
+                req->free_next = nullptr;
+                req->in_use = true;
+                req->xfer_id = LibfabricUtils::getNextXferId();
+                return req;
+            }
+        }
 
-    if (free_indices_.empty()) {
-        size_t old_size = requests_.size();
+        // Slow path: free list drained, expand under the lock
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+
+        // Another thread may have expanded (or released) while we waited
+        if (free_head_.load(std::memory_order_acquire).ptr) {
+            continue;
+        }
 
-        // Try to expand the pool using the derived class implementation
+        size_t old_size = requests_.size();
         nixl_status_t expand_status = expandPool();
         if (expand_status != NIXL_SUCCESS) {
             NIXL_ERROR << "AllocateReq on Rail " << rail_id_
@@ -132,8 +200,7 @@ RequestPool::allocateReq() {
             return nullptr;
         }
 
-        // Check if expansion provided new requests
-        if (free_indices_.empty()) {
+        if (requests_.size() == old_size) {
             NIXL_ERROR << "AllocateReq on Rail " << rail_id_
                        << " pool still exhausted after expansion";
             return nullptr;
@@ -141,16 +208,8 @@ RequestPool::allocateReq() {
 
         NIXL_INFO << "AllocateReq on Rail " << rail_id_ << " successfully expanded pool from "
                   << old_size << " to " << requests_.size() << " requests";
+        // Loop back: the expanded entries may be raced away, retry the pop
     }
-
-    size_t idx = free_indices_.top();
-    free_indices_.pop();
-
-    nixlLibfabricReq *req = &requests_[idx];
-    req->in_use = true;
-    req->xfer_id = LibfabricUtils::getNextXferId();
-
-    return req;
 }
 
 // ControlRequestPool Implementation
@@ -230,6 +289,7 @@ ControlRequestPool::initialize(struct fid_domain *domain) {
     }
 
     buffer_chunks_.push_back(initial_chunk);
+    budgetCharge(initial_chunk.size);
 
     // Pre-assign buffers to requests
     for (size_t i = 0; i < requests_.size(); ++i) {
@@ -255,6 +315,15 @@ ControlRequestPool::expandPool() {
     size_t current_size = requests_.size();
     size_t expansion_size = initial_pool_size_; // Add same amount as initial size
 
+    // Enforce the engine's internal-memory cap before allocating anything;
+    // a rejected expansion surfaces upstream as an allocation failure
+    if (!budgetReserve(chunk_size_ + expansion_size * sizeof(nixlLibfabricReq))) {
+        NIXL_WARN << "ExpandPool on Rail " << rail_id_
+                  << " rejected by internal memory cap (used=" << mem_budget_->used()
+                  << " cap=" << mem_budget_->cap() << ")";
+        return NIXL_ERR_BACKEND;
+    }
+
     // Create new buffer chunk for the expansion
     BufferChunk new_chunk;
     nixl_status_t status = createBufferChunk(chunk_size_, new_chunk);
@@ -266,7 +335,8 @@ ControlRequestPool::expandPool() {
 
     buffer_chunks_.push_back(new_chunk);
 
-    // Expand the base pool (adds new requests to requests_ vector and free_indices_)
+    // Expand the base pool; new requests are published to the free list only
+    // after their buffers are assigned below
     initializeBasePool(expansion_size);
 
     // Assign buffers to new requests
@@ -292,12 +362,22 @@ ControlRequestPool::expandPool() {
         requests_[i].operation_type = nixlLibfabricReq::SEND;
     }
 
+    publishRequests(current_size);
+
     NIXL_INFO << "Successfully expanded control request pool on rail " << rail_id_ << " to "
               << requests_.size() << " requests with " << buffer_chunks_.size() << " buffer chunks";
 
     return NIXL_SUCCESS;
 }
 
+void
+ControlRequestPool::setMemBudget(nixlMemBudget *budget) {
+    RequestPool::setMemBudget(budget);
+    for (const auto &chunk : buffer_chunks_) {
+        budgetCharge(chunk.size);
+    }
+}
+
 nixlLibfabricReq *
 ControlRequestPool::allocate(size_t needed_size) {
     // Validate size before attempting allocation
@@ -352,7 +432,15 @@ DataRequestPool::expandPool() {
     size_t current_size = requests_.size();
     size_t expansion_size = initial_pool_size_; // Add same amount as initial size
 
-    // Expand the base pool (adds new requests to requests_ vector and free_indices_)
+    if (!budgetReserve(expansion_size * sizeof(nixlLibfabricReq))) {
+        NIXL_WARN << "ExpandPool on Rail " << rail_id_
+                  << " rejected by internal memory cap (used=" << mem_budget_->used()
+                  << " cap=" << mem_budget_->cap() << ")";
+        return NIXL_ERR_BACKEND;
+    }
+
+    // Expand the base pool; new requests are published to the free list only
+    // after they are initialized below
     initializeBasePool(expansion_size);
 
     // Initialize new requests
@@ -363,6 +451,8 @@ DataRequestPool::expandPool() {
         requests_[i].operation_type = nixlLibfabricReq::WRITE; // Default for data
     }
 
+    publishRequests(current_size);
+
     NIXL_INFO << "Successfully expanded data request pool on rail " << rail_id_ << " to "
               << requests_.size() << " requests";
 
@@ -698,14 +788,21 @@ nixlLibfabricRail::setXferIdCallback(std::function<void(uint32_t)> callback) {
     xferIdCallback = callback;
 }
 
+void
+nixlLibfabricRail::setErrorCallback(std::function<void(int)> callback) {
+    errorCallback = callback;
+}
+
 // Per-Rail Completion Processing
 
 // Per-rail completion processing - handles one rail's CQ with configurable blocking behavior
 nixl_status_t
 nixlLibfabricRail::progressCompletionQueue(bool use_blocking) const {
-    // Completion processing
-    struct fi_cq_data_entry completion;
-    memset(&completion, 0, sizeof(completion));
+    // Batch completion processing: one fi_cq_read drains up to
+    // NIXL_LIBFABRIC_CQ_BATCH_SIZE entries, so heavily striped transfers pay
+    // the CQ lock and provider call once per batch instead of per completion.
+    struct fi_cq_data_entry completions[NIXL_LIBFABRIC_CQ_BATCH_SIZE];
+    memset(completions, 0, sizeof(completions));
 
     int ret;
 
@@ -715,10 +812,14 @@ nixlLibfabricRail::progressCompletionQueue(bool use_blocking) const {
 
         if (use_blocking && blocking_cq_sread_supported) {
             // Blocking read using fi_cq_sread (used by CM thread)
-            ret = fi_cq_sread(cq, &completion, 1, nullptr, NIXL_LIBFABRIC_CQ_SREAD_TIMEOUT_MS);
+            ret = fi_cq_sread(cq,
+                              completions,
+                              NIXL_LIBFABRIC_CQ_BATCH_SIZE,
+                              nullptr,
+                              NIXL_LIBFABRIC_CQ_SREAD_TIMEOUT_MS);
         } else {
             // Non-blocking read (used by progress thread or fallback)
-            ret = fi_cq_read(cq, &completion, 1);
+            ret = fi_cq_read(cq, completions, NIXL_LIBFABRIC_CQ_BATCH_SIZE);
         }
 
         if (ret < 0 && ret != -FI_EAGAIN) {
@@ -734,31 +835,39 @@ nixlLibfabricRail::progressCompletionQueue(bool use_blocking) const {
                 NIXL_ERROR << "CQ read failed on rail " << rail_id
                            << " with error: " << fi_strerror(err_entry.err)
                            << " prov_errno: " << err_entry.prov_errno << " len: " << err_entry.len;
+                // Surface the native errno before it collapses into the
+                // generic backend error
+                if (errorCallback)
+                    errorCallback(err_entry.err);
             } else {
                 NIXL_ERROR << "fi_cq_readerr failed with " << err_ret;
+                if (errorCallback)
+                    errorCallback(-ret);
             }
             return NIXL_ERR_BACKEND;
         }
     }
-    // CQ lock released here - completion is now local data
+    // CQ lock released here - completions are now local data
 
     if (ret == -FI_EAGAIN) {
         return NIXL_IN_PROG; // No completions available
     }
 
-    if (ret == 1) {
-        NIXL_TRACE << "Completion received on rail " << rail_id << " flags=" << std::hex
-                   << completion.flags << " data=" << completion.data
-                   << " context=" << completion.op_context << std::dec;
+    if (ret > 0 && ret <= NIXL_LIBFABRIC_CQ_BATCH_SIZE) {
+        for (int i = 0; i < ret; ++i) {
+            NIXL_TRACE << "Completion received on rail " << rail_id << " flags=" << std::hex
+                       << completions[i].flags << " data=" << completions[i].data
+                       << " context=" << completions[i].op_context << std::dec;
 
-        // Process completion using local data. Callbacks have their own thread safety
-        nixl_status_t status = processCompletionQueueEntry(&completion);
-        if (status != NIXL_SUCCESS) {
-            NIXL_ERROR << "Failed to process completion on rail " << rail_id;
-            return status;
+            // Process completion using local data. Callbacks have their own thread safety
+            nixl_status_t status = processCompletionQueueEntry(&completions[i]);
+            if (status != NIXL_SUCCESS) {
+                NIXL_ERROR << "Failed to process completion on rail " << rail_id;
+                return status;
+            }
         }
 
-        NIXL_DEBUG << "Completion processed on rail " << rail_id;
+        NIXL_DEBUG << "Processed " << ret << " completions on rail " << rail_id;
         return NIXL_SUCCESS;
     }
 
@@ -770,6 +879,8 @@ nixl_status_t
 nixlLibfabricRail::processCompletionQueueEntry(struct fi_cq_data_entry *comp) const {
     uint64_t flags = comp->flags;
 
+    NIXL_PROBE3(libfabric_cq_entry, rail_id, flags, comp->len);
+
     NIXL_TRACE << "Routing completion from rail " << rail_id << " with flags=" << std::hex << flags
                << " FI_SEND: " << (flags & FI_SEND) << " FI_RECV: " << (flags & FI_RECV)
                << " FI_WRITE: " << (flags & FI_WRITE)
@@ -1114,6 +1225,77 @@ nixlLibfabricRail::postSend(uint64_t immediate_data,
     return NIXL_ERR_BACKEND;
 }
 
+size_t
+nixlLibfabricRail::getInjectSize() const {
+    return (info && info->tx_attr) ? info->tx_attr->inject_size : 0;
+}
+
+nixl_status_t
+nixlLibfabricRail::postInject(uint64_t immediate_data,
+                              fi_addr_t dest_addr,
+                              const void *buffer,
+                              size_t length) const {
+    if (length == 0 || length > getInjectSize()) {
+        NIXL_ERROR << "Invalid inject size=" << length << " (max: " << getInjectSize() << ")";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    NIXL_TRACE << "Injecting data on endpoint=" << endpoint << " buffer=" << buffer
+               << " size=" << length << " immediate_data=" << std::hex << immediate_data
+               << " msg_type=" << NIXL_GET_MSG_TYPE_FROM_IMM(immediate_data)
+               << " agent_idx=" << NIXL_GET_AGENT_INDEX_FROM_IMM(immediate_data)
+               << " XFER_ID=" << NIXL_GET_XFER_ID_FROM_IMM(immediate_data)
+               << " dest_addr=" << dest_addr << std::dec;
+
+    // Same retry discipline as postSend: EAGAIN retries indefinitely with backoff
+    int ret = -FI_EAGAIN;
+    int attempt = 0;
+
+    while (true) {
+        // fi_injectdata buffers the payload at return: no completion is generated
+        ret = fi_injectdata(endpoint, buffer, length, immediate_data, dest_addr);
+
+        if (ret == 0) {
+            NIXL_TRACE << "Inject posted successfully"
+                       << (attempt > 0 ? " after " + std::to_string(attempt + 1) + " attempts" :
+                                         "");
+            return NIXL_SUCCESS;
+        }
+
+        if (ret == -FI_EAGAIN) {
+            attempt++;
+
+            // Log every N attempts to avoid log spam
+            if (attempt % NIXL_LIBFABRIC_LOG_INTERVAL_ATTEMPTS == 0) {
+                NIXL_INFO << "fi_injectdata still retrying EAGAIN on rail " << rail_id << " after "
+                          << attempt << " attempts";
+            } else {
+                NIXL_TRACE << "fi_injectdata returned EAGAIN on rail " << rail_id
+                           << ", retrying (attempt " << attempt << ")";
+            }
+
+            // Exponential backoff with cap to avoid overwhelming the system
+            int delay_us = std::min(NIXL_LIBFABRIC_BASE_RETRY_DELAY_US * (1 + attempt / 10),
+                                    NIXL_LIBFABRIC_MAX_RETRY_DELAY_US);
+
+            // Progress completion queue to drain pending completions before retry
+            nixl_status_t progress_status = progressCompletionQueue(false);
+            if (progress_status == NIXL_SUCCESS) {
+                NIXL_TRACE << "Progressed completions on rail " << rail_id << " before retry";
+            }
+
+            usleep(delay_us);
+            continue;
+        } else {
+            // Other error - don't retry, fail immediately
+            break;
+        }
+    }
+
+    NIXL_ERROR << "fi_injectdata failed on rail " << rail_id << ": " << fi_strerror(-ret);
+    return NIXL_ERR_BACKEND;
+}
+
 nixl_status_t
 nixlLibfabricRail::postWrite(const void *local_buffer,
                              size_t length,
@@ -1278,7 +1460,9 @@ nixlLibfabricRail::registerMemory(void *buffer,
                                   nixl_mem_t mem_type,
                                   int gpu_id,
                                   struct fid_mr **mr_out,
-                                  uint64_t *key_out) const {
+                                  uint64_t *key_out,
+                                  int dmabuf_fd,
+                                  size_t dmabuf_offset) const {
     if (!buffer || !mr_out || !key_out) {
         NIXL_ERROR << "Invalid parameters on rail " << rail_id;
         return NIXL_ERR_INVALID_PARAM;
@@ -1348,7 +1532,42 @@ nixlLibfabricRail::registerMemory(void *buffer,
     mr_attr.mr_iov = &iov;
     mr_attr.iov_count = 1;
 
-    int ret = fi_mr_regattr(domain, &mr_attr, 0, &mr);
+    uint64_t reg_flags = 0;
+#if defined(FI_MR_DMABUF)
+    // Register through the dmabuf fd when one backs the buffer, so the
+    // provider maps the buffer directly instead of going through
+    // peer-direct address translation
+    struct fi_mr_dmabuf dmabuf_region = {};
+    if (dmabuf_fd >= 0) {
+        dmabuf_region.fd = dmabuf_fd;
+        dmabuf_region.offset = dmabuf_offset;
+        dmabuf_region.len = length;
+        dmabuf_region.base_addr = buffer;
+        mr_attr.dmabuf = &dmabuf_region;
+        reg_flags |= FI_MR_DMABUF;
+        NIXL_DEBUG << "dmabuf memory registration - fd: " << dmabuf_fd
+                   << ", offset: " << dmabuf_offset;
+    }
+#else
+    if (dmabuf_fd >= 0) {
+        NIXL_WARN << "dmabuf fd provided but libfabric lacks FI_MR_DMABUF support,"
+                     " falling back to address-based registration on rail "
+                  << rail_id;
+    }
+#endif
+
+    int ret = fi_mr_regattr(domain, &mr_attr, reg_flags, &mr);
+#if defined(FI_MR_DMABUF)
+    if (ret && (reg_flags & FI_MR_DMABUF)) {
+        // Provider built with dmabuf support may still reject it at runtime
+        // (e.g. older kernel); retry through the virtual address
+        NIXL_WARN << "dmabuf registration failed on rail " << rail_id << ": "
+                  << fi_strerror(-ret) << ", retrying address-based registration";
+        mr_attr.mr_iov = &iov;
+        mr_attr.iov_count = 1;
+        ret = fi_mr_regattr(domain, &mr_attr, 0, &mr);
+    }
+#endif
     if (ret) {
         NIXL_ERROR << "fi_mr_reg failed on rail " << rail_id << ": " << fi_strerror(-ret)
                    << " (buffer=" << buffer << ", length=" << length
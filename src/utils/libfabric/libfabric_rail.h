@@ -24,10 +24,11 @@
 #include <functional>
 #include <mutex>
 #include <ostream>
-#include <stack>
+#include <atomic>
 
 #include "nixl.h"
 #include "backend/backend_aux.h"
+#include "common/mem_budget.h"
 #include "libfabric/libfabric_common.h"
 
 // Forward declarations
@@ -37,10 +38,11 @@ class nixlLibfabricConnection;
  * @brief Request structure for libfabric operations
  *
  */
-struct nixlLibfabricReq {
+struct alignas(64) nixlLibfabricReq {
     fi_context ctx; ///< Libfabric context for operation tracking
     size_t rail_id; ///< Rail ID that owns this request
     size_t pool_index; ///< Index in the pool for deque compatibility
+    nixlLibfabricReq *free_next; ///< Next entry in the pool's lock-free free list
     uint32_t xfer_id; ///< Pre-assigned globally unique transfer ID
     void *buffer; ///< Pre-assigned buffer for CONTROL operations, nullptr for DATA
     struct fid_mr *mr; ///< Pre-assigned memory registration for CONTROL, nullptr for DATA
@@ -61,6 +63,7 @@ struct nixlLibfabricReq {
     nixlLibfabricReq()
         : rail_id(0),
           pool_index(0),
+          free_next(nullptr),
           xfer_id(0),
           buffer(nullptr),
           mr(nullptr),
@@ -83,8 +86,13 @@ public:
     /** Initialize request pool with specified size */
     RequestPool(size_t pool_size, size_t rail_id);
 
-    /** Virtual destructor for proper cleanup */
-    virtual ~RequestPool() = default;
+    /** Virtual destructor; releases the pool's charge from the budget */
+    virtual ~RequestPool();
+
+    /** Attach a byte budget and charge the pool's current footprint; growth
+     *  paths then fail gracefully once the budget's cap would be exceeded */
+    virtual void
+    setMemBudget(nixlMemBudget *budget);
 
     /** Release request back to the pool */
     virtual void
@@ -121,15 +129,45 @@ public:
     operator=(RequestPool &&) = delete;
 
 protected:
-    /** Initialize base pool structure with specified size */
+    /** Grow the pool structure by pool_size requests (without publishing
+     * them to the free list, see publishRequests) */
     void
     initializeBasePool(size_t pool_size);
 
+    /** Push requests from first_index onward onto the free list, making them
+     * visible to lock-free allocation; call only once they are fully set up */
+    void
+    publishRequests(size_t first_index);
+
+    /** Tagged free-list head: the tag is bumped on every pop so a concurrent
+     * pop/release/pop of the same request cannot satisfy a stale CAS (ABA) */
+    struct FreeListHead {
+        nixlLibfabricReq *ptr;
+        uintptr_t tag;
+    };
+
+    /** Push a request onto the lock-free free list */
+    void
+    pushFree(nixlLibfabricReq *req) const;
+
+    /** Reserve bytes against the attached budget; always true when no budget
+     *  is attached or the budget is uncapped */
+    bool
+    budgetReserve(size_t bytes);
+
+    /** Record bytes that are already allocated against the budget */
+    void
+    budgetCharge(size_t bytes);
+
     mutable std::deque<nixlLibfabricReq> requests_; ///< Expandable request pool
-    mutable std::stack<size_t> free_indices_; ///< Stack of available request indices
+    mutable std::atomic<FreeListHead> free_head_{FreeListHead{nullptr, 0}}; ///< Treiber stack
+    mutable std::atomic<size_t> free_count_{0}; ///< Free list size, for utilization stats
+    std::atomic<size_t> total_count_{0}; ///< Total requests, grows on expansion
     size_t rail_id_; ///< Rail ID for this pool
     size_t initial_pool_size_; ///< Original pool size for expansion calculations
-    mutable std::mutex pool_mutex_; ///< Thread safety protection
+    mutable std::mutex pool_mutex_; ///< Serializes pool expansion only (off the hot path)
+    nixlMemBudget *mem_budget_ = nullptr; ///< Optional engine-level byte budget
+    size_t charged_bytes_ = 0; ///< Total charged, released on destruction
 };
 
 /** Buffer chunk structure for control request pool */
@@ -160,6 +198,10 @@ public:
     nixl_status_t
     initialize(struct fid_domain *domain);
 
+    /** Attach budget and additionally charge the registered buffer chunks */
+    void
+    setMemBudget(nixlMemBudget *budget) override;
+
     /** Allocate control request with size validation */
     nixlLibfabricReq *
     allocate(size_t needed_size);
@@ -273,15 +315,26 @@ public:
     bool
     isProperlyInitialized() const;
 
+    /** Attach an engine-level byte budget to this rail's request pools */
+    void
+    setMemBudget(nixlMemBudget *budget) {
+        control_request_pool_.setMemBudget(budget);
+        data_request_pool_.setMemBudget(budget);
+    }
+
     // Memory registration methods
-    /** Register memory buffer with libfabric */
+    /** Register memory buffer with libfabric. When dmabuf_fd is valid and
+     *  the installed libfabric supports FI_MR_DMABUF, registration goes
+     *  through the dmabuf fd instead of the virtual address. */
     nixl_status_t
     registerMemory(void *buffer,
                    size_t length,
                    nixl_mem_t mem_type,
                    int gpu_id,
                    struct fid_mr **mr_out,
-                   uint64_t *key_out) const;
+                   uint64_t *key_out,
+                   int dmabuf_fd = -1,
+                   size_t dmabuf_offset = 0) const;
 
     /** Deregister memory from libfabric */
     nixl_status_t
@@ -314,6 +367,23 @@ public:
     nixl_status_t
     postSend(uint64_t immediate_data, fi_addr_t dest_addr, nixlLibfabricReq *req) const;
 
+    /** Post small send via fi_injectdata (no MR descriptor, no completion generated) */
+    nixl_status_t
+    postInject(uint64_t immediate_data,
+               fi_addr_t dest_addr,
+               const void *buffer,
+               size_t length) const;
+
+    /** Provider inline inject limit for this rail's endpoint */
+    size_t
+    getInjectSize() const;
+
+    /** Whether the provider on this rail can register device memory directly */
+    bool
+    supportsHmem() const {
+        return provider_supports_hmem_;
+    }
+
     /** Post RDMA write operation with immediate data */
     nixl_status_t
     postWrite(const void *local_buffer,
@@ -358,6 +428,10 @@ public:
     void
     setXferIdCallback(std::function<void(uint32_t)> callback);
 
+    /** Set callback invoked with the native provider errno on CQ errors */
+    void
+    setErrorCallback(std::function<void(int)> callback);
+
     // Optimized resource management methods
     /** Allocate control request with size validation */
     [[nodiscard]] nixlLibfabricReq *
@@ -393,6 +467,8 @@ private:
         connectionReqCallback;
     // XFER_ID tracking callback
     std::function<void(uint32_t)> xferIdCallback;
+    // Native-errno error reporting callback
+    std::function<void(int)> errorCallback;
 
     // Separate request pools for optimal performance
     ControlRequestPool control_request_pool_;
@@ -16,6 +16,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
 #include "libfabric_rail_manager.h"
 #include "libfabric/libfabric_common.h"
 #include "libfabric/libfabric_topology.h"
@@ -37,8 +41,10 @@ static std::atomic<size_t> round_robin_counter{0};
 static const std::string NUM_RAILS_TAG{"num_rails"};
 
 nixlLibfabricRailManager::nixlLibfabricRailManager(size_t striping_threshold)
-    : striping_threshold_(striping_threshold) {
-    NIXL_DEBUG << "Creating rail manager with striping threshold: " << striping_threshold_
+    : striping_threshold_(striping_threshold),
+      min_striping_threshold_(std::max(striping_threshold / 16, size_t(4096))),
+      max_striping_threshold_(striping_threshold * 16) {
+    NIXL_DEBUG << "Creating rail manager with striping threshold: " << striping_threshold
                << " bytes";
 
     // Initialize topology system
@@ -97,6 +103,8 @@ nixlLibfabricRailManager::createDataRails(const std::vector<std::string> &efa_de
             NIXL_DEBUG << "Created data rail " << i << " (device=" << efa_devices[i]
                        << ", provider=" << provider_name << ")";
         }
+
+        rail_perf_.assign(num_data_rails_, RailPerf{});
     }
     catch (const std::exception &e) {
         NIXL_ERROR << "Failed to create data rails: " << e.what();
@@ -133,7 +141,157 @@ nixlLibfabricRailManager::createControlRails(const std::vector<std::string> &efa
 
 bool
 nixlLibfabricRailManager::shouldUseStriping(size_t transfer_size) const {
-    return transfer_size >= striping_threshold_;
+    return transfer_size >= striping_threshold_.load(std::memory_order_relaxed);
+}
+
+nixl_status_t
+nixlLibfabricRailManager::setRailClass(const std::string &class_name,
+                                       const std::vector<size_t> &rails) {
+    if (class_name.empty() || rails.empty()) {
+        NIXL_ERROR << "Rail class needs a name and at least one rail";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    for (size_t rail_id : rails) {
+        if (rail_id >= data_rails_.size()) {
+            NIXL_ERROR << "Rail class '" << class_name << "' references invalid rail " << rail_id
+                       << " (have " << data_rails_.size() << " data rails)";
+            return NIXL_ERR_INVALID_PARAM;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(rail_classes_mutex_);
+    rail_classes_[class_name] = rails;
+    NIXL_DEBUG << "Rail class '" << class_name << "' pinned to " << rails.size() << " data rails";
+    return NIXL_SUCCESS;
+}
+
+std::vector<size_t>
+nixlLibfabricRailManager::filterRailsForClass(const std::string &class_name,
+                                              const std::vector<size_t> &selected_rails) const {
+    if (class_name.empty()) {
+        return selected_rails;
+    }
+
+    std::lock_guard<std::mutex> lock(rail_classes_mutex_);
+    auto it = rail_classes_.find(class_name);
+    if (it == rail_classes_.end()) {
+        NIXL_WARN << "Unknown rail class '" << class_name << "', using all selected rails";
+        return selected_rails;
+    }
+
+    std::vector<size_t> filtered;
+    for (size_t rail_id : selected_rails) {
+        if (std::find(it->second.begin(), it->second.end(), rail_id) != it->second.end()) {
+            filtered.push_back(rail_id);
+        }
+    }
+    if (filtered.empty()) {
+        NIXL_WARN << "Rail class '" << class_name
+                  << "' has no overlap with the rails selected for this memory, "
+                     "using all selected rails";
+        return selected_rails;
+    }
+    return filtered;
+}
+
+static uint64_t
+stripingNowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void
+nixlLibfabricRailManager::recordRailCompletion(size_t rail_id, size_t bytes, uint64_t post_us) {
+    uint64_t latency_us = stripingNowUs() - post_us;
+
+    std::lock_guard<std::mutex> lock(rail_perf_mutex_);
+    RailPerf &perf = rail_perf_[rail_id];
+    perf.bytes += bytes;
+    perf.busy_us += latency_us;
+    perf.completions++;
+    if (perf.min_latency_us == 0 || latency_us < perf.min_latency_us) {
+        perf.min_latency_us = latency_us;
+    }
+
+    if (++perf_window_completions_ >= PERF_WINDOW) {
+        retuneStripingLocked();
+        perf_window_completions_ = 0;
+    }
+}
+
+void
+nixlLibfabricRailManager::retuneStripingLocked() {
+    // Per-rail achieved bandwidth in bytes/ms, from post-to-completion timing
+    uint64_t total_bw = 0;
+    uint64_t max_bw = 0;
+    uint64_t overhead_us = 0;
+    for (const RailPerf &perf : rail_perf_) {
+        if (perf.completions == 0 || perf.busy_us == 0) {
+            continue;
+        }
+        uint64_t bw = perf.bytes * 1000 / perf.busy_us;
+        total_bw += bw;
+        max_bw = std::max(max_bw, bw);
+        if (overhead_us == 0 || perf.min_latency_us < overhead_us) {
+            overhead_us = perf.min_latency_us;
+        }
+    }
+
+    if (max_bw == 0) {
+        return;
+    }
+
+    // Weight each rail by its share of the aggregate bandwidth so striped
+    // chunks land proportionally; rails without samples keep their weight
+    for (RailPerf &perf : rail_perf_) {
+        if (perf.completions > 0 && perf.busy_us > 0) {
+            uint64_t bw = perf.bytes * 1000 / perf.busy_us;
+            perf.weight = std::max<uint64_t>(bw * 1024 / max_bw, 1);
+        }
+        perf.bytes = 0;
+        perf.busy_us = 0;
+        perf.completions = 0;
+        perf.min_latency_us = 0;
+    }
+
+    // Striping pays once size/total_bw + overhead < size/max_bw: move the
+    // threshold to that break-even size, clamped around the configured value
+    if (total_bw > max_bw && overhead_us > 0) {
+        uint64_t breakeven =
+            overhead_us * max_bw / 1000 * total_bw / (total_bw - max_bw);
+        size_t new_threshold = std::min(std::max((size_t)breakeven, min_striping_threshold_),
+                                        max_striping_threshold_);
+        if (new_threshold != striping_threshold_.load(std::memory_order_relaxed)) {
+            NIXL_DEBUG << "Retuned striping threshold to " << new_threshold
+                       << " bytes (overhead=" << overhead_us << "us, max_bw=" << max_bw
+                       << "B/ms, total_bw=" << total_bw << "B/ms)";
+            striping_threshold_.store(new_threshold, std::memory_order_relaxed);
+        }
+    }
+}
+
+std::vector<size_t>
+nixlLibfabricRailManager::computeChunkSizes(size_t transfer_size,
+                                            const std::vector<size_t> &selected_rails) const {
+    std::vector<size_t> chunk_sizes(selected_rails.size());
+    uint64_t total_weight = 0;
+    {
+        std::lock_guard<std::mutex> lock(rail_perf_mutex_);
+        for (size_t i = 0; i < selected_rails.size(); ++i) {
+            chunk_sizes[i] = rail_perf_[selected_rails[i]].weight;
+            total_weight += chunk_sizes[i];
+        }
+    }
+
+    size_t assigned = 0;
+    for (size_t i = 0; i < chunk_sizes.size(); ++i) {
+        chunk_sizes[i] = transfer_size * chunk_sizes[i] / total_weight;
+        assigned += chunk_sizes[i];
+    }
+    // Rounding remainder goes to the last rail
+    chunk_sizes.back() += transfer_size - assigned;
+    return chunk_sizes;
 }
 
 nixl_status_t
@@ -171,8 +329,13 @@ nixlLibfabricRailManager::prepareAndSubmitTransfer(
             NIXL_ERROR << "Failed to allocate request for rail " << rail_id;
             return NIXL_ERR_BACKEND;
         }
-        // Set completion callback and populate request
-        req->completion_callback = completion_callback;
+        // Set completion callback and populate request; feed the completion
+        // back into the striping tuner
+        const uint64_t post_us = stripingNowUs();
+        req->completion_callback = [this, rail_id, transfer_size, post_us, completion_callback]() {
+            recordRailCompletion(rail_id, transfer_size, post_us);
+            if (completion_callback) completion_callback();
+        };
         req->chunk_offset = 0;
         req->chunk_size = transfer_size;
         req->local_addr = local_addr;
@@ -230,17 +393,18 @@ nixlLibfabricRailManager::prepareAndSubmitTransfer(
                    << transfer_size << " bytes, XFER_ID=" << req->xfer_id;
 
     } else {
-        // Striping: distribute across multiple rails
+        // Striping: distribute across multiple rails, sized by each rail's
+        // measured bandwidth share (equal until the tuner has data)
         size_t num_rails = selected_rails.size();
-        size_t chunk_size = transfer_size / num_rails;
-        size_t remainder = transfer_size % num_rails;
+        std::vector<size_t> chunk_sizes = computeChunkSizes(transfer_size, selected_rails);
+        size_t chunk_offset = 0;
         for (size_t i = 0; i < num_rails; ++i) {
             const size_t rail_id = selected_rails[i];
             const size_t remote_ep_id =
                 remote_selected_endpoints[i % remote_selected_endpoints.size()];
             NIXL_DEBUG << "rail " << rail_id << ", remote_ep_id=" << remote_ep_id;
-            size_t current_chunk_size = chunk_size + (i == num_rails - 1 ? remainder : 0);
-            if (current_chunk_size == 0) break;
+            size_t current_chunk_size = chunk_sizes[i];
+            if (current_chunk_size == 0) continue;
             // Allocate request
             nixlLibfabricReq *req = data_rails_[rail_id]->allocateDataRequest(op_type);
             if (!req) {
@@ -248,10 +412,14 @@ nixlLibfabricRailManager::prepareAndSubmitTransfer(
                 return NIXL_ERR_BACKEND;
             }
 
-            req->completion_callback = completion_callback;
+            const uint64_t post_us = stripingNowUs();
+            req->completion_callback =
+                [this, rail_id, current_chunk_size, post_us, completion_callback]() {
+                    recordRailCompletion(rail_id, current_chunk_size, post_us);
+                    if (completion_callback) completion_callback();
+                };
 
             // Calculate and populate chunk info
-            size_t chunk_offset = i * chunk_size;
             req->chunk_offset = chunk_offset;
             req->chunk_size = current_chunk_size;
             req->local_addr = static_cast<char *>(local_addr) + chunk_offset;
@@ -305,6 +473,7 @@ nixlLibfabricRailManager::prepareAndSubmitTransfer(
             }
 
             binary_notif->expected_completions++;
+            chunk_offset += current_chunk_size;
         }
         NIXL_DEBUG << "Striping: submitted "
                    << (binary_notif ? binary_notif->expected_completions : 0) << " requests for "
@@ -392,7 +561,9 @@ nixlLibfabricRailManager::registerMemory(void *buffer,
                                          int gpu_id,
                                          std::vector<struct fid_mr *> &mr_list_out,
                                          std::vector<uint64_t> &key_list_out,
-                                         std::vector<size_t> &selected_rails_out) {
+                                         std::vector<size_t> &selected_rails_out,
+                                         int dmabuf_fd,
+                                         size_t dmabuf_offset) {
     if (!buffer) {
         NIXL_ERROR << "Invalid buffer parameter";
         return NIXL_ERR_INVALID_PARAM;
@@ -410,47 +581,68 @@ nixlLibfabricRailManager::registerMemory(void *buffer,
     key_list_out.resize(data_rails_.size(), 0);
     selected_rails_out = selected_rails; // Return which rails were selected
 
-    // Register memory on each selected rail
-    for (size_t i = 0; i < selected_rails.size(); ++i) {
-        size_t rail_idx = selected_rails[i];
+    // Validate rail indices up front, so the registration loop below can
+    // run without partial-cleanup bookkeeping interleaved with spawns
+    for (size_t rail_idx : selected_rails) {
         if (rail_idx >= data_rails_.size()) {
             NIXL_ERROR << "Invalid rail index " << rail_idx;
-            // Cleanup already registered MRs
-            for (size_t cleanup_idx : selected_rails) {
-                if (cleanup_idx >= rail_idx) break; // Only cleanup what we've done so far
-                if (mr_list_out[cleanup_idx]) {
-                    data_rails_[cleanup_idx]->deregisterMemory(mr_list_out[cleanup_idx]);
-                    mr_list_out[cleanup_idx] = nullptr;
-                }
-            }
             return NIXL_ERR_INVALID_PARAM;
         }
+    }
 
+    // Register memory on each selected rail. Each rail has its own
+    // domain, so registrations are independent; for large regions the
+    // serial per-rail loop is dominated by per-NIC page pinning and
+    // scales with rail count, so those run on one thread per rail
+    std::vector<nixl_status_t> rail_status(selected_rails.size(), NIXL_SUCCESS);
+    auto register_one = [&](size_t i) {
+        size_t rail_idx = selected_rails[i];
         struct fid_mr *mr;
         uint64_t key;
-        nixl_status_t status =
-            data_rails_[rail_idx]->registerMemory(buffer, length, mem_type, gpu_id, &mr, &key);
-        if (status != NIXL_SUCCESS) {
-            NIXL_ERROR << "Failed to register memory on rail " << rail_idx;
-            // Cleanup already registered MRs
-            for (size_t cleanup_idx : selected_rails) {
-                if (cleanup_idx >= rail_idx) break; // Only cleanup what we've done so far
-                if (mr_list_out[cleanup_idx]) {
-                    data_rails_[cleanup_idx]->deregisterMemory(mr_list_out[cleanup_idx]);
-                    mr_list_out[cleanup_idx] = nullptr;
-                }
-            }
-            return status;
-        }
-
+        rail_status[i] = data_rails_[rail_idx]->registerMemory(
+            buffer, length, mem_type, gpu_id, &mr, &key, dmabuf_fd, dmabuf_offset);
+        if (rail_status[i] != NIXL_SUCCESS)
+            return;
         mr_list_out[rail_idx] = mr;
         key_list_out[rail_idx] = key;
+    };
+
+    if (selected_rails.size() > 1 && length >= parallel_reg_min_bytes) {
+        std::vector<std::thread> workers;
+        workers.reserve(selected_rails.size());
+        for (size_t i = 0; i < selected_rails.size(); ++i)
+            workers.emplace_back(register_one, i);
+        for (auto &worker : workers)
+            worker.join();
+    } else {
+        for (size_t i = 0; i < selected_rails.size(); ++i) {
+            register_one(i);
+            if (rail_status[i] != NIXL_SUCCESS)
+                break;
+        }
+    }
+
+    for (size_t i = 0; i < selected_rails.size(); ++i) {
+        if (rail_status[i] == NIXL_SUCCESS)
+            continue;
+        NIXL_ERROR << "Failed to register memory on rail " << selected_rails[i];
+        // Cleanup the rails that did register
+        for (size_t cleanup_idx : selected_rails) {
+            if (mr_list_out[cleanup_idx]) {
+                data_rails_[cleanup_idx]->deregisterMemory(mr_list_out[cleanup_idx]);
+                mr_list_out[cleanup_idx] = nullptr;
+                key_list_out[cleanup_idx] = 0;
+            }
+        }
+        return rail_status[i];
+    }
 
+    for (size_t rail_idx : selected_rails) {
         // Mark rail as active for progress tracking optimization
         markRailActive(rail_idx);
-
         NIXL_DEBUG << "Registered memory on rail " << rail_idx
-                   << " (mr=" << static_cast<const void *>(mr) << ", key=" << key << ")";
+                   << " (mr=" << static_cast<const void *>(mr_list_out[rail_idx])
+                   << ", key=" << key_list_out[rail_idx] << ")";
     }
 
     return NIXL_SUCCESS;
@@ -600,6 +792,25 @@ nixlLibfabricRailManager::postControlMessage(ControlMessageType msg_type,
     // TODO: Add sequencing for connection establishment workflow.
     uint64_t imm_data = NIXL_MAKE_IMM_DATA(msg_type_value, agent_idx, xfer_id, 0);
 
+    // Inject fast path: payloads within the provider's inline limit go out via
+    // fi_injectdata, which buffers the data before returning. No MR descriptor
+    // or completion tracking is needed, so the request finishes right here.
+    if (req->buffer_size > 0 &&
+        req->buffer_size <= control_rails_[control_rail_id]->getInjectSize()) {
+        nixl_status_t inject_status = control_rails_[control_rail_id]->postInject(
+            imm_data, dest_addr, req->buffer, req->buffer_size);
+        if (inject_status == NIXL_SUCCESS) {
+            NIXL_DEBUG << "Control message type " << msg_type_value << " injected inline ("
+                       << req->buffer_size << " bytes), XFER_ID=" << xfer_id;
+            if (completion_callback) {
+                completion_callback();
+            }
+            control_rails_[control_rail_id]->releaseRequest(req);
+            return NIXL_SUCCESS;
+        }
+        NIXL_DEBUG << "Inject fast path failed, falling back to registered send";
+    }
+
     // Set completion callback if provided
     if (completion_callback) {
         req->completion_callback = completion_callback;
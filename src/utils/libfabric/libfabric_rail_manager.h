@@ -104,6 +104,29 @@ public:
         return control_rails_.size();
     }
 
+    /** Attach an engine-level byte budget to the request pools of every
+     *  rail; call after rail creation, before traffic */
+    void
+    setMemBudget(nixlMemBudget *budget) {
+        for (auto &rail : data_rails_) {
+            rail->setMemBudget(budget);
+        }
+        for (auto &rail : control_rails_) {
+            rail->setMemBudget(budget);
+        }
+    }
+
+    /** Whether every data rail's provider can register device memory (FI_HMEM) */
+    bool
+    supportsHmem() const {
+        for (const auto &rail : data_rails_) {
+            if (!rail->supportsHmem()) {
+                return false;
+            }
+        }
+        return !data_rails_.empty();
+    }
+
     // Memory registration management
     /** Register memory with topology-aware rail selection based on memory type and location
      * @param buffer Memory buffer to register
@@ -113,6 +136,8 @@ public:
      * @param mr_list_out Memory registration handles, indexed by rail ID
      * @param key_list_out Remote access keys, indexed by rail ID
      * @param selected_rails_out List of rail IDs where memory was registered
+     * @param dmabuf_fd dmabuf fd backing the buffer, or -1 for address-based registration
+     * @param dmabuf_offset Offset of buffer within the dmabuf
      * @return NIXL_SUCCESS on success, error code on failure
      */
     nixl_status_t
@@ -122,7 +147,9 @@ public:
                    int gpu_id,
                    std::vector<struct fid_mr *> &mr_list_out,
                    std::vector<uint64_t> &key_list_out,
-                   std::vector<size_t> &selected_rails_out);
+                   std::vector<size_t> &selected_rails_out,
+                   int dmabuf_fd = -1,
+                   size_t dmabuf_offset = 0);
     /** Deregister memory from specified rails
      * @param selected_rails List of rail IDs to deregister from
      * @param mr_list Memory registration handles to deregister
@@ -191,6 +218,26 @@ public:
     bool
     shouldUseStriping(size_t transfer_size) const;
 
+    // QoS rail partitioning
+    /** Pin a traffic class to a subset of the data rails, so its transfers
+     * stay off rails reserved for other traffic (e.g. collectives)
+     * @param class_name Traffic class name as carried in the transfer opt args
+     * @param rails Data rail IDs the class is allowed to use
+     * @return NIXL_SUCCESS on success, NIXL_ERR_INVALID_PARAM on bad input
+     */
+    nixl_status_t
+    setRailClass(const std::string &class_name, const std::vector<size_t> &rails);
+
+    /** Restrict a rail selection to a traffic class's configured subset
+     * @param class_name Traffic class name; empty leaves the selection unchanged
+     * @param selected_rails Topology-selected rails for the memory
+     * @return The intersection in selected order; an unknown class or an empty
+     *         intersection falls back to selected_rails with a warning
+     */
+    std::vector<size_t>
+    filterRailsForClass(const std::string &class_name,
+                        const std::vector<size_t> &selected_rails) const;
+
     // Control Message APIs
     /** Control message types for rail communication */
     enum class ControlMessageType {
@@ -295,8 +342,31 @@ public:
         std::vector<std::array<char, LF_EP_NAME_MAX_LEN>> &data_endpoints_out,
         std::vector<std::array<char, LF_EP_NAME_MAX_LEN>> &control_endpoints_out) const;
 
+    /** Record a completed data transfer chunk for the striping feedback loop
+     * @param rail_id Rail the chunk completed on
+     * @param bytes Chunk size in bytes
+     * @param post_us Steady-clock timestamp (microseconds) taken at submission
+     */
+    void
+    recordRailCompletion(size_t rail_id, size_t bytes, uint64_t post_us);
+
 private:
-    size_t striping_threshold_;
+    std::atomic<size_t> striping_threshold_;
+
+    /** Per-rail measurements for the current tuning window */
+    struct RailPerf {
+        uint64_t bytes = 0; ///< Bytes completed in the window
+        uint64_t busy_us = 0; ///< Accumulated post-to-completion latency
+        uint64_t completions = 0; ///< Completions in the window
+        uint64_t min_latency_us = 0; ///< Smallest chunk latency (fixed-cost estimate)
+        uint64_t weight = 1024; ///< Relative bandwidth share, 1024 = neutral
+    };
+
+    // Registrations at least this large fan out across one thread per
+    // selected rail: per-NIC page pinning dominates at this size, and the
+    // rails' domains are independent, so a big DRAM arena registers in
+    // roughly single-rail time instead of scaling with the rail count
+    static constexpr size_t parallel_reg_min_bytes = 64ULL << 20;
 
     // Rail allocation
     std::vector<std::unique_ptr<nixlLibfabricRail>> data_rails_;
@@ -314,6 +384,30 @@ private:
     std::unordered_set<size_t> active_rails_;
     mutable std::mutex active_rails_mutex_;
 
+    // QoS rail partitioning: traffic class name to allowed data rail IDs.
+    // Written at configuration time, read per transfer under the mutex.
+    std::unordered_map<std::string, std::vector<size_t>> rail_classes_;
+    mutable std::mutex rail_classes_mutex_;
+
+    // Striping feedback loop state: guarded by rail_perf_mutex_, retuned
+    // every PERF_WINDOW completions (see retuneStripingLocked)
+    static constexpr uint64_t PERF_WINDOW = 256;
+    std::vector<RailPerf> rail_perf_;
+    mutable std::mutex rail_perf_mutex_;
+    uint64_t perf_window_completions_ = 0;
+    size_t min_striping_threshold_;
+    size_t max_striping_threshold_;
+
+    /** Recompute rail weights and the striping threshold from the completed
+     * window; caller must hold rail_perf_mutex_ */
+    void
+    retuneStripingLocked();
+
+    /** Split transfer_size across the selected rails proportionally to their
+     * measured bandwidth weights (equal split until measurements exist) */
+    std::vector<size_t>
+    computeChunkSizes(size_t transfer_size, const std::vector<size_t> &selected_rails) const;
+
     // Internal rail selection method
     std::vector<size_t>
     selectRailsForMemory(void *mem_addr, nixl_mem_t mem_type, int gpu_id) const;
@@ -19,12 +19,18 @@
 #include "libfabric_topology.h"
 #include "libfabric_common.h"
 #include "common/nixl_log.h"
+#include "serdes/serdes.h"
 
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <algorithm>
 #include <set>
 
+#include <unistd.h>
+
 #include <rdma/fabric.h>
 #include <rdma/fi_domain.h>
 
@@ -41,6 +47,15 @@ nixlLibfabricTopology::nixlLibfabricTopology()
 
     NIXL_TRACE << "Starting automatic topology discovery";
 
+    // Try the persistent cache first: on identical hardware a previous run's
+    // snapshot lets us skip fi_getinfo/hwloc probing entirely.
+    const std::string inventory_hash = computeInventoryHash();
+    if (loadTopologyCache(inventory_hash) == NIXL_SUCCESS) {
+        NIXL_INFO << "Loaded topology from cache (inventory hash " << inventory_hash << ")";
+        printTopologyInfo();
+        return;
+    }
+
     // Discover topology immediately - hard error if it fails
     nixl_status_t status = discoverTopology();
     if (status != NIXL_SUCCESS) {
@@ -49,6 +64,7 @@ nixlLibfabricTopology::nixlLibfabricTopology()
             "Failed to discover system topology - cannot proceed without topology information");
     }
     NIXL_TRACE << "Topology discovery completed successfully";
+    saveTopologyCache(inventory_hash); // Best effort, failures are non-fatal
     printTopologyInfo();
 }
 
@@ -552,6 +568,203 @@ nixlLibfabricTopology::buildFallbackMapping() {
 }
 
 
+// Persistent topology cache
+
+std::string
+nixlLibfabricTopology::computeInventoryHash() const {
+    // Hash the PCI inventory from sysfs: it is cheap to read and changes
+    // exactly when the hardware the expensive discovery depends on changes.
+    std::vector<std::string> entries;
+    std::error_code ec;
+    std::filesystem::directory_iterator dir_iter("/sys/bus/pci/devices", ec);
+    if (ec) {
+        NIXL_DEBUG << "Cannot enumerate /sys/bus/pci/devices: " << ec.message();
+        return "";
+    }
+    for (const auto &dev_entry : dir_iter) {
+        std::string line = dev_entry.path().filename().string();
+        for (const char *attr : {"vendor", "device"}) {
+            std::ifstream attr_file(dev_entry.path() / attr);
+            std::string value;
+            if (attr_file && std::getline(attr_file, value)) {
+                line += " " + value;
+            }
+        }
+        entries.push_back(line);
+    }
+    // Directory iteration order is unspecified, sort for a stable hash
+    std::sort(entries.begin(), entries.end());
+    std::string inventory;
+    for (const auto &entry : entries) {
+        inventory += entry;
+        inventory += '\n';
+    }
+    std::stringstream ss;
+    ss << std::hex << std::hash<std::string>{}(inventory);
+    return ss.str();
+}
+
+std::string
+nixlLibfabricTopology::getCacheFilePath() const {
+    const char *env = getenv("NIXL_TOPOLOGY_CACHE");
+    if (env) {
+        // "0" or an empty value disables caching, anything else overrides the path
+        std::string value(env);
+        if (value.empty() || value == "0") {
+            return "";
+        }
+        return value;
+    }
+    std::stringstream ss;
+    ss << "/var/tmp/nixl_libfabric_topology_" << getuid() << ".cache";
+    return ss.str();
+}
+
+nixl_status_t
+nixlLibfabricTopology::loadTopologyCache(const std::string &inventory_hash) {
+    const std::string path = getCacheFilePath();
+    if (path.empty() || inventory_hash.empty()) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+
+    nixlSerDes ser_des;
+    if (ser_des.importStr(buffer.str()) != NIXL_SUCCESS) {
+        NIXL_WARN << "Topology cache " << path << " is corrupt, rediscovering";
+        return NIXL_ERR_MISMATCH;
+    }
+    if (ser_des.getStr("inv_hash") != inventory_hash) {
+        NIXL_INFO << "Topology cache " << path
+                  << " was built for different hardware, rediscovering";
+        return NIXL_ERR_MISMATCH;
+    }
+
+    // Deserialize into temporaries first so a truncated snapshot never leaves
+    // the topology half-populated.
+    std::string cached_provider = ser_des.getStr("provider");
+    int counts[3];
+    size_t n_dev, n_map, n_pcie;
+    std::vector<std::string> cached_devices;
+    std::map<int, std::vector<std::string>> cached_gpu_map;
+    std::map<std::string, std::string> cached_pcie_map;
+
+    // Sanity cap: no supported instance has anywhere near this many devices
+    static constexpr size_t MAX_CACHED_ENTRIES = 4096;
+
+    if (cached_provider.empty() ||
+        ser_des.getBuf("counts", counts, sizeof(counts)) != NIXL_SUCCESS ||
+        ser_des.getBuf("n_dev", &n_dev, sizeof(n_dev)) != NIXL_SUCCESS ||
+        n_dev > MAX_CACHED_ENTRIES) {
+        NIXL_WARN << "Topology cache " << path << " is corrupt, rediscovering";
+        return NIXL_ERR_MISMATCH;
+    }
+    for (size_t i = 0; i < n_dev; ++i) {
+        cached_devices.push_back(ser_des.getStr("dev"));
+    }
+    if (ser_des.getBuf("n_map", &n_map, sizeof(n_map)) != NIXL_SUCCESS ||
+        n_map > MAX_CACHED_ENTRIES) {
+        NIXL_WARN << "Topology cache " << path << " is corrupt, rediscovering";
+        return NIXL_ERR_MISMATCH;
+    }
+    for (size_t i = 0; i < n_map; ++i) {
+        int gpu_id;
+        size_t n;
+        if (ser_des.getBuf("gpu", &gpu_id, sizeof(gpu_id)) != NIXL_SUCCESS ||
+            ser_des.getBuf("n", &n, sizeof(n)) != NIXL_SUCCESS || n > MAX_CACHED_ENTRIES) {
+            NIXL_WARN << "Topology cache " << path << " is corrupt, rediscovering";
+            return NIXL_ERR_MISMATCH;
+        }
+        auto &gpu_devices = cached_gpu_map[gpu_id];
+        for (size_t j = 0; j < n; ++j) {
+            gpu_devices.push_back(ser_des.getStr("dev"));
+        }
+    }
+    if (ser_des.getBuf("n_pcie", &n_pcie, sizeof(n_pcie)) != NIXL_SUCCESS ||
+        n_pcie > MAX_CACHED_ENTRIES) {
+        NIXL_WARN << "Topology cache " << path << " is corrupt, rediscovering";
+        return NIXL_ERR_MISMATCH;
+    }
+    for (size_t i = 0; i < n_pcie; ++i) {
+        std::string pcie_addr = ser_des.getStr("pcie");
+        cached_pcie_map[pcie_addr] = ser_des.getStr("lf");
+    }
+
+    provider_name = std::move(cached_provider);
+    num_gpus = counts[0];
+    num_numa_nodes = counts[1];
+    num_devices = counts[2];
+    all_devices = std::move(cached_devices);
+    gpu_to_efa_devices = std::move(cached_gpu_map);
+    pcie_to_libfabric_map = std::move(cached_pcie_map);
+    libfabric_to_pcie_map.clear();
+    for (const auto &pair : pcie_to_libfabric_map) {
+        libfabric_to_pcie_map[pair.second] = pair.first;
+    }
+    topology_discovered = true;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLibfabricTopology::saveTopologyCache(const std::string &inventory_hash) const {
+    const std::string path = getCacheFilePath();
+    if (path.empty() || inventory_hash.empty()) {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    nixlSerDes ser_des;
+    ser_des.addStr("inv_hash", inventory_hash);
+    ser_des.addStr("provider", provider_name);
+    int counts[3] = {num_gpus, num_numa_nodes, num_devices};
+    ser_des.addBuf("counts", counts, sizeof(counts));
+    size_t n_dev = all_devices.size();
+    ser_des.addBuf("n_dev", &n_dev, sizeof(n_dev));
+    for (const auto &device : all_devices) {
+        ser_des.addStr("dev", device);
+    }
+    size_t n_map = gpu_to_efa_devices.size();
+    ser_des.addBuf("n_map", &n_map, sizeof(n_map));
+    for (const auto &pair : gpu_to_efa_devices) {
+        int gpu_id = pair.first;
+        ser_des.addBuf("gpu", &gpu_id, sizeof(gpu_id));
+        size_t n = pair.second.size();
+        ser_des.addBuf("n", &n, sizeof(n));
+        for (const auto &device : pair.second) {
+            ser_des.addStr("dev", device);
+        }
+    }
+    size_t n_pcie = pcie_to_libfabric_map.size();
+    ser_des.addBuf("n_pcie", &n_pcie, sizeof(n_pcie));
+    for (const auto &pair : pcie_to_libfabric_map) {
+        ser_des.addStr("pcie", pair.first);
+        ser_des.addStr("lf", pair.second);
+    }
+
+    // Write to a temp file and rename so a concurrent startup never reads a
+    // partially written snapshot.
+    const std::string tmp_path = path + "." + std::to_string(getpid());
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        NIXL_DEBUG << "Cannot open topology cache " << tmp_path << " for writing";
+        return NIXL_ERR_BACKEND;
+    }
+    const std::string blob = ser_des.exportStr();
+    file.write(blob.data(), blob.size());
+    file.close();
+    if (!file || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        NIXL_DEBUG << "Failed to write topology cache " << path;
+        std::remove(tmp_path.c_str());
+        return NIXL_ERR_BACKEND;
+    }
+    NIXL_INFO << "Saved topology cache to " << path;
+    return NIXL_SUCCESS;
+}
+
 // hwloc helper methods
 
 std::string
@@ -113,6 +113,18 @@ private:
                       const std::vector<GpuInfo> &discovered_gpus,
                       std::vector<NicGroup> &nic_groups);
 
+    // Persistent topology cache: a serialized snapshot keyed by a hardware
+    // inventory hash lets identical nodes skip the fi_getinfo/hwloc probing
+    // on repeat startups.
+    std::string
+    computeInventoryHash() const;
+    std::string
+    getCacheFilePath() const;
+    nixl_status_t
+    loadTopologyCache(const std::string &inventory_hash);
+    nixl_status_t
+    saveTopologyCache(const std::string &inventory_hash) const;
+
     // hwloc helper methods
     std::string
     getPcieAddressFromHwlocObj(hwloc_obj_t obj) const;
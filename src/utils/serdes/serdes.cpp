@@ -17,13 +17,42 @@
 #include "serdes.h"
 #include "common/nixl_log.h"
 
-nixlSerDes::nixlSerDes() {
-    workingStr = "nixlSerDes|";
-    des_offset = 11;
+// Binary format header: distinguishable from the tagged "nixlSerDes|"
+// header at the same offset, followed by a format version byte
+static const std::string binHeader = std::string("nixlSerDesB") + '\x01';
+
+nixlSerDes::nixlSerDes(ser_format_t fmt) {
+    format = fmt;
+    if (format == NIXL_SERDES_BINARY) {
+        workingStr.assign(binHeader.data(), binHeader.size());
+    } else {
+        workingStr = "nixlSerDes|";
+    }
+    des_offset = workingStr.size();
 
     mode = SERIALIZE;
 }
 
+// Unsigned LEB128: 7 bits per byte, high bit marks continuation
+void nixlSerDes::appendVarint(size_t val) {
+    while (val >= 0x80) {
+        workingStr.push_back(static_cast<char>((val & 0x7f) | 0x80));
+        val >>= 7;
+    }
+    workingStr.push_back(static_cast<char>(val));
+}
+
+bool nixlSerDes::readVarint(ssize_t &offset, size_t &val) const {
+    val = 0;
+    for (int shift = 0; offset < (ssize_t)workingStr.size(); shift += 7) {
+        unsigned char byte = workingStr[offset++];
+        val |= static_cast<size_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+            return true;
+    }
+    return false;
+}
+
 std::string nixlSerDes::_bytesToString(const void *buf, ssize_t size) {
     std::string ret_str = std::string(reinterpret_cast<const char*>(buf), size);
     return ret_str;
@@ -38,17 +67,37 @@ nixl_status_t nixlSerDes::addStr(const std::string &tag, const std::string &str)
 
     size_t len = str.size();
 
-    workingStr.append(tag);
-    workingStr.append(_bytesToString(&len, sizeof(size_t)));
-    workingStr.append(str);
+    if (format == NIXL_SERDES_BINARY) {
+        appendVarint(len);
+        workingStr.append(str.data(), str.size());
+        maybeFlushChunk();
+        return NIXL_SUCCESS;
+    }
+
+    workingStr.append(tag.data(), tag.size());
+    workingStr.append(reinterpret_cast<const char*>(&len), sizeof(size_t));
+    workingStr.append(str.data(), str.size());
     workingStr.append("|");
+    maybeFlushChunk();
 
     return NIXL_SUCCESS;
 }
 
 std::string nixlSerDes::getStr(const std::string &tag){
 
-    if(workingStr.compare(des_offset, tag.size(), tag) != 0){
+    if (format == NIXL_SERDES_BINARY) {
+        size_t len;
+        if (!readVarint(des_offset, len) ||
+            des_offset + (ssize_t)len > (ssize_t)workingStr.size()) {
+            NIXL_ERROR << "Deserialization of tag " << tag << " failed";
+            return "";
+        }
+        std::string ret(workingStr.data() + des_offset, len);
+        des_offset += len;
+        return ret;
+    }
+
+    if(workingStr.compare(des_offset, tag.size(), tag.data(), tag.size()) != 0){
         NIXL_ERROR << "Deserialization of tag " << tag << " failed";
         return "";
     }
@@ -58,12 +107,11 @@ std::string nixlSerDes::getStr(const std::string &tag){
     des_offset += tag.size();
 
     //get len
-    //_stringToBytes(&len, workingStr.data() + des_offset, sizeof(ssize_t));
-    _stringToBytes(&len, workingStr.substr(des_offset, sizeof(ssize_t)), sizeof(ssize_t));
+    memcpy(&len, workingStr.data() + des_offset, sizeof(ssize_t));
     des_offset += sizeof(ssize_t);
 
     //get string
-    std::string ret = workingStr.substr(des_offset, len);
+    std::string ret(workingStr.data() + des_offset, len);
 
     //move past string plus | delimiter
     des_offset += len + 1;
@@ -76,16 +124,35 @@ std::string nixlSerDes::getStr(const std::string &tag){
 // Byte buffers serialization
 nixl_status_t nixlSerDes::addBuf(const std::string &tag, const void* buf, ssize_t len){
 
-    workingStr.append(tag);
-    workingStr.append(_bytesToString(&len, sizeof(ssize_t)));
-    workingStr.append(_bytesToString(buf, len));
+    if (format == NIXL_SERDES_BINARY) {
+        appendVarint(len);
+        workingStr.append(reinterpret_cast<const char*>(buf), len);
+        maybeFlushChunk();
+        return NIXL_SUCCESS;
+    }
+
+    workingStr.append(tag.data(), tag.size());
+    workingStr.append(reinterpret_cast<const char*>(&len), sizeof(ssize_t));
+    workingStr.append(reinterpret_cast<const char*>(buf), len);
     workingStr.append("|");
+    maybeFlushChunk();
 
     return NIXL_SUCCESS;
 }
 
 ssize_t nixlSerDes::getBufLen(const std::string &tag) const{
-    if(workingStr.compare(des_offset, tag.size(), tag) != 0){
+    if (format == NIXL_SERDES_BINARY) {
+        // Peek: do not advance past the length, getBuf re-reads it
+        ssize_t offset = des_offset;
+        size_t len;
+        if (!readVarint(offset, len)) {
+            NIXL_ERROR << "Deserialization of tag " << tag << " failed";
+            return -1;
+        }
+        return (ssize_t)len;
+    }
+
+    if(workingStr.compare(des_offset, tag.size(), tag.data(), tag.size()) != 0){
         NIXL_ERROR << "Deserialization of tag " << tag << " failed";
         return -1;
     }
@@ -93,8 +160,7 @@ ssize_t nixlSerDes::getBufLen(const std::string &tag) const{
     ssize_t len;
 
     //get len
-    //_stringToBytes(&len, workingStr.data() + des_offset + tag.size(), sizeof(ssize_t));
-    _stringToBytes(&len, workingStr.substr(des_offset + tag.size(), sizeof(ssize_t)), sizeof(ssize_t));
+    memcpy(&len, workingStr.data() + des_offset + tag.size(), sizeof(ssize_t));
 
     if (len == 0) NIXL_WARN << "In deserialization of tag " << tag << " the buffer length ios 0";
 
@@ -102,7 +168,19 @@ ssize_t nixlSerDes::getBufLen(const std::string &tag) const{
 }
 
 nixl_status_t nixlSerDes::getBuf(const std::string &tag, void *buf, ssize_t len){
-    if(workingStr.compare(des_offset, tag.size(), tag) != 0){
+    if (format == NIXL_SERDES_BINARY) {
+        size_t stored_len;
+        if (!readVarint(des_offset, stored_len) || (ssize_t)stored_len != len ||
+            des_offset + len > (ssize_t)workingStr.size()) {
+            NIXL_ERROR << "Deserialization of tag " << tag << " failed";
+            return NIXL_ERR_MISMATCH;
+        }
+        memcpy(buf, workingStr.data() + des_offset, len);
+        des_offset += len;
+        return NIXL_SUCCESS;
+    }
+
+    if(workingStr.compare(des_offset, tag.size(), tag.data(), tag.size()) != 0){
         NIXL_ERROR << "Deserialization of tag " << tag << " failed";
         return NIXL_ERR_MISMATCH;
     }
@@ -110,8 +188,7 @@ nixl_status_t nixlSerDes::getBuf(const std::string &tag, void *buf, ssize_t len)
     //skip over tag and size, which we assume has been read previously
     des_offset += tag.size() + sizeof(ssize_t);
 
-    //_stringToBytes(buf, workingStr.data() + des_offset, len);
-    _stringToBytes(buf, workingStr.substr(des_offset, len), len);
+    memcpy(buf, workingStr.data() + des_offset, len);
 
     //bytes in string form are twice as long, skip those plus | delimiter
     des_offset += len + 1;
@@ -119,21 +196,47 @@ nixl_status_t nixlSerDes::getBuf(const std::string &tag, void *buf, ssize_t len)
     return NIXL_SUCCESS;
 }
 
+void nixlSerDes::setChunkSink(size_t chunk_size, std::function<void(std::string&&)> sink) {
+    chunkSize = chunk_size;
+    chunkSink = std::move(sink);
+}
+
+void nixlSerDes::flushChunk() {
+    if (chunkSink && !workingStr.empty()) {
+        chunkSink(std::string(workingStr.data(), workingStr.size()));
+        workingStr.clear();
+    }
+}
+
+// Fields are handed off whole, so a chunk can overshoot chunk_size by up
+// to the size of the last field appended
+void nixlSerDes::maybeFlushChunk() {
+    if (chunkSink && workingStr.size() >= chunkSize)
+        flushChunk();
+}
+
 // Buffer management serialization
 std::string nixlSerDes::exportStr() const {
-    return workingStr;
+    return std::string(workingStr.data(), workingStr.size());
 }
 
 nixl_status_t nixlSerDes::importStr(const std::string &sdbuf) {
 
-    if(sdbuf.compare(0, 11, "nixlSerDes|") != 0){
+    // Format is detected from the header, so a binary blob can be
+    // imported into a default-constructed instance and vice versa
+    if (sdbuf.compare(0, binHeader.size(), binHeader) == 0) {
+        format = NIXL_SERDES_BINARY;
+        des_offset = binHeader.size();
+    } else if (sdbuf.compare(0, 11, "nixlSerDes|") == 0) {
+        format = NIXL_SERDES_TAGGED;
+        des_offset = 11;
+    } else {
         NIXL_ERROR << "Deserialization failed, missing nixlSerDes tag";
         return NIXL_ERR_MISMATCH;
     }
 
-    workingStr = sdbuf;
+    workingStr.assign(sdbuf.data(), sdbuf.size());
     mode = DESERIALIZE;
-    des_offset = 11;
 
     return NIXL_SUCCESS;
 }
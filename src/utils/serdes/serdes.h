@@ -18,21 +18,44 @@
 #define __SERDES_H
 
 #include <cstring>
+#include <functional>
 #include <string>
 #include <cstdint>
 
 #include "nixl_types.h"
+#include "common/nixl_arena.h"
 
 class nixlSerDes {
+public:
+    /* Wire formats: TAGGED is the original human-readable tag|len|payload
+     * encoding; BINARY drops the field-name strings and uses varint lengths,
+     * shrinking metadata blobs and encode/decode cost considerably. Both
+     * sides auto-detect the format from the header on import. */
+    typedef enum { NIXL_SERDES_TAGGED, NIXL_SERDES_BINARY } ser_format_t;
+
 private:
     typedef enum { SERIALIZE, DESERIALIZE } ser_mode_t;
 
-    std::string workingStr;
+    /* Working buffer comes from the internal arena when one is configured
+     * (huge pages / NUMA-bound, see nixlMemArena), plain heap otherwise */
+    using ser_buffer_t =
+        std::basic_string<char, std::char_traits<char>, nixlArenaAllocator<char>>;
+
+    ser_buffer_t workingStr;
     ssize_t des_offset;
     ser_mode_t mode;
+    ser_format_t format;
+
+    /* Streaming serialization state, unused unless a sink is installed */
+    size_t chunkSize = 0;
+    std::function<void(std::string&&)> chunkSink;
+
+    void appendVarint(size_t val);
+    bool readVarint(ssize_t &offset, size_t &val) const;
+    void maybeFlushChunk();
 
 public:
-    nixlSerDes();
+    nixlSerDes(ser_format_t fmt = NIXL_SERDES_TAGGED);
 
     /* Ser/Des for Strings */
     nixl_status_t addStr(const std::string &tag, const std::string &str);
@@ -43,6 +66,15 @@ public:
     ssize_t getBufLen(const std::string &tag) const;
     nixl_status_t getBuf(const std::string &tag, void *buf, ssize_t len);
 
+    /* Streaming serialization: with a sink installed, completed output is
+     * handed off in chunks of roughly chunk_size bytes as fields are added,
+     * so a consumer can overlap transmission with serialization. The
+     * receiver reassembles the byte stream before import, so chunk
+     * boundaries are invisible to the wire format. flushChunk() pushes the
+     * remaining tail; exportStr() must not be used on a streamed instance. */
+    void setChunkSink(size_t chunk_size, std::function<void(std::string&&)> sink);
+    void flushChunk();
+
     /* Ser/Des buffer management */
     std::string exportStr() const;
     nixl_status_t importStr(const std::string &sdbuf);
@@ -60,6 +60,7 @@ class nixlMDStreamListener: public nixlMetadataStream {
         ~nixlMDStreamListener();
 
         int         acceptClient();
+        int         getFd() const { return socketFd; }
         void        setupListener();
         void        startListenerForClients();
         void        startListenerForClient();
@@ -41,7 +41,8 @@ using namespace std;
 
 [[nodiscard]] nixl_b_params_t
 get_ucx_backend_common_options() {
-    nixl_b_params_t params = {{"ucx_devices", ""}, {"num_workers", "1"}};
+    nixl_b_params_t params = {
+        {"ucx_devices", ""}, {"num_workers", "1"}, {"enable_recv_completion", "0"}};
 
     params.emplace(nixl_ucx_err_handling_param_name,
                    ucx_err_mode_to_string(UCP_ERR_HANDLING_MODE_PEER));
@@ -134,6 +135,10 @@ void nixlUcxEp::err_cb(ucp_ep_h ucp_ep, ucs_status_t status)
         // The EP has been disconnected, nothing to do
         return;
     case NIXL_UCX_EP_STATE_CONNECTED:
+        // First failure of this EP: surface the native status before it is
+        // collapsed into a generic NIXL error downstream
+        if (errNotify_)
+            errNotify_(status);
         setState(NIXL_UCX_EP_STATE_FAILED);
         request = ucp_ep_close_nb(ucp_ep, UCP_EP_CLOSE_MODE_FORCE);
         if (UCS_PTR_IS_PTR(request)) {
@@ -384,7 +389,8 @@ nixlUcxContext::nixlUcxContext(std::vector<std::string> devs,
                                nixlUcxContext::req_cb_t fini_cb,
                                bool prog_thread,
                                unsigned long num_workers,
-                               nixl_thread_sync_t sync_mode)
+                               nixl_thread_sync_t sync_mode,
+                               const std::string &rndv_thresh)
 {
     ucp_params_t ucp_params;
 
@@ -437,7 +443,7 @@ nixlUcxContext::nixlUcxContext(std::vector<std::string> devs,
     ucp_get_version(&major_version, &minor_version, &release_number);
 
     config.modify ("ADDRESS_VERSION", "v2");
-    config.modify ("RNDV_THRESH", "inf");
+    config.modify ("RNDV_THRESH", rndv_thresh.empty() ? "inf" : rndv_thresh.c_str());
 
     unsigned ucp_version = UCP_VERSION(major_version, minor_version);
     if (ucp_version >= UCP_VERSION(1, 19)) {
@@ -539,7 +545,8 @@ absl::StatusOr<std::unique_ptr<nixlUcxEp>> nixlUcxWorker::connect(void* addr, st
  * =========================================== */
 
 
-int nixlUcxContext::memReg(void *addr, size_t size, nixlUcxMem &mem, nixl_mem_t nixl_mem_type)
+int nixlUcxContext::memReg(void *addr, size_t size, nixlUcxMem &mem, nixl_mem_t nixl_mem_type,
+                           int dmabuf_fd, size_t dmabuf_offset)
 {
     //mem.uw = this;
     mem.base = addr;
@@ -553,6 +560,20 @@ int nixlUcxContext::memReg(void *addr, size_t size, nixlUcxMem &mem, nixl_mem_t
         .length  = mem.size,
     };
 
+    if (dmabuf_fd >= 0) {
+#if UCP_API_VERSION >= UCP_VERSION(1, 16)
+        // Map through the dmabuf fd so the registration does not depend on
+        // peer-direct address translation (dmabuf_offset requires UCX >= 1.16)
+        mem_params.field_mask |= UCP_MEM_MAP_PARAM_FIELD_DMABUF_FD |
+                                 UCP_MEM_MAP_PARAM_FIELD_DMABUF_OFFSET;
+        mem_params.dmabuf_fd = dmabuf_fd;
+        mem_params.dmabuf_offset = dmabuf_offset;
+#else
+        NIXL_WARN << "dmabuf fd provided but UCX lacks dmabuf mapping support,"
+                     " falling back to address-based registration";
+#endif
+    }
+
     ucs_status_t status = ucp_mem_map(ctx, &mem_params, &mem.memh);
     if (status != UCS_OK) {
         /* TODOL: MSW_NET_ERROR(priv->net, "failed to ucp_mem_map (%s)\n", ucs_status_string(status)); */
@@ -680,6 +701,16 @@ void nixlUcxWorker::reqCancel(nixlUcxReq req)
     ucp_request_cancel(worker.get(), req);
 }
 
+nixl_status_t
+nixlUcxWorker::fence() const noexcept {
+    return ucx_status_to_nixl(ucp_worker_fence(worker.get()));
+}
+
+void
+nixlUcxWorker::dumpInfo() const {
+    ucp_worker_print_info(worker.get(), stderr);
+}
+
 nixl_status_t
 nixlUcxWorker::arm() const noexcept {
     return ucx_status_to_nixl(ucp_worker_arm(worker.get()));
@@ -17,6 +17,7 @@
 #ifndef NIXL_SRC_UTILS_UCX_UCX_UTILS_H
 #define NIXL_SRC_UTILS_UCX_UCX_UTILS_H
 
+#include <functional>
 #include <memory>
 #include <type_traits>
 
@@ -94,6 +95,10 @@ class nixlUcxEp {
 private:
     ucp_ep_h            eph{nullptr};
     nixl_ucx_ep_state_t state{NIXL_UCX_EP_STATE_NULL};
+    // Observer invoked with the native status when the EP first fails,
+    // before it is collapsed into a generic NIXL error; set by the engine
+    // for structured error telemetry
+    std::function<void(ucs_status_t)> errNotify_;
 
     void setState(nixl_ucx_ep_state_t new_state);
     nixl_status_t closeImpl(ucp_ep_close_flags_t flags);
@@ -152,6 +157,11 @@ public:
     getEp() const noexcept {
         return eph;
     }
+
+    void
+    setErrNotify(std::function<void(ucs_status_t)> cb) {
+        errNotify_ = std::move(cb);
+    }
 };
 
 class nixlUcxMem {
@@ -188,17 +198,21 @@ private:
 public:
 
     using req_cb_t = void(void *request);
+    // rndv_thresh overrides the context's eager/rendezvous switch point
+    // (UCX RNDV_THRESH syntax); empty keeps the historical "inf"
     nixlUcxContext(std::vector<std::string> devices,
                    size_t req_size,
                    req_cb_t init_cb,
                    req_cb_t fini_cb,
                    bool prog_thread,
                    unsigned long num_workers,
-                   nixl_thread_sync_t sync_mode);
+                   nixl_thread_sync_t sync_mode,
+                   const std::string &rndv_thresh = "");
     ~nixlUcxContext();
 
     /* Memory management */
-    int memReg(void *addr, size_t size, nixlUcxMem &mem, nixl_mem_t nixl_mem_type);
+    int memReg(void *addr, size_t size, nixlUcxMem &mem, nixl_mem_t nixl_mem_type,
+               int dmabuf_fd = -1, size_t dmabuf_offset = 0);
     [[nodiscard]] std::string packRkey(nixlUcxMem &mem);
     void memDereg(nixlUcxMem &mem);
 
@@ -239,6 +253,16 @@ public:
     [[nodiscard]] nixl_status_t
     arm() const noexcept;
 
+    /* Orders operations posted after the fence behind those posted
+     * before it, per endpoint, without blocking */
+    [[nodiscard]] nixl_status_t
+    fence() const noexcept;
+
+    /* Diagnostics: print the UCP worker state (transports, endpoints,
+     * outstanding operations) for stall analysis */
+    void
+    dumpInfo() const;
+
     [[nodiscard]] int
     getEfd() const;
 
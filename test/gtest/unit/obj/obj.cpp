@@ -497,6 +497,139 @@ TEST_F(objTestFixture, AsyncWriteTransferFailureIsHandled) {
     testAsyncTransferFailureIsHandled(NIXL_WRITE);
 }
 
+TEST_F(objTestFixture, MultipartReadFansOutAcrossParts) {
+    constexpr size_t part_size = 65536;
+    customParams_["multipart_threshold"] = std::to_string(part_size);
+    customParams_["part_size"] = std::to_string(part_size);
+    auto mock = std::make_shared<mockS3Client>();
+    nixlObjEngine engine(&initParams_, mock);
+    mock->setSimulateSuccess(true);
+
+    std::vector<char> test_buffer(4 * part_size);
+
+    nixlBlobDesc local_desc, remote_desc;
+    local_desc.devId = 1;
+    remote_desc.devId = 2;
+    remote_desc.metaInfo = "test-multipart-key";
+    nixlBackendMD *local_metadata = nullptr;
+    nixlBackendMD *remote_metadata = nullptr;
+    ASSERT_EQ(engine.registerMem(local_desc, DRAM_SEG, local_metadata), NIXL_SUCCESS);
+    ASSERT_EQ(engine.registerMem(remote_desc, OBJ_SEG, remote_metadata), NIXL_SUCCESS);
+
+    nixl_meta_dlist_t local_descs(DRAM_SEG);
+    nixl_meta_dlist_t remote_descs(OBJ_SEG);
+    local_descs.addDesc(
+        nixlMetaDesc(reinterpret_cast<uintptr_t>(test_buffer.data()), test_buffer.size(), 1));
+    remote_descs.addDesc(nixlMetaDesc(0, test_buffer.size(), 2));
+
+    nixlBackendReqH *handle = nullptr;
+    ASSERT_EQ(
+        engine.prepXfer(
+            NIXL_READ, local_descs, remote_descs, initParams_.localAgent, handle, nullptr),
+        NIXL_SUCCESS);
+    ASSERT_NE(handle, nullptr);
+
+    nixl_status_t status = engine.postXfer(
+        NIXL_READ, local_descs, remote_descs, initParams_.localAgent, handle, nullptr);
+    EXPECT_EQ(status, NIXL_IN_PROG);
+    // One ranged GET per part
+    EXPECT_EQ(mock->getPendingCount(), 4);
+    EXPECT_EQ(engine.checkXfer(handle), NIXL_IN_PROG);
+
+    mock->execAsync();
+    EXPECT_EQ(engine.checkXfer(handle), NIXL_SUCCESS);
+    EXPECT_EQ(test_buffer[0], 'A');
+    EXPECT_EQ(test_buffer[part_size], static_cast<char>('A' + (part_size % 26)));
+
+    engine.releaseReqH(handle);
+    engine.deregisterMem(local_metadata);
+    engine.deregisterMem(remote_metadata);
+}
+
+TEST_F(objTestFixture, PackedWritesCoalesceIntoOneContainer) {
+    constexpr size_t block_size = 1024;
+    customParams_["pack_threshold"] = std::to_string(4 * block_size);
+    auto mock = std::make_shared<mockS3Client>();
+    nixlObjEngine engine(&initParams_, mock);
+    mock->setSimulateSuccess(true);
+
+    std::vector<char> write_buffer0(block_size);
+    std::vector<char> write_buffer1(block_size);
+
+    nixlBlobDesc local_desc, remote_desc0, remote_desc1;
+    local_desc.devId = 1;
+    remote_desc0.devId = 2;
+    remote_desc0.metaInfo = "pack-key-0";
+    remote_desc1.devId = 3;
+    remote_desc1.metaInfo = "pack-key-1";
+    nixlBackendMD *local_metadata = nullptr;
+    nixlBackendMD *remote_metadata0 = nullptr;
+    nixlBackendMD *remote_metadata1 = nullptr;
+    ASSERT_EQ(engine.registerMem(local_desc, DRAM_SEG, local_metadata), NIXL_SUCCESS);
+    ASSERT_EQ(engine.registerMem(remote_desc0, OBJ_SEG, remote_metadata0), NIXL_SUCCESS);
+    ASSERT_EQ(engine.registerMem(remote_desc1, OBJ_SEG, remote_metadata1), NIXL_SUCCESS);
+
+    nixl_meta_dlist_t local_descs(DRAM_SEG);
+    nixl_meta_dlist_t remote_descs(OBJ_SEG);
+    local_descs.addDesc(
+        nixlMetaDesc(reinterpret_cast<uintptr_t>(write_buffer0.data()), block_size, 1));
+    local_descs.addDesc(
+        nixlMetaDesc(reinterpret_cast<uintptr_t>(write_buffer1.data()), block_size, 1));
+    remote_descs.addDesc(nixlMetaDesc(0, block_size, 2));
+    remote_descs.addDesc(nixlMetaDesc(0, block_size, 3));
+
+    nixlBackendReqH *handle = nullptr;
+    ASSERT_EQ(
+        engine.prepXfer(
+            NIXL_WRITE, local_descs, remote_descs, initParams_.localAgent, handle, nullptr),
+        NIXL_SUCCESS);
+
+    nixl_status_t status = engine.postXfer(
+        NIXL_WRITE, local_descs, remote_descs, initParams_.localAgent, handle, nullptr);
+    EXPECT_EQ(status, NIXL_IN_PROG);
+    // Both small writes collapse into a single container PUT
+    EXPECT_EQ(mock->getPendingCount(), 1);
+
+    mock->execAsync();
+    EXPECT_EQ(engine.checkXfer(handle), NIXL_SUCCESS);
+    engine.releaseReqH(handle);
+
+    // Reading a packed object back is a ranged GET inside the container:
+    // the second entry sits after the first one's payload
+    std::vector<char> read_buffer(block_size, 0);
+    nixl_meta_dlist_t read_local_descs(DRAM_SEG);
+    nixl_meta_dlist_t read_remote_descs(OBJ_SEG);
+    read_local_descs.addDesc(
+        nixlMetaDesc(reinterpret_cast<uintptr_t>(read_buffer.data()), block_size, 1));
+    read_remote_descs.addDesc(nixlMetaDesc(0, block_size, 3));
+
+    nixlBackendReqH *read_handle = nullptr;
+    ASSERT_EQ(engine.prepXfer(NIXL_READ,
+                              read_local_descs,
+                              read_remote_descs,
+                              initParams_.localAgent,
+                              read_handle,
+                              nullptr),
+              NIXL_SUCCESS);
+    status = engine.postXfer(NIXL_READ,
+                             read_local_descs,
+                             read_remote_descs,
+                             initParams_.localAgent,
+                             read_handle,
+                             nullptr);
+    EXPECT_EQ(status, NIXL_IN_PROG);
+    EXPECT_EQ(mock->getPendingCount(), 1);
+
+    mock->execAsync();
+    EXPECT_EQ(engine.checkXfer(read_handle), NIXL_SUCCESS);
+    EXPECT_EQ(read_buffer[0], static_cast<char>('A' + (block_size % 26)));
+
+    engine.releaseReqH(read_handle);
+    engine.deregisterMem(local_metadata);
+    engine.deregisterMem(remote_metadata0);
+    engine.deregisterMem(remote_metadata1);
+}
+
 TEST_F(objTestFixture, CheckObjectExists) {
     nixl_reg_dlist_t descs(OBJ_SEG);
     descs.addDesc(nixlBlobDesc(nixlBasicDesc(), "test-key-1"));
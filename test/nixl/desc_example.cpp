@@ -289,6 +289,27 @@ int main()
     nixl_reg_dlist_t importSList (ser_des2);
     nixl_exit_on_failure((importSList == dlist20), "Descriptor importSList does not match dlist20");
 
+    // Uniform list (fixed block size at a regular stride, same metadata)
+    // takes the run-length encoded wire format; round trip must still match
+    nixlSerDes* ser_des3 = new nixlSerDes();
+    nixl_reg_dlist_t dlistUniform(VRAM_SEG);
+    for (int i=0; i<16; ++i) {
+        nixlBlobDesc blk (0x10000 + i * 4096, 4096, 0);
+        blk.metaInfo = "pool";
+        dlistUniform.addDesc(blk);
+    }
+    // Break the stride at the tail, so the list serializes as two runs
+    nixlBlobDesc odd (0x90000, 4096, 0);
+    odd.metaInfo = "pool";
+    dlistUniform.addDesc(odd);
+
+    nixl_exit_on_failure((dlistUniform.serialize(ser_des3) == 0),
+                         "Failed to serialize dlistUniform");
+    nixl_reg_dlist_t importUniform (ser_des3);
+    nixl_exit_on_failure((importUniform == dlistUniform),
+                         "Descriptor importUniform does not match dlistUniform");
+    delete ser_des3;
+
     dlist10.print();
     std::cout << "this should be a copy:\n";
     importList.print();
@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "nixl_lz.h"
+
+// Round-trips one input through the codec and checks the decoded bytes
+// match. The decoder must reconstruct exactly src_len bytes.
+static void
+roundtrip(const std::vector<uint8_t> &src) {
+    std::vector<uint8_t> comp(nixlLzCompressBound(src.size()));
+    size_t clen = nixlLzCompress(src.data(), src.size(), comp.data(), comp.size());
+    assert(clen > 0);
+
+    std::vector<uint8_t> dec(src.size());
+    size_t dlen = nixlLzDecompress(comp.data(), clen, dec.data(), dec.size());
+    assert(dlen == src.size());
+    assert(memcmp(dec.data(), src.data(), src.size()) == 0);
+}
+
+static std::vector<uint8_t>
+compressible(size_t len) {
+    // Repeating phrase: plenty of matches within the 64KB offset window
+    static const char phrase[] = "nixl spill tier block payload ";
+    std::vector<uint8_t> buf(len);
+    for (size_t i = 0; i < len; ++i)
+        buf[i] = uint8_t(phrase[i % (sizeof(phrase) - 1)]);
+    return buf;
+}
+
+static std::vector<uint8_t>
+incompressible(size_t len, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<uint8_t> buf(len);
+    for (size_t i = 0; i < len; ++i)
+        buf[i] = uint8_t(rng());
+    return buf;
+}
+
+int main() {
+
+    const size_t sizes[] = {1, 5, 12, 13, 64, 4096, 1u << 20};
+
+    // Round-trip: compressible, incompressible and mixed inputs across
+    // sizes below and above the encoder's small-input cutoff
+    for (size_t len : sizes) {
+        roundtrip(compressible(len));
+        roundtrip(incompressible(len, uint32_t(len)));
+
+        std::vector<uint8_t> mixed = compressible(len);
+        std::vector<uint8_t> noise = incompressible(len - len / 2, 7);
+        mixed.resize(len / 2);
+        mixed.insert(mixed.end(), noise.begin(), noise.end());
+        roundtrip(mixed);
+    }
+
+    // Repetitive input must actually shrink
+    {
+        std::vector<uint8_t> src = compressible(1u << 20);
+        std::vector<uint8_t> comp(nixlLzCompressBound(src.size()));
+        size_t clen = nixlLzCompress(src.data(), src.size(), comp.data(), comp.size());
+        assert(clen > 0 && clen < src.size());
+    }
+
+    // Undersized output buffers: compress signals "store raw" with 0, and
+    // decompress rejects an output cap below the decoded length
+    {
+        std::vector<uint8_t> src = incompressible(4096, 11);
+        std::vector<uint8_t> small(src.size() / 2);
+        assert(nixlLzCompress(src.data(), src.size(), small.data(), small.size()) == 0);
+
+        std::vector<uint8_t> comp(nixlLzCompressBound(src.size()));
+        size_t clen = nixlLzCompress(src.data(), src.size(), comp.data(), comp.size());
+        assert(clen > 0);
+        std::vector<uint8_t> dec(src.size() - 1);
+        assert(nixlLzDecompress(comp.data(), clen, dec.data(), dec.size()) == 0);
+    }
+
+    // Corruption rejection on a blob with real match sequences
+    {
+        std::vector<uint8_t> src = compressible(4096);
+        std::vector<uint8_t> comp(nixlLzCompressBound(src.size()));
+        size_t clen = nixlLzCompress(src.data(), src.size(), comp.data(), comp.size());
+        assert(clen > 0);
+        std::vector<uint8_t> dec(src.size());
+
+        // Locate the first match offset by parsing the sequence header
+        size_t pos = 0;
+        size_t lit = comp[pos++] >> 4;
+        if (lit == 15) {
+            uint8_t b;
+            do {
+                b = comp[pos++];
+                lit += b;
+            } while (b == 255);
+        }
+        pos += lit;
+        assert(pos + 1 < clen); // repetitive input must contain a match
+
+        // Zero offset is invalid in the block format
+        std::vector<uint8_t> bad = comp;
+        bad[pos] = 0;
+        bad[pos + 1] = 0;
+        assert(nixlLzDecompress(bad.data(), clen, dec.data(), dec.size()) == 0);
+
+        // Offset pointing before the start of the decoded output
+        bad = comp;
+        bad[pos] = 0xFF;
+        bad[pos + 1] = 0xFF;
+        assert(nixlLzDecompress(bad.data(), clen, dec.data(), dec.size()) == 0);
+
+        // Truncation at every prefix length: must never claim more output
+        // than the real decoded size, and usually detects the cut
+        for (size_t cut = 0; cut < clen; ++cut) {
+            size_t dlen = nixlLzDecompress(comp.data(), cut, dec.data(), dec.size());
+            assert(dlen <= src.size());
+        }
+    }
+
+    std::cout << "nixl_lz_test passed\n";
+    return 0;
+}
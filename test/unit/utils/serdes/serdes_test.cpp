@@ -61,5 +61,33 @@ int main() {
 
     free(ptr);
 
+    // Binary format round trip, format is auto-detected on import
+    nixlSerDes bsd(nixlSerDes::NIXL_SERDES_BINARY);
+
+    ret = bsd.addBuf(t1, &i, sizeof(i));
+    assert(ret == 0);
+
+    ret = bsd.addStr(t2, s);
+    assert(ret == 0);
+
+    std::string bsdbuf = bsd.exportStr();
+    assert(bsdbuf.size() > 0);
+    assert(bsdbuf.size() < sdbuf.size());
+
+    nixlSerDes bsd2;
+    ret = bsd2.importStr(bsdbuf);
+    assert(ret == 0);
+
+    osize = bsd2.getBufLen(t1);
+    assert(osize == sizeof(i));
+
+    int j = 0;
+    ret = bsd2.getBuf(t1, &j, osize);
+    assert(ret == 0);
+    assert(j == 0xff);
+
+    s2 = bsd2.getStr(t2);
+    assert(s2.compare("testString") == 0);
+
     return 0;
 }
@@ -0,0 +1,221 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Out-of-band telemetry reader for fleet-wide scraping. Attaches to the
+// shared memory ring a live agent writes (NIXL_TELEMETRY_DIR/<agent>) and
+// drains or tails it; the agent side never blocks on or signals readers,
+// so attaching has zero agent-side overhead. Rotated overflow segments
+// next to the ring ("<ring>.seg.NNNNNN", see telemetry_segment.h) are
+// drained oldest-first before the ring and removed once consumed. The
+// record layout is the versioned ABI in telemetry_event.h, enforced by
+// the version checks on open. Ring and segments have single-consumer
+// semantics: run one reader per telemetry file.
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/cyclic_buffer.h"
+#include "telemetry_event.h"
+#include "telemetry_segment.h"
+
+namespace {
+
+volatile sig_atomic_t g_running = true;
+
+void
+signalHandler(int signal) {
+    if (signal == SIGINT || signal == SIGTERM) {
+        g_running = false;
+    }
+}
+
+std::string
+formatTimestamp(uint64_t timestamp_us) {
+    auto time_point =
+        std::chrono::system_clock::time_point(std::chrono::microseconds(timestamp_us));
+    auto time_t = std::chrono::system_clock::to_time_t(time_point);
+
+    std::stringstream ss;
+    ss << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S");
+    ss << "." << std::setfill('0') << std::setw(6) << (timestamp_us % 1000000);
+    return ss.str();
+}
+
+void
+printEvent(const nixlTelemetryEvent &event, bool json) {
+    if (json) {
+        // One object per line so scrapers can stream the output
+        std::cout << "{\"timestamp_us\":" << event.timestampUs_ << ",\"category\":\""
+                  << nixlEnumStrings::telemetryCategoryStr(event.category_) << "\",\"event\":\""
+                  << event.eventName_ << "\",\"value\":" << event.value_ << "}\n";
+    } else {
+        std::cout << formatTimestamp(event.timestampUs_) << " "
+                  << nixlEnumStrings::telemetryCategoryStr(event.category_) << " "
+                  << event.eventName_ << " " << event.value_ << "\n";
+    }
+}
+
+// Consumes the rotated segments next to the ring oldest-first, printing
+// their events and removing each segment once drained (the segment
+// counterpart of a destructive ring pop). A segment that fails to open is
+// skipped: it may be mid-rename or from an incompatible writer.
+uint64_t
+drainSegments(const std::string &ring_path, bool json) {
+    namespace fs = std::filesystem;
+
+    const fs::path ring(ring_path);
+    const fs::path dir = ring.parent_path().empty() ? fs::path(".") : ring.parent_path();
+    const std::string prefix = ring.filename().string() + ".seg.";
+
+    std::vector<fs::path> segments;
+    std::error_code ec;
+    for (const auto &entry : fs::directory_iterator(dir, ec))
+        if (entry.path().filename().string().rfind(prefix, 0) == 0)
+            segments.push_back(entry.path());
+    std::sort(segments.begin(), segments.end());
+
+    uint64_t count = 0;
+    std::vector<nixlTelemetryEvent> events;
+    for (const auto &segment : segments) {
+        events.clear();
+        try {
+            nixlTelemetrySegmentReader reader(segment.string());
+            if (!reader.decode(events)) {
+                std::cerr << "Skipping corrupt segment " << segment << "\n";
+                continue;
+            }
+        }
+        catch (const std::exception &e) {
+            std::cerr << "Skipping segment " << segment << ": " << e.what() << "\n";
+            continue;
+        }
+        for (const auto &event : events)
+            printEvent(event, json);
+        count += events.size();
+        fs::remove(segment, ec);
+    }
+    return count;
+}
+
+void
+usage(const char *prog) {
+    std::cout << "Usage: " << prog << " [options] <telemetry_file_path>\n"
+              << "Drains the telemetry ring of a live agent, and any rotated overflow\n"
+              << "segments next to it, and prints the events.\n"
+              << "Options:\n"
+              << "  -f, --follow         keep polling for new events until interrupted\n"
+              << "  -j, --json           print one JSON object per event\n"
+              << "  -i, --interval <ms>  polling interval in follow mode (default 100)\n"
+              << "  -h, --help           show this message\n";
+}
+
+} // namespace
+
+int
+main(int argc, char *argv[]) {
+    bool follow = false;
+    bool json = false;
+    long interval_ms = 100;
+    std::string path;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            usage(argv[0]);
+            return 0;
+        } else if (arg == "-f" || arg == "--follow") {
+            follow = true;
+        } else if (arg == "-j" || arg == "--json") {
+            json = true;
+        } else if (arg == "-i" || arg == "--interval") {
+            if (++i == argc) {
+                std::cerr << arg << " requires a value\n";
+                return 1;
+            }
+            interval_ms = std::strtol(argv[i], nullptr, 10);
+            if (interval_ms <= 0) {
+                std::cerr << "Invalid polling interval: " << argv[i] << "\n";
+                return 1;
+            }
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "Unknown option: " << arg << "\n";
+            usage(argv[0]);
+            return 1;
+        } else {
+            path = std::move(arg);
+        }
+    }
+
+    if (path.empty()) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (!std::filesystem::exists(path)) {
+        std::cerr << "Telemetry file " << path << " does not exist\n";
+        return 1;
+    }
+
+    signal(SIGINT, signalHandler);
+    signal(SIGTERM, signalHandler);
+
+    try {
+        // Opening checks the stored version against TELEMETRY_VERSION and
+        // throws on mismatch, so a reader built against a different record
+        // layout fails here instead of misparsing
+        sharedRingBuffer<nixlTelemetryEvent> buffer(path, false, TELEMETRY_VERSION);
+
+        nixlTelemetryEvent event;
+        uint64_t event_count = 0;
+
+        // Segments hold history from before we attached or from bursts we
+        // fell behind on; drain them before the ring so output stays in
+        // rough timestamp order
+        event_count += drainSegments(path, json);
+
+        while (g_running) {
+            if (buffer.pop(event)) {
+                event_count++;
+                printEvent(event, json);
+            } else if (follow) {
+                event_count += drainSegments(path, json);
+                std::cout.flush();
+                std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+            } else {
+                break;
+            }
+        }
+
+        std::cout.flush();
+        std::cerr << "Events read: " << event_count << "\n";
+    }
+    catch (const std::exception &e) {
+        std::cerr << "Failed to read telemetry buffer " << path << ": " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}